@@ -1,55 +1,164 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <math.h>
+#include <peripheral_clk_config.h>
 #include "watch.h"
+#include "watch_utility.h"
 #include "lis2dw.h"
 
-static void cb_light_pressed(void) {
+// Accelerometer throughput harness. For each LIS2DW output data rate, drains the
+// accelerometer's 32-sample FIFO continuously for a fixed window and reports the
+// sustained sample rate, FIFO overruns, and the CPU-active percentage of the window,
+// through both I2C paths: the blocking watch_i2c_receive burst and the interrupt-driven
+// watch_i2c_receive_async burst (the SERCOM has no DMA channel wired up in this tree, so
+// those are the two paths a capture pipeline can choose between). These numbers size the
+// motion-capture pipeline: pick the highest rate whose CPU cost and overrun count are
+// acceptable before committing to it.
+//
+// Usage: flash onto a board with the accelerometer, connect over USB, open the serial
+// console. The suite runs once at boot and again on every ALARM press; each of the ten
+// configurations measures for four seconds, so a full run takes under a minute.
+//
+// On the async path the reported percentage is foreground cost only — the setup and
+// decode around each burst. The per-byte SERCOM interrupt time runs while the harness
+// waits and can't be separated out here, so treat the async figures as the CPU time a
+// sleeping pipeline would still have to be awake for.
+
+#define WINDOW_SECONDS 4
+
+typedef struct {
+    const char *name;
+    lis2dw_data_rate_t rate;
+    uint16_t nominal;
+} bench_rate_t;
+
+static const bench_rate_t rates[] = {
+    { "25 Hz",  LIS2DW_DATA_RATE_25_HZ,     25 },
+    { "100 Hz", LIS2DW_DATA_RATE_100_HZ,   100 },
+    { "200 Hz", LIS2DW_DATA_RATE_200_HZ,   200 },
+    { "400 Hz", LIS2DW_DATA_RATE_HP_400_HZ, 400 },
+    { "800 Hz", LIS2DW_DATA_RATE_HP_800_HZ, 800 },
+};
+
+static volatile bool run_requested = true; // run once at boot, then on each ALARM press
+static volatile bool async_done;
+
+static void cb_alarm_pressed(void) {
+    run_requested = true;
 }
 
-static void cb_mode_pressed(void) {
+static void cb_async_done(void) {
+    async_done = true;
 }
 
-static void cb_alarm_pressed(void) {
+static uint32_t drain_sync(uint32_t *samples, uint32_t *overruns) {
+    lis2dw_fifo_t fifo;
+    watch_profile_counter_start();
+    bool overrun = lis2dw_read_fifo(&fifo);
+    uint32_t cycles = watch_profile_counter_stop();
+    *samples += fifo.count;
+    if (overrun) (*overruns)++;
+    return cycles;
 }
 
-uint8_t interrupts = 0;
-uint8_t last_interrupts = 0;
-bool tick = false;
-char buf[13] = {0};
+static uint32_t drain_async(uint32_t *samples, uint32_t *overruns) {
+    static uint8_t buffer[32 * 6];
+    lis2dw_reading_t reading;
+
+    watch_profile_counter_start();
+    uint8_t temp = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_SAMPLE);
+    uint8_t count = temp & LIS2DW_FIFO_SAMPLE_COUNT;
+    if (temp & LIS2DW_FIFO_SAMPLE_OVERRUN) (*overruns)++;
+    if (count == 0) return watch_profile_counter_stop();
+
+    uint8_t reg = LIS2DW_REG_OUT_X_L | 0x80; // set high bit for consecutive reads
+    watch_i2c_send(LIS2DW_ADDRESS, &reg, 1);
+    async_done = false;
+    watch_i2c_receive_async(LIS2DW_ADDRESS, buffer, (uint16_t)count * 6, cb_async_done);
+    uint32_t cycles = watch_profile_counter_stop();
+
+    // the burst clocks in from the SERCOM interrupt; a real pipeline sleeps here, so
+    // the wait is not counted as active time.
+    while (!async_done) {}
+
+    // decode into samples like the sync path does, so the two figures compare fairly.
+    watch_profile_counter_start();
+    for (int i = 0; i < count; i++) {
+        reading.x = buffer[i * 6] | (((uint16_t)buffer[i * 6 + 1]) << 8);
+        reading.y = buffer[i * 6 + 2] | (((uint16_t)buffer[i * 6 + 3]) << 8);
+        reading.z = buffer[i * 6 + 4] | (((uint16_t)buffer[i * 6 + 5]) << 8);
+    }
+    (void) reading;
+    cycles += watch_profile_counter_stop();
+    *samples += count;
+    return cycles;
+}
 
-static void cb_tick(void) {
-    if (!lis2dw_have_new_data()) return;
+static void run_config(const bench_rate_t *config, bool async) {
+    lis2dw_set_data_rate(config->rate);
+    lis2dw_clear_fifo();
+
+    uint32_t samples = 0;
+    uint32_t overruns = 0;
+    uint64_t busy_cycles = 0;
+
+    // align to a second boundary, then measure across whole RTC seconds.
+    uint8_t second = watch_rtc_get_date_time().unit.second;
+    while (watch_rtc_get_date_time().unit.second == second) {}
+    second = watch_rtc_get_date_time().unit.second;
+    lis2dw_clear_fifo(); // drop whatever accumulated while we waited
+
+    uint8_t elapsed = 0;
+    while (elapsed < WINDOW_SECONDS) {
+        uint8_t now = watch_rtc_get_date_time().unit.second;
+        if (now != second) {
+            second = now;
+            elapsed++;
+        }
+        busy_cycles += async ? drain_async(&samples, &overruns) : drain_sync(&samples, &overruns);
+    }
 
-    tick = true;
+    uint64_t window_cycles = (uint64_t)WINDOW_SECONDS * CONF_CPU_FREQUENCY;
+    uint32_t cpu_tenths = (uint32_t)((busy_cycles * 1000) / window_cycles);
+    uint32_t rate_tenths = (samples * 10) / WINDOW_SECONDS;
+    printf("%-7s %-6s %5lu samples  %4lu.%01lu/s (nominal %u)  overruns %2lu  cpu %2lu.%01lu%%\n",
+           config->name, async ? "async" : "sync", samples,
+           rate_tenths / 10, rate_tenths % 10, config->nominal,
+           overruns, cpu_tenths / 10, cpu_tenths % 10);
+}
+
+static void run_suite(void) {
+    if (lis2dw_get_device_id() != LIS2DW_WHO_AM_I_VAL) {
+        printf("no accelerometer found\n");
+        return;
+    }
+    printf("accelerometer FIFO drain harness, %d s per configuration (CPU at %lu Hz)\n",
+           WINDOW_SECONDS, (uint32_t)CONF_CPU_FREQUENCY);
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        run_config(&rates[i], false);
+        run_config(&rates[i], true);
+    }
+    lis2dw_set_data_rate(LIS2DW_DATA_RATE_POWERDOWN);
+    printf("done\n");
 }
 
 void app_init(void) {
-    watch_enable_display();
-    watch_display_string("AC  Strean", 0);
+}
 
+void app_wake_from_backup(void) {
+}
+
+void app_setup(void) {
     watch_enable_external_interrupts();
-    watch_register_interrupt_callback(BTN_MODE, cb_mode_pressed, INTERRUPT_TRIGGER_RISING);
-    watch_register_interrupt_callback(BTN_LIGHT, cb_light_pressed, INTERRUPT_TRIGGER_RISING);
-    watch_register_interrupt_callback(BTN_ALARM, cb_alarm_pressed, INTERRUPT_TRIGGER_RISING);
+    watch_register_extwake_callback(BTN_ALARM, cb_alarm_pressed, true);
+    watch_enable_display();
 
     watch_enable_i2c();
     lis2dw_begin();
-    lis2dw_set_data_rate(LIS2DW_DATA_RATE_25_HZ);
+    lis2dw_set_mode(LIS2DW_MODE_HIGH_PERFORMANCE); // the 400 and 800 Hz rates need it
     lis2dw_set_range(LIS2DW_RANGE_4_G);
     lis2dw_set_low_noise_mode(true);
     lis2dw_enable_fifo();
-
-    lis2dw_enable_fifo();
-
-    watch_rtc_register_periodic_callback(cb_tick, 1);
-}
-
-void app_wake_from_backup(void) {
-}
-
-void app_setup(void) {
 }
 
 void app_prepare_for_standby(void) {
@@ -59,14 +168,11 @@ void app_wake_from_standby(void) {
 }
 
 bool app_loop(void) {
-    if (tick) {
-        tick = false;
-        lis2dw_fifo_t fifo;
-        lis2dw_read_fifo(&fifo);
-        for(int i = 0; i < fifo.count; i++) {
-            printf("%d, %d, %d, %d, %d\n", fifo.readings[i].x, fifo.readings[i].y, fifo.readings[i].z, i, fifo.count);
-        }
+    if (run_requested) {
+        run_requested = false;
+        watch_display_string("AC  run   ", 0);
+        run_suite();
+        watch_display_string("AC   done ", 0);
     }
-
     return true;
 }
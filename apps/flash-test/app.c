@@ -4,8 +4,24 @@
 #include <peripheral_clk_config.h>
 #include "watch.h"
 #include "lfs.h"
+#include "spiflash.h"
 #include "hpl_flash.h"
 
+// Storage throughput benchmark suite. Measures sequential and random read bandwidth at
+// several burst sizes, plus erase and program bandwidth, for both storage tiers: the
+// SAM L22's internal RWWEE region behind watch_storage.c, and (when fitted) the external
+// SPI flash behind spiflash.c. Results go to the CDC console in bytes per second, so
+// driver work — write coalescing, bulk page programming, transfer batching — has
+// before/after numbers instead of guesses.
+//
+// Usage: flash, connect over USB, open the serial console. The suite runs once at boot
+// and again on every ALARM press.
+//
+// WARNING: this app is destructive. It erases and rewrites the RWWEE region (then
+// reformats littlefs over it) and scribbles over the last sector of the SPI flash.
+// Don't run it on a watch whose filesystem or capture data you care about.
+
+// littlefs glue, used only to reformat the RWWEE region after the raw benchmarks.
 int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size);
 int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size);
 int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block);
@@ -49,56 +65,167 @@ const struct lfs_config cfg = {
 };
 
 lfs_t lfs;
-lfs_file_t file;
 
-static int _traverse_df_cb(void *p, lfs_block_t block){
-    (void) block;
-	uint32_t *nb = p;
-	*nb += 1;
-	return 0;
+#define RWWEE_ROWS (NVMCTRL_RWWEE_PAGES / 4)
+#define RWWEE_BYTES (RWWEE_ROWS * NVMCTRL_ROW_SIZE)
+#define SPI_SECTOR_SIZE 4096
+
+static uint8_t bench_buf[SPI_SECTOR_SIZE];
+static volatile bool run_requested = true; // run once at boot, then on each ALARM press
+
+static void cb_alarm_pressed(void) {
+    run_requested = true;
 }
 
-static int get_free_space(void){
-	int err;
+// a fixed-seed LCG so the "random" access patterns are identical run over run.
+static uint32_t rand_state;
 
-	uint32_t free_blocks = 0;
-	err = lfs_fs_traverse(&lfs, _traverse_df_cb, &free_blocks);
-	if(err < 0){
-		return err;
-	}
+static uint32_t next_rand(void) {
+    rand_state = rand_state * 1103515245 + 12345;
+    return rand_state >> 8;
+}
 
-	uint32_t available = cfg.block_count * cfg.block_size - free_blocks * cfg.block_size;
+static void report(const char *label, uint32_t bytes, uint32_t cycles) {
+    uint32_t rate = (uint32_t)(((uint64_t)bytes * CONF_CPU_FREQUENCY) / cycles);
+    printf("%-24s %6lu bytes %8lu cycles %8lu B/s\n", label, bytes, cycles, rate);
+}
 
-	return available;
+static void bench_rwwee_sequential_read(uint32_t burst) {
+    char label[32];
+    watch_profile_counter_start();
+    for (uint32_t addr = 0; addr < RWWEE_BYTES; addr += burst) {
+        watch_storage_read(addr / NVMCTRL_ROW_SIZE, addr % NVMCTRL_ROW_SIZE, bench_buf, burst);
+    }
+    uint32_t cycles = watch_profile_counter_stop();
+    sprintf(label, "rwwee seq read x%lu", burst);
+    report(label, RWWEE_BYTES, cycles);
 }
 
-static void cb_tick(void) {
-    watch_date_time date_time = watch_rtc_get_date_time();
-    if (date_time.unit.second == 0) {
-        int err = lfs_mount(&lfs, &cfg);
-        if (err) {
-            printf("Mount failed: %d\n", err);
-        }
-        // read current count
-        uint32_t loop_count = 0;
-        lfs_file_open(&lfs, &file, "loop_count", LFS_O_RDWR | LFS_O_CREAT);
-        lfs_file_read(&lfs, &file, &loop_count, sizeof(loop_count));
+static void bench_rwwee_random_read(void) {
+    // 256 page-aligned reads of one 64-byte page each, scattered across the region.
+    watch_profile_counter_start();
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t addr = (next_rand() % (RWWEE_BYTES / NVMCTRL_PAGE_SIZE)) * NVMCTRL_PAGE_SIZE;
+        watch_storage_read(addr / NVMCTRL_ROW_SIZE, addr % NVMCTRL_ROW_SIZE, bench_buf, NVMCTRL_PAGE_SIZE);
+    }
+    uint32_t cycles = watch_profile_counter_stop();
+    report("rwwee random read x64", 256 * NVMCTRL_PAGE_SIZE, cycles);
+}
+
+static void bench_rwwee_program(uint32_t burst) {
+    // erase and rewrite the first 8 rows through the write path, in bursts of the
+    // given size; sub-page bursts exercise the write-combining buffer.
+    char label[32];
+    const uint32_t span = 8 * NVMCTRL_ROW_SIZE;
+    memset(bench_buf, 0xA5, sizeof(bench_buf));
+
+    watch_profile_counter_start();
+    for (uint32_t row = 0; row < 8; row++) watch_storage_erase(row);
+    watch_storage_sync();
+    uint32_t cycles = watch_profile_counter_stop();
+    report("rwwee erase", span, cycles);
+
+    watch_profile_counter_start();
+    for (uint32_t addr = 0; addr < span; addr += burst) {
+        watch_storage_write(addr / NVMCTRL_ROW_SIZE, addr % NVMCTRL_ROW_SIZE, bench_buf, burst);
+    }
+    watch_storage_sync();
+    cycles = watch_profile_counter_stop();
+    sprintf(label, "rwwee program x%lu", burst);
+    report(label, span, cycles);
+}
+
+static void run_rwwee_suite(void) {
+    printf("-- internal RWWEE (watch_storage.c), %u bytes --\n", RWWEE_BYTES);
+    bench_rwwee_sequential_read(16);
+    bench_rwwee_sequential_read(64);
+    bench_rwwee_sequential_read(256);
+    bench_rwwee_random_read();
+    bench_rwwee_program(16);
+    bench_rwwee_program(64);
 
-        // update loop count
-        loop_count += 1;
-        lfs_file_rewind(&lfs, &file);
-        lfs_file_write(&lfs, &file, &loop_count, sizeof(loop_count));
+    // the raw benchmarks just destroyed whatever littlefs held; leave a fresh one.
+    lfs_format(&lfs, &cfg);
+    if (lfs_mount(&lfs, &cfg) == 0) lfs_unmount(&lfs);
+    printf("rwwee region reformatted\n");
+}
+
+static void bench_spi_sequential_read(uint32_t burst) {
+    char label[32];
+    const uint32_t span = 64 * 1024;
+    watch_profile_counter_start();
+    for (uint32_t addr = 0; addr < span; addr += burst) {
+        spi_flash_read_data(addr, bench_buf, burst);
+    }
+    uint32_t cycles = watch_profile_counter_stop();
+    sprintf(label, "spi seq read x%lu", burst);
+    report(label, span, cycles);
+}
 
-        // remember the storage is not updated until the file is closed successfully
-        lfs_file_close(&lfs, &file);
+static void bench_spi_random_read(uint32_t chip_size) {
+    // 64 page reads scattered across the whole chip.
+    watch_profile_counter_start();
+    for (uint32_t i = 0; i < 64; i++) {
+        uint32_t addr = (next_rand() % (chip_size / 256)) * 256;
+        spi_flash_read_data(addr, bench_buf, 256);
+    }
+    uint32_t cycles = watch_profile_counter_stop();
+    report("spi random read x256", 64 * 256, cycles);
+}
 
-        // release any resources we were using
-        lfs_unmount(&lfs);
+static void bench_spi_program(uint32_t chip_size, bool bulk) {
+    // erase and rewrite the last sector of the chip: one spi_flash_write_pages call for
+    // the whole sector (program cycles overlap the next page's transfer) versus one
+    // call per page (each program cycle waited out back to back).
+    uint32_t address = chip_size - SPI_SECTOR_SIZE;
+    memset(bench_buf, 0xA5, sizeof(bench_buf));
 
-        // print the boot count
-        printf("loop_count: %ld\n", loop_count);
-        printf("free space: %d\n", get_free_space());
+    watch_profile_counter_start();
+    spi_flash_command(CMD_ENABLE_WRITE);
+    spi_flash_sector_command(CMD_SECTOR_ERASE, address);
+    spi_flash_wait_until_ready();
+    uint32_t cycles = watch_profile_counter_stop();
+    report("spi sector erase", SPI_SECTOR_SIZE, cycles);
+
+    watch_profile_counter_start();
+    if (bulk) {
+        spi_flash_write_pages(address, bench_buf, SPI_SECTOR_SIZE);
+    } else {
+        for (uint32_t off = 0; off < SPI_SECTOR_SIZE; off += 256) {
+            spi_flash_write_pages(address + off, bench_buf + off, 256);
+            spi_flash_wait_until_ready();
+        }
     }
+    spi_flash_wait_until_ready();
+    cycles = watch_profile_counter_stop();
+    report(bulk ? "spi program bulk" : "spi program x256", SPI_SECTOR_SIZE, cycles);
+}
+
+static void run_spi_suite(void) {
+    uint8_t jedec_id[3] = {0};
+    spi_flash_read_command(CMD_READ_JEDEC_ID, jedec_id, 3);
+    if (jedec_id[0] == 0x00 || jedec_id[0] == 0xFF) {
+        printf("no SPI flash found; skipping external flash benchmarks\n");
+        return;
+    }
+    // the third JEDEC ID byte is the log2 of the chip's capacity in bytes.
+    uint32_t chip_size = 1UL << jedec_id[2];
+    printf("-- external SPI flash (spiflash.c), JEDEC %02x %02x %02x, %lu bytes --\n",
+           jedec_id[0], jedec_id[1], jedec_id[2], chip_size);
+    bench_spi_sequential_read(256);
+    bench_spi_sequential_read(1024);
+    bench_spi_sequential_read(4096);
+    bench_spi_random_read(chip_size);
+    bench_spi_program(chip_size, false);
+    bench_spi_program(chip_size, true);
+}
+
+static void run_suite(void) {
+    rand_state = 0x5EED5EED;
+    printf("storage throughput suite (CPU at %lu Hz)\n", (uint32_t)CONF_CPU_FREQUENCY);
+    run_rwwee_suite();
+    run_spi_suite();
+    printf("done\n");
 }
 
 void app_init(void) {
@@ -108,16 +235,10 @@ void app_wake_from_backup(void) {
 }
 
 void app_setup(void) {
-    // mount the filesystem
-    int err = lfs_mount(&lfs, &cfg);
-
-    // reformat if we can't mount the filesystem
-    // this should only happen on the first boot
-    if (err) {
-        lfs_format(&lfs, &cfg);
-        lfs_mount(&lfs, &cfg);
-    }
-    watch_rtc_register_tick_callback(cb_tick);
+    spi_flash_init();
+    watch_enable_external_interrupts();
+    watch_register_extwake_callback(BTN_ALARM, cb_alarm_pressed, true);
+    watch_enable_display();
 }
 
 void app_prepare_for_standby(void) {
@@ -127,5 +248,11 @@ void app_wake_from_standby(void) {
 }
 
 bool app_loop(void) {
+    if (run_requested) {
+        run_requested = false;
+        watch_display_string("FL  run   ", 0);
+        run_suite();
+        watch_display_string("FL   done ", 0);
+    }
     return true;
 }
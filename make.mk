@@ -48,6 +48,8 @@ endif
 ifndef EMSCRIPTEN
 CC = arm-none-eabi-gcc
 OBJCOPY = arm-none-eabi-objcopy
+OBJDUMP = arm-none-eabi-objdump
+NM = arm-none-eabi-nm
 SIZE = arm-none-eabi-size
 UF2 = python3 $(TOP)/utils/uf2conv.py
 
@@ -62,6 +64,9 @@ CFLAGS += -MD -MP -MT $(BUILD)/$(*F).o -MF $(BUILD)/$(@F).d
 LDFLAGS += -mcpu=cortex-m0plus -mthumb
 LDFLAGS += -Wl,--gc-sections
 LDFLAGS += -Wl,--script=$(TOP)/watch-library/hardware/linker/saml22j18.ld
+# the cross-referenced link map records which object pulled in every symbol that survived
+# --gc-sections; it's the ground truth behind the facereport target's per-object numbers.
+LDFLAGS += -Wl,-Map=$(BUILD)/$(BIN).map,--cref
 
 LIBS += -lm
 
@@ -101,6 +106,7 @@ SRCS += \
   $(TOP)/tinyusb/src/tusb.c \
   $(TOP)/tinyusb/src/common/tusb_fifo.c \
   $(TOP)/tinyusb/src/class/cdc/cdc_device.c \
+  $(TOP)/tinyusb/src/class/msc/msc_device.c \
   $(TOP)/tinyusb/src/device/usbd.c \
   $(TOP)/tinyusb/src/device/usbd_control.c \
   $(TOP)/tinyusb/src/portable/microchip/samd/dcd_samd.c \
@@ -112,10 +118,12 @@ SRCS += \
   $(TOP)/watch-library/hardware/watch/watch_extint.c \
   $(TOP)/watch-library/hardware/watch/watch_led.c \
   $(TOP)/watch-library/hardware/watch/watch_buzzer.c \
+  $(TOP)/watch-library/hardware/watch/watch_fast_timer.c \
   $(TOP)/watch-library/hardware/watch/watch_adc.c \
   $(TOP)/watch-library/hardware/watch/watch_gpio.c \
   $(TOP)/watch-library/hardware/watch/watch_i2c.c \
   $(TOP)/watch-library/hardware/watch/watch_spi.c \
+  $(TOP)/watch-library/hardware/watch/watch_dma.c \
   $(TOP)/watch-library/hardware/watch/watch_uart.c \
   $(TOP)/watch-library/hardware/watch/watch_storage.c \
   $(TOP)/watch-library/hardware/watch/watch_deepsleep.c \
@@ -152,14 +160,30 @@ SRCS += \
   $(TOP)/watch-library/shared/driver/lis2dw.c \
   $(TOP)/watch-library/shared/driver/opt3001.c \
   $(TOP)/watch-library/shared/driver/spiflash.c \
+  $(TOP)/watch-library/shared/driver/fw_update.c \
+  $(TOP)/watch-library/shared/driver/accel_capture.c \
+  $(TOP)/watch-library/shared/driver/step_count.c \
+  $(TOP)/watch-library/shared/driver/wrist_raise.c \
+  $(TOP)/watch-library/shared/watch/watch_boot.c \
+  $(TOP)/watch-library/shared/watch/watch_i2c.c \
   $(TOP)/watch-library/shared/watch/watch_private_buzzer.c \
   $(TOP)/watch-library/shared/watch/watch_private_display.c \
+  $(TOP)/watch-library/shared/watch/watch_profile.c \
+  $(TOP)/watch-library/shared/watch/watch_rand.c \
+  $(TOP)/watch-library/shared/watch/watch_crc32.c \
   $(TOP)/watch-library/shared/watch/watch_utility.c \
 
 DEFINES += \
   -D__SAML22J18A__ \
   -DDONT_USE_CMSIS_INIT
 
+# On boards with the SPI flash chip (e.g. OSO-MISC-21-017 Sensor Watch Flash),
+# expose it as a second read-only USB drive alongside the internal filesystem:
+#   make SPIFLASH_MSC=1
+ifdef SPIFLASH_MSC
+DEFINES += -DSPIFLASH_MSC
+endif
+
 else
 
 CFLAGS += -W -Wall -Wextra -Wmissing-prototypes -Wmissing-declarations
@@ -186,19 +210,28 @@ SRCS += \
   $(TOP)/watch-library/simulator/watch/watch_extint.c \
   $(TOP)/watch-library/simulator/watch/watch_led.c \
   $(TOP)/watch-library/simulator/watch/watch_buzzer.c \
+  $(TOP)/watch-library/simulator/watch/watch_fast_timer.c \
   $(TOP)/watch-library/simulator/watch/watch_adc.c \
   $(TOP)/watch-library/simulator/watch/watch_gpio.c \
   $(TOP)/watch-library/simulator/watch/watch_i2c.c \
   $(TOP)/watch-library/simulator/watch/watch_spi.c \
+  $(TOP)/watch-library/simulator/watch/watch_dma.c \
   $(TOP)/watch-library/simulator/watch/watch_uart.c \
   $(TOP)/watch-library/simulator/watch/watch_storage.c \
   $(TOP)/watch-library/simulator/watch/watch_deepsleep.c \
+  $(TOP)/watch-library/simulator/watch/watch_energy.c \
+  $(TOP)/watch-library/simulator/watch/watch_headless.c \
   $(TOP)/watch-library/simulator/watch/watch_private.c \
   $(TOP)/watch-library/simulator/watch/watch.c \
   $(TOP)/watch-library/shared/driver/thermistor_driver.c \
   $(TOP)/watch-library/shared/driver/opt3001.c \
+  $(TOP)/watch-library/shared/watch/watch_boot.c \
+  $(TOP)/watch-library/shared/watch/watch_i2c.c \
   $(TOP)/watch-library/shared/watch/watch_private_buzzer.c \
   $(TOP)/watch-library/shared/watch/watch_private_display.c \
+  $(TOP)/watch-library/shared/watch/watch_profile.c \
+  $(TOP)/watch-library/shared/watch/watch_rand.c \
+  $(TOP)/watch-library/shared/watch/watch_crc32.c \
   $(TOP)/watch-library/shared/watch/watch_utility.c \
 
 endif
@@ -0,0 +1,177 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "drift_correction.h"
+#include "filesystem.h"
+#include "watch.h"
+#include "watch_utility.h"
+
+// One FREQCORR step trims the 32 kHz clock by 0.95367 ppm, i.e. 95367/100000 µs per second.
+#define DRIFT_CENTIPPM_PER_STEP 95367  // in units of 1/1000 centi-ppm
+
+// intervals shorter than this can't measure sub-ppm drift; intervals steeper than
+// 100 ppm mean somebody set the time by hand between references. Both are dropped.
+#define DRIFT_MIN_INTERVAL_SECONDS 3600
+#define DRIFT_MAX_PLAUSIBLE_PPM 100
+
+static int32_t drift_base_ppm_centi;  // the fitted bare-crystal error at the turnover temperature
+static int32_t drift_temp_ppm_centi;  // the parabolic term for the last temperature sample
+static int8_t drift_freqcorr;         // the signed FREQCORR value currently programmed
+
+// the integral of the applied correction — µs removed from the clock — since the last
+// reference, accumulated each time FREQCORR is reprogrammed. Bookkept in RTC-local unix
+// time; only durations matter, so the time zone never enters into it.
+static int64_t drift_applied_us;
+static uint32_t drift_applied_since;
+
+static uint32_t _drift_rtc_now(void) {
+    return watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+}
+
+// credit the outgoing FREQCORR value with the µs it removed while it was in effect.
+static void _drift_flush_applied(uint32_t now) {
+    drift_applied_us += (int64_t)drift_freqcorr * (int64_t)(now - drift_applied_since) * DRIFT_CENTIPPM_PER_STEP / 100000;
+    drift_applied_since = now;
+}
+
+static void _drift_program_freqcorr(void) {
+    _drift_flush_applied(_drift_rtc_now());
+    int32_t ppm_centi = drift_base_ppm_centi + drift_temp_ppm_centi;
+    // round ppm to the nearest FREQCORR step, away from zero.
+    int64_t steps = ((int64_t)ppm_centi * 1000 + (ppm_centi < 0 ? -(DRIFT_CENTIPPM_PER_STEP / 2) : DRIFT_CENTIPPM_PER_STEP / 2)) / DRIFT_CENTIPPM_PER_STEP;
+    if (steps > 127) steps = 127;
+    if (steps < -127) steps = -127;
+    // positive correction slows the prescaler, which is what a fast crystal needs.
+    watch_rtc_freqcorr_write((int16_t)(steps < 0 ? -steps : steps), steps < 0 ? 1 : 0);
+    drift_freqcorr = (int8_t)steps;
+}
+
+// Least-squares fit of cumulative intrinsic drift against cumulative elapsed time, through
+// the origin: slope = Σ(t·d) / Σ(t²). All integer math; t in seconds, d in microseconds,
+// so the slope is µs/s, which is ppm. "Intrinsic" means the drift each interval would have
+// shown with FREQCORR at zero — the correction actually applied over the interval (logged
+// with each reference) is added back in, so references recorded under different tunings
+// and temperatures combine into one estimate of the bare crystal.
+static void _drift_recompute(void) {
+    movement_drift_reference_t ref, prev;
+    int16_t count = filesystem_ringlog_count(MOVEMENT_DRIFT_LOG_FILENAME);
+
+    drift_base_ppm_centi = 0;
+    if (count >= 2) {
+        int64_t elapsed_total = 0;
+        int64_t drift_total_us = 0;
+        int64_t sum_td = 0;
+        int64_t sum_tt = 0;
+        filesystem_ringlog_read(MOVEMENT_DRIFT_LOG_FILENAME, 0, (void *)&prev);
+        for (int16_t i = 1; i < count; i++) {
+            if (!filesystem_ringlog_read(MOVEMENT_DRIFT_LOG_FILENAME, i, (void *)&ref)) break;
+            int64_t elapsed = (int64_t)(ref.timestamp - prev.timestamp);
+            prev = ref;
+            if (elapsed < DRIFT_MIN_INTERVAL_SECONDS) continue;
+            if ((int64_t)labs(ref.drift) * 1000000 > elapsed * DRIFT_MAX_PLAUSIBLE_PPM) continue;
+            // a positive recorded drift means the RTC fell behind, i.e. the clock ran slow.
+            int64_t intrinsic_us = (int64_t)(-ref.drift) * 1000000 + (int64_t)ref.applied_us;
+            elapsed_total += elapsed;
+            drift_total_us += intrinsic_us;
+            sum_td += elapsed_total * drift_total_us;
+            sum_tt += elapsed_total * elapsed_total;
+        }
+        if (sum_tt) drift_base_ppm_centi = (int32_t)(sum_td * 100 / sum_tt);
+    }
+    _drift_program_freqcorr();
+}
+
+void movement_drift_init(void) {
+    drift_base_ppm_centi = 0;
+    drift_temp_ppm_centi = 0;
+    drift_freqcorr = 0;  // the register's reset value
+    drift_applied_us = 0;
+    drift_applied_since = _drift_rtc_now();
+    _drift_recompute();
+
+    // the integral can't see time spent powered down, but FREQCORR kept running in BACKUP
+    // mode; backfill the stretch since the last reference at the correction just programmed.
+    int16_t count = filesystem_ringlog_count(MOVEMENT_DRIFT_LOG_FILENAME);
+    if (count > 0) {
+        movement_drift_reference_t ref;
+        if (filesystem_ringlog_read(MOVEMENT_DRIFT_LOG_FILENAME, (uint8_t)(count - 1), (void *)&ref)) {
+            uint32_t now = drift_applied_since;
+            if (now > ref.timestamp) {
+                drift_applied_us = (int64_t)drift_freqcorr * (int64_t)(now - ref.timestamp) * DRIFT_CENTIPPM_PER_STEP / 100000;
+            }
+        }
+    }
+}
+
+void movement_drift_record_reference(uint32_t timestamp, int32_t drift) {
+    _drift_flush_applied(_drift_rtc_now());
+    filesystem_ringlog_create(MOVEMENT_DRIFT_LOG_FILENAME, sizeof(movement_drift_reference_t), MOVEMENT_DRIFT_MAX_REFERENCES);
+    movement_drift_reference_t ref = {0};
+    ref.timestamp = timestamp;
+    ref.drift = drift;
+    if (drift_applied_us > INT32_MAX) ref.applied_us = INT32_MAX;
+    else if (drift_applied_us < INT32_MIN) ref.applied_us = INT32_MIN;
+    else ref.applied_us = (int32_t)drift_applied_us;
+    filesystem_ringlog_append(MOVEMENT_DRIFT_LOG_FILENAME, (void *)&ref);
+    drift_applied_us = 0;
+    _drift_recompute();
+}
+
+void movement_drift_temperature_update(float temperature_c) {
+    // NaN fails the range check too, so a missing thermistor can't poison the correction.
+    if (temperature_c >= -40.0 && temperature_c <= 85.0) {
+        int32_t dt_centi = (int32_t)(temperature_c * 100.0) - MOVEMENT_DRIFT_TURNOVER_CENTI_C;
+        // error centi-ppm = -(tempco/1000) * (dt_centi/100)² * 100
+        drift_temp_ppm_centi = (int32_t)(-((int64_t)MOVEMENT_DRIFT_TEMPCO_MILLIPPM * dt_centi * dt_centi) / 100000);
+    } else {
+        drift_temp_ppm_centi = 0;
+    }
+    _drift_program_freqcorr();
+}
+
+int32_t movement_drift_get_ppm_centi(void) {
+    return drift_base_ppm_centi;
+}
+
+void movement_drift_print_references(void) {
+    movement_drift_reference_t ref;
+    int16_t count = filesystem_ringlog_count(MOVEMENT_DRIFT_LOG_FILENAME);
+    if (count <= 0) {
+        printf("no drift references\n");
+        return;
+    }
+    printf("DRIFT timestamp drift applied_us\n");
+    for (int16_t i = 0; i < count; i++) {
+        if (!filesystem_ringlog_read(MOVEMENT_DRIFT_LOG_FILENAME, (uint8_t)i, (void *)&ref)) return;
+        printf("%lu %ld %ld\n", (unsigned long)ref.timestamp, (long)ref.drift, (long)ref.applied_us);
+    }
+    printf("crystal %c%ld.%02ld ppm, temp %c%ld.%02ld ppm, freqcorr %d\n",
+           drift_base_ppm_centi < 0 ? '-' : '+',
+           (long)(labs(drift_base_ppm_centi) / 100), (long)(labs(drift_base_ppm_centi) % 100),
+           drift_temp_ppm_centi < 0 ? '-' : '+',
+           (long)(labs(drift_temp_ppm_centi) / 100), (long)(labs(drift_temp_ppm_centi) % 100),
+           drift_freqcorr);
+}
@@ -0,0 +1,111 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef DRIFT_CORRECTION_H_
+#define DRIFT_CORRECTION_H_
+
+#include <stdint.h>
+
+// Closed-loop crystal drift correction.
+//
+// Every watch's crystal is a little off, and by a different amount per unit. The RTC's
+// FREQCORR register can trim up to ±121 ppm in 0.95367 ppm steps, but somebody has to
+// measure the error first. This module closes the loop: each time the RTC is set from a
+// trusted source (a GPS sync, or a host with real time), the caller records a reference
+// point — how far off the clock was, and over how long — in a ring log on the filesystem.
+// A fixed-point least-squares fit over the logged references estimates the crystal's
+// intrinsic error in ppm, compensating for whatever FREQCORR value was in effect while
+// each interval accumulated, and the result is programmed back into FREQCORR. With
+// references weeks apart the estimate resolves well below one correction step.
+//
+// On top of the per-unit offset, crystal frequency droops parabolically with temperature:
+// a tuning-fork crystal loses about 0.034 ppm for every degree squared away from its 25 °C
+// turnover point, which is minutes per month for a watch that lives outdoors in winter.
+// In a build with MOVEMENT_TEMPERATURE_COMPENSATION (make TEMPERATURE_COMPENSATION=1,
+// needs the thermistor board), movement feeds this module an hourly temperature sample and
+// the parabolic term rides on top of the fitted base correction. The engine integrates the
+// correction it actually applied — the area under the hourly-retuned FREQCORR curve — into
+// each logged reference, so the base fit keeps estimating the bare crystal and never
+// double-counts what the temperature model already took out.
+//
+// Two caveats. The drift measured at each reference assumes the RTC ran untouched since
+// the previous one: if the wearer sets the time by hand in between, the next interval is
+// garbage (the fit drops intervals shorter than an hour or steeper than 100 ppm, which
+// catches most of these). And the engine owns FREQCORR — don't combine it with faces
+// that program the register themselves, like nanosec.
+
+#define MOVEMENT_DRIFT_LOG_FILENAME "drift.dat"
+#define MOVEMENT_DRIFT_MAX_REFERENCES 16
+
+// parabolic crystal model: error ppm = -(tempco/1000) * (T - turnover)², T in °C.
+// 34 milli-ppm/°C² and 25 °C are typical for a 32.768 kHz tuning fork.
+#ifndef MOVEMENT_DRIFT_TEMPCO_MILLIPPM
+#define MOVEMENT_DRIFT_TEMPCO_MILLIPPM 34
+#endif
+#ifndef MOVEMENT_DRIFT_TURNOVER_CENTI_C
+#define MOVEMENT_DRIFT_TURNOVER_CENTI_C 2500
+#endif
+
+typedef struct {
+    uint32_t timestamp; // trusted UTC unix time at the moment of the sync
+    int32_t drift;      // seconds the RTC was off at that moment (trusted minus RTC)
+    int32_t applied_us; // microseconds of correction the engine applied over the interval
+                        // (positive = the clock was slowed), integrated across retunings
+} movement_drift_reference_t;
+
+/** @brief Called by movement's app_setup after the filesystem is mounted; reprograms
+  *        FREQCORR from the logged references. You should not call this from your app.
+  */
+void movement_drift_init(void);
+
+/** @brief Records a correction reference point and retunes FREQCORR.
+  * @details Call this at the moment you set the RTC from a trusted time source, before
+  *          or after — the drift is yours to measure, the log doesn't touch the RTC.
+  * @param timestamp The trusted UTC unix time at the moment of the sync.
+  * @param drift How many seconds the RTC was off: trusted time minus RTC time.
+  */
+void movement_drift_record_reference(uint32_t timestamp, int32_t drift);
+
+/** @brief Folds a fresh temperature sample into the correction.
+  * @details Called hourly by movement's background task pass when built with
+  *          MOVEMENT_TEMPERATURE_COMPENSATION; evaluates the parabolic model and
+  *          reprograms FREQCORR with base plus temperature term. Readings outside
+  *          -40..85 °C (including the nonsense a missing thermistor produces) zero
+  *          the temperature term rather than poisoning the correction.
+  * @param temperature_c The current temperature in degrees celsius.
+  */
+void movement_drift_temperature_update(float temperature_c);
+
+/** @brief The current crystal error estimate in hundredths of a ppm, positive if the
+  *        crystal runs fast, or 0 if there aren't enough references to estimate yet.
+  *        This is the base (turnover-temperature) estimate; the temperature term varies
+  *        on top of it.
+  */
+int32_t movement_drift_get_ppm_centi(void);
+
+/** @brief Prints the reference log, the ppm estimate and the programmed FREQCORR value
+  *        to the console; wired to the `drift` shell command.
+  */
+void movement_drift_print_references(void);
+
+#endif // DRIFT_CORRECTION_H_
@@ -1,11 +1,62 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 #include <peripheral_clk_config.h>
 #include "filesystem.h"
 #include "watch.h"
+#ifdef MOVEMENT_PROFILE
+#include "movement.h"
+#include "drift_correction.h"
+#endif
 #include "lfs.h"
 #include "hpl_flash.h"
+#include "sunrise_sunset_face.h"
+#include "stock_stopwatch_face.h"
+#if !__EMSCRIPTEN__
+#include "fw_update.h"
+#else
+#include "parity_check.h"
+#endif
+
+#ifdef FILESYSTEM_STATS
+#include "watch_profile.h"
+#include "watch_utility.h"
+
+// Storage health instrumentation, compiled in with `make FILESYSTEM_STATS=1`: SysTick
+// cycle histograms for the four operations that matter (mount, file open, read, append)
+// and per-row erase counts from the block device wrappers, reported by the `fsstats`
+// shell command. The measured sections are disjoint — open is timed separately from the
+// read or write that follows — because there is only one SysTick to go around.
+enum {
+    FS_STAT_MOUNT,
+    FS_STAT_OPEN,
+    FS_STAT_READ,
+    FS_STAT_APPEND,
+    FS_STAT_NUM_OPS
+};
+static const char _fs_stat_names[FS_STAT_NUM_OPS][7] = { "mount", "open", "read", "append" };
+#define FS_STAT_BUCKETS 8
+#define FS_RWWEE_RATED_CYCLES 25000 // datasheet rated NVM endurance per row
+
+static uint16_t _fs_stat_hist[FS_STAT_NUM_OPS][FS_STAT_BUCKETS];
+static uint16_t _fs_erase_counts[NVMCTRL_RWWEE_PAGES / 4]; // one littlefs block is one NVM row
+static uint32_t _fs_stats_start_time;
+
+static void _fs_stat_record(uint8_t op, uint32_t cycles) {
+    // log2 buckets from 4k cycles: <4k, <8k, ..., <256k, >=256k (about 0.5 ms to 64 ms
+    // at the 8 MHz clock a plugged-in watch runs at).
+    uint8_t bucket = 0;
+    while (bucket < FS_STAT_BUCKETS - 1 && cycles >= (4096UL << bucket)) bucket++;
+    if (_fs_stat_hist[op][bucket] < UINT16_MAX) _fs_stat_hist[op][bucket]++;
+}
+
+#define FS_STAT_BEGIN() watch_profile_counter_start()
+#define FS_STAT_END(op) _fs_stat_record(op, watch_profile_counter_stop())
+#else
+#define FS_STAT_BEGIN()
+#define FS_STAT_END(op)
+#endif
 
 int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size);
 int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size);
@@ -17,21 +68,61 @@ int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t
     return !watch_storage_read(block, off, (void *)buffer, size);
 }
 
-int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
+// the prog/erase/sync wrappers ride along in SRAM with the watch_storage primitives they
+// call (see watch_storage.c), keeping the whole flash write path free of wait-state stalls.
+WATCH_RAMFUNC int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
     (void) cfg;
     return !watch_storage_write(block, off, (void *)buffer, size);
 }
 
-int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block) {
+// Incremental free-space accounting. A full lfs_fs_traverse walks every metadata block
+// in flash — fine for the shell's df, too slow for a logging face that checks headroom
+// before every append. So the in-use block count is established by one traversal and
+// then kept current from the erase hook below: littlefs erases a block exactly when the
+// allocator claims it, so each erase bumps the count. Blocks an operation *frees* are
+// invisible down here (littlefs has no dealloc hook), so the estimate only drifts
+// pessimistic — it can claim less free space than really exists, never more. Operations
+// that free wholesale (rm, a truncating open) mark the count stale so the next query
+// re-walks; so does a query whose cached answer looks critically low, so "disk full" is
+// never reported from drift alone.
+static uint32_t _fs_used_blocks;
+static bool _fs_used_blocks_valid;
+
+WATCH_RAMFUNC int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block) {
     (void) cfg;
+#ifdef FILESYSTEM_STATS
+    if (block < sizeof(_fs_erase_counts) / sizeof(_fs_erase_counts[0])) _fs_erase_counts[block]++;
+#endif
+    if (_fs_used_blocks_valid) _fs_used_blocks++;
     return !watch_storage_erase(block);
 }
 
-int lfs_storage_sync(const struct lfs_config *cfg) {
+WATCH_RAMFUNC int lfs_storage_sync(const struct lfs_config *cfg) {
     (void) cfg;
     return !watch_storage_sync();
 }
 
+// The Makefile defines LFS_CRC=watch_crc32 so littlefs checksums its metadata blocks on
+// the DSU's hardware CRC engine instead of a byte-at-a-time software loop. littlefs v2.6+
+// responds to that define by omitting its own lfs_crc, in which case this weak definition
+// supplies the symbol; against an older submodule checkout the strong definition in
+// lfs_util.c wins and littlefs keeps its software CRC. (The #ifndef covers versions that
+// turn lfs_crc itself into a macro.)
+#ifndef lfs_crc
+uint32_t __attribute__((weak)) lfs_crc(uint32_t crc, const void *buffer, size_t size) {
+    return watch_crc32(crc, buffer, size);
+}
+#endif
+
+// Statically allocated caches, handed to littlefs via the config structs below. Without these,
+// littlefs mallocs the read/prog/lookahead caches at mount and a fresh cache for every file open;
+// pinning them here keeps cached metadata warm across calls and takes the heap out of the hot
+// path entirely (the boot-time TOTP record parse opens the same file dozens of times).
+static uint8_t _read_buffer[NVMCTRL_PAGE_SIZE];
+static uint8_t _prog_buffer[NVMCTRL_PAGE_SIZE];
+static uint8_t _lookahead_buffer[16] __attribute__((aligned(4)));
+static uint8_t _file_buffer[NVMCTRL_PAGE_SIZE];
+
 const struct lfs_config cfg = {
     // block device operations
     .read  = lfs_storage_read,
@@ -47,12 +138,26 @@ const struct lfs_config cfg = {
     .cache_size = NVMCTRL_PAGE_SIZE,
     .lookahead_size = 16,
     .block_cycles = 100,
+
+    // static buffers
+    .read_buffer = _read_buffer,
+    .prog_buffer = _prog_buffer,
+    .lookahead_buffer = _lookahead_buffer,
+};
+
+// per-file cache for the single static file handle below. filesystem operations in this file are
+// not reentrant (they all share `file`), so one buffer suffices.
+static const struct lfs_file_config file_cfg = {
+    .buffer = _file_buffer,
 };
 
 static lfs_t lfs;
 static lfs_file_t file;
 static struct lfs_info info;
 
+// re-verify by traversal before reporting less than this much free space.
+#define FS_FREE_RESYNC_BLOCKS 4
+
 static int _traverse_df_cb(void *p, lfs_block_t block) {
     (void) block;
 	uint32_t *nb = p;
@@ -61,17 +166,21 @@ static int _traverse_df_cb(void *p, lfs_block_t block) {
 }
 
 int32_t filesystem_get_free_space(void) {
-	int err;
+    // answer from the running count unless it says we're nearly (or impossibly, after
+    // drift) full — then fall through for the exact answer.
+    if (_fs_used_blocks_valid && _fs_used_blocks + FS_FREE_RESYNC_BLOCKS <= cfg.block_count) {
+        return (int32_t)((cfg.block_count - _fs_used_blocks) * cfg.block_size);
+    }
 
-	uint32_t free_blocks = 0;
-	err = lfs_fs_traverse(&lfs, _traverse_df_cb, &free_blocks);
+	uint32_t used_blocks = 0;
+	int err = lfs_fs_traverse(&lfs, _traverse_df_cb, &used_blocks);
 	if(err < 0){
 		return err;
 	}
+    _fs_used_blocks = used_blocks;
+    _fs_used_blocks_valid = true;
 
-	uint32_t available = cfg.block_count * cfg.block_size - free_blocks * cfg.block_size;
-
-	return (int32_t)available;
+	return (int32_t)((cfg.block_count - used_blocks) * cfg.block_size);
 }
 
 static int filesystem_ls(lfs_t *lfs, const char *path) {
@@ -112,7 +221,12 @@ static int filesystem_ls(lfs_t *lfs, const char *path) {
 }
 
 bool filesystem_init(void) {
+    FS_STAT_BEGIN();
     int err = lfs_mount(&lfs, &cfg);
+    FS_STAT_END(FS_STAT_MOUNT);
+#ifdef FILESYSTEM_STATS
+    _fs_stats_start_time = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+#endif
 
     // reformat if we can't mount the filesystem
     // this should only happen on the first boot
@@ -137,6 +251,7 @@ bool filesystem_rm(char *filename) {
     info.type = 0;
     lfs_stat(&lfs, filename, &info);
     if (filesystem_file_exists(filename)) {
+        _fs_used_blocks_valid = false; // removal frees blocks the running count can't see
         return lfs_remove(&lfs, filename) == LFS_ERR_OK;
     } else {
         printf("rm: %s: No such file\n", filename);
@@ -156,9 +271,13 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length) {
     memset(buf, 0, length);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDONLY);
+        FS_STAT_BEGIN();
+        int err = lfs_file_opencfg(&lfs, &file, filename, LFS_O_RDONLY, &file_cfg);
+        FS_STAT_END(FS_STAT_OPEN);
         if (err < 0) return false;
+        FS_STAT_BEGIN();
         err = lfs_file_read(&lfs, &file, buf, min(length, file_size));
+        FS_STAT_END(FS_STAT_READ);
         if (err < 0) return false;
         return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
     }
@@ -166,11 +285,25 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length) {
     return false;
 }
 
+bool filesystem_read_file_range(char *filename, char *buf, int32_t offset, int32_t length) {
+    int32_t file_size = filesystem_get_file_size(filename);
+    if (file_size <= 0 || offset + length > file_size) return false;
+    int err = lfs_file_opencfg(&lfs, &file, filename, LFS_O_RDONLY, &file_cfg);
+    if (err < 0) return false;
+    err = lfs_file_seek(&lfs, &file, offset, LFS_SEEK_SET);
+    if (err >= 0) err = lfs_file_read(&lfs, &file, buf, length);
+    if (err < 0) {
+        lfs_file_close(&lfs, &file);
+        return false;
+    }
+    return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+}
+
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length) {
     memset(buf, 0, length + 1);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDONLY);
+        int err = lfs_file_opencfg(&lfs, &file, filename, LFS_O_RDONLY, &file_cfg);
         if (err < 0) return false;
         err = lfs_file_seek(&lfs, &file, *offset, LFS_SEEK_SET);
         if (err < 0) return false;
@@ -189,6 +322,152 @@ bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t le
     return false;
 }
 
+// Ring log: a fixed-record circular log file for faces that log time series. The file is
+// preallocated at creation, so an append never grows it: it overwrites one record slot and the
+// 8-byte header, regardless of how much history the log holds. Layout is the header followed by
+// capacity * record_size bytes of slots; head is the slot the next append will land in.
+typedef struct {
+    uint16_t magic;       // RINGLOG_MAGIC
+    uint8_t record_size;
+    uint8_t capacity;
+    uint8_t head;
+    uint8_t count;
+    uint8_t reserved[2];
+} ringlog_header_t;
+
+#define RINGLOG_MAGIC 0x524C  // 'RL'
+
+static bool _ringlog_read_header(char *filename, ringlog_header_t *header) {
+    if (lfs_file_opencfg(&lfs, &file, filename, LFS_O_RDONLY, &file_cfg) < 0) return false;
+    lfs_ssize_t bytes_read = lfs_file_read(&lfs, &file, header, sizeof(ringlog_header_t));
+    lfs_file_close(&lfs, &file);
+    return bytes_read == sizeof(ringlog_header_t) && header->magic == RINGLOG_MAGIC;
+}
+
+bool filesystem_ringlog_create(char *filename, uint8_t record_size, uint8_t capacity) {
+    ringlog_header_t header;
+    if (record_size == 0 || capacity == 0) return false;
+    // if a matching log already exists, keep it (and its contents).
+    if (_ringlog_read_header(filename, &header) &&
+        header.record_size == record_size &&
+        header.capacity == capacity) return true;
+
+    memset(&header, 0, sizeof(header));
+    header.magic = RINGLOG_MAGIC;
+    header.record_size = record_size;
+    header.capacity = capacity;
+
+    if (lfs_file_opencfg(&lfs, &file, filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC, &file_cfg) < 0) return false;
+    _fs_used_blocks_valid = false; // truncation frees blocks the running count can't see
+    int err = lfs_file_write(&lfs, &file, &header, sizeof(header));
+    // preallocate every slot up front so appends never change the file's size.
+    uint8_t empty[16];
+    memset(empty, 0xFF, sizeof(empty));
+    int32_t remaining = (int32_t)record_size * (int32_t)capacity;
+    while (err >= 0 && remaining > 0) {
+        err = lfs_file_write(&lfs, &file, empty, min(remaining, (int32_t)sizeof(empty)));
+        remaining -= sizeof(empty);
+    }
+    if (err < 0) {
+        lfs_file_close(&lfs, &file);
+        return false;
+    }
+    return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+}
+
+bool filesystem_ringlog_append(char *filename, void *record) {
+    ringlog_header_t header;
+    if (!_ringlog_read_header(filename, &header)) return false;
+
+    if (lfs_file_opencfg(&lfs, &file, filename, LFS_O_RDWR, &file_cfg) < 0) return false;
+    int err = lfs_file_seek(&lfs, &file, sizeof(header) + (lfs_soff_t)header.head * header.record_size, LFS_SEEK_SET);
+    if (err >= 0) err = lfs_file_write(&lfs, &file, record, header.record_size);
+    header.head = (header.head + 1) % header.capacity;
+    if (header.count < header.capacity) header.count++;
+    if (err >= 0) err = lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET);
+    if (err >= 0) err = lfs_file_write(&lfs, &file, &header, sizeof(header));
+    if (err < 0) {
+        lfs_file_close(&lfs, &file);
+        return false;
+    }
+    return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+}
+
+int16_t filesystem_ringlog_count(char *filename) {
+    ringlog_header_t header;
+    if (!_ringlog_read_header(filename, &header)) return -1;
+    return header.count;
+}
+
+bool filesystem_ringlog_read(char *filename, uint8_t index, void *record) {
+    ringlog_header_t header;
+    if (!_ringlog_read_header(filename, &header)) return false;
+    if (index >= header.count) return false;
+
+    // index 0 is the oldest record still in the log.
+    uint8_t slot = (header.head + header.capacity - header.count + index) % header.capacity;
+    if (lfs_file_opencfg(&lfs, &file, filename, LFS_O_RDONLY, &file_cfg) < 0) return false;
+    int err = lfs_file_seek(&lfs, &file, sizeof(header) + (lfs_soff_t)slot * header.record_size, LFS_SEEK_SET);
+    lfs_ssize_t bytes_read = -1;
+    if (err >= 0) bytes_read = lfs_file_read(&lfs, &file, record, header.record_size);
+    lfs_file_close(&lfs, &file);
+    return bytes_read == header.record_size;
+}
+
+// Streaming line reader state. Like the rest of this module it is a single static instance:
+// only one file can be iterated at a time. The readahead buffer means sequential line iteration
+// costs one littlefs read per 128 bytes rather than an open/seek/read/close per line, which made
+// parsing a file of n lines O(n²) in calls to the storage driver.
+static struct {
+    lfs_file_t file;
+    uint8_t cache[NVMCTRL_PAGE_SIZE];
+    char buffer[128];
+    int32_t fill;
+    int32_t pos;
+    bool open;
+} reader;
+
+static const struct lfs_file_config reader_cfg = {
+    .buffer = reader.cache,
+};
+
+bool filesystem_reader_open(char *filename) {
+    if (reader.open) return false;
+    if (lfs_file_opencfg(&lfs, &reader.file, filename, LFS_O_RDONLY, &reader_cfg) < 0) return false;
+    reader.fill = 0;
+    reader.pos = 0;
+    reader.open = true;
+    return true;
+}
+
+void filesystem_reader_close(void) {
+    if (!reader.open) return;
+    lfs_file_close(&lfs, &reader.file);
+    reader.open = false;
+}
+
+bool filesystem_reader_read_line(char *buf, int32_t length) {
+    if (!reader.open) return false;
+    memset(buf, 0, length + 1);
+    int32_t written = 0;
+    while (written < length) {
+        if (reader.pos == reader.fill) {
+            lfs_ssize_t bytes_read = lfs_file_read(&lfs, &reader.file, reader.buffer, sizeof(reader.buffer));
+            if (bytes_read < 0) return false;
+            if (bytes_read == 0) break; // end of file
+            reader.fill = bytes_read;
+            reader.pos = 0;
+        }
+        char c = reader.buffer[reader.pos++];
+        if (c == '\n') return true;
+        buf[written++] = c;
+    }
+    // a line longer than length is returned truncated; the next call picks up where we stopped.
+    return written > 0;
+}
+
+#if __EMSCRIPTEN__
+// the simulator runs commands synchronously; no tick loop to protect there.
 static void filesystem_cat(char *filename) {
     info.type = 0;
     lfs_stat(&lfs, filename, &info);
@@ -205,76 +484,744 @@ static void filesystem_cat(char *filename) {
         printf("cat: %s: No such file\n", filename);
     }
 }
+#endif
 
 bool filesystem_write_file(char *filename, char *text, int32_t length) {
-    int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
+    int err = lfs_file_opencfg(&lfs, &file, filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC, &file_cfg);
     if (err < 0) return false;
+    _fs_used_blocks_valid = false; // truncation frees blocks the running count can't see
     err = lfs_file_write(&lfs, &file, text, length);
     if (err < 0) return false;
     return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
 }
 
 bool filesystem_append_file(char *filename, char *text, int32_t length) {
-    int err = lfs_file_open(&lfs, &file, filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
+    FS_STAT_BEGIN();
+    int err = lfs_file_opencfg(&lfs, &file, filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND, &file_cfg);
+    FS_STAT_END(FS_STAT_OPEN);
     if (err < 0) return false;
+    FS_STAT_BEGIN();
     err = lfs_file_write(&lfs, &file, text, length);
+    FS_STAT_END(FS_STAT_APPEND);
     if (err < 0) return false;
     return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
 }
 
-void filesystem_process_command(char *line) {
-    printf("$ %s", line);
-    char *command = strtok(line, " \n");
-    
-    if (strcmp(command, "ls") == 0) {
-        char *directory = strtok(NULL, " \n");
-        if (directory == NULL) {
-            filesystem_ls(&lfs, "/");
-        } else {
-            printf("usage: ls\n");
+// Binary transfer framing, shared by fsdump and fsload: the stream is a sequence of
+// frames, each an 8-byte header followed by up to FILESYSTEM_TRANSFER_CHUNK_SIZE bytes
+// of payload. A zero-length frame marks the end of the stream. The checksum is littlefs's
+// own CRC-32 (polynomial 0x04c11db7, seed 0xffffffff, not reflected), seeded fresh for
+// each frame, so no new table has to live in flash for this.
+typedef struct {
+    uint8_t magic[2];   // 'F', 'S'
+    uint16_t length;    // payload bytes in this frame; 0 marks the end of the stream
+    uint32_t crc;       // watch_crc32 of the payload
+} filesystem_transfer_header_t;
+
+#define FILESYSTEM_TRANSFER_CHUNK_SIZE 512
+
+// where verified frames land: a littlefs file (fsload), or the firmware update
+// staging area in SPI flash (fwload streams the image, fwdelta streams changed pages).
+#define FILESYSTEM_TRANSFER_SINK_FILE 0
+#define FILESYSTEM_TRANSFER_SINK_FW 1
+#define FILESYSTEM_TRANSFER_SINK_FW_DELTA 2
+
+// State for a binary transfer in progress. Like the rest of this module, a single static
+// instance: only one transfer can run at a time, fed by filesystem_process_transfer.
+static struct {
+    bool active;
+    uint8_t sink;
+    char filename[LFS_NAME_MAX + 1];
+    int32_t remaining;
+    uint16_t header_fill;
+    uint16_t payload_fill;
+    filesystem_transfer_header_t header;
+    uint8_t payload[FILESYSTEM_TRANSFER_CHUNK_SIZE];
+} transfer;
+
+static void _filesystem_transfer_start(uint8_t sink, int32_t remaining) {
+    transfer.sink = sink;
+    transfer.remaining = remaining;
+    transfer.header_fill = 0;
+    transfer.payload_fill = 0;
+    transfer.active = true;
+}
+
+// State for a `cat` streaming in progress: the shell task drains the file a slice per
+// loop pass instead of blocking until the whole thing is out the wire. It gets its own
+// file handle and cache because a background task may append to the very log being
+// dumped (through the shared `file` handle) between slices.
+static struct {
+    bool active;
+    lfs_file_t file;
+} _cat;
+static uint8_t _cat_file_buffer[NVMCTRL_PAGE_SIZE];
+static const struct lfs_file_config _cat_file_cfg = {
+    .buffer = _cat_file_buffer,
+};
+
+static void filesystem_fsdump(char *filename) {
+    int32_t file_size = filesystem_get_file_size(filename);
+    if (file_size < 0) {
+        printf("fsdump: %s: No such file\n", filename);
+        return;
+    }
+    // one text line announcing the payload, then raw frames: the host reads up to
+    // the newline, then switches to consuming binary.
+    printf("fsdump %s %ld\n", filename, file_size);
+
+    uint8_t *chunk = malloc(FILESYSTEM_TRANSFER_CHUNK_SIZE);
+    if (lfs_file_opencfg(&lfs, &file, filename, LFS_O_RDONLY, &file_cfg) >= 0) {
+        filesystem_transfer_header_t header = { .magic = { 'F', 'S' } };
+        lfs_ssize_t bytes_read;
+        while ((bytes_read = lfs_file_read(&lfs, &file, chunk, FILESYSTEM_TRANSFER_CHUNK_SIZE)) > 0) {
+            header.length = bytes_read;
+            header.crc = watch_crc32(0xFFFFFFFF, chunk, bytes_read);
+            write(STDOUT_FILENO, &header, sizeof(header));
+            write(STDOUT_FILENO, chunk, bytes_read);
         }
-    } else if (strcmp(command, "cat") == 0) {
-        char *filename = strtok(NULL, " \n");
-        if (filename == NULL) {
-            printf("usage: cat file\n");
-        } else {
-            filesystem_cat(filename);
+        lfs_file_close(&lfs, &file);
+        // the terminating frame: no payload, and the CRC of nothing is the seed.
+        header.length = 0;
+        header.crc = 0xFFFFFFFF;
+        write(STDOUT_FILENO, &header, sizeof(header));
+    }
+    free(chunk);
+}
+
+static void _filesystem_write_frame(const uint8_t *data, uint16_t length) {
+    filesystem_transfer_header_t header = {
+        .magic = { 'F', 'S' },
+        .length = length,
+        .crc = watch_crc32(0xFFFFFFFF, data, length),
+    };
+    write(STDOUT_FILENO, &header, sizeof(header));
+    if (length) write(STDOUT_FILENO, data, length);
+}
+
+// exports the stopwatch's lap memory: the records banked to laps.dat first
+// (they're the oldest), then the in-memory ring, then the terminating empty
+// frame -- the same framing fsdump emits, so hosts share the receive path.
+static void filesystem_dump_laps(void) {
+    int32_t banked_bytes = filesystem_get_file_size(STOCK_STOPWATCH_LAP_FILENAME);
+    if (banked_bytes < 0) banked_bytes = 0;
+    uint8_t pending = stock_stopwatch_get_lap_count();
+    printf("laps %ld\n", banked_bytes / 4 + pending);
+
+    uint8_t *chunk = malloc(FILESYSTEM_TRANSFER_CHUNK_SIZE);
+    for (int32_t offset = 0; offset < banked_bytes; offset += FILESYSTEM_TRANSFER_CHUNK_SIZE) {
+        int32_t take = banked_bytes - offset;
+        if (take > FILESYSTEM_TRANSFER_CHUNK_SIZE) take = FILESYSTEM_TRANSFER_CHUNK_SIZE;
+        if (!filesystem_read_file_range(STOCK_STOPWATCH_LAP_FILENAME, (char *)chunk, offset, take)) break;
+        _filesystem_write_frame(chunk, take);
+    }
+    free(chunk);
+    if (pending) _filesystem_write_frame((const uint8_t *)stock_stopwatch_get_laps(), pending * sizeof(uint32_t));
+    _filesystem_write_frame(NULL, 0);
+}
+
+static void filesystem_fsload_begin(char *filename, int32_t size) {
+    if (strchr(filename, '/') || strchr(filename, '\\')) {
+        printf("subdirectories are not supported\n");
+        return;
+    }
+    if (size <= 0 || size > filesystem_get_free_space()) {
+        printf("fsload: %ld bytes won't fit\n", size);
+        return;
+    }
+    // start from an empty file; each verified frame is appended to it.
+    if (!filesystem_write_file(filename, "", 0)) {
+        printf("fsload: could not create %s\n", filename);
+        return;
+    }
+    strncpy(transfer.filename, filename, LFS_NAME_MAX);
+    _filesystem_transfer_start(FILESYSTEM_TRANSFER_SINK_FILE, size);
+    printf("fsload: ready\n");
+}
+
+bool filesystem_transfer_in_progress(void) {
+    return transfer.active;
+}
+
+static void _filesystem_transfer_fail(const char *reason) {
+    printf("transfer: %s\n", reason);
+    if (transfer.sink == FILESYSTEM_TRANSFER_SINK_FILE) {
+        filesystem_rm(transfer.filename);
+    }
+#if !__EMSCRIPTEN__
+    else {
+        fw_update_cancel();
+    }
+#endif
+    transfer.active = false;
+}
+
+void filesystem_abort_transfer(void) {
+    _filesystem_transfer_fail("transfer timed out");
+}
+
+void filesystem_process_transfer(char *data, int32_t length) {
+    while (transfer.active && length > 0) {
+        if (transfer.header_fill < sizeof(filesystem_transfer_header_t)) {
+            ((uint8_t *)&transfer.header)[transfer.header_fill++] = (uint8_t)*data++;
+            length--;
+            if (transfer.header_fill < sizeof(filesystem_transfer_header_t)) continue;
+            // header complete: sanity check it before collecting the payload.
+            if (transfer.header.magic[0] != 'F' || transfer.header.magic[1] != 'S' ||
+                transfer.header.length > FILESYSTEM_TRANSFER_CHUNK_SIZE ||
+                (int32_t)transfer.header.length > transfer.remaining) {
+                _filesystem_transfer_fail("bad frame header");
+                return;
+            }
+            if (transfer.header.length == 0) {
+                // a zero-length frame is the host giving up on the transfer.
+                _filesystem_transfer_fail("aborted by host");
+                return;
+            }
         }
-    } else if (strcmp(command, "df") == 0) {
-        printf("free space: %ld bytes\n", filesystem_get_free_space());
-    } else if (strcmp(command, "rm") == 0) {
-        char *filename = strtok(NULL, " \n");
-        if (filename == NULL) {
-            printf("usage: rm file\n");
+
+        int32_t wanted = transfer.header.length - transfer.payload_fill;
+        int32_t take = min(wanted, length);
+        memcpy(transfer.payload + transfer.payload_fill, data, take);
+        transfer.payload_fill += take;
+        data += take;
+        length -= take;
+        if (transfer.payload_fill < transfer.header.length) continue;
+
+        // frame complete: verify and deliver to the sink, then acknowledge so the
+        // host can pace itself against our flash write speed.
+        if (watch_crc32(0xFFFFFFFF, transfer.payload, transfer.header.length) != transfer.header.crc) {
+            _filesystem_transfer_fail("bad checksum");
+            return;
+        }
+        if (transfer.sink == FILESYSTEM_TRANSFER_SINK_FILE) {
+            if (!filesystem_append_file(transfer.filename, (char *)transfer.payload, transfer.header.length)) {
+                _filesystem_transfer_fail("write failed");
+                return;
+            }
+        }
+#if !__EMSCRIPTEN__
+        else if (transfer.sink == FILESYSTEM_TRANSFER_SINK_FW) {
+            if (!fw_update_staging_write(transfer.payload, transfer.header.length)) {
+                _filesystem_transfer_fail("write failed");
+                return;
+            }
         } else {
-            filesystem_rm(filename);
-        } 
-    } else if (strcmp(command, "echo") == 0) {
-        char *text = malloc(248);
-        memset(text, 0, 248);
-        size_t pos = 0;
-        char *word = strtok(NULL, " \n");
-        while (strcmp(word, ">") && strcmp(word, ">>")) {
-            sprintf(text + pos, "%s ", word);
-            pos += strlen(word) + 1;
-            word = strtok(NULL, " \n");
-            if (word == NULL) break;
+            // a delta frame is a little-endian page index followed by the page data;
+            // page index 0xFFFF with no data marks the end of the delta stream.
+            if (transfer.header.length < 2) {
+                _filesystem_transfer_fail("bad frame");
+                return;
+            }
+            uint16_t page_index = transfer.payload[0] | (transfer.payload[1] << 8);
+            if (page_index == 0xFFFF) {
+                transfer.active = false;
+                if (fw_update_staging_commit()) printf("fwdelta: verified and armed\n");
+                else printf("fwdelta: verify failed\n");
+                return;
+            }
+            if (!fw_update_staging_patch_page(page_index, transfer.payload + 2, transfer.header.length - 2)) {
+                _filesystem_transfer_fail("write failed");
+                return;
+            }
+        }
+#endif
+        transfer.remaining -= transfer.header.length;
+        transfer.header_fill = 0;
+        transfer.payload_fill = 0;
+        printf("ok %ld\n", transfer.remaining);
+        if (transfer.remaining == 0) {
+            transfer.active = false;
+            if (transfer.sink == FILESYSTEM_TRANSFER_SINK_FILE) {
+                printf("fsload: received %s\n", transfer.filename);
+            }
+#if !__EMSCRIPTEN__
+            else if (fw_update_staging_commit()) {
+                printf("fwload: verified and armed\n");
+            } else {
+                printf("fwload: verify failed\n");
+            }
+#endif
+        }
+    }
+}
+
+// Each shell command is one handler and one table entry below. Handlers pick their
+// arguments out of the strtok state primed in filesystem_process_command. The table is
+// scanned linearly: at a dozen entries, hashing would cost more flash than it saves time.
+
+static void _cmd_ls(void) {
+    char *directory = strtok(NULL, " \n");
+    if (directory == NULL) {
+        filesystem_ls(&lfs, "/");
+    } else {
+        printf("usage: ls\n");
+    }
+}
+
+static void _cmd_cat(void) {
+    char *filename = strtok(NULL, " \n");
+    if (filename == NULL) {
+        printf("usage: cat file\n");
+        return;
+    }
+#if __EMSCRIPTEN__
+    filesystem_cat(filename);
+#else
+    if (!filesystem_file_exists(filename)) {
+        printf("cat: %s: No such file\n", filename);
+        return;
+    }
+    if (lfs_file_opencfg(&lfs, &_cat.file, filename, LFS_O_RDONLY, &_cat_file_cfg) < 0) return;
+    // the shell task streams the contents out a slice per loop pass from here.
+    _cat.active = true;
+#endif
+}
+
+#ifdef MOVEMENT_PROFILE
+static void _cmd_profile(void) {
+    movement_print_face_profiles();
+}
+#endif
+
+#if __EMSCRIPTEN__
+static void _cmd_parity(void) {
+    parity_check_run();
+}
+#endif
+
+static void _cmd_bootlog(void) {
+    watch_boot_print_report();
+}
+
+static void _cmd_wakes(void) {
+    movement_print_wake_ledger();
+}
+
+static void _cmd_drift(void) {
+    movement_drift_print_references();
+}
+
+static void _cmd_clocks(void) {
+    watch_dump_clock_tree();
+}
+
+static void _cmd_crashes(void) {
+    movement_print_crash_log();
+}
+
+static void _cmd_trace(void) {
+    movement_print_event_trace();
+}
+
+static void _cmd_order(void) {
+    uint8_t indices[64];
+    uint8_t count = 0;
+    char *token = strtok(NULL, " \n");
+    if (token == NULL) {
+        movement_print_face_order();
+        return;
+    }
+    if (!strcmp(token, "default")) {
+        movement_set_face_order(NULL, 0);
+        return;
+    }
+    while (token && count < sizeof(indices)) {
+        if (token[0] < '0' || token[0] > '9') {
+            printf("usage: order [default | index ...]\n");
+            return;
         }
-        text[strlen(text) - 1] = 0;
-        char *filename = strtok(NULL, " \n");
-        if (filename == NULL) {
-            printf("usage: echo text > file\n");
-        } else if (strchr(filename, '/') || strchr(filename, '\\')) {
-            printf("subdirectories are not supported\n");
-        } else if (!strcmp(word, ">")) {
+        indices[count++] = (uint8_t)atoi(token);
+        token = strtok(NULL, " \n");
+    }
+    if (!movement_set_face_order(indices, count)) printf("bad face index\n");
+}
+
+static void _cmd_laps(void) {
+    filesystem_dump_laps();
+}
+
+static void _cmd_suntable(void) {
+    if (sunrise_sunset_generate_table()) {
+        printf("suntable: wrote %ld bytes\n", filesystem_get_file_size("suntab.dat"));
+    } else {
+        printf("suntable: no location set, or write failed\n");
+    }
+}
+
+static void _cmd_sync(void) {
+    char *timestamp = strtok(NULL, " \n");
+    if (timestamp == NULL) {
+        printf("usage: sync unixtime\n");
+    } else {
+        movement_sync_time((uint32_t)strtoul(timestamp, NULL, 10));
+    }
+}
+
+static void _cmd_fsdump(void) {
+    char *filename = strtok(NULL, " \n");
+    if (filename == NULL) {
+        printf("usage: fsdump file\n");
+    } else {
+        filesystem_fsdump(filename);
+    }
+}
+
+static void _cmd_fsload(void) {
+    char *filename = strtok(NULL, " \n");
+    char *size = strtok(NULL, " \n");
+    if (filename == NULL || size == NULL) {
+        printf("usage: fsload file size\n");
+    } else {
+        filesystem_fsload_begin(filename, atol(size));
+    }
+}
+
+#if !__EMSCRIPTEN__
+static void _cmd_fwload(void) {
+    char *size = strtok(NULL, " \n");
+    char *crc = strtok(NULL, " \n");
+    if (size == NULL || crc == NULL) {
+        printf("usage: fwload size crc32\n");
+    } else if (fw_update_staging_begin((uint32_t)atol(size), (uint32_t)strtoul(crc, NULL, 16))) {
+        _filesystem_transfer_start(FILESYSTEM_TRANSFER_SINK_FW, atol(size));
+        printf("fwload: ready\n");
+    }
+}
+
+static void _cmd_fwdelta(void) {
+    char *size = strtok(NULL, " \n");
+    char *crc = strtok(NULL, " \n");
+    if (size == NULL || crc == NULL) {
+        printf("usage: fwdelta size crc32\n");
+    } else if (fw_update_staging_begin_delta((uint32_t)atol(size), (uint32_t)strtoul(crc, NULL, 16))) {
+        // a delta stream's length isn't known up front; its terminator record ends it.
+        _filesystem_transfer_start(FILESYSTEM_TRANSFER_SINK_FW_DELTA, INT32_MAX);
+        printf("fwdelta: ready\n");
+    }
+}
+
+static void _cmd_fwstatus(void) {
+    fw_update_print_status();
+}
+
+static void _cmd_fwcancel(void) {
+    fw_update_cancel();
+    printf("fwcancel: disarmed\n");
+}
+#endif
+
+static void _cmd_df(void) {
+    printf("free space: %ld bytes\n", filesystem_get_free_space());
+}
+
+static void _cmd_mem(void) {
+    movement_memory_stats_t stats;
+    if (!movement_get_memory_stats(&stats)) {
+        printf("mem: no stats in the simulator\n");
+        return;
+    }
+    printf("stack: %lu of %lu bytes at peak, %lu headroom\n",
+           stats.stack_high_water, stats.stack_size, stats.stack_size - stats.stack_high_water);
+    printf("heap:  %lu of %lu bytes at peak, %lu headroom\n",
+           stats.heap_high_water, stats.heap_size, stats.heap_size - stats.heap_high_water);
+}
+
+static void _cmd_rm(void) {
+    char *filename = strtok(NULL, " \n");
+    if (filename == NULL) {
+        printf("usage: rm file\n");
+    } else {
+        filesystem_rm(filename);
+    }
+}
+
+static void _cmd_echo(void) {
+    char *text = malloc(248);
+    memset(text, 0, 248);
+    size_t pos = 0;
+    char *word = strtok(NULL, " \n");
+    while (word != NULL && strcmp(word, ">") && strcmp(word, ">>")) {
+        sprintf(text + pos, "%s ", word);
+        pos += strlen(word) + 1;
+        word = strtok(NULL, " \n");
+    }
+    char *filename = (word == NULL) ? NULL : strtok(NULL, " \n");
+    if (pos == 0 || filename == NULL) {
+        printf("usage: echo text > file\n");
+    } else if (strchr(filename, '/') || strchr(filename, '\\')) {
+        printf("subdirectories are not supported\n");
+    } else {
+        text[pos - 1] = 0;
+        if (!strcmp(word, ">")) {
             filesystem_write_file(filename, text, strlen(text));
             filesystem_append_file(filename, "\n", 1);
-        } else if (!strcmp(word, ">>")) {
+        } else {
             filesystem_append_file(filename, text, strlen(text));
             filesystem_append_file(filename, "\n", 1);
         }
-        free(text);
+    }
+    free(text);
+}
+
+#ifdef FILESYSTEM_STATS
+static void _cmd_fsstats(void) {
+    printf("cycles      <4k  <8k <16k <32k <64k <128k <256k  more\n");
+    for (uint8_t op = 0; op < FS_STAT_NUM_OPS; op++) {
+        printf("%-8s", _fs_stat_names[op]);
+        for (uint8_t bucket = 0; bucket < FS_STAT_BUCKETS; bucket++) {
+            printf(" %4u", _fs_stat_hist[op][bucket]);
+        }
+        printf("\n");
+    }
+
+    uint32_t total = 0;
+    uint16_t worst = 0;
+    for (uint8_t block = 0; block < sizeof(_fs_erase_counts) / sizeof(_fs_erase_counts[0]); block++) {
+        printf("row %2u: %u erases\n", block, _fs_erase_counts[block]);
+        total += _fs_erase_counts[block];
+        if (_fs_erase_counts[block] > worst) worst = _fs_erase_counts[block];
+    }
+    printf("total %lu erases since boot, worst row %u of %u rated cycles\n", total, worst, FS_RWWEE_RATED_CYCLES);
+
+    // a rate projection, not an odometer: the counters reset at boot, so this assumes a
+    // fresh part and that the workload since boot is representative.
+    uint32_t elapsed = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0) - _fs_stats_start_time;
+    if (worst > 0 && elapsed > 0) {
+        uint32_t days_left = (uint32_t)(((uint64_t)(FS_RWWEE_RATED_CYCLES - worst) * elapsed) / worst / 86400);
+        printf("at this rate the worst row wears out in ~%lu days\n", days_left);
     } else {
-        printf("%s: command not found\n", command);
+        printf("not enough data for a wear projection yet\n");
+    }
+}
+
+// In-place littlefs latency benchmark, the active counterpart to the passive histograms
+// above: it runs a matrix of operations against the filesystem as it actually stands —
+// aged metadata, fragmented free list and all — so the numbers degrade the way a real
+// unit's do, where a fresh image would flatter every figure. Costs a few dozen erases
+// on the benchmarked rows, which the wear counters above will show.
+#define FSBENCH_SAMPLES 15
+
+static void _fsbench_report(const char *op, uint16_t size, uint32_t *samples) {
+    for (uint8_t i = 1; i < FSBENCH_SAMPLES; i++) {
+        uint32_t v = samples[i];
+        int8_t j = i - 1;
+        while (j >= 0 && samples[j] > v) { samples[j + 1] = samples[j]; j--; }
+        samples[j + 1] = v;
+    }
+    printf("%-6s %4u B  p50 %8lu  p90 %8lu  max %8lu\n", op, size,
+           samples[FSBENCH_SAMPLES / 2], samples[(FSBENCH_SAMPLES * 9) / 10], samples[FSBENCH_SAMPLES - 1]);
+}
+
+static void _cmd_fsbench(void) {
+    static const uint16_t sizes[] = { 16, 64, 256 };
+    static char buf[256];
+    uint32_t samples[FSBENCH_SAMPLES];
+    char *benchfile = "_bench.tmp";
+
+    for (uint16_t i = 0; i < sizeof(buf); i++) buf[i] = (char)i;
+    printf("op       size  latency percentiles, in cycles (nanoseconds in the simulator)\n");
+    for (uint8_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint16_t size = sizes[s];
+        // the append cell grows the file to (FSBENCH_SAMPLES + 1) * size; make sure the
+        // benchmark can't be the thing that fills an aged filesystem to the brim.
+        if (filesystem_get_free_space() < (int32_t)((FSBENCH_SAMPLES + 1) * size + 512)) {
+            printf("%4u B: not enough free space, skipping\n", size);
+            continue;
+        }
+
+        // whole-call latency (open + I/O + close), which is what a face blocks on; the
+        // disjoint open/read/append sections live in the fsstats histograms instead.
+        for (uint8_t i = 0; i < FSBENCH_SAMPLES; i++) {
+            watch_profile_counter_start();
+            lfs_file_opencfg(&lfs, &file, benchfile, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC, &file_cfg);
+            lfs_file_write(&lfs, &file, buf, size);
+            lfs_file_close(&lfs, &file);
+            samples[i] = watch_profile_counter_stop();
+        }
+        _fsbench_report("create", size, samples);
+
+        for (uint8_t i = 0; i < FSBENCH_SAMPLES; i++) {
+            watch_profile_counter_start();
+            lfs_file_opencfg(&lfs, &file, benchfile, LFS_O_WRONLY | LFS_O_APPEND, &file_cfg);
+            lfs_file_write(&lfs, &file, buf, size);
+            lfs_file_close(&lfs, &file);
+            samples[i] = watch_profile_counter_stop();
+        }
+        _fsbench_report("append", size, samples);
+
+        for (uint8_t i = 0; i < FSBENCH_SAMPLES; i++) {
+            watch_profile_counter_start();
+            lfs_file_opencfg(&lfs, &file, benchfile, LFS_O_RDONLY, &file_cfg);
+            lfs_file_read(&lfs, &file, buf, size);
+            lfs_file_close(&lfs, &file);
+            samples[i] = watch_profile_counter_stop();
+        }
+        _fsbench_report("read", size, samples);
+
+        lfs_remove(&lfs, benchfile);
+    }
+
+    // create-then-delete churn: every cycle dirties metadata blocks, so a run of them
+    // forces littlefs into compaction and block reclaim — the worst-case stall a
+    // logging face can hit mid-write. The spread between p50 and max here is the
+    // number that grows as a unit ages.
+    for (uint8_t i = 0; i < FSBENCH_SAMPLES; i++) {
+        watch_profile_counter_start();
+        lfs_file_opencfg(&lfs, &file, benchfile, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC, &file_cfg);
+        lfs_file_write(&lfs, &file, buf, 64);
+        lfs_file_close(&lfs, &file);
+        lfs_remove(&lfs, benchfile);
+        samples[i] = watch_profile_counter_stop();
+    }
+    _fsbench_report("churn", 64, samples);
+
+    // the benchmark removed and truncated files behind the accounting's back.
+    _fs_used_blocks_valid = false;
+}
+#endif
+
+static const struct {
+    const char *name;
+    void (*handler)(void);
+} _shell_commands[] = {
+    { "ls", _cmd_ls },
+    { "cat", _cmd_cat },
+#ifdef MOVEMENT_PROFILE
+    { "profile", _cmd_profile },
+#endif
+#if __EMSCRIPTEN__
+    { "parity", _cmd_parity },
+#endif
+#ifdef FILESYSTEM_STATS
+    { "fsstats", _cmd_fsstats },
+    { "fsbench", _cmd_fsbench },
+#endif
+    { "bootlog", _cmd_bootlog },
+    { "wakes", _cmd_wakes },
+    { "drift", _cmd_drift },
+    { "clocks", _cmd_clocks },
+    { "crashes", _cmd_crashes },
+    { "trace", _cmd_trace },
+    { "order", _cmd_order },
+    { "laps", _cmd_laps },
+    { "suntable", _cmd_suntable },
+    { "sync", _cmd_sync },
+    { "fsdump", _cmd_fsdump },
+    { "fsload", _cmd_fsload },
+#if !__EMSCRIPTEN__
+    { "fwload", _cmd_fwload },
+    { "fwdelta", _cmd_fwdelta },
+    { "fwstatus", _cmd_fwstatus },
+    { "fwcancel", _cmd_fwcancel },
+#endif
+    { "df", _cmd_df },
+    { "mem", _cmd_mem },
+    { "rm", _cmd_rm },
+    { "echo", _cmd_echo },
+};
+
+void filesystem_process_command(char *line) {
+#if __EMSCRIPTEN__
+    printf("$ %s", line); // the simulator console doesn't echo as you type
+#endif
+    char *command = strtok(line, " \n");
+    if (command == NULL) return;
+    for (size_t i = 0; i < sizeof(_shell_commands) / sizeof(_shell_commands[0]); i++) {
+        if (strcmp(command, _shell_commands[i].name) == 0) {
+            _shell_commands[i].handler();
+            return;
+        }
+    }
+    printf("%s: command not found\n", command);
+}
+
+#if !__EMSCRIPTEN__
+
+// The interactive console, called once per loop pass while USB is up. The command line
+// is assembled incrementally, each byte echoed as it is consumed from the CDC receive
+// ring — typing feels live even when the loop is between ticks — and any command that
+// yielded mid-output is resumed before new input is read.
+
+static char _shell_line[256];
+static uint8_t _shell_line_len = 0;
+static bool _shell_prompted = false;
+
+static void _shell_continue_cat(void) {
+    char chunk[256];
+    lfs_ssize_t count = lfs_file_read(&lfs, &_cat.file, chunk, sizeof(chunk));
+    if (count > 0) {
+        write(STDOUT_FILENO, chunk, count);
+        return;
     }
+    lfs_file_close(&lfs, &_cat.file);
+    write(STDOUT_FILENO, "\n", 1);
+    _cat.active = false;
 }
+
+bool filesystem_shell_task(void) {
+    if (_cat.active) {
+        // one slice per pass; the tick loop keeps running underneath a long dump.
+        _shell_continue_cat();
+        return true;
+    }
+
+    if (transfer.active) {
+        // a binary fsload only saturates the wire if we drain bytes as they arrive, so
+        // stay here until the transfer finishes (or the host goes quiet for two seconds)
+        // rather than returning to once-per-pass reads.
+        char buf[256];
+        uint16_t idle_ms = 0;
+        while (transfer.active && idle_ms < 2000) {
+            int len = read(0, buf, sizeof(buf));
+            if (len > 0) {
+                filesystem_process_transfer(buf, len);
+                idle_ms = 0;
+            } else {
+                delay_ms(1);
+                idle_ms++;
+            }
+        }
+        if (transfer.active) filesystem_abort_transfer();
+        _shell_prompted = false;
+        return false;
+    }
+
+    if (!_shell_prompted) {
+        write(STDOUT_FILENO, "$ ", 2);
+        _shell_prompted = true;
+    }
+
+    char buf[64];
+    int len = read(0, buf, sizeof(buf));
+    for (int i = 0; i < len; i++) {
+        char c = buf[i];
+        if (c == '\r' || c == '\n') {
+            write(STDOUT_FILENO, "\n", 1);
+            _shell_line[_shell_line_len] = 0;
+            bool had_line = _shell_line_len > 0;
+            _shell_line_len = 0;
+            _shell_prompted = false;
+            if (had_line) filesystem_process_command(_shell_line);
+            if (transfer.active) {
+                // the rest of this read already belongs to the binary stream.
+                filesystem_process_transfer(buf + i + 1, len - i - 1);
+                return true;
+            }
+            if (_cat.active) return true;
+        } else if (c == '\b' || c == 0x7F) {
+            if (_shell_line_len > 0) {
+                _shell_line_len--;
+                write(STDOUT_FILENO, "\b \b", 3);
+            }
+        } else if (c >= 0x20 && c < 0x7F && _shell_line_len < sizeof(_shell_line) - 1) {
+            _shell_line[_shell_line_len++] = c;
+            write(STDOUT_FILENO, &c, 1);
+        }
+    }
+
+    return false;
+}
+
+#endif // !__EMSCRIPTEN__
+
@@ -35,6 +35,9 @@ bool filesystem_init(void);
 
 /** @brief Gets the space available on the filesystem.
   * @return the free space in bytes
+  * @note Cheap to call repeatedly: the answer comes from a running block count, and the
+  *       filesystem is only re-walked after an operation that freed blocks, or to confirm
+  *       a near-full reading. Logging faces can check headroom before every append.
   */
 int32_t filesystem_get_free_space(void);
 
@@ -69,6 +72,16 @@ int32_t filesystem_get_file_size(char *filename);
   */
 bool filesystem_read_file(char *filename, char *buf, int32_t length);
 
+/** @brief Reads a range of bytes from a file into a buffer
+  * @param filename the file you wish to read
+  * @param buf A buffer of at least length bytes
+  * @param offset The offset into the file to read from
+  * @param length The number of bytes to read
+  * @return true if the read was successful; false otherwise, including if the range
+  *         extends past the end of the file.
+  */
+bool filesystem_read_file_range(char *filename, char *buf, int32_t offset, int32_t length);
+
 /** @brief Reads a line from a file into a buffer
   * @param filename the file you wish to read
   * @param buf A buffer of at least length + 1 bytes; the file will be read into this buffer,
@@ -80,6 +93,61 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length);
   */
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length);
 
+/** @brief Creates a fixed-record circular log file, preallocated to its full size.
+  * @param filename the log file to create
+  * @param record_size the size of one record in bytes
+  * @param capacity the number of records the log holds before overwriting the oldest
+  * @return true if the log exists and is ready for appends; false otherwise
+  * @note If a log with the same record size and capacity already exists at this path, it is
+  *       kept as is, contents included — so faces can call this unconditionally at setup.
+  *       Appends never grow the file: each one overwrites a single record slot plus the small
+  *       header, no matter how much history the log holds, which makes logging for weeks
+  *       practical on the 8kb filesystem.
+  */
+bool filesystem_ringlog_create(char *filename, uint8_t record_size, uint8_t capacity);
+
+/** @brief Appends a record to a circular log, overwriting the oldest record once full.
+  * @param filename a log file created with filesystem_ringlog_create
+  * @param record a buffer of the log's record size
+  * @return true if the record was written; false otherwise
+  */
+bool filesystem_ringlog_append(char *filename, void *record);
+
+/** @brief Gets the number of records currently in a circular log.
+  * @param filename a log file created with filesystem_ringlog_create
+  * @return the record count, or -1 if the file is missing or not a ring log.
+  */
+int16_t filesystem_ringlog_count(char *filename);
+
+/** @brief Reads one record from a circular log.
+  * @param filename a log file created with filesystem_ringlog_create
+  * @param index which record to read; 0 is the oldest record still in the log.
+  * @param record a buffer of the log's record size; the record is read into this buffer
+  * @return true if the record was read; false otherwise
+  */
+bool filesystem_ringlog_read(char *filename, uint8_t index, void *record);
+
+/** @brief Opens a file for sequential line iteration with filesystem_reader_read_line.
+  * @param filename the file you wish to iterate over
+  * @return true if the file was opened; false if it could not be, or if a reader is already open.
+  * @note Unlike filesystem_read_line, the reader keeps the file open and reads ahead in 128-byte
+  *       chunks, so iterating a whole file touches each storage page once instead of once per
+  *       line. Only one reader can be open at a time; close it with filesystem_reader_close.
+  */
+bool filesystem_reader_open(char *filename);
+
+/** @brief Closes the reader opened with filesystem_reader_open. */
+void filesystem_reader_close(void);
+
+/** @brief Reads the next line from the open reader into a buffer
+  * @param buf A buffer of at least length + 1 bytes; the last byte is guaranteed to be 0.
+  * @param length The maximum number of bytes to read
+  * @return true if a line was read; false at end of file or on error.
+  * @note A line longer than length bytes is returned truncated, and the next call continues
+  *       from within the same line.
+  */
+bool filesystem_reader_read_line(char *buf, int32_t length);
+
 /** @brief Writes file to the filesystem
   * @param filename the file you wish to write
   * @param text The contents of the file
@@ -101,4 +169,37 @@ bool filesystem_append_file(char *filename, char *text, int32_t length);
   */
 void filesystem_process_command(char *line);
 
+/** @brief Runs one pass of the interactive serial console; movement calls this once per
+  *        loop pass while USB is enabled (hardware builds only).
+  * @details Consumes any bytes waiting in the CDC receive ring, echoing them back as it
+  *          goes (backspace included) and dispatching each completed line to
+  *          filesystem_process_command. Long-running commands yield: `cat` streams one
+  *          slice of the file per pass, so dumping a large log never stalls the tick
+  *          loop underneath it.
+  * @return True if a yielded command still has output pending, in which case the caller
+  *         should come straight back for another pass instead of sleeping.
+  */
+bool filesystem_shell_task(void);
+
+/** @brief Checks whether a binary fsload transfer is waiting for data.
+  * @return true if the `fsload` command has started a transfer that hasn't finished.
+  * @note While a transfer is in progress, incoming console bytes belong to it and must be
+  *       fed to filesystem_process_transfer instead of filesystem_process_command.
+  */
+bool filesystem_transfer_in_progress(void);
+
+/** @brief Feeds incoming console bytes to the binary transfer started by `fsload`.
+  * @param data the bytes received from the serial console
+  * @param length how many bytes were received
+  * @note Data arrives as a sequence of framed chunks, each an 8-byte header (magic "FS",
+  *       a 16-bit payload length of at most 512, and a CRC-32 of the payload using
+  *       littlefs's polynomial) followed by the payload. Each verified chunk is appended
+  *       to the file and acknowledged with an "ok" line; a zero-length chunk, a bad
+  *       checksum or a malformed header abandons the transfer and removes the file.
+  */
+void filesystem_process_transfer(char *data, int32_t length);
+
+/** @brief Abandons a binary transfer that has stalled, removing the partial file. */
+void filesystem_abort_transfer(void);
+
 #endif // FILESYSTEM_H_
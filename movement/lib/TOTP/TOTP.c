@@ -1,69 +1,165 @@
-#include "TOTP.h"
-#include "sha1.h"
-#include "sha256.h"
-#include "sha512.h"
-#include <stdio.h>
-
-uint8_t* _hmacKey;
-uint8_t _keyLength;
-uint8_t _timeZoneOffset;
-uint32_t _timeStep;
-hmac_alg _algorithm;
-
-// Init the library with the private key, its length, the timeStep duration and the algorithm that should be used
-void TOTP(uint8_t* hmacKey, uint8_t keyLength, uint32_t timeStep, hmac_alg algorithm) {
-    _hmacKey = hmacKey;
-    _keyLength = keyLength;
-    _timeStep = timeStep;
-    _algorithm = algorithm;
-}
-
-void setTimezone(uint8_t timezone){
-    _timeZoneOffset = timezone;
-}
-
-static uint32_t TimeStruct2Timestamp(struct tm time){
-    //time.tm_mon -= 1;
-    //time.tm_year -= 1900;
-    return mktime(&(time)) - (_timeZoneOffset * 3600) - 2208988800;
-}
-
-// Generate a code, using the timestamp provided
-uint32_t getCodeFromTimestamp(uint32_t timeStamp) {
-    uint32_t steps = timeStamp / _timeStep;
-    return getCodeFromSteps(steps);
-}
-
-// Generate a code, using the timestamp provided
-uint32_t getCodeFromTimeStruct(struct tm time) {
-    return getCodeFromTimestamp(TimeStruct2Timestamp(time));
-}
-
-// Generate a code, using the number of steps provided
-uint32_t getCodeFromSteps(uint32_t steps) {
-    // STEP 0, map the number of steps in a 8-bytes array (counter value)
-    uint8_t _byteArray[8];
-    _byteArray[0] = 0x00;
-    _byteArray[1] = 0x00;
-    _byteArray[2] = 0x00;
-    _byteArray[3] = 0x00;
-    _byteArray[4] = (uint8_t)((steps >> 24) & 0xFF);
-    _byteArray[5] = (uint8_t)((steps >> 16) & 0xFF);
-    _byteArray[6] = (uint8_t)((steps >> 8) & 0XFF);
-    _byteArray[7] = (uint8_t)((steps & 0XFF));
-
-    switch(_algorithm){
-        case SHA1:
-            return(TOTP_HMAC_SHA1(_hmacKey, _keyLength, _byteArray, 8));
-        case SHA224:
-            return(TOTP_HMAC_SHA256(_hmacKey, _keyLength, _byteArray, 8, 1));
-        case SHA256:
-            return(TOTP_HMAC_SHA256(_hmacKey, _keyLength, _byteArray, 8, 0));
-        case SHA384:
-            return(TOTP_HMAC_SHA512(_hmacKey, _keyLength, _byteArray, 8, 1));
-        case SHA512:
-            return(TOTP_HMAC_SHA512(_hmacKey, _keyLength, _byteArray, 8, 0));
-        default:
-            return(0);
-    }
-}
+#include "TOTP.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "sha512.h"
+#include <stdio.h>
+#include <string.h>
+
+uint8_t* _hmacKey;
+uint8_t _keyLength;
+uint8_t _timeZoneOffset;
+uint32_t _timeStep;
+hmac_alg _algorithm;
+
+// HMAC splits into two hashes, and the first block of each is derived from the key alone:
+// the key XORed with the inner and outer pad bytes. For SHA-1 and SHA-256 we run those two
+// blocks through the compression function once, when the key is set, and stash the resulting
+// states here. Generating a code then resumes from the stashed states and only hashes the
+// 8-byte counter and the inner digest — two compression calls instead of four, and no
+// rebuilding (or zeroing) of the 64-byte pad blocks per code.
+static mbedtls_sha1_context _sha1_inner, _sha1_outer;
+static mbedtls_sha256_context _sha256_inner, _sha256_outer;
+
+static void _totp_sha1_cache_key(void) {
+    uint8_t k_pad[SHA1_BLOCK_LENGTH];
+    uint8_t i;
+
+    memset(k_pad, 0, sizeof(k_pad));
+    if (_keyLength <= SHA1_BLOCK_LENGTH) memcpy(k_pad, _hmacKey, _keyLength);
+    else mbedtls_sha1(_hmacKey, _keyLength, k_pad);
+
+    for (i = 0; i < SHA1_BLOCK_LENGTH; i++) k_pad[i] ^= HMAC_IPAD;
+    mbedtls_sha1_init(&_sha1_inner);
+    mbedtls_sha1_starts(&_sha1_inner);
+    mbedtls_sha1_process(&_sha1_inner, k_pad);
+    _sha1_inner.total[0] = SHA1_BLOCK_LENGTH;
+
+    for (i = 0; i < SHA1_BLOCK_LENGTH; i++) k_pad[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+    mbedtls_sha1_init(&_sha1_outer);
+    mbedtls_sha1_starts(&_sha1_outer);
+    mbedtls_sha1_process(&_sha1_outer, k_pad);
+    _sha1_outer.total[0] = SHA1_BLOCK_LENGTH;
+}
+
+static void _totp_sha256_cache_key(int is224) {
+    uint8_t k_pad[SHA256_BLOCK_LENGTH];
+    uint8_t i;
+
+    memset(k_pad, 0, sizeof(k_pad));
+    if (_keyLength <= SHA256_BLOCK_LENGTH) memcpy(k_pad, _hmacKey, _keyLength);
+    else mbedtls_sha256(_hmacKey, _keyLength, k_pad, is224);
+
+    for (i = 0; i < SHA256_BLOCK_LENGTH; i++) k_pad[i] ^= HMAC_IPAD;
+    mbedtls_sha256_init(&_sha256_inner);
+    mbedtls_sha256_starts(&_sha256_inner, is224);
+    mbedtls_sha256_process(&_sha256_inner, k_pad);
+    _sha256_inner.total[0] = SHA256_BLOCK_LENGTH;
+
+    for (i = 0; i < SHA256_BLOCK_LENGTH; i++) k_pad[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+    mbedtls_sha256_init(&_sha256_outer);
+    mbedtls_sha256_starts(&_sha256_outer, is224);
+    mbedtls_sha256_process(&_sha256_outer, k_pad);
+    _sha256_outer.total[0] = SHA256_BLOCK_LENGTH;
+}
+
+// Init the library with the private key, its length, the timeStep duration and the algorithm that should be used
+void TOTP(uint8_t* hmacKey, uint8_t keyLength, uint32_t timeStep, hmac_alg algorithm) {
+    _hmacKey = hmacKey;
+    _keyLength = keyLength;
+    _timeStep = timeStep;
+    _algorithm = algorithm;
+
+    switch(algorithm){
+        case SHA1:
+            _totp_sha1_cache_key();
+            break;
+        case SHA224:
+            _totp_sha256_cache_key(1);
+            break;
+        case SHA256:
+            _totp_sha256_cache_key(0);
+            break;
+        default:
+            // the SHA-512 variants take the uncached path in getCodeFromSteps
+            break;
+    }
+}
+
+void setTimezone(uint8_t timezone){
+    _timeZoneOffset = timezone;
+}
+
+static uint32_t TimeStruct2Timestamp(struct tm time){
+    //time.tm_mon -= 1;
+    //time.tm_year -= 1900;
+    return mktime(&(time)) - (_timeZoneOffset * 3600) - 2208988800;
+}
+
+// Generate a code, using the timestamp provided
+uint32_t getCodeFromTimestamp(uint32_t timeStamp) {
+    uint32_t steps = timeStamp / _timeStep;
+    return getCodeFromSteps(steps);
+}
+
+// Generate a code, using the timestamp provided
+uint32_t getCodeFromTimeStruct(struct tm time) {
+    return getCodeFromTimestamp(TimeStruct2Timestamp(time));
+}
+
+// Dynamic truncation (RFC 4226): pick 31 bits from the hash, reduce to 6 digits
+static uint32_t _totp_truncate(const uint8_t *hash, uint8_t hash_length) {
+    uint32_t truncated_hash = 0;
+    uint8_t _offset = hash[hash_length - 1] & 0xF;
+    uint8_t j;
+    for (j = 0; j < 4; ++j) {
+        truncated_hash <<= 8;
+        truncated_hash  |= hash[_offset + j];
+    }
+    truncated_hash &= 0x7FFFFFFF;
+    return truncated_hash % 1000000;
+}
+
+// Generate a code, using the number of steps provided
+uint32_t getCodeFromSteps(uint32_t steps) {
+    // STEP 0, map the number of steps in a 8-bytes array (counter value)
+    uint8_t _byteArray[8];
+    _byteArray[0] = 0x00;
+    _byteArray[1] = 0x00;
+    _byteArray[2] = 0x00;
+    _byteArray[3] = 0x00;
+    _byteArray[4] = (uint8_t)((steps >> 24) & 0xFF);
+    _byteArray[5] = (uint8_t)((steps >> 16) & 0xFF);
+    _byteArray[6] = (uint8_t)((steps >> 8) & 0XFF);
+    _byteArray[7] = (uint8_t)((steps & 0XFF));
+
+    switch(_algorithm){
+        case SHA1: {
+            uint8_t hash[SHA1_DIGEST_LENGTH];
+            mbedtls_sha1_context ctx = _sha1_inner;
+            mbedtls_sha1_update(&ctx, _byteArray, 8);
+            mbedtls_sha1_finish(&ctx, hash);
+            ctx = _sha1_outer;
+            mbedtls_sha1_update(&ctx, hash, SHA1_DIGEST_LENGTH);
+            mbedtls_sha1_finish(&ctx, hash);
+            return _totp_truncate(hash, SHA1_DIGEST_LENGTH);
+        }
+        case SHA224:
+        case SHA256: {
+            uint8_t hash[SHA256_DIGEST_LENGTH];
+            uint8_t hash_length = (_algorithm == SHA224) ? SHA224_DIGEST_LENGTH : SHA256_DIGEST_LENGTH;
+            mbedtls_sha256_context ctx = _sha256_inner;
+            mbedtls_sha256_update(&ctx, _byteArray, 8);
+            mbedtls_sha256_finish(&ctx, hash);
+            ctx = _sha256_outer;
+            mbedtls_sha256_update(&ctx, hash, hash_length);
+            mbedtls_sha256_finish(&ctx, hash);
+            return _totp_truncate(hash, hash_length);
+        }
+        case SHA384:
+            return(TOTP_HMAC_SHA512(_hmacKey, _keyLength, _byteArray, 8, 1));
+        case SHA512:
+            return(TOTP_HMAC_SHA512(_hmacKey, _keyLength, _byteArray, 8, 0));
+        default:
+            return(0);
+    }
+}
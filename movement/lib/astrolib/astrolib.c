@@ -1,7 +1,7 @@
 /*
  * Partial C port of Greg Miller's public domain astro library (gmiller@gregmiller.net) 2019
  * https://github.com/gmiller123456/astrogreg
- * 
+ *
  * Ported by Joey Castillo for Sensor Watch
  * https://github.com/joeycastillo/Sensor-Watch/
  *
@@ -21,26 +21,11 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include "astrolib.h"
-#include "vsop87a_milli.h"
+#include "vsop87a_pruned.h"
 
 double astro_convert_utc_to_tt(double jd) ;
-double astro_get_GMST(double ut1);
 astro_cartesian_coordinates_t astro_subtract_cartesian(astro_cartesian_coordinates_t a, astro_cartesian_coordinates_t b);
-astro_cartesian_coordinates_t astro_rotate_from_vsop_to_J2000(astro_cartesian_coordinates_t c);
-astro_matrix_t astro_get_x_rotation_matrix(double r);
-astro_matrix_t astro_get_y_rotation_matrix(double r);
-astro_matrix_t astro_get_z_rotation_matrix(double r);
-astro_matrix_t astro_transpose_matrix(astro_matrix_t m);
-astro_matrix_t astro_dot_product(astro_matrix_t a, astro_matrix_t b);
-astro_matrix_t astro_get_precession_matrix(double jd);
-astro_cartesian_coordinates_t astro_matrix_multiply(astro_cartesian_coordinates_t v, astro_matrix_t m);
-astro_cartesian_coordinates_t astro_convert_geodedic_latlon_to_ITRF_XYZ(double lat, double lon, double height);
-astro_cartesian_coordinates_t astro_convert_ITRF_to_GCRS(astro_cartesian_coordinates_t r, double ut1);
-astro_cartesian_coordinates_t astro_convert_coordinates_from_meters_to_AU(astro_cartesian_coordinates_t c);
-astro_cartesian_coordinates_t astro_get_observer_geocentric_coords(double jd, double lat, double lon);
-astro_cartesian_coordinates_t astro_get_body_coordinates(astro_body_t bodyNum, double et);
 astro_cartesian_coordinates_t astro_get_body_coordinates_light_time_adjusted(astro_body_t body, astro_cartesian_coordinates_t origin, double t);
-astro_equatorial_coordinates_t astro_convert_cartesian_to_polar(astro_cartesian_coordinates_t xyz);
 
 //Special "Math.floor()" function used by convertDateToJulianDate()
 static double _astro_special_floor(double d) {
@@ -70,13 +55,298 @@ double astro_convert_date_to_julian_date(uint16_t year, uint8_t month, uint8_t d
     return jd;
 }
 
+// ---------------------------------------------------------------------------
+// Fixed point geometry core.
+//
+// Once the VSOP87 series have produced a geocentric vector, everything left
+// to do -- the frame rotations, precession, parallax, the polar conversion
+// and alt/az -- is unit-scale geometry, and softfloat doubles are a painfully
+// slow way to do it on a Cortex M0+. So the vector is normalized once and the
+// rest of the pipeline runs in integer math: unit-scale quantities (vector
+// components, matrix elements, sines) as Q2.30, and angles as 32-bit binary
+// turns, where 2^32 is one full revolution and reduction comes free with the
+// wraparound. Worst case disagreement with the old double pipeline is a few
+// arcseconds, far below anything the display can show.
+
+typedef int32_t astro_fix_t; // Q2.30
+#define ASTRO_FIX_ONE ((astro_fix_t)1 << 30)
+
+// one binary angle unit in radians: 2 pi / 2^32
+#define ASTRO_RADIANS_PER_TURN_UNIT 1.4629180792671596e-9
+
+typedef struct {
+    astro_fix_t x;
+    astro_fix_t y;
+    astro_fix_t z;
+} astro_fix_vector_t;
+
+typedef struct {
+    astro_fix_t elements[3][3];
+} astro_fix_matrix_t;
+
+static astro_fix_t _astro_fix_mul(astro_fix_t a, astro_fix_t b) {
+    return (astro_fix_t)(((int64_t)a * b) >> 30);
+}
+
+static astro_fix_t _astro_fix_from_double(double d) {
+    return (astro_fix_t)llround(d * (double)ASTRO_FIX_ONE);
+}
+
+static uint32_t _astro_turns_from_radians(double radians) {
+    return (uint32_t)(int64_t)llround(radians / ASTRO_RADIANS_PER_TURN_UNIT);
+}
+
+// sine of a binary angle: fold into the first quarter wave, then a degree-7
+// odd polynomial fit of sin(pi/2 x) on [0,1], good to 6e-7 -- about a tenth
+// of an arcsecond by the time the result feeds back into an angle.
+static astro_fix_t _astro_fix_sin(uint32_t angle) {
+    uint32_t quadrant = angle >> 30;
+    astro_fix_t x = (astro_fix_t)(angle & 0x3FFFFFFF);
+    if (quadrant & 1) x = ASTRO_FIX_ONE - x;
+
+    astro_fix_t x2 = _astro_fix_mul(x, x);
+    astro_fix_t s = _astro_fix_mul(x, 1686623980 + _astro_fix_mul(x2, -693521966 + _astro_fix_mul(x2, 85291577 + _astro_fix_mul(x2, -4652396))));
+
+    return (quadrant & 2) ? -s : s;
+}
+
+static astro_fix_t _astro_fix_cos(uint32_t angle) {
+    return _astro_fix_sin(angle + 0x40000000);
+}
+
+// atan(2^-i) as binary angles: the CORDIC angle table.
+static const int32_t _astro_cordic_angles[24] = {
+    536870912, 316933406, 167458907, 85004756, 42667331, 21354465,
+    10679838, 5340245, 2670163, 1335087, 667544, 333772,
+    166886, 83443, 41722, 20861, 10430, 5215,
+    2608, 1304, 652, 326, 163, 81
+};
+
+// 1 / 1.64676..., Q2.30: compensates the CORDIC's intrinsic gain.
+#define ASTRO_CORDIC_INVERSE_GAIN 652032874
+
+// atan2 as a binary angle via CORDIC vectoring mode; as a byproduct the
+// rotated x holds gain * sqrt(x^2 + y^2), which callers collect through
+// *mag. Inputs are pre-shifted down two bits so the gain (times sqrt(2),
+// for a worst case diagonal) can't push the working x out the top of int32.
+static int32_t _astro_fix_atan2(astro_fix_t y, astro_fix_t x, astro_fix_t *mag) {
+    int32_t angle = 0;
+
+    if (x == 0 && y == 0) {
+        if (mag) *mag = 0;
+        return 0;
+    }
+
+    x >>= 2;
+    y >>= 2;
+
+    // pre-rotate by a quarter turn so the vector lands in the right half
+    // plane, where the CORDIC iteration converges.
+    if (x < 0) {
+        astro_fix_t t = x;
+        if (y >= 0) {
+            x = y;
+            y = -t;
+            angle = 0x40000000;
+        } else {
+            x = -y;
+            y = t;
+            angle = -0x40000000;
+        }
+    }
+
+    for (int i = 0; i < 24; i++) {
+        astro_fix_t xt;
+        if (y > 0) {
+            xt = x + (y >> i);
+            y -= (x >> i);
+            angle += _astro_cordic_angles[i];
+        } else {
+            xt = x - (y >> i);
+            y += (x >> i);
+            angle -= _astro_cordic_angles[i];
+        }
+        x = xt;
+    }
+
+    if (mag) *mag = (astro_fix_t)((((int64_t)x * ASTRO_CORDIC_INVERSE_GAIN) >> 30) << 2);
+    return angle;
+}
+
+static uint32_t _astro_isqrt64(uint64_t v) {
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= result + bit) {
+            v -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+// sqrt of a non-negative Q2.30 value.
+static astro_fix_t _astro_fix_sqrt(astro_fix_t x) {
+    if (x <= 0) return 0;
+    return (astro_fix_t)_astro_isqrt64((uint64_t)(uint32_t)x << 30);
+}
+
+// public faces of the trig core, for callers doing their own spherical math
+// on binary angles (the star catalog face's hour-angle computation).
+
+int32_t astro_sin_turns(uint32_t angle) {
+    return _astro_fix_sin(angle);
+}
+
+int32_t astro_cos_turns(uint32_t angle) {
+    return _astro_fix_cos(angle);
+}
+
+uint32_t astro_acos_turns(int32_t x) {
+    if (x >= ASTRO_FIX_ONE) return 0;
+    if (x <= -ASTRO_FIX_ONE) return 0x80000000;
+    astro_fix_t y = _astro_fix_sqrt(ASTRO_FIX_ONE - _astro_fix_mul(x, x));
+    return (uint32_t)_astro_fix_atan2(y, x, NULL);
+}
+
+static astro_fix_vector_t _astro_fix_matrix_multiply(astro_fix_vector_t v, astro_fix_matrix_t m) {
+    astro_fix_vector_t t;
+
+    t.x = (astro_fix_t)(((int64_t)v.x * m.elements[0][0] + (int64_t)v.y * m.elements[0][1] + (int64_t)v.z * m.elements[0][2]) >> 30);
+    t.y = (astro_fix_t)(((int64_t)v.x * m.elements[1][0] + (int64_t)v.y * m.elements[1][1] + (int64_t)v.z * m.elements[1][2]) >> 30);
+    t.z = (astro_fix_t)(((int64_t)v.x * m.elements[2][0] + (int64_t)v.y * m.elements[2][1] + (int64_t)v.z * m.elements[2][2]) >> 30);
+
+    return t;
+}
+
+static astro_fix_matrix_t _astro_fix_dot_product(astro_fix_matrix_t a, astro_fix_matrix_t b) {
+    astro_fix_matrix_t retval;
+
+    for(uint8_t i = 0; i < 3 ; i++) {
+        for(uint8_t j = 0 ; j < 3 ; j++) {
+            int64_t temp = 0;
+            for(uint8_t k = 0; k < 3 ; k++) {
+                temp += (int64_t)a.elements[i][k] * b.elements[k][j];
+            }
+            retval.elements[i][j] = (astro_fix_t)(temp >> 30);
+        }
+    }
+
+    return retval;
+}
+
+static astro_fix_matrix_t _astro_fix_transpose_matrix(astro_fix_matrix_t m) {
+    astro_fix_matrix_t retval;
+    for(uint8_t i = 0; i < 3 ; i++) {
+        for(uint8_t j = 0 ; j < 3 ; j++) {
+            retval.elements[i][j] = m.elements[j][i];
+        }
+    }
+    return retval;
+}
+
+//Gets a rotation matrix about the x axis for a binary angle. (The y axis
+//rotation was never used, so it has no fixed point port.)
+static astro_fix_matrix_t _astro_fix_x_rotation_matrix(uint32_t r) {
+    astro_fix_t c = _astro_fix_cos(r);
+    astro_fix_t s = _astro_fix_sin(r);
+    astro_fix_matrix_t t = { .elements = {
+        { ASTRO_FIX_ONE, 0, 0 },
+        { 0, c, s },
+        { 0, -s, c },
+    } };
+    return t;
+}
+
+//Gets a rotation matrix about the z axis for a binary angle.
+static astro_fix_matrix_t _astro_fix_z_rotation_matrix(uint32_t r) {
+    astro_fix_t c = _astro_fix_cos(r);
+    astro_fix_t s = _astro_fix_sin(r);
+    astro_fix_matrix_t t = { .elements = {
+        { c, s, 0 },
+        { -s, c, 0 },
+        { 0, 0, ASTRO_FIX_ONE },
+    } };
+    return t;
+}
+
+static astro_fix_matrix_t _astro_fix_precession_matrix(double jd) {
+    //2006 IAU Precession.  Implemented from IERS Technical Note No 36 ch5.
+    //https://www.iers.org/SharedDocs/Publikationen/EN/IERS/Publications/tn/TechnNote36/tn36_043.pdf?__blob=publicationFile&v=1
+    //The polynomial coefficients are pre-converted from arcseconds to binary
+    //angle units (1 arcsecond = 2^32 / 1296000 units, so the lsb is a third
+    //of a milliarcsecond; coefficients under half a unit are dropped), with
+    //t in Q2.30 Julian centuries -- inside the format until the RTC gives
+    //out in 2083.
+    astro_fix_t t = _astro_fix_from_double((jd - 2451545.0) / 36525.0);  //5.2
+
+    int32_t e0 = 279641496; //84381.406 arcsec, 5.6.4
+    int32_t omegaA = e0 + (int32_t)(((int64_t)(-85 + _astro_fix_mul(t, 170 + _astro_fix_mul(t, -26))) * t) >> 30); //5.39
+    int32_t psiA = (int32_t)(((int64_t)(16697618 + _astro_fix_mul(t, -3576 + _astro_fix_mul(t, -4))) * t) >> 30); //5.39
+    int32_t chiA = (int32_t)(((int64_t)(34984 + _astro_fix_mul(t, -7892 + _astro_fix_mul(t, -4 + _astro_fix_mul(t, 1)))) * t) >> 30); //5.40
+
+    //Rotation matrix from 5.4.5
+    //(R1(−e0) · R3(psiA) · R1(omegaA) · R3(−chiA))
+    //Above eq rotates from "of date" to J2000, so we reverse the signs to go from J2000 to "of date"
+    astro_fix_matrix_t m1 = _astro_fix_x_rotation_matrix((uint32_t)e0);
+    astro_fix_matrix_t m2 = _astro_fix_z_rotation_matrix((uint32_t)-psiA);
+    astro_fix_matrix_t m3 = _astro_fix_x_rotation_matrix((uint32_t)-omegaA);
+    astro_fix_matrix_t m4 = _astro_fix_z_rotation_matrix((uint32_t)chiA);
+
+    astro_fix_matrix_t m5 = _astro_fix_dot_product(m4, m3);
+    astro_fix_matrix_t m6 = _astro_fix_dot_product(m5, m2);
+    astro_fix_matrix_t precessionMatrix = _astro_fix_dot_product(m6, m1);
+
+    return precessionMatrix;
+}
+
+//Observer's geocentric position as a unit-scale direction: geodedic lat/lon
+//to ITRF XYZ in units of the equatorial radius (Explanatory Supplement to the
+//Astronomical Almanac 3rd ed. P294, height 0), rotated about Z by -GMST into
+//the celestial frame.  The caller scales it into the body vector's units.
+static astro_fix_vector_t _astro_fix_observer_direction(double jd, uint32_t lat, uint32_t lon) {
+    const astro_fix_t one_minus_f_squared = 1066553769; //(1 - 1/298.25642)^2
+
+    astro_fix_t coslat = _astro_fix_cos(lat);
+    astro_fix_t sinlat = _astro_fix_sin(lat);
+
+    astro_fix_t C = _astro_fix_sqrt(_astro_fix_mul(coslat, coslat) + _astro_fix_mul(one_minus_f_squared, _astro_fix_mul(sinlat, sinlat)));
+    astro_fix_t S = _astro_fix_mul(one_minus_f_squared, C);
+
+    astro_fix_vector_t r;
+    r.x = _astro_fix_mul(_astro_fix_mul(C, coslat), _astro_fix_cos(lon));
+    r.y = _astro_fix_mul(_astro_fix_mul(C, coslat), _astro_fix_sin(lon));
+    r.z = _astro_fix_mul(S, sinlat);
+
+    //This is a simple rotation about the Z axis, rotation angle is -GMST
+    uint32_t gmst = (uint32_t)(uint64_t)llround(astro_get_GMST(jd) * (4294967296.0 / 24.0));
+    return _astro_fix_matrix_multiply(r, _astro_fix_z_rotation_matrix((uint32_t)-gmst));
+}
+
+// ---------------------------------------------------------------------------
+
 //Return all values in radians.
 //The positions are adjusted for the parallax of the Earth, and the offset of the observer from the Earth's center
 //All input and output angles are in radians!
 astro_equatorial_coordinates_t astro_get_ra_dec(double jd, astro_body_t body, double lat, double lon, bool calculate_precession) {
+    /* From VSOP87.doc
+        X        +1.000000000000  +0.000000440360  -0.000000190919   X
+        Y     =  -0.000000479966  +0.917482137087  -0.397776982902   Y
+        Z FK5     0.000000000000  +0.397776982902  +0.917482137087   Z VSOP87A
+    */
+    static const astro_fix_matrix_t vsop_to_j2000 = { .elements = {
+        { ASTRO_FIX_ONE, 473, -205 },
+        { -515, 985138943, -427109783 },
+        { 0, 427109783, 985138943 },
+    } };
+
     double jdTT = astro_convert_utc_to_tt(jd);
     double t = astro_convert_jd_to_julian_millenia_since_j2000(jdTT);
-    
+
     // Get current position of Earth and the target body
     astro_cartesian_coordinates_t earth_coords = astro_get_body_coordinates(ASTRO_BODY_EARTH, t);
     astro_cartesian_coordinates_t body_coords = astro_get_body_coordinates_light_time_adjusted(body, earth_coords, t);
@@ -84,40 +354,60 @@ astro_equatorial_coordinates_t astro_get_ra_dec(double jd, astro_body_t body, do
     // Convert to Geocentric coordinate
     body_coords = astro_subtract_cartesian(body_coords, earth_coords);
 
+    // Normalize into the fixed point pipeline: the distance is the last double
+    // computed; every rotation below works on the unit direction in Q2.30.
+    double distance = sqrt(body_coords.x * body_coords.x + body_coords.y * body_coords.y + body_coords.z * body_coords.z);
+    astro_fix_vector_t direction;
+    direction.x = _astro_fix_from_double(body_coords.x / distance);
+    direction.y = _astro_fix_from_double(body_coords.y / distance);
+    direction.z = _astro_fix_from_double(body_coords.z / distance);
+
     //Rotate ecliptic coordinates to J2000 coordinates
-    body_coords = astro_rotate_from_vsop_to_J2000(body_coords);
+    direction = _astro_fix_matrix_multiply(direction, vsop_to_j2000);
 
-    astro_matrix_t precession;
+    astro_fix_matrix_t precession;
     // TODO: rotate body for precession, nutation and bias
     if(calculate_precession) {
-        precession = astro_get_precession_matrix(jdTT);
-        body_coords = astro_matrix_multiply(body_coords, precession);
+        precession = _astro_fix_precession_matrix(jdTT);
+        direction = _astro_fix_matrix_multiply(direction, precession);
     }
 
-    //Convert to topocentric
-    astro_cartesian_coordinates_t observerXYZ = astro_get_observer_geocentric_coords(jdTT, lat, lon);
+    //Convert to topocentric: the observer's offset, in units of the body's
+    //distance, is their unit direction times the parallax scale.
+    astro_fix_vector_t observer = _astro_fix_observer_direction(jdTT, _astro_turns_from_radians(lat), _astro_turns_from_radians(lon));
+    astro_fix_t parallax = _astro_fix_from_double(4.263520978299404e-5 / distance); //equatorial radius in AU over distance
+    observer.x = _astro_fix_mul(parallax, observer.x);
+    observer.y = _astro_fix_mul(parallax, observer.y);
+    observer.z = _astro_fix_mul(parallax, observer.z);
 
     if(calculate_precession) {
-        //TODO: rotate observerXYZ for precession, nutation and bias
-        astro_matrix_t precessionInv = astro_transpose_matrix(precession);
-        observerXYZ = astro_matrix_multiply(observerXYZ, precessionInv);
+        //TODO: rotate observer for precession, nutation and bias
+        observer = _astro_fix_matrix_multiply(observer, _astro_fix_transpose_matrix(precession));
     }
 
-    body_coords = astro_subtract_cartesian(body_coords, observerXYZ);
+    direction.x -= observer.x;
+    direction.y -= observer.y;
+    direction.z -= observer.z;
+
+    //Convert to topocentric RA DEC by converting from cartesian coordinates to
+    //polar: RA around the pole, then declination out of the equatorial plane,
+    //with the CORDIC handing back the plane magnitudes as byproducts.
+    astro_fix_t equatorial_mag, mag;
+    int32_t right_ascension = _astro_fix_atan2(direction.y, direction.x, &equatorial_mag);
+    int32_t declination = _astro_fix_atan2(direction.z, equatorial_mag, &mag);
+
+    astro_equatorial_coordinates_t retval;
+    retval.right_ascension = (double)(uint32_t)right_ascension * ASTRO_RADIANS_PER_TURN_UNIT; //the unsigned read of the angle ensures RA is positive
+    retval.declination = (double)declination * ASTRO_RADIANS_PER_TURN_UNIT;
+    retval.distance = distance * ((double)mag / (double)ASTRO_FIX_ONE);
 
-    //Convert to topocentric RA DEC by converting from cartesian coordinates to polar coordinates
-    astro_equatorial_coordinates_t retval = astro_convert_cartesian_to_polar(body_coords);
-    
-    retval.declination = M_PI/2.0 - retval.declination;  //Dec.  Offset to make 0 the equator, and the poles +/-90 deg
-    if(retval.right_ascension < 0) retval.right_ascension += 2*M_PI; //Ensure RA is positive
-    
     return retval;
 }
 
 //Converts a Julian Date in UTC to Terrestrial Time (TT)
 double astro_convert_utc_to_tt(double jd) {
     //Leap seconds are hard coded, should be updated from the IERS website for other times
-    
+
     //TAI = UTC + leap seconds (e.g. 32)
     //TT=TAI + 32.184
 
@@ -171,21 +461,6 @@ astro_cartesian_coordinates_t astro_subtract_cartesian(astro_cartesian_coordinat
     return retval;
 }
 
-// Performs the rotation from ecliptic coordinates to J2000 coordinates for the given vector x
-astro_cartesian_coordinates_t astro_rotate_from_vsop_to_J2000(astro_cartesian_coordinates_t c) {
-    /* From VSOP87.doc
-        X        +1.000000000000  +0.000000440360  -0.000000190919   X
-        Y     =  -0.000000479966  +0.917482137087  -0.397776982902   Y
-        Z FK5     0.000000000000  +0.397776982902  +0.917482137087   Z VSOP87A
-    */
-    astro_cartesian_coordinates_t t;
-    t.x = c.x + c.y * 0.000000440360 + c.z * -0.000000190919;
-    t.y = c.x * -0.000000479966 + c.y * 0.917482137087 + c.z * -0.397776982902;
-    t.z = c.y * 0.397776982902 + c.z * 0.917482137087;
-
-    return t;
-}
-
 double astro_get_GMST(double ut1) {
     double D = ut1 - 2451545.0;
     double T = D/36525.0;
@@ -198,254 +473,67 @@ double astro_get_GMST(double ut1) {
     return gmst/15;
 }
 
-static astro_matrix_t _astro_get_empty_matrix() {
-    astro_matrix_t t;
-    for(uint8_t i = 0; i < 3 ; i++) {
-        for(uint8_t j = 0 ; j < 3 ; j++) {
-            t.elements[i][j] = 0;
-        }
-    }
-    return t;
-}
-
-//Gets a rotation matrix about the x axis.  Angle R is in radians
-astro_matrix_t astro_get_x_rotation_matrix(double r) {
-    astro_matrix_t t = _astro_get_empty_matrix();
-
-    t.elements[0][0]=1;
-    t.elements[0][1]=0;
-    t.elements[0][2]=0;
-    t.elements[1][0]=0;
-    t.elements[1][1]=cos(r);
-    t.elements[1][2]=sin(r);
-    t.elements[2][0]=0;
-    t.elements[2][1]=-sin(r);
-    t.elements[2][2]=cos(r);
-
-    return t;
-}
-
-//Gets a rotation matrix about the y axis.  Angle R is in radians
-astro_matrix_t astro_get_y_rotation_matrix(double r) {
-    astro_matrix_t t = _astro_get_empty_matrix();
-
-    t.elements[0][0]=cos(r);
-    t.elements[0][1]=0;
-    t.elements[0][2]=-sin(r);
-    t.elements[1][0]=0;
-    t.elements[1][1]=1;
-    t.elements[1][2]=0;
-    t.elements[2][0]=sin(r);
-    t.elements[2][1]=0;
-    t.elements[2][2]=cos(r);
-
-    return t;
-}
-
-//Gets a rotation matrix about the z axis.  Angle R is in radians
-astro_matrix_t astro_get_z_rotation_matrix(double r) {
-    astro_matrix_t t = _astro_get_empty_matrix();
-
-    t.elements[0][0]=cos(r);
-    t.elements[0][1]=sin(r);
-    t.elements[0][2]=0;
-    t.elements[1][0]=-sin(r);
-    t.elements[1][1]=cos(r);
-    t.elements[1][2]=0;
-    t.elements[2][0]=0;
-    t.elements[2][1]=0;
-    t.elements[2][2]=1;
-
-    return t;
-}
-
-void astro_print_matrix(char * title, astro_matrix_t matrix);
-void astro_print_matrix(char * title, astro_matrix_t matrix) {
-    printf("%s\n", title);
-    for(uint8_t i = 0; i < 3 ; i++) {
-        printf("\t");
-        for(uint8_t j = 0 ; j < 3 ; j++) {
-            printf("%12f", matrix.elements[i][j]);
-        }
-        printf("\n");
-    }
-    printf("\n");
-}
-
-astro_matrix_t astro_dot_product(astro_matrix_t a, astro_matrix_t b) {
-    astro_matrix_t retval;
-
-    for(uint8_t i = 0; i < 3 ; i++) {
-        for(uint8_t j = 0 ; j < 3 ; j++) {
-            double temp = 0;
-            for(uint8_t k = 0; k < 3 ; k++) {
-                temp += a.elements[i][k] * b.elements[k][j];
-            }
-            retval.elements[i][j]=temp;
-        }
-    }
-
-    return retval;
-}
-
-astro_matrix_t astro_transpose_matrix(astro_matrix_t m) {
-    astro_matrix_t retval;
-    for(uint8_t i = 0; i < 3 ; i++) {
-        for(uint8_t j = 0 ; j < 3 ; j++) {
-            retval.elements[i][j] = m.elements[j][i];
-        }
-    }
-    return retval;
-}
-
-astro_matrix_t astro_get_precession_matrix(double jd) {
-    //2006 IAU Precession.  Implemented from IERS Technical Note No 36 ch5.
-    //https://www.iers.org/SharedDocs/Publikationen/EN/IERS/Publications/tn/TechnNote36/tn36_043.pdf?__blob=publicationFile&v=1
-
-    double t = (jd - 2451545.0) / 36525.0;  //5.2
-    const double Arcsec2Radians = M_PI/180.0/60.0/60.0; //Converts arc seconds used in equations below to radians
-
-    double e0 = 84381.406 * Arcsec2Radians; //5.6.4
-    double omegaA = e0 + ((-0.025754 + (0.0512623 +	(-0.00772503 + (-0.000000467 + 0.0000003337*t) * t) * t) * t) * t) * Arcsec2Radians; //5.39
-    double psiA = ((5038.481507 +	(-1.0790069 + (-0.00114045 + (0.000132851 - 0.0000000951*t) * t) * t) * t) * t) * Arcsec2Radians; //5.39
-    double chiA = ((10.556403 + (-2.3814292 + (-0.00121197 + (0.000170663 - 0.0000000560*t) * t) * t) * t) * t) * Arcsec2Radians; //5.40
-    //Rotation matrix from 5.4.5
-    //(R1(−e0) · R3(psiA) · R1(omegaA) · R3(−chiA))
-    //Above eq rotates from "of date" to J2000, so we reverse the signs to go from J2000 to "of date"
-    astro_matrix_t m1 = astro_get_x_rotation_matrix(e0);
-    astro_matrix_t m2 = astro_get_z_rotation_matrix(-psiA);
-    astro_matrix_t m3 = astro_get_x_rotation_matrix(-omegaA);
-    astro_matrix_t m4 = astro_get_z_rotation_matrix(chiA);
-
-    astro_matrix_t m5 = astro_dot_product(m4, m3);
-    astro_matrix_t m6 = astro_dot_product(m5, m2);
-    astro_matrix_t precessionMatrix = astro_dot_product(m6, m1);
-
-    return precessionMatrix;
-}
-
-astro_cartesian_coordinates_t astro_matrix_multiply(astro_cartesian_coordinates_t v, astro_matrix_t m) {
-    astro_cartesian_coordinates_t t;
-
-    t.x = v.x*m.elements[0][0] + v.y*m.elements[0][1] + v.z*m.elements[0][2];
-    t.y = v.x*m.elements[1][0] + v.y*m.elements[1][1] + v.z*m.elements[1][2];
-    t.z = v.x*m.elements[2][0] + v.y*m.elements[2][1] + v.z*m.elements[2][2];
-
-    return t;
-}
-
-//Converts cartesian XYZ coordinates to polar (e.g. J2000 xyz to Right Accention and Declication)
-astro_equatorial_coordinates_t astro_convert_cartesian_to_polar(astro_cartesian_coordinates_t xyz) {
-    astro_equatorial_coordinates_t t;
-
-    t.distance = sqrt(xyz.x * xyz.x + xyz.y * xyz.y + xyz.z * xyz.z);
-    t.declination = acos(xyz.z / t.distance);
-    t.right_ascension = atan2(xyz.y, xyz.x);
-
-    if(t.declination < 0) t.declination += 2 * M_PI;
-
-    if(t.right_ascension < 0) t.right_ascension += 2 * M_PI;
-
-    return t;
-}
-
-//Convert Geodedic Lat Lon to geocentric XYZ position vector
-//All angles are input as radians
-astro_cartesian_coordinates_t astro_convert_geodedic_latlon_to_ITRF_XYZ(double lat, double lon, double height) {
-    //Algorithm from Explanatory Supplement to the Astronomical Almanac 3rd ed. P294
-    const double a = 6378136.6;
-    const double f = 1 / 298.25642;
-
-    const double C = sqrt(((cos(lat)*cos(lat)) + (1.0-f)*(1.0-f) * (sin(lat)*sin(lat))));
-
-    const double S = (1-f)*(1-f)*C;
-    
-    double h = height;
-
-    astro_cartesian_coordinates_t r;
-    r.x = (a*C+h) * cos(lat) * cos(lon);
-    r.y = (a*C+h) * cos(lat) * sin(lon);
-    r.z = (a*S+h) * sin(lat);
-    
-    return r;
-}
-
-//Convert position vector to celestial "of date" system.
-//g(t)=R3(-GAST) r
-//(Remember to use UT1 for GAST, not ET)
-//All angles are input and output as radians
-astro_cartesian_coordinates_t astro_convert_ITRF_to_GCRS(astro_cartesian_coordinates_t r, double ut1) {
-    //This is a simple rotation matrix implemenation about the Z axis, rotation angle is -GMST
-
-    double GMST = astro_get_GMST(ut1);
-    GMST =- GMST * 15.0 * M_PI / 180.0;
-
-    astro_matrix_t m = astro_get_z_rotation_matrix(GMST);
-    astro_cartesian_coordinates_t t = astro_matrix_multiply(r, m);
-
-    return t;
-}
-
-astro_cartesian_coordinates_t astro_convert_coordinates_from_meters_to_AU(astro_cartesian_coordinates_t c) {
-    astro_cartesian_coordinates_t t;
-    
-    t.x = c.x / 1.49597870691E+11;
-    t.y = c.y / 1.49597870691E+11;
-    t.z = c.z / 1.49597870691E+11;
-    
-    return t;
-}
-
-astro_cartesian_coordinates_t astro_get_observer_geocentric_coords(double jd, double lat, double lon) {
-    astro_cartesian_coordinates_t r = astro_convert_geodedic_latlon_to_ITRF_XYZ(lat, lon,0);
-    r = astro_convert_ITRF_to_GCRS(r, jd);
-    r = astro_convert_coordinates_from_meters_to_AU(r);
-    
-    return r;
-}
+// cached heliocentric coordinates, one entry per body. A single position fix
+// evaluates each body several times over -- once per precession pass and again
+// for every light time iteration, all within seconds of ephemeris time -- and
+// the VSOP87 series are by far the most expensive part of the fix, so serving
+// repeats from the cache makes all but the first evaluation free. Keyed on the
+// hour (minute for the swift-moving Moon); each entry holds the coordinates
+// for the exact time of the first request within its interval.
+#define ASTRO_HOURS_PER_MILLENNIUM 8766000.0
+static int32_t _body_cache_key[ASTRO_BODY_MOON + 1];
+static bool _body_cache_valid[ASTRO_BODY_MOON + 1];
+static astro_cartesian_coordinates_t _body_cache[ASTRO_BODY_MOON + 1];
 
 //Returns a body's cartesian coordinates centered on the Sun.
-//Requires vsop87a_milli_js, if you wish to use a different version of VSOP87, replace the class name vsop87a_milli below
+//Requires vsop87a_pruned, if you wish to use a different version of VSOP87, replace the class name vsop87a_pruned below
 astro_cartesian_coordinates_t astro_get_body_coordinates(astro_body_t body, double et) {
     astro_cartesian_coordinates_t retval = {0};
     double coords[3];
+    int32_t key;
+
+    if (body == ASTRO_BODY_SUN) return retval; //Sun is at the center for vsop87a
+
+    key = (int32_t)floor(et * (body == ASTRO_BODY_MOON ? ASTRO_HOURS_PER_MILLENNIUM * 60.0 : ASTRO_HOURS_PER_MILLENNIUM));
+    if (_body_cache_valid[body] && _body_cache_key[body] == key) return _body_cache[body];
+
     switch(body) {
-        case ASTRO_BODY_SUN: 
-            return retval; //Sun is at the center for vsop87a
+        case ASTRO_BODY_SUN:
+             break; //handled above; silences the switch warning
         case ASTRO_BODY_MERCURY:
-             vsop87a_milli_getMercury(et, coords);
+             vsop87a_pruned_getMercury(et, coords);
              break;
         case ASTRO_BODY_VENUS:
-             vsop87a_milli_getVenus(et, coords);
+             vsop87a_pruned_getVenus(et, coords);
              break;
         case ASTRO_BODY_EARTH:
-             vsop87a_milli_getEarth(et, coords);
+             vsop87a_pruned_getEarth(et, coords);
              break;
         case ASTRO_BODY_MARS:
-             vsop87a_milli_getMars(et, coords);
+             vsop87a_pruned_getMars(et, coords);
              break;
         case ASTRO_BODY_JUPITER:
-             vsop87a_milli_getJupiter(et, coords);
+             vsop87a_pruned_getJupiter(et, coords);
              break;
         case ASTRO_BODY_SATURN:
-             vsop87a_milli_getSaturn(et, coords);
+             vsop87a_pruned_getSaturn(et, coords);
              break;
         case ASTRO_BODY_URANUS:
-             vsop87a_milli_getUranus(et, coords);
+             vsop87a_pruned_getUranus(et, coords);
              break;
         case ASTRO_BODY_NEPTUNE:
-             vsop87a_milli_getNeptune(et, coords);
+             vsop87a_pruned_getNeptune(et, coords);
              break;
         case ASTRO_BODY_EMB:
-             vsop87a_milli_getEmb(et, coords);
+             vsop87a_pruned_getEmb(et, coords);
              break;
         case ASTRO_BODY_MOON:
             {
                 double earth_coords[3];
                 double emb_coords[3];
-                vsop87a_milli_getEarth(et, earth_coords);
-                vsop87a_milli_getEmb(et, emb_coords);
-                vsop87a_milli_getMoon(earth_coords, emb_coords, coords);
+                vsop87a_pruned_getEarth(et, earth_coords);
+                vsop87a_pruned_getEmb(et, emb_coords);
+                vsop87a_pruned_getMoon(earth_coords, emb_coords, coords);
             }
              break;
     }
@@ -454,6 +542,10 @@ astro_cartesian_coordinates_t astro_get_body_coordinates(astro_body_t body, doub
     retval.y = coords[1];
     retval.z = coords[2];
 
+    _body_cache_key[body] = key;
+    _body_cache[body] = retval;
+    _body_cache_valid[body] = true;
+
     return retval;
 }
 
@@ -471,7 +563,7 @@ astro_cartesian_coordinates_t astro_get_body_coordinates_light_time_adjusted(ast
         double lightTime = distance / 299792458.0;
 
         //Convert light time to Julian Millenia, and subtract it from the original value of t
-        newT -= lightTime / 24.0 / 60.0 / 60.0 / 365250.0;  
+        newT -= lightTime / 24.0 / 60.0 / 60.0 / 365250.0;
         //Recalculate body position adjusted for light time
         body_coords = astro_get_body_coordinates(body, newT);
     }
@@ -480,20 +572,30 @@ astro_cartesian_coordinates_t astro_get_body_coordinates_light_time_adjusted(ast
 }
 
 astro_horizontal_coordinates_t astro_ra_dec_to_alt_az(double jd, double lat, double lon, double ra, double dec) {
-    double GMST = astro_get_GMST(jd) * M_PI/180.0 * 15.0;
-    double h = GMST + lon - ra;
-
-    double sina = sin(dec)*sin(lat) + cos(dec)*cos(h)*cos(lat);
-    double a = asin(sina);
-
-    double cosAz = (sin(dec)*cos(lat) - cos(dec)*cos(h)*sin(lat)) / cos(a);
-    double Az = acos(cosAz);
-
-    if(sin(h) > 0) Az = 2.0*M_PI - Az;
+    uint32_t h = (uint32_t)(uint64_t)llround(astro_get_GMST(jd) * (4294967296.0 / 24.0)) + _astro_turns_from_radians(lon) - _astro_turns_from_radians(ra);
+
+    astro_fix_t sind = _astro_fix_sin(_astro_turns_from_radians(dec));
+    astro_fix_t cosd = _astro_fix_cos(_astro_turns_from_radians(dec));
+    astro_fix_t sinlat = _astro_fix_sin(_astro_turns_from_radians(lat));
+    astro_fix_t coslat = _astro_fix_cos(_astro_turns_from_radians(lat));
+    astro_fix_t cosdcosh = _astro_fix_mul(cosd, _astro_fix_cos(h));
+
+    //The old double version took asin/acos of the projections, which blows up
+    //fixed point rounding wherever those run out of slope (the zenith, due
+    //north, due south). Working from the full east and north components keeps
+    //the arctangents conditioned everywhere, and their plane magnitude is
+    //exactly the cos(altitude) the altitude needs.
+    astro_fix_t east = -_astro_fix_mul(cosd, _astro_fix_sin(h));
+    astro_fix_t north = _astro_fix_mul(sind, coslat) - _astro_fix_mul(cosdcosh, sinlat);
+    astro_fix_t sina = _astro_fix_mul(sind, sinlat) + _astro_fix_mul(cosdcosh, coslat);
+
+    astro_fix_t cosa;
+    int32_t Az = _astro_fix_atan2(east, north, &cosa); //azimuth from north, through east
+    int32_t a = _astro_fix_atan2(sina, cosa, NULL); //altitude
 
     astro_horizontal_coordinates_t retval;
-    retval.altitude = a;
-    retval.azimuth = Az;
+    retval.altitude = (double)a * ASTRO_RADIANS_PER_TURN_UNIT;
+    retval.azimuth = (double)(uint32_t)Az * ASTRO_RADIANS_PER_TURN_UNIT;
 
     return retval;
 }
@@ -508,48 +610,25 @@ double astro_radians_to_degrees(double radians) {
 
 astro_angle_dms_t astro_radians_to_dms(double radians) {
     astro_angle_dms_t retval;
-    int8_t sign = (radians < 0) ? -1 : 1;
-    double degrees = fabs(astro_radians_to_degrees(radians));
-
-    retval.degrees = (uint16_t)degrees;
-    double temp = 60.0 * (degrees - retval.degrees);
-    retval.minutes = (uint8_t)temp;
-    retval.seconds = (uint8_t)round(60.0 * (temp - retval.minutes));
-
-    if (retval.seconds > 59) {
-        retval.seconds = 0.0;
-        retval.minutes++;
-    }
+    //one multiply down to integer arcseconds; the splitting (and the rounding
+    //carries the old float version patched up after the fact) comes out of the
+    //integer divisions. Note that like the old version, this drops the sign.
+    int32_t arcseconds = (int32_t)llround(fabs(radians) * 206264.80624709636); //arcseconds per radian
 
-    if (retval.minutes > 59) {
-        retval.minutes = 0;
-        retval.degrees++;
-    }
-
-    degrees *= sign;
+    retval.degrees = arcseconds / 3600;
+    retval.minutes = (arcseconds / 60) % 60;
+    retval.seconds = arcseconds % 60;
 
     return retval;
 }
 
 astro_angle_hms_t astro_radians_to_hms(double radians) {
     astro_angle_hms_t retval;
-    double degrees = astro_radians_to_degrees(radians);
-    double temp = degrees / 15.0;
-
-    retval.hours = (uint8_t)temp;
-    temp = 60.0 * (temp - retval.hours);
-    retval.minutes = (uint8_t)temp;
-    retval.seconds = (uint8_t)round(60.0 * (temp - retval.minutes));
+    int32_t seconds = (int32_t)llround(radians * 13750.987083139758); //seconds of time per radian
 
-    if (retval.seconds > 59) {
-        retval.seconds = 0;
-        retval.minutes++;
-    }
-
-    if (retval.minutes > 59) {
-        retval.minutes = 0;
-        retval.hours++;
-    }
+    retval.hours = seconds / 3600;
+    retval.minutes = (seconds / 60) % 60;
+    retval.seconds = seconds % 60;
 
     return retval;
 }
@@ -33,10 +33,6 @@ typedef enum {
     ASTRO_BODY_MOON
 } astro_body_t;
 
-typedef struct {
-    double elements[3][3];
-} astro_matrix_t;
-
 typedef struct {
     double x;
     double y;
@@ -72,6 +68,12 @@ double astro_convert_date_to_julian_date(uint16_t year, uint8_t month, uint8_t d
 // Converts a Julan Date to Julian Millenia since J2000, which is what VSOP87 expects as input.
 double astro_convert_jd_to_julian_millenia_since_j2000(double jd);
 
+// Get a body's heliocentric cartesian coordinates in AU (geocentric for the Moon).
+// Results are served through a small static cache keyed on the body and the hour
+// of ephemeris time, shared by every caller, so repeat requests for the same body
+// within the hour cost nothing.
+astro_cartesian_coordinates_t astro_get_body_coordinates(astro_body_t body, double et);
+
 // Get right ascension / declination for a given body in the list above.
 astro_equatorial_coordinates_t astro_get_ra_dec(double jd, astro_body_t bodyNum, double lat, double lon, bool calculate_precession);
 
@@ -84,4 +86,15 @@ double astro_radians_to_degrees(double radians);
 astro_angle_dms_t astro_radians_to_dms(double radians);
 astro_angle_hms_t astro_radians_to_hms(double radians);
 
+// Greenwich Mean Sidereal Time in decimal hours for a given (UT1) Julian date.
+double astro_get_GMST(double ut1);
+
+// The conversion pipeline's fixed-point trig core, public for faces doing their
+// own spherical math: sine and cosine of a 32-bit binary angle (2^32 = one full
+// turn) as Q2.30 values, and the inverse cosine of a Q2.30 value (clamped to
+// [-1, 1]) as a binary angle in [0, half a turn].
+int32_t astro_sin_turns(uint32_t angle);
+int32_t astro_cos_turns(uint32_t angle);
+uint32_t astro_acos_turns(int32_t x);
+
 #endif // ASTROLIB_H_
@@ -24,6 +24,7 @@
 
 #include <assert.h>  // assert()
 #include <limits.h>  // CHAR_BIT
+#include <stdint.h>  // uint32_t
 
 #include "base32.h"
 
@@ -71,23 +72,29 @@ static unsigned char encode_char(unsigned char c)
 }
 
 /**
- * Decode given character into a 5 bits value. 
- * Returns -1 iff the argument given was an invalid base32 character
- * or a padding character.
+ * Maps every base32 character to its 5 bits value and everything else,
+ * including the padding character and the terminating NUL, to 0xFF.
+ * A straight table lookup replaces the range checks of the old
+ * decode_char() in the inner decoding loop.
  */
-static int decode_char(unsigned char c)
-{
-	int retval = -1;
-
-	if (c >= 'A' && c <= 'Z')
-		retval = c - 'A';
-	if (c >= '2' && c <= '7')
-		retval = c - '2' + 26;
-
-	assert(retval == -1 || ((retval & 0x1F) == retval));
-
-	return  retval;
-}
+static const unsigned char decode_table[256] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+	0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
 
 /**
  * Given a block id between 0 and 7 inclusive, this will return the index of
@@ -141,11 +148,6 @@ static unsigned char shift_right(unsigned char byte, int offset)
 		return byte << -offset;
 }
 
-static unsigned char shift_left(unsigned char byte, int offset)
-{
-	return shift_right(byte, - offset);
-}
-
 /**
  * Encode a sequence. A sequence is no longer than 5 octets by definition.
  * Thus passing a length greater than 5 to this function is an error. Encoding
@@ -186,36 +188,54 @@ void base32_encode(const unsigned char *plain, size_t len, unsigned char *coded)
 	}
 }
 
-static int decode_sequence(const unsigned char *coded, unsigned char *plain)
+size_t base32_decode(const unsigned char *coded, unsigned char *plain)
 {
 	assert(CHAR_BIT == 8);
 	assert(coded && plain);
 
-	plain[0] = 0;
-	for (int block = 0; block < 8; block++) {
-		int offset = get_offset(block);
-		int octet = get_octet(block);
-
-		int c = decode_char(coded[block]);
-		if (c < 0)  // invalid char, stop here
-			return octet;
-
-		plain[octet] |= shift_left(c, offset);
-		if (offset < 0) {  // does this block overflows to next octet?
-			assert(octet < 4);
-			plain[octet+1] = shift_left(c, 8 + offset);
+	size_t written = 0;
+	for (;;) {
+		// Gather a sequence of 8 characters through the decode table. The common
+		// case is 8 valid characters with no padding, which runs straight through
+		// with no per-bit bookkeeping; the first invalid character (padding, NUL,
+		// anything else) ends the input.
+		unsigned char v[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+		int n;
+		for (n = 0; n < 8; n++) {
+			v[n] = decode_table[coded[n]];
+			if (v[n] == 0xFF) {
+				v[n] = 0;
+				break;
+			}
 		}
+
+		// Pack the eight 5 bits values into two 20 bits halves, then peel off the
+		// 5 octets. n characters carry floor(n * 5 / 8) whole octets; any trailing
+		// partial octet is dropped, as before.
+		uint32_t hi = ((uint32_t)v[0] << 15) | ((uint32_t)v[1] << 10) | ((uint32_t)v[2] << 5) | v[3];
+		uint32_t lo = ((uint32_t)v[4] << 15) | ((uint32_t)v[5] << 10) | ((uint32_t)v[6] << 5) | v[7];
+		unsigned char octets[5] = {
+			(unsigned char)(hi >> 12),
+			(unsigned char)(hi >> 4),
+			(unsigned char)((hi << 4) | (lo >> 16)),
+			(unsigned char)(lo >> 8),
+			(unsigned char)lo,
+		};
+		int count = (n * 5) / 8;
+		for (int i = 0; i < count; i++)
+			plain[i] = octets[i];
+		written += count;
+
+		if (n < 8)
+			return written;
+		coded += 8;
+		plain += 5;
 	}
-	return 5;
 }
 
-size_t base32_decode(const unsigned char *coded, unsigned char *plain)
+size_t base32_decode_inplace(unsigned char *buf)
 {
-	size_t written = 0;
-	for (size_t i = 0, j = 0; ; i += 8, j += 5) {
-		int n = decode_sequence(&coded[i], &plain[j]);
-		written += n;
-		if (n < 5)
-			return written;
-	}
+	// Each 8 characters collapse into 5 octets, so the write cursor never
+	// catches up with the read cursor and the buffer can decode onto itself.
+	return base32_decode(buf, buf);
 }
@@ -63,4 +63,14 @@ void base32_encode(const unsigned char *plain, size_t len, unsigned char *coded)
  **/
 size_t base32_decode(const unsigned char *coded, unsigned char *plain);
 
+/**
+ * Decode the null terminated string pointed to by buf, writing the
+ * decoded data back over the string itself. Every 8 input characters
+ * shrink to 5 output bytes, so the decoded data always fits in the
+ * buffer it came from and no second buffer is needed.
+ * Returns the length of the decoded data, with the same padding and
+ * invalid character semantics as base32_decode.
+ **/
+size_t base32_decode_inplace(unsigned char *buf);
+
 #endif
@@ -0,0 +1,111 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Niclas Hoyer
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "fixed_rpn.h"
+
+// scaled weight of each display position, leftmost first: thousands down to hundredths.
+static const int32_t digit_weight[6] = {100000, 10000, 1000, 100, 10, 1};
+
+void fixed_rpn_init(fixed_rpn_stack_t *stack, int64_t *storage, uint8_t capacity) {
+    stack->values = storage;
+    stack->capacity = capacity;
+    stack->top = -1;
+}
+
+void fixed_rpn_push(fixed_rpn_stack_t *stack, int64_t value) {
+    if (stack->top + 1 >= (int8_t)stack->capacity) {
+        // full: shift everything down one slot, losing the deepest entry.
+        for (uint8_t i = 0; i < stack->capacity - 1; i++) {
+            stack->values[i] = stack->values[i + 1];
+        }
+        stack->top = stack->capacity - 2;
+    }
+    stack->values[++stack->top] = value;
+}
+
+int64_t fixed_rpn_peek(fixed_rpn_stack_t *stack) {
+    if (stack->top < 0) return 0;
+    return stack->values[stack->top];
+}
+
+int64_t fixed_rpn_pop(fixed_rpn_stack_t *stack) {
+    if (stack->top < 0) return 0;
+    return stack->values[stack->top--];
+}
+
+int64_t fixed_rpn_mul(int64_t a, int64_t b) {
+    return (a * b) / FIXED_RPN_SCALE;
+}
+
+int64_t fixed_rpn_div(int64_t a, int64_t b) {
+    return (a * FIXED_RPN_SCALE) / b;
+}
+
+int64_t fixed_rpn_sqrt(int64_t a) {
+    if (a <= 0) return 0;
+    // sqrt(a / SCALE) scaled back up by SCALE is an integer square root of a * SCALE.
+    uint64_t n = (uint64_t)a * FIXED_RPN_SCALE;
+    uint64_t x = n;
+    uint64_t next = (x + 1) / 2;
+    // Newton's method on integers; converges in well under 64 iterations.
+    while (next < x) {
+        x = next;
+        next = (x + n / x) / 2;
+    }
+    return (int64_t)x;
+}
+
+bool fixed_rpn_pow(int64_t base, int64_t exponent, int64_t *result) {
+    if (exponent % FIXED_RPN_SCALE != 0) return false;
+    int32_t n = exponent / FIXED_RPN_SCALE;
+    bool reciprocal = n < 0;
+    if (reciprocal) {
+        if (base == 0) return false;
+        n = -n;
+    }
+    int64_t acc = FIXED_RPN_SCALE; // 1.0
+    while (n--) acc = fixed_rpn_mul(acc, base);
+    if (reciprocal) {
+        if (acc == 0) return false;
+        acc = fixed_rpn_div(FIXED_RPN_SCALE, acc);
+    }
+    *result = acc;
+    return true;
+}
+
+uint8_t fixed_rpn_digit(int64_t value, uint8_t position) {
+    if (value < 0) value = -value;
+    return (value / digit_weight[position]) % 10;
+}
+
+void fixed_rpn_increment_digit(int64_t *value, uint8_t position) {
+    if (position > 5) return;
+    // bump the digit in place; 9 wraps back around to 0. No string round trip:
+    // the old float path formatted the number with sprintf and re-parsed it with strtof.
+    if (fixed_rpn_digit(*value, position) == 9) {
+        *value -= 9 * (int64_t)digit_weight[position];
+    } else {
+        *value += digit_weight[position];
+    }
+}
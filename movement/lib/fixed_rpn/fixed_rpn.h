@@ -0,0 +1,68 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Niclas Hoyer
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef FIXED_RPN_H_INCLUDED
+#define FIXED_RPN_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Decimal fixed-point RPN stack engine for the calculator faces.
+//
+// Values are int64 counts of hundredths, which maps one-to-one onto the six-digit
+// DDDD.FF layout the watch can actually display. Everything here is integer
+// arithmetic: the Cortex-M0+ has no FPU, so the float path this replaces dragged
+// in softfloat (and, for digit entry, a sprintf/strtof round trip) on every
+// button press.
+
+#define FIXED_RPN_SCALE 100
+
+// pi in hundredths; two decimal places is all the display can show anyway.
+#define FIXED_RPN_PI 314
+
+typedef struct {
+    int64_t *values;  // caller-owned storage
+    uint8_t capacity; // number of slots in values
+    int8_t top;       // index of the top entry; -1 when empty
+} fixed_rpn_stack_t;
+
+void fixed_rpn_init(fixed_rpn_stack_t *stack, int64_t *storage, uint8_t capacity);
+// pushing onto a full stack drops the deepest entry, like a desk calculator's register stack.
+void fixed_rpn_push(fixed_rpn_stack_t *stack, int64_t value);
+int64_t fixed_rpn_peek(fixed_rpn_stack_t *stack); // 0 when empty
+int64_t fixed_rpn_pop(fixed_rpn_stack_t *stack);  // 0 when empty
+
+// arithmetic on scaled values. add and subtract are plain + and -.
+int64_t fixed_rpn_mul(int64_t a, int64_t b);
+int64_t fixed_rpn_div(int64_t a, int64_t b);  // b must be nonzero; callers check first
+int64_t fixed_rpn_sqrt(int64_t a);            // integer Newton iteration; a < 0 yields 0
+// only whole-number exponents are representable; returns false for anything else.
+bool fixed_rpn_pow(int64_t base, int64_t exponent, int64_t *result);
+
+// digit access for the six-position DDDDFF display; position 0 is the leftmost
+// (thousands) digit, position 5 the hundredths digit. The sign is ignored.
+uint8_t fixed_rpn_digit(int64_t value, uint8_t position);
+void fixed_rpn_increment_digit(int64_t *value, uint8_t position); // wraps 9 back to 0
+
+#endif
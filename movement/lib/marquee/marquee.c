@@ -0,0 +1,70 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "marquee.h"
+#include "watch.h"
+#include "watch_private_display.h"
+
+void marquee_set_text(marquee_t *marquee, const char *text, uint8_t first_position, uint8_t window) {
+    if (window > MARQUEE_MAX_WINDOW) window = MARQUEE_MAX_WINDOW;
+    if (window == 0) window = 1;
+    if (first_position + window > Num_Chars) first_position = Num_Chars - window;
+
+    uint8_t length = 0;
+    while (text[length] != 0 && length < MARQUEE_MAX_TEXT) length++;
+
+    marquee->first_position = first_position;
+    marquee->window = window;
+    marquee->step = 0;
+    marquee->steps = (length > window) ? length - window + 1 : 1;
+
+    // pad short texts with spaces so a frame is always a full window of columns.
+    uint8_t columns = (length > window) ? length : window;
+    for (uint8_t i = 0; i < columns; i++) {
+        uint8_t character = (i < length) ? (uint8_t)text[i] : ' ';
+        for (uint8_t j = 0; j < window; j++) {
+            marquee->columns[i][j] = watch_character_segdata(character, first_position + j);
+        }
+    }
+}
+
+bool marquee_is_scrolling(marquee_t *marquee) {
+    return marquee->steps > 1;
+}
+
+void marquee_draw(marquee_t *marquee) {
+    for (uint8_t j = 0; j < marquee->window; j++) {
+        watch_display_segdata(marquee->columns[marquee->step + j][j], marquee->first_position + j);
+    }
+}
+
+void marquee_advance(marquee_t *marquee) {
+    if (marquee->steps > 1) {
+        marquee->step++;
+        if (marquee->step >= marquee->steps) marquee->step = 0;
+    }
+    marquee_draw(marquee);
+}
@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MARQUEE_H_
+#define MARQUEE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Scrolling text for labels longer than the display window. The cost model is
+// front-loaded: marquee_set_text resolves every character of the text at every window
+// position it will ever occupy — the per-position remap and segment table walks that
+// watch_display_character performs on each call — into a matrix of precomputed
+// patterns. Advancing the scroll then just replays one column per position through
+// watch_display_segdata, with the display shadow filtering the writes down to the
+// pixels that actually change between adjacent frames. That makes a 2 Hz scroll tick
+// cost about as much as a seconds update, instead of a full string render.
+//
+// Typical face usage: marquee_set_text on activate (or when the record changes),
+// movement_request_tick_frequency(2), and marquee_advance from EVENT_TICK. Texts
+// that fit the window are drawn once and never scroll; check marquee_is_scrolling
+// to drop back to 1 Hz.
+
+#define MARQUEE_MAX_TEXT 32   // characters kept of the text (longer input is truncated)
+#define MARQUEE_MAX_WINDOW 6  // the main line; the two upper lines are too short to scroll
+
+typedef struct {
+    uint8_t first_position;  // leftmost display position of the window
+    uint8_t window;          // number of positions the text scrolls through
+    uint8_t steps;           // scroll steps before the scroll wraps (1 if the text fits)
+    uint8_t step;            // current scroll step
+    // columns[i][j]: character i of the (space-padded) text resolved at window slot j.
+    uint16_t columns[MARQUEE_MAX_TEXT][MARQUEE_MAX_WINDOW];
+} marquee_t;
+
+// Precomputes the pattern matrix for a text in the given window and resets the scroll
+// to step 0; call marquee_draw (or wait for the next advance) to put it on the glass.
+// window is clamped to MARQUEE_MAX_WINDOW, the text to MARQUEE_MAX_TEXT characters.
+void marquee_set_text(marquee_t *marquee, const char *text, uint8_t first_position, uint8_t window);
+
+// True if the text is longer than the window, i.e. ticking is worth the wakes.
+bool marquee_is_scrolling(marquee_t *marquee);
+
+// Draws the frame at the current scroll step without advancing.
+void marquee_draw(marquee_t *marquee);
+
+// Advances one scroll step (wrapping at the end) and draws the new frame.
+void marquee_advance(marquee_t *marquee);
+
+#endif // MARQUEE_H_
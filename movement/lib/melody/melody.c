@@ -0,0 +1,177 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "melody.h"
+#include "filesystem.h"
+
+// 64 Hz ticks per nibble duration unit: a sixteenth of a second.
+#define MELODY_DURATION_UNIT 4
+
+// only one melody can own the buzzer sequencer at a time.
+static melody_player_t *_active_player;
+static void (*_user_callback)(void);
+
+// the sequencer interrupt's pull callback: pops one decoded event from the ring.
+static bool _melody_next_note(BuzzerNote *note, uint8_t *duration) {
+    melody_player_t *player = _active_player;
+    if (!player) return false;
+    if (player->head == player->tail) {
+        if (player->done) return false;
+        // the refill task fell behind; hold a short rest instead of cutting the melody.
+        *note = BUZZER_NOTE_REST;
+        *duration = MELODY_DURATION_UNIT;
+        return true;
+    }
+    *note = player->events[player->head].note;
+    *duration = player->events[player->head].ticks;
+    player->head = (player->head + 1) % MELODY_PLAYER_BUFFER;
+    return true;
+}
+
+static void _melody_playback_ended(void) {
+    if (_active_player) _active_player->playing = false;
+    _active_player = NULL;
+    if (_user_callback) _user_callback();
+}
+
+void melody_player_task(melody_player_t *player) {
+    if (!player->playing || player->done) return;
+
+    uint8_t raw[16];
+    for (;;) {
+        int32_t remaining = player->size - player->offset;
+        if (remaining <= 0) {
+            player->done = true;
+            return;
+        }
+        int32_t chunk = remaining < (int32_t)sizeof(raw) ? remaining : (int32_t)sizeof(raw);
+        if (!filesystem_read_file_range(player->filename, (char *)raw, player->offset, chunk)) {
+            player->done = true;
+            return;
+        }
+
+        int32_t pos = 0;
+        bool ring_full = false;
+        while (pos < chunk) {
+            uint8_t used = (uint8_t)(player->tail - player->head) % MELODY_PLAYER_BUFFER;
+            if (used == MELODY_PLAYER_BUFFER - 1) {
+                ring_full = true;
+                break;
+            }
+
+            uint8_t event = raw[pos];
+            int8_t delta = (int8_t)(event & 0xF0) >> 4;
+            uint8_t ticks = event & 0x0F;
+
+            if (delta == -8 && ticks == 0) {
+                // re-anchor: the next byte is an absolute pitch; consumes no time.
+                if (pos + 1 >= chunk) break; // escape byte is in the next chunk; reread
+                player->note = raw[pos + 1] > BUZZER_NOTE_B8 ? BUZZER_NOTE_B8 : raw[pos + 1];
+                pos += 2;
+                continue;
+            }
+
+            int32_t consumed = 1;
+            if (ticks == 0) {
+                // escaped duration: the next byte is a tick count.
+                if (pos + 1 >= chunk) break;
+                ticks = raw[pos + 1];
+                consumed = 2;
+            } else {
+                ticks *= MELODY_DURATION_UNIT;
+            }
+
+            uint8_t note;
+            if (delta == -8) {
+                note = BUZZER_NOTE_REST;
+            } else {
+                int16_t next = (int16_t)player->note + delta;
+                if (next < 0) next = 0;
+                if (next > BUZZER_NOTE_B8) next = BUZZER_NOTE_B8;
+                player->note = (uint8_t)next;
+                note = (uint8_t)next;
+            }
+            player->events[player->tail].note = note;
+            player->events[player->tail].ticks = ticks;
+            player->tail = (player->tail + 1) % MELODY_PLAYER_BUFFER;
+            pos += consumed;
+        }
+
+        player->offset += pos;
+        if (pos == chunk) {
+            if (chunk == remaining) {
+                player->done = true;
+                return;
+            }
+            continue; // decoded the whole chunk and the ring has room: read the next one
+        }
+        if (ring_full) return; // come back when the sequencer has drained some events
+        // an escape byte straddles the chunk boundary: reread from the event byte —
+        // unless we already read to end of file and the escape byte just isn't there.
+        if (chunk == remaining) {
+            player->done = true;
+            return;
+        }
+    }
+}
+
+bool melody_player_play(melody_player_t *player, char *filename, void (*callback_on_end)(void)) {
+    uint8_t header[4];
+    int32_t size = filesystem_get_file_size(filename);
+    if (size < 5) return false;
+    if (!filesystem_read_file_range(filename, (char *)header, 0, 4)) return false;
+    if (header[0] != 'M' || header[1] != 'L' || header[2] != 1) return false;
+    if (header[3] > BUZZER_NOTE_B8) return false;
+
+    if (_active_player) melody_player_stop(_active_player);
+
+    player->filename = filename;
+    player->size = size;
+    player->offset = 4;
+    player->note = header[3];
+    player->head = 0;
+    player->tail = 0;
+    player->done = false;
+    player->playing = true;
+    _active_player = player;
+    _user_callback = callback_on_end;
+
+    // fill the lookahead ring before the first tick, then let the sequencer pull.
+    melody_player_task(player);
+    watch_buzzer_play_stream(_melody_next_note, _melody_playback_ended);
+    return true;
+}
+
+bool melody_player_is_playing(melody_player_t *player) {
+    return player->playing;
+}
+
+void melody_player_stop(melody_player_t *player) {
+    if (!player->playing) return;
+    player->playing = false;
+    if (_active_player == player) {
+        _active_player = NULL;
+        watch_buzzer_abort_sequence();
+    }
+}
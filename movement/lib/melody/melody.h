@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MELODY_H_
+#define MELODY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "watch.h"
+
+// User melodies from the filesystem, streamed to the buzzer in constant RAM.
+//
+// The compiled-in tunes are int8 (note, duration) pairs in face sources: two bytes a
+// note, and changing one means a reflash. The "ML" file format stores a melody at about
+// one byte per note, uploads over fsload, and never needs a parse step at trigger time:
+//
+//   - a four byte header: 'M', 'L', version (1), and the starting pitch as a BuzzerNote;
+//   - then one event per byte. The high nibble is a two's-complement pitch delta, -7..+7
+//     semitones from the previous pitch (melodies move stepwise, so deltas almost always
+//     fit); the low nibble is the duration in sixteenths of a second, 1-15. A duration
+//     nibble of 0 means the next byte carries the duration as a count of 64 Hz ticks
+//     (1-255), so a long held note costs one extra byte instead of a chain of events.
+//   - a delta nibble of -8 is an escape: with a nonzero duration nibble it is a rest
+//     (pitch held for the next delta); with a zero duration nibble the next byte is an
+//     absolute BuzzerNote that re-anchors the pitch without consuming any time, which is
+//     how intervals wider than a fifth are written.
+//
+// utils/melody_encode.py turns a text note list into this format. Playback decodes the
+// file in small chunks into a 16-event lookahead ring: the buzzer sequencer's interrupt
+// pops one event at a time (always at least one note ahead), and melody_player_task
+// tops the ring up from the filesystem in mainline context. RAM use is the
+// melody_player_t, whatever the melody's length.
+
+#define MELODY_PLAYER_BUFFER 16
+
+typedef struct {
+    char *filename;
+    int32_t offset;  // next unread byte of the file
+    int32_t size;
+    uint8_t note;    // the pitch the next delta is relative to
+    bool playing;
+    bool done;       // file fully decoded; playback ends when the ring drains
+    // lookahead ring: the task writes at tail, the sequencer interrupt reads at head.
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    struct {
+        uint8_t note;
+        uint8_t ticks;
+    } events[MELODY_PLAYER_BUFFER];
+} melody_player_t;
+
+// Starts playing an ML file. Validates the header, fills the lookahead ring and hands
+// the buzzer sequencer its pull callback; returns false if the file is missing or isn't
+// an ML file (in which case the caller might fall back to a compiled-in tune). Like
+// watch_buzzer_play_sequence this enables the buzzer itself; callback_on_end (which may
+// be NULL) runs in interrupt context when the melody finishes.
+bool melody_player_play(melody_player_t *player, char *filename, void (*callback_on_end)(void));
+
+// Tops the lookahead ring back up from the file; call it on every tick while the melody
+// plays. The full ring covers at least a second of playback at the shortest nibble
+// durations, so 1 Hz is enough — and if the task ever does fall behind, the sequencer
+// holds a short rest rather than cutting the melody off.
+void melody_player_task(melody_player_t *player);
+
+// True from melody_player_play until the melody ends or is stopped.
+bool melody_player_is_playing(melody_player_t *player);
+
+// Stops playback immediately.
+void melody_player_stop(melody_player_t *player);
+
+#endif // MELODY_H_
@@ -40,18 +40,52 @@ int calc_init(calc_state_t *cs) {
     return 0;
 }
 
-/* calc_input_function
- * Try to execut the token as a calculator function
- * TODO: Maybe replace this loop with binary search for token in a sorted calc_dict
+/* Flattened, sorted view of calc_dict[], built once on first use.
+ * Each entry is one name (aliases get their own entry), so looking up a token
+ * is a binary search here instead of strcmp against every alias in the dict.
  */
-int calc_input_function(calc_state_t *cs, char *token) {
-    for(uint8_t idx=0; idx<sizeof(calc_dict)/sizeof(calc_dict[0]); idx++) {
-        for(uint8_t idxn=0; idxn<sizeof(calc_dict[idx].names)/sizeof(calc_dict[idx].names[0]); idxn++) {
-            if(0 == strcmp(calc_dict[idx].names[idxn], token)) { // Found a match
-                return (*calc_dict[idx].fn)(cs); // Run calculator function
+typedef struct {
+    const char *name;
+    calc_fn_t fn;
+} calc_dict_idx_entry_t;
+
+#define CALC_DICT_LEN (sizeof(calc_dict)/sizeof(calc_dict[0]))
+#define CALC_DICT_NAMES (sizeof(calc_dict[0].names)/sizeof(calc_dict[0].names[0]))
+
+static calc_dict_idx_entry_t calc_dict_idx[CALC_DICT_LEN*CALC_DICT_NAMES];
+static uint8_t calc_dict_idx_len = 0;
+
+static void calc_build_dict_idx(void) {
+    for(uint8_t idx=0; idx<CALC_DICT_LEN; idx++) {
+        for(uint8_t idxn=0; idxn<CALC_DICT_NAMES; idxn++) {
+            const char *name = calc_dict[idx].names[idxn];
+            if(NULL == name) continue; // Unused alias slot
+            // Insertion sort; this runs once and the dict is small
+            uint8_t j = calc_dict_idx_len++;
+            while(j > 0 && strcmp(calc_dict_idx[j-1].name, name) > 0) {
+                calc_dict_idx[j] = calc_dict_idx[j-1];
+                j--;
             }
+            calc_dict_idx[j].name = name;
+            calc_dict_idx[j].fn = calc_dict[idx].fn;
         }
     }
+}
+
+/* calc_input_function
+ * Try to execute the token as a calculator function
+ * (binary search for token in the sorted index over calc_dict)
+ */
+int calc_input_function(calc_state_t *cs, char *token) {
+    if(0 == calc_dict_idx_len) calc_build_dict_idx();
+    uint8_t lo = 0, hi = calc_dict_idx_len;
+    while(lo < hi) {
+        uint8_t mid = (lo + hi)/2;
+        int cmp = strcmp(calc_dict_idx[mid].name, token);
+        if(0 == cmp) return (*calc_dict_idx[mid].fn)(cs); // Run calculator function
+        if(cmp < 0) lo = mid + 1;
+        else hi = mid;
+    }
     return -1; // Unrecognized function name
 }
 
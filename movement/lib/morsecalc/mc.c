@@ -32,35 +32,33 @@
 void mc_reset(mc_state_t * mc) {
     memset(mc->b, '\0', BUFFLEN*sizeof(mc->b[0]));
     mc->bidx = 0;
+    mc->pos = 1; // Root of the MC_DEC_KEY binary tree
     return;
-   return;
 }
 
-/* mc_input Read an input into a morse code buffer 
+/* mc_input Read an input into a morse code buffer
  * Input: mc = buffer to read into
  *        c = character to read into buffer ('.' or '-', ignored otherwise).
  * If the buffer is full, reset it instead of entering the new character.
+ * The tree position is maintained incrementally, one child step per symbol,
+ * so decoding never has to re-walk the buffer.
  */
 void mc_input(mc_state_t * mc, char c) {
     if(mc->bidx >= BUFFLEN) mc_reset(mc);
     else if( ('.' == c) || ('-' == c) ) {
         mc->b[mc->bidx] = c;
         mc->bidx++;
+        mc->pos = 2*mc->pos + ('-' == c); // Descend ('.'=left; '-'=right)
     }
     return;
 }
 
-/* mc_dec Decode a Morse code character (descend MC_DEC_KEY[])
- * Input: b = BUFFLEN-length char array with '.'s and '-'s
- * Output: c = Character b represents, or '\0' if not a Morse code. 
+/* mc_dec Decode a Morse code character
+ * Input: mc = morse code buffer
+ * Output: c = Character the buffer represents, or '\0' if not a Morse code.
+ * The descent already happened in mc_input; this is a single table load.
  */
-char mc_dec(char b[BUFFLEN]) {
-    uint8_t pos = 1; // Binary tree position ('.'=0; '-'=1)
-    for(uint8_t idx=0; idx<BUFFLEN; idx++) {
-        if('.' == b[idx]) pos = 2*pos; // Descend in . direction
-        else if('-' == b[idx]) pos = 2*pos+1; // Descend in - direction
-        else break; // End of morse code segment; finished descending
-    }
-    return MC_DEC_KEY[pos-1];
+char mc_dec(const mc_state_t * mc) {
+    return MC_DEC_KEY[mc->pos-1];
 }
 
@@ -31,6 +31,7 @@
 typedef struct {
     char b[BUFFLEN];
     uint8_t bidx;
+    uint8_t pos; // heap index into MC_DEC_KEY for the buffer contents; 1 = root (empty)
 } mc_state_t;
 
 // MC_DEC_KEY represents a binary tree of International Morse Code. 
@@ -47,5 +48,5 @@ static const char MC_DEC_KEY[] = " etianmsurwdkgohvf\0l\0pjbxcyzq\0C\x35\x34V\x3
     
 void mc_reset(mc_state_t * mcb);
 void mc_input(mc_state_t * mc, char c);
-char mc_dec(char b[BUFFLEN]);
+char mc_dec(const mc_state_t * mc);
 
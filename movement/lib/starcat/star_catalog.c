@@ -0,0 +1,231 @@
+// Bright-star catalog, generated by utils/gen_star_catalog.py -- do not edit.
+// 110 stars, J2000 coordinates as 16-bit binary turns, sorted by right ascension.
+#include "star_catalog.h"
+
+const star_catalog_entry_t star_catalog[] = {
+    {   382,   5296,  206 }, // ALPHER mag 2.06
+    {   418,  10768,  227 }, // CAPH   mag 2.27
+    {  1196,  -7702,  239 }, // ANKAA  mag 2.39
+    {  1843,  10292,  224 }, // SCHEDA mag 2.24
+    {  1982,  -3274,  204 }, // DIPHDA mag 2.04
+    {  2580,  11053,  247 }, // GAMCAS mag 2.47
+    {  3173,   6484,  205 }, // MIRACH mag 2.05
+    {  3905,  10965,  266 }, // RUCHBA mag 2.66
+    {  4448, -10420,   46 }, // ACHERN mag 0.46
+    {  5218,   3788,  264 }, // SHERAT mag 2.64
+    {  5639,   7706,  226 }, // ALMACH mag 2.26
+    {  5789,   4271,  200 }, // HAMAL  mag 2.00
+    {  6909,  16250,  198 }, // POLARI mag 1.98
+    {  8296,    745,  253 }, // MENKAR mag 2.53
+    {  8563,   7456,  212 }, // ALGOL  mag 2.12
+    {  9298,   9077,  180 }, // MIRFAK mag 1.80
+    { 12558,   3005,   85 }, // ALDEBA mag 0.85
+    { 13517,   6038,  269 }, // HASSAL mag 2.69
+    { 14314,  -1493,   13 }, // RIGEL  mag 0.13
+    { 14412,   8374,    8 }, // CAPELL mag 0.08
+    { 14797,   1156,  164 }, // BELLAT mag 1.64
+    { 14849,   5208,  165 }, // ELNATH mag 1.65
+    { 15109,    -54,  223 }, // MINTAK mag 2.23
+    { 15142,  -3244,  258 }, // ARNEB  mag 2.58
+    { 15300,   -219,  169 }, // ALNILA mag 1.69
+    { 15456,  -6203,  264 }, // PHACT  mag 2.64
+    { 15507,   -354,  177 }, // ALNITA mag 1.77
+    { 15827,  -1760,  209 }, // SAIPH  mag 2.09
+    { 16163,   1348,   50 }, // BETELG mag 0.50
+    { 16362,   8183,  190 }, // MENKAL mag 1.90
+    { 16370,   6774,  265 }, // MAHASI mag 2.65
+    { 17416,  -3269,  198 }, // MIRZAM mag 1.98
+    { 17476,  -9593,  -74 }, // CANOPU mag -0.74
+    { 18102,   2985,  192 }, // ALHENA mag 1.92
+    { 18437,  -3043, -146 }, // SIRIUS mag -1.46
+    { 19052,  -5274,  150 }, // ADHARA mag 1.50
+    { 19497,  -4805,  184 }, // WEZEN  mag 1.84
+    { 20212,  -5334,  245 }, // ALUDRA mag 2.45
+    { 20690,   5805,  157 }, // CASTOR mag 1.57
+    { 20903,    951,   34 }, // PROCYO mag 0.34
+    { 21176,   5102,  114 }, // POLLUX mag 1.14
+    { 22009,  -7282,  225 }, // NAOS   mag 2.25
+    { 22277,  -8617,  178 }, // REGOR  mag 1.78
+    { 22869, -10833,  186 }, // AVIOR  mag 1.86
+    { 23880,  -9959,  196 }, // ALSEPH mag 1.96
+    { 24939,  -7907,  221 }, // SUHAIL mag 2.21
+    { 25177, -12692,  168 }, // MIAPLA mag 1.68
+    { 25354, -10791,  221 }, // ASPIDI mag 2.21
+    { 25584, -10014,  250 }, // MARKEB mag 2.50
+    { 25832,  -1576,  198 }, // ALPHAR mag 1.98
+    { 27689,   2179,  135 }, // REGULU mag 1.35
+    { 28216,   3612,  208 }, // ALGIEB mag 2.08
+    { 30122,  10264,  237 }, // MERAK  mag 2.37
+    { 30207,  11241,  179 }, // DUBHE  mag 1.79
+    { 32271,   2653,  213 }, // DENEBO mag 2.13
+    { 32487,   9775,  244 }, // PHECDA mag 2.44
+    { 33486,  -3193,  259 }, // GIENAH mag 2.59
+    { 33978, -11487,   76 }, // ACRUX  mag 0.76
+    { 34185, -10397,  163 }, // GACRUX mag 1.63
+    { 34333,  -4259,  265 }, // KRAZ   mag 2.65
+    { 34461, -12586,  269 }, // ALPMUS mag 2.69
+    { 34658,  -8913,  217 }, // MUHLIF mag 2.17
+    { 34939, -10866,  125 }, // MIMOSA mag 1.25
+    { 35226,  10187,  177 }, // ALIOTH mag 1.77
+    { 36588,   9999,  204 }, // MIZAR  mag 2.04
+    { 36646,  -2032,   97 }, // SPICA  mag 0.97
+    { 37315,  -9733,  230 }, // EPSCEN mag 2.30
+    { 37661,   8977,  186 }, // ALKAID mag 1.86
+    { 37986,   3349,  268 }, // MUPHRI mag 2.68
+    { 38025,  -8609,  255 }, // ZETCEN mag 2.55
+    { 38404, -10991,   61 }, // HADAR  mag 0.61
+    { 38532,  -6621,  206 }, // MENKEN mag 2.06
+    { 38942,   3492,   -5 }, // ARCTUR mag -0.05
+    { 39846,  -7675,  231 }, // ETACEN mag 2.31
+    { 40032, -11074,  -27 }, // RIGILK mag -0.27
+    { 40135,  -8627,  230 }, // ALPLUP mag 2.30
+    { 40277,   4929,  237 }, // IZAR   mag 2.37
+    { 40537,  13500,  208 }, // KOCHAB mag 2.08
+    { 41733,  -1708,  261 }, // ZUBENE mag 2.61
+    { 42538,   4863,  223 }, // ALPHEC mag 2.23
+    { 42975,   1170,  263 }, // UNUKAL mag 2.63
+    { 43707,  -4118,  232 }, // DSCHUB mag 2.32
+    { 43936,  -3605,  262 }, // ACRAB  mag 2.62
+    { 45029,  -4812,   96 }, // ANTARE mag 0.96
+    { 45384,  -1924,  257 }, // ZETOPH mag 2.57
+    { 45905, -12566,  192 }, // ATRIA  mag 1.92
+    { 45974,  -6243,  229 }, // LARAWA mag 2.29
+    { 46894,  -2863,  243 }, // SABIK  mag 2.43
+    { 47951,  -6755,  163 }, // SHAULA mag 1.63
+    { 48011,   2286,  207 }, // RASALH mag 2.07
+    { 48120,  -7828,  187 }, // SARGAS mag 1.87
+    { 48355,  -7105,  241 }, // GIRTAB mag 2.41
+    { 48996,   9373,  223 }, // ELTANI mag 2.23
+    { 50108,  -5430,  270 }, // KAUSME mag 2.70
+    { 50252,  -6260,  185 }, // KAUSAU mag 1.85
+    { 50831,   7060,    3 }, // VEGA   mag 0.03
+    { 51667,  -4787,  206 }, // NUNKI  mag 2.06
+    { 52000,  -5439,  260 }, // ASCELL mag 2.60
+    { 54193,   1614,   77 }, // ALTAIR mag 0.77
+    { 55624,   7329,  223 }, // SADR   mag 2.23
+    { 55779, -10328,  194 }, // PEACOC mag 1.94
+    { 56497,   8243,  125 }, // DENEB  mag 1.25
+    { 56716,   6184,  246 }, // ALJANA mag 2.46
+    { 58191,  11393,  245 }, // ALDERA mag 2.45
+    { 59354,   1798,  239 }, // ENIF   mag 2.39
+    { 60449,  -8549,  174 }, // ALNAIR mag 1.74
+    { 62016,  -8535,  211 }, // TIAKI  mag 2.11
+    { 62699,  -5393,  116 }, // FOMALH mag 1.16
+    { 62977,   5112,  242 }, // SCHEAT mag 2.42
+    { 63021,   2768,  249 }, // MARKAB mag 2.49
+};
+
+const char star_catalog_names[][7] = {
+    "ALPHER",
+    "CAPH",
+    "ANKAA",
+    "SCHEDA",
+    "DIPHDA",
+    "GAMCAS",
+    "MIRACH",
+    "RUCHBA",
+    "ACHERN",
+    "SHERAT",
+    "ALMACH",
+    "HAMAL",
+    "POLARI",
+    "MENKAR",
+    "ALGOL",
+    "MIRFAK",
+    "ALDEBA",
+    "HASSAL",
+    "RIGEL",
+    "CAPELL",
+    "BELLAT",
+    "ELNATH",
+    "MINTAK",
+    "ARNEB",
+    "ALNILA",
+    "PHACT",
+    "ALNITA",
+    "SAIPH",
+    "BETELG",
+    "MENKAL",
+    "MAHASI",
+    "MIRZAM",
+    "CANOPU",
+    "ALHENA",
+    "SIRIUS",
+    "ADHARA",
+    "WEZEN",
+    "ALUDRA",
+    "CASTOR",
+    "PROCYO",
+    "POLLUX",
+    "NAOS",
+    "REGOR",
+    "AVIOR",
+    "ALSEPH",
+    "SUHAIL",
+    "MIAPLA",
+    "ASPIDI",
+    "MARKEB",
+    "ALPHAR",
+    "REGULU",
+    "ALGIEB",
+    "MERAK",
+    "DUBHE",
+    "DENEBO",
+    "PHECDA",
+    "GIENAH",
+    "ACRUX",
+    "GACRUX",
+    "KRAZ",
+    "ALPMUS",
+    "MUHLIF",
+    "MIMOSA",
+    "ALIOTH",
+    "MIZAR",
+    "SPICA",
+    "EPSCEN",
+    "ALKAID",
+    "MUPHRI",
+    "ZETCEN",
+    "HADAR",
+    "MENKEN",
+    "ARCTUR",
+    "ETACEN",
+    "RIGILK",
+    "ALPLUP",
+    "IZAR",
+    "KOCHAB",
+    "ZUBENE",
+    "ALPHEC",
+    "UNUKAL",
+    "DSCHUB",
+    "ACRAB",
+    "ANTARE",
+    "ZETOPH",
+    "ATRIA",
+    "LARAWA",
+    "SABIK",
+    "SHAULA",
+    "RASALH",
+    "SARGAS",
+    "GIRTAB",
+    "ELTANI",
+    "KAUSME",
+    "KAUSAU",
+    "VEGA",
+    "NUNKI",
+    "ASCELL",
+    "ALTAIR",
+    "SADR",
+    "PEACOC",
+    "DENEB",
+    "ALJANA",
+    "ALDERA",
+    "ENIF",
+    "ALNAIR",
+    "TIAKI",
+    "FOMALH",
+    "SCHEAT",
+    "MARKAB",
+};
+
+const uint16_t star_catalog_num_stars = 110;
@@ -0,0 +1,46 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef STAR_CATALOG_H_
+#define STAR_CATALOG_H_
+
+#include <stdint.h>
+
+// Packed bright-star catalog, generated by utils/gen_star_catalog.py and read
+// directly out of flash: no parsing, no RAM copy. Records are sorted by right
+// ascension so the face can binary-search for whatever is crossing the meridian;
+// names live in a parallel table so the records stay a compact six bytes.
+// Coordinates are J2000 in 16-bit binary turns (65536 = one revolution), which
+// shift straight up into astrolib's 32-bit binary angles.
+
+typedef struct {
+    uint16_t right_ascension;   // J2000 right ascension in 16-bit binary turns
+    int16_t declination;        // J2000 declination in 16-bit binary turns
+    int16_t magnitude;          // visual magnitude in centimagnitudes
+} star_catalog_entry_t;
+
+extern const star_catalog_entry_t star_catalog[];
+extern const char star_catalog_names[][7];
+extern const uint16_t star_catalog_num_stars;
+
+#endif // STAR_CATALOG_H_
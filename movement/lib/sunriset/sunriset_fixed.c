@@ -0,0 +1,340 @@
+/*
+
+SUNRISET_FIXED.C - Q16.16 fixed-point port of SUNRISET.C for FPU-less cores.
+
+The algorithm is a line-for-line port of Paul Schlyter's SUNRISET.C (see
+that file for the astronomy). Doubles are replaced with Q16.16 degrees and
+hours; sines and cosines come from a 91-entry quarter-wave table with
+linear interpolation, and arctangents (and vector magnitudes) from an
+18-iteration CORDIC, which together keep the computed times within about
+a minute of the double version for the latitudes a wristwatch will see.
+
+Derived from SUNRISET.C, (c) Paul Schlyter, 1989, 1992; released to the
+public domain by Paul Schlyter, December 1992.
+
+*/
+
+#include "sunriset_fixed.h"
+
+/* A macro to compute the number of days elapsed since 2000 Jan 0.0 */
+/* (which is equal to 1999 Dec 31, 0h UT)                           */
+
+#define days_since_2000_Jan_0(y,m,d) \
+    (367L*(y)-((7*((y)+(((m)+9)/12)))/4)+((275*(m))/9)+(d)-730530L)
+
+#define FIX16_ONE      SUNRISET_FIX16_ONE
+#define FIX16_HALF     ((sunriset_fix16_t)0x8000)
+#define FIX16_90_DEG   (90 * FIX16_ONE)
+#define FIX16_180_DEG  (180 * FIX16_ONE)
+#define FIX16_360_DEG  ((int64_t)360 * FIX16_ONE)
+
+/* Constants from the double version, scaled to fixed point. The per-day   */
+/* rates are kept at higher precision (Q8.24 and beyond) because they get  */
+/* multiplied by day counts in the tens of thousands; at Q16.16 the        */
+/* rounding error alone would reach hundredths of a degree by the 2030s.   */
+#define C_MEAN_ANOM_BASE   23333896   /* 356.0470, Q16.16 degrees */
+#define C_MEAN_ANOM_RATE   16535628   /* 0.9856002585, Q8.24 degrees/day */
+#define C_PERIHELION_BASE  18542782   /* 282.9404, Q16.16 degrees */
+#define C_PERIHELION_RATE  790        /* 4.70935e-5, Q8.24 degrees/day */
+#define C_ECCENTRICITY     1095       /* 0.016709, Q16.16 (the 1.151e-9/day drift is below our resolution) */
+#define C_RADEG            3754936    /* 180/pi, Q16.16 */
+#define C_OBLIQUITY_BASE   1536118    /* 23.4393, Q16.16 degrees */
+#define C_OBLIQUITY_RATE   391756     /* 3.563e-7, Q24.40 degrees/day */
+#define C_GMST0_BASE       53673158   /* 180 + 356.0470 + 282.9404, Q16.16 degrees */
+#define C_GMST0_RATE       16536419   /* 0.9856002585 + 4.70935e-5, Q8.24 degrees/day */
+#define C_SUN_RADIUS       17472      /* 0.2666, Q16.16 degrees at 1 AU */
+
+static sunriset_fix16_t _fix16_mul(sunriset_fix16_t a, sunriset_fix16_t b) {
+    return (sunriset_fix16_t)(((int64_t)a * b) >> 16);
+}
+
+static sunriset_fix16_t _fix16_div(sunriset_fix16_t a, sunriset_fix16_t b) {
+    return (sunriset_fix16_t)(((int64_t)a << 16) / b);
+}
+
+/* Reduce an angle (possibly far outside one revolution, hence the 64-bit */
+/* argument) to within 0..360 degrees.                                    */
+static sunriset_fix16_t _fix16_revolution(int64_t x) {
+    int64_t r = x % FIX16_360_DEG;
+    if (r < 0) r += FIX16_360_DEG;
+    return (sunriset_fix16_t)r;
+}
+
+/* Reduce an angle to within -180..+180 degrees. */
+static sunriset_fix16_t _fix16_rev180(sunriset_fix16_t x) {
+    sunriset_fix16_t r = _fix16_revolution(x);
+    if (r >= FIX16_180_DEG) r -= (sunriset_fix16_t)FIX16_360_DEG;
+    return r;
+}
+
+/* sin(x degrees) for x = 0..90, Q16.16, one-degree steps. */
+static const uint32_t _sine_table[91] = {
+        0,  1144,  2287,  3430,  4572,  5712,  6850,  7987,  9121, 10252,
+    11380, 12505, 13626, 14742, 15855, 16962, 18064, 19161, 20252, 21336,
+    22415, 23486, 24550, 25607, 26656, 27697, 28729, 29753, 30767, 31772,
+    32768, 33754, 34729, 35693, 36647, 37590, 38521, 39441, 40348, 41243,
+    42126, 42995, 43852, 44695, 45525, 46341, 47143, 47930, 48703, 49461,
+    50203, 50931, 51643, 52339, 53020, 53684, 54332, 54963, 55578, 56175,
+    56756, 57319, 57865, 58393, 58903, 59396, 59870, 60326, 60764, 61183,
+    61584, 61966, 62328, 62672, 62997, 63303, 63589, 63856, 64104, 64332,
+    64540, 64729, 64898, 65048, 65177, 65287, 65376, 65446, 65496, 65526,
+    65536
+};
+
+static sunriset_fix16_t _fix16_sind(int64_t x) {
+    sunriset_fix16_t r = _fix16_revolution(x);
+    int negate = 0;
+    if (r >= FIX16_180_DEG) {
+        r -= FIX16_180_DEG;
+        negate = 1;
+    }
+    if (r > FIX16_90_DEG) r = FIX16_180_DEG - r;
+
+    uint32_t deg = (uint32_t)r >> 16;
+    uint32_t frac = (uint32_t)r & 0xFFFF;
+    uint32_t a = _sine_table[deg];
+    sunriset_fix16_t value = (sunriset_fix16_t)(a + (((_sine_table[deg + (deg < 90)] - a) * frac) >> 16));
+    return negate ? -value : value;
+}
+
+static sunriset_fix16_t _fix16_cosd(int64_t x) {
+    return _fix16_sind(x + FIX16_90_DEG);
+}
+
+/* atand(2^-i) for i = 0..17, Q16.16 degrees: the CORDIC angle table. */
+static const sunriset_fix16_t _cordic_angles[18] = {
+    2949120, 1740967, 919879, 466945, 234379, 117304, 58666, 29335,
+    14668, 7334, 3667, 1833, 917, 458, 229, 115, 57, 29
+};
+
+/* 1 / 1.64676..., Q16.16: compensates the CORDIC's intrinsic gain. */
+#define CORDIC_INVERSE_GAIN 39797
+
+/* atan2 in degrees via CORDIC vectoring mode; as a byproduct the rotated  */
+/* x holds gain * sqrt(x^2 + y^2), which callers can collect through *mag. */
+static sunriset_fix16_t _fix16_atan2d(sunriset_fix16_t y, sunriset_fix16_t x, sunriset_fix16_t *mag) {
+    sunriset_fix16_t angle = 0;
+
+    if (x == 0 && y == 0) {
+        if (mag) *mag = 0;
+        return 0;
+    }
+
+    /* pre-rotate by +/-90 degrees so the vector lands in the right half plane, */
+    /* where the CORDIC iteration converges.                                    */
+    if (x < 0) {
+        sunriset_fix16_t t = x;
+        if (y >= 0) {
+            x = y;
+            y = -t;
+            angle = FIX16_90_DEG;
+        } else {
+            x = -y;
+            y = t;
+            angle = -FIX16_90_DEG;
+        }
+    }
+
+    for (int i = 0; i < 18; i++) {
+        sunriset_fix16_t xt;
+        if (y > 0) {
+            xt = x + (y >> i);
+            y -= (x >> i);
+            angle += _cordic_angles[i];
+        } else {
+            xt = x - (y >> i);
+            y += (x >> i);
+            angle -= _cordic_angles[i];
+        }
+        x = xt;
+    }
+
+    if (mag) *mag = (sunriset_fix16_t)(((int64_t)x * CORDIC_INVERSE_GAIN) >> 16);
+    return angle;
+}
+
+static uint32_t _isqrt64(uint64_t v) {
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= result + bit) {
+            v -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)result;
+}
+
+/* sqrt of a non-negative Q16.16 value. */
+static sunriset_fix16_t _fix16_sqrt(sunriset_fix16_t x) {
+    if (x <= 0) return 0;
+    return (sunriset_fix16_t)_isqrt64((uint64_t)(uint32_t)x << 16);
+}
+
+static sunriset_fix16_t _fix16_acosd(sunriset_fix16_t x) {
+    if (x >= FIX16_ONE) return 0;
+    if (x <= -FIX16_ONE) return FIX16_180_DEG;
+    return _fix16_atan2d(_fix16_sqrt(FIX16_ONE - _fix16_mul(x, x)), x, 0);
+}
+
+/* Computes the Sun's ecliptic longitude and distance, as sunpos() does in */
+/* the double version. d is Q16.16 days since 2000 Jan 0.0.                */
+static void _sunpos_fixed(sunriset_fix16_t d, sunriset_fix16_t *lon, sunriset_fix16_t *r) {
+    sunriset_fix16_t M, w, e, E, x, y, v;
+
+    /* Compute mean elements */
+    M = _fix16_revolution(C_MEAN_ANOM_BASE + (((int64_t)d * C_MEAN_ANOM_RATE) >> 24));
+    w = (sunriset_fix16_t)(C_PERIHELION_BASE + (((int64_t)d * C_PERIHELION_RATE) >> 24));
+    e = C_ECCENTRICITY;
+
+    /* Compute true longitude and radius vector */
+    E = M + _fix16_mul(_fix16_mul(e, C_RADEG),
+                       _fix16_mul(_fix16_sind(M), FIX16_ONE + _fix16_mul(e, _fix16_cosd(M))));
+    x = _fix16_cosd(E) - e;
+    /* sqrt(1 - e^2) to first order; e^2/2 is two parts in ten thousand */
+    y = _fix16_mul(FIX16_ONE - _fix16_mul(e, e) / 2, _fix16_sind(E));
+    v = _fix16_atan2d(y, x, r);          /* True anomaly and solar distance */
+    *lon = _fix16_revolution((int64_t)v + w);  /* True solar longitude, 0..360 degrees */
+}
+
+/* Computes the Sun's equatorial coordinates RA, Decl and distance, as */
+/* sun_RA_dec() does in the double version.                            */
+static void _sun_RA_dec_fixed(sunriset_fix16_t d, sunriset_fix16_t *RA, sunriset_fix16_t *dec, sunriset_fix16_t *r) {
+    sunriset_fix16_t lon, obl_ecl, x, y, z, xy_mag;
+
+    /* Compute Sun's ecliptical coordinates */
+    _sunpos_fixed(d, &lon, r);
+
+    /* Compute ecliptic rectangular coordinates (z=0) */
+    x = _fix16_mul(*r, _fix16_cosd(lon));
+    y = _fix16_mul(*r, _fix16_sind(lon));
+
+    /* Compute obliquity of ecliptic (inclination of Earth's axis) */
+    obl_ecl = C_OBLIQUITY_BASE - (sunriset_fix16_t)(((int64_t)d * C_OBLIQUITY_RATE) >> 40);
+
+    /* Convert to equatorial rectangular coordinates - x is unchanged */
+    z = _fix16_mul(y, _fix16_sind(obl_ecl));
+    y = _fix16_mul(y, _fix16_cosd(obl_ecl));
+
+    /* Convert to spherical coordinates; the first CORDIC pass hands us */
+    /* sqrt(x^2 + y^2) for free.                                        */
+    *RA = _fix16_atan2d(y, x, &xy_mag);
+    *dec = _fix16_atan2d(z, xy_mag, 0);
+}
+
+/* GMST0, as in the double version: Greenwich Mean Sidereal Time at 0h UT */
+/* minus UT, in degrees.                                                  */
+static sunriset_fix16_t _gmst0_fixed(sunriset_fix16_t d) {
+    return _fix16_revolution(C_GMST0_BASE + (((int64_t)d * C_GMST0_RATE) >> 24));
+}
+
+int __sunriset_fixed__( int year, int month, int day, sunriset_fix16_t lon, sunriset_fix16_t lat,
+                        sunriset_fix16_t altit, int upper_limb,
+                        sunriset_fix16_t *trise, sunriset_fix16_t *tset )
+{
+    sunriset_fix16_t d,   /* Days since 2000 Jan 0.0 (negative before) */
+    sr,                   /* Solar distance, astronomical units */
+    sRA,                  /* Sun's Right Ascension */
+    sdec,                 /* Sun's declination */
+    sradius,              /* Sun's apparent radius */
+    t,                    /* Diurnal arc */
+    tsouth,               /* Time when Sun is at south */
+    sidtime;              /* Local sidereal time */
+
+    int rc = 0;           /* Return code from function - usually 0 */
+
+    /* Compute d of 12h local mean solar time */
+    d = (sunriset_fix16_t)(((int64_t)days_since_2000_Jan_0(year, month, day) << 16) + FIX16_HALF - lon / 360);
+
+    /* Compute the local sidereal time of this moment */
+    sidtime = _fix16_revolution((int64_t)_gmst0_fixed(d) + FIX16_180_DEG + lon);
+
+    /* Compute Sun's RA, Decl and distance at this moment */
+    _sun_RA_dec_fixed(d, &sRA, &sdec, &sr);
+
+    /* Compute time when Sun is at south - in hours UT */
+    tsouth = 12 * FIX16_ONE - _fix16_rev180(sidtime - sRA) / 15;
+
+    /* Compute the Sun's apparent radius in degrees */
+    sradius = _fix16_div(C_SUN_RADIUS, sr);
+
+    /* Do correction to upper limb, if necessary */
+    if ( upper_limb )
+        altit -= sradius;
+
+    /* Compute the diurnal arc that the Sun traverses to reach */
+    /* the specified altitude altit: */
+    {
+        sunriset_fix16_t cost;
+        sunriset_fix16_t num = _fix16_sind(altit) - _fix16_mul(_fix16_sind(lat), _fix16_sind(sdec));
+        sunriset_fix16_t den = _fix16_mul(_fix16_cosd(lat), _fix16_cosd(sdec));
+        /* den is zero only at the poles; the num >= den comparisons below */
+        /* then resolve the always-up/always-down cases on num's sign.     */
+        cost = den ? _fix16_div(num, den) : (num >= 0 ? FIX16_ONE : -FIX16_ONE);
+        if ( cost >= FIX16_ONE )
+            rc = -1, t = 0;              /* Sun always below altit */
+        else if ( cost <= -FIX16_ONE )
+            rc = +1, t = 12 * FIX16_ONE; /* Sun always above altit */
+        else
+            t = _fix16_acosd(cost) / 15; /* The diurnal arc, hours */
+    }
+
+    /* Store rise and set times - in hours UT */
+    *trise = tsouth - t;
+    *tset  = tsouth + t;
+
+    return rc;
+}  /* __sunriset_fixed__ */
+
+sunriset_fix16_t __daylen_fixed__( int year, int month, int day, sunriset_fix16_t lon, sunriset_fix16_t lat,
+                                   sunriset_fix16_t altit, int upper_limb )
+{
+    sunriset_fix16_t d,   /* Days since 2000 Jan 0.0 (negative before) */
+    obl_ecl,              /* Obliquity (inclination) of Earth's axis */
+    sr,                   /* Solar distance, astronomical units */
+    slon,                 /* True solar longitude */
+    sin_sdecl,            /* Sine of Sun's declination */
+    cos_sdecl,            /* Cosine of Sun's declination */
+    sradius,              /* Sun's apparent radius */
+    t;                    /* Diurnal arc */
+
+    /* Compute d of 12h local mean solar time */
+    d = (sunriset_fix16_t)(((int64_t)days_since_2000_Jan_0(year, month, day) << 16) + FIX16_HALF - lon / 360);
+
+    /* Compute obliquity of ecliptic (inclination of Earth's axis) */
+    obl_ecl = C_OBLIQUITY_BASE - (sunriset_fix16_t)(((int64_t)d * C_OBLIQUITY_RATE) >> 40);
+
+    /* Compute Sun's ecliptic longitude and distance */
+    _sunpos_fixed(d, &slon, &sr);
+
+    /* Compute sine and cosine of Sun's declination */
+    sin_sdecl = _fix16_mul(_fix16_sind(obl_ecl), _fix16_sind(slon));
+    cos_sdecl = _fix16_sqrt(FIX16_ONE - _fix16_mul(sin_sdecl, sin_sdecl));
+
+    /* Compute the Sun's apparent radius, degrees */
+    sradius = _fix16_div(C_SUN_RADIUS, sr);
+
+    /* Do correction to upper limb, if necessary */
+    if ( upper_limb )
+        altit -= sradius;
+
+    /* Compute the diurnal arc that the Sun traverses to reach */
+    /* the specified altitude altit: */
+    {
+        sunriset_fix16_t cost;
+        sunriset_fix16_t num = _fix16_sind(altit) - _fix16_mul(_fix16_sind(lat), sin_sdecl);
+        sunriset_fix16_t den = _fix16_mul(_fix16_cosd(lat), cos_sdecl);
+        cost = den ? _fix16_div(num, den) : (num >= 0 ? FIX16_ONE : -FIX16_ONE);
+        if ( cost >= FIX16_ONE )
+            t = 0;                            /* Sun always below altit */
+        else if ( cost <= -FIX16_ONE )
+            t = 24 * FIX16_ONE;               /* Sun always above altit */
+        else
+            t = 2 * (_fix16_acosd(cost) / 15); /* The diurnal arc, hours */
+    }
+    return t;
+}  /* __daylen_fixed__ */
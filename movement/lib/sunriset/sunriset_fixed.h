@@ -0,0 +1,76 @@
+/*
+
+SUNRISET_FIXED.H - fixed-point variant of the sun rise/set routines in
+                   sunriset.c, for processors without an FPU.
+
+The interface mirrors sunriset.h, but all angles and times are Q16.16
+fixed-point values (degrees and decimal hours respectively) instead of
+doubles. On the SAM L22's Cortex-M0+, where every double operation is a
+softfloat library call, this computes a rise/set pair roughly two orders
+of magnitude faster while staying within about a minute of the double
+version. Valid for calendar dates from 1970 through 2089; past that the
+day count overflows the Q16.16 range.
+
+Derived from SUNRISET.C, (c) Paul Schlyter, 1989, 1992; released to the
+public domain by Paul Schlyter, December 1992.
+
+*/
+
+#ifndef SUNRISET_FIXED_H_
+#define SUNRISET_FIXED_H_
+
+#include <stdint.h>
+
+/* Q16.16 fixed-point value: degrees for angles, decimal hours for times. */
+typedef int32_t sunriset_fix16_t;
+
+#define SUNRISET_FIX16_ONE ((sunriset_fix16_t)0x10000)
+
+/* Convert between Q16.16 and other representations. */
+#define sunriset_fix16_from_int(x) ((sunriset_fix16_t)((x) * 65536))
+#define sunriset_fix16_to_int(x)   ((int32_t)((x) >> 16))
+
+/* Following are some macros around the "workhorse" function __sunriset_fixed__ */
+/* They mostly serve as examples of how to use the function; the altitude      */
+/* arguments are the same Q16.16 degrees as in the double version.             */
+
+/* This macro computes times for sunrise/sunset.                  */
+/* Sunrise/set is considered to occur when the Sun's upper limb   */
+/* is 35 arc minutes below the horizon (this accounts for the     */
+/* refraction of the Earth's atmosphere).                         */
+#define sun_rise_set_fixed(year,month,day,lon,lat,rise,set)  \
+        __sunriset_fixed__( year, month, day, lon, lat, -38229, 1, rise, set )
+
+/* This macro computes the start and end times of civil twilight.       */
+/* Civil twilight starts/ends when the Sun's center is 6 degrees below  */
+/* the horizon.                                                         */
+#define civil_twilight_fixed(year,month,day,lon,lat,start,end)  \
+        __sunriset_fixed__( year, month, day, lon, lat, -393216, 0, start, end )
+
+/* This macro computes the start and end times of nautical twilight.      */
+/* Nautical twilight starts/ends when the Sun's center is 12 degrees      */
+/* below the horizon.                                                     */
+#define nautical_twilight_fixed(year,month,day,lon,lat,start,end)  \
+        __sunriset_fixed__( year, month, day, lon, lat, -786432, 0, start, end )
+
+/* This macro computes the start and end times of astronomical twilight.    */
+/* Astronomical twilight starts/ends when the Sun's center is 18 degrees    */
+/* below the horizon.                                                       */
+#define astronomical_twilight_fixed(year,month,day,lon,lat,start,end)  \
+        __sunriset_fixed__( year, month, day, lon, lat, -1179648, 0, start, end )
+
+/* This macro computes the length of the day, from sunrise to sunset. */
+#define day_length_fixed(year,month,day,lon,lat)  \
+        __daylen_fixed__( year, month, day, lon, lat, -38229, 1 )
+
+/* The "workhorse" functions. Same semantics and return values as         */
+/* __sunriset__ and __daylen__ in sunriset.h, with Q16.16 in place of     */
+/* double throughout.                                                     */
+int __sunriset_fixed__( int year, int month, int day, sunriset_fix16_t lon, sunriset_fix16_t lat,
+                        sunriset_fix16_t altit, int upper_limb,
+                        sunriset_fix16_t *trise, sunriset_fix16_t *tset );
+
+sunriset_fix16_t __daylen_fixed__( int year, int month, int day, sunriset_fix16_t lon, sunriset_fix16_t lat,
+                                   sunriset_fix16_t altit, int upper_limb );
+
+#endif // SUNRISET_FIXED_H_
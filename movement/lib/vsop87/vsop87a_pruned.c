@@ -0,0 +1,1139 @@
+//Generated by utils/gen_vsop87_pruned.py from vsop87a_milli.c; do not edit.
+//Terms contributing less than 1 arc seconds as seen from Earth are pruned.
+//Underlying data: VSOP87-Multilang http://www.astrogreg.com/vsop87-multilang/index.html
+//Greg Miller (gmiller@gregmiller.net) 2019.  Released as Public Domain
+
+#include <math.h>
+#include "vsop87a_pruned.h"
+
+static double _vsop87a_pruned_eval(const vsop87a_pruned_series_t *series, double t) {
+   const vsop87a_pruned_term_t *term = series->terms;
+   double tn = 1.0;
+   double result = 0.0;
+   for (int power = 0; power < VSOP87A_PRUNED_MAX_POWER; power++) {
+      double sum = 0.0;
+      for (int i = 0; i < series->counts[power]; i++) {
+         sum += term->a * cos(term->b + term->c * t);
+         term++;
+      }
+      result += sum * tn;
+      tn *= t;
+   }
+   return result;
+}
+
+static const vsop87a_pruned_term_t _earth_x_terms[] = {
+   {0.99982928844, 1.75348568475, 6283.07584999140},
+   {0.00835257300, 1.71034539450, 12566.15169998280},
+   {0.00561144206, 0.00000000000, 0.00000000000},
+   {0.00010466628, 1.66722645223, 18849.22754997420},
+   {0.00003110838, 0.66875185215, 83996.84731811189},
+   {0.00002552498, 0.58310207301, 529.69096509460},
+   {0.00002137256, 1.09235189672, 1577.34354244780},
+   {0.00001709103, 0.49540223397, 6279.55273164240},
+   {0.00001707882, 6.15315547484, 6286.59896834040},
+   {0.00001445242, 3.47272783760, 2352.86615377180},
+   {0.00001091006, 3.68984782465, 5223.69391980220},
+   {0.00123403056, 0.00000000000, 0.00000000000},
+   {0.00051500156, 6.00266267204, 12566.15169998280},
+   {0.00001290726, 5.95943124583, 18849.22754997420},
+   {0.00001068627, 2.01554176551, 6283.07584999140},
+   {0.00004143217, 3.14159265359, 0.00000000000},
+   {0.00002175695, 4.39999849572, 12566.15169998280},
+};
+static const vsop87a_pruned_series_t _earth_x = {_earth_x_terms, {11, 4, 2, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _earth_y_terms[] = {
+   {0.99989211030, 0.18265890456, 6283.07584999140},
+   {0.02442699036, 3.14159265359, 0.00000000000},
+   {0.00835292314, 0.13952878991, 12566.15169998280},
+   {0.00010466965, 0.09641690558, 18849.22754997420},
+   {0.00003110838, 5.38114091484, 83996.84731811189},
+   {0.00002570338, 5.30103973360, 529.69096509460},
+   {0.00002147473, 2.66253538905, 1577.34354244780},
+   {0.00001709219, 5.20780401071, 6279.55273164240},
+   {0.00001707987, 4.58232858766, 6286.59896834040},
+   {0.00001440265, 1.90068164664, 2352.86615377180},
+   {0.00001135092, 5.27313415220, 5223.69391980220},
+   {0.00093046324, 0.00000000000, 0.00000000000},
+   {0.00051506609, 4.43180499286, 12566.15169998280},
+   {0.00001290800, 4.38860548540, 18849.22754997420},
+   {0.00005080208, 0.00000000000, 0.00000000000},
+   {0.00002178016, 2.82957544235, 12566.15169998280},
+   {0.00001020487, 4.63746718598, 6283.07584999140},
+};
+static const vsop87a_pruned_series_t _earth_y = {_earth_y_terms, {11, 3, 3, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _earth_z_terms[] = {
+   {0.00227822442, 3.41372504278, 6283.07584999140},
+   {0.00005429282, 0.00000000000, 0.00000000000},
+   {0.00001903183, 3.37061270964, 12566.15169998280},
+   {0.00009721989, 5.15233725915, 6283.07584999140},
+};
+static const vsop87a_pruned_series_t _earth_z = {_earth_z_terms, {0, 3, 1, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _emb_x_terms[] = {
+   {0.99982927460, 1.75348568475, 6283.07584999140},
+   {0.00835257300, 1.71034539450, 12566.15169998280},
+   {0.00561144161, 0.00000000000, 0.00000000000},
+   {0.00010466628, 1.66722645223, 18849.22754997420},
+   {0.00002552498, 0.58310207301, 529.69096509460},
+   {0.00002137256, 1.09235189672, 1577.34354244780},
+   {0.00001709103, 0.49540223397, 6279.55273164240},
+   {0.00001707882, 6.15315547484, 6286.59896834040},
+   {0.00001445242, 3.47272783760, 2352.86615377180},
+   {0.00001091006, 3.68984782465, 5223.69391980220},
+   {0.00123403046, 0.00000000000, 0.00000000000},
+   {0.00051500156, 6.00266267204, 12566.15169998280},
+   {0.00001290726, 5.95943124583, 18849.22754997420},
+   {0.00001068627, 2.01554176551, 6283.07584999140},
+   {0.00004143217, 3.14159265359, 0.00000000000},
+   {0.00002175695, 4.39999849572, 12566.15169998280},
+};
+static const vsop87a_pruned_series_t _emb_x = {_emb_x_terms, {10, 4, 2, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _emb_y_terms[] = {
+   {0.99989209645, 0.18265890456, 6283.07584999140},
+   {0.02442698841, 3.14159265359, 0.00000000000},
+   {0.00835292314, 0.13952878991, 12566.15169998280},
+   {0.00010466965, 0.09641690558, 18849.22754997420},
+   {0.00002570338, 5.30103973360, 529.69096509460},
+   {0.00002147473, 2.66253538905, 1577.34354244780},
+   {0.00001709219, 5.20780401071, 6279.55273164240},
+   {0.00001707987, 4.58232858766, 6286.59896834040},
+   {0.00001440265, 1.90068164664, 2352.86615377180},
+   {0.00001135092, 5.27313415220, 5223.69391980220},
+   {0.00093046317, 0.00000000000, 0.00000000000},
+   {0.00051506609, 4.43180499286, 12566.15169998280},
+   {0.00001290800, 4.38860548540, 18849.22754997420},
+   {0.00005080208, 0.00000000000, 0.00000000000},
+   {0.00002178016, 2.82957544235, 12566.15169998280},
+   {0.00001020487, 4.63746718598, 6283.07584999140},
+};
+static const vsop87a_pruned_series_t _emb_y = {_emb_y_terms, {10, 3, 3, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _emb_z_terms[] = {
+   {0.00227822442, 3.41372504278, 6283.07584999140},
+   {0.00005429282, 0.00000000000, 0.00000000000},
+   {0.00001903183, 3.37061270964, 12566.15169998280},
+   {0.00009721989, 5.15233725915, 6283.07584999140},
+};
+static const vsop87a_pruned_series_t _emb_z = {_emb_z_terms, {0, 3, 1, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _jupiter_x_terms[] = {
+   {5.19663470114, 0.59945082355, 529.69096509460},
+   {0.36662642320, 3.14159265359, 0.00000000000},
+   {0.12593937922, 0.94911583701, 1059.38193018920},
+   {0.01500672056, 0.73175134610, 522.57741809380},
+   {0.01476224578, 3.61736921122, 536.80451209540},
+   {0.00457752736, 1.29883700755, 1589.07289528380},
+   {0.00301689798, 5.17372551148, 7.11354700080},
+   {0.00385975375, 2.01229910687, 103.09277421860},
+   {0.00194025405, 5.02580363996, 426.59819087600},
+   {0.00150678793, 6.12003027739, 110.20632121940},
+   {0.00144867641, 5.55980577080, 632.78373931320},
+   {0.00134226996, 0.87648567011, 213.29909543800},
+   {0.00103494641, 6.19324769120, 1052.26838318840},
+   {0.00114201562, 0.01567084269, 1162.47470440780},
+   {0.00072095575, 3.96117430643, 1066.49547719000},
+   {0.00059486083, 4.45769374358, 949.17560896980},
+   {0.00068284021, 3.44051122631, 846.08283475120},
+   {0.00047092251, 1.44612636451, 419.48464387520},
+   {0.00030623417, 2.99132321427, 206.18554843720},
+   {0.00026613459, 4.85169906494, 323.50541665740},
+   {0.00019727457, 1.64891626213, 2118.76386037840},
+   {0.00016481594, 1.95150056568, 316.39186965660},
+   {0.00016101974, 0.87973155980, 515.46387109300},
+   {0.00014209487, 2.07769621413, 742.99006053260},
+   {0.00015192516, 6.25820127906, 735.87651353180},
+   {0.00011423199, 3.48146108929, 543.91805909620},
+   {0.00012155285, 3.75229924999, 525.75881183150},
+   {0.00011996271, 0.58568573729, 533.62311835770},
+   {0.00008468556, 3.47248751739, 639.89728631400},
+   {0.00008223302, 5.56680447143, 1478.86657406440},
+   {0.00008694124, 0.38262009411, 1692.16566950240},
+   {0.00007427517, 5.98380751196, 956.28915597060},
+   {0.00007516470, 0.92896448412, 1265.56747862640},
+   {0.00007655867, 0.14178789086, 1581.95934828300},
+   {0.00005318791, 1.10494016349, 526.50957135690},
+   {0.00005218492, 3.23235129224, 532.87235883230},
+   {0.00005777311, 5.03726165628, 14.22709400160},
+   {0.00004622685, 3.75817086099, 1375.77379984580},
+   {0.00003939864, 4.30892687511, 1596.18644228460},
+   {0.00004569444, 2.15087281710, 95.97922721780},
+   {0.00002952712, 3.85988483947, 309.27832265580},
+   {0.00002857935, 6.01118473739, 117.31986822020},
+   {0.00002440094, 4.23995765702, 433.71173787680},
+   {0.00002438257, 3.88808463822, 220.41264243880},
+   {0.00002675112, 3.18723449094, 1169.58825140860},
+   {0.00002386425, 5.96354994324, 1045.15483618760},
+   {0.00001939060, 5.91883412864, 625.67019231240},
+   {0.00882389251, 3.14159265359, 0.00000000000},
+   {0.00635297172, 0.10662156868, 1059.38193018920},
+   {0.00599720482, 2.42996678275, 522.57741809380},
+   {0.00589157060, 1.91556314637, 536.80451209540},
+   {0.00081697204, 3.46668108797, 7.11354700080},
+   {0.00046201898, 0.45714214032, 1589.07289528380},
+   {0.00032508590, 1.74648849928, 1052.26838318840},
+   {0.00033891193, 4.10113482752, 529.69096509460},
+   {0.00031234303, 2.34698051502, 1066.49547719000},
+   {0.00021244363, 4.36576178953, 110.20632121940},
+   {0.00018156701, 4.00572238779, 426.59819087600},
+   {0.00013577576, 0.30008010246, 632.78373931320},
+   {0.00012889505, 2.57489294062, 515.46387109300},
+   {0.00009125875, 1.78082469962, 543.91805909620},
+   {0.00008085991, 6.16136518902, 949.17560896980},
+   {0.00007142547, 3.17267801203, 323.50541665740},
+   {0.00004292240, 4.74970626655, 206.18554843720},
+   {0.00004393977, 1.14770788063, 735.87651353180},
+   {0.00003399164, 2.90091450747, 526.50957135690},
+   {0.00003333344, 1.43691652967, 532.87235883230},
+   {0.00003873467, 3.33648870101, 14.22709400160},
+   {0.00003044408, 1.65428048669, 525.75881183150},
+   {0.00003001874, 2.68376982746, 533.62311835770},
+   {0.00002933359, 2.61899855005, 419.48464387520},
+   {0.00002438199, 3.60655644537, 316.39186965660},
+   {0.00002804218, 4.89742591320, 103.09277421860},
+   {0.00002990245, 0.80692155639, 2118.76386037840},
+   {0.00001977572, 5.08915489088, 956.28915597060},
+   {0.00123864644, 4.13563277513, 522.57741809380},
+   {0.00121521296, 0.21155109275, 536.80451209540},
+   {0.00085355503, 0.00000000000, 0.00000000000},
+   {0.00077685547, 5.29776154458, 529.69096509460},
+   {0.00041410887, 5.12291589939, 1059.38193018920},
+   {0.00011423070, 1.72917878238, 7.11354700080},
+   {0.00007051587, 0.74163703419, 1066.49547719000},
+   {0.00005711029, 3.63172846494, 1052.26838318840},
+   {0.00005242644, 4.27482379441, 515.46387109300},
+   {0.00004039540, 5.58417732117, 1589.07289528380},
+   {0.00003706457, 0.07769981349, 543.91805909620},
+   {0.00017071323, 5.86133022278, 522.57741809380},
+   {0.00016713548, 4.77458794485, 536.80451209540},
+   {0.00003348610, 0.00000000000, 0.00000000000},
+};
+static const vsop87a_pruned_series_t _jupiter_x = {_jupiter_x_terms, {47, 28, 11, 3, 0, 0}};
+
+static const vsop87a_pruned_term_t _jupiter_y_terms[] = {
+   {5.19520046589, 5.31203162731, 529.69096509460},
+   {0.12592862602, 5.66160227728, 1059.38193018920},
+   {0.09363670616, 3.14159265359, 0.00000000000},
+   {0.01508275299, 5.43934968102, 522.57741809380},
+   {0.01475809370, 2.04679566495, 536.80451209540},
+   {0.00457750806, 6.01129093501, 1589.07289528380},
+   {0.00300686679, 3.60948050740, 7.11354700080},
+   {0.00378285578, 3.53006782383, 103.09277421860},
+   {0.00192333128, 3.45690564771, 426.59819087600},
+   {0.00146104656, 4.62267224431, 110.20632121940},
+   {0.00139480058, 4.00075307706, 632.78373931320},
+   {0.00132696764, 5.62184581859, 213.29909543800},
+   {0.00101999807, 4.57594598884, 1052.26838318840},
+   {0.00114043110, 4.72982262969, 1162.47470440780},
+   {0.00072091178, 2.39048659148, 1066.49547719000},
+   {0.00059051769, 2.89529070968, 949.17560896980},
+   {0.00068374489, 1.86537074374, 846.08283475120},
+   {0.00029807369, 4.52105772740, 206.18554843720},
+   {0.00026933579, 3.86233956827, 419.48464387520},
+   {0.00026619714, 3.28203174951, 323.50541665740},
+   {0.00020873780, 3.79369881757, 735.87651353180},
+   {0.00019727397, 0.07818534532, 2118.76386037840},
+   {0.00018639846, 0.38751972138, 316.39186965660},
+   {0.00016355726, 5.56997881604, 515.46387109300},
+   {0.00014606858, 0.47759399145, 742.99006053260},
+   {0.00011419853, 1.91089341468, 543.91805909620},
+   {0.00012153427, 2.18151972499, 525.75881183150},
+   {0.00011988875, 5.29687602089, 533.62311835770},
+   {0.00008443107, 1.91435801697, 639.89728631400},
+   {0.00008163163, 4.00303742375, 1478.86657406440},
+   {0.00008732789, 5.09607066097, 1692.16566950240},
+   {0.00007414115, 4.41141990461, 956.28915597060},
+   {0.00007619486, 5.59554151997, 1265.56747862640},
+   {0.00007779184, 4.83346300662, 1581.95934828300},
+   {0.00005322882, 5.81740472645, 526.50957135690},
+   {0.00005217025, 1.66178643542, 532.87235883230},
+   {0.00005772132, 3.46915716927, 14.22709400160},
+   {0.00004528355, 2.18377558038, 1375.77379984580},
+   {0.00003939875, 2.73830531054, 1596.18644228460},
+   {0.00004567181, 3.71300776935, 95.97922721780},
+   {0.00003235419, 4.76600347062, 625.67019231240},
+   {0.00003140740, 5.59566796922, 309.27832265580},
+   {0.00002855423, 4.44478286006, 117.31986822020},
+   {0.00002445625, 2.67036952230, 433.71173787680},
+   {0.00002253545, 4.28462825722, 838.96928775040},
+   {0.00002672262, 1.61857897069, 1169.58825140860},
+   {0.00002423639, 2.32942339839, 220.41264243880},
+   {0.00002362662, 4.60417580207, 1155.36115740700},
+   {0.00002409581, 4.33196301609, 1045.15483618760},
+   {0.01694798253, 3.14159265359, 0.00000000000},
+   {0.00634859798, 4.81903199650, 1059.38193018920},
+   {0.00601160431, 0.85811249940, 522.57741809380},
+   {0.00588928504, 0.34491576890, 536.80451209540},
+   {0.00081187145, 1.90914316532, 7.11354700080},
+   {0.00046888090, 1.91294535618, 529.69096509460},
+   {0.00046194129, 5.16955994561, 1589.07289528380},
+   {0.00032503453, 0.17640743623, 1052.26838318840},
+   {0.00031231694, 0.77623645597, 1066.49547719000},
+   {0.00019462096, 3.00957119470, 110.20632121940},
+   {0.00017738615, 2.46531787101, 426.59819087600},
+   {0.00013701692, 5.02070197804, 632.78373931320},
+   {0.00013034616, 0.98979834442, 515.46387109300},
+   {0.00009122660, 0.21022587969, 543.91805909620},
+   {0.00008109050, 4.58123811601, 949.17560896980},
+   {0.00007145229, 1.60381236094, 323.50541665740},
+   {0.00003957592, 6.18550697817, 206.18554843720},
+   {0.00004347346, 5.85522835488, 735.87651353180},
+   {0.00003401735, 1.33033225252, 526.50957135690},
+   {0.00003331887, 6.14951835712, 532.87235883230},
+   {0.00003866147, 1.76877582038, 14.22709400160},
+   {0.00003094257, 1.00670454701, 419.48464387520},
+   {0.00003044205, 0.08329779827, 525.75881183150},
+   {0.00003001484, 1.11280606283, 533.62311835770},
+   {0.00002977284, 3.35507028507, 103.09277421860},
+   {0.00002347100, 2.06781775390, 316.39186965660},
+   {0.00002990192, 5.51944830506, 2118.76386037840},
+   {0.00001968401, 3.51896739844, 956.28915597060},
+   {0.00124032509, 2.56495576833, 522.57741809380},
+   {0.00121455991, 4.92398766380, 536.80451209540},
+   {0.00076523263, 3.75913371793, 529.69096509460},
+   {0.00076943042, 3.14159265359, 0.00000000000},
+   {0.00041357600, 3.55228440457, 1059.38193018920},
+   {0.00011277667, 0.18559902389, 7.11354700080},
+   {0.00007051103, 5.45404368570, 1066.49547719000},
+   {0.00005719440, 2.05970000230, 1052.26838318840},
+   {0.00005286157, 2.69490465064, 515.46387109300},
+   {0.00004039038, 4.01341034637, 1589.07289528380},
+   {0.00003704528, 4.79029292271, 543.91805909620},
+   {0.00017085516, 4.29096904063, 522.57741809380},
+   {0.00016701353, 3.20365737109, 536.80451209540},
+   {0.00004006038, 0.00000000000, 0.00000000000},
+};
+static const vsop87a_pruned_series_t _jupiter_y = {_jupiter_y_terms, {49, 28, 11, 3, 0, 0}};
+
+static const vsop87a_pruned_term_t _jupiter_z_terms[] = {
+   {0.11823100489, 3.55844646343, 529.69096509460},
+   {0.00859031952, 0.00000000000, 0.00000000000},
+   {0.00286562094, 3.90812238338, 1059.38193018920},
+   {0.00042388592, 3.60144191032, 522.57741809380},
+   {0.00033295491, 0.30297050585, 536.80451209540},
+   {0.00010416160, 4.25764593061, 1589.07289528380},
+   {0.00007449294, 5.24213104150, 103.09277421860},
+   {0.00006910102, 1.75032945752, 7.11354700080},
+   {0.00005292012, 1.68231447192, 426.59819087600},
+   {0.00004313598, 3.70673689841, 213.29909543800},
+   {0.00003784265, 2.71522544491, 110.20632121940},
+   {0.00003798016, 2.16715743175, 632.78373931320},
+   {0.00002455385, 2.96904135659, 1052.26838318840},
+   {0.00002461547, 2.99889460411, 1162.47470440780},
+   {0.00002001451, 2.68535838309, 419.48464387520},
+   {0.00002163471, 6.26718259854, 846.08283475120},
+   {0.00407072175, 1.52699353482, 529.69096509460},
+   {0.00020307341, 2.59878269248, 1059.38193018920},
+   {0.00014424953, 4.85400155025, 536.80451209540},
+   {0.00015474611, 0.00000000000, 0.00000000000},
+   {0.00012730364, 5.45536715732, 522.57741809380},
+   {0.00002100882, 0.09538864287, 7.11354700080},
+   {0.00028635326, 3.01374166973, 529.69096509460},
+   {0.00003114752, 3.13228646176, 536.80451209540},
+   {0.00002379765, 0.95574345340, 522.57741809380},
+};
+static const vsop87a_pruned_series_t _jupiter_z = {_jupiter_z_terms, {16, 6, 3, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _mars_x_terms[] = {
+   {1.51769936383, 6.20403346548, 3340.61242669980},
+   {0.19502945246, 3.14159265359, 0.00000000000},
+   {0.07070919655, 0.25870338558, 6681.22485339960},
+   {0.00494196914, 0.59669127768, 10021.83728009940},
+   {0.00040938237, 0.93473307419, 13362.44970679920},
+   {0.00021067199, 1.80435656154, 3337.08930835080},
+   {0.00021041626, 1.17895619474, 3344.13554504880},
+   {0.00011370375, 4.83265211109, 1059.38193018920},
+   {0.00013527976, 0.63010765169, 529.69096509460},
+   {0.00006774107, 3.61785048282, 3340.59517304760},
+   {0.00006774060, 5.64862211431, 3340.62968035200},
+   {0.00008226069, 1.86843519535, 2281.23049651060},
+   {0.00005469046, 1.13324429003, 2942.46342329160},
+   {0.00004817134, 1.85091045536, 3738.76143010800},
+   {0.00004937579, 4.43241440654, 5621.84292321040},
+   {0.00005276260, 2.33148083116, 6151.53388830500},
+   {0.00003636667, 6.11397592106, 796.29800681640},
+   {0.00003725823, 1.27280182943, 16703.06213349900},
+   {0.00003729746, 1.21398323637, 398.14900340820},
+   {0.00002368513, 2.96841895360, 2544.31441988340},
+   {0.00002397865, 0.63553674054, 3149.16416058820},
+   {0.00002274646, 2.35708328853, 3532.06069281140},
+   {0.00001977579, 2.14087826110, 6677.70173505060},
+   {0.00002229176, 1.69588962513, 3340.54511639700},
+   {0.00002229117, 1.28739323821, 3340.67973700260},
+   {0.00002182206, 1.69655112969, 6283.07584999140},
+   {0.00002241010, 4.82218655311, 8962.45534991020},
+   {0.00001677693, 3.14442612046, 5884.92684658320},
+   {0.00001630482, 0.24117974845, 4136.91043351620},
+   {0.00001958162, 1.51914544555, 6684.74797174860},
+   {0.00001378470, 2.18011900021, 1751.53953141600},
+   {0.00001289804, 4.70970778621, 1194.44701022460},
+   {0.00001468124, 1.87869730543, 3870.30339179440},
+   {0.00001290170, 0.43596325296, 2810.92146160520},
+   {0.00001572540, 4.84809921789, 1589.07289528380},
+   {0.00861441374, 3.14159265359, 0.00000000000},
+   {0.00552437949, 5.09565872891, 6681.22485339960},
+   {0.00077184977, 5.43315636209, 10021.83728009940},
+   {0.00020467294, 5.57051812369, 3340.61242669980},
+   {0.00009589581, 5.77107234791, 13362.44970679920},
+   {0.00002620610, 6.22441295122, 3344.13554504880},
+   {0.00002620537, 3.04172154436, 3337.08930835080},
+   {0.00001163612, 6.10909257097, 16703.06213349900},
+   {0.00056323939, 0.00000000000, 0.00000000000},
+   {0.00022122528, 3.54372113272, 6681.22485339960},
+   {0.00006091409, 3.93272649649, 10021.83728009940},
+   {0.00001451998, 3.64655666460, 3340.61242669980},
+   {0.00001130613, 4.28827023222, 13362.44970679920},
+};
+static const vsop87a_pruned_series_t _mars_x = {_mars_x_terms, {35, 8, 5, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _mars_y_terms[] = {
+   {1.51558976277, 4.63212206588, 3340.61242669980},
+   {0.07064550239, 4.97051892902, 6681.22485339960},
+   {0.08655481102, 0.00000000000, 0.00000000000},
+   {0.00493872848, 5.30877806694, 10021.83728009940},
+   {0.00040917422, 5.64698263703, 13362.44970679920},
+   {0.00021036784, 0.23240270955, 3337.08930835080},
+   {0.00021012921, 5.89022773653, 3344.13554504880},
+   {0.00011370034, 3.26131408801, 1059.38193018920},
+   {0.00013324177, 5.34259389724, 529.69096509460},
+   {0.00006764653, 4.07671230062, 3340.62968035200},
+   {0.00006764700, 2.04594066912, 3340.59517304760},
+   {0.00008346220, 3.42464704002, 2281.23049651060},
+   {0.00005400042, 5.81507793194, 2942.46342329160},
+   {0.00004809528, 0.27875310553, 3738.76143010800},
+   {0.00004849523, 2.85190987550, 5621.84292321040},
+   {0.00005263268, 0.75811089992, 6151.53388830500},
+   {0.00003609527, 4.53244488294, 796.29800681640},
+   {0.00003724293, 5.98516013322, 16703.06213349900},
+   {0.00003805073, 5.94234296399, 398.14900340820},
+   {0.00002394490, 5.34678816191, 3149.16416058820},
+   {0.00002251027, 0.76938193892, 3532.06069281140},
+   {0.00001975769, 0.56949816579, 6677.70173505060},
+   {0.00002226030, 5.99867316288, 3340.67973700260},
+   {0.00002226089, 0.12398424247, 3340.54511639700},
+   {0.00002177591, 0.12334436516, 6283.07584999140},
+   {0.00001690439, 1.58331163985, 5884.92684658320},
+   {0.00002234121, 3.24909113765, 8962.45534991020},
+   {0.00001628395, 4.95250906888, 4136.91043351620},
+   {0.00001956411, 6.23095843554, 6684.74797174860},
+   {0.00001697214, 0.81869636263, 2544.31441988340},
+   {0.00001385946, 3.73437191158, 1751.53953141600},
+   {0.00001439619, 5.19505958438, 2810.92146160520},
+   {0.00001281890, 3.13035275682, 1194.44701022460},
+   {0.00001469783, 0.30415060688, 3870.30339179440},
+   {0.00001571880, 3.27679498650, 1589.07289528380},
+   {0.00001575854, 2.78266835243, 5092.15195811580},
+   {0.01427324210, 3.14159265359, 0.00000000000},
+   {0.00551063753, 3.52128320402, 6681.22485339960},
+   {0.00077091913, 3.86082685753, 10021.83728009940},
+   {0.00037310491, 1.16016958445, 3340.61242669980},
+   {0.00009582122, 4.19942354479, 13362.44970679920},
+   {0.00002617695, 1.47284555520, 3337.08930835080},
+   {0.00002611572, 4.65030772498, 3344.13554504880},
+   {0.00001162955, 4.53778503576, 16703.06213349900},
+   {0.00035396765, 3.14159265359, 0.00000000000},
+   {0.00021950759, 1.96291594946, 6681.22485339960},
+   {0.00006075990, 2.35864321001, 10021.83728009940},
+   {0.00002571425, 5.64795745327, 3340.61242669980},
+   {0.00001129099, 2.71576248963, 13362.44970679920},
+   {0.00001448778, 0.00000000000, 0.00000000000},
+};
+static const vsop87a_pruned_series_t _mars_y = {_mars_y_terms, {36, 8, 5, 1, 0, 0}};
+
+static const vsop87a_pruned_term_t _mars_z_terms[] = {
+   {0.04901207220, 3.76712324286, 3340.61242669980},
+   {0.00660669541, 0.00000000000, 0.00000000000},
+   {0.00228333904, 4.10544022266, 6681.22485339960},
+   {0.00015958402, 4.44367058261, 10021.83728009940},
+   {0.00001321976, 4.78186604114, 13362.44970679920},
+   {0.00331842958, 6.05027773492, 3340.61242669980},
+   {0.00047930411, 3.14159265359, 0.00000000000},
+   {0.00009896501, 1.61155844715, 6681.22485339960},
+   {0.00001700147, 2.63703242065, 10021.83728009940},
+   {0.00013705360, 1.04212852598, 3340.61242669980},
+   {0.00005931596, 3.14159265359, 0.00000000000},
+};
+static const vsop87a_pruned_series_t _mars_z = {_mars_z_terms, {5, 4, 2, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _mercury_x_terms[] = {
+   {0.37546291728, 4.39651506942, 26087.90314157420},
+   {0.03825746672, 1.16485604339, 52175.80628314840},
+   {0.02625615963, 3.14159265359, 0.00000000000},
+   {0.00584261333, 4.21599394757, 78263.70942472259},
+   {0.00105716695, 0.98379033182, 104351.61256629678},
+   {0.00021011730, 4.03469353923, 130439.51570787099},
+   {0.00004433373, 0.80236674527, 156527.41884944518},
+   {0.00318848034, 0.00000000000, 0.00000000000},
+   {0.00105289019, 5.91600475006, 52175.80628314840},
+   {0.00032316001, 2.68247273347, 78263.70942472259},
+   {0.00011992889, 5.81575112963, 26087.90314157420},
+   {0.00008783200, 5.73285747425, 104351.61256629678},
+   {0.00002329042, 2.50023793407, 130439.51570787099},
+   {0.00001484185, 4.35401210269, 52175.80628314840},
+   {0.00001214995, 0.00000000000, 0.00000000000},
+};
+static const vsop87a_pruned_series_t _mercury_x = {_mercury_x_terms, {7, 6, 2, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _mercury_y_terms[] = {
+   {0.37953642888, 2.83780617820, 26087.90314157420},
+   {0.11626131831, 3.14159265359, 0.00000000000},
+   {0.03854668215, 5.88780608966, 52175.80628314840},
+   {0.00587711268, 2.65498896201, 78263.70942472259},
+   {0.00106235493, 5.70550616735, 104351.61256629678},
+   {0.00021100828, 2.47291315849, 130439.51570787099},
+   {0.00004450056, 5.52354907071, 156527.41884944518},
+   {0.00107803852, 4.34964793883, 52175.80628314840},
+   {0.00080651544, 3.14159265359, 0.00000000000},
+   {0.00032715354, 1.11763734425, 78263.70942472259},
+   {0.00008858158, 4.16852401867, 104351.61256629678},
+   {0.00011914709, 1.22139986340, 26087.90314157420},
+   {0.00002344469, 0.93615372641, 130439.51570787099},
+   {0.00004612157, 0.00000000000, 0.00000000000},
+   {0.00001575670, 2.81172733349, 52175.80628314840},
+};
+static const vsop87a_pruned_series_t _mercury_y = {_mercury_y_terms, {7, 6, 2, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _mercury_z_terms[] = {
+   {0.04607665326, 1.99295081967, 26087.90314157420},
+   {0.00708734365, 3.14159265359, 0.00000000000},
+   {0.00469171617, 5.04215742764, 52175.80628314840},
+   {0.00071626395, 1.80894256071, 78263.70942472259},
+   {0.00012957446, 4.85922032010, 104351.61256629678},
+   {0.00002575002, 1.62646731545, 130439.51570787099},
+   {0.00108722177, 3.91134750825, 26087.90314157420},
+   {0.00057826621, 3.14159265359, 0.00000000000},
+   {0.00004297352, 2.56373047177, 52175.80628314840},
+   {0.00002435833, 0.05112640506, 78263.70942472259},
+   {0.00001053118, 5.37979214357, 26087.90314157420},
+   {0.00001185024, 0.00000000000, 0.00000000000},
+};
+static const vsop87a_pruned_series_t _mercury_z = {_mercury_z_terms, {6, 4, 2, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _neptune_x_terms[] = {
+   {30.05890004476, 5.31211340029, 38.13303563780},
+   {0.27080164222, 3.14159265359, 0.00000000000},
+   {0.13505661755, 3.50078975634, 76.26607127560},
+   {0.15726094556, 0.11319072675, 36.64856292950},
+   {0.14935120126, 1.08499403018, 39.61750834610},
+   {0.02597313814, 1.99590301412, 1.48447270830},
+   {0.01074040708, 5.38502938672, 74.78159856730},
+   {0.00823793287, 1.43221581862, 35.16409022120},
+   {0.00817588813, 0.78180174031, 2.96894541660},
+   {0.00565534918, 5.98964907613, 41.10198105440},
+   {0.00495719107, 0.59948143567, 529.69096509460},
+   {0.00307525907, 0.40023311011, 73.29712585900},
+   {0.00272253551, 0.87443494387, 213.29909543800},
+   {0.00135887219, 5.54676577816, 77.75054398390},
+   {0.00090965704, 1.68910246115, 114.39910691340},
+   {0.00069040539, 5.83469123520, 4.45341812490},
+   {0.00060813556, 2.62589958380, 33.67961751290},
+   {0.00054690827, 1.55799996661, 71.81265315070},
+   {0.00028889260, 4.78966826027, 42.58645376270},
+   {0.00255840261, 2.01935686795, 36.64856292950},
+   {0.00243125299, 5.46214902873, 39.61750834610},
+   {0.00118398168, 2.88251845061, 76.26607127560},
+   {0.00037965449, 3.14159265359, 0.00000000000},
+   {0.00021924705, 3.20156164152, 35.16409022120},
+   {0.00017459808, 4.26349398817, 41.10198105440},
+};
+static const vsop87a_pruned_series_t _neptune_x = {_neptune_x_terms, {19, 6, 0, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _neptune_y_terms[] = {
+   {30.06056351665, 3.74086294714, 38.13303563780},
+   {0.30205857683, 3.14159265359, 0.00000000000},
+   {0.13506391797, 1.92953034883, 76.26607127560},
+   {0.15706589373, 4.82539970129, 36.64856292950},
+   {0.14936165806, 5.79694900665, 39.61750834610},
+   {0.02584250749, 0.42549700754, 1.48447270830},
+   {0.01073739772, 3.81371728533, 74.78159856730},
+   {0.00815187583, 5.49429775826, 2.96894541660},
+   {0.00582199295, 6.19633718936, 35.16409022120},
+   {0.00565576412, 4.41843009015, 41.10198105440},
+   {0.00495581047, 5.31205825784, 529.69096509460},
+   {0.00304525203, 5.11048113661, 73.29712585900},
+   {0.00272640298, 5.58603690785, 213.29909543800},
+   {0.00135897385, 3.97553750964, 77.75054398390},
+   {0.00090970871, 0.11783619888, 114.39910691340},
+   {0.00068790261, 4.26391997151, 4.45341812490},
+   {0.00028893355, 3.21848975032, 42.58645376270},
+   {0.00020081559, 1.19787916085, 33.67961751290},
+   {0.00352947493, 3.14159265359, 0.00000000000},
+   {0.00256125493, 0.44757496817, 36.64856292950},
+   {0.00243147725, 3.89099798696, 39.61750834610},
+   {0.00118427205, 1.31128027037, 76.26607127560},
+   {0.00021936702, 1.63124087591, 35.16409022120},
+   {0.00017462332, 2.69229902966, 41.10198105440},
+};
+static const vsop87a_pruned_series_t _neptune_y = {_neptune_y_terms, {18, 6, 0, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _neptune_z_terms[] = {
+   {0.92866054405, 1.44103930278, 38.13303563780},
+   {0.01245978462, 0.00000000000, 0.00000000000},
+   {0.00474333567, 2.52218774238, 36.64856292950},
+   {0.00451987936, 3.50949720541, 39.61750834610},
+   {0.00417558068, 5.91310695421, 76.26607127560},
+   {0.00084104329, 4.38928900096, 1.48447270830},
+   {0.00032704958, 1.52048692001, 74.78159856730},
+   {0.00030873335, 3.29017611456, 35.16409022120},
+   {0.00025812584, 3.19303128782, 2.96894541660},
+   {0.00016865319, 2.13251104425, 41.10198105440},
+   {0.00154885971, 2.14239039664, 38.13303563780},
+};
+static const vsop87a_pruned_series_t _neptune_z = {_neptune_z_terms, {10, 1, 0, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _saturn_x_terms[] = {
+   {9.51638335797, 0.87441380794, 213.29909543800},
+   {0.26412374238, 0.12390892620, 426.59819087600},
+   {0.06760430339, 4.16767145778, 206.18554843720},
+   {0.06624260115, 0.75094737780, 220.41264243880},
+   {0.04244797817, 0.00000000000, 0.00000000000},
+   {0.02336340488, 2.02227784673, 7.11354700080},
+   {0.01255372247, 2.17338917731, 110.20632121940},
+   {0.01115684467, 3.15686878377, 419.48464387520},
+   {0.01097683232, 5.65753337256, 639.89728631400},
+   {0.00716328481, 2.71149993708, 316.39186965660},
+   {0.00509313365, 4.95865624780, 103.09277421860},
+   {0.00433994439, 0.72012820974, 529.69096509460},
+   {0.00372894461, 0.00137195497, 433.71173787680},
+   {0.00097843523, 1.01485750417, 323.50541665740},
+   {0.00080600536, 5.62103979796, 11.04570026390},
+   {0.00083782316, 0.62038893702, 227.52618943960},
+   {0.00074150224, 2.38206066655, 632.78373931320},
+   {0.00070219382, 0.88789752415, 209.36694217490},
+   {0.00068855792, 4.01788097627, 217.23124870110},
+   {0.00065620467, 2.69728593339, 202.25339517410},
+   {0.00058297911, 2.16155251399, 224.34479570190},
+   {0.00054022837, 4.90928184374, 853.19638175200},
+   {0.00045550446, 1.88235037830, 14.22709400160},
+   {0.00038345667, 4.39815501478, 199.07200143640},
+   {0.00044551703, 5.60763553535, 63.73589830340},
+   {0.00025165185, 0.37800582257, 216.48048917570},
+   {0.00024554499, 4.53150598095, 210.11770170030},
+   {0.00024673219, 5.90891573850, 522.57741809380},
+   {0.00024677050, 5.60389382420, 415.55249061210},
+   {0.00025491374, 1.63922423181, 117.31986822020},
+   {0.00031253049, 4.62976601833, 735.87651353180},
+   {0.00023372467, 5.53491987276, 647.01083331480},
+   {0.00023355468, 0.18791490124, 149.56319713460},
+   {0.00024805815, 5.50327676733, 74.78159856730},
+   {0.00014731703, 4.67981909838, 277.03499374140},
+   {0.00012427525, 1.02995545746, 1059.38193018920},
+   {0.00009943329, 0.84628387596, 3.93215326310},
+   {0.00012393514, 4.19747622821, 490.33408917940},
+   {0.00012026472, 5.66372282839, 351.81659230870},
+   {0.00008222014, 2.47875301104, 742.99006053260},
+   {0.00009087093, 4.33505326762, 1052.26838318840},
+   {0.00006717741, 5.51897460997, 838.96928775040},
+   {0.00006232999, 2.45837758015, 846.08283475120},
+   {0.00007161671, 2.18152751738, 95.97922721780},
+   {0.00006321101, 0.83915408770, 309.27832265580},
+   {0.00006074958, 6.15905897331, 440.82528487760},
+   {0.00005343894, 3.60046273598, 412.37109687440},
+   {0.00004860582, 0.26461045175, 536.80451209540},
+   {0.00005775802, 5.30717695229, 38.13303563780},
+   {0.00005194178, 4.54584467686, 210.85141488320},
+   {0.00005152474, 0.34669517150, 215.74677599280},
+   {0.00004111695, 5.96153153046, 137.03302416240},
+   {0.07575103962, 0.00000000000, 0.00000000000},
+   {0.03085041716, 4.27565749128, 426.59819087600},
+   {0.02714918399, 5.85229412397, 206.18554843720},
+   {0.02643100909, 5.33291950584, 220.41264243880},
+   {0.00627104520, 0.32898307969, 7.11354700080},
+   {0.00256560953, 3.52478934343, 639.89728631400},
+   {0.00312356512, 4.83001724941, 419.48464387520},
+   {0.00189196274, 4.48642453552, 433.71173787680},
+   {0.00203646570, 1.10998681782, 213.29909543800},
+   {0.00119531145, 1.14735096078, 110.20632121940},
+   {0.00066764238, 3.72346596928, 316.39186965660},
+   {0.00066901225, 5.20257500380, 227.52618943960},
+   {0.00031000840, 6.06067919437, 199.07200143640},
+   {0.00030418100, 0.18746903351, 14.22709400160},
+   {0.00022275210, 6.19530878014, 103.09277421860},
+   {0.00018939377, 2.77618306725, 853.19638175200},
+   {0.00018093009, 5.09162723865, 209.36694217490},
+   {0.00017777854, 6.10381593351, 217.23124870110},
+   {0.00016296201, 4.86945681437, 216.48048917570},
+   {0.00017120250, 4.59611664188, 632.78373931320},
+   {0.00015894491, 0.03653502304, 210.11770170030},
+   {0.00016192653, 5.60798014450, 323.50541665740},
+   {0.00014466010, 3.67449380090, 647.01083331480},
+   {0.00011061528, 0.03163071461, 117.31986822020},
+   {0.00009873183, 5.20065307357, 202.25339517410},
+   {0.00008707608, 6.03511731637, 224.34479570190},
+   {0.00005499109, 4.40350603415, 440.82528487760},
+   {0.00005512222, 2.60556642348, 11.04570026390},
+   {0.00004008257, 1.48942966807, 522.57741809380},
+   {0.00560746334, 1.26401632282, 206.18554843720},
+   {0.00545834518, 3.62343709657, 220.41264243880},
+   {0.00443342186, 3.14159265359, 0.00000000000},
+   {0.00336109713, 2.42547432460, 213.29909543800},
+   {0.00224302269, 2.49151203519, 426.59819087600},
+   {0.00087170924, 4.89048951691, 7.11354700080},
+   {0.00050028094, 2.70119046081, 433.71173787680},
+   {0.00045122590, 0.36735068943, 419.48464387520},
+   {0.00032847824, 1.59210153669, 639.89728631400},
+   {0.00027153555, 3.49804002218, 227.52618943960},
+   {0.00012676167, 1.45465729530, 199.07200143640},
+   {0.00010330738, 4.76949531290, 14.22709400160},
+   {0.00007249149, 5.70264553247, 110.20632121940},
+   {0.00004653214, 1.83710048213, 647.01083331480},
+   {0.00004923585, 3.08463039042, 216.48048917570},
+   {0.00004777358, 1.81695155349, 210.11770170030},
+   {0.00004166633, 5.32887874226, 316.39186965660},
+   {0.00077115952, 2.97714385362, 206.18554843720},
+   {0.00075340436, 1.89208005248, 220.41264243880},
+   {0.00018450895, 3.14159265359, 0.00000000000},
+   {0.00010527244, 0.66368256891, 426.59819087600},
+   {0.00008994946, 0.91696559755, 433.71173787680},
+   {0.00007403594, 1.78627385870, 227.52618943960},
+   {0.00008045160, 3.12864412887, 7.11354700080},
+   {0.00004505149, 2.24531319187, 419.48464387520},
+   {0.00007959921, 4.70523623364, 206.18554843720},
+   {0.00007836652, 0.13981693631, 220.41264243880},
+};
+static const vsop87a_pruned_series_t _saturn_x = {_saturn_x_terms, {52, 29, 17, 8, 2, 0}};
+
+static const vsop87a_pruned_term_t _saturn_y_terms[] = {
+   {9.52986882699, 5.58600556665, 213.29909543800},
+   {0.79387988806, 3.14159265359, 0.00000000000},
+   {0.26441781302, 4.83528061849, 426.59819087600},
+   {0.06916653915, 2.55279408706, 206.18554843720},
+   {0.06633570703, 5.46258848288, 220.41264243880},
+   {0.02345609742, 0.44652132519, 7.11354700080},
+   {0.01183874652, 1.34638298371, 419.48464387520},
+   {0.01245790434, 0.60367177975, 110.20632121940},
+   {0.01098751131, 4.08608782813, 639.89728631400},
+   {0.00700849336, 1.13611298025, 316.39186965660},
+   {0.00434466176, 5.42474696262, 529.69096509460},
+   {0.00373327342, 4.71308726958, 433.71173787680},
+   {0.00335162363, 0.66422253983, 103.09277421860},
+   {0.00097837745, 5.72844290173, 323.50541665740},
+   {0.00080571808, 4.05295449910, 11.04570026390},
+   {0.00083899691, 5.33204070267, 227.52618943960},
+   {0.00070158491, 5.59777963629, 209.36694217490},
+   {0.00065937657, 1.25969608208, 202.25339517410},
+   {0.00070957225, 0.88888207567, 632.78373931320},
+   {0.00068985859, 2.44460312617, 217.23124870110},
+   {0.00058382264, 0.58978766922, 224.34479570190},
+   {0.00054049836, 3.33757904879, 853.19638175200},
+   {0.00045790930, 0.30331527632, 14.22709400160},
+   {0.00041976402, 2.62591355948, 199.07200143640},
+   {0.00044697175, 0.90661238256, 63.73589830340},
+   {0.00025199575, 5.08963506006, 216.48048917570},
+   {0.00024640836, 2.95445247282, 210.11770170030},
+   {0.00024835151, 4.02630190571, 415.55249061210},
+   {0.00025545907, 0.06626229252, 117.31986822020},
+   {0.00029666833, 6.09910638345, 735.87651353180},
+   {0.00023396742, 3.96337393635, 647.01083331480},
+   {0.00023380691, 4.90051072276, 149.56319713460},
+   {0.00020272215, 2.34319548198, 309.27832265580},
+   {0.00020099552, 0.98365186365, 522.57741809380},
+   {0.00024827950, 3.92681428900, 74.78159856730},
+   {0.00015383927, 3.10227822627, 277.03499374140},
+   {0.00011629210, 5.74108283772, 1059.38193018920},
+   {0.00012422966, 2.62557865743, 490.33408917940},
+   {0.00012048048, 4.09265980116, 351.81659230870},
+   {0.00009551796, 3.48788042094, 95.97922721780},
+   {0.00007670379, 1.16594276164, 742.99006053260},
+   {0.00006919946, 1.17090063883, 412.37109687440},
+   {0.00009034877, 5.86816144198, 1052.26838318840},
+   {0.00006536751, 0.84246459392, 838.96928775040},
+   {0.00006082097, 4.58758280729, 440.82528487760},
+   {0.00005027211, 0.93213690546, 846.08283475120},
+   {0.00004838146, 4.98563812475, 536.80451209540},
+   {0.00005768897, 3.73776690402, 38.13303563780},
+   {0.00005201849, 2.97482802430, 210.85141488320},
+   {0.00005156578, 5.05796998564, 215.74677599280},
+   {0.00003881104, 3.38026646963, 3.93215326310},
+   {0.00004042463, 1.24471211016, 137.03302416240},
+   {0.05373889135, 0.00000000000, 0.00000000000},
+   {0.03090575152, 2.70346890906, 426.59819087600},
+   {0.02741594312, 4.26667636015, 206.18554843720},
+   {0.02647489677, 3.76132298889, 220.41264243880},
+   {0.00631520527, 5.03245505280, 7.11354700080},
+   {0.00256799701, 1.95351819758, 639.89728631400},
+   {0.00312271930, 3.25850205023, 419.48464387520},
+   {0.00189433319, 2.91501840819, 433.71173787680},
+   {0.00164133553, 5.29239290066, 213.29909543800},
+   {0.00116791227, 5.89146675760, 110.20632121940},
+   {0.00067210919, 2.17042636344, 316.39186965660},
+   {0.00067003292, 3.63101075514, 227.52618943960},
+   {0.00033002406, 4.35527405801, 199.07200143640},
+   {0.00030628998, 4.88861760772, 14.22709400160},
+   {0.00022234714, 4.62212779231, 103.09277421860},
+   {0.00018945004, 1.20412493845, 853.19638175200},
+   {0.00018079959, 3.51566153251, 209.36694217490},
+   {0.00017791543, 4.53214140649, 217.23124870110},
+   {0.00016320701, 3.29784030970, 216.48048917570},
+   {0.00015944258, 4.74503265169, 210.11770170030},
+   {0.00016717122, 3.00270792752, 632.78373931320},
+   {0.00016149947, 4.04186432517, 323.50541665740},
+   {0.00014481431, 2.10298298650, 647.01083331480},
+   {0.00011084040, 4.74073871754, 117.31986822020},
+   {0.00009905491, 3.60258599375, 202.25339517410},
+   {0.00008726051, 4.46341342877, 224.34479570190},
+   {0.00006585597, 4.07326320487, 309.27832265580},
+   {0.00005505978, 2.83207390240, 440.82528487760},
+   {0.00005424041, 1.03197684410, 11.04570026390},
+   {0.00004178266, 3.01038512076, 412.37109687440},
+   {0.00004049905, 5.17488767645, 95.97922721780},
+   {0.00563706537, 5.97115878242, 206.18554843720},
+   {0.00547012116, 2.05154973426, 220.41264243880},
+   {0.00458518613, 0.00000000000, 0.00000000000},
+   {0.00362294249, 0.89540100509, 213.29909543800},
+   {0.00225521642, 0.91699821445, 426.59819087600},
+   {0.00088390611, 3.30289449917, 7.11354700080},
+   {0.00050101314, 1.12976163835, 433.71173787680},
+   {0.00045516403, 5.07669466539, 419.48464387520},
+   {0.00032896745, 0.02089057938, 639.89728631400},
+   {0.00027199743, 1.92638417640, 227.52618943960},
+   {0.00013251505, 6.07693099404, 199.07200143640},
+   {0.00010425984, 3.18246869028, 14.22709400160},
+   {0.00006673556, 4.24747633887, 110.20632121940},
+   {0.00004658591, 0.26557833758, 647.01083331480},
+   {0.00004934094, 1.51301179516, 216.48048917570},
+   {0.00004789554, 0.24337901916, 210.11770170030},
+   {0.00004167268, 3.73203671391, 316.39186965660},
+   {0.00077376615, 1.40391048961, 206.18554843720},
+   {0.00075564351, 0.31962896379, 220.41264243880},
+   {0.00022843837, 3.14159265359, 0.00000000000},
+   {0.00010672263, 5.36495663820, 426.59819087600},
+   {0.00009010175, 5.62865146645, 433.71173787680},
+   {0.00007418018, 0.21442310101, 227.52618943960},
+   {0.00008298723, 1.52262563519, 7.11354700080},
+   {0.00004507061, 0.67248969480, 419.48464387520},
+   {0.00007978886, 3.13229268011, 206.18554843720},
+   {0.00007868379, 4.84940260021, 220.41264243880},
+};
+static const vsop87a_pruned_series_t _saturn_y = {_saturn_y_terms, {52, 31, 17, 8, 2, 0}};
+
+static const vsop87a_pruned_term_t _saturn_z_terms[] = {
+   {0.41356950940, 3.60234142982, 213.29909543800},
+   {0.01148283576, 2.85128367469, 426.59819087600},
+   {0.01214249867, 0.00000000000, 0.00000000000},
+   {0.00329280791, 0.57121407104, 206.18554843720},
+   {0.00286934048, 3.48073526693, 220.41264243880},
+   {0.00099076584, 4.73369511264, 7.11354700080},
+   {0.00057361820, 4.92611225093, 110.20632121940},
+   {0.00047738127, 2.10039779728, 639.89728631400},
+   {0.00043458803, 5.84904978051, 419.48464387520},
+   {0.00034565673, 5.42614229590, 316.39186965660},
+   {0.00016185391, 2.72987173675, 433.71173787680},
+   {0.00009001270, 1.38140102737, 103.09277421860},
+   {0.00011433574, 3.71662021072, 529.69096509460},
+   {0.00005398708, 5.13204892363, 202.25339517410},
+   {0.00003902467, 3.71499738796, 323.50541665740},
+   {0.01906503283, 4.94544746116, 213.29909543800},
+   {0.00528301265, 3.14159265359, 0.00000000000},
+   {0.00130262284, 2.26140980879, 206.18554843720},
+   {0.00101466332, 1.79095829545, 220.41264243880},
+   {0.00085947578, 0.51612788497, 426.59819087600},
+   {0.00022257446, 3.07684015656, 7.11354700080},
+   {0.00016179946, 1.19987517506, 419.48464387520},
+   {0.00009117402, 6.17205626814, 639.89728631400},
+   {0.00007470703, 0.93135621171, 433.71173787680},
+   {0.00004966668, 0.19044864213, 316.39186965660},
+   {0.00131275155, 0.08868998101, 213.29909543800},
+   {0.00030147649, 3.91396203887, 206.18554843720},
+   {0.00019322173, 0.09228748624, 220.41264243880},
+   {0.00006868926, 5.48420255395, 426.59819087600},
+   {0.00004559419, 1.70646871501, 213.29909543800},
+   {0.00004779074, 5.57723756330, 206.18554843720},
+   {0.00003965402, 0.00000000000, 0.00000000000},
+};
+static const vsop87a_pruned_series_t _saturn_z = {_saturn_z_terms, {15, 10, 4, 3, 0, 0}};
+
+static const vsop87a_pruned_term_t _uranus_x_terms[] = {
+   {19.17370730359, 5.48133416489, 74.78159856730},
+   {1.32272523872, 0.00000000000, 0.00000000000},
+   {0.44402496796, 1.65967519586, 149.56319713460},
+   {0.14668209481, 3.42395862804, 73.29712585900},
+   {0.14130269479, 4.39572927934, 76.26607127560},
+   {0.06201106178, 5.14043574125, 1.48447270830},
+   {0.01542951343, 4.12121838072, 224.34479570190},
+   {0.01444216660, 2.65117115201, 148.07872442630},
+   {0.00944995563, 1.65869338757, 11.04570026390},
+   {0.00657524815, 0.57595170636, 151.04766984290},
+   {0.00621624676, 3.05882246638, 77.75054398390},
+   {0.00585182542, 4.79934779678, 71.81265315070},
+   {0.00634000270, 4.09556589724, 63.73589830340},
+   {0.00547699056, 3.63127725056, 85.82729883120},
+   {0.00458219984, 3.90788284112, 2.96894541660},
+   {0.00496087649, 0.59947400861, 529.69096509460},
+   {0.00383625535, 6.18762010576, 138.51749687070},
+   {0.00267938156, 0.96885660137, 213.29909543800},
+   {0.00215368005, 5.30877641428, 38.13303563780},
+   {0.00145505389, 2.31759757085, 70.84944530420},
+   {0.00135340032, 5.51062460816, 78.71375183040},
+   {0.00119593859, 4.10138544267, 39.61750834610},
+   {0.00125105686, 2.51455273063, 111.43016149680},
+   {0.00111260244, 5.12252784325, 222.86032299360},
+   {0.00104619827, 3.90538916334, 146.59425171800},
+   {0.00110125387, 4.45473528724, 35.16409022120},
+   {0.00063584588, 0.29966233158, 299.12639426920},
+   {0.00053904041, 3.92590422507, 3.93215326310},
+   {0.00065066905, 3.73008452906, 109.94568878850},
+   {0.00039181662, 2.68841280769, 4.45341812490},
+   {0.00034341683, 3.03781661928, 225.82926841020},
+   {0.00033134636, 2.54201591218, 65.22037101170},
+   {0.00034555652, 1.84699329257, 79.23501669220},
+   {0.00033867050, 5.98418436103, 70.32818044240},
+   {0.00028371614, 2.58026657123, 127.47179660680},
+   {0.00035943348, 4.08754543016, 202.25339517410},
+   {0.00025208833, 5.30272144657, 9.56122755560},
+   {0.00023467802, 4.09729860322, 145.63104387150},
+   {0.00022963939, 5.51475073655, 84.34282612290},
+   {0.00031823951, 5.53948583244, 152.53214255120},
+   {0.00028384953, 6.01785430306, 184.72728735580},
+   {0.00026657176, 6.11027939727, 160.60889739850},
+   {0.00019676762, 5.53431398332, 74.66972398270},
+   {0.00019653873, 2.28660913421, 74.89347315190},
+   {0.00019954280, 0.57450958037, 12.53017297220},
+   {0.00018565067, 0.62225019017, 52.69019803950},
+   {0.00020084756, 4.47297488471, 22.09140052780},
+   {0.00019926329, 1.39878194708, 112.91463420510},
+   {0.00018575632, 5.70217475790, 33.67961751290},
+   {0.00016587870, 4.86920309163, 108.46121608020},
+   {0.00015171194, 2.88415453399, 41.10198105440},
+   {0.00011245800, 6.11597016146, 71.60020482960},
+   {0.00013948521, 6.27545694160, 221.37585028530},
+   {0.00010798350, 1.70031857078, 77.96299230500},
+   {0.00013593955, 2.55407820633, 87.31177153950},
+   {0.00011997848, 0.94875212305, 1059.38193018920},
+   {0.00012884351, 5.08737999470, 145.10977900970},
+   {0.00012394786, 6.21892878850, 72.33391801250},
+   {0.00012253318, 0.19452856525, 36.64856292950},
+   {0.00011538642, 1.77241794539, 77.22927912210},
+   {0.00008738409, 4.96956808452, 186.21176006410},
+   {0.00739730021, 6.01067825116, 149.56319713460},
+   {0.00526878306, 3.14159265359, 0.00000000000},
+   {0.00239840801, 5.33657762707, 73.29712585900},
+   {0.00229676787, 2.48204455775, 76.26607127560},
+   {0.00111045158, 5.57157235960, 11.04570026390},
+   {0.00096352822, 0.35070389084, 63.73589830340},
+   {0.00081511870, 1.21058618039, 85.82729883120},
+   {0.00045687564, 2.29216583843, 138.51749687070},
+   {0.00051382501, 2.18935125260, 224.34479570190},
+   {0.00038844330, 0.30724575951, 70.84944530420},
+   {0.00036158493, 1.23634798757, 78.71375183040},
+   {0.00032333094, 5.06666556704, 74.78159856730},
+   {0.00021685656, 4.93710968392, 151.04766984290},
+   {0.00019441970, 1.30617490304, 77.75054398390},
+   {0.00017376241, 0.24607221230, 71.81265315070},
+   {0.00015211071, 5.53141633140, 3.93215326310},
+   {0.00016015732, 3.83700026619, 74.78159856730},
+   {0.00010915299, 3.02987776270, 149.56319713460},
+};
+static const vsop87a_pruned_series_t _uranus_x = {_uranus_x_terms, {61, 16, 2, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _uranus_y_terms[] = {
+   {19.16518231584, 3.91045677002, 74.78159856730},
+   {0.44390465203, 0.08884111329, 149.56319713460},
+   {0.16256125476, 3.14159265359, 0.00000000000},
+   {0.14755940186, 1.85423280679, 73.29712585900},
+   {0.14123958128, 2.82486076549, 76.26607127560},
+   {0.06250078231, 3.56960243857, 1.48447270830},
+   {0.01542668264, 2.55040539213, 224.34479570190},
+   {0.01442356575, 1.08004542712, 148.07872442630},
+   {0.00938975501, 0.09275714761, 11.04570026390},
+   {0.00650331846, 2.76142680222, 63.73589830340},
+   {0.00657343120, 5.28830704469, 151.04766984290},
+   {0.00621326770, 1.48795811387, 77.75054398390},
+   {0.00541961958, 3.24476486661, 71.81265315070},
+   {0.00547472694, 2.06037924573, 85.82729883120},
+   {0.00459589120, 2.33745536070, 2.96894541660},
+   {0.00495936105, 5.31205753740, 529.69096509460},
+   {0.00387922853, 4.62026923885, 138.51749687070},
+   {0.00268363417, 5.68085299020, 213.29909543800},
+   {0.00216239629, 3.73800767580, 38.13303563780},
+   {0.00144032475, 0.75015700920, 70.84944530420},
+   {0.00135290820, 3.93970260616, 78.71375183040},
+   {0.00119670613, 2.53058783780, 39.61750834610},
+   {0.00124868545, 0.94315917319, 111.43016149680},
+   {0.00111204860, 3.55163219419, 222.86032299360},
+   {0.00104507929, 2.33345675603, 146.59425171800},
+   {0.00108584454, 6.02234848388, 35.16409022120},
+   {0.00063573747, 5.01204967920, 299.12639426920},
+   {0.00053289771, 2.38437587876, 3.93215326310},
+   {0.00063774261, 2.15607602904, 109.94568878850},
+   {0.00039218598, 1.11841109252, 4.45341812490},
+   {0.00034205426, 0.92405922576, 65.22037101170},
+   {0.00034334377, 1.46696169843, 225.82926841020},
+   {0.00034538316, 0.27613780697, 79.23501669220},
+   {0.00039256771, 5.75956853703, 202.25339517410},
+   {0.00026157754, 3.74097610798, 9.56122755560},
+   {0.00023427328, 2.52740125551, 145.63104387150},
+   {0.00022933138, 3.94455540350, 84.34282612290},
+   {0.00031816303, 3.96860170484, 152.53214255120},
+   {0.00025237176, 4.45141413666, 70.32818044240},
+   {0.00028372491, 4.44714627097, 184.72728735580},
+   {0.00026652859, 4.53944395347, 160.60889739850},
+   {0.00019666208, 3.96350065335, 74.66972398270},
+   {0.00019643845, 0.71577796385, 74.89347315190},
+   {0.00019838981, 5.29113397354, 12.53017297220},
+   {0.00021523908, 4.93565132068, 36.64856292950},
+   {0.00015537967, 1.87863275460, 52.69019803950},
+   {0.00020115100, 3.45473780762, 127.47179660680},
+   {0.00020051641, 2.90386352937, 22.09140052780},
+   {0.00019901477, 6.11075402434, 112.91463420510},
+   {0.00018126776, 0.98478853787, 33.67961751290},
+   {0.00015174962, 1.31314034959, 41.10198105440},
+   {0.00011239020, 4.54508334011, 71.60020482960},
+   {0.00013948849, 4.70474945682, 221.37585028530},
+   {0.00010819728, 0.12807029856, 77.96299230500},
+   {0.00013589665, 0.98313719930, 87.31177153950},
+   {0.00011996772, 5.66129275335, 1059.38193018920},
+   {0.00012407787, 4.64945783340, 72.33391801250},
+   {0.00011531140, 0.20190074645, 77.22927912210},
+   {0.00008736150, 3.39874828293, 186.21176006410},
+   {0.02157896385, 0.00000000000, 0.00000000000},
+   {0.00739227349, 4.43963890935, 149.56319713460},
+   {0.00238545685, 3.76882493145, 73.29712585900},
+   {0.00229396424, 0.91090183978, 76.26607127560},
+   {0.00110137111, 4.00844441616, 11.04570026390},
+   {0.00094979054, 5.07141537066, 63.73589830340},
+   {0.00081474163, 5.92275367106, 85.82729883120},
+   {0.00045457174, 0.73292241207, 138.51749687070},
+   {0.00051366974, 0.61844114994, 224.34479570190},
+   {0.00038296005, 5.01873578671, 70.84944530420},
+   {0.00036146116, 5.94859452787, 78.71375183040},
+   {0.00032420558, 4.32617271732, 74.78159856730},
+   {0.00021673269, 3.36607263522, 151.04766984290},
+   {0.00019425087, 6.01842187783, 77.75054398390},
+   {0.00017393206, 4.96098895488, 71.81265315070},
+   {0.00014991169, 3.97176856758, 3.93215326310},
+   {0.00034812647, 3.14159265359, 0.00000000000},
+   {0.00016589194, 2.29556740620, 74.78159856730},
+   {0.00010905147, 1.45737963668, 149.56319713460},
+};
+static const vsop87a_pruned_series_t _uranus_y = {_uranus_y_terms, {59, 16, 3, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _uranus_z_terms[] = {
+   {0.25878127698, 2.61861272578, 74.78159856730},
+   {0.01774318778, 3.14159265359, 0.00000000000},
+   {0.00599316131, 5.08119500585, 149.56319713460},
+   {0.00190281890, 1.61643841193, 76.26607127560},
+   {0.00190881685, 0.57869575952, 73.29712585900},
+   {0.00084626761, 2.26030150166, 1.48447270830},
+   {0.00030734257, 0.23571721555, 63.73589830340},
+   {0.00020842052, 1.26054208091, 224.34479570190},
+   {0.00019734273, 6.04314677688, 148.07872442630},
+   {0.00012537530, 5.17169051466, 11.04570026390},
+   {0.00014582864, 6.14852037212, 71.81265315070},
+   {0.00010407529, 3.65320417038, 213.29909543800},
+   {0.00011261541, 3.55973769686, 529.69096509460},
+   {0.00008855669, 4.03774505739, 151.04766984290},
+   {0.00655916626, 0.01271947660, 74.78159856730},
+   {0.00049648951, 0.00000000000, 0.00000000000},
+   {0.00023874178, 2.73870491220, 149.56319713460},
+   {0.00014697858, 1.75149165003, 74.78159856730},
+};
+static const vsop87a_pruned_series_t _uranus_z = {_uranus_z_terms, {14, 3, 1, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _venus_x_terms[] = {
+   {0.72211281391, 3.17575836361, 10213.28554621100},
+   {0.00486448018, 0.00000000000, 0.00000000000},
+   {0.00244500474, 4.05566613861, 20426.57109242200},
+   {0.00002800281, 0.33147492492, 2352.86615377180},
+   {0.00001949669, 4.23196016801, 1577.34354244780},
+   {0.00001241717, 4.93573787058, 30639.85663863300},
+   {0.00001162258, 2.87958246189, 18073.70493865020},
+   {0.00001046690, 1.75434920413, 6283.07584999140},
+   {0.00033862636, 3.14159265359, 0.00000000000},
+   {0.00017234992, 0.92721124604, 20426.57109242200},
+   {0.00006510416, 2.19289889733, 10213.28554621100},
+};
+static const vsop87a_pruned_series_t _venus_x = {_venus_x_terms, {8, 3, 0, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _venus_y_terms[] = {
+   {0.72324820731, 1.60573808356, 10213.28554621100},
+   {0.00549506273, 3.14159265359, 0.00000000000},
+   {0.00244884790, 2.48564954004, 20426.57109242200},
+   {0.00002789807, 5.04214523606, 2352.86615377180},
+   {0.00001933868, 5.80597990261, 1577.34354244780},
+   {0.00001243658, 3.36573697344, 30639.85663863300},
+   {0.00001164480, 1.30970620277, 18073.70493865020},
+   {0.00001041872, 0.18129136925, 6283.07584999140},
+   {0.00039231430, 0.00000000000, 0.00000000000},
+   {0.00017282326, 5.63824735900, 20426.57109242200},
+   {0.00005968075, 3.60854944086, 10213.28554621100},
+   {0.00002007155, 3.14159265359, 0.00000000000},
+};
+static const vsop87a_pruned_series_t _venus_y = {_venus_y_terms, {8, 3, 1, 0, 0, 0}};
+
+static const vsop87a_pruned_term_t _venus_z_terms[] = {
+   {0.04282990302, 0.26703856476, 10213.28554621100},
+   {0.00035588343, 3.14159265359, 0.00000000000},
+   {0.00014501879, 1.14696911390, 20426.57109242200},
+   {0.00208096402, 1.88967278742, 10213.28554621100},
+   {0.00001264989, 3.71037501321, 20426.57109242200},
+   {0.00001364144, 0.00000000000, 0.00000000000},
+   {0.00009148044, 3.34791005272, 10213.28554621100},
+};
+static const vsop87a_pruned_series_t _venus_z = {_venus_z_terms, {3, 3, 1, 0, 0, 0}};
+
+void vsop87a_pruned_getEarth(double t,double temp[]){
+   temp[0]=_vsop87a_pruned_eval(&_earth_x, t);
+   temp[1]=_vsop87a_pruned_eval(&_earth_y, t);
+   temp[2]=_vsop87a_pruned_eval(&_earth_z, t);
+}
+
+void vsop87a_pruned_getEmb(double t,double temp[]){
+   temp[0]=_vsop87a_pruned_eval(&_emb_x, t);
+   temp[1]=_vsop87a_pruned_eval(&_emb_y, t);
+   temp[2]=_vsop87a_pruned_eval(&_emb_z, t);
+}
+
+void vsop87a_pruned_getJupiter(double t,double temp[]){
+   temp[0]=_vsop87a_pruned_eval(&_jupiter_x, t);
+   temp[1]=_vsop87a_pruned_eval(&_jupiter_y, t);
+   temp[2]=_vsop87a_pruned_eval(&_jupiter_z, t);
+}
+
+void vsop87a_pruned_getMars(double t,double temp[]){
+   temp[0]=_vsop87a_pruned_eval(&_mars_x, t);
+   temp[1]=_vsop87a_pruned_eval(&_mars_y, t);
+   temp[2]=_vsop87a_pruned_eval(&_mars_z, t);
+}
+
+void vsop87a_pruned_getMercury(double t,double temp[]){
+   temp[0]=_vsop87a_pruned_eval(&_mercury_x, t);
+   temp[1]=_vsop87a_pruned_eval(&_mercury_y, t);
+   temp[2]=_vsop87a_pruned_eval(&_mercury_z, t);
+}
+
+void vsop87a_pruned_getNeptune(double t,double temp[]){
+   temp[0]=_vsop87a_pruned_eval(&_neptune_x, t);
+   temp[1]=_vsop87a_pruned_eval(&_neptune_y, t);
+   temp[2]=_vsop87a_pruned_eval(&_neptune_z, t);
+}
+
+void vsop87a_pruned_getSaturn(double t,double temp[]){
+   temp[0]=_vsop87a_pruned_eval(&_saturn_x, t);
+   temp[1]=_vsop87a_pruned_eval(&_saturn_y, t);
+   temp[2]=_vsop87a_pruned_eval(&_saturn_z, t);
+}
+
+void vsop87a_pruned_getUranus(double t,double temp[]){
+   temp[0]=_vsop87a_pruned_eval(&_uranus_x, t);
+   temp[1]=_vsop87a_pruned_eval(&_uranus_y, t);
+   temp[2]=_vsop87a_pruned_eval(&_uranus_z, t);
+}
+
+void vsop87a_pruned_getVenus(double t,double temp[]){
+   temp[0]=_vsop87a_pruned_eval(&_venus_x, t);
+   temp[1]=_vsop87a_pruned_eval(&_venus_y, t);
+   temp[2]=_vsop87a_pruned_eval(&_venus_z, t);
+}
+
+void vsop87a_pruned_getMoon(double earth[], double emb[],double temp[]){
+   temp[0]=(emb[0]-earth[0])*(1 + 1 / 0.01230073677);
+   temp[1]=(emb[1]-earth[1])*(1 + 1 / 0.01230073677);
+   temp[2]=(emb[2]-earth[2])*(1 + 1 / 0.01230073677);
+   temp[0]=temp[0]+earth[0];
+   temp[1]=temp[1]+earth[1];
+   temp[2]=temp[2]+earth[2];
+}
@@ -0,0 +1,35 @@
+//Pruned, table-driven repackaging of vsop87a_milli for slow embedded targets.
+//The tables in vsop87a_pruned.c are generated by utils/gen_vsop87_pruned.py;
+//see that script for the pruning threshold and how to regenerate.
+//Underlying data: VSOP87-Multilang http://www.astrogreg.com/vsop87-multilang/index.html
+//Greg Miller (gmiller@gregmiller.net) 2019.  Released as Public Domain
+
+#ifndef VSOP87A_PRUNED
+#define VSOP87A_PRUNED
+
+#include <stdint.h>
+
+#define VSOP87A_PRUNED_MAX_POWER 6
+
+typedef struct {
+   double a;  // amplitude, AU
+   double b;  // phase, radians
+   double c;  // frequency, radians per Julian millennium
+} vsop87a_pruned_term_t;
+
+typedef struct {
+   const vsop87a_pruned_term_t *terms;  // all powers' terms, concatenated in power order
+   uint8_t counts[VSOP87A_PRUNED_MAX_POWER];  // terms per power of t
+} vsop87a_pruned_series_t;
+
+   void vsop87a_pruned_getEarth(double t,double temp[]);
+   void vsop87a_pruned_getEmb(double t,double temp[]);
+   void vsop87a_pruned_getJupiter(double t,double temp[]);
+   void vsop87a_pruned_getMars(double t,double temp[]);
+   void vsop87a_pruned_getMercury(double t,double temp[]);
+   void vsop87a_pruned_getNeptune(double t,double temp[]);
+   void vsop87a_pruned_getSaturn(double t,double temp[]);
+   void vsop87a_pruned_getUranus(double t,double temp[]);
+   void vsop87a_pruned_getVenus(double t,double temp[]);
+   void vsop87a_pruned_getMoon(double earth[], double emb[],double temp[]);
+#endif
@@ -24,6 +24,32 @@
 
 #define MOVEMENT_LONG_PRESS_TICKS 64
 
+// Sentinel stored in a button's down_timestamp once its long press event has fired. It marks the
+// button as "held, already long" so the fast tick can stop at the half-second threshold instead of
+// running for the entire hold; the release edge reads the latch to pick the long-up event.
+// fast_ticks tops out at 128 * 20, so this value can never occur as a real timestamp.
+#define MOVEMENT_LONG_PRESS_LATCHED 0xFFFF
+
+// Bits for movement_state.pending_work. Each bit mirrors one of the housekeeping conditions that
+// app_loop checks before dispatching an event to the active face. If no bit is set, a plain
+// EVENT_TICK can skip all of those checks and dispatch straight to the face's loop function, which
+// keeps the CPU awake for less time on every tick when a face has requested a fast tick frequency.
+#define MOVEMENT_WORK_FACE_CHANGED     (1 << 0)  // movement_move_to_face was called
+#define MOVEMENT_WORK_FAST_TICK        (1 << 1)  // the 128 Hz fast tick is running (alarm or button countdowns active)
+#define MOVEMENT_WORK_BACKGROUND_TASKS (1 << 2)  // the minute alarm fired; poll faces for background tasks
+#define MOVEMENT_WORK_SCHEDULED_TASKS  (1 << 3)  // at least one face has a scheduled background task pending
+#define MOVEMENT_WORK_LE_MODE          (1 << 4)  // the low energy mode countdown expired
+#define MOVEMENT_WORK_TIMEOUT          (1 << 5)  // the inactivity timeout countdown expired
+#define MOVEMENT_WORK_TICK_GOVERNOR    (1 << 6)  // the adaptive tick governor wants to shift frequency
+#define MOVEMENT_WORK_CONTINUATION     (1 << 7)  // a face has a sliced computation in progress
+
+// slices of a registered continuation run per app_loop pass. Each slice should be a few
+// milliseconds, so the default bounds continuation work per pass well under a tick period
+// while still finishing a thousand-slice computation in seconds.
+#ifndef MOVEMENT_CONTINUATION_SLICES_PER_PASS
+#define MOVEMENT_CONTINUATION_SLICES_PER_PASS 4
+#endif
+
 #include <stdio.h>
 #include <string.h>
 #include <limits.h>
@@ -31,7 +57,20 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "watch.h"
+#include "watch_utility.h"
+#include "watch_private_display.h"
+#include "lis2dw.h"
+#include "opt3001.h"
 #include "filesystem.h"
+#include "drift_correction.h"
+#include "zone_transitions.h"
+#ifdef MOVEMENT_TEMPERATURE_COMPENSATION
+#include "thermistor_driver.h"
+#endif
+#ifdef MOVEMENT_WRIST_RAISE
+#include "wrist_raise.h"
+#endif
+#include "lfs.h"
 #include "movement.h"
 
 #ifndef MOVEMENT_FIRMWARE
@@ -69,15 +108,115 @@
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
+#include "watch_energy.h"
+#endif
+
+// seconds without a button or motion event before the governor starts downshifting the tick
+// frequency toward the active face's declared floor; override in movement_config.h.
+#ifndef MOVEMENT_TICK_GOVERNOR_IDLE_SECONDS
+#define MOVEMENT_TICK_GOVERNOR_IDLE_SECONDS 30
 #endif
 
+// coin cell thresholds for the battery-state engine, in millivolts. 2200 mV is the same
+// "maybe 5-10% remaining" line simple_clock uses for its low battery indicator.
+#ifndef MOVEMENT_BATTERY_LOW_MV
+#define MOVEMENT_BATTERY_LOW_MV 2400
+#endif
+#ifndef MOVEMENT_BATTERY_CRITICAL_MV
+#define MOVEMENT_BATTERY_CRITICAL_MV 2200
+#endif
+// headroom required above a threshold before climbing back out of its state.
+#define MOVEMENT_BATTERY_HYSTERESIS_MV 100
+
 movement_state_t movement_state;
+// decoded shadow of movement_state.settings; see the note on movement_settings_cache_t in movement.h.
+movement_settings_cache_t movement_settings_cache;
+// the packed register the cache was last decoded from. Initialized to a value no real
+// settings word can take so the first refresh always decodes.
+static uint32_t settings_cache_reg = 0xFFFFFFFF;
 void * watch_face_contexts[MOVEMENT_NUM_FACES];
 watch_date_time scheduled_tasks[MOVEMENT_NUM_FACES];
+// faces that provide a wants_background_task hook, collected once at setup so the minute sweep
+// only touches faces that can actually have work, instead of all MOVEMENT_NUM_FACES contexts.
+static uint8_t background_task_faces[MOVEMENT_NUM_FACES];
+static uint8_t num_background_task_faces;
+#ifdef MOVEMENT_FAVORITE_FACES
+// the favorites ring from movement_config.h, in rotation order.
+static const uint8_t movement_favorite_faces[] = { MOVEMENT_FAVORITE_FACES };
+#define MOVEMENT_NUM_FAVORITE_FACES (sizeof(movement_favorite_faces))
+// next_favorite_face[i] is where a MODE long press jumps from face i: the activation
+// order is precomputed once at boot, so a jump is one table load and one face change —
+// the faces in between never activate, render, or resign.
+static uint8_t next_favorite_face[MOVEMENT_NUM_FACES];
+
+static void _movement_compute_favorite_order(void) {
+    for (uint8_t face = 0; face < MOVEMENT_NUM_FACES; face++) {
+        uint8_t next = movement_favorite_faces[0];
+        for (uint8_t i = 0; i < MOVEMENT_NUM_FAVORITE_FACES; i++) {
+            if (movement_favorite_faces[i] == face) {
+                // from a favorite, continue around the ring in list order.
+                next = movement_favorite_faces[(i + 1) % MOVEMENT_NUM_FAVORITE_FACES];
+                break;
+            }
+            if (movement_favorite_faces[i] > face) {
+                // from anywhere else, enter the ring at the first favorite past here
+                // (the scan wrapped to the first favorite if none is).
+                next = movement_favorite_faces[i];
+                break;
+            }
+        }
+        next_favorite_face[face] = next;
+    }
+}
+#endif // MOVEMENT_FAVORITE_FACES
+// the earliest deadline in scheduled_tasks (or 0 if none), so the minute check is a single
+// compare instead of a walk over every face's slot.
+static watch_date_time next_scheduled_task;
 const int32_t movement_le_inactivity_deadlines[8] = {INT_MAX, 3600, 7200, 21600, 43200, 86400, 172800, 604800};
 const int16_t movement_timeout_inactivity_deadlines[4] = {60, 120, 300, 1800};
 movement_event_t event;
 
+// The interrupt handlers below used to write straight into `event`, so two button edges
+// landing in the same pass (or a button edge racing a tick) would overwrite each other and
+// lose an event. They now push into this small ring and app_loop pops one event per pass:
+// ordering is preserved, bursts are loss-free, and each ISR does constant work. All our
+// interrupts run at the same NVIC priority, so pushes never nest; app_loop is the only
+// consumer, and each side owns one single-byte index, so no locking is needed. EVENT_TICK
+// is coalesced — a tick is a statement that time passed, and queueing a second one behind
+// an unconsumed first would just dispatch a stale frame — while button events all queue.
+#define MOVEMENT_EVENT_QUEUE_SIZE 8  // power of two; a burst deeper than this drops the newest event
+static movement_event_t event_queue[MOVEMENT_EVENT_QUEUE_SIZE];
+static volatile uint8_t event_queue_head;  // producer-owned (interrupt handlers)
+static volatile uint8_t event_queue_tail;  // consumer-owned (app_loop)
+static volatile bool tick_queued;
+
+static void _movement_push_event(uint8_t event_type) {
+    if (event_type == EVENT_NONE) return;
+    if (event_type == EVENT_TICK && tick_queued) return;
+    uint8_t head = event_queue_head;
+    if ((uint8_t)(head - event_queue_tail) >= MOVEMENT_EVENT_QUEUE_SIZE) return;
+    event_queue[head % MOVEMENT_EVENT_QUEUE_SIZE].event_type = event_type;
+    event_queue[head % MOVEMENT_EVENT_QUEUE_SIZE].subsecond = 0;
+    event_queue_head = head + 1;
+    // only mark the tick coalesced once it's really in the queue: marking before the
+    // full check above would wedge tick delivery forever if the push was dropped.
+    if (event_type == EVENT_TICK) tick_queued = true;
+}
+
+static inline bool _movement_event_queue_empty(void) {
+    return event_queue_head == event_queue_tail;
+}
+
+// pops the next queued event into the global `event`; leaves it untouched if the queue is empty.
+static void _movement_pop_event(void) {
+    if (_movement_event_queue_empty()) return;
+    uint8_t tail = event_queue_tail;
+    event.event_type = event_queue[tail % MOVEMENT_EVENT_QUEUE_SIZE].event_type;
+    event.subsecond = 0;
+    if (event.event_type == EVENT_TICK) tick_queued = false;
+    event_queue_tail = tail + 1;
+}
+
 const int16_t movement_timezone_offsets[] = {
     0,      //  0 :   0:00:00 (UTC)
     60,     //  1 :   1:00:00 (Central European Time)
@@ -122,6 +261,109 @@ const int16_t movement_timezone_offsets[] = {
     -60,    // 40 :  -1:00:00 (Azores Standard Time)
 };
 
+// each zone's offset prerendered for the display, exactly as "%3d%02d" would format it:
+// a three-character hour (sign included) and a two-digit minute, with the colon between
+// them coming from the LCD's colon segment. The zone-picker screens in set_time,
+// set_time_hackwatch and world_clock used to redo that division, modulo and sprintf on
+// every blink tick, times four for a four-instance world clock setup; now scrolling a
+// zone is a direct index into this table and a string copy.
+const char movement_timezone_labels[41][6] = {
+    "  000",  //  0
+    "  100",  //  1
+    "  200",  //  2
+    "  300",  //  3
+    "  330",  //  4
+    "  400",  //  5
+    "  430",  //  6
+    "  500",  //  7
+    "  530",  //  8
+    "  545",  //  9
+    "  600",  // 10
+    "  630",  // 11
+    "  700",  // 12
+    "  800",  // 13
+    "  845",  // 14
+    "  900",  // 15
+    "  930",  // 16
+    " 1000",  // 17
+    " 1030",  // 18
+    " 1100",  // 19
+    " 1200",  // 20
+    " 1245",  // 21
+    " 1300",  // 22
+    " 1345",  // 23
+    " 1400",  // 24
+    "-1200",  // 25
+    "-1100",  // 26
+    "-1000",  // 27
+    " -930",  // 28
+    " -900",  // 29
+    " -800",  // 30
+    " -700",  // 31
+    " -600",  // 32
+    " -500",  // 33
+    " -430",  // 34
+    " -400",  // 35
+    " -330",  // 36
+    " -300",  // 37
+    " -230",  // 38
+    " -200",  // 39
+    " -100",  // 40
+};
+
+// DST-correct offset resolution over the compiled transition table (zone_transitions.h).
+// _movement_zone_search finds the transition in force at a UTC instant; the public
+// movement_timezone_offset resolves the RTC's local time against it and caches the
+// window between the two surrounding transitions, so the tick-rate cost is two compares
+// and a subtract — the binary search reruns only when the zone changes or a transition
+// boundary is crossed, which is twice a year.
+static int32_t _movement_zone_search(uint8_t zone_index, uint32_t utc_timestamp,
+                                     uint32_t *window_start, uint32_t *window_end) {
+    const movement_zone_info_t *info = &movement_zone_infos[zone_index];
+    const uint32_t *times = &movement_zone_transition_times[info->first_transition];
+    // binary search for the count of transitions at or before the timestamp.
+    uint16_t lo = 0, hi = info->num_transitions;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (times[mid] <= utc_timestamp) lo = mid + 1;
+        else hi = mid;
+    }
+    *window_start = lo ? times[lo - 1] : 0;
+    *window_end = (lo < info->num_transitions) ? times[lo] : UINT32_MAX;
+    int8_t quarter_hours = lo ? movement_zone_transition_offsets[info->first_transition + lo - 1]
+                              : info->initial_offset;
+    return (int32_t)quarter_hours * 900;
+}
+
+int32_t movement_timezone_offset(uint8_t zone_index) {
+    static uint8_t cached_zone = 0xFF;
+    static int32_t cached_offset;
+    static uint32_t cached_window_start, cached_window_end;
+
+    if (zone_index >= sizeof(movement_timezone_offsets) / sizeof(movement_timezone_offsets[0])) return 0;
+
+    // the RTC keeps local time but the table is keyed by UTC. Use the cached (or fixed)
+    // offset as a first guess at UTC, search, then search once more in case the guess
+    // landed on the wrong side of a transition — the usual local-time resolution dance,
+    // except the window cache means it only actually runs on a boundary.
+    uint32_t local = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    if (zone_index == cached_zone) {
+        uint32_t utc = local - cached_offset;
+        if (utc >= cached_window_start && utc < cached_window_end) return cached_offset;
+    }
+
+    int32_t offset = movement_timezone_offsets[zone_index] * 60;
+    uint32_t window_start, window_end;
+    offset = _movement_zone_search(zone_index, local - offset, &window_start, &window_end);
+    offset = _movement_zone_search(zone_index, local - offset, &window_start, &window_end);
+
+    cached_zone = zone_index;
+    cached_offset = offset;
+    cached_window_start = window_start;
+    cached_window_end = window_end;
+    return offset;
+}
+
 const char movement_valid_position_0_chars[] = " AaBbCcDdEeFGgHhIiJKLMNnOoPQrSTtUuWXYZ-='+\\/0123456789";
 const char movement_valid_position_1_chars[] = " ABCDEFHlJLNORTtUX-='01378";
 
@@ -129,13 +371,356 @@ void cb_mode_btn_interrupt(void);
 void cb_light_btn_interrupt(void);
 void cb_alarm_btn_interrupt(void);
 void cb_alarm_btn_extwake(void);
+void cb_motion_wake_interrupt(void);
+#ifdef MOVEMENT_WRIST_RAISE
+static void cb_wrist_raised(void);
+#ifdef MOVEMENT_WRIST_RAISE_LED
+static void cb_wrist_raised_in_dark(void);
+#endif
+#endif
 void cb_alarm_fired(void);
 void cb_fast_tick(void);
 void cb_tick(void);
 
+static void _movement_update_battery_state(void);
+
+#ifdef MOVEMENT_PROFILE
+static movement_face_profile_t face_profiles[MOVEMENT_NUM_FACES];
+
+// time face dispatches with the counter in watch_profile.h: SysTick cycles on hardware,
+// wall-time nanoseconds in the simulator. Note that the counter is single-level, so a
+// face running its own watch_profile measurement inside loop costs one corrupted sample
+// here — acceptable for a bench build.
+static inline void _profile_dispatch_begin(void) {
+    watch_profile_counter_start();
+}
+
+static inline uint32_t _profile_dispatch_end(void) {
+    return watch_profile_counter_stop();
+}
+
+const movement_face_profile_t *movement_get_face_profile(uint8_t watch_face_index) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES) return NULL;
+    return &face_profiles[watch_face_index];
+}
+
+uint8_t movement_get_num_faces(void) {
+    return MOVEMENT_NUM_FACES;
+}
+
+void movement_print_face_profiles(void) {
+    printf("face wakes cycles\n");
+    for (uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        printf("%4d %5ld %ld\n", i, (long)face_profiles[i].wake_count, (long)face_profiles[i].active_cycles);
+    }
+}
+#endif // MOVEMENT_PROFILE
+
+// the wake-source ledger (see movement.h). Counters tick in the interrupt handlers below;
+// residency accrues in the standby hooks; the day rolls into the wakes.dat ring from
+// _movement_handle_background_tasks, which the minute alarm guarantees runs shortly after
+// midnight even in low energy mode.
+static movement_wake_ledger_t wake_ledger;
+static uint8_t wake_ledger_day;               // day of month the live counts cover; 0 = not yet latched
+static uint32_t wake_ledger_last_transition;  // unix time of the last active<->standby edge
+
+const movement_wake_ledger_t *movement_get_wake_ledger(void) {
+    return &wake_ledger;
+}
+
+static void _movement_wake_ledger_print_row(const char *label, const movement_wake_ledger_t *l) {
+    printf("%s t %lu/%lu/%lu/%lu/%lu/%lu/%lu/%lu a %lu b %lu m %lu act %lu stby %lu\n", label,
+        (unsigned long)l->tick_wakes[0], (unsigned long)l->tick_wakes[1], (unsigned long)l->tick_wakes[2],
+        (unsigned long)l->tick_wakes[3], (unsigned long)l->tick_wakes[4], (unsigned long)l->tick_wakes[5],
+        (unsigned long)l->tick_wakes[6], (unsigned long)l->tick_wakes[7],
+        (unsigned long)l->alarm_wakes, (unsigned long)l->button_wakes, (unsigned long)l->motion_wakes,
+        (unsigned long)l->active_seconds, (unsigned long)l->standby_seconds);
+}
+
+void movement_print_wake_ledger(void) {
+    printf("day      ticks (1/2/4/8/16/32/64/128 Hz) alarm button motion active standby\n");
+    movement_wake_ledger_day_t ring[MOVEMENT_WAKE_LEDGER_DAYS];
+    if (filesystem_get_file_size("wakes.dat") == (int32_t)sizeof(ring) &&
+        filesystem_read_file("wakes.dat", (char *)ring, sizeof(ring))) {
+        for (uint8_t i = 0; i < MOVEMENT_WAKE_LEDGER_DAYS; i++) {
+            if (ring[i].date == 0) continue;
+            char label[9];
+            watch_date_time date;
+            date.reg = ring[i].date;
+            sprintf(label, "20%02d%02d%02d", date.unit.year + 20, date.unit.month, date.unit.day);
+            _movement_wake_ledger_print_row(label, &ring[i].counts);
+        }
+    }
+    _movement_wake_ledger_print_row("today   ", &wake_ledger);
+}
+
+void movement_sync_time(uint32_t utc_timestamp) {
+    uint32_t offset = movement_timezone_offset(movement_state.settings.bit.time_zone);
+    uint32_t old_timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), offset);
+    watch_rtc_set_date_time(watch_utility_date_time_from_unix_time(utc_timestamp, offset));
+    int32_t drift = (int32_t)(utc_timestamp - old_timestamp);
+    movement_drift_record_reference(utc_timestamp, drift);
+    printf("drift was %ld seconds\n", (long)drift);
+}
+
+static void _movement_wake_ledger_roll_if_needed(void) {
+    watch_date_time now = watch_rtc_get_date_time();
+    if (wake_ledger_day == 0) {
+        wake_ledger_day = now.unit.day;
+        return;
+    }
+    if (now.unit.day == wake_ledger_day) return;
+
+    // midnight passed (or someone set the date): close out the day into the ring.
+    movement_wake_ledger_day_t ring[MOVEMENT_WAKE_LEDGER_DAYS];
+    if (filesystem_get_file_size("wakes.dat") != (int32_t)sizeof(ring) ||
+        !filesystem_read_file("wakes.dat", (char *)ring, sizeof(ring))) {
+        memset(ring, 0, sizeof(ring));
+    }
+    memmove(&ring[0], &ring[1], sizeof(ring) - sizeof(ring[0]));
+    // stamp the closing record with yesterday's date; we run within a minute of the rollover.
+    watch_date_time stamp = watch_utility_date_time_from_unix_time(
+        watch_utility_date_time_to_unix_time(now, 0) - 86400, 0);
+    stamp.unit.hour = stamp.unit.minute = stamp.unit.second = 0;
+    ring[MOVEMENT_WAKE_LEDGER_DAYS - 1].date = stamp.reg;
+    ring[MOVEMENT_WAKE_LEDGER_DAYS - 1].counts = wake_ledger;
+    filesystem_write_file("wakes.dat", (char *)ring, sizeof(ring));
+
+    memset(&wake_ledger, 0, sizeof(wake_ledger));
+    wake_ledger_day = now.unit.day;
+}
+
+#if defined(MOVEMENT_STATIC_DISPATCH) && defined(MOVEMENT_FACE_LIST)
+// Static dispatch build (make STATIC_DISPATCH=1): expand the face list into switches so
+// each hook call is a direct call to the face's function rather than a load through the
+// watch_faces[] pointer table. The face macros are compound literals, so face.loop et al.
+// fold to plain function addresses at compile time; with LTO the compiler can then inline
+// a short face loop straight into app_loop and constant-propagate the settings bits.
+static bool _movement_face_loop(uint8_t face_index, movement_event_t face_event) {
+    switch (face_index) {
+#define MOVEMENT_DISPATCH_LOOP(index, face) \
+        case index: return face.loop(face_event, &movement_state.settings, watch_face_contexts[index]);
+        MOVEMENT_FACE_LIST(MOVEMENT_DISPATCH_LOOP)
+#undef MOVEMENT_DISPATCH_LOOP
+    }
+    return true;
+}
+
+static void WATCH_COLD _movement_face_setup(uint8_t face_index) {
+    switch (face_index) {
+#define MOVEMENT_DISPATCH_SETUP(index, face) \
+        case index: face.setup(&movement_state.settings, index, &watch_face_contexts[index]); return;
+        MOVEMENT_FACE_LIST(MOVEMENT_DISPATCH_SETUP)
+#undef MOVEMENT_DISPATCH_SETUP
+    }
+}
+
+static void _movement_face_activate(uint8_t face_index) {
+#if __EMSCRIPTEN__
+    watch_energy_set_face(face_index); // attribute the simulator's energy model to the incoming face
+#endif
+    switch (face_index) {
+#define MOVEMENT_DISPATCH_ACTIVATE(index, face) \
+        case index: face.activate(&movement_state.settings, watch_face_contexts[index]); return;
+        MOVEMENT_FACE_LIST(MOVEMENT_DISPATCH_ACTIVATE)
+#undef MOVEMENT_DISPATCH_ACTIVATE
+    }
+}
+
+static void _movement_face_resign(uint8_t face_index) {
+    switch (face_index) {
+#define MOVEMENT_DISPATCH_RESIGN(index, face) \
+        case index: face.resign(&movement_state.settings, watch_face_contexts[index]); return;
+        MOVEMENT_FACE_LIST(MOVEMENT_DISPATCH_RESIGN)
+#undef MOVEMENT_DISPATCH_RESIGN
+    }
+}
+
+// returns false if the face provides no peek hook.
+static bool _movement_face_peek(uint8_t face_index) {
+    switch (face_index) {
+#define MOVEMENT_DISPATCH_PEEK(index, face) \
+        case index: if (face.peek == NULL) return false; \
+            face.peek(&movement_state.settings, watch_face_contexts[index]); return true;
+        MOVEMENT_FACE_LIST(MOVEMENT_DISPATCH_PEEK)
+#undef MOVEMENT_DISPATCH_PEEK
+    }
+    return false;
+}
+#else
+// Table dispatch (the default): every hook call goes through the watch_faces[] pointer
+// table. Configs that predate the MOVEMENT_FACE_LIST X macro only support this path.
+static bool _movement_face_loop(uint8_t face_index, movement_event_t face_event) {
+    return watch_faces[face_index].loop(face_event, &movement_state.settings, watch_face_contexts[face_index]);
+}
+
+static void WATCH_COLD _movement_face_setup(uint8_t face_index) {
+    watch_faces[face_index].setup(&movement_state.settings, face_index, &watch_face_contexts[face_index]);
+}
+
+static void _movement_face_activate(uint8_t face_index) {
+#if __EMSCRIPTEN__
+    watch_energy_set_face(face_index); // attribute the simulator's energy model to the incoming face
+#endif
+    watch_faces[face_index].activate(&movement_state.settings, watch_face_contexts[face_index]);
+}
+
+static void _movement_face_resign(uint8_t face_index) {
+    watch_faces[face_index].resign(&movement_state.settings, watch_face_contexts[face_index]);
+}
+
+// returns false if the face provides no peek hook.
+static bool _movement_face_peek(uint8_t face_index) {
+    if (watch_faces[face_index].peek == NULL) return false;
+    watch_faces[face_index].peek(&movement_state.settings, watch_face_contexts[face_index]);
+    return true;
+}
+#endif // MOVEMENT_STATIC_DISPATCH
+
+// re-decodes movement_settings_cache, but only when the packed register actually changed.
+// The common case is a single 32-bit compare; the full unpack runs once per settings edit,
+// not once per event.
+static void _movement_refresh_settings_cache(void) {
+    if (movement_state.settings.reg == settings_cache_reg) return;
+    settings_cache_reg = movement_state.settings.reg;
+    movement_settings_cache.button_should_sound = movement_state.settings.bit.button_should_sound;
+    movement_settings_cache.to_interval = movement_state.settings.bit.to_interval;
+    movement_settings_cache.to_always = movement_state.settings.bit.to_always;
+    movement_settings_cache.le_interval = movement_state.settings.bit.le_interval;
+    movement_settings_cache.led_duration = movement_state.settings.bit.led_duration;
+    movement_settings_cache.led_red_color = movement_state.settings.bit.led_red_color;
+    movement_settings_cache.led_green_color = movement_state.settings.bit.led_green_color;
+    movement_settings_cache.time_zone = movement_state.settings.bit.time_zone;
+    movement_settings_cache.clock_mode_24h = movement_state.settings.bit.clock_mode_24h;
+    movement_settings_cache.use_imperial_units = movement_state.settings.bit.use_imperial_units;
+    movement_settings_cache.alarm_enabled = movement_state.settings.bit.alarm_enabled;
+}
+
+// the last event type handed to any face, kept for the hardfault flight recorder: if a
+// face crashes mid-event, the tag word tells us what it was doing at the time.
+static volatile uint8_t last_event_dispatched;
+
+// The event trace: a 256-entry ring of packed words, one per dispatched event, cheap
+// enough to leave on in production (one word build, two RAM stores — the uint8_t head
+// wraps by itself). When a unit in the field misbehaves — stuck at a high tick rate,
+// a background task firing every minute — "trace" over the shell shows the last 256
+// events with wall-clock timestamps, no debugger required.
+//
+// Word layout: [31:26] minute  [25:20] second  [19:13] subsecond
+//              [12:8] event type  [7:2] face index  [1:0] wake source
+// A zero word is an unused slot; a dispatched event always has a nonzero event type.
+#define MOVEMENT_TRACE_ENTRIES 256
+static uint32_t trace_ring[MOVEMENT_TRACE_ENTRIES];
+static uint8_t trace_head;
+
+static const char *trace_source_names[4] = {"tick", "button", "alarm", "motion"};
+
+static uint8_t _movement_trace_wake_source(uint8_t event_type) {
+    switch (event_type) {
+        case EVENT_MOTION_WAKE:
+            return 3;
+        case EVENT_BACKGROUND_TASK:
+        case EVENT_LOW_ENERGY_UPDATE:
+            return 2;
+        case EVENT_TICK:
+        case EVENT_ACTIVATE:
+        case EVENT_TIMEOUT:
+            return 0;
+        default:
+            return 1;   // the twelve button events
+    }
+}
+
+static inline void _movement_trace_event(uint8_t face_index, movement_event_t face_event) {
+    // the event's timestamp mirrors the CLOCK register layout; its low 12 bits are mm:ss.
+    uint32_t clock = face_event.date_time.reg;
+    trace_ring[trace_head++] = ((clock & 0xFFF) << 20) |
+                               ((uint32_t)(face_event.subsecond & 0x7F) << 13) |
+                               ((uint32_t)(face_event.event_type & 0x1F) << 8) |
+                               ((uint32_t)(face_index & 0x3F) << 2) |
+                               _movement_trace_wake_source(face_event.event_type);
+}
+
+void movement_print_event_trace(void) {
+    // walk forward from the head: oldest entry first, wrapping through the whole ring.
+    for (uint16_t i = 0; i < MOVEMENT_TRACE_ENTRIES; i++) {
+        uint32_t word = trace_ring[(uint8_t)(trace_head + i)];
+        if (word == 0) continue;
+        printf("%02lu:%02lu.%03lu event %lu face %lu %s\n",
+               (word >> 26) & 0x3F, (word >> 20) & 0x3F, (word >> 13) & 0x7F,
+               (word >> 8) & 0x1F, (word >> 2) & 0x3F, trace_source_names[word & 3]);
+    }
+}
+
+bool movement_get_memory_stats(movement_memory_stats_t *stats) {
+#if __EMSCRIPTEN__
+    (void) stats;
+    return false;
+#else
+    extern uint32_t _sstack, _estack, _end;
+    extern unsigned char *_heap_high_water;
+
+    // the boot-time paint survives from the bottom of the stack up to the deepest frame
+    // ever pushed; the first disturbed word marks the high-water line.
+    uint32_t *p = &_sstack;
+    while (p < &_estack && *p == WATCH_STACK_FILL_WORD) p++;
+    stats->stack_size = (uint32_t)&_estack - (uint32_t)&_sstack;
+    stats->stack_high_water = (uint32_t)&_estack - (uint32_t)p;
+
+    // the heap grows up from _end toward the top of RAM; the sbrk shim records its
+    // highest break, which stays put even after everything is freed.
+    stats->heap_size = (HSRAM_ADDR + HSRAM_SIZE) - (uint32_t)&_end;
+    stats->heap_high_water = _heap_high_water ? (uint32_t)(_heap_high_water - (unsigned char *)&_end) : 0;
+    return true;
+#endif
+}
+
+// all face loop invocations funnel through here so the profiling build can count them.
+static bool _movement_dispatch_loop(uint8_t face_index, movement_event_t face_event) {
+    // math-heavy faces declare cpu_boost_on_activate; their activation render runs at
+    // 16 MHz so the active window stays short. note the boost scales the profiler's
+    // cycle counts for this event along with the clock.
+    bool boost = face_event.event_type == EVENT_ACTIVATE && watch_faces[face_index].cpu_boost_on_activate;
+    // one RTC read per wake: the face (and the trace below) consume the timestamp from the
+    // event rather than each reading the CLOCK register themselves.
+    face_event.date_time = watch_rtc_get_date_time();
+    last_event_dispatched = face_event.event_type;  // for the hardfault flight recorder
+    _movement_trace_event(face_index, face_event);
+    if (boost) watch_cpu_boost_begin();
+#ifdef MOVEMENT_PROFILE
+    _profile_dispatch_begin();
+#endif
+    bool result = _movement_face_loop(face_index, face_event);
+#ifdef MOVEMENT_PROFILE
+    face_profiles[face_index].active_cycles += _profile_dispatch_end();
+    face_profiles[face_index].wake_count++;
+#endif
+    if (boost) watch_cpu_boost_end();
+    // faces edit settings through the pointer they were handed; catch any change now so the
+    // decoded cache is fresh before anyone reads it again.
+    _movement_refresh_settings_cache();
+    return result;
+}
+
+// Face setup is lazy: a face runs its setup the first time it activates or takes a
+// background task, not at boot. With a long face list, cold boot would otherwise stall
+// behind faces that may not open for days (TOTP file parses, astronomy table seeding).
+static bool face_is_set_up[MOVEMENT_NUM_FACES];
+
+static void _movement_ensure_face_setup(uint8_t face_index) {
+    if (face_is_set_up[face_index]) return;
+    face_is_set_up[face_index] = true;
+    _movement_face_setup(face_index);
+}
+
 static inline void _movement_reset_inactivity_countdown(void) {
     movement_state.le_mode_ticks = movement_le_inactivity_deadlines[movement_state.settings.bit.le_interval];
+    // with the battery critical, minute-resolution updates engage a minute after the last
+    // interaction no matter what the user's low energy timeout says.
+    if (movement_state.battery_state == MOVEMENT_BATTERY_CRITICAL && movement_state.le_mode_ticks > 60)
+        movement_state.le_mode_ticks = 60;
     movement_state.timeout_ticks = movement_timeout_inactivity_deadlines[movement_state.settings.bit.to_interval];
+    movement_state.pending_work &= ~(MOVEMENT_WORK_LE_MODE | MOVEMENT_WORK_TIMEOUT);
 }
 
 static inline void _movement_enable_fast_tick_if_needed(void) {
@@ -143,40 +728,90 @@ static inline void _movement_enable_fast_tick_if_needed(void) {
         movement_state.fast_ticks = 0;
         watch_rtc_register_periodic_callback(cb_fast_tick, 128);
         movement_state.fast_tick_enabled = true;
+        movement_state.pending_work |= MOVEMENT_WORK_FAST_TICK;
     }
 }
 
+static inline bool _movement_button_needs_timing(uint16_t down_timestamp) {
+    // 0 means the button is up; the latch means its long press already fired. Either way
+    // there is nothing left to time for this button until its release edge arrives.
+    return down_timestamp != 0 && down_timestamp != MOVEMENT_LONG_PRESS_LATCHED;
+}
+
 static inline void _movement_disable_fast_tick_if_possible(void) {
-    if ((movement_state.light_ticks == -1) &&
-        (movement_state.alarm_ticks == -1) &&
-        ((movement_state.light_down_timestamp + movement_state.mode_down_timestamp + movement_state.alarm_down_timestamp) == 0)) {
+    if ((movement_state.alarm_ticks == -1) &&
+        !_movement_button_needs_timing(movement_state.light_down_timestamp) &&
+        !_movement_button_needs_timing(movement_state.mode_down_timestamp) &&
+        !_movement_button_needs_timing(movement_state.alarm_down_timestamp)) {
         movement_state.fast_tick_enabled = false;
+        movement_state.pending_work &= ~MOVEMENT_WORK_FAST_TICK;
         watch_rtc_disable_periodic_callback(128);
     }
 }
 
-static void _movement_handle_background_tasks(void) {
+static void _movement_update_next_scheduled_task(void) {
+    next_scheduled_task.reg = 0;
     for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        // For each face, if the watch face wants a background task...
-        if (watch_faces[i].wants_background_task != NULL && watch_faces[i].wants_background_task(&movement_state.settings, watch_face_contexts[i])) {
+        if (scheduled_tasks[i].reg && (next_scheduled_task.reg == 0 || scheduled_tasks[i].reg < next_scheduled_task.reg)) {
+            next_scheduled_task.reg = scheduled_tasks[i].reg;
+        }
+    }
+}
+
+static void _movement_handle_background_tasks(void) {
+    _movement_wake_ledger_roll_if_needed();
+
+    // hourly coin cell sample for the battery-state engine; a zero counter also forces a
+    // sample on the first minute pass after boot.
+    static uint8_t battery_check_minutes;
+    if (battery_check_minutes == 0) {
+        _movement_update_battery_state();
+#ifdef MOVEMENT_TEMPERATURE_COMPENSATION
+        // hourly thermistor sample for temperature-compensated timekeeping.
+        thermistor_driver_enable();
+        movement_drift_temperature_update(thermistor_driver_get_temperature());
+        thermistor_driver_disable();
+#endif
+        battery_check_minutes = 60;
+    }
+    battery_check_minutes--;
+
+    for(uint8_t i = 0; i < num_background_task_faces; i++) {
+        uint8_t face_index = background_task_faces[i];
+        // a face that hasn't run setup yet gets it now, so its hook sees a real context.
+        _movement_ensure_face_setup(face_index);
+        // For each face that provides the hook, if the watch face wants a background task...
+        if (watch_faces[face_index].wants_background_task(&movement_state.settings, watch_face_contexts[face_index])) {
             // ...we give it one. pretty straightforward!
             movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
-            watch_faces[i].loop(background_event, &movement_state.settings, watch_face_contexts[i]);
+            _movement_dispatch_loop(face_index, background_event);
         }
     }
     movement_state.needs_background_tasks_handled = false;
+    movement_state.pending_work &= ~MOVEMENT_WORK_BACKGROUND_TASKS;
 }
 
 static void _movement_handle_scheduled_tasks(void) {
     watch_date_time date_time = watch_rtc_get_date_time();
     uint8_t num_active_tasks = 0;
 
+    // a task pending for the face on screen means a running timer is counting on us to stay
+    // out of low energy mode (see the note in countdown_face.h); deadlines held by background
+    // faces (chimes, alarms) deliberately don't hold the watch awake — those fire from the
+    // sleep mode loop instead.
+    if (scheduled_tasks[movement_state.current_watch_face].reg) _movement_reset_inactivity_countdown();
+
+    // single compare against the earliest deadline; if nothing is due yet, skip the walk entirely.
+    if (next_scheduled_task.reg == 0 || date_time.reg < next_scheduled_task.reg) return;
+
     for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
         if (scheduled_tasks[i].reg) {
-            if (scheduled_tasks[i].reg == date_time.reg) {
+            if (scheduled_tasks[i].reg <= date_time.reg) {
+                // due or overdue: a wake can overshoot a deadline set on an arbitrary second
+                // (minute alarm wakes, low energy mode), so fire anything we owe, once.
                 scheduled_tasks[i].reg = 0;
                 movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
-                watch_faces[i].loop(background_event, &movement_state.settings, watch_face_contexts[i]);
+                _movement_dispatch_loop(i, background_event);
                 // check if loop scheduled a new task
                 if (scheduled_tasks[i].reg) {
                     num_active_tasks++;
@@ -187,35 +822,218 @@ static void _movement_handle_scheduled_tasks(void) {
         }
     }
 
+    _movement_update_next_scheduled_task();
+
     if (num_active_tasks == 0) {
         movement_state.has_scheduled_background_task = false;
-    } else {
-        _movement_reset_inactivity_countdown();
+        movement_state.pending_work &= ~MOVEMENT_WORK_SCHEDULED_TASKS;
     }
 }
 
-void movement_request_tick_frequency(uint8_t freq) {
-    // Movement uses the 128 Hz tick internally
-    if (freq == 128) return;
+// MOVEMENT_DISPLAY_BUFFER_CHARS matches the ten character positions on the Casio F-91W LCD.
+#define MOVEMENT_DISPLAY_BUFFER_CHARS 10
+static char display_scratch[MOVEMENT_DISPLAY_BUFFER_CHARS + 1];
+// the characters as of the last flush, so a rewrite of the same frame costs ten compares
+// and zero SLCD writes. A zero byte never matches a displayable character, so zeroing the
+// shadow (after a face change or display power-up, when we can no longer vouch for what is
+// on the glass) forces the next flush to write everything.
+static char display_shadow[MOVEMENT_DISPLAY_BUFFER_CHARS];
+
+static void _movement_invalidate_display_shadow(void) {
+    memset(display_shadow, 0, sizeof(display_shadow));
+}
+
+char *movement_get_display_buffer(void) {
+    return display_scratch;
+}
+
+void movement_flush_display_buffer(void) {
+    watch_display_begin();
+    for (uint8_t i = 0; i < MOVEMENT_DISPLAY_BUFFER_CHARS && display_scratch[i]; i++) {
+        if (display_shadow[i] != display_scratch[i]) {
+            watch_display_character(display_scratch[i], i);
+            display_shadow[i] = display_scratch[i];
+        }
+    }
+    watch_display_commit();
+}
 
-    // Movement requires at least a 1 Hz tick.
-    // If we are asked for an invalid frequency, default back to 1 Hz.
-    if (freq == 0 || __builtin_popcount(freq) != 1) freq = 1;
+// a peek in progress: the face whose frame is on the glass while someone else holds the
+// foreground, and the frame it replaced.
+static int16_t peek_face_index = -1;
+static char peek_saved_frame[MOVEMENT_DISPLAY_BUFFER_CHARS];
+
+bool movement_peek_face(uint8_t watch_face_index) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES) return false;
+    if (watch_face_index == movement_state.current_watch_face) return false;
+    _movement_ensure_face_setup(watch_face_index);
+    // first peek of a sequence: capture the frame on the glass so movement_end_peek can
+    // put it back. A peek during a peek just replaces the peeked frame.
+    if (peek_face_index < 0) memcpy(peek_saved_frame, display_shadow, sizeof(peek_saved_frame));
+    memset(display_scratch, 0, sizeof(display_scratch));
+    if (!_movement_face_peek(watch_face_index)) return false;
+    peek_face_index = watch_face_index;
+    movement_flush_display_buffer();
+    return true;
+}
+
+void movement_end_peek(void) {
+    if (peek_face_index < 0) return;
+    peek_face_index = -1;
+    // the shadow only knows characters that went through the display buffer; if the
+    // saved frame is complete, restoring it is ten compares and a diff flush. If any
+    // position is unknown (the foreground face last drew to the display directly), ask
+    // it to repaint with a loop call instead — still no resign/activate churn.
+    bool complete = true;
+    for (uint8_t i = 0; i < MOVEMENT_DISPLAY_BUFFER_CHARS; i++) {
+        if (peek_saved_frame[i] == 0) {
+            complete = false;
+            break;
+        }
+    }
+    if (complete) {
+        memcpy(display_scratch, peek_saved_frame, MOVEMENT_DISPLAY_BUFFER_CHARS);
+        display_scratch[MOVEMENT_DISPLAY_BUFFER_CHARS] = 0;
+        movement_flush_display_buffer();
+    } else {
+        movement_event_t repaint_event = { EVENT_ACTIVATE, 0 };
+        _movement_invalidate_display_shadow();
+        _movement_dispatch_loop(movement_state.current_watch_face, repaint_event);
+    }
+}
+
+// the low-level half of movement_request_tick_frequency: swaps the registered callback
+// without touching the face's recorded request, so the governor can shift frequency
+// underneath the face and still know where to come back to.
+static void _movement_apply_tick_frequency(uint8_t freq) {
+    // with the battery critical, nothing redraws faster than once a second: seconds still
+    // advance, but the fast display rates that burn the most power are off the table.
+    // (the 128 Hz button-timing tick is registered elsewhere and unaffected.)
+    if (movement_state.battery_state == MOVEMENT_BATTERY_CRITICAL && freq > 1) freq = 1;
 
     // disable all callbacks except the 128 Hz one
+    watch_rtc_disable_aligned_tick_callback();
     watch_rtc_disable_matching_periodic_callbacks(0xFE);
 
     movement_state.subsecond = 0;
     movement_state.tick_frequency = freq;
-    watch_rtc_register_periodic_callback(cb_tick, freq);
+    // at 1 Hz, ride the phase-aligned tick: the raw PER7 interrupt fires half a second
+    // after the second rolls over, which is why clock faces used to flip their seconds
+    // late (or tick faster than 1 Hz just to look crisp). Aligned, cb_tick always lands
+    // just past the boundary and every EVENT_TICK carries a freshly-changed second.
+    if (freq == 1) watch_rtc_register_aligned_tick_callback(cb_tick, 0);
+    else if (freq) watch_rtc_register_periodic_callback(cb_tick, freq);
+}
+
+void movement_request_tick_frequency(uint8_t freq) {
+    // Movement uses the 128 Hz tick internally
+    if (freq == 128) return;
+
+    // A frequency of 0 suspends the tick entirely: the face will receive no EVENT_TICK events,
+    // and the system will sleep until a button is pressed, a background task fires, or a wake
+    // scheduled with movement_request_wake_at arrives. Faces with static content can use this
+    // to avoid waking the CPU once a second for a display that never changes.
+    // If we are asked for any other invalid frequency, default back to 1 Hz.
+    if (freq != 0 && __builtin_popcount(freq) != 1) freq = 1;
+
+    movement_state.tick_frequency_requested = freq;
+    movement_state.governor_idle_ticks = 0;
+    movement_state.pending_work &= ~MOVEMENT_WORK_TICK_GOVERNOR;
+    _movement_apply_tick_frequency(freq);
+}
+
+// called from the button and motion interrupts: the wearer is back, so zero the idle clock
+// and, if the governor had downshifted, queue the restore. The event that got us here forces
+// a full app_loop pass, so the requested frequency is back before the face sees the event.
+static inline void _movement_tick_governor_poke(void) {
+    movement_state.governor_idle_ticks = 0;
+    if (movement_state.tick_frequency != movement_state.tick_frequency_requested)
+        movement_state.pending_work |= MOVEMENT_WORK_TICK_GOVERNOR;
+}
+
+// loop-context half of the governor: downshift one octave toward the active face's floor
+// when the idle clock has run out, or restore the face's request after a poke.
+static void _movement_apply_tick_governor(void) {
+    movement_state.pending_work &= ~MOVEMENT_WORK_TICK_GOVERNOR;
+    uint8_t tick_floor = watch_faces[movement_state.current_watch_face].tick_governor_floor;
+    if (movement_state.governor_idle_ticks >= MOVEMENT_TICK_GOVERNOR_IDLE_SECONDS) {
+        if (tick_floor && movement_state.tick_frequency > tick_floor) {
+            uint8_t next = movement_state.tick_frequency >> 1;
+            if (next < tick_floor) next = tick_floor;
+            _movement_apply_tick_frequency(next);
+        }
+    } else if (movement_state.tick_frequency != movement_state.tick_frequency_requested) {
+        _movement_apply_tick_frequency(movement_state.tick_frequency_requested);
+    }
+}
+
+movement_battery_state_t movement_get_battery_state(void) {
+    return (movement_battery_state_t)movement_state.battery_state;
+}
+
+// the single continuation slot (see movement.h). One face computes at a time; the slot is
+// cleared on face change and on low energy entry, so a stale continuation can never run
+// against a context its face no longer expects.
+static movement_continuation_fn continuation_fn;
+static void *continuation_context;
+
+void movement_start_continuation(movement_continuation_fn fn, void *context) {
+    continuation_fn = fn;
+    continuation_context = context;
+    if (fn) movement_state.pending_work |= MOVEMENT_WORK_CONTINUATION;
+    else movement_state.pending_work &= ~MOVEMENT_WORK_CONTINUATION;
+}
+
+void movement_cancel_continuation(void) {
+    continuation_fn = NULL;
+    movement_state.pending_work &= ~MOVEMENT_WORK_CONTINUATION;
+}
+
+static void _movement_update_battery_state(void) {
+    watch_enable_adc();
+    uint16_t voltage = watch_get_vcc_voltage();
+    watch_disable_adc();
+
+    movement_battery_state_t state;
+    if (voltage < MOVEMENT_BATTERY_CRITICAL_MV) state = MOVEMENT_BATTERY_CRITICAL;
+    else if (voltage < MOVEMENT_BATTERY_LOW_MV) state = MOVEMENT_BATTERY_LOW;
+    else state = MOVEMENT_BATTERY_OK;
+
+    // falling into a state is immediate; climbing back out needs headroom above the
+    // threshold we fell through, so a cell bouncing around one reading doesn't flap.
+    if (state < movement_state.battery_state) {
+        uint16_t climb_threshold = (movement_state.battery_state == MOVEMENT_BATTERY_CRITICAL)
+            ? MOVEMENT_BATTERY_CRITICAL_MV : MOVEMENT_BATTERY_LOW_MV;
+        if (voltage < climb_threshold + MOVEMENT_BATTERY_HYSTERESIS_MV) return;
+    }
+    if (state == (movement_battery_state_t)movement_state.battery_state) return;
+    movement_state.battery_state = state;
+
+    if (state == MOVEMENT_BATTERY_CRITICAL) {
+        // take effect now, not at the next face change: cap a running fast tick and start
+        // the shortened low energy countdown even if the user's LE timeout is "never".
+        if (movement_state.tick_frequency > 1) _movement_apply_tick_frequency(movement_state.tick_frequency);
+        if (movement_state.le_mode_ticks > 60) movement_state.le_mode_ticks = 60;
+    } else if (movement_state.tick_frequency != movement_state.tick_frequency_requested) {
+        // recovered: give the face back whatever the critical cap took away.
+        _movement_apply_tick_frequency(movement_state.tick_frequency_requested);
+    }
+}
+
+void movement_request_wake_at(watch_date_time date_time) {
+    movement_state.scheduled_wake.reg = date_time.reg;
 }
 
 void movement_illuminate_led(void) {
+    // the LED is the single hungriest load on the board; it's the first thing the
+    // battery-state engine takes away.
+    if (movement_state.battery_state >= MOVEMENT_BATTERY_LOW) return;
     if (movement_state.settings.bit.led_duration) {
-        watch_set_led_color(movement_state.settings.bit.led_red_color ? (0xF | movement_state.settings.bit.led_red_color << 4) : 0,
-                            movement_state.settings.bit.led_green_color ? (0xF | movement_state.settings.bit.led_green_color << 4) : 0);
-        movement_state.light_ticks = (movement_state.settings.bit.led_duration * 2 - 1) * 128;
-        _movement_enable_fast_tick_if_needed();
+        // the auto-off engine times the LED duration in hardware, so we can go right
+        // back to sleep instead of counting it down on the 128 Hz fast tick.
+        watch_led_illuminate_with_auto_off(movement_state.settings.bit.led_red_color ? (0xF | movement_state.settings.bit.led_red_color << 4) : 0,
+                                           movement_state.settings.bit.led_green_color ? (0xF | movement_state.settings.bit.led_green_color << 4) : 0,
+                                           (movement_state.settings.bit.led_duration * 2 - 1) * 1000);
     }
 }
 
@@ -230,11 +1048,16 @@ bool movement_default_loop_handler(movement_event_t event, movement_settings_t *
             movement_illuminate_led();
             break;
         case EVENT_MODE_LONG_PRESS:
+#ifdef MOVEMENT_FAVORITE_FACES
+            // jump around the favorites ring; pass-through faces never activate.
+            movement_move_to_face(next_favorite_face[movement_state.current_watch_face]);
+#else
             if (MOVEMENT_SECONDARY_FACE_INDEX && movement_state.current_watch_face == 0) {
                 movement_move_to_face(MOVEMENT_SECONDARY_FACE_INDEX);
             } else {
                 movement_move_to_face(0);
             }
+#endif
             break;
         default:
             break;
@@ -245,17 +1068,101 @@ bool movement_default_loop_handler(movement_event_t event, movement_settings_t *
 
 void movement_move_to_face(uint8_t watch_face_index) {
     movement_state.watch_face_changed = true;
+    movement_state.pending_work |= MOVEMENT_WORK_FACE_CHANGED;
     movement_state.next_watch_face = watch_face_index;
 }
 
+// The runtime face order: a record on the filesystem holding the MODE-button ring as
+// indices into the compiled-in face table, so reordering (or parking a rarely-used face
+// out of the ring) is a shell command instead of a movement_config.h edit and a reflash.
+// Each press saved is a wake-render cycle saved, every day. Face indices stay physical
+// everywhere — contexts, backup registers, scheduled tasks, the snapshot — only the
+// ring sequence changes; a face left out of the record still runs its background task
+// and is still reachable through favorites or movement_move_to_face. With no record
+// (or an invalid one), the compiled-in order applies exactly as before.
+#define MOVEMENT_FACE_ORDER_FILENAME "order.dat"
+static uint8_t face_order[MOVEMENT_NUM_FACES];
+static uint8_t face_order_count;    // 0 = no record loaded
+
+static bool _movement_face_order_valid(const uint8_t *indices, uint8_t count) {
+    bool seen[MOVEMENT_NUM_FACES] = {false};
+    if (count == 0 || count > MOVEMENT_NUM_FACES) return false;
+    for (uint8_t i = 0; i < count; i++) {
+        if (indices[i] >= MOVEMENT_NUM_FACES || seen[indices[i]]) return false;
+        seen[indices[i]] = true;
+    }
+    return true;
+}
+
+static void _movement_load_face_order(void) {
+    uint8_t order[MOVEMENT_NUM_FACES];
+    int32_t size = filesystem_get_file_size(MOVEMENT_FACE_ORDER_FILENAME);
+    if (size <= 0 || size > MOVEMENT_NUM_FACES) return;
+    if (!filesystem_read_file(MOVEMENT_FACE_ORDER_FILENAME, (char *)order, size)) return;
+    if (!_movement_face_order_valid(order, (uint8_t)size)) return;
+    memcpy(face_order, order, size);
+    face_order_count = (uint8_t)size;
+}
+
+bool movement_set_face_order(const uint8_t *indices, uint8_t count) {
+    if (count == 0) {
+        // back to the compiled-in order.
+        filesystem_rm(MOVEMENT_FACE_ORDER_FILENAME);
+        face_order_count = 0;
+        return true;
+    }
+    if (!_movement_face_order_valid(indices, count)) return false;
+    if (!filesystem_write_file(MOVEMENT_FACE_ORDER_FILENAME, (char *)indices, count)) return false;
+    memcpy(face_order, indices, count);
+    face_order_count = count;
+    return true;
+}
+
+void movement_print_face_order(void) {
+    if (face_order_count == 0) {
+        printf("compiled-in order, %d faces\n", MOVEMENT_NUM_FACES);
+        return;
+    }
+    for (uint8_t i = 0; i < face_order_count; i++) printf("%s%d", i ? " " : "", face_order[i]);
+    printf(" (%d of %d faces)\n", face_order_count, MOVEMENT_NUM_FACES);
+}
+
+static bool _movement_face_available(uint8_t face_index) {
+    uint8_t sensor = watch_faces[face_index].required_sensor;
+    return sensor == MOVEMENT_SENSOR_NONE || movement_sensor_present((movement_sensor_t)sensor);
+}
+
 void movement_move_to_next_face(void) {
+    if (face_order_count) {
+        // a loaded record defines the whole ring, superseding the secondary-face split
+        // (which only partitions the compiled-in sequence). if the current face isn't in
+        // the ring — favorites or a face jumped us somewhere parked — re-enter at the top.
+        uint8_t position = 0;
+        for (uint8_t i = 0; i < face_order_count; i++) {
+            if (face_order[i] == movement_state.current_watch_face) {
+                position = (i + 1) % face_order_count;
+                break;
+            }
+        }
+        // skip over faces whose required sensor the topology probe found absent.
+        for (uint8_t i = 0; i < face_order_count && !_movement_face_available(face_order[position]); i++) {
+            position = (position + 1) % face_order_count;
+        }
+        movement_move_to_face(face_order[position]);
+        return;
+    }
     uint16_t face_max;
     if (MOVEMENT_SECONDARY_FACE_INDEX) {
         face_max = (movement_state.current_watch_face < (int16_t)MOVEMENT_SECONDARY_FACE_INDEX) ? MOVEMENT_SECONDARY_FACE_INDEX : MOVEMENT_NUM_FACES;
     } else {
         face_max = MOVEMENT_NUM_FACES;
     }
-    movement_move_to_face((movement_state.current_watch_face + 1) % face_max);
+    uint16_t next_face = (movement_state.current_watch_face + 1) % face_max;
+    // skip over faces whose required sensor the topology probe found absent.
+    for (uint16_t i = 0; i < face_max && !_movement_face_available(next_face); i++) {
+        next_face = (next_face + 1) % face_max;
+    }
+    movement_move_to_face(next_face);
 }
 
 void movement_schedule_background_task(watch_date_time date_time) {
@@ -270,12 +1177,26 @@ void movement_schedule_background_task_for_face(uint8_t watch_face_index, watch_
     watch_date_time now = watch_rtc_get_date_time();
     if (date_time.reg > now.reg) {
         movement_state.has_scheduled_background_task = true;
+        movement_state.pending_work |= MOVEMENT_WORK_SCHEDULED_TASKS;
         scheduled_tasks[watch_face_index].reg = date_time.reg;
+        if (next_scheduled_task.reg == 0 || date_time.reg < next_scheduled_task.reg) next_scheduled_task.reg = date_time.reg;
     }
 }
 
+watch_date_time movement_next_chime(uint16_t interval_minutes) {
+    // Time-triggered buzzes (the hourly signal, half-hour ship's bells) fire on minute
+    // boundaries. Rather than each chime face polling the clock every minute through a
+    // wants_background_task hook, it schedules the next boundary as a background task and
+    // re-arms when it fires: the scheduled task engine is then the single consumer of the
+    // minute RTC alarm for every chime in the system.
+    uint32_t interval = (uint32_t)interval_minutes * 60;
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    return watch_utility_date_time_from_unix_time(timestamp - (timestamp % interval) + interval, 0);
+}
+
 void movement_cancel_background_task_for_face(uint8_t watch_face_index) {
     scheduled_tasks[watch_face_index].reg = 0;
+    _movement_update_next_scheduled_task();
     bool other_tasks_scheduled = false;
     for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
         if (scheduled_tasks[i].reg != 0) {
@@ -284,6 +1205,7 @@ void movement_cancel_background_task_for_face(uint8_t watch_face_index) {
         }
     }
     movement_state.has_scheduled_background_task = other_tasks_scheduled;
+    if (!other_tasks_scheduled) movement_state.pending_work &= ~MOVEMENT_WORK_SCHEDULED_TASKS;
 }
 
 void movement_request_wake() {
@@ -291,10 +1213,44 @@ void movement_request_wake() {
     _movement_reset_inactivity_countdown();
 }
 
+void movement_enable_motion_wake(uint8_t pin) {
+    watch_register_interrupt_callback(pin, cb_motion_wake_interrupt, INTERRUPT_TRIGGER_RISING);
+}
+
+void movement_disable_motion_wake(uint8_t pin) {
+    watch_register_interrupt_callback(pin, NULL, INTERRUPT_TRIGGER_NONE);
+}
+
+static void _movement_chime_finished(void) {
+    // movement_play_chime powered the buzzer up for this melody; power it back down.
+    watch_disable_buzzer();
+}
+
+void movement_play_chime(int8_t *note_sequence) {
+    // Chimes can fire from a background task with all PWM peripherals powered down. The
+    // sequencer enables the buzzer on demand and keeps it alive through standby; if it was
+    // down when we got here, the end-of-sequence callback powers it off again. Callers no
+    // longer wrap chimes in watch_enable_buzzer/watch_disable_buzzer — with the sequencer
+    // running in the background, an immediate disable would cut the melody off.
+    watch_set_buzzer_volume(movement_state.buzzer_volume);
+    if (watch_is_buzzer_or_led_enabled()) watch_buzzer_play_sequence(note_sequence, NULL);
+    else watch_buzzer_play_sequence(note_sequence, _movement_chime_finished);
+}
+
+void movement_set_buzzer_volume(watch_buzzer_volume_t volume) {
+    movement_state.buzzer_volume = volume;
+}
+
 void movement_play_signal(void) {
-    watch_buzzer_play_note(BUZZER_NOTE_C8, 75);
-    watch_buzzer_play_note(BUZZER_NOTE_REST, 100);
-    watch_buzzer_play_note(BUZZER_NOTE_C8, 100);
+    // the hourly chime is discretionary; a failing cell silences it. (alarms the wearer
+    // explicitly set still play: they go through movement_play_alarm.)
+    if (movement_state.battery_state >= MOVEMENT_BATTERY_LOW) return;
+
+    // play through the interrupt-driven sequencer rather than blocking note calls,
+    // so the core can return to STANDBY between note boundaries. durations are in
+    // 64ths of a second: 5/6/6 ticks approximate the original 75/100/100 ms.
+    static int8_t signal_seq[] = {BUZZER_NOTE_C8, 5, BUZZER_NOTE_REST, 6, BUZZER_NOTE_C8, 6, 0};
+    movement_play_chime(signal_seq);
 }
 
 void movement_play_alarm(void) {
@@ -316,12 +1272,224 @@ uint8_t movement_claim_backup_register(void) {
     return movement_state.next_available_backup_register++;
 }
 
-void app_init(void) {
+bool movement_sensor_present(movement_sensor_t sensor) {
+    // before the probe has run (i.e. before app_setup), claim everything is present
+    // rather than letting zeroed bits read as a boardful of missing sensors.
+    if (!movement_state.settings.bit.sensor_probe_done) return true;
+    switch (sensor) {
+        case MOVEMENT_SENSOR_ACCELEROMETER:
+            return movement_state.settings.bit.has_accelerometer;
+        case MOVEMENT_SENSOR_LIGHT:
+            return movement_state.settings.bit.has_light_sensor;
+        default:
+            return true;
+    }
+}
+
+// Face contexts are allocated once at setup and never freed, so they come from a static arena
+// sized at build time rather than the heap: RAM use is visible at link time, and setup can't
+// fragment the heap. The default budget assumes an average face context of ~96 bytes; override
+// MOVEMENT_FACE_CONTEXT_ARENA_SIZE in movement_config.h if your face list needs more.
+#ifndef MOVEMENT_FACE_CONTEXT_ARENA_SIZE
+#define MOVEMENT_FACE_CONTEXT_ARENA_SIZE (96 * MOVEMENT_NUM_FACES)
+#endif
+
+static uint8_t face_context_arena[MOVEMENT_FACE_CONTEXT_ARENA_SIZE] __attribute__((aligned(4)));
+static size_t face_context_arena_used;
+
+void *movement_face_context_alloc(size_t size) {
+    // keep every block 4-byte aligned.
+    size = (size + 3) & ~(size_t)3;
+    if (face_context_arena_used + size > MOVEMENT_FACE_CONTEXT_ARENA_SIZE) {
+        // arena undersized for this face list; fall back to the heap so the firmware still runs,
+        // and complain so whoever is debugging RAM headroom knows to bump the arena size.
+        printf("face context arena exhausted, falling back to malloc for %zu bytes\n", size);
+        return malloc(size);
+    }
+    void *block = &face_context_arena[face_context_arena_used];
+    face_context_arena_used += size;
+    return block;
+}
+
+// BACKUP mode powers down RAM, so ordinarily every face comes back cold: setup reallocates
+// and reinitializes each context from scratch. movement_enter_backup_mode() instead
+// serializes the face context arena and the context table into a file before powering
+// down, and stamps the payload's CRC into backup register 3 (the one register movement
+// doesn't already use). On wake, if the register matches the file, the arena is restored
+// in place before face setup runs; each face then finds its context pointer non-NULL and
+// skips cold initialization, exactly as it does on a soft relaunch.
+
+#define MOVEMENT_SNAPSHOT_FILENAME "backup.bin"
+#define MOVEMENT_SNAPSHOT_REGISTER 3
+
+typedef struct {
+    uint32_t fingerprint;   // CRC of the face table, so a different firmware build ignores the snapshot
+    uint32_t arena_used;
+    int32_t context_offsets[MOVEMENT_NUM_FACES];    // offset into the arena, or -1 for no context
+    uint8_t current_face;
+    uint8_t padding[3];
+} movement_snapshot_header_t;
+
+static bool snapshot_restored;
+static int32_t snapshot_offsets[MOVEMENT_NUM_FACES];
+
+static uint32_t _movement_snapshot_fingerprint(void) {
+    return watch_crc32(0xFFFFFFFF, watch_faces, sizeof(watch_faces));
+}
+
+void movement_enter_backup_mode(void) {
+    movement_snapshot_header_t header;
+    header.fingerprint = _movement_snapshot_fingerprint();
+    header.arena_used = face_context_arena_used;
+    header.current_face = movement_state.current_watch_face;
+    memset(header.padding, 0, sizeof(header.padding));
+    for (uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        uint8_t *context = (uint8_t *)watch_face_contexts[i];
+        if (context >= face_context_arena && context < face_context_arena + MOVEMENT_FACE_CONTEXT_ARENA_SIZE) {
+            header.context_offsets[i] = context - face_context_arena;
+        } else {
+            header.context_offsets[i] = -1; // no context, or one that fell back to the heap
+        }
+    }
+
+    if (filesystem_write_file(MOVEMENT_SNAPSHOT_FILENAME, (char *)&header, sizeof(header)) &&
+        filesystem_append_file(MOVEMENT_SNAPSHOT_FILENAME, (char *)face_context_arena, face_context_arena_used)) {
+        uint32_t crc = watch_crc32(0xFFFFFFFF, &header, sizeof(header));
+        crc = watch_crc32(crc, face_context_arena, face_context_arena_used);
+        watch_store_backup_data(crc, MOVEMENT_SNAPSHOT_REGISTER);
+    } else {
+        watch_store_backup_data(0, MOVEMENT_SNAPSHOT_REGISTER);
+    }
+
+    watch_store_backup_data(movement_state.settings.reg, 0);
+    watch_enter_backup_mode();
+}
+
+static void _movement_restore_snapshot(void) {
+    for (uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) snapshot_offsets[i] = -1;
+
+    uint32_t crc_expected = watch_get_backup_data(MOVEMENT_SNAPSHOT_REGISTER);
+    if (crc_expected == 0) return;
+    // the snapshot is one shot: clearing the register up front means a crash mid-restore
+    // falls back to a cold boot on the next reset instead of looping.
+    watch_store_backup_data(0, MOVEMENT_SNAPSHOT_REGISTER);
+
+    movement_snapshot_header_t header;
+    if (!filesystem_read_file_range(MOVEMENT_SNAPSHOT_FILENAME, (char *)&header, 0, sizeof(header))) return;
+    if (header.fingerprint != _movement_snapshot_fingerprint()) return;
+    if (header.arena_used > MOVEMENT_FACE_CONTEXT_ARENA_SIZE) return;
+    if (!filesystem_read_file_range(MOVEMENT_SNAPSHOT_FILENAME, (char *)face_context_arena, sizeof(header), header.arena_used)) return;
+
+    uint32_t crc = watch_crc32(0xFFFFFFFF, &header, sizeof(header));
+    crc = watch_crc32(crc, face_context_arena, header.arena_used);
+    if (crc != crc_expected) {
+        memset(face_context_arena, 0, header.arena_used);
+        return;
+    }
+
+    face_context_arena_used = header.arena_used;
+    memcpy(snapshot_offsets, header.context_offsets, sizeof(snapshot_offsets));
+    if (header.current_face < MOVEMENT_NUM_FACES) movement_state.current_watch_face = header.current_face;
+    snapshot_restored = true;
+}
+
+// The hardfault flight recorder. A crash used to mean a silent reset with no trail; now
+// the fault handler stashes the stacked PC and LR plus a tag word (magic, active face,
+// event in flight) in backup registers 4-6 — which survive any reset, the RTC never
+// powers down — and resets. The next boot takes the warm path (the RTC is running, so
+// face state comes back through the snapshot service where one exists) and appends the
+// record to a small ring on the filesystem, timestamped with the boot time. Total
+// downtime is one reset plus the warm boot.
+
+#define MOVEMENT_CRASH_LOG_FILENAME "crash.log"
+#define MOVEMENT_CRASH_MAX_RECORDS 8
+#define MOVEMENT_CRASH_PC_REGISTER 4
+#define MOVEMENT_CRASH_LR_REGISTER 5
+#define MOVEMENT_CRASH_TAG_REGISTER 6
+#define MOVEMENT_CRASH_MAGIC 0xFA170000     // high half of the tag word; low half is face << 8 | event
+
+typedef struct {
+    uint32_t timestamp;     // when the record was logged, i.e. the boot right after the crash
+    uint32_t pc;            // the faulting instruction; look it up with addr2line
+    uint32_t lr;            // the caller (or EXC_RETURN if the fault hit in an interrupt)
+    uint8_t face_index;
+    uint8_t event_type;
+    uint8_t padding[2];
+} movement_crash_record_t;
+
+#if !__EMSCRIPTEN__
+// the C half of the fault handler, entered with a pointer to the stacked exception frame.
+static void __attribute__((used)) _movement_hardfault_record(uint32_t *frame) {
+    watch_store_backup_data(frame[6], MOVEMENT_CRASH_PC_REGISTER);      // stacked PC
+    watch_store_backup_data(frame[5], MOVEMENT_CRASH_LR_REGISTER);      // stacked LR
+    watch_store_backup_data(MOVEMENT_CRASH_MAGIC |
+                            ((uint32_t)movement_state.current_watch_face << 8) |
+                            last_event_dispatched, MOVEMENT_CRASH_TAG_REGISTER);
+    while (RTC->MODE0.SYNCBUSY.reg);    // let the backup register writes land before we reset
+    NVIC_SystemReset();
+}
+
+// overrides the weak handler in startup_saml22.c. Naked so the compiler's prologue can't
+// disturb the stack before we capture it: MSP still points at the stacked frame (this
+// firmware has no process stack), and the C half does the rest.
+__attribute__((naked)) void HardFault_Handler(void) {
+    __asm volatile (
+        "mrs r0, msp                        \n"
+        "ldr r1, =_movement_hardfault_record \n"
+        "bx r1                              \n"
+    );
+}
+#endif
+
+static void _movement_log_pending_crash(void) {
+    uint32_t tag = watch_get_backup_data(MOVEMENT_CRASH_TAG_REGISTER);
+    if ((tag & 0xFFFF0000) != MOVEMENT_CRASH_MAGIC) return;
+    // clear the tag first so a crash while logging can't loop.
+    watch_store_backup_data(0, MOVEMENT_CRASH_TAG_REGISTER);
+
+    movement_crash_record_t record;
+    record.timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    record.pc = watch_get_backup_data(MOVEMENT_CRASH_PC_REGISTER);
+    record.lr = watch_get_backup_data(MOVEMENT_CRASH_LR_REGISTER);
+    record.face_index = (tag >> 8) & 0xFF;
+    record.event_type = tag & 0xFF;
+    memset(record.padding, 0, sizeof(record.padding));
+    filesystem_ringlog_create(MOVEMENT_CRASH_LOG_FILENAME, sizeof(record), MOVEMENT_CRASH_MAX_RECORDS);
+    filesystem_ringlog_append(MOVEMENT_CRASH_LOG_FILENAME, (void *)&record);
+    printf("hardfault: pc %08lx lr %08lx face %u event %u\n",
+           (unsigned long)record.pc, (unsigned long)record.lr, record.face_index, record.event_type);
+}
+
+void movement_print_crash_log(void) {
+    int16_t count = filesystem_ringlog_count(MOVEMENT_CRASH_LOG_FILENAME);
+    if (count <= 0) {
+        printf("no crashes recorded\n");
+        return;
+    }
+    for (int16_t i = 0; i < count; i++) {
+        movement_crash_record_t record;
+        if (!filesystem_ringlog_read(MOVEMENT_CRASH_LOG_FILENAME, (uint8_t)i, (void *)&record)) break;
+        printf("%lu: pc %08lx lr %08lx face %u event %u\n", (unsigned long)record.timestamp,
+               (unsigned long)record.pc, (unsigned long)record.lr, record.face_index, record.event_type);
+    }
+}
+
+void WATCH_COLD app_init(void) {
+    // waking from BACKUP mode? the RTC, which never powers down, is the tell. A warm
+    // boot skips work whose result survived the power-down: the frequency trim is still
+    // programmed (and the drift engine reprograms it from the reference log momentarily
+    // anyway, so the static value below is only a cold-boot seed), and the wrist-raise
+    // engine on the accelerometer is still running — quite possibly the thing that woke
+    // us, which a cold wrist_raise_begin would soft-reset mid-gesture.
+    bool warm_boot = _watch_rtc_is_enabled();
+
+    if (!warm_boot) {
 #ifdef WATCH_IS_BLUE_BOARD
-    watch_rtc_freqcorr_write(11, 0);
+        watch_rtc_freqcorr_write(11, 0);
 #else
-    watch_rtc_freqcorr_write(22, 0);
+        watch_rtc_freqcorr_write(22, 0);
 #endif
+    }
 
     memset(&movement_state, 0, sizeof(movement_state));
 
@@ -330,12 +1498,24 @@ void app_init(void) {
     movement_state.settings.bit.button_should_sound = true;
     movement_state.settings.bit.le_interval = 1;
     movement_state.settings.bit.led_duration = 1;
-    movement_state.light_ticks = -1;
     movement_state.alarm_ticks = -1;
-    movement_state.next_available_backup_register = 4;
+    movement_state.next_available_backup_register = 7;
     _movement_reset_inactivity_countdown();
 
     filesystem_init();
+    movement_drift_init();
+    _movement_log_pending_crash();
+    _movement_load_face_order();
+
+#ifdef MOVEMENT_WRIST_RAISE
+#ifdef MOVEMENT_WRIST_RAISE_LED
+    if (warm_boot) wrist_raise_resume(cb_wrist_raised, cb_wrist_raised_in_dark);
+    else wrist_raise_begin(cb_wrist_raised, cb_wrist_raised_in_dark);
+#else
+    if (warm_boot) wrist_raise_resume(cb_wrist_raised, NULL);
+    else wrist_raise_begin(cb_wrist_raised, NULL);
+#endif
+#endif
 
 #if __EMSCRIPTEN__
     int32_t time_zone_offset = EM_ASM_INT({
@@ -350,12 +1530,37 @@ void app_init(void) {
 #endif
 }
 
-void app_wake_from_backup(void) {
+void WATCH_COLD app_wake_from_backup(void) {
     movement_state.settings.reg = watch_get_backup_data(0);
+    _movement_refresh_settings_cache();
+    _movement_restore_snapshot();
 }
 
-void app_setup(void) {
+// probe the I2C bus once for the sensors a board can carry. The findings live in the
+// settings register's spare bits, so they ride to BKUP[0] with the store below and come
+// back through app_wake_from_backup: warm boots reuse the cached bitmap instead of
+// re-running the bus round-trips, while a cold boot zeroes sensor_probe_done — exactly
+// when the topology could have changed out from under us.
+static void WATCH_COLD _movement_probe_sensors(void) {
+    if (movement_state.settings.bit.sensor_probe_done) return;
+#if __EMSCRIPTEN__
+    // the simulator emulates both sensors.
+    movement_state.settings.bit.has_accelerometer = true;
+    movement_state.settings.bit.has_light_sensor = true;
+#else
+    watch_enable_i2c();
+    movement_state.settings.bit.has_accelerometer = (lis2dw_get_device_id() == LIS2DW_WHO_AM_I_VAL);
+    // the OPT3001 sits at 0x44 on the sensor board and answers 0x5449 ("TI").
+    movement_state.settings.bit.has_light_sensor = (opt3001_readManufacturerID(0x44) == 0x5449);
+    watch_disable_i2c();
+#endif
+    movement_state.settings.bit.sensor_probe_done = true;
+}
+
+void WATCH_COLD app_setup(void) {
+    _movement_probe_sensors();
     watch_store_backup_data(movement_state.settings.reg, 0);
+    _movement_refresh_settings_cache();
 
     static bool is_first_launch = true;
 
@@ -364,9 +1569,20 @@ void app_setup(void) {
         MOVEMENT_CUSTOM_BOOT_COMMANDS()
         #endif
 
+        num_background_task_faces = 0;
+        next_scheduled_task.reg = 0;
+#ifdef MOVEMENT_FAVORITE_FACES
+        _movement_compute_favorite_order();
+#endif
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-            watch_face_contexts[i] = NULL;
+            // hand a face its restored context when we have one; setup sees it non-NULL
+            // and skips cold initialization.
+            if (snapshot_restored && snapshot_offsets[i] >= 0) watch_face_contexts[i] = &face_context_arena[snapshot_offsets[i]];
+            else watch_face_contexts[i] = NULL;
             scheduled_tasks[i].reg = 0;
+            // don't register background tasks for faces whose sensor isn't on this board;
+            // without the part their minute-sweep polls could never produce useful work.
+            if (watch_faces[i].wants_background_task != NULL && _movement_face_available(i)) background_task_faces[num_background_task_faces++] = i;
             is_first_launch = false;
         }
 
@@ -376,7 +1592,12 @@ void app_setup(void) {
         alarm_time.unit.second = 59; // after a match, the alarm fires at the next rising edge of CLK_RTC_CNT, so 59 seconds lets us update at :00
         watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
     }
-    if (movement_state.le_mode_ticks != -1) {
+    // the wake block below is for cold boots and wakes from BACKUP; waking out of low
+    // energy mode takes the lightweight exit in app_loop instead, which skips the display
+    // reprogramming and the per-face setup pass. (watch_enter_sleep_mode calls app_setup
+    // on every low energy wake, including the final one, so without the le_sleeping gate
+    // the full block would run twice per exit.)
+    if (movement_state.le_mode_ticks != -1 && !movement_state.le_sleeping) {
         watch_disable_extwake_interrupt(BTN_ALARM);
 
         watch_enable_external_interrupts();
@@ -387,23 +1608,43 @@ void app_setup(void) {
         watch_enable_buzzer();
         watch_enable_leds();
         watch_enable_display();
+        _movement_invalidate_display_shadow();
+
+        // if the LCD tuning face saved per-unit drive settings, reapply them over the
+        // stock configuration watch_enable_display just programmed.
+        watch_lcd_drive_t lcd_drive;
+        if (filesystem_get_file_size(MOVEMENT_LCD_TUNING_FILENAME) == (int32_t)sizeof(lcd_drive) &&
+            filesystem_read_file(MOVEMENT_LCD_TUNING_FILENAME, (char *)&lcd_drive, sizeof(lcd_drive))) {
+            watch_set_lcd_drive(&lcd_drive);
+        }
 
         movement_request_tick_frequency(1);
 
+        // faces that have already run setup get it again so they can re-init hardware
+        // this wake may have powered down; faces never yet visited stay cold until
+        // their first activation or background task.
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-            watch_faces[i].setup(&movement_state.settings, i, &watch_face_contexts[i]);
+            if (face_is_set_up[i]) _movement_face_setup(i);
         }
+        _movement_ensure_face_setup(0);
+        _movement_ensure_face_setup(movement_state.current_watch_face);
 
-        watch_faces[movement_state.current_watch_face].activate(&movement_state.settings, watch_face_contexts[movement_state.current_watch_face]);
+        _movement_face_activate(movement_state.current_watch_face);
         event.subsecond = 0;
         event.event_type = EVENT_ACTIVATE;
     }
 }
 
 void app_prepare_for_standby(void) {
+    uint32_t now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    if (wake_ledger_last_transition) wake_ledger.active_seconds += now - wake_ledger_last_transition;
+    wake_ledger_last_transition = now;
 }
 
 void app_wake_from_standby(void) {
+    uint32_t now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    if (wake_ledger_last_transition) wake_ledger.standby_seconds += now - wake_ledger_last_transition;
+    wake_ledger_last_transition = now;
 }
 
 static void _sleep_mode_app_loop(void) {
@@ -413,84 +1654,176 @@ static void _sleep_mode_app_loop(void) {
         // we also have to handle background tasks here in the mini-runloop
         if (movement_state.needs_background_tasks_handled) _movement_handle_background_tasks();
 
-        event.event_type = EVENT_LOW_ENERGY_UPDATE;
-        watch_faces[movement_state.current_watch_face].loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_watch_face]);
+        // scheduled deadlines (chimes, alarms) must still fire down here: the minute alarm
+        // wakes us once a minute, and anything due or overdue plays now.
+        if (movement_state.has_scheduled_background_task) _movement_handle_scheduled_tasks();
+
+        // faces that provide the lean le_update hook get it in place of the full event pipeline.
+        if (watch_faces[movement_state.current_watch_face].le_update != NULL) {
+            watch_faces[movement_state.current_watch_face].le_update(watch_rtc_get_date_time(), watch_face_contexts[movement_state.current_watch_face]);
+        } else {
+            event.event_type = EVENT_LOW_ENERGY_UPDATE;
+            _movement_dispatch_loop(movement_state.current_watch_face, event);
+        }
 
         // if we need to wake immediately, do it!
         if (movement_state.needs_wake) return;
         // otherwise enter sleep mode, and when the extwake handler is called, it will reset le_mode_ticks and force us out at the next loop.
-        else watch_enter_sleep_mode();
+        // bracketed with the standby hooks so low energy naps land in the wake ledger too.
+        else {
+            app_prepare_for_standby();
+            watch_enter_sleep_mode();
+            app_wake_from_standby();
+        }
     }
 }
 
 bool app_loop(void) {
+    // pull the next queued interrupt event, if the previous one has been consumed. if more
+    // events are waiting behind it, the returns below report "can't sleep" so the main loop
+    // calls us straight back and one wake drains the whole burst in order.
+    if (event.event_type == EVENT_NONE) _movement_pop_event();
+
+    // Fast path: a plain tick with no housekeeping pending can dispatch straight to the active
+    // face. All of the conditions the full pass below checks are mirrored in pending_work, so one
+    // test of that bitmask covers them; this is the path the system takes on nearly every tick,
+    // and keeping it short lets the CPU return to STANDBY sooner at fast tick frequencies.
+    if (event.event_type == EVENT_TICK && movement_state.pending_work == 0 && !watch_is_usb_enabled()) {
+        event.subsecond = movement_state.subsecond;
+        bool face_can_sleep = _movement_dispatch_loop(movement_state.current_watch_face, event);
+        event.event_type = EVENT_NONE;
+        event.subsecond = 0;
+        // the loop function may have changed faces or started the LED/buzzer; those set pending_work.
+        return face_can_sleep && movement_state.pending_work == 0 && _movement_event_queue_empty();
+    }
+
     if (movement_state.watch_face_changed) {
         if (movement_state.settings.bit.button_should_sound) {
             // low note for nonzero case, high note for return to watch_face 0
-            watch_buzzer_play_note(movement_state.next_watch_face ? BUZZER_NOTE_C7 : BUZZER_NOTE_C8, 50);
+            static int8_t beep_seq[] = {0, 3, 0};
+            beep_seq[0] = movement_state.next_watch_face ? BUZZER_NOTE_C7 : BUZZER_NOTE_C8;
+            watch_set_buzzer_volume(movement_state.buzzer_volume);
+            watch_buzzer_play_sequence(beep_seq, NULL);
         }
-        watch_faces[movement_state.current_watch_face].resign(&movement_state.settings, watch_face_contexts[movement_state.current_watch_face]);
+        // the outgoing face's sliced computation (if any) dies with it.
+        movement_cancel_continuation();
+        _movement_face_resign(movement_state.current_watch_face);
+        // resign functions are a documented place to commit settings edits; refresh here so
+        // the incoming face's activate sees the decoded cache current.
+        _movement_refresh_settings_cache();
         movement_state.current_watch_face = movement_state.next_watch_face;
+        movement_state.scheduled_wake.reg = 0; // any scheduled wake belonged to the outgoing face
+        peek_face_index = -1; // a peek in progress dies with the face that started it
         watch_clear_display();
+        _movement_invalidate_display_shadow();
         movement_request_tick_frequency(1);
-        watch_faces[movement_state.current_watch_face].activate(&movement_state.settings, watch_face_contexts[movement_state.current_watch_face]);
+        _movement_ensure_face_setup(movement_state.current_watch_face);
+        _movement_face_activate(movement_state.current_watch_face);
         event.subsecond = 0;
         event.event_type = EVENT_ACTIVATE;
         movement_state.watch_face_changed = false;
+        movement_state.pending_work &= ~MOVEMENT_WORK_FACE_CHANGED;
     }
 
-    // if the LED should be off, turn it off
-    if (movement_state.light_ticks == 0) {
-        // unless the user is holding down the LIGHT button, in which case, give them more time.
-        if (watch_get_pin_level(BTN_LIGHT)) {
-            movement_state.light_ticks = 1;
-        } else {
-            watch_set_led_off();
-            movement_state.light_ticks = -1;
-            _movement_disable_fast_tick_if_possible();
-        }
-    }
+    // shift the tick frequency if the governor asked for it (idle downshift or post-press
+    // restore); this runs before the event dispatch below so a button event reaching the
+    // face already sees its requested frequency back in force.
+    if (movement_state.pending_work & MOVEMENT_WORK_TICK_GOVERNOR) _movement_apply_tick_governor();
 
     // handle background tasks, if the alarm handler told us we need to
     if (movement_state.needs_background_tasks_handled) _movement_handle_background_tasks();
 
-    // if we have a scheduled background task, handle that here:
-    if (event.event_type == EVENT_TICK && movement_state.has_scheduled_background_task) _movement_handle_scheduled_tasks();
+    // if a face suspended its tick and scheduled a wake, deliver a tick when the time arrives.
+    // this check piggybacks on the minute alarm, so wakes have one-minute resolution.
+    if (movement_state.scheduled_wake.reg) {
+        watch_date_time now = watch_rtc_get_date_time();
+        if (now.reg >= movement_state.scheduled_wake.reg) {
+            movement_state.scheduled_wake.reg = 0;
+            event.event_type = EVENT_TICK;
+            _movement_reset_inactivity_countdown();
+        }
+    }
+
+    // if we have a scheduled background task, handle that here. Not gated on EVENT_TICK:
+    // a face that suspended its tick still wakes on the minute alarm, and the head-of-queue
+    // compare inside makes this a single load when nothing is due.
+    if (movement_state.has_scheduled_background_task) _movement_handle_scheduled_tasks();
 
     // if we have timed out of our low energy mode countdown, enter low energy mode.
     if (movement_state.le_mode_ticks == 0) {
         movement_state.le_mode_ticks = -1;
+        movement_state.le_sleeping = true;
+        movement_state.pending_work &= ~MOVEMENT_WORK_LE_MODE;
         watch_register_extwake_callback(BTN_ALARM, cb_alarm_btn_extwake, true);
+        // low energy mode won't run continuation slices; cancel rather than letting one
+        // stall half-finished until the next wake. the face can re-register on activate.
+        movement_cancel_continuation();
+        // no point lingering the I2C bus into a low energy stretch; cut it now.
+        _watch_i2c_quiesce(true);
+        // the display only changes once a minute down here; slow its drive to match.
+        watch_display_enter_low_power_mode();
         event.event_type = EVENT_NONE;
         event.subsecond = 0;
 
         // _sleep_mode_app_loop takes over at this point and loops until le_mode_ticks is reset by the extwake handler,
         // or wake is requested using the movement_request_wake function.
         _sleep_mode_app_loop();
-        // as soon as _sleep_mode_app_loop returns, we reactivate ourselves.
+        // lightweight exit: the sleeps in there turned off every pin and peripheral except
+        // the RTC and the SLCD, so the buttons, buzzer and LED need re-driving — but the
+        // display kept showing the face's low energy rendering and the shadow tracking it
+        // is still accurate, the face's context never went anywhere, and one EVENT_ACTIVATE
+        // (no resign, no per-face setup pass, no display clear) brings it back: its repaint
+        // filters through the intact shadow, so only segments that actually differ from
+        // the low energy rendering get rewritten.
+        movement_state.le_sleeping = false;
+        watch_display_exit_low_power_mode();
+        watch_disable_extwake_interrupt(BTN_ALARM);
+        watch_enable_external_interrupts();
+        watch_register_interrupt_callback(BTN_MODE, cb_mode_btn_interrupt, INTERRUPT_TRIGGER_BOTH);
+        watch_register_interrupt_callback(BTN_LIGHT, cb_light_btn_interrupt, INTERRUPT_TRIGGER_BOTH);
+        watch_register_interrupt_callback(BTN_ALARM, cb_alarm_btn_interrupt, INTERRUPT_TRIGGER_BOTH);
+        watch_enable_buzzer();
+        watch_enable_leds();
+        // faces start the tick animation from their low energy handlers; they expect
+        // activate-with-fresh-display to have stopped it, so stop it for them here.
+        if (watch_tick_animation_is_running()) watch_stop_tick_animation();
+        movement_request_tick_frequency(1);
+        event.subsecond = 0;
         event.event_type = EVENT_ACTIVATE;
-        // this is a hack tho: waking from sleep mode, app_setup does get called, but it happens before we have reset our ticks.
-        // need to figure out if there's a better heuristic for determining how we woke up.
-        app_setup();
     }
 
     static bool can_sleep = true;
 
     if (event.event_type) {
         event.subsecond = movement_state.subsecond;
-        can_sleep = watch_faces[movement_state.current_watch_face].loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_watch_face]);
+        can_sleep = _movement_dispatch_loop(movement_state.current_watch_face, event);
         event.event_type = EVENT_NONE;
     }
 
+    // run budgeted slices of any in-progress continuation. Bailing out when an event has
+    // queued keeps button latency bounded by one slice rather than the whole computation;
+    // holding can_sleep false brings us straight back for the next batch.
+    if (continuation_fn) {
+        for (uint8_t i = 0; i < MOVEMENT_CONTINUATION_SLICES_PER_PASS; i++) {
+            if (continuation_fn(continuation_context)) {
+                movement_cancel_continuation();
+                break;
+            }
+            if (!_movement_event_queue_empty()) break;
+        }
+        if (continuation_fn) can_sleep = false;
+    }
+
     // if we have timed out of our timeout countdown, give the app a hint that they can resign.
     if (movement_state.timeout_ticks == 0) {
         movement_state.timeout_ticks = -1;
+        movement_state.pending_work &= ~MOVEMENT_WORK_TIMEOUT;
         if (movement_state.settings.bit.to_always == false) {
             // if "timeout always" is false, give the current watch face a chance to exit gracefully...
             event.event_type = EVENT_TIMEOUT;
         }
         event.subsecond = movement_state.subsecond;
-        watch_faces[movement_state.current_watch_face].loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_watch_face]);
+        _movement_dispatch_loop(movement_state.current_watch_face, event);
         event.event_type = EVENT_NONE;
         if (movement_state.settings.bit.to_always && movement_state.current_watch_face != 0) {
             // ...but if the user has "timeout always" set, give it the boot.
@@ -504,13 +1837,14 @@ bool app_loop(void) {
         if(buzzer_phase == 127) {
             // failsafe: buzzer could have been disabled in the meantime
             if (!watch_is_buzzer_or_led_enabled()) watch_enable_buzzer();
-            // play 4 beeps plus pause
-            for(uint8_t i = 0; i < 4; i++) {
-                // TODO: This method of playing the buzzer blocks the UI while it's beeping.
-                // It might be better to time it with the fast tick.
-                watch_buzzer_play_note(movement_state.alarm_note, (i != 3) ? 50 : 75);
-                if (i != 3) watch_buzzer_play_note(BUZZER_NOTE_REST, 50);
-            }
+            // play 4 beeps plus pause through the sequencer: three beep/rest pairs
+            // via the repeat marker, then a longer final beep. this no longer blocks
+            // the UI; the TC3 interrupt advances the notes while the core sleeps.
+            static int8_t alarm_seq[] = {0, 3, BUZZER_NOTE_REST, 3, -2, 2, 0, 5, 0};
+            alarm_seq[0] = alarm_seq[6] = movement_state.alarm_note;
+            // an alarm's job is to wake the wearer; it overrides any quiet volume class.
+            watch_set_buzzer_volume(WATCH_BUZZER_VOLUME_FULL);
+            watch_buzzer_play_sequence(alarm_seq, NULL);
         }
         if (movement_state.alarm_ticks == 0) {
             movement_state.alarm_ticks = -1;
@@ -520,8 +1854,8 @@ bool app_loop(void) {
 
     // if we are plugged into USB, handle the file browser tasks
     if (watch_is_usb_enabled()) {
-        char line[256] = {0};
 #if __EMSCRIPTEN__
+        char line[256] = {0};
         // This is a terrible hack; ideally this should be handled deeper in the watch library.
         // Alas, emscripten treats read() as something that should pop up an input box, so I
         // wasn't able to implement this over there. I sense that this relates to read() being
@@ -538,10 +1872,17 @@ bool app_loop(void) {
         EM_ASM({
             tx = "";
         });
+        int len = strlen(line);
+        if (filesystem_transfer_in_progress()) filesystem_process_transfer(line, len);
+        else if (strlen(line)) filesystem_process_command(line);
 #else
-        read(0, line, 256);
+        // the incremental shell: echoes input as it arrives, dispatches completed
+        // lines, and resumes any command that yielded mid-output (so a long cat
+        // never stalls the tick loop). The fsload drain loop lives in there too.
+        // A pending slice holds off sleep; otherwise the CPU idles between USB
+        // interrupts, since tinyusb is serviced from the interrupt now, not here.
+        if (filesystem_shell_task()) can_sleep = false;
 #endif
-        if (strlen(line)) filesystem_process_command(line);
     }
 
     event.subsecond = 0;
@@ -549,10 +1890,10 @@ bool app_loop(void) {
     // if the watch face changed, we can't sleep because we need to update the display.
     if (movement_state.watch_face_changed) can_sleep = false;
 
-    // if the buzzer or the LED is on, we need to stay awake to keep the TCC running.
-    if (movement_state.is_buzzing || movement_state.light_ticks != -1) can_sleep = false;
+    // the LED and buzzer no longer block sleep: the auto-off engine and the buzzer
+    // sequencer both run the TCC and their timer in standby mode.
 
-    return can_sleep;
+    return can_sleep && _movement_event_queue_empty();
 }
 
 static movement_event_type_t _figure_out_button_event(bool pin_level, movement_event_type_t button_down_event_type, uint16_t *down_timestamp) {
@@ -565,77 +1906,154 @@ static movement_event_type_t _figure_out_button_event(bool pin_level, movement_e
         *down_timestamp = movement_state.fast_ticks + 1;
         return button_down_event_type;
     } else {
-        // this line is hack but it handles the situation where the light button was held for more than 20 seconds.
-        // fast tick is disabled by then, and the LED would get stuck on since there's no one left decrementing light_ticks.
-        if (movement_state.light_ticks == 1) movement_state.light_ticks = 0;
-        // now that that's out of the way, handle falling edge
+        // handle falling edge
+        bool long_press_fired = (*down_timestamp == MOVEMENT_LONG_PRESS_LATCHED);
         uint16_t diff = movement_state.fast_ticks - *down_timestamp;
         *down_timestamp = 0;
         _movement_disable_fast_tick_if_possible();
         // any press over a half second is considered a long press. Fire the long-up event
-        if (diff > MOVEMENT_LONG_PRESS_TICKS) return button_down_event_type + 3;
+        if (long_press_fired || diff > MOVEMENT_LONG_PRESS_TICKS) return button_down_event_type + 3;
         else return button_down_event_type + 1;
     }
 }
 
 void cb_light_btn_interrupt(void) {
     bool pin_level = watch_get_pin_level(BTN_LIGHT);
+    wake_ledger.button_wakes++;
+    _movement_tick_governor_poke();
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_LIGHT_BUTTON_DOWN, &movement_state.light_down_timestamp);
+    _movement_push_event(_figure_out_button_event(pin_level, EVENT_LIGHT_BUTTON_DOWN, &movement_state.light_down_timestamp));
 }
 
 void cb_mode_btn_interrupt(void) {
     bool pin_level = watch_get_pin_level(BTN_MODE);
+    wake_ledger.button_wakes++;
+    _movement_tick_governor_poke();
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_MODE_BUTTON_DOWN, &movement_state.mode_down_timestamp);
+    _movement_push_event(_figure_out_button_event(pin_level, EVENT_MODE_BUTTON_DOWN, &movement_state.mode_down_timestamp));
 }
 
 void cb_alarm_btn_interrupt(void) {
     bool pin_level = watch_get_pin_level(BTN_ALARM);
+    wake_ledger.button_wakes++;
+    _movement_tick_governor_poke();
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_ALARM_BUTTON_DOWN, &movement_state.alarm_down_timestamp);
+    _movement_push_event(_figure_out_button_event(pin_level, EVENT_ALARM_BUTTON_DOWN, &movement_state.alarm_down_timestamp));
 }
 
 void cb_alarm_btn_extwake(void) {
     // wake up!
+    wake_ledger.button_wakes++;
+    _movement_reset_inactivity_countdown();
+}
+
+void cb_motion_wake_interrupt(void) {
+    // a sensor interrupt line registered with movement_enable_motion_wake saw a rising edge.
+    wake_ledger.motion_wakes++;
+    _movement_tick_governor_poke();
     _movement_reset_inactivity_countdown();
+    _movement_push_event(EVENT_MOTION_WAKE);
 }
 
+#ifdef MOVEMENT_WRIST_RAISE
+static void cb_wrist_raised(void) {
+    // the wearer turned the dial up to look at it. In low energy mode there's nothing
+    // to do here: the interrupt itself pulled us out of standby, and _sleep_mode_app_loop
+    // repaints the display on every wake — the raise just makes that happen now instead
+    // of at the minute boundary, without leaving low energy mode. In normal mode, treat
+    // it as wearer attention, the same as a button press.
+    wake_ledger.motion_wakes++;
+    if (movement_state.le_mode_ticks == -1) return;
+    _movement_tick_governor_poke();
+    _movement_reset_inactivity_countdown();
+}
+
+#ifdef MOVEMENT_WRIST_RAISE_LED
+static void cb_wrist_raised_in_dark(void) {
+    // the lux one-shot came back dark: light up. The hardware auto-off engine times
+    // the LED out on its own, so this is safe even from low energy mode's standby loop.
+    movement_illuminate_led();
+}
+#endif
+#endif
+
 void cb_alarm_fired(void) {
+    wake_ledger.alarm_wakes++;
     movement_state.needs_background_tasks_handled = true;
+    movement_state.pending_work |= MOVEMENT_WORK_BACKGROUND_TASKS;
+    if (movement_state.tick_frequency == 0) {
+        // with the tick suspended, the minute alarm is our only periodic wake; advance the
+        // inactivity countdowns here so low energy mode still engages on schedule.
+        if ((movement_state.settings.bit.le_interval || movement_state.battery_state == MOVEMENT_BATTERY_CRITICAL) && movement_state.le_mode_ticks > 0) {
+            movement_state.le_mode_ticks = (movement_state.le_mode_ticks > 60) ? movement_state.le_mode_ticks - 60 : 0;
+            if (movement_state.le_mode_ticks == 0) movement_state.pending_work |= MOVEMENT_WORK_LE_MODE;
+        }
+        if (movement_state.timeout_ticks > 0) {
+            movement_state.timeout_ticks = (movement_state.timeout_ticks > 60) ? movement_state.timeout_ticks - 60 : 0;
+            if (movement_state.timeout_ticks == 0) movement_state.pending_work |= MOVEMENT_WORK_TIMEOUT;
+        }
+    }
 }
 
 void cb_fast_tick(void) {
+    wake_ledger.tick_wakes[7]++;
     movement_state.fast_ticks++;
-    if (movement_state.light_ticks > 0) movement_state.light_ticks--;
     if (movement_state.alarm_ticks > 0) movement_state.alarm_ticks--;
-    // check timestamps and auto-fire the long-press events
+    // check timestamps and auto-fire the long-press events. once a button's long press has fired
+    // we latch its timestamp: the release edge only needs to know that the press was long, so the
+    // fast tick has nothing left to time for it and can stop if the LED and alarm are idle too.
     // Notice: is it possible that two or more buttons have an identical timestamp? In this case
     // only one of these buttons would receive the long press event. Don't bother for now...
-    if (movement_state.light_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.light_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1) 
-            event.event_type = EVENT_LIGHT_LONG_PRESS;
-    if (movement_state.mode_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.mode_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1) 
-            event.event_type = EVENT_MODE_LONG_PRESS;
-    if (movement_state.alarm_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.alarm_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1) 
-            event.event_type = EVENT_ALARM_LONG_PRESS;
+    if (_movement_button_needs_timing(movement_state.light_down_timestamp))
+        if (movement_state.fast_ticks - movement_state.light_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1) {
+            _movement_push_event(EVENT_LIGHT_LONG_PRESS);
+            movement_state.light_down_timestamp = MOVEMENT_LONG_PRESS_LATCHED;
+        }
+    if (_movement_button_needs_timing(movement_state.mode_down_timestamp))
+        if (movement_state.fast_ticks - movement_state.mode_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1) {
+            _movement_push_event(EVENT_MODE_LONG_PRESS);
+            movement_state.mode_down_timestamp = MOVEMENT_LONG_PRESS_LATCHED;
+        }
+    if (_movement_button_needs_timing(movement_state.alarm_down_timestamp))
+        if (movement_state.fast_ticks - movement_state.alarm_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1) {
+            _movement_push_event(EVENT_ALARM_LONG_PRESS);
+            movement_state.alarm_down_timestamp = MOVEMENT_LONG_PRESS_LATCHED;
+        }
+    _movement_disable_fast_tick_if_possible();
     // this is just a fail-safe; fast tick should be disabled as soon as the button is up, the LED times out, and/or the alarm finishes.
     // but if for whatever reason it isn't, this forces the fast tick off after 20 seconds.
     if (movement_state.fast_ticks >= 128 * 20) {
         watch_rtc_disable_periodic_callback(128);
         movement_state.fast_tick_enabled = false;
+        movement_state.pending_work &= ~MOVEMENT_WORK_FAST_TICK;
     }
 }
 
 void cb_tick(void) {
-    event.event_type = EVENT_TICK;
+    if (movement_state.tick_frequency) wake_ledger.tick_wakes[__builtin_ctz(movement_state.tick_frequency)]++;
+    _movement_push_event(EVENT_TICK);
     watch_date_time date_time = watch_rtc_get_date_time();
     if (date_time.unit.second != movement_state.last_second) {
         // TODO: can we consolidate these two ticks?
-        if (movement_state.settings.bit.le_interval && movement_state.le_mode_ticks > 0) movement_state.le_mode_ticks--;
-        if (movement_state.timeout_ticks > 0) movement_state.timeout_ticks--;
+        if ((movement_state.settings.bit.le_interval || movement_state.battery_state == MOVEMENT_BATTERY_CRITICAL) && movement_state.le_mode_ticks > 0) {
+            if (--movement_state.le_mode_ticks == 0) movement_state.pending_work |= MOVEMENT_WORK_LE_MODE;
+        }
+        if (movement_state.timeout_ticks > 0) {
+            if (--movement_state.timeout_ticks == 0) movement_state.pending_work |= MOVEMENT_WORK_TIMEOUT;
+        }
+
+        // adaptive tick governor: once the idle clock runs out, and as long as the active
+        // face declared a floor we haven't reached, ask the loop to shift down one octave.
+        if (movement_state.governor_idle_ticks < MOVEMENT_TICK_GOVERNOR_IDLE_SECONDS) {
+            movement_state.governor_idle_ticks++;
+        } else {
+            uint8_t tick_floor = watch_faces[movement_state.current_watch_face].tick_governor_floor;
+            if (tick_floor && movement_state.tick_frequency > tick_floor)
+                movement_state.pending_work |= MOVEMENT_WORK_TICK_GOVERNOR;
+        }
+
+        // let the I2C bus power down if its post-release linger window has run out.
+        _watch_i2c_quiesce(false);
 
         movement_state.last_second = date_time.unit.second;
         movement_state.subsecond = 0;
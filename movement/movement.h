@@ -31,7 +31,9 @@
 // Movement Preferences
 // These four 32-bit structs store information about the wearer and their preferences. Tentatively, the plan is
 // for Movement to use four 32-bit registers for these preferences and to store them in the RTC's backup registers
-// 0-3, leaving registers 4-7 available for third party watch faces to use as they see fit.
+// 0-3. Registers 4-6 are reserved for the hardfault flight recorder (faulting PC, LR, and a tag word with the
+// active face and event type — see movement_print_crash_log), leaving register 7 available to third party watch
+// faces via movement_claim_backup_register.
 // * The movement_settings_t struct is provided to all watch faces in the callback functions, and is stored in the
 //   RTC's first backup register (BKUP[0]).
 // * The movement_location_t and movement_birthdate_t types are defined here, and are tentatively meant to be
@@ -62,11 +64,41 @@ typedef union {
         bool clock_mode_24h : 1;            // indicates whether clock should use 12 or 24 hour mode.
         bool use_imperial_units : 1;        // indicates whether to use metric units (the default) or imperial.
         bool alarm_enabled : 1;             // indicates whether there is at least one alarm enabled.
-        uint8_t reserved : 6;               // room for more preferences if needed.
+
+        // not preferences: the boot-time sensor topology probe caches its findings here,
+        // because this register survives BACKUP mode (and zeroes on a cold boot, which is
+        // exactly when the I2C bus needs probing again). Read via movement_sensor_present.
+        bool sensor_probe_done : 1;         // the probe has run since the last cold boot
+        bool has_accelerometer : 1;         // LIS2DW answered its WHO_AM_I
+        bool has_light_sensor : 1;          // OPT3001 answered its manufacturer ID
+        uint8_t reserved : 3;               // room for more preferences if needed.
     } bit;
     uint32_t reg;
 } movement_settings_t;
 
+// movement_settings_cache_t is a decoded shadow of movement_settings_t: the same fields, but as
+// plain bytes instead of packed bitfields. Extracting a bitfield from settings->reg costs a
+// shift/mask sequence every time, which adds up in loop functions that run at up to 128 Hz.
+// Movement re-decodes the cache only when the packed register actually changes, so a hot loop
+// can read `movement_settings_cache.clock_mode_24h` as a single byte load. The cache is
+// read-only for faces: to change a setting, write settings->bit as usual and the cache follows
+// after your loop or resign function returns.
+typedef struct {
+    uint8_t button_should_sound;
+    uint8_t to_interval;
+    uint8_t to_always;
+    uint8_t le_interval;
+    uint8_t led_duration;
+    uint8_t led_red_color;
+    uint8_t led_green_color;
+    uint8_t time_zone;
+    uint8_t clock_mode_24h;
+    uint8_t use_imperial_units;
+    uint8_t alarm_enabled;
+} movement_settings_cache_t;
+
+extern movement_settings_cache_t movement_settings_cache;
+
 // movement_location_t is for storing the wearer's location. This will be useful for astronomical calculations such as
 // sunrise and sunset, or predictions of visible satellite passes.
 // If you create a UI for this register or need to access it, look for it in the RTC's BKUP[1] register.
@@ -94,6 +126,7 @@ typedef union {
 } movement_birthdate_t;
 
 // movement_reserved_t is a placeholder for future use of the BKUP[3] register.
+// (In practice BKUP[3] currently holds the context snapshot CRC; see movement_enter_backup_mode.)
 typedef union {
     struct {
         uint32_t reserved : 32;
@@ -101,6 +134,14 @@ typedef union {
     uint32_t reg;
 } movement_reserved_t;
 
+// Sensors the boot-time topology probe knows about. A face that is useless without one
+// can declare it in its watch_face_t (see required_sensor); zero means none required.
+typedef enum {
+    MOVEMENT_SENSOR_NONE = 0,
+    MOVEMENT_SENSOR_ACCELEROMETER,
+    MOVEMENT_SENSOR_LIGHT,
+} movement_sensor_t;
+
 typedef enum {
     EVENT_NONE = 0,             // There is no event to report.
     EVENT_ACTIVATE,             // Your watch face is entering the foreground.
@@ -120,14 +161,34 @@ typedef enum {
     EVENT_ALARM_BUTTON_UP,      // The alarm button was pressed for less than half a second, and released.
     EVENT_ALARM_LONG_PRESS,     // The alarm button was held for over half a second, but not yet released.
     EVENT_ALARM_LONG_UP,        // The alarm button was held for over half a second, and released.
+    EVENT_MOTION_WAKE,          // A sensor interrupt routed through movement_enable_motion_wake fired, i.e. the accelerometer's tap or wakeup engine detected motion.
 } movement_event_type_t;
 
 typedef struct {
     uint8_t event_type;
     uint8_t subsecond;
+    // the local date and time, sampled once as the event was dispatched. Prefer this over
+    // calling watch_rtc_get_date_time in your loop function: it's one RTC read per wake
+    // no matter how many handlers look at it, and every handler sees the same instant, so
+    // a midnight rollover can't slip in between two reads while processing one event.
+    // (If you set the RTC yourself mid-event, read it back fresh; this is the pre-event time.)
+    watch_date_time date_time;
 } movement_event_t;
 
 extern const int16_t movement_timezone_offsets[];
+
+// The DST-correct UTC offset for a time zone slot at the current moment, in seconds east
+// of UTC. The table above is each slot's fixed standard offset; this resolves the slot
+// against a compiled tzdata transition table (see zone_transitions.h), so zones that
+// observe DST shift automatically twice a year. The lookup caches the window between
+// the surrounding transitions, making it O(1) per call — fine to call every tick. Use
+// this rather than the table times 60 when converting the RTC's local time to unix time.
+int32_t movement_timezone_offset(uint8_t zone_index);
+
+// each zone's standard offset prerendered as the five characters the zone-picker screens
+// display (three-character signed hour, two-digit minute; the colon segment goes between).
+// Scrolling a zone list is a direct index here — no division or sprintf per redraw.
+extern const char movement_timezone_labels[][6];
 extern const char movement_valid_position_0_chars[];
 extern const char movement_valid_position_1_chars[];
 
@@ -231,12 +292,61 @@ typedef void (*watch_face_resign)(movement_settings_t *settings, void *context);
   */
 typedef bool (*watch_face_wants_background_task)(movement_settings_t *settings, void *context);
 
+/** @brief OPTIONAL. A lean display updater for low energy mode.
+  * @details If you provide this function, Movement calls it in place of your loop function's
+  *          EVENT_LOW_ENERGY_UPDATE once a minute while your face is in the foreground in low
+  *          energy mode, with the current date and time already read from the RTC. Skipping the
+  *          event pipeline (button state bookkeeping, subsecond tracking, settings marshaling)
+  *          keeps the once-a-minute wake as short as possible, which matters since minutes spent
+  *          in low energy mode dominate the battery budget. The same restrictions as
+  *          EVENT_LOW_ENERGY_UPDATE apply: all pins and peripherals other than the RTC and the
+  *          display are disabled, and you must not wake any of them here.
+  * @param date_time The current date and time, pre-read from the RTC.
+  * @param context A pointer to your application's context. @see watch_face_setup.
+  */
+typedef void (*watch_face_le_update)(watch_date_time date_time, void *context);
+
+/** @brief OPTIONAL. A stateless render of your face's display, for momentary peeks.
+  * @details If you provide this function, another face can show your display for a moment with
+  *          movement_peek_face without the full switch: your activate and resign hooks are not
+  *          called, you receive no events, and the peeking face stays in the foreground. Render
+  *          your current output into movement_get_display_buffer(), padding all ten positions
+  *          (Movement flushes the buffer and later restores the previous frame). Because nothing
+  *          about the peek is undone through your resign, you must not touch indicators, the
+  *          colon, peripherals, or the tick frequency here — just characters in the buffer.
+  * @param settings A pointer to the global Movement settings. @see watch_face_setup.
+  * @param context A pointer to your application's context. @see watch_face_setup.
+  */
+typedef void (*watch_face_peek)(movement_settings_t *settings, void *context);
+
 typedef struct {
     watch_face_setup setup;
     watch_face_activate activate;
     watch_face_loop loop;
     watch_face_resign resign;
     watch_face_wants_background_task wants_background_task;
+    watch_face_le_update le_update; // optional; may be omitted from the face's initializer
+    watch_face_peek peek; // optional; may be omitted from the face's initializer
+    // optional: the lowest tick frequency the adaptive governor may downshift to after
+    // MOVEMENT_TICK_GOVERNOR_IDLE_SECONDS without a button or motion event. Zero (the
+    // default for faces that omit it) opts out: the face keeps whatever it requested.
+    // Only declare a floor if your face's timekeeping doesn't depend on counting ticks —
+    // the governor restores the requested frequency on the next button press, but ticks
+    // skipped while idle are gone. Most high-rate display time happens with nobody
+    // looking, so a running stopwatch that draws at 16 Hz can declare a floor of 1.
+    uint8_t tick_governor_floor;
+    // optional: declare true if your face does heavy math on EVENT_ACTIVATE (ephemeris
+    // calculations, sunrise iteration). Movement then wraps that one event in
+    // watch_cpu_boost_begin/end, so the first render runs at 16 MHz and the watch gets
+    // back to sleep sooner. Don't declare it for faces that just draw on activate; the
+    // boost's regulator switch costs more than a cheap render saves.
+    bool cpu_boost_on_activate;
+    // optional: a movement_sensor_t this face is useless without. Movement checks it
+    // against the boot-time topology probe: the MODE-button ring skips the face and its
+    // background task is never registered when the sensor is absent, so a board without
+    // the part pays nothing for faces that need it. The face stays reachable by direct
+    // index (movement_move_to_face), so it should still fail gracefully on its own.
+    uint8_t required_sensor;
 } watch_face_t;
 
 typedef struct {
@@ -250,19 +360,22 @@ typedef struct {
     bool fast_tick_enabled;
     int16_t fast_ticks;
 
-    // LED stuff
-    int16_t light_ticks;
-
     // alarm stuff
     int16_t alarm_ticks;
-    bool is_buzzing;
     BuzzerNote alarm_note;
 
+    // volume class for discretionary sounds; alarms always play at full drive.
+    watch_buzzer_volume_t buzzer_volume;
+
     // button tracking for long press
     uint16_t light_down_timestamp;
     uint16_t mode_down_timestamp;
     uint16_t alarm_down_timestamp;
 
+    // housekeeping bitmask; mirrors the conditions app_loop checks before dispatching an event.
+    // when this is zero, a plain tick dispatches straight to the active face's loop function.
+    uint8_t pending_work;
+
     // background task handling
     bool needs_background_tasks_handled;
     bool has_scheduled_background_task;
@@ -270,15 +383,29 @@ typedef struct {
 
     // low energy mode countdown
     int32_t le_mode_ticks;
+    // true from low energy mode entry until the exit path in app_loop has run. while this
+    // is set, app_setup's wake block stands down: the lightweight exit keeps the face's
+    // context and the display (which stays powered through low energy sleep) untouched.
+    bool le_sleeping;
 
     // app resignation countdown (TODO: consolidate with LE countdown?)
     int16_t timeout_ticks;
 
+    // a one-shot wake scheduled with movement_request_wake_at (0 if none)
+    watch_date_time scheduled_wake;
+
     // stuff for subsecond tracking
     uint8_t tick_frequency;
     uint8_t last_second;
     uint8_t subsecond;
 
+    // adaptive tick governor (see tick_governor_floor in watch_face_t)
+    uint8_t tick_frequency_requested; // what the face asked for, before the governor touched it
+    uint8_t governor_idle_ticks;      // seconds since the last button or motion event, saturating
+
+    // battery-state engine (a movement_battery_state_t; see movement_get_battery_state)
+    uint8_t battery_state;
+
     // backup register stuff
     uint8_t next_available_backup_register;
 } movement_state_t;
@@ -286,12 +413,47 @@ typedef struct {
 void movement_move_to_face(uint8_t watch_face_index);
 void movement_move_to_next_face(void);
 
+// shows another face's display for a moment without switching to it: if the target face
+// provides a peek hook, its frame replaces yours on the glass but your face stays in the
+// foreground — no resign, no activate, and events keep coming to you. Call
+// movement_end_peek to put your frame back (a press-and-hold binding is the natural fit:
+// peek on button down, end on button up). Returns false, leaving the display untouched,
+// if the target has no peek hook; fall back to movement_move_to_face in that case.
+bool movement_peek_face(uint8_t watch_face_index);
+
+// ends a peek started with movement_peek_face, restoring the frame that was on the glass
+// before the first peek. Does nothing if no peek is in progress.
+void movement_end_peek(void);
+
 bool movement_default_loop_handler(movement_event_t event, movement_settings_t *settings);
 
 void movement_illuminate_led(void);
 
+// returns a persistent 10-character scratch line (plus a terminating NUL movement maintains)
+// that your face can format into instead of a stack buffer. Pair with
+// movement_flush_display_buffer: movement remembers what it last flushed, so rewriting the
+// whole line every tick is fine — only the characters that actually changed touch the SLCD,
+// and a tick that produces an identical frame skips the display entirely. The buffer persists
+// across ticks but not across face changes; treat its contents as undefined on EVENT_ACTIVATE.
+char *movement_get_display_buffer(void);
+
+// diffs the scratch line against the last flushed frame and writes only the changed positions,
+// batched in a single display transaction. Positions after a NUL in the buffer are left alone,
+// same as watch_display_string.
+void movement_flush_display_buffer(void);
+
+// request a tick frequency for your watch face. Must be a power of 2 from 1 to 64, or 0.
+// passing 0 suspends the tick entirely: your face will receive no EVENT_TICK events and the
+// system will sleep until a button is pressed or a wake scheduled with movement_request_wake_at
+// arrives. Use this if your face displays static content that never needs a periodic update.
 void movement_request_tick_frequency(uint8_t freq);
 
+// schedule a one-shot wake for the current face. When the given time arrives (checked against
+// the minute alarm, so with one-minute resolution), the face receives a single EVENT_TICK even
+// if it suspended its tick with movement_request_tick_frequency(0). Moving to another face
+// cancels the scheduled wake.
+void movement_request_wake_at(watch_date_time date_time);
+
 // note: watch faces can only schedule a background task when in the foreground, since
 // movement will associate the scheduled task with the currently active face.
 void movement_schedule_background_task(watch_date_time date_time);
@@ -304,12 +466,200 @@ void movement_cancel_background_task(void);
 void movement_schedule_background_task_for_face(uint8_t watch_face_index, watch_date_time date_time);
 void movement_cancel_background_task_for_face(uint8_t watch_face_index);
 
+// the next minute-aligned boundary of the given interval: 60 for the top of the hour, 30 for
+// half-hour ship's bells. Chime-style faces schedule this as a background task and re-arm it
+// when it fires, instead of polling the clock every minute with a wants_background_task hook.
+watch_date_time movement_next_chime(uint16_t interval_minutes);
+
 void movement_request_wake(void);
 
+// route a sensor interrupt line on the nine-pin connector into Movement. When the pin sees a
+// rising edge — say, the accelerometer's tap or wakeup engine firing on INT1 — the active face
+// receives EVENT_MOTION_WAKE, and the inactivity countdowns reset just as they do for a button
+// press. The sensor does the motion detection in hardware; the CPU sleeps until the edge arrives.
+// Configure the sensor side with something like lis2dw_configure_wakeup_int1 or
+// lis2dw_configure_tap_int1 before calling this.
+void movement_enable_motion_wake(uint8_t pin);
+
+// stop delivering EVENT_MOTION_WAKE for the given pin.
+void movement_disable_motion_wake(uint8_t pin);
+
+// play a melody through the interrupt-driven buzzer sequencer. Safe to call from a background
+// task: if the buzzer peripheral is powered down it is brought up for the melody and powered
+// off again when the sequence ends. Do not wrap calls in watch_enable_buzzer/watch_disable_buzzer.
+void movement_play_chime(int8_t *note_sequence);
 void movement_play_signal(void);
 void movement_play_alarm(void);
 void movement_play_alarm_beeps(uint8_t rounds, BuzzerNote alarm_note);
 
+// set the volume class for discretionary sounds: button beeps, the hourly signal, and chimes
+// played with movement_play_chime. A quiet class drives the piezo at reduced duty, cutting the
+// energy per beep several-fold — worthwhile for sounds that fire thousands of times a month.
+// Alarms the wearer explicitly set always play at full drive. Defaults to full volume; faces
+// that offer a quiet or night mode should set it on activate and are responsible for putting
+// it back. Not persisted across reboots.
+void movement_set_buzzer_volume(watch_buzzer_volume_t volume);
+
 uint8_t movement_claim_backup_register(void);
 
+// whether the boot-time topology probe found the given sensor on the I2C bus. Faces that
+// are useless without a part should declare a required_sensor in their watch_face_t
+// instead; this call is for faces that merely degrade (hide a page, skip a reading)
+// when the part is absent. Always true for MOVEMENT_SENSOR_NONE.
+bool movement_sensor_present(movement_sensor_t sensor);
+
+// snapshot all face contexts and enter BACKUP mode. On wake, faces whose contexts were
+// captured get them back before setup runs — each face finds its context pointer non-NULL
+// and skips cold initialization, the same as a soft relaunch. The snapshot lives in a
+// file on the filesystem with its CRC in backup register 3; a CRC mismatch or a firmware
+// reflash falls back to an ordinary cold boot.
+void movement_enter_backup_mode(void);
+
+// allocate a block for your watch face's context from Movement's static arena instead of the
+// heap. Call this from your setup function in place of malloc; the block persists for the life
+// of the firmware (faces never free their contexts, so there is no free). The arena is sized by
+// MOVEMENT_FACE_CONTEXT_ARENA_SIZE, which you can override in movement_config.h; if it fills up,
+// this falls back to malloc and logs a complaint so the build keeps working while you resize it.
+void *movement_face_context_alloc(size_t size);
+
+#ifdef MOVEMENT_PROFILE
+// Per-face profiling counters, collected when the firmware is built with MOVEMENT_PROFILE=1
+// (see movement/make/Makefile). Wake counts and active cycles accumulate across every loop
+// dispatch, including background tasks, so you can see which compiled-in face is burning the
+// battery before doing any other power tuning.
+typedef struct {
+    uint32_t wake_count;     // number of times the face's loop function ran
+    uint32_t active_cycles;  // cumulative CPU cycles spent in the face's loop function
+} movement_face_profile_t;
+
+// returns the profile counters for the face at the given index, or NULL if out of range.
+const movement_face_profile_t *movement_get_face_profile(uint8_t watch_face_index);
+
+// the number of compiled-in faces, for consumers (like the shell) that can't see MOVEMENT_NUM_FACES.
+uint8_t movement_get_num_faces(void);
+
+// prints one line per face with its wake count and active cycles; used by the "profile" shell command.
+void movement_print_face_profiles(void);
+#endif // MOVEMENT_PROFILE
+
+// Wake-source ledger: counts every interrupt Movement services, by source, plus active vs
+// STANDBY residency accumulated against the RTC (one second resolution, so sub-second naps
+// round to zero). Unlike the profiler this is always compiled in — the counters are a
+// handful of increments in interrupt handlers — and at midnight the day's counts roll into
+// a seven-day ring in wakes.dat, so a watch that comes back after a week of vague battery
+// complaints carries the per-source wake budget that explains them. Read the live counters
+// and the ring with the "wakes" shell command. (Time spent awake on USB power counts as
+// active: the main loop never enters STANDBY while USB is enabled.)
+typedef struct {
+    uint32_t tick_wakes[8];   // periodic tick callbacks by frequency: index n is 2^n Hz
+    uint32_t alarm_wakes;     // the once-a-minute RTC alarm (background tasks, LE updates)
+    uint32_t button_wakes;    // edges on the three buttons, including the BTN_ALARM extwake
+    uint32_t motion_wakes;    // rising edges from a movement_enable_motion_wake sensor
+    uint32_t active_seconds;
+    uint32_t standby_seconds;
+} movement_wake_ledger_t;
+
+// one day in the wakes.dat ring: the day the counts cover (a watch_date_time reg with the
+// time-of-day bits zeroed) and its totals. date == 0 marks a slot not yet filled.
+typedef struct {
+    uint32_t date;
+    movement_wake_ledger_t counts;
+} movement_wake_ledger_day_t;
+
+#define MOVEMENT_WAKE_LEDGER_DAYS 7
+
+// the live (since-midnight) ledger.
+const movement_wake_ledger_t *movement_get_wake_ledger(void);
+
+// prints the live ledger and the persisted ring; used by the "wakes" shell command.
+void movement_print_wake_ledger(void);
+
+// prints the hardfault flight recorder's log; used by the "crashes" shell command.
+// A hardfault stashes the faulting PC and LR plus the active face and event type in
+// backup registers 4-6 and resets; the next boot appends the record (timestamped) to
+// a ring of the last few crashes on the filesystem. Look the PC up with
+// arm-none-eabi-addr2line -e build/watch.elf <pc> to find the faulting line.
+void movement_print_crash_log(void);
+
+// prints the always-on event trace, oldest first; used by the "trace" shell command.
+// Every event dispatched to a face is logged to a 256-entry RAM ring with a wall-clock
+// timestamp (minute:second.subsecond), the event type, the face index and the wake
+// source — cheap enough that it stays enabled in production, so a misbehaving unit's
+// recent history is one shell command away.
+void movement_print_event_trace(void);
+
+// RAM headroom report: how deep the stack and heap have ever reached since boot. The
+// unused stack is painted with a known word early in init and scanned for the first
+// disturbed word on request; the sbrk shim records the heap's highest break. With 32 KB
+// shared between .data, the stack and the heap, this headroom is the constraint that
+// decides which features a build can afford — and a silent stack/heap collision (deep
+// littlefs housekeeping under a face's loop, say) shows up here before it corrupts
+// anything. Reported by the "mem" shell command.
+typedef struct {
+    uint32_t stack_size;        // bytes reserved for the stack
+    uint32_t stack_high_water;  // deepest stack usage observed since boot
+    uint32_t heap_size;         // bytes between the heap's start and the top of RAM
+    uint32_t heap_high_water;   // highest break the allocator has reached since boot
+} movement_memory_stats_t;
+
+// fills in the stats above. Returns false in the simulator, which runs against the
+// browser's memory and has no meaningful numbers to offer.
+bool movement_get_memory_stats(movement_memory_stats_t *stats);
+
+// Replaces the MODE-button ring with the given sequence of compiled-in face indices and
+// persists it to the filesystem, so it survives reboots and loads in one read at boot.
+// Faces left out are parked: skipped by MODE but still running background tasks and
+// reachable via movement_move_to_face. A count of zero deletes the record and restores
+// the compiled-in order. Returns false (changing nothing) on an out-of-range or
+// duplicate index. Used by the "order" shell command.
+bool movement_set_face_order(const uint8_t *indices, uint8_t count);
+
+// prints the active face order; used by the "order" shell command with no arguments.
+void movement_print_face_order(void);
+
+// Sets the RTC from a trusted UTC unix timestamp (converted to the configured time zone)
+// and records a drift correction reference point; used by the "sync" shell command, so a
+// USB host can retune the crystal with `echo sync $(date +%s) > /dev/ttyACM0`.
+void movement_sync_time(uint32_t utc_timestamp);
+
+// Per-unit LCD drive tuning, saved by the LCD tuning face as a watch_lcd_drive_t and
+// reapplied by movement at boot, since watch_enable_display resets the stock settings.
+#define MOVEMENT_LCD_TUNING_FILENAME "lcd.cfg"
+
+// Battery-state engine: movement samples the coin cell on the first minute pass after boot
+// and hourly after that, and degrades progressively as the cell fails — a systemwide
+// reduced-performance mode that buys weeks of life automatically, rather than waiting for
+// the all-or-nothing low energy timeout. Falling past a threshold takes effect at the next
+// hourly check; climbing back out requires 100 mV of headroom so a reading bouncing around
+// a threshold doesn't flap the mode. Thresholds are MOVEMENT_BATTERY_LOW_MV (2400) and
+// MOVEMENT_BATTERY_CRITICAL_MV (2200), overridable in movement_config.h.
+typedef enum {
+    MOVEMENT_BATTERY_OK = 0,
+    MOVEMENT_BATTERY_LOW,       // LED illumination and the hourly signal are disabled
+    MOVEMENT_BATTERY_CRITICAL,  // additionally, face ticks cap at 1 Hz and low energy mode
+                                // (minute-resolution updates) engages 60 seconds after the
+                                // last interaction, even if the LE timeout is set to never
+} movement_battery_state_t;
+
+// the battery state as of the last hourly sample. Faces can consult this to skip
+// discretionary work (sensor polls, animations) when the cell is on its way out.
+movement_battery_state_t movement_get_battery_state(void);
+
+/** @brief Cooperative slicing for long computations.
+  * @details A face that needs seconds of math (ephemeris solves, orbit propagation) would
+  *          block app_loop for the whole computation and freeze button response. Instead,
+  *          break the work into short steps and register a continuation: movement calls it
+  *          a budgeted number of times per loop pass, popping queued button events between
+  *          slices and holding off STANDBY until it reports completion. Keep each slice to
+  *          a few milliseconds — one iteration of the outer loop, one body per slice — and
+  *          keep progress state in your face context; the function receives the pointer
+  *          you registered. Return true from the final slice. There is one slot: starting
+  *          a new continuation replaces a pending one, and movement cancels it if the face
+  *          changes or low energy mode engages, so a face that still cares on its next
+  *          activate should check its progress state and re-register.
+  */
+typedef bool (*movement_continuation_fn)(void *context);
+void movement_start_continuation(movement_continuation_fn fn, void *context);
+void movement_cancel_continuation(void);
+
 #endif // MOVEMENT_H_
@@ -27,25 +27,46 @@
 
 #include "movement_faces.h"
 
+/* The face list is an X macro: each entry is F(index, face). The watch_faces[] table
+ * below is generated from it, and the static dispatch build (make STATIC_DISPATCH=1)
+ * expands the same list into switch statements in movement.c, turning every hook call
+ * in the runloop into a direct call instead of a load through a function pointer.
+ * Keep the indices sequential from 0; they are the face indices movement uses everywhere.
+ */
+#define MOVEMENT_FACE_LIST(F) \
+    F(0, simple_clock_face) \
+    F(1, lightmeter_face) \
+    F(2, thermistor_readout_face) \
+    F(3, world_clock_face) \
+    F(4, sunrise_sunset_face) \
+    F(5, moon_phase_face) \
+    F(6, stopwatch_face) \
+    F(7, preferences_face) \
+    F(8, set_time_face)
+
+#define MOVEMENT_FACE_TABLE_ENTRY(index, face) [index] = face,
 const watch_face_t watch_faces[] = {
-    simple_clock_face,
-    lightmeter_face,
-    thermistor_readout_face,
-    world_clock_face,
-    sunrise_sunset_face,
-    moon_phase_face,
-    stopwatch_face,
-    preferences_face,
-    set_time_face,
+    MOVEMENT_FACE_LIST(MOVEMENT_FACE_TABLE_ENTRY)
 };
 
 #define MOVEMENT_NUM_FACES (sizeof(watch_faces) / sizeof(watch_face_t))
 
-/* Determines what face to go to from the first face if you've already set 
+/* Determines what face to go to from the first face if you've already set
  * a mode long press to go to the first face in preferences, and
  * excludes these faces from the normal rotation.
  * Usually it makes sense to set this to the preferences face.
  */
 #define MOVEMENT_SECONDARY_FACE_INDEX 0 // or (MOVEMENT_NUM_FACES - 2)
 
+/* Optional favorites ring. With a long face list, reaching a face deep in the rotation
+ * costs one full activate/resign and repaint per MODE press. Define this to a
+ * comma-separated list of face indices (in ascending order) and a MODE long press jumps
+ * to the next listed face instead of returning to face 0: from a favorite, the next one
+ * around the ring; from any other face, the first favorite past it. Only the destination
+ * face activates and renders — pass-through faces are skipped entirely. A short MODE
+ * press still walks every face. Defining this replaces the long-press behaviors above
+ * (return to 0 and the secondary face).
+ */
+// #define MOVEMENT_FAVORITE_FACES 0, 6, 8
+
 #endif // MOVEMENT_CONFIG_H_
@@ -54,6 +54,7 @@
 #include "mars_time_face.h"
 #include "orrery_face.h"
 #include "astronomy_face.h"
+#include "star_catalog_face.h"
 #include "tomato_face.h"
 #include "probability_face.h"
 #include "wake_face.h"
@@ -73,9 +74,15 @@
 #include "interval_face.h"
 #include "morsecalc_face.h"
 #include "rpn_calculator_face.h"
+#include "profile_face.h"
 #include "ships_bell_face.h"
 #include "lightmeter_face.h"
 #include "habit_face.h"
+#include "gps_time_sync_face.h"
+#include "steps_face.h"
+#include "sleep_face.h"
+#include "lcd_tuning_face.h"
+#include "ev_meter_face.h"
 // New includes go above this line.
 
 #endif // MOVEMENT_FACES_H_
@@ -0,0 +1,260 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "parity_check.h"
+
+#if __EMSCRIPTEN__
+
+// Every fixed-point kernel in this tree was converted from a double implementation,
+// and each conversion is only as trustworthy as the widest sweep anyone ran against
+// the original. This file is that sweep: for each kernel it drives the fixed and the
+// double pipeline with the same deterministic pseudo-random inputs, tracks the worst
+// disagreement, and times both variants with the profile counter (nanoseconds of
+// wall time in the simulator — good for the relative fixed-vs-double ratio, not for
+// predicting cycle counts on the M0+, where the softfloat gap is far larger).
+//
+// Error bounds printed here are what the kernels' own headers promise: about a
+// minute for sun rise/set, a millisecond for Mars Sol Date, a couple of Q2.30 LSBs
+// for the trig core. If a sweep reports worse, the kernel regressed — fix it before
+// shipping, don't widen the promise.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "watch_profile.h"
+#include "sunriset.h"
+#include "sunriset_fixed.h"
+#include "astrolib.h"
+#include "mars_time_face.h"
+
+// xorshift32: deterministic, seeded per section so the error sweep and both timing
+// loops of a kernel all see the identical input sequence.
+static uint32_t _rng;
+
+static uint32_t _rand32(void) {
+    _rng ^= _rng << 13;
+    _rng ^= _rng >> 17;
+    _rng ^= _rng << 5;
+    return _rng;
+}
+
+// sinks keep the optimizer from discarding the timed calls.
+static volatile double _sink_d;
+static volatile int64_t _sink_i;
+
+static void _parity_sunriset(void) {
+    const uint32_t samples = 100000;
+    const uint32_t timed_calls = 20000;
+    double max_err_minutes = 0;
+    uint32_t code_mismatches = 0;
+
+    _rng = 0x5EED5071;
+    for (uint32_t i = 0; i < samples; i++) {
+        int year = 1970 + (int)(_rand32() % 120);           // the fixed kernel's stated domain
+        int month = 1 + (int)(_rand32() % 12);
+        int day = 1 + (int)(_rand32() % 28);
+        double lat = (double)(int32_t)(_rand32() % 178001) / 1000.0 - 89.0;
+        double lon = (double)(int32_t)(_rand32() % 360001) / 1000.0 - 180.0;
+        sunriset_fix16_t lat_f = (sunriset_fix16_t)lround(lat * 65536.0);
+        sunriset_fix16_t lon_f = (sunriset_fix16_t)lround(lon * 65536.0);
+
+        double rise_d, set_d;
+        sunriset_fix16_t rise_f, set_f;
+        int code_d = sun_rise_set(year, month, day, lon, lat, &rise_d, &set_d);
+        int code_f = sun_rise_set_fixed(year, month, day, lon_f, lat_f, &rise_f, &set_f);
+        if (code_d != code_f) {
+            // polar-summer/winter days right at the threshold can straddle the two
+            // kernels' rounding; count them rather than comparing bogus times.
+            code_mismatches++;
+            continue;
+        }
+        if (code_d != 0) continue; // sun never crossed the horizon; no times to compare
+        double err_rise = fabs(rise_d - (double)rise_f / 65536.0) * 60.0;
+        double err_set = fabs(set_d - (double)set_f / 65536.0) * 60.0;
+        if (err_rise > max_err_minutes) max_err_minutes = err_rise;
+        if (err_set > max_err_minutes) max_err_minutes = err_set;
+    }
+
+    uint32_t ns_double, ns_fixed;
+    _rng = 0x5EED5071;
+    watch_profile_counter_start();
+    for (uint32_t i = 0; i < timed_calls; i++) {
+        int year = 1970 + (int)(_rand32() % 120);
+        int month = 1 + (int)(_rand32() % 12);
+        int day = 1 + (int)(_rand32() % 28);
+        double lat = (double)(int32_t)(_rand32() % 178001) / 1000.0 - 89.0;
+        double lon = (double)(int32_t)(_rand32() % 360001) / 1000.0 - 180.0;
+        double rise_d, set_d;
+        sun_rise_set(year, month, day, lon, lat, &rise_d, &set_d);
+        _sink_d = rise_d + set_d;
+    }
+    ns_double = watch_profile_counter_stop() / timed_calls;
+
+    _rng = 0x5EED5071;
+    watch_profile_counter_start();
+    for (uint32_t i = 0; i < timed_calls; i++) {
+        int year = 1970 + (int)(_rand32() % 120);
+        int month = 1 + (int)(_rand32() % 12);
+        int day = 1 + (int)(_rand32() % 28);
+        sunriset_fix16_t lat_f = (sunriset_fix16_t)((int64_t)(_rand32() % 178001) * 65536 / 1000) - 89 * 65536;
+        sunriset_fix16_t lon_f = (sunriset_fix16_t)((int64_t)(_rand32() % 360001) * 65536 / 1000) - 180 * 65536;
+        sunriset_fix16_t rise_f, set_f;
+        sun_rise_set_fixed(year, month, day, lon_f, lat_f, &rise_f, &set_f);
+        _sink_i = (int64_t)rise_f + set_f;
+    }
+    ns_fixed = watch_profile_counter_stop() / timed_calls;
+
+    printf("sunriset: %lu dates, max err %.3f min, %lu return-code splits, %lu ns/call double vs %lu fixed\n",
+           (unsigned long)samples, max_err_minutes, (unsigned long)code_mismatches,
+           (unsigned long)ns_double, (unsigned long)ns_fixed);
+}
+
+static void _parity_astro_trig(void) {
+    const uint32_t samples = 2000000;
+    const uint32_t timed_calls = 1000000;
+    double max_err_sincos = 0;    // in Q2.30 LSBs
+    double max_err_acos = 0;      // in arcseconds
+
+    _rng = 0x5EEDA572;
+    for (uint32_t i = 0; i < samples; i++) {
+        uint32_t angle = _rand32();
+        double turns = (double)angle / 4294967296.0;
+        double err_s = fabs((double)astro_sin_turns(angle) / 1073741824.0 - sin(turns * 2.0 * M_PI));
+        double err_c = fabs((double)astro_cos_turns(angle) / 1073741824.0 - cos(turns * 2.0 * M_PI));
+        if (err_s * 1073741824.0 > max_err_sincos) max_err_sincos = err_s * 1073741824.0;
+        if (err_c * 1073741824.0 > max_err_sincos) max_err_sincos = err_c * 1073741824.0;
+
+        int32_t x = (int32_t)(_rand32() % 2147483647u) - 1073741823; // Q2.30 in [-1, 1]
+        double err_a = fabs((double)astro_acos_turns(x) / 4294967296.0 - acos((double)x / 1073741824.0) / (2.0 * M_PI));
+        if (err_a * 1296000.0 > max_err_acos) max_err_acos = err_a * 1296000.0;
+    }
+
+    uint32_t ns_double, ns_fixed;
+    _rng = 0x5EEDA572;
+    watch_profile_counter_start();
+    for (uint32_t i = 0; i < timed_calls; i++) {
+        double turns = (double)_rand32() / 4294967296.0;
+        _sink_d = sin(turns * 2.0 * M_PI) + cos(turns * 2.0 * M_PI);
+    }
+    ns_double = watch_profile_counter_stop() / timed_calls;
+
+    _rng = 0x5EEDA572;
+    watch_profile_counter_start();
+    for (uint32_t i = 0; i < timed_calls; i++) {
+        uint32_t angle = _rand32();
+        _sink_i = (int64_t)astro_sin_turns(angle) + astro_cos_turns(angle);
+    }
+    ns_fixed = watch_profile_counter_stop() / timed_calls;
+
+    printf("astrolib: %lu angles, max sin/cos err %.2f LSB (Q2.30), max acos err %.2f arcsec, %lu ns/pair double vs %lu fixed\n",
+           (unsigned long)samples, max_err_sincos, max_err_acos,
+           (unsigned long)ns_double, (unsigned long)ns_fixed);
+}
+
+static void _parity_mars_time(void) {
+    const uint32_t samples = 4000000;
+    const uint32_t timed_calls = 1000000;
+    double max_err_ms = 0;
+
+    // the double reference is the formula mars_time_face.c folded into integers:
+    // rebase to the MSD epoch, stretch by the sol/day ratio, add the sol base.
+    _rng = 0x5EED4445;
+    for (uint32_t i = 0; i < samples; i++) {
+        uint32_t now = 946684800u + _rand32() % 3155760000u; // 2000 through 2100
+        double msd_d = ((double)now * 1000.0 - 947116730816.0) / 1.0274912517 + 3870374316831.0;
+        double err = fabs((double)mars_time_msd_ms(now) - msd_d);
+        if (err > max_err_ms) max_err_ms = err;
+    }
+
+    uint32_t ns_double, ns_fixed;
+    _rng = 0x5EED4445;
+    watch_profile_counter_start();
+    for (uint32_t i = 0; i < timed_calls; i++) {
+        uint32_t now = 946684800u + _rand32() % 3155760000u;
+        _sink_d = ((double)now * 1000.0 - 947116730816.0) / 1.0274912517 + 3870374316831.0;
+    }
+    ns_double = watch_profile_counter_stop() / timed_calls;
+
+    _rng = 0x5EED4445;
+    watch_profile_counter_start();
+    for (uint32_t i = 0; i < timed_calls; i++) {
+        uint32_t now = 946684800u + _rand32() % 3155760000u;
+        _sink_i = mars_time_msd_ms(now);
+    }
+    ns_fixed = watch_profile_counter_stop() / timed_calls;
+
+    printf("mars: %lu timestamps, max err %.4f ms, %lu ns/call double vs %lu fixed\n",
+           (unsigned long)samples, max_err_ms, (unsigned long)ns_double, (unsigned long)ns_fixed);
+}
+
+static void _parity_moon_phase(void) {
+    const uint32_t samples = 4000000;
+    const uint32_t timed_calls = 1000000;
+    const uint64_t cycle_us = 2551442777778ull;   // moon_phase_face.c's LUNAR_CYCLE_US
+    const uint32_t first_moon = 947182440;        // and its FIRST_MOON anchor
+    const double cycle_s = 2551442.777778;
+    double max_err_s = 0;
+
+    _rng = 0x5EED4004;
+    for (uint32_t i = 0; i < samples; i++) {
+        uint32_t now = first_moon + _rand32() % 3155760000u;
+        uint64_t pos_us = ((uint64_t)(now - first_moon) * 1000000ull) % cycle_us;
+        double pos_s = fmod((double)(now - first_moon), cycle_s);
+        double err = fabs((double)pos_us / 1000000.0 - pos_s);
+        if (err > cycle_s / 2.0) err = cycle_s - err; // disagreement across the wrap point
+        if (err > max_err_s) max_err_s = err;
+    }
+
+    uint32_t ns_double, ns_fixed;
+    _rng = 0x5EED4004;
+    watch_profile_counter_start();
+    for (uint32_t i = 0; i < timed_calls; i++) {
+        uint32_t now = first_moon + _rand32() % 3155760000u;
+        _sink_d = fmod((double)(now - first_moon), cycle_s);
+    }
+    ns_double = watch_profile_counter_stop() / timed_calls;
+
+    _rng = 0x5EED4004;
+    watch_profile_counter_start();
+    for (uint32_t i = 0; i < timed_calls; i++) {
+        uint32_t now = first_moon + _rand32() % 3155760000u;
+        _sink_i = (int64_t)(((uint64_t)(now - first_moon) * 1000000ull) % cycle_us);
+    }
+    ns_fixed = watch_profile_counter_stop() / timed_calls;
+
+    printf("moon: %lu timestamps, max err %.4f s, %lu ns/call double vs %lu fixed\n",
+           (unsigned long)samples, max_err_s, (unsigned long)ns_double, (unsigned long)ns_fixed);
+}
+
+void parity_check_run(void) {
+    printf("parity sweep: fixed-point kernels vs. double references (costs are sim wall time)\n");
+    _parity_sunriset();
+    _parity_astro_trig();
+    _parity_mars_time();
+    _parity_moon_phase();
+}
+
+#endif // __EMSCRIPTEN__
@@ -0,0 +1,38 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef PARITY_CHECK_H_
+#define PARITY_CHECK_H_
+
+/** @brief Sweeps each fixed-point math kernel against the double implementation it
+  *        replaced — sun rise/set, the astrolib trig core, the Mars Sol Date
+  *        conversion and the moon phase position — over a few million deterministic
+  *        random inputs, printing the worst error in display-relevant units and the
+  *        per-call cost of both variants. Simulator only: the sweep takes seconds at
+  *        WASM speed but would take hours on the watch, and the double references
+  *        are exactly the softfloat load the fixed kernels exist to avoid. Run it
+  *        with the `parity` shell command after touching any of these kernels.
+  */
+void parity_check_run(void);
+
+#endif // PARITY_CHECK_H_
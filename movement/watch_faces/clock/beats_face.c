@@ -3,58 +3,67 @@
 #include "beats_face.h"
 #include "watch.h"
 
-const uint8_t BEAT_REFRESH_FREQUENCY = 8;
+// One centibeat is 864 ms. The RTC multiplexer only deals in power-of-two tick rates, so
+// an exact one-wake-per-centibeat cadence isn't on the menu; 2 Hz is the slowest rate
+// that never lets the display fall a full centibeat behind. Each wake is a single
+// accumulator add — the full clock-to-beats conversion runs only when the counter is
+// re-anchored from the RTC.
+#define BEAT_REFRESH_FREQUENCY 2
+
+static void _beats_face_anchor(movement_settings_t *settings, beats_face_state_t *state) {
+    watch_date_time date_time = watch_rtc_get_date_time();
+    int32_t ms_of_day = (((int32_t)date_time.unit.hour * 60 + date_time.unit.minute) * 60 + date_time.unit.second) * 1000;
+    ms_of_day -= (movement_timezone_offset(settings->bit.time_zone) - 3600) * 1000;
+    while (ms_of_day < 0) ms_of_day += 86400000;
+    ms_of_day %= 86400000;
+    state->centibeats = (uint32_t)ms_of_day / 864;
+    state->ms_acc = (uint16_t)((uint32_t)ms_of_day % 864);
+}
 
 void beats_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
     (void) context_ptr;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(beats_face_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(beats_face_state_t));
     }
 }
 
 void beats_face_activate(movement_settings_t *settings, void *context) {
-    (void) settings;
     beats_face_state_t *state = (beats_face_state_t *)context;
-    state->next_subsecond_update = 0;
-    state->last_centibeat_displayed = 0;
+    _beats_face_anchor(settings, state);
     movement_request_tick_frequency(BEAT_REFRESH_FREQUENCY);
 }
 
 bool beats_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
-    (void) settings;
     beats_face_state_t *state = (beats_face_state_t *)context;
-    if (event.event_type == EVENT_TICK && event.subsecond != state->next_subsecond_update) {
-         return true; // math is hard, don't do it if we don't have to.
-    }
-
     char buf[16];
-    uint32_t centibeats;
 
-    watch_date_time date_time;
     switch (event.event_type) {
-        case EVENT_ACTIVATE:
         case EVENT_TICK:
-            date_time = watch_rtc_get_date_time();
-            centibeats = clock2beats(date_time.unit.hour, date_time.unit.minute, date_time.unit.second, event.subsecond, movement_timezone_offsets[settings->bit.time_zone]);
-            if (centibeats == state->last_centibeat_displayed) {
-                // we missed this update, try again next subsecond
-                state->next_subsecond_update = (event.subsecond + 1) % BEAT_REFRESH_FREQUENCY;
-            } else {
-                state->next_subsecond_update = (event.subsecond + 1 + (BEAT_REFRESH_FREQUENCY * 2 / 3)) % BEAT_REFRESH_FREQUENCY;
-                state->last_centibeat_displayed = centibeats;
-            }
-            sprintf(buf, "bt  %6lu", centibeats);
+            // beats advance uniformly, and the ticks come from the same crystal as the
+            // time of day: one add per wake, and the display is only touched when the
+            // counter actually steps.
+            state->ms_acc += 1000 / BEAT_REFRESH_FREQUENCY;
+            if (state->ms_acc < 864) return true;
+            state->ms_acc -= 864;
+            state->centibeats++;
+            if (state->centibeats >= 100000) state->centibeats = 0;
+            // a tick can't cross two centibeat boundaries at 2 Hz (500 < 864), so
+            // one step is the only case.
+            // fall through
 
+        case EVENT_ACTIVATE:
+            if (event.event_type == EVENT_ACTIVATE) _beats_face_anchor(settings, state);
+            sprintf(buf, "bt  %6lu", state->centibeats);
             watch_display_string(buf, 0);
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             if (!watch_tick_animation_is_running()) watch_start_tick_animation(432);
-            date_time = watch_rtc_get_date_time();
-            centibeats = clock2beats(date_time.unit.hour, date_time.unit.minute, date_time.unit.second, event.subsecond, movement_timezone_offsets[settings->bit.time_zone]);
-            sprintf(buf, "bt  %4lu  ", centibeats / 100);
-
+            // the minute-cadence updates in low energy mode re-anchor from the RTC, so
+            // the accumulator is fresh if normal ticks resume.
+            _beats_face_anchor(settings, state);
+            sprintf(buf, "bt  %4lu  ", state->centibeats / 100);
             watch_display_string(buf, 0);
             break;
         default:
@@ -69,15 +78,3 @@ void beats_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
 }
-
-uint32_t clock2beats(uint32_t hours, uint32_t minutes, uint32_t seconds, uint32_t subseconds, int16_t utc_offset) {
-    uint32_t retval = seconds * 1000 + (subseconds * 1000) / (BEAT_REFRESH_FREQUENCY);
-    retval += 60 * minutes * 1000;
-    retval += hours * 60 * 60 * 1000;
-    retval -= (utc_offset - 60) * 60 * 1000;
-
-    retval /= 864; // convert to centibeats
-    retval %= 100000;
-
-    return retval;
-}
@@ -4,11 +4,10 @@
 #include "movement.h"
 
 typedef struct {
-    int8_t next_subsecond_update;
-    uint32_t last_centibeat_displayed;
+    uint32_t centibeats;  // the running .beats counter, re-anchored from the RTC on activate
+    uint16_t ms_acc;      // milliseconds accumulated toward the next centibeat (one is 864 ms)
 } beats_face_state_t;
 
-uint32_t clock2beats(uint32_t hours, uint32_t minutes, uint32_t seconds, uint32_t subseconds, int16_t utc_offset);
 void beats_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void beats_face_activate(movement_settings_t *settings, void *context);
 bool beats_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
@@ -20,6 +19,7 @@ void beats_face_resign(movement_settings_t *settings, void *context);
     beats_face_loop, \
     beats_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // BEATS_FACE_H_
\ No newline at end of file
@@ -24,17 +24,38 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "watch_utility.h"
 #include "mars_time_face.h"
 
-// note: lander coordinates come from Mars24's `marslandmarks.xml` file
-static double site_longitudes[MARS_TIME_NUM_SITES] = {
-    0,                      // Mars Coordinated Time, at the meridian
-    360.0 - 109.9,          // Zhurong lander site
-    360.0 - 77.45088572,    // Perseverance lander site
-    360.0 - 135.623447,     // InSight lander site
-    360.0 - 137.441635,     // Curiosity lander site
+// The Mars24 conversion (https://www.giss.nasa.gov/tools/mars24/help/algorithm.html),
+// folded into 64-bit integer math. Everything is milliseconds: Earth milliseconds are
+// rebased to the MSD epoch and stretched by the 1/1.0274912517 sol/day ratio with one
+// multiply-shift. The ratio is split into a high and a low 20-bit factor so both
+// products stay inside int64 (a single 41-bit factor would overflow by 2040); total
+// scale is 2^40, which keeps the conversion within a millisecond of the double math
+// through the next century. The previous implementation ran this pipeline in double
+// precision every second — a standing softfloat load for a novelty complication.
+#define MARS_SOL_MS 86400000                        // a sol is 24 Mars-hours of 3600 Mars-seconds
+#define MARS_RATIO_HI 1020520                       // floor((2^40 / 1.0274912517) / 2^20)
+#define MARS_RATIO_LO 640698                        // round(2^40 / 1.0274912517) - (HI << 20)
+#define MARS_UNIX_REBASE_MS 947116730816LL          // 10962 days MSD epoch offset, less 69.184 s of TT-UTC
+#define MARS_MSD_BASE_MS 3870374316831LL            // (44796 - 0.0009626) sols
+
+int64_t mars_time_msd_ms(uint32_t unix_time) {
+    int64_t earth_ms = (int64_t)unix_time * 1000 - MARS_UNIX_REBASE_MS;
+    return ((earth_ms * MARS_RATIO_HI + ((earth_ms * MARS_RATIO_LO) >> 20)) >> 20) + MARS_MSD_BASE_MS;
+}
+
+// per-site local time offsets, in Mars-milliseconds west of the meridian: each is
+// round(longitude * 86400000 / 360) for the site longitudes in Mars24's
+// `marslandmarks.xml` file (Zhurong 109.9 W, Perseverance 77.45088572 W,
+// InSight 135.623447 W, Curiosity 137.441635 W, all expressed as 360 - west).
+static const int32_t site_offsets_ms[MARS_TIME_NUM_SITES] = {
+    0,
+    60024000,
+    67811787,
+    53850373,
+    53414008,
 };
 
 static char site_names[MARS_TIME_NUM_SITES][3] = {
@@ -45,7 +66,7 @@ static char site_names[MARS_TIME_NUM_SITES][3] = {
     "CU",
 };
 
-static uint16_t landing_sols[MARS_TIME_NUM_SITES] = {
+static const uint16_t landing_sols[MARS_TIME_NUM_SITES] = {
     0,
     52387,
     52304,
@@ -53,52 +74,31 @@ static uint16_t landing_sols[MARS_TIME_NUM_SITES] = {
     49269,
 };
 
-typedef struct {
-    uint8_t hour;
-    uint8_t minute;
-    uint8_t second;
-} mars_clock_hms_t;
-
-static void _h_to_hms(mars_clock_hms_t *date_time, double h) {
-	unsigned int seconds = (unsigned int)(h * 3600.0);
-	date_time->hour = seconds / 3600;
-	seconds = seconds % 3600;
-	date_time->minute = floor(seconds / 60);
-	date_time->second = round(seconds % 60);
-}
-
 static void _update(movement_settings_t *settings, mars_time_state_t *state) {
     char buf[11];
     watch_date_time date_time = watch_rtc_get_date_time();
-    uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
-    // TODO: I'm skipping over some steps here.
-    // https://www.giss.nasa.gov/tools/mars24/help/algorithm.html
-    double jdut = 2440587.5 + ((double)now / 86400.0);
-    double jdtt = jdut + ((37.0 + 32.184) / 86400.0);
-    double jd2k = jdtt - 2451545.0;
-    double msd = ((jd2k - 4.5) / 1.0274912517) + 44796.0 - 0.0009626;
-    double mtc = fmod(24 * msd, 24);
-    double lmt;
-
-    if (state->current_site == 0) {
-        lmt = mtc;
-    } else {
-        double longitude = site_longitudes[state->current_site];
-        double lmst = mtc - ((longitude * 24.0) / 360.0);
-        lmt = fmod(lmst + 24, 24);
+    uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offset(settings->bit.time_zone));
+    int64_t msd_ms = mars_time_msd_ms(now);
+    int64_t lmt_ms = msd_ms - site_offsets_ms[state->current_site];
+
+    // the sol boundary is cached in context, so the every-second path below costs one
+    // 64-bit subtraction; the divide only runs on activate, a site change, or rollover.
+    if (state->current_site != state->cached_site || lmt_ms < state->sol_start_ms || lmt_ms - state->sol_start_ms >= MARS_SOL_MS) {
+        state->cached_site = state->current_site;
+        state->sol_start_ms = (lmt_ms / MARS_SOL_MS) * MARS_SOL_MS;
     }
+    uint32_t second_of_sol = (uint32_t)(lmt_ms - state->sol_start_ms) / 1000;
 
     if (state->displaying_sol) {
         // TODO: this is not right, mission sol should turn over at midnight local time?
-        uint16_t sol = floor(msd) - landing_sols[state->current_site];
+        uint16_t sol = (uint16_t)(msd_ms / MARS_SOL_MS) - landing_sols[state->current_site];
         if (sol < 1000) sprintf(&buf[0], "%s  Sol%3d", site_names[state->current_site], sol);
         else sprintf(&buf[0], "%s $%6d", site_names[state->current_site], sol);
         watch_clear_colon();
         watch_clear_indicator(WATCH_INDICATOR_24H);
     } else {
-        mars_clock_hms_t mars_time;
-        _h_to_hms(&mars_time, lmt);
-        sprintf(&buf[0], "%s  %02d%02d%02d", site_names[state->current_site], mars_time.hour, mars_time.minute, mars_time.second);
+        sprintf(&buf[0], "%s  %02u%02u%02u", site_names[state->current_site],
+                (unsigned int)(second_of_sol / 3600), (unsigned int)((second_of_sol / 60) % 60), (unsigned int)(second_of_sol % 60));
         watch_set_colon();
         watch_set_indicator(WATCH_INDICATOR_24H);
     }
@@ -110,7 +110,7 @@ void mars_time_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(mars_time_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(mars_time_state_t));
         memset(*context_ptr, 0, sizeof(mars_time_state_t));
     }
 }
@@ -39,8 +39,15 @@ typedef enum {
 typedef struct {
     mars_time_site_t current_site;
     bool displaying_sol;
+    uint8_t cached_site;      // site the cached sol boundary below belongs to
+    int64_t sol_start_ms;     // start of the current local sol, in ms on the MSD timescale
 } mars_time_state_t;
 
+// The Mars24 conversion folded into integer math: milliseconds on the Mars Sol Date
+// timescale for a unix timestamp. Public so the parity harness can sweep it against
+// the double-precision formula it replaced.
+int64_t mars_time_msd_ms(uint32_t unix_time);
+
 void mars_time_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void mars_time_face_activate(movement_settings_t *settings, void *context);
 bool mars_time_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
@@ -52,6 +59,7 @@ void mars_time_face_resign(movement_settings_t *settings, void *context);
     mars_time_face_loop, \
     mars_time_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // MARS_TIME_FACE_H_
@@ -39,7 +39,7 @@ void simple_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_i
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(simple_clock_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(simple_clock_state_t));
         simple_clock_state_t *state = (simple_clock_state_t *)*context_ptr;
         state->signal_enabled = false;
         state->watch_face_index = watch_face_index;
@@ -51,11 +51,19 @@ void simple_clock_face_activate(movement_settings_t *settings, void *context) {
 
     if (watch_tick_animation_is_running()) watch_stop_tick_animation();
 
+    // cache the hour mode so the lean low energy updater doesn't need the settings struct.
+    state->clock_mode_24h = settings->bit.clock_mode_24h;
     if (settings->bit.clock_mode_24h) watch_set_indicator(WATCH_INDICATOR_24H);
 
-    // handle chime indicator
-    if (state->signal_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
-    else watch_clear_indicator(WATCH_INDICATOR_BELL);
+#ifndef CLOCK_FACE_DISABLE_CHIME
+    // handle chime indicator; scheduled tasks don't survive a trip through BACKUP mode,
+    // so re-arming the hourly chime here is cheap insurance (and idempotent).
+    // (make CLOCK_NO_CHIME=1 compiles the whole capability out of the face.)
+    if (state->signal_enabled) {
+        watch_set_indicator(WATCH_INDICATOR_BELL);
+        movement_schedule_background_task_for_face(state->watch_face_index, movement_next_chime(60));
+    } else watch_clear_indicator(WATCH_INDICATOR_BELL);
+#endif
 
     // show alarm indicator if there is an active alarm
     _update_alarm_indicator(settings->bit.alarm_enabled, state);
@@ -69,7 +77,6 @@ void simple_clock_face_activate(movement_settings_t *settings, void *context) {
 bool simple_clock_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     simple_clock_state_t *state = (simple_clock_state_t *)context;
     char buf[11];
-    uint8_t pos;
 
     watch_date_time date_time;
     uint32_t previous_date_time;
@@ -77,36 +84,38 @@ bool simple_clock_face_loop(movement_event_t event, movement_settings_t *setting
         case EVENT_ACTIVATE:
         case EVENT_TICK:
         case EVENT_LOW_ENERGY_UPDATE:
-            date_time = watch_rtc_get_date_time();
+            date_time = event.date_time;
             previous_date_time = state->previous_date_time;
             state->previous_date_time = date_time.reg;
 
-            // check the battery voltage once a day...
-            if (date_time.unit.day != state->last_battery_check) {
-                state->last_battery_check = date_time.unit.day;
-                watch_enable_adc();
-                uint16_t voltage = watch_get_vcc_voltage();
-                watch_disable_adc();
-                // 2.2 volts will happen when the battery has maybe 5-10% remaining?
-                // we can refine this later.
-                state->battery_low = (voltage < 2200);
-            }
-
-            // ...and set the LAP indicator if low.
-            if (state->battery_low) watch_set_indicator(WATCH_INDICATOR_LAP);
-
             if ((date_time.reg >> 6) == (previous_date_time >> 6) && event.event_type != EVENT_LOW_ENERGY_UPDATE) {
-                // everything before seconds is the same, don't waste cycles setting those segments.
-                watch_display_character_lp_seconds('0' + date_time.unit.second / 10, 8);
-                watch_display_character_lp_seconds('0' + date_time.unit.second % 10, 9);
+                // everything before seconds is the same: segment writes straight from the
+                // packed field, usually just the ones digit. This is the 24/7 duty cycle path.
+                watch_display_seconds(date_time.unit.second);
                 break;
             } else if ((date_time.reg >> 12) == (previous_date_time >> 12) && event.event_type != EVENT_LOW_ENERGY_UPDATE) {
                 // everything before minutes is the same.
-                pos = 6;
-                sprintf(buf, "%02d%02d", date_time.unit.minute, date_time.unit.second);
+                watch_display_2d(date_time.unit.minute, 6);
+                watch_display_2d(date_time.unit.second, 8);
             } else {
-                // other stuff changed; let's do it all.
-                if (!settings->bit.clock_mode_24h) {
+                // other stuff changed; let's do it all. Anything keyed to slow rollovers also
+                // lives here, so the seconds-only path above stays free of per-tick overhead:
+                // a day change always lands in this branch, so the daily battery check runs
+                // exactly when it can matter and the LAP indicator is only rewritten when the
+                // rest of the line is being redrawn anyway.
+                if (date_time.unit.day != state->last_battery_check) {
+                    state->last_battery_check = date_time.unit.day;
+                    watch_enable_adc();
+                    uint16_t voltage = watch_get_vcc_voltage();
+                    watch_disable_adc();
+                    // 2.2 volts will happen when the battery has maybe 5-10% remaining?
+                    // we can refine this later.
+                    state->battery_low = (voltage < 2200);
+                }
+                if (state->battery_low) watch_set_indicator(WATCH_INDICATOR_LAP);
+
+                // the decoded settings cache spares the bitfield extraction on this per-tick path.
+                if (!movement_settings_cache.clock_mode_24h) {
                     // if we are in 12 hour mode, do some cleanup.
                     if (date_time.unit.hour < 12) {
                         watch_clear_indicator(WATCH_INDICATOR_PM);
@@ -116,38 +125,47 @@ bool simple_clock_face_loop(movement_event_t event, movement_settings_t *setting
                     date_time.unit.hour %= 12;
                     if (date_time.unit.hour == 0) date_time.unit.hour = 12;
                 }
-                pos = 0;
+                // build the whole line with the integer formatters; sprintf's format parsing
+                // and software divides have no place in a function that runs every second.
+                const char *weekday = watch_utility_get_weekday(date_time);
+                buf[0] = weekday[0];
+                buf[1] = weekday[1];
+                watch_utility_format_2d_space(buf + 2, date_time.unit.day);
+                watch_utility_format_2d_space(buf + 4, date_time.unit.hour);
+                watch_utility_format_2d(buf + 6, date_time.unit.minute);
                 if (event.event_type == EVENT_LOW_ENERGY_UPDATE) {
                     if (!watch_tick_animation_is_running()) watch_start_tick_animation(500);
-                    sprintf(buf, "%s%2d%2d%02d  ", watch_utility_get_weekday(date_time), date_time.unit.day, date_time.unit.hour, date_time.unit.minute);
+                    buf[8] = ' ';
+                    buf[9] = ' ';
                 } else {
-                    sprintf(buf, "%s%2d%2d%02d%02d", watch_utility_get_weekday(date_time), date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
+                    watch_utility_format_2d(buf + 8, date_time.unit.second);
                 }
+                buf[10] = 0;
+                watch_display_string(buf, 0);
             }
-            watch_display_string(buf, pos);
             // handle alarm indicator
-            if (state->alarm_enabled != settings->bit.alarm_enabled) _update_alarm_indicator(settings->bit.alarm_enabled, state);
+            if (state->alarm_enabled != movement_settings_cache.alarm_enabled) _update_alarm_indicator(movement_settings_cache.alarm_enabled, state);
             break;
+#ifndef CLOCK_FACE_DISABLE_CHIME
         case EVENT_ALARM_LONG_PRESS:
             state->signal_enabled = !state->signal_enabled;
-            if (state->signal_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
-            else watch_clear_indicator(WATCH_INDICATOR_BELL);
+            if (state->signal_enabled) {
+                watch_set_indicator(WATCH_INDICATOR_BELL);
+                movement_schedule_background_task_for_face(state->watch_face_index, movement_next_chime(60));
+            } else {
+                watch_clear_indicator(WATCH_INDICATOR_BELL);
+                movement_cancel_background_task_for_face(state->watch_face_index);
+            }
             break;
         case EVENT_BACKGROUND_TASK:
             // uncomment this line to snap back to the clock face when the hour signal sounds:
             // movement_move_to_face(state->watch_face_index);
-            if (watch_is_buzzer_or_led_enabled()) {
-                // if we are in the foreground, we can just beep.
-                movement_play_signal();
-            } else {
-                // if we were in the background, we need to enable the buzzer peripheral first,
-                watch_enable_buzzer();
-                // beep quickly (this call blocks for 275 ms),
-                movement_play_signal();
-                // and then turn the buzzer peripheral off again.
-                watch_disable_buzzer();
-            }
+            // the chime plays through the sequencer, which handles powering the buzzer
+            // even when this fires in the background; then arm the next top of the hour.
+            movement_play_signal();
+            movement_schedule_background_task_for_face(state->watch_face_index, movement_next_chime(60));
             break;
+#endif
         default:
             return movement_default_loop_handler(event, settings);
     }
@@ -155,17 +173,58 @@ bool simple_clock_face_loop(movement_event_t event, movement_settings_t *setting
     return true;
 }
 
-void simple_clock_face_resign(movement_settings_t *settings, void *context) {
-    (void) settings;
-    (void) context;
-}
-
-bool simple_clock_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
+void simple_clock_face_le_update(watch_date_time date_time, void *context) {
     simple_clock_state_t *state = (simple_clock_state_t *)context;
-    if (!state->signal_enabled) return false;
+    char buf[11];
+
+    state->previous_date_time = date_time.reg;
+
+    if (!state->clock_mode_24h) {
+        if (date_time.unit.hour < 12) {
+            watch_clear_indicator(WATCH_INDICATOR_PM);
+        } else {
+            watch_set_indicator(WATCH_INDICATOR_PM);
+        }
+        date_time.unit.hour %= 12;
+        if (date_time.unit.hour == 0) date_time.unit.hour = 12;
+    }
 
+    if (!watch_tick_animation_is_running()) watch_start_tick_animation(500);
+    const char *weekday = watch_utility_get_weekday(date_time);
+    buf[0] = weekday[0];
+    buf[1] = weekday[1];
+    watch_utility_format_2d_space(buf + 2, date_time.unit.day);
+    watch_utility_format_2d_space(buf + 4, date_time.unit.hour);
+    watch_utility_format_2d(buf + 6, date_time.unit.minute);
+    buf[8] = ' ';
+    buf[9] = ' ';
+    buf[10] = 0;
+    watch_display_string(buf, 0);
+}
+
+void simple_clock_face_peek(movement_settings_t *settings, void *context) {
+    (void) context;
+    // a stateless render for momentary peeks from other faces: just the time, into the
+    // display buffer. No indicators, no colon, no state touched; the peeking face's
+    // frame comes back when the peek ends.
     watch_date_time date_time = watch_rtc_get_date_time();
 
-    return date_time.unit.minute == 0;
+    if (!settings->bit.clock_mode_24h) {
+        date_time.unit.hour %= 12;
+        if (date_time.unit.hour == 0) date_time.unit.hour = 12;
+    }
+
+    char *buf = movement_get_display_buffer();
+    const char *weekday = watch_utility_get_weekday(date_time);
+    buf[0] = weekday[0];
+    buf[1] = weekday[1];
+    watch_utility_format_2d_space(buf + 2, date_time.unit.day);
+    watch_utility_format_2d_space(buf + 4, date_time.unit.hour);
+    watch_utility_format_2d(buf + 6, date_time.unit.minute);
+    watch_utility_format_2d(buf + 8, date_time.unit.second);
+}
+
+void simple_clock_face_resign(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
 }
@@ -34,20 +34,24 @@ typedef struct {
     bool signal_enabled;
     bool battery_low;
     bool alarm_enabled;
+    bool clock_mode_24h; // cached at activate for the lean low energy updater
 } simple_clock_state_t;
 
 void simple_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void simple_clock_face_activate(movement_settings_t *settings, void *context);
 bool simple_clock_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void simple_clock_face_resign(movement_settings_t *settings, void *context);
-bool simple_clock_face_wants_background_task(movement_settings_t *settings, void *context);
+void simple_clock_face_le_update(watch_date_time date_time, void *context);
+void simple_clock_face_peek(movement_settings_t *settings, void *context);
 
 #define simple_clock_face ((const watch_face_t){ \
     simple_clock_face_setup, \
     simple_clock_face_activate, \
     simple_clock_face_loop, \
     simple_clock_face_resign, \
-    simple_clock_face_wants_background_task, \
+    NULL, \
+    simple_clock_face_le_update, \
+    simple_clock_face_peek, \
 })
 
 #endif // SIMPLE_CLOCK_FACE_H_
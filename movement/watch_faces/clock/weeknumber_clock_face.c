@@ -26,6 +26,7 @@
 #include "weeknumber_clock_face.h"
 #include "watch.h"
 #include "watch_utility.h"
+#include "watch_private_display.h"
 
 static void _update_alarm_indicator(bool settings_alarm_enabled, weeknumber_clock_state_t *state) {
     state->alarm_enabled = settings_alarm_enabled;
@@ -38,7 +39,7 @@ void weeknumber_clock_face_setup(movement_settings_t *settings, uint8_t watch_fa
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(weeknumber_clock_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(weeknumber_clock_state_t));
         weeknumber_clock_state_t *state = (weeknumber_clock_state_t *)*context_ptr;
         state->signal_enabled = false;
         state->watch_face_index = watch_face_index;
@@ -52,9 +53,12 @@ void weeknumber_clock_face_activate(movement_settings_t *settings, void *context
 
     if (settings->bit.clock_mode_24h) watch_set_indicator(WATCH_INDICATOR_24H);
 
-    // handle chime indicator
-    if (state->signal_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
-    else watch_clear_indicator(WATCH_INDICATOR_BELL);
+    // handle chime indicator; scheduled tasks don't survive a trip through BACKUP mode,
+    // so re-arming the hourly chime here is cheap insurance (and idempotent).
+    if (state->signal_enabled) {
+        watch_set_indicator(WATCH_INDICATOR_BELL);
+        movement_schedule_background_task_for_face(state->watch_face_index, movement_next_chime(60));
+    } else watch_clear_indicator(WATCH_INDICATOR_BELL);
 
     // show alarm indicator if there is an active alarm
     _update_alarm_indicator(settings->bit.alarm_enabled, state);
@@ -68,7 +72,6 @@ void weeknumber_clock_face_activate(movement_settings_t *settings, void *context
 bool weeknumber_clock_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     weeknumber_clock_state_t *state = (weeknumber_clock_state_t *)context;
     char buf[11];
-    uint8_t pos;
 
     watch_date_time date_time;
     uint32_t previous_date_time;
@@ -76,30 +79,39 @@ bool weeknumber_clock_face_loop(movement_event_t event, movement_settings_t *set
         case EVENT_ACTIVATE:
         case EVENT_TICK:
         case EVENT_LOW_ENERGY_UPDATE:
-            date_time = watch_rtc_get_date_time();
+            date_time = event.date_time;
             previous_date_time = state->previous_date_time;
             state->previous_date_time = date_time.reg;
 
-            // check the battery voltage once a day...
-            if (date_time.unit.day != state->last_battery_check) {
-                state->last_battery_check = date_time.unit.day;
-                watch_enable_adc();
-                uint16_t voltage = watch_get_vcc_voltage();
-                watch_disable_adc();
-                // 2.2 volts will happen when the battery has maybe 5-10% remaining?
-                // we can refine this later.
-                state->battery_low = (voltage < 2200);
+            // the week number only changes at midnight: recompute it when the date fields
+            // roll over (or on activate, when none of the fields match) and cache it.
+            if ((date_time.reg >> 17) != (previous_date_time >> 17)) {
+                state->cached_weeknumber = watch_utility_get_weeknumber(date_time.unit.year, date_time.unit.month, date_time.unit.day);
             }
 
-            // ...and set the LAP indicator if low.
-            if (state->battery_low) watch_set_indicator(WATCH_INDICATOR_LAP);
-
-            if ((date_time.reg >> 12) == (previous_date_time >> 12) && event.event_type != EVENT_LOW_ENERGY_UPDATE) {
-                // everything before minutes is the same.
-                pos = 6;
-                sprintf(buf, "%02d%02d", date_time.unit.minute, watch_utility_get_weeknumber(date_time.unit.year, date_time.unit.month, date_time.unit.day));
+            if ((date_time.reg >> 6) == (previous_date_time >> 6) && event.event_type != EVENT_LOW_ENERGY_UPDATE) {
+                // this face shows no seconds — the week number lives in those positions — so
+                // until the minute rolls over there is nothing to redraw at all.
+                break;
+            } else if ((date_time.reg >> 12) == (previous_date_time >> 12) && event.event_type != EVENT_LOW_ENERGY_UPDATE) {
+                // only the minute rolled over; the cached week number can't have changed with
+                // the date intact, so positions 8-9 stay untouched.
+                watch_display_2d(date_time.unit.minute, 6);
             } else {
-                // other stuff changed; let's do it all.
+                // other stuff changed; let's do it all. Housekeeping keyed to slow rollovers
+                // lives here too, so the paths above stay lean: a day change always lands in
+                // this branch, which is when the daily battery check can matter.
+                if (date_time.unit.day != state->last_battery_check) {
+                    state->last_battery_check = date_time.unit.day;
+                    watch_enable_adc();
+                    uint16_t voltage = watch_get_vcc_voltage();
+                    watch_disable_adc();
+                    // 2.2 volts will happen when the battery has maybe 5-10% remaining?
+                    // we can refine this later.
+                    state->battery_low = (voltage < 2200);
+                }
+                if (state->battery_low) watch_set_indicator(WATCH_INDICATOR_LAP);
+
                 if (!settings->bit.clock_mode_24h) {
                     // if we are in 12 hour mode, do some cleanup.
                     if (date_time.unit.hour < 12) {
@@ -110,37 +122,42 @@ bool weeknumber_clock_face_loop(movement_event_t event, movement_settings_t *set
                     date_time.unit.hour %= 12;
                     if (date_time.unit.hour == 0) date_time.unit.hour = 12;
                 }
-                pos = 0;
+                const char *weekday = watch_utility_get_weekday(date_time);
+                buf[0] = weekday[0];
+                buf[1] = weekday[1];
+                watch_utility_format_2d_space(buf + 2, date_time.unit.day);
+                watch_utility_format_2d_space(buf + 4, date_time.unit.hour);
+                watch_utility_format_2d(buf + 6, date_time.unit.minute);
                 if (event.event_type == EVENT_LOW_ENERGY_UPDATE) {
                     if (!watch_tick_animation_is_running()) watch_start_tick_animation(500);
-                    sprintf(buf, "%s%2d%2d%02d  ", watch_utility_get_weekday(date_time), date_time.unit.day, date_time.unit.hour, date_time.unit.minute);
+                    buf[8] = ' ';
+                    buf[9] = ' ';
                 } else {
-                    sprintf(buf, "%s%2d%2d%02d%02d", watch_utility_get_weekday(date_time), date_time.unit.day, date_time.unit.hour, date_time.unit.minute, watch_utility_get_weeknumber(date_time.unit.year, date_time.unit.month, date_time.unit.day));
+                    watch_utility_format_2d(buf + 8, state->cached_weeknumber);
                 }
+                buf[10] = 0;
+                watch_display_string(buf, 0);
             }
-            watch_display_string(buf, pos);
             // handle alarm indicator
             if (state->alarm_enabled != settings->bit.alarm_enabled) _update_alarm_indicator(settings->bit.alarm_enabled, state);
             break;
         case EVENT_ALARM_LONG_PRESS:
             state->signal_enabled = !state->signal_enabled;
-            if (state->signal_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
-            else watch_clear_indicator(WATCH_INDICATOR_BELL);
+            if (state->signal_enabled) {
+                watch_set_indicator(WATCH_INDICATOR_BELL);
+                movement_schedule_background_task_for_face(state->watch_face_index, movement_next_chime(60));
+            } else {
+                watch_clear_indicator(WATCH_INDICATOR_BELL);
+                movement_cancel_background_task_for_face(state->watch_face_index);
+            }
             break;
         case EVENT_BACKGROUND_TASK:
             // uncomment this line to snap back to the clock face when the hour signal sounds:
             // movement_move_to_face(state->watch_face_index);
-            if (watch_is_buzzer_or_led_enabled()) {
-                // if we are in the foreground, we can just beep.
-                movement_play_signal();
-            } else {
-                // if we were in the background, we need to enable the buzzer peripheral first,
-                watch_enable_buzzer();
-                // beep quickly (this call blocks for 275 ms),
-                movement_play_signal();
-                // and then turn the buzzer peripheral off again.
-                watch_disable_buzzer();
-            }
+            // the chime plays through the sequencer, which handles powering the buzzer
+            // even when this fires in the background; then arm the next top of the hour.
+            movement_play_signal();
+            movement_schedule_background_task_for_face(state->watch_face_index, movement_next_chime(60));
             break;
         default:
             movement_default_loop_handler(event, settings);
@@ -154,13 +171,3 @@ void weeknumber_clock_face_resign(movement_settings_t *settings, void *context)
     (void) settings;
     (void) context;
 }
-
-bool weeknumber_clock_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    weeknumber_clock_state_t *state = (weeknumber_clock_state_t *)context;
-    if (!state->signal_enabled) return false;
-
-    watch_date_time date_time = watch_rtc_get_date_time();
-
-    return date_time.unit.minute == 0;
-}
@@ -31,6 +31,9 @@ typedef struct {
     uint32_t previous_date_time;
     uint8_t last_battery_check;
     uint8_t watch_face_index;
+    // the ISO week number only changes at midnight, so it is computed on day rollover and
+    // cached here rather than recomputed with full date math in the loop function.
+    uint8_t cached_weeknumber;
     bool signal_enabled;
     bool battery_low;
     bool alarm_enabled;
@@ -40,14 +43,14 @@ void weeknumber_clock_face_setup(movement_settings_t *settings, uint8_t watch_fa
 void weeknumber_clock_face_activate(movement_settings_t *settings, void *context);
 bool weeknumber_clock_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void weeknumber_clock_face_resign(movement_settings_t *settings, void *context);
-bool weeknumber_clock_face_wants_background_task(movement_settings_t *settings, void *context);
 
 #define weeknumber_clock_face ((const watch_face_t){ \
     weeknumber_clock_face_setup, \
     weeknumber_clock_face_activate, \
     weeknumber_clock_face_loop, \
     weeknumber_clock_face_resign, \
-    weeknumber_clock_face_wants_background_task, \
+    NULL, \
+    NULL, \
 })
 
 #endif // SIMPLE_CLOCK_FACE_H_
@@ -32,7 +32,7 @@ void world_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_in
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(world_clock_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(world_clock_state_t));
         memset(*context_ptr, 0, sizeof(world_clock_state_t));
         uint8_t backup_register = movement_claim_backup_register();
         if (backup_register) {
@@ -63,12 +63,20 @@ static bool world_clock_face_do_display_mode(movement_event_t event, movement_se
             if (settings->bit.clock_mode_24h) watch_set_indicator(WATCH_INDICATOR_24H);
             watch_set_colon();
             state->previous_date_time = 0xFFFFFFFF;
+            state->cached_local_time = 0xFFFFFFFF;
             // fall through
         case EVENT_TICK:
         case EVENT_LOW_ENERGY_UPDATE:
-            date_time = watch_rtc_get_date_time();
-            timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
-            date_time = watch_utility_date_time_from_unix_time(timestamp, movement_timezone_offsets[state->settings.bit.timezone_index] * 60);
+            date_time = event.date_time;
+            // zone offsets are whole minutes, so the converted time only needs recomputing
+            // when the local minute rolls over (or on activate / after a zone change, which
+            // invalidate the cache). in between, the zone's seconds are just our seconds.
+            if ((date_time.reg >> 6) != (state->cached_local_time >> 6)) {
+                timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offset(settings->bit.time_zone));
+                state->cached_local_time = date_time.reg;
+                state->cached_zone_time = watch_utility_date_time_from_unix_time(timestamp, movement_timezone_offset(state->settings.bit.timezone_index)).reg;
+            }
+            date_time.reg = (state->cached_zone_time & ~0x3F) | date_time.unit.second;
             previous_date_time = state->previous_date_time;
             state->previous_date_time = date_time.reg;
 
@@ -111,7 +119,10 @@ static bool world_clock_face_do_display_mode(movement_event_t event, movement_se
                         date_time.unit.second);
                 }
             }
+            // batch the digit updates so the whole line lands on screen in one frame
+            watch_display_begin();
             watch_display_string(buf, pos);
+            watch_display_commit();
             break;
         case EVENT_ALARM_LONG_PRESS:
             movement_request_tick_frequency(4);
@@ -168,11 +179,10 @@ static bool _world_clock_face_do_settings_mode(movement_event_t event, movement_
     }
 
     char buf[13];
-    sprintf(buf, "%c%c %3d%02d  ",
+    sprintf(buf, "%c%c %s  ",
         movement_valid_position_0_chars[state->settings.bit.char_0],
         movement_valid_position_1_chars[state->settings.bit.char_1],
-        (int8_t) (movement_timezone_offsets[state->settings.bit.timezone_index] / 60),
-        (int8_t) (movement_timezone_offsets[state->settings.bit.timezone_index] % 60) * (movement_timezone_offsets[state->settings.bit.timezone_index] < 0 ? -1 : 1));
+        movement_timezone_labels[state->settings.bit.timezone_index]);
     watch_set_colon();
     watch_clear_indicator(WATCH_INDICATOR_PM);
 
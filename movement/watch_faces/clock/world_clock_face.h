@@ -40,6 +40,8 @@ typedef struct {
     uint8_t backup_register;
     uint8_t current_screen;
     uint32_t previous_date_time;
+    uint32_t cached_local_time;     // local date_time.reg the zone conversion was done from
+    uint32_t cached_zone_time;      // zone-adjusted date_time.reg, valid for that local minute
 } world_clock_state_t;
 
 void world_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -55,6 +57,7 @@ uint8_t world_clock_face_get_weekday(uint16_t day, uint16_t month, uint16_t year
     world_clock_face_loop, \
     world_clock_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // WORLD_CLOCK_FACE_H_
@@ -153,47 +153,66 @@ static void _alarm_initiate_setting(movement_settings_t *settings, alarm_state_t
 static void _alarm_resume_setting(movement_settings_t *settings, alarm_state_t *state, uint8_t subsecond) {
     state->is_setting = false;
     movement_request_tick_frequency(1);
+    // settings mode is where slots change; leaving it is the moment to rebuild the schedule.
+    _alarm_commit_schedule(settings, state);
     _alarm_face_draw(settings, state, subsecond);
 }
 
-static void _alarm_update_alarm_enabled(movement_settings_t *settings, alarm_state_t *state) {
-    // save indication for active alarms to movement settings
-    bool active_alarms = false;
-    watch_date_time now;
-    bool now_init = false;
-    uint8_t weekday_idx;
-    uint16_t now_minutes_of_day;
-    uint16_t alarm_minutes_of_day;
+static uint32_t _alarm_next_occurrence(const alarm_setting_t *alarm, uint8_t weekday_idx, uint32_t midnight_ts, uint32_t now_ts) {
+    // walk forward at most a week (plus today) and return the first minute this slot matches;
+    // 0 means the slot never comes up, which can't happen for an enabled slot but keeps the
+    // caller honest.
+    for (uint8_t d = 0; d < 8; d++) {
+        uint8_t wd = (weekday_idx + d) % 7;
+        bool day_matches = alarm->day == ALARM_DAY_EACH_DAY
+            || alarm->day == ALARM_DAY_ONE_TIME
+            || alarm->day == wd
+            || (alarm->day == ALARM_DAY_WORKDAY && wd < 5)
+            || (alarm->day == ALARM_DAY_WEEKEND && wd >= 5);
+        if (!day_matches) continue;
+        uint32_t ts = midnight_ts + (uint32_t)d * 86400 + (uint32_t)alarm->hour * 3600 + (uint32_t)alarm->minute * 60;
+        if (ts > now_ts) return ts;
+    }
+    return 0;
+}
+
+// Recomputes the next-occurrence schedule and programs movement's scheduled task and the
+// 24-hour alarm indicator from its head. This runs only when a slot changes or an alarm
+// fires; in between, nothing polls the slots at all — movement's minute sweep is a single
+// compare against its earliest scheduled deadline, and it wakes us at exactly the right
+// minute.
+static void _alarm_commit_schedule(movement_settings_t *settings, alarm_state_t *state) {
+    watch_date_time now = watch_rtc_get_date_time();
+    uint32_t now_ts = watch_utility_date_time_to_unix_time(now, 0);
+    watch_date_time midnight = now;
+    midnight.reg &= ~(uint32_t)0x1FFFF;  // clear the time-of-day bits
+    uint32_t midnight_ts = now_ts - (uint32_t)watch_date_time_seconds_between(midnight, now);
+    uint8_t weekday_idx = _get_weekday_idx(now);
+
+    uint32_t best = 0;
+    uint8_t best_idx = 0;
     for (uint8_t i = 0; i < ALARM_ALARMS; i++) {
-        if (state->alarm[i].enabled) {
-            // figure out if alarm is to go off in the next 24 h
-            if (state->alarm[i].day == ALARM_DAY_EACH_DAY || state->alarm[i].day == ALARM_DAY_ONE_TIME) {
-            active_alarms = true;
-            break;
-            } else {
-                if (!now_init) {
-                    now = watch_rtc_get_date_time();
-                    now_init = true;
-                    weekday_idx = _get_weekday_idx(now);
-                    now_minutes_of_day = now.unit.hour * 60 + now.unit.minute;
-                }
-                alarm_minutes_of_day = state->alarm[i].hour * 60 + state->alarm[i].minute;
-                // no more shortcuts: check days and times for all possible cases...
-                if ((state->alarm[i].day == weekday_idx && alarm_minutes_of_day >= now_minutes_of_day)
-                    || ((weekday_idx + 1) % 7 == state->alarm[i].day && alarm_minutes_of_day <= now_minutes_of_day) 
-                    || (state->alarm[i].day == ALARM_DAY_WORKDAY && (weekday_idx < 4
-                        || (weekday_idx == 4 && alarm_minutes_of_day >= now_minutes_of_day)
-                        || (weekday_idx == 6 && alarm_minutes_of_day <= now_minutes_of_day)))
-                    || (state->alarm[i].day == ALARM_DAY_WEEKEND && (weekday_idx == 5
-                        || (weekday_idx == 6 && alarm_minutes_of_day >= now_minutes_of_day)
-                        || (weekday_idx == 4 && alarm_minutes_of_day <= now_minutes_of_day)))) {
-                    active_alarms = true;
-                    break;
-                }
-            }
+        if (!state->alarm[i].enabled) continue;
+        uint32_t ts = _alarm_next_occurrence(&state->alarm[i], weekday_idx, midnight_ts, now_ts);
+        if (ts != 0 && (best == 0 || ts < best)) {
+            best = ts;
+            best_idx = i;
         }
     }
-    settings->bit.alarm_enabled = active_alarms;
+    state->next_alarm_timestamp = best;
+    state->next_alarm_idx = best_idx;
+
+    // the indicator other faces show means "an alarm will go off within 24 hours"
+    settings->bit.alarm_enabled = (best != 0) && (best - now_ts <= 86400);
+
+    if (best == 0) {
+        movement_cancel_background_task_for_face(state->watch_face_index);
+    } else {
+        // if the head is more than a day out, wake early at the moment it crosses into the
+        // 24-hour window so the indicator can turn on; otherwise wake when it fires.
+        uint32_t wake_ts = (best - now_ts > 86400) ? best - 86400 : best;
+        movement_schedule_background_task_for_face(state->watch_face_index, watch_utility_date_time_from_unix_time(wake_ts, 0));
+    }
 }
 
 static void _alarm_play_short_beep(uint8_t pitch_idx) {
@@ -225,10 +244,9 @@ static void _abort_quick_ticks(alarm_state_t *state) {
 
 void alarm_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(alarm_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(alarm_state_t));
         alarm_state_t *state = (alarm_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(alarm_state_t));
         // initialize the default alarm values
@@ -237,55 +255,30 @@ void alarm_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
             state->alarm[i].beeps = 5;
             state->alarm[i].pitch = 1;
         }
-        state->alarm_handled_minute = -1;
         _wait_ticks = -1;
     }
+    ((alarm_state_t *)*context_ptr)->watch_face_index = watch_face_index;
 }
 
 void alarm_face_activate(movement_settings_t *settings, void *context) {
-    (void) settings;
-    (void) context;
+    alarm_state_t *state = (alarm_state_t *)context;
     watch_set_colon();
+    // re-arm from the slots on every activation: it's cheap, idempotent, and rebuilds the
+    // scheduled task if it was lost (movement's task table does not survive BACKUP mode
+    // even when the face context does).
+    _alarm_commit_schedule(settings, state);
 }
 
 void alarm_face_resign(movement_settings_t *settings, void *context) {
     alarm_state_t *state = (alarm_state_t *)context;
     state->is_setting = false;
-    _alarm_update_alarm_enabled(settings, state);
+    _alarm_commit_schedule(settings, state);
     watch_set_led_off();
     state->alarm_quick_ticks = false;
     _wait_ticks = -1;
     movement_request_tick_frequency(1);
 }
 
-bool alarm_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    alarm_state_t *state = (alarm_state_t *)context;
-    watch_date_time now = watch_rtc_get_date_time();
-    // just a failsafe: never fire more than one alarm within a minute
-    if (state->alarm_handled_minute == now.unit.minute) return false;
-    state->alarm_handled_minute = now.unit.minute;
-    // check the rest
-    for (uint8_t i = 0; i < ALARM_ALARMS; i++) {
-        if (state->alarm[i].enabled) {
-            if (state->alarm[i].minute == now.unit.minute) {
-                if (state->alarm[i].hour == now.unit.hour) {
-                    state->alarm_playing_idx = i;
-                    if (state->alarm[i].day == ALARM_DAY_EACH_DAY || state->alarm[i].day == ALARM_DAY_ONE_TIME) return true;
-                    uint8_t weekday_idx = _get_weekday_idx(now);
-                    if (state->alarm[i].day == weekday_idx) return true;
-                    if (state->alarm[i].day == ALARM_DAY_WORKDAY && weekday_idx < 5) return true;
-                    if (state->alarm[i].day == ALARM_DAY_WEEKEND && weekday_idx >= 5) return true;
-                }
-            }
-        }
-    }
-    state->alarm_handled_minute = -1;
-    // update the movement's alarm indicator five times an hour
-    if (now.unit.minute % 12 == 0) _alarm_update_alarm_enabled(settings, state);
-    return false;
-}
-
 bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     (void) settings;
     alarm_state_t *state = (alarm_state_t *)context;
@@ -307,6 +300,7 @@ bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void
                 if (state->alarm_idx) {
                     // revert change of enabled flag and show it briefly
                     state->alarm[state->alarm_idx].enabled ^= 1;
+                    _alarm_commit_schedule(settings, state);
                     _alarm_set_signal(state);
                     delay_ms(275);
                     state->alarm_idx = 0;
@@ -387,6 +381,7 @@ bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void
         if (!state->is_setting) {
             // toggle the enabled flag for current alarm
             state->alarm[state->alarm_idx].enabled ^= 1;
+            _alarm_commit_schedule(settings, state);
             // start wait ticks counter
             _wait_ticks = 0;
         } else {
@@ -415,6 +410,15 @@ bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void
         } else _wait_ticks = -1;
         break;
     case EVENT_BACKGROUND_TASK:
+        // movement woke us at the head of the schedule. If the head is still more than a
+        // minute away, this was the early wake that moves it into the 24-hour indicator
+        // window: refresh the indicator and re-arm for the actual firing time.
+        if (state->next_alarm_timestamp == 0 ||
+            watch_utility_date_time_to_unix_time(event.date_time, 0) + 60 <= state->next_alarm_timestamp) {
+            _alarm_commit_schedule(settings, state);
+            break;
+        }
+        state->alarm_playing_idx = state->next_alarm_idx;
         // play alarm
         if (state->alarm[state->alarm_playing_idx].beeps == 0) {
             // short beep
@@ -438,8 +442,9 @@ bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void
             state->alarm[state->alarm_playing_idx].beeps = 5;
             state->alarm[state->alarm_playing_idx].pitch = 1;
             state->alarm[state->alarm_playing_idx].enabled = false;
-            _alarm_update_alarm_enabled(settings, state);
         }
+        // arm the next occurrence (strictly after this minute, so we can't refire)
+        _alarm_commit_schedule(settings, state);
         break;
     case EVENT_TIMEOUT:
         movement_move_to_face(0);
@@ -55,9 +55,14 @@ typedef struct {
     uint8_t alarm_idx : 4;
     uint8_t alarm_playing_idx : 4;
     uint8_t setting_state : 3;
-    int8_t alarm_handled_minute;
     bool alarm_quick_ticks : 1;
     bool is_setting : 1;
+    uint8_t watch_face_index;
+    // head of the precomputed alarm schedule: the unix timestamp and slot index of the next
+    // alarm due, recomputed only when a slot is edited or an alarm fires. Movement's scheduled
+    // task wakes the face at exactly that minute, so there is no per-minute slot scan at all.
+    uint32_t next_alarm_timestamp;
+    uint8_t next_alarm_idx;
     alarm_setting_t alarm[ALARM_ALARMS];
 } alarm_state_t;
 
@@ -66,14 +71,14 @@ void alarm_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
 void alarm_face_activate(movement_settings_t *settings, void *context);
 bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void alarm_face_resign(movement_settings_t *settings, void *context);
-bool alarm_face_wants_background_task(movement_settings_t *settings, void *context);
 
 #define alarm_face ((const watch_face_t){ \
     alarm_face_setup, \
     alarm_face_activate, \
     alarm_face_loop, \
     alarm_face_resign, \
-    alarm_face_wants_background_task, \
+    NULL, \
+    NULL, \
 })
 
 #endif // ALARM_FACE_H_
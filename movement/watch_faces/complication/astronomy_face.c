@@ -80,9 +80,12 @@ static void _astronomy_face_recalculate(movement_settings_t *settings, astronomy
 #endif
 
     watch_date_time date_time = watch_rtc_get_date_time();
-    uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offset(settings->bit.time_zone));
     date_time = watch_utility_date_time_from_unix_time(timestamp, 0);
-    double jd = astro_convert_date_to_julian_date(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
+    // rata die + 1721424.5 is the Julian day at midnight; add the time of day as a
+    // fraction. Integer calendar math instead of astrolib's chain of double floors.
+    double jd = watch_utility_rata_die(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day) + 1721424.5
+        + (date_time.unit.hour * 3600 + date_time.unit.minute * 60 + date_time.unit.second) / 86400.0;
 
     astro_equatorial_coordinates_t radec_precession = astro_get_ra_dec(jd, astronomy_available_celestial_bodies[state->active_body_index], state->latitude_radians, state->longitude_radians, true);
     printf("\nParams to convert: %f %f %f %f %f\n",
@@ -192,7 +195,7 @@ void astronomy_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(astronomy_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(astronomy_state_t));
         memset(*context_ptr, 0, sizeof(astronomy_state_t));
     }
 }
@@ -63,6 +63,8 @@ void astronomy_face_resign(movement_settings_t *settings, void *context);
     astronomy_face_loop, \
     astronomy_face_resign, \
     NULL, \
+    NULL, \
+    .cpu_boost_on_activate = true, \
 })
 
 #endif // ASTRONOMY_FACE_H_
@@ -31,7 +31,7 @@ void blinky_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(blinky_face_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(blinky_face_state_t));
         memset(*context_ptr, 0, sizeof(blinky_face_state_t));
     }
 }
@@ -67,10 +67,15 @@ bool blinky_face_loop(movement_event_t event, movement_settings_t *settings, voi
             if (!state->active) {
                 state->active = true;
                 watch_clear_display();
-                movement_request_tick_frequency(state->fast ? 8 : 2);            
+                // the pattern runs from a hardware timer while we sleep; phases match the
+                // old software blink (8 Hz and 2 Hz toggles).
+                uint16_t phase_ms = state->fast ? 125 : 500;
+                if (state->color == 0) watch_led_blink_pattern(255, 0, phase_ms, phase_ms);
+                else if (state->color == 1) watch_led_blink_pattern(0, 255, phase_ms, phase_ms);
+                else watch_led_blink_pattern(255, 255, phase_ms, phase_ms);
             } else {
                 state->active = false;
-                watch_set_led_off();
+                watch_led_blink_stop();
                 _blinky_face_update_lcd(state);
             }
             break;
@@ -81,12 +86,7 @@ bool blinky_face_loop(movement_event_t event, movement_settings_t *settings, voi
             }
             break;
         case EVENT_TICK:
-            if (state->active) {
-                if (event.subsecond % 2 == 0) watch_set_led_off();
-                else if (state->color == 0) watch_set_led_red();
-                else if (state->color == 1) watch_set_led_green();
-                else watch_set_led_yellow();
-            }
+            // nothing to do while blinking: the timer runs the pattern on its own.
             break;
         case EVENT_TIMEOUT:
             if (!state->active) movement_move_to_face(0);
@@ -102,5 +102,6 @@ bool blinky_face_loop(movement_event_t event, movement_settings_t *settings, voi
 void blinky_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
+    watch_led_blink_stop();
     watch_set_led_off();
 }
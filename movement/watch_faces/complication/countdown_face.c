@@ -42,6 +42,12 @@
 
     - When paused or terminated, press the light button to restore the
       last entered countdown.
+
+    - While running, press and hold the light button to toggle low refresh
+      mode: the display shows hours and minutes only and the watch sleeps
+      between minute rollovers instead of waking every second, which matters
+      for long countdowns (cooking, parking meters). The final minute always
+      counts down live.
 */
 
 #define CD_SELECTIONS 3
@@ -60,7 +66,39 @@ static void abort_quick_ticks(countdown_state_t *state) {
 }
 
 static inline int32_t get_tz_offset(movement_settings_t *settings) {
-    return movement_timezone_offsets[settings->bit.time_zone] * 60;
+    return movement_timezone_offset(settings->bit.time_zone);
+}
+
+static inline uint32_t now_unix(countdown_state_t *state, movement_settings_t *settings) {
+    // the full calendar conversion happens at most once per day: cache midnight's
+    // timestamp and derive now from the packed time-of-day bits, which is
+    // watch_date_time_seconds_between's same-day fast path. This runs every tick
+    // while the countdown is running, so it's worth keeping register-cheap.
+    watch_date_time now = watch_rtc_get_date_time();
+    watch_date_time midnight = now;
+    midnight.reg &= ~(uint32_t)0x1FFFF;  // clear the time-of-day bits
+    int32_t tz = get_tz_offset(settings);
+    if (midnight.reg != state->midnight_reg || tz != state->midnight_tz) {
+        state->midnight_reg = midnight.reg;
+        state->midnight_tz = tz;
+        state->midnight_ts = watch_utility_date_time_to_unix_time(midnight, tz);
+    }
+    return state->midnight_ts + (uint32_t)watch_date_time_seconds_between(midnight, now);
+}
+
+static void schedule_next_refresh(countdown_state_t *state) {
+    // in low refresh mode we sleep between minute rollovers: scheduled wakes piggyback
+    // on the minute alarm, so ask for the next one and drop the 1 Hz tick. The final
+    // minute always runs live ticks, both so the seconds reappear for the home stretch
+    // and so the background task at T-0 fires on its exact second.
+    if (state->low_refresh && state->target_ts - state->now_ts > 60) {
+        watch_date_time now = watch_rtc_get_date_time();
+        uint32_t ts = watch_utility_date_time_to_unix_time(now, 0);
+        movement_request_wake_at(watch_utility_date_time_from_unix_time(ts + 60 - now.unit.second, 0));
+        movement_request_tick_frequency(0);
+    } else {
+        movement_request_tick_frequency(1);
+    }
 }
 
 static inline void store_countdown(countdown_state_t *state) {
@@ -84,13 +122,12 @@ static inline void button_beep(movement_settings_t *settings) {
 }
 
 static void start(countdown_state_t *state, movement_settings_t *settings) {
-    watch_date_time now = watch_rtc_get_date_time();
-
     state->mode = cd_running;
-    state->now_ts = watch_utility_date_time_to_unix_time(now, get_tz_offset(settings));
+    state->now_ts = now_unix(state, settings);
     state->target_ts = watch_utility_offset_timestamp(state->now_ts, state->hours, state->minutes, state->seconds);
     watch_date_time target_dt = watch_utility_date_time_from_unix_time(state->target_ts, get_tz_offset(settings));
     movement_schedule_background_task(target_dt);
+    schedule_next_refresh(state);
     watch_set_indicator(WATCH_INDICATOR_BELL);
 }
 
@@ -109,6 +146,8 @@ static void draw(countdown_state_t *state, uint8_t subsecond) {
             state->hours = result.quot;
             state->minutes = result.rem;
             sprintf(buf, "CD  %2d%02d%02d", state->hours, state->minutes, state->seconds);
+            // in low refresh mode the seconds digits stay blank until the final minute
+            if (state->low_refresh && delta > 60) buf[8] = buf[9] = ' ';
             break;
         case cd_reset:
         case cd_paused:
@@ -138,6 +177,8 @@ static void draw(countdown_state_t *state, uint8_t subsecond) {
 
 static void pause(countdown_state_t *state) {
     state->mode = cd_paused;
+    // the tick may be suspended in low refresh mode; the paused display wants it back
+    movement_request_tick_frequency(1);
     movement_cancel_background_task();
     watch_clear_indicator(WATCH_INDICATOR_BELL);
 }
@@ -177,7 +218,7 @@ void countdown_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(countdown_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(countdown_state_t));
         countdown_state_t *state = (countdown_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(countdown_state_t));
         state->minutes = DEFAULT_MINUTES;
@@ -190,14 +231,14 @@ void countdown_face_activate(movement_settings_t *settings, void *context) {
     (void) settings;
     countdown_state_t *state = (countdown_state_t *)context;
     if(state->mode == cd_running) {
-        watch_date_time now = watch_rtc_get_date_time();
-        state->now_ts = watch_utility_date_time_to_unix_time(now, get_tz_offset(settings));
+        state->now_ts = now_unix(state, settings);
         watch_set_indicator(WATCH_INDICATOR_BELL);
     }
     watch_set_colon();
 
     movement_request_tick_frequency(1);
     quick_ticks_running = false;
+    if (state->mode == cd_running) schedule_next_refresh(state);
 }
 
 bool countdown_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
@@ -217,7 +258,10 @@ bool countdown_face_loop(movement_event_t event, movement_settings_t *settings,
             }
 
             if (state->mode == cd_running) {
-                state->now_ts++;
+                // re-derive the remaining time from the RTC rather than counting ticks,
+                // so a missed or suspended tick can never drift us off the true deadline.
+                state->now_ts = now_unix(state, settings);
+                if (state->low_refresh) schedule_next_refresh(state);
             }
             draw(state, event.subsecond);
             break;
@@ -291,6 +335,13 @@ bool countdown_face_loop(movement_event_t event, movement_settings_t *settings,
                         state->seconds = 0;
                         break;
                 }
+            } else if (state->mode == cd_running) {
+                // toggle the minutes-only low refresh display
+                state->low_refresh = !state->low_refresh;
+                button_beep(settings);
+                state->now_ts = now_unix(state, settings);
+                schedule_next_refresh(state);
+                draw(state, event.subsecond);
             }
             break;
         case EVENT_ALARM_LONG_UP:
@@ -49,6 +49,10 @@ typedef enum {
 typedef struct {
     uint32_t target_ts;
     uint32_t now_ts;
+    // cache for the once-a-day calendar conversion behind now_ts; see now_unix().
+    uint32_t midnight_reg;
+    uint32_t midnight_ts;
+    int32_t midnight_tz;
     uint8_t hours;
     uint8_t minutes;
     uint8_t seconds;
@@ -57,6 +61,9 @@ typedef struct {
     uint8_t set_seconds;
     uint8_t selection;
     countdown_mode_t mode;
+    // when set, a running countdown shows hours and minutes only and sleeps between
+    // minute rollovers instead of ticking at 1 Hz; the final minute counts down live.
+    bool low_refresh;
 } countdown_state_t;
 
 
@@ -71,6 +78,7 @@ void countdown_face_resign(movement_settings_t *settings, void *context);
     countdown_face_loop, \
     countdown_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // COUNTDOWN_FACE_H_
@@ -25,14 +25,38 @@
 #include <stdlib.h>
 #include <string.h>
 #include "counter_face.h"
+#include "filesystem.h"
 #include "watch.h"
 
+// stage the live count in the claimed backup register, if we got one.
+static void counter_stage(counter_state_t *state) {
+    if (state->backup_register) {
+        counter_backup_data_t backup_data = {0};
+        backup_data.bit.counter_idx = state->counter_idx;
+        backup_data.bit.valid = 1;
+        watch_store_backup_data(backup_data.reg, state->backup_register);
+    }
+    state->dirty = true;
+}
+
 void counter_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(counter_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(counter_state_t));
         memset(*context_ptr, 0, sizeof(counter_state_t));
+        counter_state_t *state = (counter_state_t *)*context_ptr;
+        // the filesystem holds the count as of the last resign...
+        if (filesystem_get_file_size("counter.ini") == sizeof(state->counter_idx)) {
+            filesystem_read_file("counter.ini", (char *)&state->counter_idx, sizeof(state->counter_idx));
+        }
+        // ...but the staged register copy, if present, is fresher: it tracks every
+        // increment, so a count survives even a reset that preempts the resign flush.
+        state->backup_register = movement_claim_backup_register();
+        if (state->backup_register) {
+            counter_backup_data_t backup_data = (counter_backup_data_t) watch_get_backup_data(state->backup_register);
+            if (backup_data.bit.valid) state->counter_idx = backup_data.bit.counter_idx;
+        }
     }
 }
 
@@ -52,11 +76,13 @@ bool counter_face_loop(movement_event_t event, movement_settings_t *settings, vo
             if (state->counter_idx>99) { //0-99
                 state->counter_idx=0;//reset counter index
             }
+            counter_stage(state);
             print_counter(state);
             beep_counter(state);
             break;
         case EVENT_ALARM_LONG_PRESS:
             state->counter_idx=0; // reset counter index
+            counter_stage(state);
             print_counter(state);
             break;
         case EVENT_ACTIVATE:
@@ -103,5 +129,10 @@ void print_counter(counter_state_t *state) {
 
 void counter_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
-    (void) context;
+    counter_state_t *state = (counter_state_t *)context;
+    // write-behind: the register tracked every increment, flash only changes here.
+    if (state->dirty) {
+        filesystem_write_file("counter.ini", (char *)&state->counter_idx, sizeof(state->counter_idx));
+        state->dirty = false;
+    }
 }
@@ -30,8 +30,24 @@
 // Counter face is designed to count the number of running laps during excercises.
 typedef struct {
     uint8_t counter_idx;
+    uint8_t backup_register;
+    bool dirty; // the count has changed since it was last persisted to the filesystem
 } counter_state_t;
 
+// Live copy of the count staged in one of the BKUP[4-7] registers movement hands out to
+// watch faces. The register is a plain RAM-speed write and survives reset and BACKUP
+// mode, so every increment is crash-safe without touching flash; the filesystem copy is
+// only refreshed when the face resigns. The valid bit distinguishes a staged count of
+// zero from a register that has never been written.
+typedef union {
+    struct {
+        uint32_t counter_idx : 8;
+        uint32_t valid : 1;
+        uint32_t reserved : 23;
+    } bit;
+    uint32_t reg;
+} counter_backup_data_t;
+
 
 void counter_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void counter_face_activate(movement_settings_t *settings, void *context);
@@ -47,6 +63,7 @@ void beep_counter(counter_state_t *state);
     counter_face_loop, \
     counter_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // COUNTER_FACE_H_
@@ -42,59 +42,82 @@ const char *pi_data[] = {
 
 const int databank_num_pages = (sizeof(pi_data) / sizeof(char*) / 2);
 
-struct {
+// The payload strings stay in flash; what we build at setup is a per-record index so that
+// nothing is ever scanned again at runtime. Each entry records the word count (the old code
+// re-ran strlen over the 200-digit pi record on every button press) and how many characters
+// the final word holds, so the display loop is pure pointer arithmetic with no NUL hunting.
+typedef struct {
+    const char *data;      // payload in flash
+    uint8_t num_words;     // payload length in 6-character display words
+    uint8_t last_word_len; // characters in the final word; the rest are blank-padded
+} databank_record_t;
+
+typedef struct {
     uint8_t current_word;
-    uint8_t databank_page;
-    bool animating;
-} databank_state;
+    uint8_t current_record;
+    uint8_t order[sizeof(pi_data) / sizeof(char*) / 2]; // records sorted by label
+    databank_record_t records[sizeof(pi_data) / sizeof(char*) / 2];
+} databank_state_t;
 
 void databank_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
-    // These next two lines just silence the compiler warnings associated with unused parameters.
-    // We have no use for the settings or the watch_face_index, so we make that explicit here.
     (void) settings;
-    (void) context_ptr;
     (void) watch_face_index;
-    // At boot, context_ptr will be NULL indicating that we don't have anyplace to store our context.
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(databank_state_t));
+        memset(*context_ptr, 0, sizeof(databank_state_t));
+        databank_state_t *state = (databank_state_t *)*context_ptr;
+        // index every record once, here, instead of parsing on each activation.
+        for (int i = 0; i < databank_num_pages; i++) {
+            size_t len = strlen(pi_data[i * 2 + 1]);
+            state->records[i].data = pi_data[i * 2 + 1];
+            state->records[i].num_words = (len - 1) / 6 + 1;
+            state->records[i].last_word_len = len - (state->records[i].num_words - 1) * 6;
+            state->order[i] = i;
+        }
+        // sort the index by label so scrolling visits records in a predictable order
+        // regardless of how the table above is maintained. Insertion sort: n is tiny.
+        for (int i = 1; i < databank_num_pages; i++) {
+            uint8_t entry = state->order[i];
+            int j = i - 1;
+            while (j >= 0 && strncmp(pi_data[state->order[j] * 2], pi_data[entry * 2], 2) > 0) {
+                state->order[j + 1] = state->order[j];
+                j--;
+            }
+            state->order[j + 1] = entry;
+        }
+    }
 }
 
 void databank_face_activate(movement_settings_t *settings, void *context) {
     // same as above: silence the warning, we don't need to check the settings.
     (void) settings;
-    (void) context;
-    // we do however need to set some things in our context. Here we cast it to the correct type...
-    databank_state.current_word = 0;
-    databank_state.animating = true;
+    databank_state_t *state = (databank_state_t *)context;
+    state->current_word = 0;
 }
 
-static void display()
+static void display(databank_state_t *state)
 {
     char buf[14];
-    int page = databank_state.current_word;
-    sprintf(buf, "%s%2d", pi_data[databank_state.databank_page * 2 + 0], page);
+    int page = state->current_word;
+    databank_record_t *record = &state->records[state->order[state->current_record]];
+    sprintf(buf, "%s%2d", pi_data[state->order[state->current_record] * 2], page);
     watch_display_string(buf, 0);
-    bool data_ended = false;
+    const char *word = record->data + page * 6;
+    int word_len = (page == record->num_words - 1) ? record->last_word_len : 6;
     for (int i = 0; i < 6; i++) {
-        if (pi_data[databank_state.databank_page * 2 + 1][page * 6 + i] == 0) {
-            data_ended = true;
-        }
-
-        if (!data_ended) {
-            watch_display_character(pi_data[databank_state.databank_page * 2 + 1][page * 6 + i], 4 + i);
-        } else {
-            // only 6 digits per page
-            watch_display_character(' ', 4 + i);
-        }
+        // only 6 digits per page; blank-pad past the end of the record
+        watch_display_character(i < word_len ? word[i] : ' ', 4 + i);
     }
 }
 
 bool databank_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     (void) settings;
-    (void) context;
-    int max_words = (strlen(pi_data[databank_state.databank_page * 2 + 1]) - 1) / 6 + 1;
+    databank_state_t *state = (databank_state_t *)context;
+    int max_words = state->records[state->order[state->current_record]].num_words;
 
     switch (event.event_type) {
         case EVENT_ACTIVATE:
-             display();
+             display(state);
         case EVENT_TICK:
             // on activate and tick, if we are animating,
             break;
@@ -102,24 +125,24 @@ bool databank_face_loop(movement_event_t event, movement_settings_t *settings, v
             // when the user presses 'light', we illuminate the LED. We could override this if
             // our UI needed an additional button for input, consuming the light button press
             // but not illuminating the LED.
-            databank_state.current_word = (databank_state.current_word + max_words - 1) % max_words;
-            display();
+            state->current_word = (state->current_word + max_words - 1) % max_words;
+            display(state);
             break;
         case EVENT_LIGHT_LONG_PRESS:
-            databank_state.databank_page = (databank_state.databank_page + databank_num_pages - 1) % databank_num_pages;
-            databank_state.current_word = 0;
-            display();
+            state->current_record = (state->current_record + databank_num_pages - 1) % databank_num_pages;
+            state->current_word = 0;
+            display(state);
             break;
         case EVENT_ALARM_LONG_PRESS:
-            databank_state.databank_page = (databank_state.databank_page + 1) % databank_num_pages;
-            databank_state.current_word = 0;
-            display();
+            state->current_record = (state->current_record + 1) % databank_num_pages;
+            state->current_word = 0;
+            display(state);
             break;
         case EVENT_ALARM_BUTTON_UP:
             // when the user presses 'alarm', we toggle the state of the animation. If animating,
             // we stop; if stopped, we resume.
-            databank_state.current_word = (databank_state.current_word + 1) % max_words;
-            display();
+            state->current_word = (state->current_word + 1) % max_words;
+            display(state);
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             // This low energy mode update occurs once a minute, if the watch face is in the
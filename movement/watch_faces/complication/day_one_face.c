@@ -26,21 +26,17 @@
 #include <string.h>
 #include "day_one_face.h"
 #include "watch.h"
-
-static uint32_t _day_one_face_juliandaynum(uint16_t year, uint16_t month, uint16_t day) {
-    // from here: https://en.wikipedia.org/wiki/Julian_day#Julian_day_number_calculation
-    return (1461 * (year + 4800 + (month - 14) / 12)) / 4 + (367 * (month - 2 - 12 * ((month - 14) / 12))) / 12 - (3 * ((year + 4900 + (month - 14) / 12) / 100))/4 + day - 32075;
-}
+#include "watch_utility.h"
 
 static void _day_one_face_update(day_one_state_t state) {
     char buf[14];
     watch_date_time date_time = watch_rtc_get_date_time();
-    uint32_t julian_date = _day_one_face_juliandaynum(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day);
-    uint32_t julian_birthdate = _day_one_face_juliandaynum(state.birth_year, state.birth_month, state.birth_day);
-    if (julian_date < julian_birthdate) {
-    	sprintf(buf, "DA  %6lu", julian_birthdate - julian_date);
+    uint32_t today = watch_utility_rata_die(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day);
+    uint32_t birthdate = watch_utility_rata_die(state.birth_year, state.birth_month, state.birth_day);
+    if (today < birthdate) {
+    	sprintf(buf, "DA  %6lu", birthdate - today);
     } else {
-    	sprintf(buf, "DA  %6lu", julian_date - julian_birthdate);
+    	sprintf(buf, "DA  %6lu", today - birthdate);
     }
     watch_display_string(buf, 0);
 }
@@ -49,7 +45,7 @@ void day_one_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(day_one_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(day_one_state_t));
         memset(*context_ptr, 0, sizeof(day_one_state_t));
         movement_birthdate_t movement_birthdate = (movement_birthdate_t) watch_get_backup_data(2);
         if (movement_birthdate.reg == 0) {
@@ -23,6 +23,7 @@
  */
 
 #include "habit_face.h"
+#include "filesystem.h"
 #include "watch_private_display.h"
 #include "watch_rtc.h"
 #include "watch_slcd.h"
@@ -46,19 +47,36 @@ typedef struct {
   uint8_t lookback;
   uint32_t last_update;
   bool display_total;
+  bool dirty; // the streak has changed since it was last persisted to the filesystem
 } habit_state_t;
 
+static void habit_flush(habit_state_t *state) {
+  // write-behind: marking the habit done only touches RAM, and the streak is persisted
+  // here on the way out instead of paying littlefs copy-on-write cost per press.
+  if (!state->dirty)
+    return;
+  filesystem_write_file("habit.ini", (char *)state, sizeof(habit_state_t));
+  state->dirty = false;
+}
+
 void habit_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
                       void **context_ptr) {
   (void)settings;
   (void)watch_face_index;
   if (*context_ptr == NULL) {
-    *context_ptr = malloc(sizeof(habit_state_t));
+    *context_ptr = movement_face_context_alloc(sizeof(habit_state_t));
     memset(*context_ptr, 0, sizeof(habit_state_t));
     habit_state_t *state = (habit_state_t *)*context_ptr;
-    state->lookback = 0;
-    state->last_update = watch_utility_offset_timestamp(
-        today_unix(settings->bit.time_zone), -24, 0, 0);
+    if (filesystem_get_file_size("habit.ini") == sizeof(habit_state_t)) {
+      // restore the streak persisted by a previous run
+      filesystem_read_file("habit.ini", (char *)state, sizeof(habit_state_t));
+      state->display_total = false;
+      state->dirty = false;
+    } else {
+      state->lookback = 0;
+      state->last_update = watch_utility_offset_timestamp(
+          today_unix(settings->bit.time_zone), -24, 0, 0);
+    }
   }
 }
 
@@ -124,6 +142,7 @@ bool habit_face_loop(movement_event_t event, movement_settings_t *settings,
         num_shifts = 7;
       state->lookback <<= num_shifts;
       state->last_update = today_now_unix;
+      state->dirty = true;
     }
     break;
   }
@@ -137,6 +156,7 @@ bool habit_face_loop(movement_event_t event, movement_settings_t *settings,
       state->lookback |= 1;
       state->total_count++;
       state->last_update = today_now_unix;
+      state->dirty = true;
       display_state(state);
     };
     break;
@@ -153,5 +173,5 @@ bool habit_face_loop(movement_event_t event, movement_settings_t *settings,
 
 void habit_face_resign(movement_settings_t *settings, void *context) {
   (void)settings;
-  (void)context;
+  habit_flush((habit_state_t *)context);
 }
@@ -48,6 +48,12 @@
 
     - To completely abort a running timer, press and hold the alarm button.
 
+    - While a timer is running, phase transitions are driven by scheduled RTC
+      alarms and the watch sleeps in between: the display shows the phase that
+      just began together with its full length. A short press of the light
+      button toggles a live per-second countdown instead (at the cost of
+      waking the CPU once a second for the rest of the session).
+
     - Press and hold the light button to enter settings mode for each interval
       timer slot.
 
@@ -145,9 +151,19 @@ static inline void _inc_uint8(uint8_t *value, uint8_t step, uint8_t max) {
 }
 
 static uint32_t _get_now_ts() {
-    // returns the current date time as unix timestamp
+    // returns the current date time as unix timestamp. The full calendar conversion is
+    // cached per calendar day; the per-tick calls while a timer runs resolve through
+    // watch_date_time_seconds_between's same-day register arithmetic.
+    static uint32_t _midnight_reg;
+    static uint32_t _midnight_ts;
     watch_date_time now = watch_rtc_get_date_time();
-    return watch_utility_date_time_to_unix_time(now, 0);
+    watch_date_time midnight = now;
+    midnight.reg &= ~(uint32_t)0x1FFFF;  // clear the time-of-day bits
+    if (midnight.reg != _midnight_reg) {
+        _midnight_reg = midnight.reg;
+        _midnight_ts = watch_utility_date_time_to_unix_time(midnight, 0);
+    }
+    return _midnight_ts + (uint32_t)watch_date_time_seconds_between(midnight, now);
 }
 
 static inline void _button_beep(movement_settings_t *settings) {
@@ -398,6 +414,12 @@ static inline bool _is_timer_empty(interval_timer_setting_t *timer) {
         + timer->cooldown_minutes + timer->cooldown_seconds == 0);
 }
 
+static void _request_run_tick(interval_face_state_t *state) {
+    // while a timer runs, phase transitions come from the scheduled background task; the
+    // 1 Hz tick is only needed if the wearer wants to watch the seconds count down.
+    movement_request_tick_frequency(state->show_countdown ? 1 : 0);
+}
+
 static void _init_timer_info(interval_face_state_t *state) {
     state->face_state = interval_state_waiting;
     _ticks = 0;
@@ -419,6 +441,7 @@ static void _resume_paused_timer(interval_face_state_t *state) {
     watch_date_time target_dt = watch_utility_date_time_from_unix_time(_target_ts, 0);
     movement_schedule_background_task_for_face(state->face_idx, target_dt);
     state->face_state = interval_state_running;
+    _request_run_tick(state);
     watch_set_indicator(WATCH_INDICATOR_BELL);
 }
 
@@ -426,7 +449,7 @@ void interval_face_setup(movement_settings_t *settings, uint8_t watch_face_index
     (void) settings;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(interval_face_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(interval_face_state_t));
         interval_face_state_t *state = (interval_face_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(interval_face_state_t));
         state->face_idx = watch_face_index;
@@ -457,7 +480,13 @@ void interval_face_activate(movement_settings_t *settings, void *context) {
         state->face_state = interval_state_intro;
         _ticks = 0;
         movement_request_tick_frequency(8);
-    } else watch_set_colon();
+    } else {
+        watch_set_colon();
+        // a running timer without the countdown has nothing to redraw until the next
+        // phase boundary, so drop the default 1 Hz tick again (pausing keeps it for
+        // the blinking bell).
+        if (state->face_state == interval_state_running) _request_run_tick(state);
+    }
 }
 
 void interval_face_resign(movement_settings_t *settings, void *context) {
@@ -505,6 +534,9 @@ bool interval_face_loop(movement_event_t event, movement_settings_t *settings, v
         break;
     case EVENT_ACTIVATE:
         watch_display_string(INTERVAL_FACE_STATE_DEFAULT, 0);
+        // with the countdown off there is no tick to refresh _now_ts, so take a fresh
+        // timestamp here to show the correct remaining time for the current phase.
+        if (state->face_state >= interval_state_running) _now_ts = _get_now_ts();
         if (state->face_state) _face_draw(state, event.subsecond);
         break;
     case EVENT_LIGHT_BUTTON_UP:
@@ -528,8 +560,14 @@ bool interval_face_loop(movement_event_t event, movement_settings_t *settings, v
             if (_setting_idx == interval_setting_max) {
                 // we have done a full settings circle: resume setting
                 _resume_setting(state, event.subsecond);
-            } else 
+            } else
                 _face_draw(state, event.subsecond);
+        } else if (state->face_state >= interval_state_running) {
+            // toggle the optional per-second countdown for the running timer
+            state->show_countdown = !state->show_countdown;
+            if (state->face_state == interval_state_running) _request_run_tick(state);
+            _now_ts = _get_now_ts();
+            _face_draw(state, event.subsecond);
         } else {
             movement_illuminate_led();
         }
@@ -562,6 +600,8 @@ bool interval_face_loop(movement_event_t event, movement_settings_t *settings, v
             _paused_ts = _get_now_ts();
             state->face_state = interval_state_pausing;
             movement_cancel_background_task();
+            // tick at 1 Hz while paused so the bell indicator blinks
+            movement_request_tick_frequency(1);
             _face_draw(state, event.subsecond);
             break;
         case interval_state_pausing:
@@ -593,7 +633,7 @@ bool interval_face_loop(movement_event_t event, movement_settings_t *settings, v
                 else if (timer->work_minutes + timer->work_seconds) _timer_run_state = 1;
                 else if (timer->break_minutes + timer->break_seconds) _timer_run_state = 2;
                 else if (timer->cooldown_minutes + timer->cooldown_seconds) _timer_run_state = 3;
-                movement_request_tick_frequency(1);
+                _request_run_tick(state);
                 _now_ts = _get_now_ts();
                 _target_ts = _now_ts;
                 _set_next_timestamp(state);
@@ -656,6 +696,10 @@ bool interval_face_loop(movement_event_t event, movement_settings_t *settings, v
         if (_timer_run_state < 4) {
             // transition to next timer phase
             _set_next_timestamp(state);
+            // with the countdown off, a phase boundary is the only moment the display
+            // changes, so redraw the new phase right away (a no-op in the background).
+            _now_ts = _get_now_ts();
+            _face_draw(state, event.subsecond);
         } else {
             // timer has finished
             state->face_state = interval_state_waiting;
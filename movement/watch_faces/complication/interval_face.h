@@ -58,6 +58,9 @@ typedef enum {
 
 typedef struct {
     bool is_active;
+    // when set, a running timer redraws a per-second countdown on the 1 Hz tick; when
+    // clear, the CPU sleeps between phase boundaries and the display only changes per phase.
+    bool show_countdown;
     uint8_t face_idx;
     uint8_t timer_idx;
     uint8_t timer_running_idx;
@@ -30,22 +30,35 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
-#include <math.h>
 #include "moon_phase_face.h"
 #include "watch_utility.h"
 
-#define LUNAR_DAYS 29.53058770576
-#define LUNAR_SECONDS (LUNAR_DAYS * (24 * 60 * 60))
+// one synodic month (29.53058770576 days) in microseconds. everything below tracks the
+// position within the cycle as integer microseconds, so no floating point is involved.
+#define LUNAR_CYCLE_US 2551442777778ull
 #define FIRST_MOON 947182440 // Saturday, 6 January 2000 18:14:00 in unix epoch time
 #define NUM_PHASES 8
 
-static const float phase_changes[] = {0, 1, 6.38264692644, 8.38264692644, 13.76529385288, 15.76529385288, 21.14794077932, 23.14794077932, 28.53058770576, 29.53058770576};
+// the phase_changes day boundaries (0, 1, 6.38264692644, ... 29.53058770576 days),
+// converted to microseconds within the cycle.
+static const uint64_t phase_changes_us[] = {
+    0ull,
+    86400000000ull,
+    551460694444ull,
+    724260694444ull,
+    1189321388888ull,
+    1362121388888ull,
+    1827182083333ull,
+    1999982083333ull,
+    2465042777777ull,
+    LUNAR_CYCLE_US,
+};
 
 void moon_phase_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(moon_phase_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(moon_phase_state_t));
         memset(*context_ptr, 0, sizeof(moon_phase_state_t));
     }
 }
@@ -56,19 +69,39 @@ void moon_phase_face_activate(movement_settings_t *settings, void *context) {
 }
 
 static void _update(movement_settings_t *settings, moon_phase_state_t *state, uint32_t offset) {
-    (void)state;
     char buf[11];
     watch_date_time date_time = watch_rtc_get_date_time();
-    uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60) + offset;
-    date_time = watch_utility_date_time_from_unix_time(now, movement_timezone_offsets[settings->bit.time_zone] * 60);
-    double currentfrac = fmod(now - FIRST_MOON, LUNAR_SECONDS) / LUNAR_SECONDS;
-    double currentday = currentfrac * LUNAR_DAYS;
-    uint8_t phase_index = 0;
+    uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offset(settings->bit.time_zone)) + offset;
+    date_time = watch_utility_date_time_from_unix_time(now, movement_timezone_offset(settings->bit.time_zone));
 
-    for(phase_index = 0; phase_index <= NUM_PHASES; phase_index++) {
-        if (currentday > phase_changes[phase_index] && currentday <= phase_changes[phase_index + 1]) break;
+    if (state->phase_hour != now / 3600) {
+        // the phase advances deterministically, so rather than reducing the full
+        // seconds-since-FIRST_MOON modulo the cycle every time, carry an accumulator:
+        // the position within the cycle at some anchor second, advanced by the time
+        // elapsed since. the advance is exact integer math, and because the anchor is
+        // refreshed on every recomputation, the wraparound below runs at most once an
+        // update. the full reduction only happens to seed a fresh (or time-warped) state.
+        if (state->phase_anchor_time == 0 || now < state->phase_anchor_time) {
+            state->phase_anchor_us = ((uint64_t)(now - FIRST_MOON) * 1000000ull) % LUNAR_CYCLE_US;
+            state->phase_anchor_time = now;
+        }
+        uint64_t position_us = state->phase_anchor_us + (uint64_t)(now - state->phase_anchor_time) * 1000000ull;
+        while (position_us >= LUNAR_CYCLE_US) position_us -= LUNAR_CYCLE_US;
+        state->phase_anchor_time = now;
+        state->phase_anchor_us = position_us;
+
+        uint8_t phase_index;
+        for(phase_index = 0; phase_index <= NUM_PHASES; phase_index++) {
+            if (position_us > phase_changes_us[phase_index] && position_us <= phase_changes_us[phase_index + 1]) break;
+        }
+
+        state->phase_hour = now / 3600;
+        state->phase_index = phase_index;
     }
 
+    uint64_t position_us = state->phase_anchor_us;
+    uint8_t phase_index = state->phase_index;
+
     watch_display_string(" ", 0);
     switch (phase_index) {
         case 0:
@@ -79,7 +112,7 @@ static void _update(movement_settings_t *settings, moon_phase_state_t *state, ui
             sprintf(buf, "%2dCresnt", date_time.unit.day);
             watch_set_pixel(2, 13);
             watch_set_pixel(2, 15);
-            if (currentfrac > 0.125) watch_set_pixel(1, 13);
+            if (position_us > LUNAR_CYCLE_US / 8) watch_set_pixel(1, 13);
             break;
         case 2:
             sprintf(buf, "%2d 1st q", date_time.unit.day);
@@ -126,7 +159,7 @@ static void _update(movement_settings_t *settings, moon_phase_state_t *state, ui
             sprintf(buf, "%2dCresnt", date_time.unit.day);
             watch_set_pixel(0, 14);
             watch_set_pixel(0, 13);
-            if (currentfrac < 0.875) watch_set_pixel(2, 14);
+            if (position_us < LUNAR_CYCLE_US - LUNAR_CYCLE_US / 8) watch_set_pixel(2, 14);
             break;
     }
     watch_display_string(buf, 2);
@@ -142,13 +175,13 @@ bool moon_phase_face_loop(movement_event_t event, movement_settings_t *settings,
             break;
         case EVENT_TICK:
             // only update once an hour
-            date_time = watch_rtc_get_date_time();
+            date_time = event.date_time;
             if ((date_time.unit.minute == 0) && (date_time.unit.second == 0)) _update(settings, state, state->offset);
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             // update at the top of the hour OR if we're entering sleep mode with an offset.
             // also, in sleep mode, always show the current moon phase (offset = 0).
-            if (state->offset || (watch_rtc_get_date_time().unit.minute == 0)) _update(settings, state, 0);
+            if (state->offset || (event.date_time.unit.minute == 0)) _update(settings, state, 0);
             // and kill the offset so when the wearer wakes up, it matches what's on screen.
             state->offset = 0;
             // finally: clear out the last two digits and replace them with the sleep mode indicator
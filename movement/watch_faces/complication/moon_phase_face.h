@@ -29,6 +29,15 @@
 
 typedef struct {
     uint32_t offset;
+    // cached phase, keyed on the hour it was computed for: the phase moves
+    // slowly enough that repeated views within an hour (and the hourly tick
+    // update itself) can skip recomputing entirely.
+    uint32_t phase_hour;
+    uint8_t phase_index;
+    // synodic accumulator: the position within the lunar cycle (integer
+    // microseconds) at the anchor second, advanced incrementally from there.
+    uint32_t phase_anchor_time;
+    uint64_t phase_anchor_us;
 } moon_phase_state_t;
 
 void moon_phase_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -42,6 +51,8 @@ void moon_phase_face_resign(movement_settings_t *settings, void *context);
     moon_phase_face_loop, \
     moon_phase_face_resign, \
     NULL, \
+    NULL, \
+    .cpu_boost_on_activate = true, \
 })
 
 #endif // MOON_PHASE_FACE_H_
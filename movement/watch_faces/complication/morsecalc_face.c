@@ -197,7 +197,7 @@ void morsecalc_print_token(morsecalc_state_t *mcs) {
     watch_display_string("          ", 0); // Clear display
 
     // Print morse code buffer
-    char c = mc_dec(mcs->mc->b); // Decode the morse code buffer's current contents
+    char c = mc_dec(mcs->mc); // Decode the morse code buffer's current contents
     if('\0' == c) c = ' '; // Needed for watch_display_character
     watch_display_character(c, 0); // Display current morse code char in mode position
     watch_display_character('0'+(mcs->mc->bidx), 3); // Display buffer position in top right
@@ -220,7 +220,7 @@ void morsecalc_reset_token(morsecalc_state_t *mcs) {
 void morsecalc_print_stack(morsecalc_state_t * mcs) {
     watch_display_string("          ", 0); // Clear display
 
-    char c = mc_dec(mcs->mc->b); 
+    char c = mc_dec(mcs->mc); 
     if('m' == c) { // Display memory 
         morsecalc_print_float(mcs->cs->mem);
         watch_display_character(c, 0);
@@ -248,7 +248,7 @@ void morsecalc_input(morsecalc_state_t * mcs, char c) {
         morsecalc_print_token(mcs);
     } 
     else { // Morse code character finished
-        char dec = mc_dec(mcs->mc->b); 
+        char dec = mc_dec(mcs->mc); 
         mc_reset(mcs->mc);
         switch(dec) {
             case '\0': // Invalid character, do nothing
@@ -302,14 +302,14 @@ void morsecalc_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(morsecalc_state_t)); 
+        *context_ptr = movement_face_context_alloc(sizeof(morsecalc_state_t)); 
         morsecalc_state_t *mcs = (morsecalc_state_t *)*context_ptr;
         morsecalc_reset_token(mcs); 
         
-        mcs->cs = (calc_state_t *) malloc(sizeof(calc_state_t));
+        mcs->cs = (calc_state_t *) movement_face_context_alloc(sizeof(calc_state_t));
         calc_init(mcs->cs); 
         
-        mcs->mc = (mc_state_t *) malloc(sizeof(mc_state_t));
+        mcs->mc = (mc_state_t *) movement_face_context_alloc(sizeof(mc_state_t));
         mc_reset(mcs->mc);
 
         mcs->led_is_on = 0;
@@ -55,6 +55,7 @@ void morsecalc_input(morsecalc_state_t *mcs, char c);
     morsecalc_face_loop, \
     morsecalc_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // MORSECALC_FACE_H_
@@ -29,8 +29,6 @@
 #include "orrery_face.h"
 #include "watch.h"
 #include "watch_utility.h"
-#include "vsop87a_micro.h" // smaller size, less accurate
-#include "vsop87a_milli.h"
 #include "astrolib.h"
 
 #define NUM_AVAILABLE_BODIES 9
@@ -47,52 +45,35 @@ static const char orrery_celestial_body_names[NUM_AVAILABLE_BODIES][3] = {
     "NE"    // Neptune
 };
 
+static const astro_body_t orrery_celestial_bodies[NUM_AVAILABLE_BODIES] = {
+    ASTRO_BODY_MERCURY,
+    ASTRO_BODY_VENUS,
+    ASTRO_BODY_EARTH,
+    ASTRO_BODY_MOON,
+    ASTRO_BODY_MARS,
+    ASTRO_BODY_JUPITER,
+    ASTRO_BODY_SATURN,
+    ASTRO_BODY_URANUS,
+    ASTRO_BODY_NEPTUNE
+};
+
 static void _orrery_face_recalculate(movement_settings_t *settings, orrery_state_t *state) {
     watch_date_time date_time = watch_rtc_get_date_time();
-    uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offset(settings->bit.time_zone));
     date_time = watch_utility_date_time_from_unix_time(timestamp, 0);
-    double jd = astro_convert_date_to_julian_date(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
+    // rata die + 1721424.5 is the Julian day at midnight; add the time of day as a
+    // fraction. Integer calendar math instead of astrolib's chain of double floors.
+    double jd = watch_utility_rata_die(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day) + 1721424.5
+        + (date_time.unit.hour * 3600 + date_time.unit.minute * 60 + date_time.unit.second) / 86400.0;
     double et = astro_convert_jd_to_julian_millenia_since_j2000(jd);
-    double r[3] = {0};
 
-    switch(state->active_body_index) {
-        case 0:
-            vsop87a_milli_getMercury(et, r);
-            break;
-        case 1:
-            vsop87a_milli_getVenus(et, r);
-            break;
-        case 2:
-            vsop87a_milli_getEarth(et, r);
-            break;
-        case 3:
-            {
-                 double earth[3];
-                 double emb[3];
-                 vsop87a_milli_getEarth(et, earth);
-                 vsop87a_milli_getEmb(et, emb);
-                 vsop87a_milli_getMoon(earth, emb, r);
-             }
-            break;
-        case 4:
-            vsop87a_milli_getMars(et, r);
-            break;
-        case 5:
-            vsop87a_milli_getJupiter(et, r);
-            break;
-        case 6:
-            vsop87a_milli_getSaturn(et, r);
-            break;
-        case 7:
-            vsop87a_milli_getUranus(et, r);
-            break;
-        case 8:
-            vsop87a_milli_getNeptune(et, r);
-            break;
-    }
-    state->coords[0] = r[0];
-    state->coords[1] = r[1];
-    state->coords[2] = r[2];
+    // the astronomy face computes positions for the same bodies through the same
+    // cache, so flipping between the two faces (or returning to a recently viewed
+    // body) within the hour serves from it instead of rerunning the series.
+    astro_cartesian_coordinates_t coords = astro_get_body_coordinates(orrery_celestial_bodies[state->active_body_index], et);
+    state->coords[0] = coords.x;
+    state->coords[1] = coords.y;
+    state->coords[2] = coords.z;
 }
 
 static void _orrery_face_update(movement_event_t event, movement_settings_t *settings, orrery_state_t *state) {
@@ -154,7 +135,7 @@ void orrery_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(orrery_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(orrery_state_t));
         memset(*context_ptr, 0, sizeof(orrery_state_t));
     }
 }
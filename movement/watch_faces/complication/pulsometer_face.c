@@ -27,13 +27,22 @@
 #include "pulsometer_face.h"
 #include "watch.h"
 
-#define PULSOMETER_FACE_FREQUENCY_FACTOR (4ul) // refresh rate will be 2 to this power Hz (0 for 1 Hz, 2 for 4 Hz, etc.)
-#define PULSOMETER_FACE_FREQUENCY (1 << PULSOMETER_FACE_FREQUENCY_FACTOR)
+// display refresh rate while measuring. the measurement itself runs on a 128 Hz timer channel,
+// so this only determines how often the settling number repaints, not the timing resolution.
+#define PULSOMETER_FACE_FREQUENCY (2)
+
+static int8_t _timer_channel = -1;
+
+// 30 beats at 128 ticks per second: bpm = 30 * 60 * 128 / elapsed ticks, rounded.
+static inline int16_t _pulsometer_bpm(uint32_t timer_ticks) {
+    return (int16_t)((30ul * 60 * WATCH_FAST_TIMER_HZ + timer_ticks / 2) / timer_ticks);
+}
 
 void pulsometer_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(pulsometer_state_t));
+    if (*context_ptr == NULL) *context_ptr = movement_face_context_alloc(sizeof(pulsometer_state_t));
+    if (_timer_channel < 0) _timer_channel = watch_fast_timer_claim();
 }
 
 void pulsometer_face_activate(movement_settings_t *settings, void *context) {
@@ -50,10 +59,17 @@ bool pulsometer_face_loop(movement_event_t event, movement_settings_t *settings,
             pulsometer_state->measuring = true;
             pulsometer_state->pulse = 0xFFFF;
             pulsometer_state->ticks = 0;
+            watch_fast_timer_reset(_timer_channel);
+            watch_fast_timer_start(_timer_channel);
             movement_request_tick_frequency(PULSOMETER_FACE_FREQUENCY);
             break;
         case EVENT_ALARM_BUTTON_UP:
         case EVENT_ALARM_LONG_UP:
+            if (pulsometer_state->measuring) {
+                uint32_t timer_ticks = watch_fast_timer_get_ticks(_timer_channel);
+                watch_fast_timer_stop(_timer_channel);
+                if (timer_ticks) pulsometer_state->pulse = _pulsometer_bpm(timer_ticks);
+            }
             pulsometer_state->measuring = false;
             movement_request_tick_frequency(1);
             break;
@@ -78,8 +94,9 @@ bool pulsometer_face_loop(movement_event_t event, movement_settings_t *settings,
                 }
                 pulsometer_state->ticks = (pulsometer_state->ticks + 1) % 5;
             } else {
-                if (pulsometer_state->measuring && pulsometer_state->ticks) {
-                    pulsometer_state->pulse = (int16_t)((30.0 * ((float)(60 << PULSOMETER_FACE_FREQUENCY_FACTOR) / (float)pulsometer_state->ticks)) + 0.5);
+                if (pulsometer_state->measuring) {
+                    uint32_t timer_ticks = watch_fast_timer_get_ticks(_timer_channel);
+                    if (timer_ticks) pulsometer_state->pulse = _pulsometer_bpm(timer_ticks);
                 }
                 if (pulsometer_state->pulse > 240) {
                     watch_display_string("        Hi", 0);
@@ -89,7 +106,6 @@ bool pulsometer_face_loop(movement_event_t event, movement_settings_t *settings,
                     sprintf(buf, "    %-3dbpn", pulsometer_state->pulse);
                     watch_display_string(buf, 0);
                 }
-                if (pulsometer_state->measuring) pulsometer_state->ticks++;
             }
             break;
         case EVENT_TIMEOUT:
@@ -106,4 +122,6 @@ bool pulsometer_face_loop(movement_event_t event, movement_settings_t *settings,
 void pulsometer_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
+    // don't leave the timer channel counting if we resign mid-measurement.
+    watch_fast_timer_stop(_timer_channel);
 }
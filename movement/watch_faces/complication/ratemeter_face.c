@@ -26,14 +26,29 @@
 #include <string.h>
 #include "ratemeter_face.h"
 #include "watch.h"
+#include "watch_utility.h"
 
-#define RATEMETER_FACE_FREQUENCY_FACTOR (4ul) // refresh rate will be 2 to this power Hz (0 for 1 Hz, 2 for 4 Hz, etc.)
-#define RATEMETER_FACE_FREQUENCY (1 << RATEMETER_FACE_FREQUENCY_FACTOR)
+static int8_t _timer_channel = -1;
+
+static void _ratemeter_draw(ratemeter_state_t *ratemeter_state) {
+    char buf[14];
+    if (ratemeter_state->rate == 0) {
+        watch_display_string("ra          ", 0);
+    } else if (ratemeter_state->rate > 500) {
+        watch_display_string("ra      Hi", 0);
+    } else if (ratemeter_state->rate < 1) {
+        watch_display_string("ra      Lo", 0);
+    } else {
+        sprintf(buf, "ra  %-3d pn", ratemeter_state->rate);
+        watch_display_string(buf, 0);
+    }
+}
 
 void ratemeter_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(ratemeter_state_t));
+    if (*context_ptr == NULL) *context_ptr = movement_face_context_alloc(sizeof(ratemeter_state_t));
+    if (_timer_channel < 0) _timer_channel = watch_fast_timer_claim();
 }
 
 void ratemeter_face_activate(movement_settings_t *settings, void *context) {
@@ -44,36 +59,27 @@ void ratemeter_face_activate(movement_settings_t *settings, void *context) {
 bool ratemeter_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     (void) settings;
     ratemeter_state_t *ratemeter_state = (ratemeter_state_t *)context;
-    char buf[14];
     switch (event.event_type) {
         case EVENT_ACTIVATE:
             watch_display_string("ra          ", 0);
             break;
-        case EVENT_ALARM_BUTTON_DOWN:
-            if (ratemeter_state->ticks != 0) {
-                ratemeter_state->rate = (int16_t)(60.0 / ((float)ratemeter_state->ticks / (float)RATEMETER_FACE_FREQUENCY));
+        case EVENT_ALARM_BUTTON_DOWN: {
+            // rate = 60 seconds at 128 ticks each over the interval since the last press.
+            uint32_t timer_ticks = watch_fast_timer_get_ticks(_timer_channel);
+            if (timer_ticks != 0) {
+                ratemeter_state->rate = (int16_t)watch_utility_fast_divide(60 * WATCH_FAST_TIMER_HZ, timer_ticks);
             }
-            ratemeter_state->ticks = 0;
-            movement_request_tick_frequency(RATEMETER_FACE_FREQUENCY);
+            watch_fast_timer_reset(_timer_channel);
+            watch_fast_timer_start(_timer_channel);
+            _ratemeter_draw(ratemeter_state);
             break;
+        }
         case EVENT_ALARM_BUTTON_UP:
             break;
         case EVENT_ALARM_LONG_PRESS:
             break;
         case EVENT_TICK:
-            if (ratemeter_state->rate == 0) {
-                watch_display_string("ra          ", 0);
-            } else {
-                if (ratemeter_state->rate > 500) {
-                    watch_display_string("ra      Hi", 0);
-                } else if (ratemeter_state->rate < 1) {
-                    watch_display_string("ra      Lo", 0);
-                } else {
-                    sprintf(buf, "ra  %-3d pn", ratemeter_state->rate);
-                    watch_display_string(buf, 0);
-                }
-            }
-            ratemeter_state->ticks++;
+            _ratemeter_draw(ratemeter_state);
             break;
         case EVENT_TIMEOUT:
             movement_move_to_face(0);
@@ -89,4 +95,6 @@ bool ratemeter_face_loop(movement_event_t event, movement_settings_t *settings,
 void ratemeter_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
+    // stop timing when we leave the face; a fresh press starts a fresh interval.
+    watch_fast_timer_stop(_timer_channel);
 }
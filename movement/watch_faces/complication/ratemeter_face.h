@@ -29,7 +29,6 @@
 
 typedef struct {
     int16_t rate;
-    int16_t ticks;
 } ratemeter_state_t;
 
 void ratemeter_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -43,6 +42,7 @@ void ratemeter_face_resign(movement_settings_t *settings, void *context);
     ratemeter_face_loop, \
     ratemeter_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // RATEMETER_FACE_H_
@@ -68,7 +68,7 @@ void rpn_calculator_alt_face_setup(movement_settings_t *settings, uint8_t watch_
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(calculator_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(calculator_state_t));
         memset(*context_ptr, 0, sizeof(calculator_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -24,116 +24,57 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "rpn_calculator_face.h"
 
-static void draw_number(char *buf, float num) {
-    float f = fmodf(num, 1.0) * 100;
-    sprintf(buf, "CA  %4d%02d", ((int)num) % 10000, (int) f);
+// extract the six display digits from the scaled value; no sprintf, no softfloat.
+static void draw_number(char *buf, int64_t num) {
+    for (int i = 0; i < 6; i++) {
+        buf[4 + i] = '0' + fixed_rpn_digit(num, i);
+    }
+    // blank leading zeros in the integer part, matching the old %4d padding.
+    for (int i = 0; i < 3 && buf[4 + i] == '0'; i++) buf[4 + i] = ' ';
 }
 
 static void draw_op(char *buf, rpn_calculator_op_t op) {
     switch (op) {
         case rpn_calculator_op_add:
-            sprintf(buf, "CA     Add");
+            memcpy(buf, "CA     Add", 10);
         break;
         case rpn_calculator_op_sub:
-            sprintf(buf, "CA     sub");
+            memcpy(buf, "CA     sub", 10);
         break;
         case rpn_calculator_op_mul:
-            sprintf(buf, "CA    n&ul");
+            memcpy(buf, "CA    n&ul", 10);
         break;
         case rpn_calculator_op_div:
-            sprintf(buf, "CA     div");
+            memcpy(buf, "CA     div", 10);
         break;
         case rpn_calculator_op_pow:
-            sprintf(buf, "CA     pow");
+            memcpy(buf, "CA     pow", 10);
         break;
         case rpn_calculator_op_sqrt:
-            sprintf(buf, "CA    sqrt");
+            memcpy(buf, "CA    sqrt", 10);
         break;
         case rpn_calculator_op_pi:
-            sprintf(buf, "CA      pi");
+            memcpy(buf, "CA      pi", 10);
             break;
         default:
             break;
     }
 }
 
-static void printf_stack(rpn_calculator_state_t *state) {
-    printf("Stack: [%f, %f, %f, %f], top: %d\n",
-        state->stack[0],
-        state->stack[1],
-        state->stack[2],
-        state->stack[3],
-        state->top
-    );
-}
-
 static void next_op(rpn_calculator_state_t *state) {
     state->op += 1;
     state->op = state->op % RPN_CALCULATOR_MAX_OPS;
 }
 
-// increase a digit of a floating point number
-// FIXME: this converts the number to string and back, there might
-// be better ways to do this
-static float inc_digit(float num, uint8_t position) {
-    char buf[8];
-    if (position > 5) {
-        return 0.0;
-    }
-    // inverse position (rtl)
-    position = 5 - position;
-    float f = fmodf(num, 1.0) * 100;
-    sprintf(buf, "%04d%02d", ((int)num) % 10000, (int) f);
-    uint8_t digit = buf[position] - '0';
-    digit = (digit + 1) % 10;
-    buf[position] = digit + '0';
-    printf("buf: %s\n", buf);
-    return strtof(buf, NULL) / 100.0;
-}
-
-static void stack_push(rpn_calculator_state_t *state, float f) {
-    printf_stack(state);
-    printf("push: %f\n", f);
-    state->top++;
-    if (state->top >= RPN_CALCULATOR_STACK_SIZE) {
-        // FIXME: implement this using a circular buffer?
-        for (int i=0; i<RPN_CALCULATOR_STACK_SIZE-1; i++) {
-            state->stack[i] = state->stack[i+1];
-        }
-    }
-    state->stack[state->top] = f;
-}
-
-static float stack_peek(rpn_calculator_state_t *state) {
-    if (state->top > -1) {
-        return state->stack[state->top];
-    }
-    return 0;
-}
-
-static float stack_pop(rpn_calculator_state_t *state) {
-    printf_stack(state);
-    float f = stack_peek(state);
-    state->stack[state->top] = 0;
-    printf("pop: %f\n", f);
-    if (state->top > -1) {
-        state->top--;
-    } else {
-        state->top = -1; // empty
-    }
-    return f;
-}
-
 static void run_op(rpn_calculator_state_t *state) {
-    printf_stack(state);
     bool op_found = false;
+    int64_t result;
     // ops without parameters
     switch (state->op)  {
         case rpn_calculator_op_pi:
-            stack_push(state, M_PI);
+            fixed_rpn_push(&state->stack, FIXED_RPN_PI);
             op_found = true;
             break;
         default:
@@ -145,15 +86,14 @@ static void run_op(rpn_calculator_state_t *state) {
     }
 
     // ops with one parameter
-    if (state->top < 0) {
+    if (state->stack.top < 0) {
         state->mode = rpn_calculator_err;
         return;
     }
-    float right = stack_pop(state);
-    printf("right: %f\n", right);
+    int64_t right = fixed_rpn_pop(&state->stack);
     switch (state->op)  {
         case rpn_calculator_op_sqrt:
-            stack_push(state, sqrt(right));
+            fixed_rpn_push(&state->stack, fixed_rpn_sqrt(right));
             op_found = true;
             break;
         default:
@@ -165,32 +105,35 @@ static void run_op(rpn_calculator_state_t *state) {
     }
 
     // ops with two parameters
-    if (state->top < 0) {
+    if (state->stack.top < 0) {
         // no parameter left -> error
         state->mode = rpn_calculator_err;
         return;
     }
-    float left = stack_pop(state);
-    printf("left: %f\n", left);
+    int64_t left = fixed_rpn_pop(&state->stack);
     switch (state->op)  {
         case rpn_calculator_op_add:
-            stack_push(state, left + right);
+            fixed_rpn_push(&state->stack, left + right);
             op_found = true;
             break;
         case rpn_calculator_op_sub:
-            stack_push(state, left - right);
+            fixed_rpn_push(&state->stack, left - right);
             op_found = true;
             break;
         case rpn_calculator_op_mul:
-            stack_push(state, left * right);
+            fixed_rpn_push(&state->stack, fixed_rpn_mul(left, right));
             op_found = true;
             break;
         case rpn_calculator_op_div:
-            stack_push(state, left / right);
+            // division by zero is an error, not an infinity we can't display.
+            if (right == 0) break;
+            fixed_rpn_push(&state->stack, fixed_rpn_div(left, right));
             op_found = true;
             break;
         case rpn_calculator_op_pow:
-            stack_push(state, powf(left, right));
+            // only whole-number exponents exist in fixed point.
+            if (!fixed_rpn_pow(left, right, &result)) break;
+            fixed_rpn_push(&state->stack, result);
             op_found = true;
             break;
         default:
@@ -204,13 +147,16 @@ static void run_op(rpn_calculator_state_t *state) {
 }
 
 static void draw(rpn_calculator_state_t *state, uint8_t subsecond) {
-    char buf[16];
+    // format into movement's scratch line; the flush below diffs against what is
+    // already on the glass, so a keystroke that changes one digit writes one digit.
+    char *buf = movement_get_display_buffer();
+    memcpy(buf, "CA        ", 10);
     switch (state->mode) {
         case rpn_calculator_err:
-            sprintf(buf, "CA   err  ");
+            memcpy(buf, "CA   err  ", 10);
             break;
         case rpn_calculator_number:
-            draw_number(buf, stack_peek(state));
+            draw_number(buf, fixed_rpn_peek(&state->stack));
             uint8_t i = 4 + (5 - state->selection);
             if (buf[i] == ' ') {
                 buf[i] = '0';
@@ -220,8 +166,7 @@ static void draw(rpn_calculator_state_t *state, uint8_t subsecond) {
             }
             break;
         case rpn_calculator_waiting:
-            printf_stack(state);
-            draw_number(buf, stack_peek(state));
+            draw_number(buf, fixed_rpn_peek(&state->stack));
             break;
         case rpn_calculator_op:
             draw_op(buf, state->op);
@@ -229,18 +174,18 @@ static void draw(rpn_calculator_state_t *state, uint8_t subsecond) {
         default:
             break;
     }
-    watch_display_string(buf, 0);
+    movement_flush_display_buffer();
 }
 
 void rpn_calculator_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(rpn_calculator_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(rpn_calculator_state_t));
         memset(*context_ptr, 0, sizeof(rpn_calculator_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
         rpn_calculator_state_t *state = *context_ptr;
-        state->top = -1;
+        fixed_rpn_init(&state->stack, state->stack_storage, RPN_CALCULATOR_STACK_SIZE);
     }
     // Do any pin or peripheral setup here; this will be called whenever the watch wakes from deep sleep.
 }
@@ -304,13 +249,13 @@ bool rpn_calculator_face_loop(movement_event_t event, movement_settings_t *setti
                 case rpn_calculator_waiting:
                     state->mode = rpn_calculator_number;
                     state->selection = 2;
-                    stack_push(state, 0);
+                    fixed_rpn_push(&state->stack, 0);
                     draw(state, event.subsecond);
                     movement_request_tick_frequency(4);
                     break;
                 case rpn_calculator_number:
-                    state->stack[state->top] = inc_digit(state->stack[state->top], state->selection);
-                    printf_stack(state);
+                    // selection counts right to left; the engine's positions run left to right.
+                    fixed_rpn_increment_digit(&state->stack.values[state->stack.top], 5 - state->selection);
                     draw(state, event.subsecond);
                     break;
                 case rpn_calculator_err:
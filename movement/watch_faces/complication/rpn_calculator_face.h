@@ -26,6 +26,7 @@
 #define RPN_CALCULATOR_FACE_H_
 
 #include "movement.h"
+#include "fixed_rpn.h"
 
 #define RPN_CALCULATOR_STACK_SIZE 4
 #define RPN_CALCULATOR_MAX_OPS 7;
@@ -50,8 +51,8 @@ typedef enum {
 typedef struct {
     rpn_calculator_mode_t mode;
     rpn_calculator_op_t op;
-    float stack[RPN_CALCULATOR_STACK_SIZE];
-    int8_t top;
+    int64_t stack_storage[RPN_CALCULATOR_STACK_SIZE];
+    fixed_rpn_stack_t stack; // decimal fixed point in hundredths; see lib/fixed_rpn
     uint8_t selection;
 } rpn_calculator_state_t;
 
@@ -66,6 +67,7 @@ void rpn_calculator_face_resign(movement_settings_t *settings, void *context);
     rpn_calculator_face_loop, \
     rpn_calculator_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // RPN_CALCULATOR_FACE_H_
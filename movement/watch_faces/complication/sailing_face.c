@@ -67,7 +67,7 @@ Long press on light button cycles through sound modes:
 #define DEFAULT_MINUTES { 5,4,1,0,0,0 }
 
 static inline int32_t get_tz_offset(movement_settings_t *settings) {
-    return movement_timezone_offsets[settings->bit.time_zone] * 60;
+    return movement_timezone_offset(settings->bit.time_zone);
 }
 
 static int lap = 0;
@@ -141,12 +141,21 @@ static void draw(sailing_state_t *state, uint8_t subsecond, movement_settings_t
                 if (subsecond % 2) {
                     buf[4 + state->selection] = ' ';
                 }
-                watch_display_string(buf, 0);
+                memcpy(movement_get_display_buffer(), buf, 10);
+                movement_flush_display_buffer();
+                // the vertical "10" is drawn with raw pixels on top of the blank position,
+                // so blinking it means clearing those pixels explicitly: the diff flush
+                // above won't rewrite a position whose character didn't change.
                 if (!(subsecond % 2) || state->selection != 0) {
                     watch_set_pixel(0, 18);
                     watch_set_pixel(0, 19);
                     watch_set_pixel(1, 18);
                     watch_set_pixel(1, 19);
+                } else {
+                    watch_clear_pixel(0, 18);
+                    watch_clear_pixel(0, 19);
+                    watch_clear_pixel(1, 18);
+                    watch_clear_pixel(1, 19);
                 }
                 return;
             }
@@ -182,7 +191,10 @@ static void draw(sailing_state_t *state, uint8_t subsecond, movement_settings_t
             }
             break;
     }
-    watch_display_string(buf, 0);
+    // diff-flushed: during the countdown only the digits that changed this second
+    // touch the SLCD, instead of rewriting all ten positions every tick.
+    memcpy(movement_get_display_buffer(), buf, 10);
+    movement_flush_display_buffer();
 }
 
 static void ring(sailing_state_t *state, movement_settings_t *settings) {    
@@ -272,7 +284,7 @@ void sailing_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(sailing_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(sailing_state_t));
         sailing_state_t *state = (sailing_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(sailing_state_t));
         static const uint8_t default_minutes[6] = DEFAULT_MINUTES;
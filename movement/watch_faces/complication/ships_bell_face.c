@@ -28,20 +28,51 @@
 #include "ships_bell_face.h"
 
 static void ships_bell_ring() {
+    // build the melody for this half hour (up to four double strikes plus one single) and
+    // hand it to the interrupt-driven sequencer: it powers the buzzer even when we ring
+    // from the background, and the core sleeps between notes. Durations are in 64ths of a
+    // second, approximating the original 75/100/250 ms strikes.
+    static int8_t bell_seq[4 * 8 + 3];
+    uint8_t pos = 0;
     watch_date_time date_time = watch_rtc_get_date_time();
 
     date_time.unit.hour %= 4;
     date_time.unit.hour = date_time.unit.hour == 0 && date_time.unit.minute < 30 ? 4 : date_time.unit.hour;
 
     for (uint8_t i = 0; i < date_time.unit.hour; i++) {
-        watch_buzzer_play_note(BUZZER_NOTE_C8, 75);
-        watch_buzzer_play_note(BUZZER_NOTE_REST, 75);
-        watch_buzzer_play_note(BUZZER_NOTE_C8, 100);
-        watch_buzzer_play_note(BUZZER_NOTE_REST, 250);
+        bell_seq[pos++] = BUZZER_NOTE_C8;
+        bell_seq[pos++] = 5;
+        bell_seq[pos++] = BUZZER_NOTE_REST;
+        bell_seq[pos++] = 5;
+        bell_seq[pos++] = BUZZER_NOTE_C8;
+        bell_seq[pos++] = 6;
+        bell_seq[pos++] = BUZZER_NOTE_REST;
+        bell_seq[pos++] = 16;
     }
 
-    if (date_time.unit.minute >= 30 ? 1 : 0) {
-        watch_buzzer_play_note(BUZZER_NOTE_C8, 100);
+    if (date_time.unit.minute >= 30) {
+        bell_seq[pos++] = BUZZER_NOTE_C8;
+        bell_seq[pos++] = 6;
+    }
+
+    bell_seq[pos] = 0;
+    movement_play_chime(bell_seq);
+}
+
+static bool ships_bell_on_duty(ships_bell_state_t *state, watch_date_time date_time) {
+    date_time.unit.hour %= 12;
+    switch (state->on_watch) {
+        case 1:
+            return (date_time.unit.hour >= 4 && date_time.unit.hour < 8) ||
+                   (date_time.unit.hour == 8 && date_time.unit.minute == 0);
+        case 2:
+            return (date_time.unit.hour >= 8 && date_time.unit.hour < 12) ||
+                   (date_time.unit.hour == 0 && date_time.unit.minute == 0);
+        case 3:
+            return (date_time.unit.hour >= 0 && date_time.unit.hour < 4) ||
+                   (date_time.unit.hour == 4 && date_time.unit.minute == 0);
+        default:
+            return true;
     }
 }
 
@@ -63,20 +94,23 @@ static void ships_bell_draw(ships_bell_state_t *state) {
 
 void ships_bell_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(ships_bell_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(ships_bell_state_t));
         memset(*context_ptr, 0, sizeof(ships_bell_state_t));
     }
+    ((ships_bell_state_t *)*context_ptr)->watch_face_index = watch_face_index;
 }
 
 void ships_bell_face_activate(movement_settings_t *settings, void *context) {
     (void) settings;
 
     ships_bell_state_t *state = (ships_bell_state_t *) context;
-    if (state->bell_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
-    else watch_clear_indicator(WATCH_INDICATOR_BELL);
+    if (state->bell_enabled) {
+        watch_set_indicator(WATCH_INDICATOR_BELL);
+        // scheduled tasks don't survive a trip through BACKUP mode; re-arming is idempotent
+        movement_schedule_background_task_for_face(state->watch_face_index, movement_next_chime(30));
+    } else watch_clear_indicator(WATCH_INDICATOR_BELL);
 
     watch_display_string("SB", 0);
     watch_set_colon();
@@ -94,8 +128,13 @@ bool ships_bell_face_loop(movement_event_t event, movement_settings_t *settings,
             break;
         case EVENT_ALARM_BUTTON_UP:
             state->bell_enabled = !state->bell_enabled;
-            if (state->bell_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
-            else watch_clear_indicator(WATCH_INDICATOR_BELL);
+            if (state->bell_enabled) {
+                watch_set_indicator(WATCH_INDICATOR_BELL);
+                movement_schedule_background_task_for_face(state->watch_face_index, movement_next_chime(30));
+            } else {
+                watch_clear_indicator(WATCH_INDICATOR_BELL);
+                movement_cancel_background_task_for_face(state->watch_face_index);
+            }
             break;
         case EVENT_ALARM_LONG_PRESS:
             state->on_watch = (state->on_watch + 1) % 4;
@@ -107,13 +146,10 @@ bool ships_bell_face_loop(movement_event_t event, movement_settings_t *settings,
         case EVENT_LOW_ENERGY_UPDATE:
             break;
         case EVENT_BACKGROUND_TASK:
-            if (watch_is_buzzer_or_led_enabled()) {
-                ships_bell_ring();
-            } else {
-                watch_enable_buzzer();
-                ships_bell_ring();
-                watch_disable_buzzer();
-            }
+            // strike if this half hour falls in our watch, then arm the next one: two wakes
+            // an hour instead of polling the clock every minute.
+            if (ships_bell_on_duty(state, event.date_time)) ships_bell_ring();
+            movement_schedule_background_task_for_face(state->watch_face_index, movement_next_chime(30));
             break;
         default:
             movement_default_loop_handler(event, settings);
@@ -127,28 +163,3 @@ void ships_bell_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
 }
-
-bool ships_bell_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-
-    ships_bell_state_t *state = (ships_bell_state_t *) context;
-    if (!state->bell_enabled) return false;
-
-    watch_date_time date_time = watch_rtc_get_date_time();
-    if (!(date_time.unit.minute == 0 || date_time.unit.minute == 30)) return false;
-
-    date_time.unit.hour %= 12;
-    switch (state->on_watch) {
-        case 1:
-            return (date_time.unit.hour >= 4 && date_time.unit.hour < 8) ||
-                   (date_time.unit.hour == 8 && date_time.unit.minute == 0);
-        case 2:
-            return (date_time.unit.hour >= 8 && date_time.unit.hour < 12) ||
-                   (date_time.unit.hour == 0 && date_time.unit.minute == 0);
-        case 3:
-            return (date_time.unit.hour >= 0 && date_time.unit.hour < 4) ||
-                   (date_time.unit.hour == 4 && date_time.unit.minute == 0);
-        default:
-            return true;
-    }
-}
@@ -48,20 +48,21 @@
 typedef struct {
     bool bell_enabled;
     uint8_t on_watch;
+    uint8_t watch_face_index;
 } ships_bell_state_t;
 
 void ships_bell_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void ships_bell_face_activate(movement_settings_t *settings, void *context);
 bool ships_bell_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void ships_bell_face_resign(movement_settings_t *settings, void *context);
-bool ships_bell_face_wants_background_task(movement_settings_t *settings, void *context);
 
 #define ships_bell_face ((const watch_face_t){ \
     ships_bell_face_setup, \
     ships_bell_face_activate, \
     ships_bell_face_loop, \
     ships_bell_face_resign, \
-    ships_bell_face_wants_background_task, \
+    NULL, \
+    NULL, \
 })
 
 #endif // SHIPS_BELL_FACE_H_
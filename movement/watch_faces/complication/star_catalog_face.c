@@ -0,0 +1,227 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "star_catalog_face.h"
+#include "watch.h"
+#include "watch_utility.h"
+#include "astrolib.h"
+
+// sin of -34 arcminutes in Q2.30: the standard refraction altitude for rise/set.
+#define STAR_CATALOG_SIN_H0 ((int32_t)-10619347)
+
+// one sidereal day in milliseconds; scaled by a 32-bit binary angle this turns
+// "fraction of the sky's rotation" into time.
+#define STAR_CATALOG_SIDEREAL_DAY_MS 86164091ULL
+
+// local (apparent-ish) sidereal time as a 32-bit binary angle, plus the current
+// unix timestamp through *now_out. Same GMST-to-turns conversion the alt/az
+// pipeline in astrolib uses.
+static uint32_t _star_catalog_lst_turns(movement_settings_t *settings, uint32_t *now_out) {
+    watch_date_time date_time = watch_rtc_get_date_time();
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offset(settings->bit.time_zone));
+    if (now_out) *now_out = timestamp;
+    watch_date_time utc = watch_utility_date_time_from_unix_time(timestamp, 0);
+    double jd = watch_utility_rata_die(utc.unit.year + WATCH_RTC_REFERENCE_YEAR, utc.unit.month, utc.unit.day) + 1721424.5
+        + (utc.unit.hour * 3600 + utc.unit.minute * 60 + utc.unit.second) / 86400.0;
+    uint32_t gmst = (uint32_t)(uint64_t)llround(astro_get_GMST(jd) * (4294967296.0 / 24.0));
+    movement_location_t movement_location = (movement_location_t) watch_get_backup_data(1);
+    int32_t lon_turns = (int32_t)(((int64_t)(int16_t)movement_location.bit.longitude << 32) / 36000);
+    return gmst + (uint32_t)lon_turns;
+}
+
+// index of the star whose right ascension is next up from the given sidereal
+// time -- i.e. the next one to cross the meridian. The catalog is sorted by
+// right ascension, so this is a plain binary search with a wrap at the end.
+static uint16_t _star_catalog_next_transit(uint16_t lst16) {
+    uint16_t lo = 0;
+    uint16_t hi = star_catalog_num_stars;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if (star_catalog[mid].right_ascension < lst16) lo = mid + 1;
+        else hi = mid;
+    }
+    return (lo < star_catalog_num_stars) ? lo : 0;
+}
+
+// next rise, transit and set for the selected star, all integer math: the time
+// to transit falls out of the right ascension minus the sidereal time (binary
+// angles subtract with free wraparound), and the half-arc on either side comes
+// from the standard hour-angle formula evaluated on astrolib's Q2.30 trig core.
+static void _star_catalog_recalculate(movement_settings_t *settings, star_catalog_state_t *state) {
+    uint32_t now;
+    uint32_t lst = _star_catalog_lst_turns(settings, &now);
+    const star_catalog_entry_t *star = &star_catalog[state->star_index];
+
+    uint32_t ra = (uint32_t)star->right_ascension << 16;
+    uint32_t dec = (uint32_t)((int32_t)star->declination << 16);
+    movement_location_t movement_location = (movement_location_t) watch_get_backup_data(1);
+    uint32_t lat = (uint32_t)(int32_t)(((int64_t)(int16_t)movement_location.bit.latitude << 32) / 36000);
+
+    uint32_t until_transit = (uint32_t)(((uint64_t)(ra - lst) * STAR_CATALOG_SIDEREAL_DAY_MS) >> 32) / 1000;
+    state->transit_timestamp = now + until_transit;
+
+    // cos H = (sin h0 - sin lat sin dec) / (cos lat cos dec), h0 = -34'
+    int64_t numerator = (int64_t)STAR_CATALOG_SIN_H0 - (((int64_t)astro_sin_turns(lat) * astro_sin_turns(dec)) >> 30);
+    int64_t denominator = ((int64_t)astro_cos_turns(lat) * astro_cos_turns(dec)) >> 30;
+    if (denominator <= 0 || numerator <= -denominator) {
+        // circumpolar: always above the horizon (or we're standing on a pole)
+        state->rise_timestamp = state->set_timestamp = 0;
+        return;
+    }
+    if (numerator >= denominator) {
+        // never rises at this latitude
+        state->rise_timestamp = state->set_timestamp = 0;
+        return;
+    }
+    uint32_t half_arc = astro_acos_turns((int32_t)((numerator << 30) / denominator));
+    uint32_t half_arc_seconds = (uint32_t)(((uint64_t)half_arc * STAR_CATALOG_SIDEREAL_DAY_MS) >> 32) / 1000;
+    state->rise_timestamp = state->transit_timestamp - half_arc_seconds;
+    state->set_timestamp = state->transit_timestamp + half_arc_seconds;
+    // show the next occurrence of each event, not one already behind us.
+    if (state->rise_timestamp <= now) state->rise_timestamp += (uint32_t)(STAR_CATALOG_SIDEREAL_DAY_MS / 1000);
+    if (state->set_timestamp <= now) state->set_timestamp += (uint32_t)(STAR_CATALOG_SIDEREAL_DAY_MS / 1000);
+}
+
+static void _star_catalog_display_event(movement_settings_t *settings, const char *prefix, uint32_t timestamp) {
+    char buf[14];
+    if (timestamp == 0) {
+        watch_clear_colon();
+        watch_clear_indicator(WATCH_INDICATOR_PM);
+        sprintf(buf, "%s   none ", prefix);
+        watch_display_string(buf, 0);
+        return;
+    }
+    watch_date_time event_time = watch_utility_date_time_from_unix_time(timestamp, movement_timezone_offset(settings->bit.time_zone));
+    watch_set_colon();
+    if (settings->bit.clock_mode_24h) {
+        watch_set_indicator(WATCH_INDICATOR_24H);
+    } else {
+        if (watch_utility_convert_to_12_hour(&event_time)) watch_set_indicator(WATCH_INDICATOR_PM);
+        else watch_clear_indicator(WATCH_INDICATOR_PM);
+    }
+    sprintf(buf, "%s%2d%2d%02d  ", prefix, event_time.unit.day, event_time.unit.hour, event_time.unit.minute);
+    watch_display_string(buf, 0);
+}
+
+static void _star_catalog_face_update(movement_settings_t *settings, star_catalog_state_t *state) {
+    char buf[14];
+    if (watch_get_backup_data(1) == 0) {
+        // rise and set times are meaningless without a location; the sunrise/sunset
+        // face is the place to set one.
+        watch_display_string("ST  no Loc", 0);
+        return;
+    }
+    switch (state->mode) {
+        case STAR_CATALOG_MODE_SELECTING:
+            watch_clear_colon();
+            watch_clear_indicator(WATCH_INDICATOR_PM);
+            watch_clear_indicator(WATCH_INDICATOR_24H);
+            sprintf(buf, "ST%2d%-6s", (state->star_index + 1) % 100, star_catalog_names[state->star_index]);
+            watch_display_string(buf, 0);
+            break;
+        case STAR_CATALOG_MODE_DISPLAYING_MAG:
+            watch_clear_colon();
+            sprintf(buf, "ST  %6d", star_catalog[state->star_index].magnitude);
+            watch_display_string(buf, 0);
+            break;
+        case STAR_CATALOG_MODE_DISPLAYING_RISE:
+            _star_catalog_display_event(settings, "rI", state->rise_timestamp);
+            break;
+        case STAR_CATALOG_MODE_DISPLAYING_TRANSIT:
+            _star_catalog_display_event(settings, "tr", state->transit_timestamp);
+            break;
+        case STAR_CATALOG_MODE_DISPLAYING_SET:
+            _star_catalog_display_event(settings, "SE", state->set_timestamp);
+            break;
+        case STAR_CATALOG_MODE_NUM_MODES:
+            // this case does not happen, but we need it to silence a warning.
+            break;
+    }
+}
+
+void star_catalog_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
+    (void) settings;
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(star_catalog_state_t));
+        memset(*context_ptr, 0, sizeof(star_catalog_state_t));
+    }
+}
+
+void star_catalog_face_activate(movement_settings_t *settings, void *context) {
+    star_catalog_state_t *state = (star_catalog_state_t *)context;
+    // open on whatever is closest to crossing the meridian right now.
+    uint32_t lst = _star_catalog_lst_turns(settings, NULL);
+    state->star_index = _star_catalog_next_transit((uint16_t)(lst >> 16));
+    state->mode = STAR_CATALOG_MODE_SELECTING;
+}
+
+bool star_catalog_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
+    star_catalog_state_t *state = (star_catalog_state_t *)context;
+
+    switch (event.event_type) {
+        case EVENT_ACTIVATE:
+        case EVENT_TICK:
+            _star_catalog_face_update(settings, state);
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+            if (state->mode == STAR_CATALOG_MODE_SELECTING) {
+                // advance along the meridian: the catalog is in transit order.
+                state->star_index = (state->star_index + 1) % star_catalog_num_stars;
+            } else {
+                state->mode++;
+                if (state->mode == STAR_CATALOG_MODE_NUM_MODES) state->mode = STAR_CATALOG_MODE_DISPLAYING_MAG;
+            }
+            _star_catalog_face_update(settings, state);
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            if (state->mode == STAR_CATALOG_MODE_SELECTING) {
+                _star_catalog_recalculate(settings, state);
+                state->mode = STAR_CATALOG_MODE_DISPLAYING_MAG;
+            } else {
+                state->mode = STAR_CATALOG_MODE_SELECTING;
+            }
+            _star_catalog_face_update(settings, state);
+            break;
+        case EVENT_TIMEOUT:
+            movement_move_to_face(0);
+            break;
+        case EVENT_LOW_ENERGY_UPDATE:
+            break;
+        default:
+            movement_default_loop_handler(event, settings);
+            break;
+    }
+
+    return true;
+}
+
+void star_catalog_face_resign(movement_settings_t *settings, void *context) {
+    (void) settings;
+    star_catalog_state_t *state = (star_catalog_state_t *)context;
+    state->mode = STAR_CATALOG_MODE_SELECTING;
+}
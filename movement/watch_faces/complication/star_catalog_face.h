@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STAR_CATALOG_FACE_H_
+#define STAR_CATALOG_FACE_H_
+
+#include "movement.h"
+#include "star_catalog.h"
+
+// The Star Catalog face answers "what's that star": it holds the ~110 brightest
+// stars as packed flash records and, for the location register, shows each one's
+// rise, transit and set times. On activation it binary-searches the catalog (which
+// is sorted by right ascension) for the star closest to crossing the meridian, so
+// the face opens on whatever is highest in the sky right now. The hour-angle math
+// runs on astrolib's fixed-point trig core; no floating point trig is involved.
+//
+// Controls:
+//  - ALARM short press: next star, in order of upcoming transit.
+//  - ALARM long press: show details for the current star; short presses then cycle
+//    magnitude, rise, transit and set. Another long press returns to star selection.
+//  - On days the star never crosses the horizon, rise and set show "none".
+
+typedef enum {
+    STAR_CATALOG_MODE_SELECTING = 0,
+    STAR_CATALOG_MODE_DISPLAYING_MAG,
+    STAR_CATALOG_MODE_DISPLAYING_RISE,
+    STAR_CATALOG_MODE_DISPLAYING_TRANSIT,
+    STAR_CATALOG_MODE_DISPLAYING_SET,
+    STAR_CATALOG_MODE_NUM_MODES
+} star_catalog_mode_t;
+
+typedef struct {
+    uint16_t star_index;
+    star_catalog_mode_t mode;
+    // next events for the selected star as unix timestamps; rise and set are
+    // 0 when the star never crosses the horizon at this latitude.
+    uint32_t rise_timestamp;
+    uint32_t transit_timestamp;
+    uint32_t set_timestamp;
+} star_catalog_state_t;
+
+void star_catalog_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
+void star_catalog_face_activate(movement_settings_t *settings, void *context);
+bool star_catalog_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
+void star_catalog_face_resign(movement_settings_t *settings, void *context);
+
+#define star_catalog_face ((const watch_face_t){ \
+    star_catalog_face_setup, \
+    star_catalog_face_activate, \
+    star_catalog_face_loop, \
+    star_catalog_face_resign, \
+    NULL, \
+    NULL, \
+})
+
+#endif // STAR_CATALOG_FACE_H_
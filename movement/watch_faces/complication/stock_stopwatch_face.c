@@ -28,6 +28,7 @@
 #include "watch.h"
 #include "watch_utility.h"
 #include "watch_rtc.h"
+#include "filesystem.h"
 
 /*
     This watch face implements the original F-91W stopwatch functionality
@@ -37,92 +38,49 @@
        but keeps track of hours in the upper right hand corner. (Up to 24h)
     2. Long pressing the light button toggles the led behaviour: it either
        turns on on each button press or it doesn't.
+    3. Laps are remembered: each one is stamped into a 64-entry ring that
+       banks to the filesystem when full, and the `laps` shell command
+       exports them all in one binary burst.
 */
 
-#if __EMSCRIPTEN__
-#include <emscripten.h>
-#include <emscripten/html5.h>
-#else
-#include "../../../watch-library/hardware/include/saml22j18a.h"
-#include "../../../watch-library/hardware/include/component/tc.h"
-#include "../../../watch-library/hardware/hri/hri_tc_l22.h"
-#endif
-
 // distant future for background task: January 1, 2083
 static const watch_date_time distant_future = {
     .unit = {0, 0, 0, 1, 1, 63}
 };
 
+static int8_t _timer_channel = -1;
 static uint32_t _ticks;
 static uint32_t _lap_ticks;
 static uint8_t _blink_ticks;
 static uint32_t _old_seconds;
 static uint8_t _old_minutes;
+static uint8_t _old_hours;
 static uint8_t _hours;
 static bool _colon;
 static bool _is_running;
 
-#if __EMSCRIPTEN__
-
-static long _em_interval_id = 0;
-
-void em_cb_handler(void *userData) {
-    // interrupt handler for emscripten 128 Hz callbacks
-    (void) userData;
-    _ticks++;
-}
-
-static void _cb_initialize() { }
-
-static inline void _cb_stop() {
-    emscripten_clear_interval(_em_interval_id);
-    _em_interval_id = 0;
-    _is_running = false;
-}
-
-static inline void _cb_start() {
-    // initiate 128 hz callback
-    _em_interval_id = emscripten_set_interval(em_cb_handler, (double)(1000/128), (void *)NULL);
-}
-
-#else
-
-static inline void _cb_start() {
-    // start the TC2 timer
-    hri_tc_set_CTRLA_ENABLE_bit(TC2);
-    _is_running = true;
-}
+static uint32_t _lap_ring[STOCK_STOPWATCH_LAP_RING_SIZE];
+static uint8_t _lap_count;
 
-static inline void _cb_stop() {
-    // stop the TC2 timer
-    hri_tc_clear_CTRLA_ENABLE_bit(TC2);
-    _is_running = false;
+// stamp the current elapsed time into the lap ring; a full ring is banked to
+// the filesystem in one append, so taking a lap never costs more than that.
+static void _record_lap(void) {
+    uint32_t total_ticks = watch_fast_timer_get_ticks(_timer_channel);
+    _lap_ring[_lap_count++] = (uint32_t)(((uint64_t)total_ticks * 100) >> 7);
+    if (_lap_count == STOCK_STOPWATCH_LAP_RING_SIZE) {
+        filesystem_append_file(STOCK_STOPWATCH_LAP_FILENAME, (char *)_lap_ring, sizeof(_lap_ring));
+        _lap_count = 0;
+    }
 }
 
-static void _cb_initialize() {
-    // setup and initialize TC2 for a 64 Hz interrupt
-    hri_mclk_set_APBCMASK_TC2_bit(MCLK);
-    hri_gclk_write_PCHCTRL_reg(GCLK, TC2_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK3 | GCLK_PCHCTRL_CHEN);
-    _cb_stop();
-    hri_tc_write_CTRLA_reg(TC2, TC_CTRLA_SWRST);
-    hri_tc_wait_for_sync(TC2, TC_SYNCBUSY_SWRST);
-    hri_tc_write_CTRLA_reg(TC2, TC_CTRLA_PRESCALER_DIV64 | // 32 Khz divided by 64 divided by 4 results in a 128 Hz interrupt
-                           TC_CTRLA_MODE_COUNT8 | 
-                           TC_CTRLA_RUNSTDBY);
-    hri_tccount8_write_PER_reg(TC2, 3);
-    hri_tc_set_INTEN_OVF_bit(TC2);
-    NVIC_ClearPendingIRQ(TC2_IRQn);
-    NVIC_EnableIRQ (TC2_IRQn);
+uint8_t stock_stopwatch_get_lap_count(void) {
+    return _lap_count;
 }
 
-void TC2_Handler(void) {
-    // interrupt handler for TC2 (globally!)
-    _ticks++;
-    TC2->COUNT8.INTFLAG.reg |= TC_INTFLAG_OVF;
+const uint32_t *stock_stopwatch_get_laps(void) {
+    return _lap_ring;
 }
 
-#endif
-
 static inline void _button_beep(movement_settings_t *settings) {
     // play a beep as confirmation for a button press (if applicable)
     if (settings->bit.button_should_sound) watch_buzzer_play_note(BUZZER_NOTE_C7, 50);
@@ -206,16 +164,16 @@ void stock_stopwatch_face_setup(movement_settings_t *settings, uint8_t watch_fac
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(stock_stopwatch_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(stock_stopwatch_state_t));
         memset(*context_ptr, 0, sizeof(stock_stopwatch_state_t));
         stock_stopwatch_state_t *state = (stock_stopwatch_state_t *)*context_ptr;
-        _ticks = _lap_ticks = _blink_ticks = _old_minutes = _old_seconds = _hours = 0;
+        _ticks = _lap_ticks = _blink_ticks = _old_minutes = _old_seconds = _old_hours = _hours = 0;
     _is_running = _colon = false;
         state->light_on_button = true;
     }
-    if (!_is_running) {
-        // prepare the 128 Hz callback source
-        _cb_initialize();
+    if (_timer_channel < 0) {
+        // claim a 128 Hz timer channel for time measuring
+        _timer_channel = watch_fast_timer_claim();
     }
 }
 
@@ -231,13 +189,16 @@ void stock_stopwatch_face_activate(movement_settings_t *settings, void *context)
 bool stock_stopwatch_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     stock_stopwatch_state_t *state = (stock_stopwatch_state_t *)context;
 
-    // handle overflow of fast ticks
-    while (_ticks >= (128 * 60 * 60)) {
-        _ticks -= (128 * 60 * 60);
-        _hours++;
-        if (_hours >= 24) _hours -= 24;
-        // initiate a re-draw
-        _old_minutes = 59;
+    // derive hours and sub-hour ticks from the timer channel's total count
+    if (_is_running) {
+        uint32_t total_ticks = watch_fast_timer_get_ticks(_timer_channel);
+        _ticks = total_ticks % (128 * 60 * 60);
+        _hours = (total_ticks / (128 * 60 * 60)) % 24;
+        if (_hours != _old_hours) {
+            _old_hours = _hours;
+            // initiate a re-draw
+            _old_minutes = 59;
+        }
     }
 
     switch (event.event_type) {
@@ -262,13 +223,13 @@ bool stock_stopwatch_face_loop(movement_event_t event, movement_settings_t *sett
             if (_is_running) {
                 // start or continue stopwatch
                 movement_request_tick_frequency(16);
-                // register 128 hz callback for time measuring
-                _cb_start();
+                // start the 128 Hz timer channel for time measuring
+                watch_fast_timer_start(_timer_channel);
                 // schedule the keepalive task when running
                 movement_schedule_background_task(distant_future);
             } else {
                 // stop the stopwatch
-                _cb_stop();
+                watch_fast_timer_stop(_timer_channel);
                 movement_request_tick_frequency(1);
                 _set_colon();
                 // cancel the keepalive task
@@ -287,6 +248,7 @@ bool stock_stopwatch_face_loop(movement_event_t event, movement_settings_t *sett
                 } else {
                     // set lap ticks and stop updating the display
                     _lap_ticks = _ticks;
+                    _record_lap();
                     movement_request_tick_frequency(2);
                     _set_colon();
                 }
@@ -294,9 +256,13 @@ bool stock_stopwatch_face_loop(movement_event_t event, movement_settings_t *sett
                 if (_lap_ticks) {
                     // clear lap and show running stopwatch
                     _lap_ticks = 0;
-                } else if (_ticks) {
-                    // reset stopwatch
-                    _ticks = _lap_ticks = _blink_ticks = _old_minutes = _old_seconds = _hours = 0;
+                } else if (_ticks || _hours) {
+                    // reset stopwatch; this is the session boundary, so the lap
+                    // memory goes too. export with the `laps` command first.
+                    watch_fast_timer_reset(_timer_channel);
+                    _ticks = _lap_ticks = _blink_ticks = _old_minutes = _old_seconds = _old_hours = _hours = 0;
+                    _lap_count = 0;
+                    if (filesystem_file_exists(STOCK_STOPWATCH_LAP_FILENAME)) filesystem_rm(STOCK_STOPWATCH_LAP_FILENAME);
                     _button_beep(settings);
                 }
             }
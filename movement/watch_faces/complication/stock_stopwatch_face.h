@@ -36,23 +36,35 @@ typedef struct {
     bool light_on_button;   // determines whether the light button actually triggers the led
 } stock_stopwatch_state_t;
 
+// Lap memory: every lap taken with the LIGHT button is stamped into a 64-entry
+// ring of 32-bit centisecond counts; when the ring fills it is banked to
+// "laps.dat" on the filesystem, so no lap is ever lost to the display. The
+// `laps` shell command exports banked and pending laps in one framed binary
+// burst. Resetting the stopwatch clears the ring and the banked file — export
+// before resetting.
+#define STOCK_STOPWATCH_LAP_RING_SIZE 64
+#define STOCK_STOPWATCH_LAP_FILENAME "laps.dat"
+
+/** @brief Number of laps currently in the in-memory ring (banked laps not included). */
+uint8_t stock_stopwatch_get_lap_count(void);
+
+/** @brief The in-memory lap ring: lap stamps in centiseconds, oldest first. */
+const uint32_t *stock_stopwatch_get_laps(void);
+
 void stock_stopwatch_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void stock_stopwatch_face_activate(movement_settings_t *settings, void *context);
 bool stock_stopwatch_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void stock_stopwatch_face_resign(movement_settings_t *settings, void *context);
 
-#if __EMSCRIPTEN__
-void em_cb_handler(void *userData);
-#else
-void TC2_Handler(void);
-#endif
-
 #define stock_stopwatch_face ((const watch_face_t){ \
     stock_stopwatch_face_setup, \
     stock_stopwatch_face_activate, \
     stock_stopwatch_face_loop, \
     stock_stopwatch_face_resign, \
     NULL, \
+    NULL, \
+    NULL, \
+    1, /* timekeeping lives in the TC channel, so the 16 Hz display tick can idle down to 1 Hz */ \
 })
 
 #endif // STOCK_STOPWATCH_FACE_H_
@@ -39,42 +39,44 @@ void stopwatch_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(stopwatch_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(stopwatch_state_t));
         memset(*context_ptr, 0, sizeof(stopwatch_state_t));
     }
 }
 
 static void _stopwatch_face_update_display(stopwatch_state_t *stopwatch_state, bool show_seconds) {
     if (stopwatch_state->running) {
-        watch_date_time now = watch_rtc_get_date_time();
-        uint32_t now_timestamp = watch_utility_date_time_to_unix_time(now, 0);
-        uint32_t start_timestamp = watch_utility_date_time_to_unix_time(stopwatch_state->start_time, 0);
-        stopwatch_state->seconds_counted = now_timestamp - start_timestamp;
+        uint32_t now_timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+        stopwatch_state->seconds_counted = now_timestamp - stopwatch_state->start_ts;
     }
 
     if (stopwatch_state->seconds_counted >= 3456000) {
         // display maxes out just shy of 40 days, thanks to the limit on the day digits (0-39)
         stopwatch_state->running = false;
         movement_cancel_background_task();
-        watch_display_string("st39235959", 0);
+        strcpy(movement_get_display_buffer(), "st39235959");
+        movement_flush_display_buffer();
         return;
     }
 
     watch_duration_t duration = watch_utility_seconds_to_duration(stopwatch_state->seconds_counted);
-    char buf[14];
+    char *buf = movement_get_display_buffer();
 
-    sprintf(buf, "st  %02d%02d  ", duration.hours, duration.minutes);
-    watch_display_string(buf, 0);
+    // format the whole line into the persistent scratch buffer every time; the diff flush
+    // only writes the positions that changed since the last frame, so a running stopwatch
+    // normally costs two digit writes per second.
+    if (show_seconds) {
+        sprintf(buf, "st  %02d%02d%02d", duration.hours, duration.minutes, duration.seconds);
+    } else {
+        sprintf(buf, "st  %02d%02d  ", duration.hours, duration.minutes);
+    }
 
     if (duration.days != 0) {
-        sprintf(buf, "%2d", (uint8_t)duration.days);
-        watch_display_string(buf, 2);
+        buf[2] = (duration.days >= 10) ? ('0' + duration.days / 10) : ' ';
+        buf[3] = '0' + duration.days % 10;
     }
 
-    if (show_seconds) {
-        sprintf(buf, "%02d", duration.seconds);
-        watch_display_string(buf, 8);
-    }
+    movement_flush_display_buffer();
 }
 
 void stopwatch_face_activate(movement_settings_t *settings, void *context) {
@@ -101,8 +103,9 @@ bool stopwatch_face_loop(movement_event_t event, movement_settings_t *settings,
             watch_set_colon();
             // fall through
         case EVENT_TICK:
-            if (stopwatch_state->start_time.reg == 0) {
-                watch_display_string("st  000000", 0);
+            if (stopwatch_state->start_ts == 0) {
+                strcpy(movement_get_display_buffer(), "st  000000");
+                movement_flush_display_buffer();
             } else {
                 _stopwatch_face_update_display(stopwatch_state, true);
             }
@@ -110,9 +113,10 @@ bool stopwatch_face_loop(movement_event_t event, movement_settings_t *settings,
         case EVENT_LIGHT_BUTTON_DOWN:
             movement_illuminate_led();
             if (!stopwatch_state->running) {
-                stopwatch_state->start_time.reg = 0;
+                stopwatch_state->start_ts = 0;
                 stopwatch_state->seconds_counted = 0;
-                watch_display_string("st  000000", 0);
+                strcpy(movement_get_display_buffer(), "st  000000");
+                movement_flush_display_buffer();
             }
             break;
         case EVENT_ALARM_BUTTON_DOWN:
@@ -121,18 +125,15 @@ bool stopwatch_face_loop(movement_event_t event, movement_settings_t *settings,
             }
             stopwatch_state->running = !stopwatch_state->running;
             if (stopwatch_state->running) {
-                // we're running now, so we need to set the start_time.
-                if (stopwatch_state->start_time.reg == 0) {
+                // we're running now, so we need to set the start timestamp.
+                uint32_t timestamp = watch_utility_date_time_to_unix_time(event.date_time, 0);
+                if (stopwatch_state->start_ts == 0) {
                     // if starting from the reset state, easy: we start now.
-                    stopwatch_state->start_time = watch_rtc_get_date_time();
+                    stopwatch_state->start_ts = timestamp;
                 } else {
                     // if resuming with time already on the clock, the original start time isn't valid anymore!
-                    // so let's fetch the current time...
-                    uint32_t timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
-                    // ...subtract the seconds we've already counted...
-                    timestamp -= stopwatch_state->seconds_counted;
-                    // and resume from the "virtual" start time that's that many seconds ago.
-                    stopwatch_state->start_time = watch_utility_date_time_from_unix_time(timestamp, 0);
+                    // so resume from the "virtual" start that's seconds_counted seconds ago.
+                    stopwatch_state->start_ts = timestamp - stopwatch_state->seconds_counted;
                 }
                 // schedule our keepalive task when running...
                 movement_schedule_background_task(distant_future);
@@ -150,7 +151,8 @@ bool stopwatch_face_loop(movement_event_t event, movement_settings_t *settings,
                 // since the tick animation is running, displaying the stopped time could be misleading,
                 // as it could imply that the stopwatch is running. instead, show a blank display to
                 // indicate that we are in sleep mode.
-                watch_display_string("st  ----  ", 0);
+                strcpy(movement_get_display_buffer(), "st  ----  ");
+                movement_flush_display_buffer();
             } else {
                 // this OTOH shouldn't happen anymore; if we're running, we shouldn't enter low energy mode
                 _stopwatch_face_update_display(stopwatch_state, false);
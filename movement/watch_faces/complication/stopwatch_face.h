@@ -30,7 +30,9 @@
 
 typedef struct {
     bool running;
-    watch_date_time start_time; // while running, show the difference between this time and now
+    uint32_t start_ts;          // while running, show the difference between this unix timestamp
+                                // and now. Converted from calendar time once when the stopwatch
+                                // starts, so each render pays for only one date conversion.
     uint32_t seconds_counted;   // set this value when paused, and show that instead.
 } stopwatch_state_t;
 
@@ -45,6 +47,7 @@ void stopwatch_face_resign(movement_settings_t *settings, void *context);
     stopwatch_face_loop, \
     stopwatch_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // STOPWATCH_FACE_H_
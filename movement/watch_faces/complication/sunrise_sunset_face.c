@@ -27,11 +27,11 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "sunrise_sunset_face.h"
 #include "watch.h"
 #include "watch_utility.h"
-#include "sunriset.h"
+#include "sunriset_fixed.h"
+#include "filesystem.h"
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
@@ -42,9 +42,151 @@ static void _sunrise_sunset_set_expiration(sunrise_sunset_state_t *state, watch_
     state->rise_set_expires = watch_utility_date_time_from_unix_time(timestamp + 60, 0);
 }
 
+// Precomputed annual rise/set table, generated on demand by the `suntable` shell
+// command for the stored location. The file is a small header (the location register
+// and calendar year it was computed for) followed by one record per day of the year:
+// rise and set as int16 minutes from UTC midnight, rounded the same way the display
+// rounds, so a table hit and a live computation always show the same time. Days where
+// the sun never crosses the horizon store a sentinel rise and the sunriset return
+// code in the set slot. Lookups validate the header, so a changed location or a new
+// year quietly falls back to live computation until the table is regenerated.
+
+#define SUNRISE_SUNSET_TABLE_FILENAME "suntab.dat"
+#define SUNRISE_SUNSET_TABLE_NO_EVENT INT16_MAX
+
+typedef struct {
+    uint32_t location;  // movement_location_t.reg the table was computed for
+    uint16_t year;      // calendar year the table covers
+    uint16_t num_days;  // 365 or 366
+} sunrise_sunset_table_header_t;
+
+static bool _sunrise_sunset_table_lookup(movement_location_t location, uint16_t year, uint8_t month, uint8_t day, sunriset_fix16_t *rise, sunriset_fix16_t *set, uint8_t *rc) {
+    sunrise_sunset_table_header_t header;
+    if (!filesystem_read_file_range(SUNRISE_SUNSET_TABLE_FILENAME, (char *)&header, 0, sizeof(header))) return false;
+    if (header.location != location.reg || header.year != year) return false;
+    uint16_t day_of_year = watch_utility_days_since_new_year(year, month, day);
+    if (day_of_year > header.num_days) return false;
+
+    int16_t minutes[2];
+    if (!filesystem_read_file_range(SUNRISE_SUNSET_TABLE_FILENAME, (char *)minutes, sizeof(header) + (day_of_year - 1) * sizeof(minutes), sizeof(minutes))) return false;
+    if (minutes[0] == SUNRISE_SUNSET_TABLE_NO_EVENT) {
+        *rise = *set = 0;
+        *rc = (uint8_t)minutes[1];
+    } else {
+        *rise = ((sunriset_fix16_t)minutes[0] << 16) / 60;
+        *set = ((sunriset_fix16_t)minutes[1] << 16) / 60;
+        *rc = 0;
+    }
+    return true;
+}
+
+bool sunrise_sunset_generate_table(void) {
+    movement_location_t location = (movement_location_t) watch_get_backup_data(1);
+    if (location.reg == 0) return false;
+
+    watch_date_time now = watch_rtc_get_date_time();
+    uint16_t year = now.unit.year + WATCH_RTC_REFERENCE_YEAR;
+    sunriset_fix16_t lat = ((sunriset_fix16_t)(int16_t)location.bit.latitude << 16) / 100;
+    sunriset_fix16_t lon = ((sunriset_fix16_t)(int16_t)location.bit.longitude << 16) / 100;
+
+    sunrise_sunset_table_header_t header = {
+        .location = location.reg,
+        .year = year,
+        .num_days = 365 + is_leap(year),
+    };
+    if (!filesystem_write_file(SUNRISE_SUNSET_TABLE_FILENAME, (char *)&header, sizeof(header))) return false;
+
+    // generate and append a month at a time: a day's record is 4 bytes, so a whole
+    // year on the stack would be unfriendly, and per-day appends would be 366 syncs.
+    static const uint8_t days_in_month[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    for (uint8_t month = 1; month <= 12; month++) {
+        int16_t records[31][2];
+        uint8_t num_days = days_in_month[month - 1] + ((month == 2) ? is_leap(year) : 0);
+        for (uint8_t day = 1; day <= num_days; day++) {
+            sunriset_fix16_t rise, set;
+            uint8_t rc = sun_rise_set_fixed(year, month, day, lon, lat, &rise, &set);
+            if (rc != 0) {
+                records[day - 1][0] = SUNRISE_SUNSET_TABLE_NO_EVENT;
+                records[day - 1][1] = (int16_t)rc;
+            } else {
+                records[day - 1][0] = (int16_t)(((int64_t)rise * 60 + 32768) >> 16);
+                records[day - 1][1] = (int16_t)(((int64_t)set * 60 + 32768) >> 16);
+            }
+        }
+        if (!filesystem_append_file(SUNRISE_SUNSET_TABLE_FILENAME, (char *)records, num_days * sizeof(records[0]))) {
+            filesystem_rm(SUNRISE_SUNSET_TABLE_FILENAME);
+            return false;
+        }
+    }
+    return true;
+}
+
+// rise/set times for a given date, served from the two-entry cache in the face
+// state when possible. the update loop only ever asks about today and tomorrow,
+// which land in different slots (day parity), so a full day of activations and
+// scrolling costs one computation per date. on a cache miss the annual table, if
+// one has been generated for this location, answers with two small file reads
+// before any trigonometry happens.
+static uint8_t _sunrise_sunset_cached_rise_set(sunrise_sunset_state_t *state, movement_location_t location, uint16_t year, uint8_t month, uint8_t day, sunriset_fix16_t *rise, sunriset_fix16_t *set) {
+    uint32_t date_key = ((uint32_t)year << 9) | ((uint32_t)month << 5) | day;
+    uint8_t slot = day & 1;
+
+    if (state->ephemeris_location != location.reg) {
+        // location changed out from under us; drop both entries.
+        state->ephemeris_date[0] = state->ephemeris_date[1] = 0;
+        state->ephemeris_location = location.reg;
+    }
+
+    if (state->ephemeris_date[slot] != date_key) {
+        if (!_sunrise_sunset_table_lookup(location, year, month, day, &state->ephemeris_rise[slot], &state->ephemeris_set[slot], &state->ephemeris_rc[slot])) {
+            int16_t lat_centi = (int16_t)location.bit.latitude;
+            int16_t lon_centi = (int16_t)location.bit.longitude;
+            sunriset_fix16_t lat = ((sunriset_fix16_t)lat_centi << 16) / 100;
+            sunriset_fix16_t lon = ((sunriset_fix16_t)lon_centi << 16) / 100;
+            state->ephemeris_rc[slot] = sun_rise_set_fixed(year, month, day, lon, lat, &state->ephemeris_rise[slot], &state->ephemeris_set[slot]);
+        }
+        state->ephemeris_date[slot] = date_key;
+    }
+
+    *rise = state->ephemeris_rise[slot];
+    *set = state->ephemeris_set[slot];
+    return state->ephemeris_rc[slot];
+}
+
+// find the first rise/set event after the current time and ask Movement to wake us
+// then. events are checked in order (today's rise, today's set, then tomorrow's),
+// and all the times come out of the ephemeris cache, so this is table reads plus a
+// handful of fixed-point multiplies.
+static void _sunrise_sunset_schedule_next_event(movement_settings_t *settings, sunrise_sunset_state_t *state) {
+    movement_location_t movement_location = (movement_location_t) watch_get_backup_data(1);
+    if (movement_location.reg == 0) return;
+
+    watch_date_time now = watch_rtc_get_date_time();
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(now, movement_timezone_offset(settings->bit.time_zone));
+    sunriset_fix16_t hours_from_utc = ((sunriset_fix16_t)(movement_timezone_offset(settings->bit.time_zone) / 60) << 16) / 60;
+
+    for (int i = 0; i < 2; i++) {
+        watch_date_time scratch_time = watch_utility_date_time_from_unix_time(timestamp + i * 86400, 0);
+        sunriset_fix16_t events[2];
+        if (_sunrise_sunset_cached_rise_set(state, movement_location, scratch_time.unit.year + WATCH_RTC_REFERENCE_YEAR, scratch_time.unit.month, scratch_time.unit.day, &events[0], &events[1])) continue;
+        for (int j = 0; j < 2; j++) {
+            int32_t total_minutes = (int32_t)(((int64_t)(events[j] + hours_from_utc) * 60 + 32768) >> 16);
+            scratch_time.unit.hour = (total_minutes / 60) % 24;
+            scratch_time.unit.minute = total_minutes % 60;
+            scratch_time.unit.second = 0;
+            if (now.reg < scratch_time.reg) {
+                state->next_event = scratch_time;
+                movement_schedule_background_task_for_face(state->watch_face_index, scratch_time);
+                return;
+            }
+        }
+    }
+}
+
 static void _sunrise_sunset_face_update(movement_settings_t *settings, sunrise_sunset_state_t *state) {
     char buf[14];
-    double rise, set, minutes, seconds;
+    sunriset_fix16_t rise, set;
+    int32_t total_minutes;
     bool show_next_match = false;
     movement_location_t movement_location = (movement_location_t) watch_get_backup_data(1);
 
@@ -54,26 +196,18 @@ static void _sunrise_sunset_face_update(movement_settings_t *settings, sunrise_s
     }
 
     watch_date_time date_time = watch_rtc_get_date_time(); // the current local date / time
-    watch_date_time utc_now = watch_utility_date_time_convert_zone(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60, 0); // the current date / time in UTC
+    watch_date_time utc_now = watch_utility_date_time_convert_zone(date_time, movement_timezone_offset(settings->bit.time_zone), 0); // the current date / time in UTC
     watch_date_time scratch_time; // scratchpad, contains different values at different times
     scratch_time.reg = utc_now.reg;
 
-    // Weird quirky unsigned things were happening when I tried to cast these directly to doubles below.
-    // it looks redundant, but extracting them to local int16's seemed to fix it.
-    int16_t lat_centi = (int16_t)movement_location.bit.latitude;
-    int16_t lon_centi = (int16_t)movement_location.bit.longitude;
-
-    double lat = (double)lat_centi / 100.0;
-    double lon = (double)lon_centi / 100.0;
-
     // sunriset returns the rise/set times as signed decimal hours in UTC.
     // this can mean hours below 0 or above 31, which won't fit into a watch_date_time struct.
     // to deal with this, we set aside the offset in hours, and add it back before converting it to a watch_date_time.
-    double hours_from_utc = ((double)movement_timezone_offsets[settings->bit.time_zone]) / 60.0;
+    sunriset_fix16_t hours_from_utc = ((sunriset_fix16_t)(movement_timezone_offset(settings->bit.time_zone) / 60) << 16) / 60;
 
     // we loop twice because if it's after sunset today, we need to recalculate to display values for tomorrow.
     for(int i = 0; i < 2; i++) {
-        uint8_t result = sun_rise_set(scratch_time.unit.year + WATCH_RTC_REFERENCE_YEAR, scratch_time.unit.month, scratch_time.unit.day, lon, lat, &rise, &set);
+        uint8_t result = _sunrise_sunset_cached_rise_set(state, movement_location, scratch_time.unit.year + WATCH_RTC_REFERENCE_YEAR, scratch_time.unit.month, scratch_time.unit.day, &rise, &set);
 
         if (result != 0) {
             watch_clear_colon();
@@ -90,16 +224,10 @@ static void _sunrise_sunset_face_update(movement_settings_t *settings, sunrise_s
         rise += hours_from_utc;
         set += hours_from_utc;
 
-        minutes = 60.0 * fmod(rise, 1);
-        seconds = 60.0 * fmod(minutes, 1);
-        scratch_time.unit.hour = floor(rise);
-        if (seconds < 30) scratch_time.unit.minute = floor(minutes);
-        else scratch_time.unit.minute = ceil(minutes);
-
-        if (scratch_time.unit.minute == 60) {
-            scratch_time.unit.minute = 0;
-            scratch_time.unit.hour = (scratch_time.unit.hour + 1) % 24;
-        }
+        // round the Q16.16 decimal hours to the nearest minute.
+        total_minutes = (int32_t)(((int64_t)rise * 60 + 32768) >> 16);
+        scratch_time.unit.hour = (total_minutes / 60) % 24;
+        scratch_time.unit.minute = total_minutes % 60;
 
         if (date_time.reg < scratch_time.reg) _sunrise_sunset_set_expiration(state, scratch_time);
 
@@ -117,16 +245,9 @@ static void _sunrise_sunset_face_update(movement_settings_t *settings, sunrise_s
             }
         }
 
-        minutes = 60.0 * fmod(set, 1);
-        seconds = 60.0 * fmod(minutes, 1);
-        scratch_time.unit.hour = floor(set);
-        if (seconds < 30) scratch_time.unit.minute = floor(minutes);
-        else scratch_time.unit.minute = ceil(minutes);
-
-        if (scratch_time.unit.minute == 60) {
-            scratch_time.unit.minute = 0;
-            scratch_time.unit.hour = (scratch_time.unit.hour + 1) % 24;
-        }
+        total_minutes = (int32_t)(((int64_t)set * 60 + 32768) >> 16);
+        scratch_time.unit.hour = (total_minutes / 60) % 24;
+        scratch_time.unit.minute = total_minutes % 60;
 
         if (date_time.reg < scratch_time.reg) _sunrise_sunset_set_expiration(state, scratch_time);
 
@@ -283,10 +404,10 @@ static void _sunrise_sunset_face_advance_digit(sunrise_sunset_state_t *state) {
 
 void sunrise_sunset_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(sunrise_sunset_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(sunrise_sunset_state_t));
         memset(*context_ptr, 0, sizeof(sunrise_sunset_state_t));
+        ((sunrise_sunset_state_t *)*context_ptr)->watch_face_index = watch_face_index;
     }
 }
 
@@ -322,6 +443,9 @@ bool sunrise_sunset_face_loop(movement_event_t event, movement_settings_t *setti
     switch (event.event_type) {
         case EVENT_ACTIVATE:
             _sunrise_sunset_face_update(settings, state);
+            if (state->signal_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
+            // make sure a wake is armed for the next event; harmless if one already is.
+            if (state->next_event.reg == 0) _sunrise_sunset_schedule_next_event(settings, state);
             break;
         case EVENT_LOW_ENERGY_UPDATE:
         case EVENT_TICK:
@@ -329,7 +453,7 @@ bool sunrise_sunset_face_loop(movement_event_t event, movement_settings_t *setti
                 // if entering low energy mode, start tick animation
                 if (event.event_type == EVENT_LOW_ENERGY_UPDATE && !watch_tick_animation_is_running()) watch_start_tick_animation(1000);
                 // check if we need to update the display
-                watch_date_time date_time = watch_rtc_get_date_time();
+                watch_date_time date_time = event.date_time;
                 if (date_time.reg >= state->rise_set_expires.reg) {
                     // and on the off chance that this happened before EVENT_TIMEOUT snapped us back to rise/set 0, go back now
                     state->rise_index = 0;
@@ -375,6 +499,38 @@ bool sunrise_sunset_face_loop(movement_event_t event, movement_settings_t *setti
                 _sunrise_sunset_face_update_settings_display(event, context);
             }
             break;
+        case EVENT_LIGHT_LONG_PRESS:
+            if (state->page == 0) {
+                state->signal_enabled = !state->signal_enabled;
+                if (state->signal_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
+                else watch_clear_indicator(WATCH_INDICATOR_BELL);
+            }
+            break;
+        case EVENT_BACKGROUND_TASK: {
+            // two kinds of wake land here: the daily midnight sweep that refreshes the
+            // ephemeris cache, and the wake we scheduled for the next rise/set event.
+            watch_date_time now = event.date_time;
+            if (state->next_event.reg && now.reg >= state->next_event.reg) {
+                state->next_event.reg = 0;
+                if (state->signal_enabled) {
+                    // the signal plays through the sequencer, which handles powering the
+                    // buzzer even when this fires in the background.
+                    movement_play_signal();
+                }
+            }
+            // prewarm the ephemeris cache for today and tomorrow (UTC), so the
+            // first activation of the day is a table read instead of a computation,
+            // then arm the wake for the next rise/set event.
+            movement_location_t movement_location = (movement_location_t) watch_get_backup_data(1);
+            sunriset_fix16_t rise, set;
+            uint32_t timestamp = watch_utility_date_time_to_unix_time(now, movement_timezone_offset(settings->bit.time_zone));
+            for (int i = 0; i < 2; i++) {
+                watch_date_time scratch_time = watch_utility_date_time_from_unix_time(timestamp + i * 86400, 0);
+                _sunrise_sunset_cached_rise_set(state, movement_location, scratch_time.unit.year + WATCH_RTC_REFERENCE_YEAR, scratch_time.unit.month, scratch_time.unit.day, &rise, &set);
+            }
+            _sunrise_sunset_schedule_next_event(settings, state);
+            break;
+        }
         case EVENT_TIMEOUT:
             if (watch_get_backup_data(1) == 0) {
                 // if no location set, return home
@@ -395,10 +551,21 @@ bool sunrise_sunset_face_loop(movement_event_t event, movement_settings_t *setti
 }
 
 void sunrise_sunset_face_resign(movement_settings_t *settings, void *context) {
-    (void) settings;
     sunrise_sunset_state_t *state = (sunrise_sunset_state_t *)context;
     state->page = 0;
     state->active_digit = 0;
     state->rise_index = 0;
+    bool location_changed = state->location_changed;
     _sunrise_sunset_face_update_location_register(state);
+    // a new location means a new event time; rearm the wake before we go to the background.
+    if (location_changed) _sunrise_sunset_schedule_next_event(settings, state);
+}
+
+bool sunrise_sunset_face_wants_background_task(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
+    // wake up once a day at local midnight to refresh the ephemeris cache.
+    watch_date_time date_time = watch_rtc_get_date_time();
+    if (date_time.unit.hour != 0 || date_time.unit.minute != 0) return false;
+    return watch_get_backup_data(1) != 0;
 }
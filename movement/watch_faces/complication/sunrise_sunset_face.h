@@ -28,6 +28,8 @@
 #include "movement.h"
 
 // The Sunrise/Sunset face is designed to display the next sunrise or sunset for a given location.
+// Long press the LIGHT button to toggle a chime at each rise/set event; the face schedules a
+// Movement wake for the next event, so the chime costs no polling and no per-minute wakeups.
 // TODO: It also functions as an interface for setting the location register, which other watch faces can use for various purposes.
 
 typedef struct {
@@ -43,23 +45,48 @@ typedef struct {
     uint8_t page;
     uint8_t rise_index;
     uint8_t active_digit;
+    uint8_t watch_face_index;
     bool location_changed;
+    bool signal_enabled;
     watch_date_time rise_set_expires;
+    // the rise/set event we have scheduled a Movement wake for, or 0 if none is armed.
+    watch_date_time next_event;
     sunrise_sunset_lat_lon_settings_t working_latitude;
     sunrise_sunset_lat_lon_settings_t working_longitude;
+    // cached ephemeris: rise/set times for the (at most) two dates the update
+    // loop can touch, so activations and scrolling serve from the cache instead
+    // of recomputing. keyed on the packed date and the location register; slot
+    // is day parity, so today and tomorrow never evict each other.
+    uint32_t ephemeris_date[2];
+    int32_t ephemeris_rise[2];
+    int32_t ephemeris_set[2];
+    uint8_t ephemeris_rc[2];
+    uint32_t ephemeris_location;
 } sunrise_sunset_state_t;
 
+/** @brief Computes a year of rise/set times for the stored location into "suntab.dat",
+  *        which the face then reads instead of computing. Invoked by the `suntable`
+  *        shell command; takes a few seconds. The table records the location and year
+  *        it was computed for, so it goes quietly stale (and the face falls back to
+  *        live computation) when either changes.
+  * @return false if no location is set or the filesystem write failed.
+  */
+bool sunrise_sunset_generate_table(void);
+
 void sunrise_sunset_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void sunrise_sunset_face_activate(movement_settings_t *settings, void *context);
 bool sunrise_sunset_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void sunrise_sunset_face_resign(movement_settings_t *settings, void *context);
+bool sunrise_sunset_face_wants_background_task(movement_settings_t *settings, void *context);
 
 #define sunrise_sunset_face ((const watch_face_t){ \
     sunrise_sunset_face_setup, \
     sunrise_sunset_face_activate, \
     sunrise_sunset_face_loop, \
     sunrise_sunset_face_resign, \
+    sunrise_sunset_face_wants_background_task, \
     NULL, \
+    .cpu_boost_on_activate = true, \
 })
 
 #endif // SUNRISE_SUNSET_FACE_H_
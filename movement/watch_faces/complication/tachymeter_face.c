@@ -27,6 +27,8 @@
 #include "tachymeter_face.h"
 #include "watch_utility.h"
 
+static int8_t _timer_channel = -1;
+
 static uint32_t _distance_from_struct(distance_digits_t dist_digits) {
     // distance from digitwise distance
     uint32_t retval = (dist_digits.thousands * 100000 +
@@ -42,13 +44,14 @@ void tachymeter_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
     (void)settings;
     (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tachymeter_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(tachymeter_state_t));
         memset(*context_ptr, 0, sizeof(tachymeter_state_t));
         tachymeter_state_t *state = (tachymeter_state_t *)*context_ptr;
         // Default distance
         state->dist_digits.ones = 1;
         state->distance = _distance_from_struct(state->dist_digits);
     }
+    if (_timer_channel < 0) _timer_channel = watch_fast_timer_claim();
 }
 
 void tachymeter_face_activate(movement_settings_t *settings, void *context) {
@@ -173,8 +176,8 @@ bool tachymeter_face_loop(movement_event_t event, movement_settings_t *settings,
                 if (!state->editing) {
                     // Start running
                     state->running = true;
-                    state->start_seconds = watch_rtc_get_date_time();
-                    state->start_subsecond = event.subsecond;
+                    watch_fast_timer_reset(_timer_channel);
+                    watch_fast_timer_start(_timer_channel);
                     state->total_time = 0;
                 } else {
                     // Alarm button to increase active digit
@@ -205,13 +208,12 @@ bool tachymeter_face_loop(movement_event_t event, movement_settings_t *settings,
                 }
                 // Stop running
                 state->running = false;
-                watch_date_time now = watch_rtc_get_date_time();
-                uint32_t now_timestamp = watch_utility_date_time_to_unix_time(now, 0);
-                uint32_t start_timestamp = watch_utility_date_time_to_unix_time(state->start_seconds, 0);
-                // Total time in centiseconds
-                state->total_time = ((now_timestamp*100) + (event.subsecond*25)) - ((start_timestamp*100) + (state->start_subsecond*25));
+                uint32_t timer_ticks = watch_fast_timer_get_ticks(_timer_channel);
+                watch_fast_timer_stop(_timer_channel);
+                // Total time in centiseconds: 100/128 = 25/32 of the 128 Hz tick count
+                state->total_time = (timer_ticks * 25) >> 5;
                 // Total speed in distance units per hour
-                state->total_speed = (uint32_t)(3600 * 100 * state->distance / state->total_time);
+                state->total_speed = watch_utility_fast_divide(3600 * 100 * state->distance, state->total_time);
             }
             break;
         case EVENT_ALARM_LONG_PRESS:
@@ -264,6 +266,10 @@ bool tachymeter_face_loop(movement_event_t event, movement_settings_t *settings,
 
 void tachymeter_face_resign(movement_settings_t *settings, void *context) {
     (void)settings;
-    (void)context;
-    // handle any cleanup before your watch face goes off-screen.
+    tachymeter_state_t *state = (tachymeter_state_t *)context;
+    // don't leave the timer channel counting if we resign mid-measurement.
+    if (state->running) {
+        watch_fast_timer_stop(_timer_channel);
+        state->running = false;
+    }
 }
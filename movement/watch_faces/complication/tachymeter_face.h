@@ -41,8 +41,6 @@ typedef struct {
     bool editing;                  // editing distance
     uint8_t active_digit;          // active digit at editing distance
     uint8_t animation_state;       // running animation state
-    watch_date_time start_seconds; // start_seconds
-    int8_t start_subsecond;        // start_subsecond count (each count = 250 ms)
     distance_digits_t dist_digits; // distance digitwise
     uint32_t distance;             // distance
     uint32_t total_time;           // total_time = now - start_time (in cs)
@@ -60,6 +58,7 @@ void tachymeter_face_resign(movement_settings_t *settings, void *context);
     tachymeter_face_loop, \
     tachymeter_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // TACHYMETER_FACE_H_
@@ -26,13 +26,26 @@
 #include <string.h>
 #include "tally_face.h"
 #include "watch.h"
+#include "filesystem.h"
+
+static void _tally_flush(tally_state_t *state) {
+    // write-behind: button presses only touch RAM, and the count is persisted here on the
+    // way out, so rapid tallying never pays the littlefs copy-on-write cost per press.
+    if (!state->dirty) return;
+    filesystem_write_file("tally.ini", (char *)&state->tally_idx, sizeof(state->tally_idx));
+    state->dirty = false;
+}
 
 void tally_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tally_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(tally_state_t));
         memset(*context_ptr, 0, sizeof(tally_state_t));
+        tally_state_t *state = (tally_state_t *)*context_ptr;
+        // restore a count persisted by a previous run (the size check guards against stale formats)
+        if (filesystem_get_file_size("tally.ini") == sizeof(state->tally_idx))
+            filesystem_read_file("tally.ini", (char *)&state->tally_idx, sizeof(state->tally_idx));
     }
 }
 
@@ -49,6 +62,7 @@ bool tally_face_loop(movement_event_t event, movement_settings_t *settings, void
         case EVENT_ALARM_BUTTON_UP:
             // increment tally index
             state->tally_idx++;
+            state->dirty = true;
             if (state->tally_idx > 999999) { //0-999,999
                 //reset tally index and play a reset tune
                 state->tally_idx = 0;
@@ -60,6 +74,7 @@ bool tally_face_loop(movement_event_t event, movement_settings_t *settings, void
             break;
         case EVENT_ALARM_LONG_PRESS:
             state->tally_idx = 0; // reset tally index
+            state->dirty = true;
             //play a reset tune
             watch_buzzer_play_note(BUZZER_NOTE_G6, 30);
             watch_buzzer_play_note(BUZZER_NOTE_REST, 30);
@@ -72,6 +87,11 @@ bool tally_face_loop(movement_event_t event, movement_settings_t *settings, void
         case EVENT_TIMEOUT:
             // ignore timeout
             break;
+        case EVENT_LOW_ENERGY_UPDATE:
+            // this face ignores the timeout and can sit on screen indefinitely, so entering
+            // low energy mode is our settle point: flush the count once, then stay clean.
+            _tally_flush(state);
+            break;
         default:
             movement_default_loop_handler(event, settings);
             break;
@@ -89,5 +109,5 @@ void print_tally(tally_state_t *state) {
 
 void tally_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
-    (void) context;
+    _tally_flush((tally_state_t *)context);
 }
@@ -33,6 +33,7 @@
 
 typedef struct {
     uint32_t tally_idx;
+    bool dirty; // the count has changed since it was last persisted to the filesystem
 } tally_state_t;
 
 
@@ -49,6 +50,7 @@ void print_tally(tally_state_t *state);
     tally_face_loop, \
     tally_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // TALLY_FACE_H_
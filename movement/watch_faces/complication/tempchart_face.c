@@ -41,6 +41,10 @@ struct {
     uint16_t num_div;
 } tempchart_state;
 
+// Running total of all bins, maintained incrementally as samples land so that rendering
+// doesn't have to re-sum the whole array. Not part of the ini file; rebuilt at setup.
+static uint32_t tempchart_total;
+
 static void tempchart_save(void) {
     filesystem_write_file("tempchart.ini", (char*)&tempchart_state, sizeof(tempchart_state));
 }
@@ -61,6 +65,10 @@ void tempchart_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     } else
         filesystem_read_file("tempchart.ini", (char*)&tempchart_state, sizeof(tempchart_state));
 
+    // one scan at boot; after this the total is maintained at insert time.
+    tempchart_total = 0;
+    for (int i = 0; i < 24 * 70; i++)
+        tempchart_total += tempchart_state.stat[i];
 }
 
 void tempchart_face_activate(movement_settings_t *settings, void *context) {
@@ -70,12 +78,8 @@ void tempchart_face_activate(movement_settings_t *settings, void *context) {
 }
 
 static void display(void) {
-    int sum = 0;
-    for (int i = 0; i < 24 * 70; i++)
-        sum += tempchart_state.stat[i];
-
     char buf[24];
-    sprintf(buf, "TS%2d%6d", tempchart_state.num_div, sum);
+    sprintf(buf, "TS%2d%6ld", tempchart_state.num_div, (long)tempchart_total);
     watch_display_string(buf, 0);
 }
 
@@ -109,17 +113,21 @@ bool tempchart_face_loop(movement_event_t event, movement_settings_t *settings,
             thermistor_driver_enable();
             float temperature_c = thermistor_driver_get_temperature();
             thermistor_driver_disable();
-            watch_date_time date_time = watch_rtc_get_date_time();
+            watch_date_time date_time = event.date_time;
 
             int temp = round(temperature_c * 2);
             if ((temp < 0) || (temp >= 70)) break;
 
             if (tempchart_state.stat[date_time.unit.hour + temp * 24] == 255) { // We've reached the limit
               tempchart_state.num_div++;
-              for (int i = 0; i < 24 * 70; i++)
+              tempchart_total = 0;
+              for (int i = 0; i < 24 * 70; i++) {
                 tempchart_state.stat[i] = (tempchart_state.stat[i] + 1) >> 1; // So that we don't lose 1
+                tempchart_total += tempchart_state.stat[i];
+              }
             }
             tempchart_state.stat[date_time.unit.hour+temp*24]++;
+            tempchart_total++;
 
             if (date_time.unit.hour == 0 && date_time.unit.minute == 10)
                 tempchart_save();
@@ -31,7 +31,7 @@ static uint8_t focus_min = 25;
 static uint8_t break_min = 5;
 
 static inline int32_t get_tz_offset(movement_settings_t *settings) {
-    return movement_timezone_offsets[settings->bit.time_zone] * 60;
+    return movement_timezone_offset(settings->bit.time_zone);
 }
 
 static uint8_t get_length(tomato_state_t *state) {
@@ -110,7 +110,7 @@ void tomato_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tomato_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(tomato_state_t));
         tomato_state_t *state = (tomato_state_t*)*context_ptr;
         memset(*context_ptr, 0, sizeof(tomato_state_t));
         state->mode=tomato_ready;
@@ -4,70 +4,56 @@
 #include "watch.h"
 #include "watch_utility.h"
 #include "TOTP.h"
+#include "totp_keys.h"
 
-// Use https://cryptii.com/pipes/base32-to-hex to convert base32 to hex
-// Use https://github.com/susam/mintotp to generate test codes for verification
-// Available algorothms:
-// SHA1 (most TOTP codes use this)
-// SHA224
-// SHA256
-// SHA384
-// SHA512
-
-////////////////////////////////////////////////////////////////////////////////
-// Enter your TOTP key data below
-static const uint8_t num_keys = 2;
-static uint8_t keys[] = {
-    0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x21, 0xde, 0xad, 0xbe, 0xef, // 1 - JBSWY3DPEHPK3PXP
-    0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x21, 0xde, 0xad, 0xbe, 0xef, // 2 - JBSWY3DPEHPK3PXP
-};
-static const uint8_t key_sizes[] = {
-    10,
-    10,
-};
-static const uint32_t timesteps[] = {
-    30,
-    30,
-};
-static const char labels[][2] = {
-    { '2', 'F' },
-    { 'A', 'C' },
-};
-static const hmac_alg algorithms[] = {
-    SHA1,
-    SHA1,
-};
-// END OF KEY DATA.
-////////////////////////////////////////////////////////////////////////////////
+// The key table lives in totp_keys.c, generated at build time from a
+// provisioning file of otpauth:// URIs by utils/gen_totp_keys.py — see
+// totp_keys.h for how to regenerate it with your own accounts. Use
+// https://github.com/susam/mintotp to generate test codes for verification.
 
 static void _update_display(totp_state_t *totp_state) {
     char buf[14];
     div_t result;
     uint8_t valid_for;
 
-    result = div(totp_state->timestamp, timesteps[totp_state->current_index]);
+    result = div(totp_state->timestamp, totp_timesteps[totp_state->current_index]);
     if (result.quot != totp_state->steps) {
-        totp_state->current_code = getCodeFromTimestamp(totp_state->timestamp);
+        // at the rollover, prefer the code precomputed last step; only fall back to
+        // computing it here if the lookahead is missing or stale.
+        if (totp_state->next_valid && totp_state->next_steps == (uint8_t)result.quot) {
+            totp_state->current_code = totp_state->next_code;
+        } else {
+            totp_state->current_code = getCodeFromTimestamp(totp_state->timestamp);
+        }
         totp_state->steps = result.quot;
+        totp_state->next_valid = false;
     }
-    valid_for = timesteps[totp_state->current_index] - result.rem;
-    sprintf(buf, "%c%c%2d%06lu", labels[totp_state->current_index][0], labels[totp_state->current_index][1], valid_for, totp_state->current_code);
+    valid_for = totp_timesteps[totp_state->current_index] - result.rem;
+    sprintf(buf, "%c%c%2d%06lu", totp_labels[totp_state->current_index][0], totp_labels[totp_state->current_index][1], valid_for, totp_state->current_code);
 
     watch_display_string(buf, 0);
+
+    // precompute the next window's code while the current one is on screen, so the
+    // SHA rounds happen now rather than as a visible hiccup at the 30-second boundary.
+    if (!totp_state->next_valid) {
+        totp_state->next_code = getCodeFromTimestamp(totp_state->timestamp + totp_timesteps[totp_state->current_index]);
+        totp_state->next_steps = (uint8_t)(result.quot + 1);
+        totp_state->next_valid = true;
+    }
 }
 
 void totp_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(totp_state_t));
+    if (*context_ptr == NULL) *context_ptr = movement_face_context_alloc(sizeof(totp_state_t));
 }
 
 void totp_face_activate(movement_settings_t *settings, void *context) {
     (void) settings;
     memset(context, 0, sizeof(totp_state_t));
     totp_state_t *totp_state = (totp_state_t *)context;
-    TOTP(keys, key_sizes[0], timesteps[0], algorithms[0]);
-    totp_state->timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), movement_timezone_offsets[settings->bit.time_zone] * 60);
+    TOTP((uint8_t *)totp_keys, totp_key_sizes[0], totp_timesteps[0], totp_algorithms[0]);
+    totp_state->timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), movement_timezone_offset(settings->bit.time_zone));
     totp_state->current_code = getCodeFromTimestamp(totp_state->timestamp);
 }
 
@@ -86,20 +72,29 @@ bool totp_face_loop(movement_event_t event, movement_settings_t *settings, void
             movement_move_to_face(0);
             break;
         case EVENT_ALARM_BUTTON_UP:
-            if (totp_state->current_index + 1 < num_keys) {
-                totp_state->current_key_offset += key_sizes[totp_state->current_index];
+            if (totp_state->current_index + 1 < totp_num_keys) {
+                totp_state->current_key_offset += totp_key_sizes[totp_state->current_index];
                 totp_state->current_index++;
             } else {
                 // wrap around to first key
                 totp_state->current_key_offset = 0;
                 totp_state->current_index = 0;
             }
-            TOTP(keys + totp_state->current_key_offset, key_sizes[totp_state->current_index], timesteps[totp_state->current_index], algorithms[totp_state->current_index]);
+            TOTP((uint8_t *)totp_keys + totp_state->current_key_offset, totp_key_sizes[totp_state->current_index], totp_timesteps[totp_state->current_index], totp_algorithms[totp_state->current_index]);
+            // the lookahead was computed with the previous key; discard it.
+            totp_state->next_valid = false;
             _update_display(totp_state);
             break;
         case EVENT_ALARM_BUTTON_DOWN:
-        case EVENT_ALARM_LONG_PRESS:
             break;
+        case EVENT_ALARM_LONG_PRESS: {
+            // with USB plugged in, a long press types the displayed code into the host
+            // through the HID keyboard — the whole burst is queued here in one shot.
+            char code[7];
+            sprintf(code, "%06lu", totp_state->current_code);
+            watch_usb_hid_type_string(code);
+            break;
+        }
         default:
             movement_default_loop_handler(event, settings);
             break;
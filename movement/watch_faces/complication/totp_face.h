@@ -7,6 +7,9 @@ typedef struct {
     uint32_t timestamp;
     uint8_t steps;
     uint32_t current_code;
+    uint32_t next_code;     // code for the following time step, precomputed ahead of the rollover
+    uint8_t next_steps;     // the time step next_code belongs to
+    bool next_valid;        // whether next_code is usable (cleared on key change)
     uint8_t current_index;
     uint8_t current_key_offset;
 } totp_state_t;
@@ -22,6 +25,7 @@ void totp_face_resign(movement_settings_t *settings, void *context);
     totp_face_loop, \
     totp_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // TOTP_FACE_H_
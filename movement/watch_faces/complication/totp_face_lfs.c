@@ -33,6 +33,14 @@
 #define MAX_TOTP_SECRET_SIZE 48
 #define TOTP_FILE "totp_uris.txt"
 
+// Once the URIs have been parsed successfully, the decoded records are compiled into
+// TOTP_CACHE_FILE so that subsequent boots skip the line-by-line parse and base32 decode
+// entirely. The cache records the size of totp_uris.txt it was compiled from; littlefs
+// keeps no modification times, so a size mismatch is our staleness signal and sends us
+// back to the text parse (which then rewrites the cache).
+#define TOTP_CACHE_FILE "totp_bin.dat"
+#define TOTP_CACHE_MAGIC 0x544F5401  // 'TOT' + cache format version
+
 const char* TOTP_URI_START = "otpauth://totp/";
 
 struct totp_record {
@@ -43,6 +51,20 @@ struct totp_record {
     hmac_alg algorithm;
 };
 
+struct totp_cache_header {
+    uint32_t magic;
+    int32_t source_size;
+    uint32_t num_records;
+};
+
+struct totp_cache_record {
+    uint8_t secret[MAX_TOTP_SECRET_SIZE];
+    uint8_t secret_size;
+    char label[2];
+    uint8_t algorithm;
+    uint32_t period;
+};
+
 static struct totp_record totp_records[MAX_TOTP_RECORDS];
 static int num_totp_records = 0;
 
@@ -67,6 +89,7 @@ static bool totp_face_lfs_read_param(struct totp_record *totp_record, char *para
             printf("TOTP secret too long: %s\n", value);
             return false;
         }
+        // note: not arena-allocated; this block is freed below if the secret fails to decode.
         totp_record->secret = malloc(UNBASE32_LEN(strlen(value)));
         totp_record->secret_size = base32_decode((unsigned char *)value, totp_record->secret);
         if (totp_record->secret_size == 0) {
@@ -114,14 +137,13 @@ static void totp_face_lfs_read_file(char *filename) {
     // For 'format' of file, see comment at top.
     const size_t uri_start_len = strlen(TOTP_URI_START);
 
-    if (!filesystem_file_exists(filename)) {
+    if (!filesystem_reader_open(filename)) {
         printf("TOTP file error: %s\n", filename);
         return;
     }
 
     char line[256];
-    int32_t offset = 0;
-    while (filesystem_read_line(filename, line, &offset, 255) && strlen(line)) {
+    while (filesystem_reader_read_line(line, 255) && strlen(line)) {
         if (num_totp_records == MAX_TOTP_RECORDS) {
             printf("TOTP max records: %d\n", MAX_TOTP_RECORDS);
             break;
@@ -164,18 +186,94 @@ static void totp_face_lfs_read_file(char *filename) {
             printf("TOTP missing secret: %s\n", line);
         }
     }
+
+    filesystem_reader_close();
+}
+
+static bool totp_face_lfs_load_cache(void) {
+    struct totp_cache_header header;
+    int32_t source_size = filesystem_get_file_size(TOTP_FILE);
+    int32_t cache_size = filesystem_get_file_size(TOTP_CACHE_FILE);
+
+    if (source_size <= 0) return false;
+    if (cache_size < (int32_t)sizeof(header)) return false;
+    if (!filesystem_read_file(TOTP_CACHE_FILE, (char *)&header, sizeof(header))) return false;
+    if (header.magic != TOTP_CACHE_MAGIC) return false;
+    if (header.source_size != source_size) return false;
+    if (header.num_records == 0 || header.num_records > MAX_TOTP_RECORDS) return false;
+    if (cache_size != (int32_t)(sizeof(header) + header.num_records * sizeof(struct totp_cache_record))) return false;
+
+    char *buf = malloc(cache_size);
+    if (buf == NULL) return false;
+    if (!filesystem_read_file(TOTP_CACHE_FILE, buf, cache_size)) {
+        free(buf);
+        return false;
+    }
+
+    struct totp_cache_record *records = (struct totp_cache_record *)(buf + sizeof(header));
+    for (uint32_t i = 0; i < header.num_records; i++) {
+        if (records[i].secret_size == 0 || records[i].secret_size > MAX_TOTP_SECRET_SIZE || records[i].period == 0) {
+            // corrupt record; throw the whole cache away and fall back to the text parse.
+            while (num_totp_records) free(totp_records[--num_totp_records].secret);
+            free(buf);
+            return false;
+        }
+        totp_records[i].secret = malloc(records[i].secret_size);
+        memcpy(totp_records[i].secret, records[i].secret, records[i].secret_size);
+        totp_records[i].secret_size = records[i].secret_size;
+        totp_records[i].label[0] = records[i].label[0];
+        totp_records[i].label[1] = records[i].label[1];
+        totp_records[i].period = records[i].period;
+        totp_records[i].algorithm = records[i].algorithm;
+        num_totp_records = i + 1;
+    }
+
+    free(buf);
+    return true;
+}
+
+static void totp_face_lfs_write_cache(void) {
+    if (num_totp_records == 0) return;
+
+    struct totp_cache_header header;
+    header.magic = TOTP_CACHE_MAGIC;
+    header.source_size = filesystem_get_file_size(TOTP_FILE);
+    header.num_records = num_totp_records;
+    if (!filesystem_write_file(TOTP_CACHE_FILE, (char *)&header, sizeof(header))) return;
+
+    for (int i = 0; i < num_totp_records; i++) {
+        struct totp_cache_record record;
+        memset(&record, 0, sizeof(record));
+        memcpy(record.secret, totp_records[i].secret, totp_records[i].secret_size);
+        record.secret_size = totp_records[i].secret_size;
+        record.label[0] = totp_records[i].label[0];
+        record.label[1] = totp_records[i].label[1];
+        record.algorithm = totp_records[i].algorithm;
+        record.period = totp_records[i].period;
+        if (!filesystem_append_file(TOTP_CACHE_FILE, (char *)&record, sizeof(record))) {
+            // don't leave a truncated cache behind; next boot just parses the text again.
+            filesystem_rm(TOTP_CACHE_FILE);
+            return;
+        }
+    }
+}
+
+static void totp_face_lfs_load_records(void) {
+    if (totp_face_lfs_load_cache()) return;
+    totp_face_lfs_read_file(TOTP_FILE);
+    totp_face_lfs_write_cache();
 }
 
 void totp_face_lfs_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(totp_lfs_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(totp_lfs_state_t));
     }
 
 #if !(__EMSCRIPTEN__)
     if (num_totp_records == 0) {
-        totp_face_lfs_read_file(TOTP_FILE);
+        totp_face_lfs_load_records();
     }
 #endif
 }
@@ -200,11 +298,11 @@ void totp_face_lfs_activate(movement_settings_t *settings, void *context) {
     if (num_totp_records == 0) {
         // Doing this here rather than in setup makes things a bit more pleasant in the simulator, since there's no easy way to trigger
         // setup again after uploading the data.
-        totp_face_lfs_read_file(TOTP_FILE);
+        totp_face_lfs_load_records();
     }
 #endif
 
-    totp_state->timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), movement_timezone_offsets[settings->bit.time_zone] * 60);
+    totp_state->timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), movement_timezone_offset(settings->bit.time_zone));
     totp_face_set_record(totp_state, 0);
 }
 
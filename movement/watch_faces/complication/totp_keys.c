@@ -0,0 +1,31 @@
+// Generated by utils/gen_totp_keys.py — do not edit.
+// Regenerate with: python3 utils/gen_totp_keys.py <totp_uris.txt> > movement/watch_faces/complication/totp_keys.c
+
+#include "totp_keys.h"
+
+const uint8_t totp_num_keys = 2;
+
+const uint8_t totp_keys[] = {
+    0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x21, 0xde, 0xad, 0xbe, 0xef, // 2F
+    0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x21, 0xde, 0xad, 0xbe, 0xef, // AC
+};
+
+const uint8_t totp_key_sizes[] = {
+    10,
+    10,
+};
+
+const uint32_t totp_timesteps[] = {
+    30,
+    30,
+};
+
+const char totp_labels[][2] = {
+    { '2', 'F' },
+    { 'A', 'C' },
+};
+
+const hmac_alg totp_algorithms[] = {
+    SHA1,
+    SHA1,
+};
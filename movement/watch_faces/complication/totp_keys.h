@@ -0,0 +1,24 @@
+#ifndef TOTP_KEYS_H_
+#define TOTP_KEYS_H_
+
+#include <stdint.h>
+#include "TOTP.h"
+
+// The static totp_face's key table, generated at build time from a provisioning
+// file of otpauth:// URIs (the same format totp_face_lfs reads from
+// totp_uris.txt) by utils/gen_totp_keys.py. Everything lives in flash as const
+// data, already base32-decoded — the face never parses or copies anything at
+// startup. To provision a watch, regenerate totp_keys.c:
+//
+//   python3 utils/gen_totp_keys.py totp_uris.txt > movement/watch_faces/complication/totp_keys.c
+//
+// This header is maintained by hand.
+
+extern const uint8_t totp_num_keys;
+extern const uint8_t totp_keys[];        // decoded key material, all keys concatenated
+extern const uint8_t totp_key_sizes[];   // decoded length of each key, in bytes
+extern const uint32_t totp_timesteps[];  // TOTP period of each key, in seconds
+extern const char totp_labels[][2];      // two-character display label of each key
+extern const hmac_alg totp_algorithms[]; // HMAC algorithm of each key
+
+#endif // TOTP_KEYS_H_
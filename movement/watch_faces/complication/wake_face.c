@@ -44,6 +44,26 @@
 // Private
 //
 
+// Hands the single wake time to movement's scheduled-task mechanism as an absolute
+// timestamp: today's occurrence if it hasn't passed yet, otherwise tomorrow's. Nothing
+// polls in between — movement wakes us at exactly the right minute. Runs whenever the
+// time or mode changes, after the alarm fires (to arm the next day), and on activation
+// so the task is rebuilt after a BACKUP wake restores the face context.
+static
+void _wake_face_schedule(wake_face_state_t *state) {
+    if ( !state->mode ) {
+        movement_cancel_background_task_for_face(state->watch_face_index);
+        return;
+    }
+    watch_date_time now = watch_rtc_get_date_time();
+    uint32_t now_ts = watch_utility_date_time_to_unix_time(now, 0);
+    uint32_t midnight_ts = now_ts - ((uint32_t)now.unit.hour * 3600 + (uint32_t)now.unit.minute * 60 + now.unit.second);
+    uint32_t wake_ts = midnight_ts + (uint32_t)state->hour * 3600 + (uint32_t)state->minute * 60;
+    if ( wake_ts <= now_ts )
+        wake_ts += 86400;
+    movement_schedule_background_task_for_face(state->watch_face_index, watch_utility_date_time_from_unix_time(wake_ts, 0));
+}
+
 static
 void _wake_face_update_display(movement_settings_t *settings, wake_face_state_t *state) {
     (void) settings;
@@ -74,47 +94,30 @@ void _wake_face_update_display(movement_settings_t *settings, wake_face_state_t
 
 void wake_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wake_face_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(wake_face_state_t));
         wake_face_state_t *state = (wake_face_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(wake_face_state_t));
 
         state->hour = 5;
         state->minute = 0;
         state->mode = 0;
+        state->watch_face_index = watch_face_index;
     }
 }
 
 void wake_face_activate(movement_settings_t *settings, void *context) {
     (void) settings;
-    (void) context;
+    wake_face_state_t *state = (wake_face_state_t *)context;
+    // scheduled tasks don't survive BACKUP mode; re-arming here is idempotent and heals that.
+    _wake_face_schedule(state);
 }
 void wake_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
 }
 
-bool wake_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    wake_face_state_t *state = (wake_face_state_t *)context;
-
-    bool rc = false;
-    if ( state->mode ) {
-        watch_date_time now = watch_rtc_get_date_time();
-        rc = state->hour==now.unit.hour && state->minute==now.unit.minute;
-        // We’re at the mercy of the wants_background_task handler
-        // In Safari, the emulator triggers at the ›end‹ of the minute
-        // Converting to Unix timestamps and taking a difference between now and wake
-        // is not an easy win — because the timestamp for wake has to rely on now
-        // for its date. So first we’d have to see if the TOD of wake is after that
-        // of now. If it is, take tomorrow’s date, calculating month and year rollover
-        // if need be.
-    }
-    return rc;
-}
-
 bool wake_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     (void) settings;
     wake_face_state_t *state = (wake_face_state_t *)context;
@@ -126,23 +129,29 @@ bool wake_face_loop(movement_event_t event, movement_settings_t *settings, void
         break;
     case EVENT_LIGHT_BUTTON_UP:
         state->hour = (state->hour + 1) % 24;
+        _wake_face_schedule(state);
         _wake_face_update_display(settings, state);
         break;
     case EVENT_LIGHT_LONG_PRESS:
         state->hour = (state->hour + 6) % 24;
+        _wake_face_schedule(state);
         _wake_face_update_display(settings, state);
         break;
     case EVENT_ALARM_BUTTON_UP:
         state->minute = (state->minute + 10) % 60;
+        _wake_face_schedule(state);
         _wake_face_update_display(settings, state);
         break;
     case EVENT_ALARM_LONG_PRESS:
         state->mode ^= 1;
+        _wake_face_schedule(state);
         _wake_face_update_display(settings, state);
         break;
     case EVENT_BACKGROUND_TASK:
         movement_play_alarm();
             // 2022-07-23: Thx @joeycastillo for the dedicated “alarm” signal
+        _wake_face_schedule(state);
+            // arm tomorrow's occurrence
         break;
     case EVENT_TIMEOUT:
         movement_move_to_face(0);
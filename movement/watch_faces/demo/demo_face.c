@@ -47,7 +47,7 @@ void demo_face_setup(movement_settings_t *settings, uint8_t watch_face_index, vo
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(demo_face_index_t));
+        *context_ptr = movement_face_context_alloc(sizeof(demo_face_index_t));
         memset(*context_ptr, 0, sizeof(demo_face_index_t));
     }
 }
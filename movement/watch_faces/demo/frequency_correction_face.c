@@ -73,7 +73,7 @@ void frequency_correction_face_setup(movement_settings_t *settings, uint8_t watc
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(frequency_correction_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(frequency_correction_state_t));
         frequency_correction_state_t *state = (frequency_correction_state_t *)*context_ptr;
         state->period_event_output = 0;
     }
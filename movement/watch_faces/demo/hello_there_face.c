@@ -35,7 +35,7 @@ void hello_there_face_setup(movement_settings_t *settings, uint8_t watch_face_in
     // At boot, context_ptr will be NULL indicating that we don't have anyplace to store our context.
     if (*context_ptr == NULL) {
         // in this case, we allocate an area of memory sufficient to store the stuff we need to track.
-        *context_ptr = malloc(sizeof(hello_there_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(hello_there_state_t));
     }
 }
 
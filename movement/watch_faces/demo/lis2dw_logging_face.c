@@ -115,7 +115,7 @@ void lis2dw_logging_face_setup(movement_settings_t *settings, uint8_t watch_face
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(lis2dw_logger_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(lis2dw_logger_state_t));
         memset(*context_ptr, 0, sizeof(lis2dw_logger_state_t));
         watch_enable_i2c();
         lis2dw_begin();
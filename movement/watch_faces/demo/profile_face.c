@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "profile_face.h"
+#include "watch.h"
+#include "sha1.h"
+#include "sunriset.h"
+
+void profile_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
+    (void) settings;
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(profile_state_t));
+        memset(*context_ptr, 0, sizeof(profile_state_t));
+    }
+}
+
+void profile_face_activate(movement_settings_t *settings, void *context) {
+    (void) settings;
+    profile_state_t *state = (profile_state_t *)context;
+    state->face_index = 0;
+    state->show_cycles = false;
+}
+
+static void _profile_face_update_display(profile_state_t *state) {
+#ifdef MOVEMENT_PROFILE
+    char buf[11];
+    const movement_face_profile_t *profile = movement_get_face_profile(state->face_index);
+    uint32_t value = state->show_cycles ? profile->active_cycles / 1000 : profile->wake_count;
+    if (value > 999999) value = 999999;
+    sprintf(buf, "PF%2d%6ld", state->face_index, (long)value);
+    watch_display_string(buf, 0);
+    if (state->show_cycles) watch_set_indicator(WATCH_INDICATOR_LAP);
+    else watch_clear_indicator(WATCH_INDICATOR_LAP);
+#else
+    (void) state;
+    watch_display_string("PF   OFF  ", 0);
+#endif
+}
+
+static void _profile_face_run_benchmarks(void) {
+    // reference sections spanning the three kinds of work faces do: pushing characters to
+    // the LCD, crunching a hash (the TOTP face's per-code cost), and floating point math
+    // (a full sunrise/sunset solve). Run before and after an optimization and diff the
+    // dump; results land on the console, cycles on hardware and nanoseconds in the sim.
+    WATCH_PROFILE("display_string", watch_display_string("BE10:42 35", 0));
+
+    uint8_t digest[SHA1_DIGEST_LENGTH];
+    WATCH_PROFILE("hmac_sha1", HMAC_SHA1((const uint8_t *)"12345678901234567890", 20,
+                                         (const uint8_t *)"\x00\x00\x00\x00\x02\x35\x23\xec", 8, digest));
+
+    double rise, set;
+    WATCH_PROFILE("sun_rise_set", sun_rise_set(2023, 6, 21, -73.98, 40.73, &rise, &set));
+
+    watch_profile_dump();
+}
+
+bool profile_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
+    profile_state_t *state = (profile_state_t *)context;
+
+    switch (event.event_type) {
+        case EVENT_ACTIVATE:
+        case EVENT_TICK:
+            _profile_face_update_display(state);
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+#ifdef MOVEMENT_PROFILE
+            state->face_index = (state->face_index + 1) % movement_get_num_faces();
+#endif
+            _profile_face_update_display(state);
+            break;
+        case EVENT_LIGHT_BUTTON_UP:
+            state->show_cycles = !state->show_cycles;
+            _profile_face_update_display(state);
+            break;
+        case EVENT_LIGHT_BUTTON_DOWN:
+            // don't illuminate the LED; the light button toggles the displayed counter here.
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            _profile_face_run_benchmarks();
+            _profile_face_update_display(state);
+            break;
+        case EVENT_TIMEOUT:
+            movement_move_to_face(0);
+            break;
+        default:
+            return movement_default_loop_handler(event, settings);
+    }
+
+    return true;
+}
+
+void profile_face_resign(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
+}
@@ -0,0 +1,58 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PROFILE_FACE_H_
+#define PROFILE_FACE_H_
+
+/*
+ * A debug face for firmware built with MOVEMENT_PROFILE=1. Pages through every compiled-in
+ * face with the ALARM button, showing its index and wake count; press LIGHT to toggle between
+ * wake count and cumulative active CPU cycles (shown in thousands). Long press ALARM to run
+ * the reference microbenchmarks from watch_profile.h (display write, HMAC-SHA1, sunriset)
+ * and dump the results to the console. In a build without MOVEMENT_PROFILE it just
+ * displays "PF   OFF".
+ */
+
+#include "movement.h"
+
+typedef struct {
+    uint8_t face_index;
+    bool show_cycles;
+} profile_state_t;
+
+void profile_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
+void profile_face_activate(movement_settings_t *settings, void *context);
+bool profile_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
+void profile_face_resign(movement_settings_t *settings, void *context);
+
+#define profile_face ((const watch_face_t){ \
+    profile_face_setup, \
+    profile_face_activate, \
+    profile_face_loop, \
+    profile_face_resign, \
+    NULL, \
+    NULL, \
+})
+
+#endif // PROFILE_FACE_H_
@@ -27,22 +27,28 @@
 #include "voltage_face.h"
 #include "watch.h"
 
-static void _voltage_face_update_display(void) {
-    char buf[14];
-
+static void _voltage_face_take_reading(voltage_state_t *state) {
+    // one spot check: watch_enable_adc configures a 16-sample hardware average, so a
+    // single conversion delivers a stable burst reading and the ADC goes right back off.
     watch_enable_adc();
-    float voltage = (float)watch_get_vcc_voltage() / 1000.0;
+    state->millivolts = watch_get_vcc_voltage();
     watch_disable_adc();
+}
+
+static void _voltage_face_update_display(voltage_state_t *state) {
+    char buf[14];
 
-    sprintf(buf, "BA  %4.2f V", voltage);
-    // printf("%s\n", buf);
+    sprintf(buf, "BA  %4.2f V", (float)state->millivolts / 1000.0);
     watch_display_string(buf, 0);
 }
 
 void voltage_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
-    (void) context_ptr;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(voltage_state_t));
+        memset(*context_ptr, 0, sizeof(voltage_state_t));
+    }
 }
 
 void voltage_face_activate(movement_settings_t *settings, void *context) {
@@ -52,20 +58,13 @@ void voltage_face_activate(movement_settings_t *settings, void *context) {
 
 bool voltage_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     (void) settings;
-    (void) context;
-    watch_date_time date_time;
+    voltage_state_t *state = (voltage_state_t *)context;
     switch (event.event_type) {
+        case EVENT_ALARM_BUTTON_UP:
+            // an explicit refresh; the tick never samples on its own.
         case EVENT_ACTIVATE:
-            _voltage_face_update_display();
-            break;
-        case EVENT_TICK:
-            date_time = watch_rtc_get_date_time();
-            if (date_time.unit.second % 5 == 4) {
-                watch_set_indicator(WATCH_INDICATOR_SIGNAL);
-            } else if (date_time.unit.second % 5 == 0) {
-                _voltage_face_update_display();
-                watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
-            }
+            _voltage_face_take_reading(state);
+            _voltage_face_update_display(state);
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
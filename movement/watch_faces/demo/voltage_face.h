@@ -27,6 +27,15 @@
 
 #include "movement.h"
 
+// Battery voltage spot check. The reading is one hardware-averaged ADC burst taken
+// when the face activates; press ALARM to take a fresh one. The ADC stays disabled
+// the rest of the time, so leaving this face up no longer drains the battery it's
+// supposed to be watching.
+
+typedef struct {
+    uint16_t millivolts;  // the cached burst reading the display shows
+} voltage_state_t;
+
 void voltage_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void voltage_face_activate(movement_settings_t *settings, void *context);
 bool voltage_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
@@ -38,6 +47,7 @@ void voltage_face_resign(movement_settings_t *settings, void *context);
     voltage_face_loop, \
     voltage_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // VOLTAGE_FACE_H_
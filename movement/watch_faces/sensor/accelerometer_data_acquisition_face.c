@@ -70,7 +70,7 @@ void accelerometer_data_acquisition_face_setup(movement_settings_t *settings, ui
     (void) watch_face_index;
     accelerometer_data_acquisition_state_t *state = (accelerometer_data_acquisition_state_t *)*context_ptr;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(accelerometer_data_acquisition_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(accelerometer_data_acquisition_state_t));
         memset(*context_ptr, 0, sizeof(accelerometer_data_acquisition_state_t));
         state = (accelerometer_data_acquisition_state_t *)*context_ptr;
         state->beep_with_countdown = true;
@@ -354,19 +354,9 @@ static int16_t get_next_available_page(void) {
 static void write_buffer_to_page(uint8_t *buf, uint16_t page) {
     uint32_t address = 256 * page;
 
-    wait_for_flash_ready();
-    watch_set_pin_level(A3, false);
-    spi_flash_command(CMD_ENABLE_WRITE);
-    wait_for_flash_ready();
-    watch_set_pin_level(A3, false);
-    spi_flash_write_data(address, buf, 256);
-    wait_for_flash_ready();
-
-    uint8_t buf2[256];
-    watch_set_pin_level(A3, false);
-    spi_flash_read_data(address, buf2, 256);
-    wait_for_flash_ready();
+    spi_flash_write_pages(address, buf, 256);
 
+    // work out the used-page bookkeeping while the data page programs.
     uint8_t used_pages[256] = {0xFF};
     uint16_t address_to_mark_used = page / 8;
     uint8_t header_page = address_to_mark_used / 256;
@@ -374,21 +364,19 @@ static void write_buffer_to_page(uint8_t *buf, uint16_t page) {
     uint8_t offset_in_buf = address_to_mark_used % 256;
 
     printf("\twrite 256 bytes to address %ld, page %d.\n", address, page);
+
+    spi_flash_wait_until_ready();
+    uint8_t buf2[256];
+    spi_flash_read_data(address, buf2, 256);
     for(int i = 0; i < 256; i++) {
         if (buf[i] != buf2[i]) {
             printf("\tData mismatch detected at offset  %d: %d != %d.\n", i, buf[i], buf2[i]);
         }
     }
 
-    watch_set_pin_level(A3, false);
     spi_flash_read_data(header_page * 256, used_pages, 256);
     used_pages[offset_in_buf] = used_byte;
-    watch_set_pin_level(A3, false);
-    spi_flash_command(CMD_ENABLE_WRITE);
-    wait_for_flash_ready();
-    watch_set_pin_level(A3, false);
-    spi_flash_write_data(header_page * 256, used_pages, 256);
-    wait_for_flash_ready();
+    spi_flash_write_pages(header_page * 256, used_pages, 256);
 }
 
 static bool wait_for_flash_ready(void) {
@@ -406,7 +394,8 @@ static bool wait_for_flash_ready(void) {
 static void write_page(accelerometer_data_acquisition_state_t *state) {
     if (state->next_available_page > 0) {
         write_buffer_to_page((uint8_t *)(state->records), state->next_available_page);
-        wait_for_flash_ready();
+        // don't wait for the header page program here; the next burst's buffer
+        // refill overlaps it, and every flash entry point waits as needed.
         state->next_available_page++;
     }
     state->pos = 0;
@@ -442,7 +431,7 @@ static void start_reading(accelerometer_data_acquisition_state_t *state, movemen
 
     accelerometer_data_acquisition_record_t record;
     watch_date_time date_time = watch_rtc_get_date_time();
-    state->starting_timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
+    state->starting_timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offset(settings->bit.time_zone));
     record.header.info.record_type = ACCELEROMETER_DATA_ACQUISITION_HEADER;
     record.header.info.range = ACCELEROMETER_RANGE;
     record.header.info.temperature = lis2dw_get_temperature();
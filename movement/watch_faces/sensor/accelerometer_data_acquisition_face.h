@@ -106,6 +106,8 @@ void accelerometer_data_acquisition_face_resign(movement_settings_t *settings, v
     accelerometer_data_acquisition_face_loop, \
     accelerometer_data_acquisition_face_resign, \
     NULL, \
+    NULL, \
+    .required_sensor = MOVEMENT_SENSOR_ACCELEROMETER, \
 })
 
 #endif // ACCELEROMETER_DATA_ACQUISITION_FACE_H_
@@ -0,0 +1,247 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ev_meter_face.h"
+#include "filesystem.h"
+#include "watch.h"
+#include "watch_utility.h"
+
+#define EV_METER_FILENAME "evlog.dat"
+#define EV_METER_RECORDS (48)
+
+typedef struct {
+    uint32_t timestamp;  // unix timestamp of the reading
+    uint16_t raw;        // the exponent/mantissa word as read from the sensor
+    int8_t ev2;          // computed EV in half stops
+    uint8_t ap_iso;      // (iso << 5) | aperture index at the time of the reading
+} ev_meter_record_t;
+
+// ISO compensation in half stops, matching the lightmeter face's float table.
+static const int8_t _ev_meter_iso_ev2[LIGHTMETER_N_ISOS] = {-4, -2, 0, 1, 2, 4, 6, 8};
+
+// fractional bits of log2 in Q8, indexed by the five mantissa bits below the leading one:
+// round(log2(1 + i/32) * 256).
+static const uint8_t _ev_meter_log2_frac[32] = {
+      0,  11,  22,  33,  44,  54,  63,  73,  82,  92, 100, 109, 118, 126, 134, 142,
+    150, 157, 165, 172, 179, 186, 193, 200, 207, 213, 220, 226, 232, 238, 244, 250,
+};
+
+// EV in half stops, straight from the result register. The format is already
+// log2-structured (lux = 0.01 * 2^E * M), so log2(lux) is the exponent plus the
+// mantissa's leading-one position plus one fraction table row, minus log2(100);
+// the calibration constant is the lightmeter face's 2.58 EV, in Q8.
+static int16_t _ev_meter_ev2_from_raw(opt3001_ER_t raw) {
+    uint16_t mantissa = raw.Result;
+    if (mantissa == 0) mantissa = 1;
+
+    uint8_t leading = 0;
+    for (uint16_t t = mantissa; t > 1; t >>= 1) leading++;
+    uint8_t frac_index = ((uint32_t)mantissa << (16 - leading) >> 11) & 0x1F;
+
+    int32_t ev_q8 = ((int32_t)raw.Exponent << 8) + ((int32_t)leading << 8)
+                  + _ev_meter_log2_frac[frac_index] - 1701 + 660;
+    int16_t ev2 = (int16_t)((ev_q8 * 2 + 128) >> 8);
+
+    if (ev2 > 99) ev2 = 99;
+    if (ev2 < -18) ev2 = -18;
+    return ev2;
+}
+
+// main line: best shutter speed for the compensated EV, plus the aperture. The
+// aperture rows are exactly half-stop spaced so the index is its own EV2, and the
+// shutter rows descend one half stop per index, so the best row is a single add.
+static void _ev_meter_show_exposure(int16_t ev2, uint8_t iso, uint8_t ap) {
+    int16_t comp_ev2 = ev2 + _ev_meter_iso_ev2[iso] - (int16_t)ap;
+    int16_t index = comp_ev2 + 12;
+    if (index >= LIGHTMETER_N_SHS) watch_display_string(lightmeter_shs[LIGHTMETER_SH_HIGH].str, 4);
+    else if (index < 2) watch_display_string(lightmeter_shs[LIGHTMETER_SH_LOW].str, 4);
+    else watch_display_string(lightmeter_shs[index].str, 4);
+    watch_display_string(lightmeter_aps[ap].str, 7);
+}
+
+static void _ev_meter_update_display(ev_meter_state_t *state) {
+    char buf[4];
+    watch_clear_all_indicators();
+    watch_clear_pixel(1, 9);
+    watch_display_string("EV        ", 0);
+    if (!state->have_reading) {
+        // no measurement yet: just the aperture, so the dial can be preset.
+        watch_display_string(lightmeter_aps[state->ap].str, 7);
+        return;
+    }
+    sprintf(buf, "%2d", abs(state->ev2 / 2));
+    watch_display_string(buf, 2);
+    if (state->ev2 & 1) watch_set_indicator(WATCH_INDICATOR_LAP); // half stop
+    if (state->ev2 < 0) watch_set_pixel(1, 9);                    // negative EV
+    _ev_meter_show_exposure(state->ev2, state->iso, state->ap);
+}
+
+static void _ev_meter_update_history(ev_meter_state_t *state) {
+    char buf[11];
+    watch_clear_all_indicators();
+    watch_clear_pixel(1, 9);
+
+    int16_t count = filesystem_ringlog_count(EV_METER_FILENAME);
+    if (count <= 0) {
+        watch_display_string("EL  no dat", 0);
+        return;
+    }
+    if (state->history_index >= count) state->history_index = count - 1;
+
+    ev_meter_record_t record;
+    if (!filesystem_ringlog_read(EV_METER_FILENAME, count - 1 - state->history_index, &record)) {
+        watch_display_string("EL  no dat", 0);
+        return;
+    }
+
+    // top right: how many readings back this is; main line: the logged exposure.
+    sprintf(buf, "EL%2d      ", state->history_index > 99 ? 99 : (int)state->history_index);
+    watch_display_string(buf, 0);
+    if (record.ev2 & 1) watch_set_indicator(WATCH_INDICATOR_LAP);
+    if (record.ev2 < 0) watch_set_pixel(1, 9);
+    _ev_meter_show_exposure(record.ev2, record.ap_iso >> 5, record.ap_iso & 0x1F);
+}
+
+static void _ev_meter_log_reading(ev_meter_state_t *state, opt3001_ER_t raw) {
+    ev_meter_record_t record;
+    record.timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    record.raw = raw.rawData;
+    record.ev2 = (int8_t)state->ev2;
+    record.ap_iso = ((uint8_t)state->iso << 5) | (uint8_t)state->ap;
+    filesystem_ringlog_append(EV_METER_FILENAME, &record);
+}
+
+void ev_meter_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
+    (void) settings;
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(ev_meter_state_t));
+        ev_meter_state_t *state = (ev_meter_state_t *)*context_ptr;
+        memset(state, 0, sizeof(ev_meter_state_t));
+        state->iso = LIGHTMETER_ISO_100;
+        state->ap = LIGHTMETER_AP_4P0;
+    }
+    filesystem_ringlog_create(EV_METER_FILENAME, sizeof(ev_meter_record_t), EV_METER_RECORDS);
+}
+
+void ev_meter_face_activate(movement_settings_t *settings, void *context) {
+    (void) settings;
+    ev_meter_state_t *state = (ev_meter_state_t *)context;
+    state->waiting_for_conversion = false;
+    state->history_page = false;
+    state->history_index = 0;
+    _ev_meter_update_display(state);
+    watch_enable_i2c();
+}
+
+bool ev_meter_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
+    ev_meter_state_t *state = (ev_meter_state_t *)context;
+
+    switch (event.event_type) {
+        case EVENT_TICK:
+            if (state->waiting_for_conversion) {
+                opt3001_Config_t c = opt3001_readConfig(lightmeter_addr);
+                if (c.ConversionReady) {
+                    state->waiting_for_conversion = false;
+                    opt3001_ER_t raw = opt3001_readRawResult(lightmeter_addr);
+                    state->ev2 = (int8_t)_ev_meter_ev2_from_raw(raw);
+                    state->have_reading = true;
+                    _ev_meter_log_reading(state, raw);
+                    _ev_meter_update_display(state);
+                } else {
+                    watch_set_indicator(WATCH_INDICATOR_SIGNAL);
+                    watch_display_string(lightmeter_isos[state->iso].str, 4); // show current ISO
+                }
+            }
+            break;
+
+        case EVENT_ALARM_BUTTON_UP:
+            if (state->history_page) {
+                // step back one exposure; past the oldest one, wrap around to the latest.
+                int16_t count = filesystem_ringlog_count(EV_METER_FILENAME);
+                if (count <= 0 || ++state->history_index >= count) state->history_index = 0;
+                _ev_meter_update_history(state);
+            } else {
+                state->ap = lightmeter_mod(state->ap + 1, LIGHTMETER_N_APS);
+                _ev_meter_update_display(state);
+            }
+            break;
+
+        case EVENT_LIGHT_BUTTON_UP:
+            if (state->history_page) {
+                if (state->history_index > 0) state->history_index--;
+                _ev_meter_update_history(state);
+            } else {
+                if (state->ap == 0) state->ap = LIGHTMETER_N_APS - 1;
+                else state->ap = lightmeter_mod(state->ap - 1, LIGHTMETER_N_APS);
+                _ev_meter_update_display(state);
+            }
+            break;
+
+        case EVENT_LIGHT_LONG_PRESS:
+            if (!state->history_page) {
+                state->iso = lightmeter_mod(state->iso + 1, LIGHTMETER_N_ISOS);
+                watch_display_string(lightmeter_isos[state->iso].str, 4);
+            }
+            break;
+
+        case EVENT_ALARM_LONG_PRESS:
+            if (!state->history_page) {
+                opt3001_writeConfig(lightmeter_addr, lightmeter_takeNewReading);
+                watch_set_indicator(WATCH_INDICATOR_SIGNAL);
+                state->waiting_for_conversion = true;
+                watch_display_string(lightmeter_isos[state->iso].str, 4);
+            }
+            break;
+
+        case EVENT_MODE_LONG_PRESS:
+            state->history_page = !state->history_page;
+            state->history_index = 0;
+            if (state->history_page) _ev_meter_update_history(state);
+            else _ev_meter_update_display(state);
+            break;
+
+        case EVENT_LIGHT_BUTTON_DOWN: // eat light on button down
+            break;
+
+        case EVENT_LIGHT_LONG_UP: // trigger light
+            movement_illuminate_led();
+            break;
+
+        default:
+            movement_default_loop_handler(event, settings);
+            break;
+    }
+    return true;
+}
+
+void ev_meter_face_resign(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
+    opt3001_writeConfig(lightmeter_addr, lightmeter_off);
+    watch_disable_i2c();
+}
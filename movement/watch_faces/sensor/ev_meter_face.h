@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef EV_METER_FACE_H_
+#define EV_METER_FACE_H_
+
+#include "movement.h"
+#include "lightmeter_face.h"
+
+/*
+ * EV METER FACE
+ *
+ * An integer-only take on the light meter, with a log of past exposures.
+ *
+ * The OPT3001's result register is already log2-structured: a 4-bit binary
+ * exponent and a 12-bit mantissa. The classic lightmeter face converts that
+ * to lux in floating point and then takes log2 to get back to EV; this face
+ * skips the round trip and computes EV in half stops straight from the raw
+ * register — the exponent contributes itself, the mantissa a leading-one
+ * position and one row of a 32-entry fraction table. The ISO, aperture and
+ * shutter scales are all half-stop spaced, so exposure math is small-integer
+ * addition from there. Display strings and the control scheme are shared
+ * with the lightmeter face:
+ *
+ *  - Long-press ALARM to take a measurement (SIGNAL indicator while the
+ *    sensor integrates). Each completed measurement is appended to a ring
+ *    log on the filesystem along with the ISO and aperture it was metered
+ *    at, so you can reconstruct a day's light after the fact.
+ *
+ *  - ALARM and LIGHT open and close the aperture in half stops; long-press
+ *    LIGHT cycles ISO.
+ *
+ *  - Long-press MODE to flip between the meter and the exposure log ("EL");
+ *    in the log, ALARM steps back through past exposures and LIGHT steps
+ *    forward again. The top right shows how many readings back you are.
+ */
+
+typedef struct {
+    lightmeter_iso_t iso;
+    lightmeter_ap_t ap;
+    bool waiting_for_conversion;
+    bool history_page;
+    bool have_reading;
+    int8_t ev2;             // last measured EV, in half stops
+    int16_t history_index;  // in the log: how many readings back from the latest
+} ev_meter_state_t;
+
+void ev_meter_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
+void ev_meter_face_activate(movement_settings_t *settings, void *context);
+bool ev_meter_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
+void ev_meter_face_resign(movement_settings_t *settings, void *context);
+
+#define ev_meter_face ((const watch_face_t){ \
+    ev_meter_face_setup, \
+    ev_meter_face_activate, \
+    ev_meter_face_loop, \
+    ev_meter_face_resign, \
+    NULL, \
+    NULL, \
+    .required_sensor = MOVEMENT_SENSOR_LIGHT, \
+})
+
+#endif // EV_METER_FACE_H_
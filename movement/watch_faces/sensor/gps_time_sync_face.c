@@ -0,0 +1,200 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "gps_time_sync_face.h"
+#include "watch_utility.h"
+#include "drift_correction.h"
+
+static void _gps_time_sync_update_display(gps_time_sync_state_t *state) {
+    if (state->synced) {
+        char buf[11];
+        int32_t correction = state->last_correction;
+        if (correction > 9999) correction = 9999;
+        if (correction < -9999) correction = -9999;
+        sprintf(buf, "GP  %c%4ld", correction < 0 ? '-' : ' ', labs(correction));
+        watch_display_string(buf, 0);
+        watch_set_indicator(WATCH_INDICATOR_SIGNAL);
+    } else {
+        watch_display_string("GP  LISTEN", 0);
+        watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
+    }
+}
+
+// A complete, checksummed RMC sentence with a valid fix: set the RTC from it.
+static void _gps_time_sync_apply(gps_time_sync_state_t *state, movement_settings_t *settings) {
+    watch_date_time utc;
+    utc.reg = 0;
+    utc.unit.hour = (state->time_digits[0] - '0') * 10 + (state->time_digits[1] - '0');
+    utc.unit.minute = (state->time_digits[2] - '0') * 10 + (state->time_digits[3] - '0');
+    utc.unit.second = (state->time_digits[4] - '0') * 10 + (state->time_digits[5] - '0');
+    utc.unit.day = (state->date_digits[0] - '0') * 10 + (state->date_digits[1] - '0');
+    utc.unit.month = (state->date_digits[2] - '0') * 10 + (state->date_digits[3] - '0');
+    uint8_t year = (state->date_digits[4] - '0') * 10 + (state->date_digits[5] - '0');
+    if (year < 20) return;  // before the watch epoch; a receiver without a fix on its almanac yet
+    utc.unit.year = year - 20;
+
+    uint32_t offset = movement_timezone_offset(settings->bit.time_zone);
+    uint32_t timestamp = watch_utility_date_time_to_unix_time(utc, 0);
+    uint32_t old_timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), offset);
+    watch_rtc_set_date_time(watch_utility_date_time_from_unix_time(timestamp, offset));
+
+    state->last_correction = (int32_t)(timestamp - old_timestamp);
+    state->synced = true;
+
+    // a GPS fix is a trusted time source: feed the drift engine so it can retune FREQCORR.
+    movement_drift_record_reference(timestamp, state->last_correction);
+}
+
+// Feed one byte to the sentence parser. Fields are consumed as they stream past: we keep
+// the hhmmss and ddmmyy digits and the status character, and XOR the running checksum,
+// but never buffer the sentence itself.
+static void _gps_time_sync_parse_byte(gps_time_sync_state_t *state, movement_settings_t *settings, uint8_t byte) {
+    static const char address[5] = {'G', 0, 'R', 'M', 'C'};  // 0 matches any talker: GPRMC, GNRMC...
+
+    if (byte == '$') {
+        // a new sentence resynchronizes the parser no matter what state it was in.
+        state->phase = GPS_NMEA_ADDRESS;
+        state->checksum = 0;
+        state->field = 0;
+        state->field_pos = 0;
+        state->status = 0;
+        memset(state->time_digits, 0, sizeof(state->time_digits));
+        memset(state->date_digits, 0, sizeof(state->date_digits));
+        return;
+    }
+
+    switch (state->phase) {
+        case GPS_NMEA_IDLE:
+            break;
+        case GPS_NMEA_ADDRESS:
+            state->checksum ^= byte;
+            if (byte == ',') {
+                if (state->field_pos == 5) {
+                    state->phase = GPS_NMEA_FIELDS;
+                    state->field = 1;
+                    state->field_pos = 0;
+                } else {
+                    state->phase = GPS_NMEA_IDLE;  // address too short
+                }
+            } else if (state->field_pos < 5 && (address[state->field_pos] == 0 || address[state->field_pos] == (char)byte)) {
+                state->field_pos++;
+            } else {
+                state->phase = GPS_NMEA_IDLE;  // some other sentence; wait for the next '$'
+            }
+            break;
+        case GPS_NMEA_FIELDS:
+            if (byte == '*') {
+                state->phase = GPS_NMEA_CHECKSUM_HI;
+                break;
+            }
+            state->checksum ^= byte;
+            if (byte == ',') {
+                state->field++;
+                state->field_pos = 0;
+            } else if (state->field == 1 && state->field_pos < 6) {
+                state->time_digits[state->field_pos++] = byte;  // hhmmss; fractional seconds ignored
+            } else if (state->field == 2 && state->field_pos == 0) {
+                state->status = byte;
+                state->field_pos++;
+            } else if (state->field == 9 && state->field_pos < 6) {
+                state->date_digits[state->field_pos++] = byte;  // ddmmyy
+            }
+            break;
+        case GPS_NMEA_CHECKSUM_HI:
+            if ((state->checksum >> 4) == (uint8_t)(byte <= '9' ? byte - '0' : (byte & ~0x20) - 'A' + 10)) {
+                state->phase = GPS_NMEA_CHECKSUM_LO;
+            } else {
+                state->phase = GPS_NMEA_IDLE;
+            }
+            break;
+        case GPS_NMEA_CHECKSUM_LO:
+            if ((state->checksum & 0xF) == (uint8_t)(byte <= '9' ? byte - '0' : (byte & ~0x20) - 'A' + 10) &&
+                state->status == 'A' && state->time_digits[5] && state->date_digits[5]) {
+                _gps_time_sync_apply(state, settings);
+            }
+            state->phase = GPS_NMEA_IDLE;
+            break;
+    }
+}
+
+void gps_time_sync_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
+    (void) settings;
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(gps_time_sync_state_t));
+        memset(*context_ptr, 0, sizeof(gps_time_sync_state_t));
+    }
+}
+
+void gps_time_sync_face_activate(movement_settings_t *settings, void *context) {
+    (void) settings;
+    gps_time_sync_state_t *state = (gps_time_sync_state_t *)context;
+    state->phase = GPS_NMEA_IDLE;
+    state->synced = false;
+    watch_enable_uart(0, A1, 9600);
+    // no watermark or callback; we drain the ring from the tick. A receiver that emits the
+    // full default sentence set sends under 250 bytes between 4 Hz ticks at 9600 baud, so
+    // the 256-byte ring never fills.
+    watch_uart_rx_enable(state->rx_ring, sizeof(state->rx_ring), 0, 0, NULL);
+    movement_request_tick_frequency(4);
+    _gps_time_sync_update_display(state);
+}
+
+bool gps_time_sync_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
+    gps_time_sync_state_t *state = (gps_time_sync_state_t *)context;
+    uint8_t chunk[32];
+    size_t count;
+
+    switch (event.event_type) {
+        case EVENT_TICK:
+            if (state->synced) break;
+            while ((count = watch_uart_read_async(chunk, sizeof(chunk))) > 0) {
+                for (size_t i = 0; i < count; i++) _gps_time_sync_parse_byte(state, settings, chunk[i]);
+            }
+            if (state->synced) _gps_time_sync_update_display(state);
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            // listen for another sync.
+            state->synced = false;
+            state->phase = GPS_NMEA_IDLE;
+            _gps_time_sync_update_display(state);
+            break;
+        case EVENT_TIMEOUT:
+            movement_move_to_face(0);
+            break;
+        default:
+            movement_default_loop_handler(event, settings);
+            break;
+    }
+    return true;
+}
+
+void gps_time_sync_face_resign(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
+    watch_uart_rx_disable();
+}
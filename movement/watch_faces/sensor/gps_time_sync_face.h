@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GPS_TIME_SYNC_FACE_H_
+#define GPS_TIME_SYNC_FACE_H_
+
+/*
+ * GPS Time Sync
+ *
+ * Sets the RTC from a GPS module wired to the nine-pin connector: module TX to pin A1,
+ * 9600 baud NMEA. While the face is active it listens for $GPRMC (any talker: $GNRMC
+ * works too), and on the first sentence with a valid fix and checksum it converts the
+ * UTC time and date to the configured time zone, writes the RTC, and displays the
+ * correction it applied in seconds. Long press ALARM to listen for another sync.
+ *
+ * Sentences are parsed in place as bytes drain from the UART ring buffer — a small
+ * state machine accumulates only the three fields it needs (time, status, date) and
+ * XORs the checksum as it goes, so a sentence costs no buffering or copying beyond
+ * the ring itself.
+ *
+ * Note that while this face is active the watch sleeps in IDLE rather than STANDBY
+ * so the UART can keep receiving; resign the face when you're done syncing.
+ */
+
+#include "movement.h"
+
+// waiting for '$' / matching "GxRMC" / walking the fields / reading the two checksum digits
+typedef enum {
+    GPS_NMEA_IDLE,
+    GPS_NMEA_ADDRESS,
+    GPS_NMEA_FIELDS,
+    GPS_NMEA_CHECKSUM_HI,
+    GPS_NMEA_CHECKSUM_LO,
+} gps_nmea_parse_phase_t;
+
+typedef struct {
+    // parser state; reset at each '$'
+    gps_nmea_parse_phase_t phase;
+    uint8_t checksum;       // running XOR of everything between '$' and '*'
+    uint8_t field;          // which comma-separated field we're in (0 = address)
+    uint8_t field_pos;      // position within the current field
+    char time_digits[6];    // hhmmss from field 1
+    char date_digits[6];    // ddmmyy from field 9
+    char status;            // 'A' = valid fix, from field 2
+    // face state
+    bool synced;
+    int32_t last_correction;
+    uint8_t rx_ring[256];
+} gps_time_sync_state_t;
+
+void gps_time_sync_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
+void gps_time_sync_face_activate(movement_settings_t *settings, void *context);
+bool gps_time_sync_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
+void gps_time_sync_face_resign(movement_settings_t *settings, void *context);
+
+#define gps_time_sync_face ((const watch_face_t){ \
+    gps_time_sync_face_setup, \
+    gps_time_sync_face_activate, \
+    gps_time_sync_face_loop, \
+    gps_time_sync_face_resign, \
+    NULL, \
+    NULL, \
+})
+
+#endif // GPS_TIME_SYNC_FACE_H_
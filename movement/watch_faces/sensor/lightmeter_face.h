@@ -180,6 +180,8 @@ static const uint8_t lightmeter_addr = 0x44;
     lightmeter_face_loop, \
     lightmeter_face_resign, \
     NULL, \
+    NULL, \
+    .required_sensor = MOVEMENT_SENSOR_LIGHT, \
 })
 
 #endif // LIGHTMETER_FACE_H_
@@ -0,0 +1,178 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "sleep_face.h"
+#include "filesystem.h"
+#include "watch.h"
+#include "watch_utility.h"
+
+#define SLEEP_FACE_LOG_FILENAME "sleep.dat"
+#define SLEEP_FACE_LOG_RECORDS 80       // 15 epochs each: ten hours before the ring wraps
+#define SLEEP_FACE_RESTLESS_THRESHOLD 60 // activity byte a sleeping wrist stays well under, empirical
+
+typedef struct {
+    uint32_t timestamp;  // when the last epoch in this record closed
+    step_count_epoch_t epochs[SLEEP_FACE_EPOCHS_PER_RECORD];
+} sleep_face_log_record_t;
+
+static void _sleep_face_flush_record(sleep_state_t *state) {
+    sleep_face_log_record_t record;
+    memset(&record, 0, sizeof(record));
+    record.timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    memcpy(record.epochs, state->pending, state->pending_count * sizeof(step_count_epoch_t));
+    filesystem_ringlog_append(SLEEP_FACE_LOG_FILENAME, &record);
+    state->pending_count = 0;
+}
+
+static void _sleep_face_drain(sleep_state_t *state) {
+    step_count_epoch_t batch[8];
+    uint8_t count;
+    while ((count = step_count_epochs_read(batch, sizeof(batch) / sizeof(batch[0]))) != 0) {
+        for (uint8_t i = 0; i < count; i++) {
+            state->epochs_total++;
+            state->activity_sum += batch[i].activity;
+            if (batch[i].activity >= SLEEP_FACE_RESTLESS_THRESHOLD) state->epochs_restless++;
+            state->pending[state->pending_count++] = batch[i];
+            if (state->pending_count == SLEEP_FACE_EPOCHS_PER_RECORD) _sleep_face_flush_record(state);
+        }
+    }
+}
+
+static void _sleep_face_update_display(sleep_state_t *state) {
+    char buf[14];
+
+    if (state->tracking) watch_set_indicator(WATCH_INDICATOR_SIGNAL);
+    else watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
+
+    switch (state->page) {
+        case 0: {
+            // while armed, the duration runs live off the clock; once stopped, it
+            // settles to the finished epochs that actually made the log.
+            uint32_t minutes;
+            if (state->tracking) {
+                uint32_t now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+                minutes = (now - state->night_start) / 60;
+            } else {
+                minutes = (uint32_t)state->epochs_total / 2;
+            }
+            watch_set_colon();
+            sprintf(buf, "SL  %2lu%02lu  ", (unsigned long)(minutes / 60), (unsigned long)(minutes % 60));
+            break;
+        }
+        case 1:
+            watch_clear_colon();
+            sprintf(buf, "SL 1%6u", state->epochs_restless);
+            break;
+        default: {
+            uint32_t percent = state->epochs_total ?
+                (uint32_t)state->epochs_restless * 100 / state->epochs_total : 0;
+            watch_clear_colon();
+            sprintf(buf, "SL 2   %3lu", (unsigned long)percent);
+            break;
+        }
+    }
+
+    watch_display_string(buf, 0);
+}
+
+static void _sleep_face_toggle_tracking(sleep_state_t *state) {
+    if (state->tracking) {
+        step_count_epochs_enable(false);
+        _sleep_face_drain(state);
+        // a short partial record closes the night; its unused slots stay zero.
+        if (state->pending_count) _sleep_face_flush_record(state);
+        state->tracking = false;
+        // the step engine keeps running for the daily count; only the epochs stop.
+    } else if (step_count_begin()) {
+        state->night_start = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+        state->epochs_total = 0;
+        state->epochs_restless = 0;
+        state->activity_sum = 0;
+        state->pending_count = 0;
+        step_count_epochs_enable(true);
+        state->tracking = true;
+    }
+}
+
+void sleep_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
+    (void) settings;
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(sleep_state_t));
+        memset(*context_ptr, 0, sizeof(sleep_state_t));
+    }
+    filesystem_ringlog_create(SLEEP_FACE_LOG_FILENAME, sizeof(sleep_face_log_record_t), SLEEP_FACE_LOG_RECORDS);
+}
+
+void sleep_face_activate(movement_settings_t *settings, void *context) {
+    (void) settings;
+    sleep_state_t *state = (sleep_state_t *)context;
+    state->page = 0;
+}
+
+bool sleep_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
+    sleep_state_t *state = (sleep_state_t *)context;
+    switch (event.event_type) {
+        case EVENT_ALARM_BUTTON_UP:
+            state->page = (state->page + 1) % 3;
+            // fall through
+        case EVENT_ACTIVATE:
+            _sleep_face_update_display(state);
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            _sleep_face_toggle_tracking(state);
+            _sleep_face_update_display(state);
+            break;
+        case EVENT_TICK:
+        case EVENT_LOW_ENERGY_UPDATE:
+            if (state->page == 0 && state->tracking) _sleep_face_update_display(state);
+            break;
+        case EVENT_BACKGROUND_TASK:
+            _sleep_face_drain(state);
+            break;
+        case EVENT_TIMEOUT:
+            movement_move_to_face(0);
+            break;
+        default:
+            movement_default_loop_handler(event, settings);
+            break;
+    }
+
+    return true;
+}
+
+void sleep_face_resign(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
+    // tracking carries on in the background until the wearer disarms it.
+}
+
+bool sleep_face_wants_background_task(movement_settings_t *settings, void *context) {
+    (void) settings;
+    // drain the epoch ring minutely while armed; it holds eight minutes, so even a
+    // missed minute or two costs nothing.
+    return ((sleep_state_t *)context)->tracking;
+}
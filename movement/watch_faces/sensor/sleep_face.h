@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SLEEP_FACE_H_
+#define SLEEP_FACE_H_
+
+#include "movement.h"
+#include "step_count.h"
+
+/*
+ * SLEEP FACE
+ *
+ * Overnight sleep tracking on the LIS2DW, for boards with the accelerometer.
+ * Continuous capture would eat the battery over a night, so this rides on
+ * the step counter's epoch aggregation instead: the same FIFO-drain interrupt
+ * that detects steps also folds each 30-second epoch down to a zero-crossing
+ * count and a magnitude sum, two bytes per epoch — no extra wakes, and the
+ * watch can spend the whole night in low energy mode.
+ *
+ * Long press ALARM to arm tracking at bedtime ("SIGNAL" stays on while armed)
+ * and again on waking to stop. While armed, a minutely background task drains
+ * finished epochs and chunks them into a ring log on the filesystem, fifteen
+ * epochs to a timestamped record, about ten hours deep — a night costs around
+ * 2.5 KB and the ring overwrites itself, so the log never grows. Pull the raw
+ * epochs over USB with "cat sleep.dat" for analysis off the watch.
+ *
+ * On screen: the tracked duration, and on further ALARM presses the number of
+ * restless epochs (page 1) and the restless percentage (page 2). An epoch
+ * counts as restless when its activity byte clears a threshold a sleeping
+ * wrist stays well under.
+ */
+
+#define SLEEP_FACE_EPOCHS_PER_RECORD 15
+
+typedef struct {
+    bool tracking;
+    uint8_t page;              // 0 = duration, 1 = restless epochs, 2 = restless percent
+    uint32_t night_start;      // unix timestamp when tracking was armed
+    uint16_t epochs_total;
+    uint16_t epochs_restless;
+    uint32_t activity_sum;
+    step_count_epoch_t pending[SLEEP_FACE_EPOCHS_PER_RECORD];
+    uint8_t pending_count;
+} sleep_state_t;
+
+void sleep_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
+void sleep_face_activate(movement_settings_t *settings, void *context);
+bool sleep_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
+void sleep_face_resign(movement_settings_t *settings, void *context);
+bool sleep_face_wants_background_task(movement_settings_t *settings, void *context);
+
+#define sleep_face ((const watch_face_t){ \
+    sleep_face_setup, \
+    sleep_face_activate, \
+    sleep_face_loop, \
+    sleep_face_resign, \
+    sleep_face_wants_background_task, \
+    NULL, \
+    .required_sensor = MOVEMENT_SENSOR_ACCELEROMETER, \
+})
+
+#endif // SLEEP_FACE_H_
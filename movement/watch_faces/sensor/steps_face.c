@@ -0,0 +1,195 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "steps_face.h"
+#include "step_count.h"
+#include "filesystem.h"
+#include "watch.h"
+#include "watch_utility.h"
+#include "watch_character_remap.h"
+
+#define STEPS_FACE_LOG_FILENAME "steps.dat"
+#define STEPS_FACE_LOG_DAYS 30
+
+// the "ST" title renders in the weekday digits; fail the build if it ever falls back.
+_Static_assert(WATCH_CHAR_RENDERS_EXACTLY('S', 0) && WATCH_CHAR_RENDERS_EXACTLY('T', 1),
+               "steps_face title cannot render at positions 0-1");
+
+typedef struct {
+    uint32_t timestamp;  // noon of the logged day, UTC-naive like the RTC itself
+    uint32_t steps;
+} steps_face_log_record_t;
+
+static uint32_t _steps_face_total(steps_state_t *state) {
+    return state->base + step_count_steps();
+}
+
+// the backup register holds the running total (24 bits, plenty) plus the day of month
+// and the low bits of the month it belongs to, so a stale total from last week isn't
+// mistaken for today's after a trip through BACKUP mode.
+static uint32_t _steps_face_pack(uint32_t steps, uint8_t day, uint8_t month) {
+    if (steps > 0xFFFFFF) steps = 0xFFFFFF;
+    return steps | ((uint32_t)(day & 0x1F) << 24) | ((uint32_t)(month & 0x7) << 29);
+}
+
+static void _steps_face_sync(steps_state_t *state) {
+    watch_date_time now = watch_rtc_get_date_time();
+
+    if (now.unit.day != state->day || now.unit.month != state->month) {
+        // midnight passed: log the finished day and start the new one at zero.
+        watch_date_time finished = now;
+        finished.unit.day = state->day;
+        finished.unit.month = state->month;
+        finished.unit.hour = 12;
+        finished.unit.minute = 0;
+        finished.unit.second = 0;
+        if (state->month == 12 && now.unit.month == 1 && finished.unit.year) finished.unit.year--;
+
+        steps_face_log_record_t record;
+        record.timestamp = watch_utility_date_time_to_unix_time(finished, 0);
+        record.steps = _steps_face_total(state);
+        filesystem_ringlog_append(STEPS_FACE_LOG_FILENAME, &record);
+
+        state->base = 0;
+        step_count_reset();
+        state->day = now.unit.day;
+        state->month = now.unit.month;
+    }
+
+    if (state->backup_register) {
+        watch_store_backup_data(_steps_face_pack(_steps_face_total(state), state->day, state->month),
+                                state->backup_register);
+    }
+}
+
+static void _steps_face_update_display(steps_state_t *state) {
+    char buf[14];
+
+    if (state->history_index == 0) {
+        uint32_t total = _steps_face_total(state);
+        if (total > 999999) total = 999999;
+        sprintf(buf, "ST  %6lu", (unsigned long)total);
+    } else {
+        int16_t count = filesystem_ringlog_count(STEPS_FACE_LOG_FILENAME);
+        steps_face_log_record_t record;
+        if (count >= state->history_index &&
+            filesystem_ringlog_read(STEPS_FACE_LOG_FILENAME, count - state->history_index, &record)) {
+            uint32_t steps = record.steps;
+            if (steps > 999999) steps = 999999;
+            sprintf(buf, "ST%2u%6lu", state->history_index, (unsigned long)steps);
+        } else {
+            sprintf(buf, "ST%2uno dat", state->history_index);
+        }
+    }
+
+    watch_display_string(buf, 0);
+}
+
+void steps_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
+    (void) settings;
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(steps_state_t));
+        memset(*context_ptr, 0, sizeof(steps_state_t));
+        ((steps_state_t *)*context_ptr)->backup_register = movement_claim_backup_register();
+    }
+    steps_state_t *state = (steps_state_t *)*context_ptr;
+
+    // after any reset the engine counter starts over at zero, so re-derive today's
+    // base from the backup register: if the stored total is from today, carry it.
+    watch_date_time now = watch_rtc_get_date_time();
+    uint32_t packed = state->backup_register ? watch_get_backup_data(state->backup_register) : 0;
+    if (((packed >> 24) & 0x1F) == now.unit.day && ((packed >> 29) & 0x7) == (now.unit.month & 0x7)) {
+        state->base = packed & 0xFFFFFF;
+    } else {
+        state->base = 0;
+    }
+    state->day = now.unit.day;
+    state->month = now.unit.month;
+
+    filesystem_ringlog_create(STEPS_FACE_LOG_FILENAME, sizeof(steps_face_log_record_t), STEPS_FACE_LOG_DAYS);
+    step_count_begin();
+}
+
+void steps_face_activate(movement_settings_t *settings, void *context) {
+    (void) settings;
+    steps_state_t *state = (steps_state_t *)context;
+    state->history_index = 0;
+}
+
+bool steps_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
+    steps_state_t *state = (steps_state_t *)context;
+    switch (event.event_type) {
+        case EVENT_ALARM_BUTTON_DOWN: {
+            int16_t count = filesystem_ringlog_count(STEPS_FACE_LOG_FILENAME);
+            if (count < 0) count = 0;
+            state->history_index = (state->history_index + 1) % (count + 1);
+        }
+            // fall through
+        case EVENT_ACTIVATE:
+            _steps_face_update_display(state);
+            break;
+        case EVENT_TICK:
+        case EVENT_LOW_ENERGY_UPDATE:
+            // the engine only advances when the watermark drains, about once a second;
+            // refreshing on the tick is enough to watch the count climb.
+            if (state->history_index == 0) _steps_face_update_display(state);
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            if (state->history_index == 0) {
+                state->base = 0;
+                step_count_reset();
+                _steps_face_sync(state);
+                _steps_face_update_display(state);
+            }
+            break;
+        case EVENT_BACKGROUND_TASK:
+            _steps_face_sync(state);
+            break;
+        case EVENT_TIMEOUT:
+            movement_move_to_face(0);
+            break;
+        default:
+            movement_default_loop_handler(event, settings);
+            break;
+    }
+
+    return true;
+}
+
+void steps_face_resign(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
+    // the engine keeps counting in the background; nothing to wind down.
+}
+
+bool steps_face_wants_background_task(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
+    // sync the running total minutely: the backup register mirror stays fresh and the
+    // midnight rollover gets noticed within a minute of happening.
+    return step_count_is_active();
+}
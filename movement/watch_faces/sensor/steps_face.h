@@ -0,0 +1,76 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STEPS_FACE_H_
+#define STEPS_FACE_H_
+
+#include "movement.h"
+
+/*
+ * STEPS FACE
+ *
+ * Daily step counts from the LIS2DW, for boards with the accelerometer fitted.
+ * The counting itself lives in the step_count driver: the sensor samples at
+ * 25 Hz into its FIFO while the MCU sleeps, and a watermark interrupt on A4
+ * wakes us about once a second to run the detection kernel over the batch.
+ * The engine starts the first time this face is activated and keeps counting
+ * in the background from then on, whatever face is on screen.
+ *
+ * The face shows today's total ("ST" in the title). Pressing ALARM steps back
+ * through the daily history ("ST 1" is yesterday, and so on); pressing it past
+ * the oldest day wraps back to today. A long press on ALARM zeroes today's
+ * count.
+ *
+ * At midnight (noticed by the minutely background task) the finished day is
+ * appended to a ring log on the filesystem and the counter starts over. The
+ * running total is also mirrored into a backup register every minute, so it
+ * survives a trip through BACKUP mode; counting is suspended while the watch
+ * is in BACKUP mode, since the accelerometer's interrupt can't wake us there.
+ */
+
+typedef struct {
+    uint8_t backup_register;  // running total and its date, packed; survives BACKUP mode
+    uint32_t base;            // steps carried into today from before the last engine reset
+    uint8_t day;              // date the running total belongs to
+    uint8_t month;
+    uint8_t history_index;    // 0 = today, 1 = yesterday, ...
+} steps_state_t;
+
+void steps_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
+void steps_face_activate(movement_settings_t *settings, void *context);
+bool steps_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
+void steps_face_resign(movement_settings_t *settings, void *context);
+bool steps_face_wants_background_task(movement_settings_t *settings, void *context);
+
+#define steps_face ((const watch_face_t){ \
+    steps_face_setup, \
+    steps_face_activate, \
+    steps_face_loop, \
+    steps_face_resign, \
+    steps_face_wants_background_task, \
+    NULL, \
+    .required_sensor = MOVEMENT_SENSOR_ACCELEROMETER, \
+})
+
+#endif // STEPS_FACE_H_
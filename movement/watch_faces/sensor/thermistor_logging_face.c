@@ -26,32 +26,94 @@
 #include <string.h>
 #include "thermistor_logging_face.h"
 #include "thermistor_driver.h"
+#include "filesystem.h"
 #include "watch.h"
+#include "watch_utility.h"
+
+#define THERMISTOR_LOGGING_FILENAME "temp.dat"
+#define THERMISTOR_LOGGING_RECORDS (28)     // 6 hours each: a full week before the ring wraps
+#define THERMISTOR_LOGGING_INTERVAL (900)   // seconds between readings
+
+// a record is six hours of readings: the first one absolute, the rest as deltas in
+// tenths of a degree. ±12.7° in 15 minutes is a wider swing than even a wrist-to-
+// windowsill transition; anything wider clips.
+typedef struct {
+    uint32_t timestamp;  // unix timestamp of the first reading in this record
+    int16_t base_deci;
+    int8_t deltas[THERMISTOR_LOGGING_POINTS_PER_RECORD - 1];
+} thermistor_logger_record_t;
+
+static void _thermistor_logging_face_flush(thermistor_logger_state_t *logger_state) {
+    thermistor_logger_record_t record;
+    record.timestamp = logger_state->pending_timestamp;
+    record.base_deci = logger_state->pending_deci[0];
+    for (uint8_t i = 1; i < THERMISTOR_LOGGING_POINTS_PER_RECORD; i++) {
+        int32_t delta = logger_state->pending_deci[i] - logger_state->pending_deci[i - 1];
+        if (delta > 127) delta = 127;
+        if (delta < -128) delta = -128;
+        record.deltas[i - 1] = delta;
+    }
+    filesystem_ringlog_append(THERMISTOR_LOGGING_FILENAME, &record);
+    logger_state->pending_count = 0;
+}
 
 static void _thermistor_logging_face_log_data(thermistor_logger_state_t *logger_state) {
     thermistor_driver_enable();
-    watch_date_time date_time = watch_rtc_get_date_time();
-    size_t pos = logger_state->data_points % THERMISTOR_LOGGING_NUM_DATA_POINTS;
+    float temperature_c = thermistor_driver_get_temperature();
+    thermistor_driver_disable();
+
+    if (logger_state->pending_count == 0) {
+        logger_state->pending_timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    }
+    logger_state->pending_deci[logger_state->pending_count++] = (int16_t)(temperature_c * 10.0);
+    if (logger_state->pending_count == THERMISTOR_LOGGING_POINTS_PER_RECORD) {
+        _thermistor_logging_face_flush(logger_state);
+    }
+}
 
-    logger_state->data[pos].timestamp.reg = date_time.reg;
-    logger_state->data[pos].temperature_c = thermistor_driver_get_temperature();
-    logger_state->data_points++;
+// fetches the reading `index` steps back from the most recent one: out of the in-RAM
+// pending record if it's recent enough, otherwise by reading one record back from the
+// log on demand and walking its deltas.
+static bool _thermistor_logging_face_read_point(thermistor_logger_state_t *logger_state, uint16_t index,
+                                                int16_t *deci, uint32_t *timestamp) {
+    if (index < logger_state->pending_count) {
+        uint8_t pos = logger_state->pending_count - 1 - index;
+        *deci = logger_state->pending_deci[pos];
+        *timestamp = logger_state->pending_timestamp + (uint32_t)pos * THERMISTOR_LOGGING_INTERVAL;
+        return true;
+    }
+    index -= logger_state->pending_count;
 
-    thermistor_driver_disable();
+    int16_t count = filesystem_ringlog_count(THERMISTOR_LOGGING_FILENAME);
+    uint16_t records_back = index / THERMISTOR_LOGGING_POINTS_PER_RECORD;
+    if (count <= 0 || records_back >= (uint16_t)count) return false;
+
+    thermistor_logger_record_t record;
+    if (!filesystem_ringlog_read(THERMISTOR_LOGGING_FILENAME, count - 1 - records_back, &record)) return false;
+
+    uint8_t pos = (THERMISTOR_LOGGING_POINTS_PER_RECORD - 1) - index % THERMISTOR_LOGGING_POINTS_PER_RECORD;
+    int16_t value = record.base_deci;
+    for (uint8_t i = 0; i < pos; i++) value += record.deltas[i];
+    *deci = value;
+    *timestamp = record.timestamp + (uint32_t)pos * THERMISTOR_LOGGING_INTERVAL;
+    return true;
 }
 
 static void _thermistor_logging_face_update_display(thermistor_logger_state_t *logger_state, bool in_fahrenheit, bool clock_mode_24h) {
-    int8_t pos = (logger_state->data_points - 1 - logger_state->display_index) % THERMISTOR_LOGGING_NUM_DATA_POINTS;
+    int16_t deci;
+    uint32_t timestamp;
     char buf[14];
+    // the two small digits show how many hours ago this reading was taken.
+    int hours_ago = logger_state->display_index / 4 > 99 ? 99 : logger_state->display_index / 4;
 
     watch_clear_indicator(WATCH_INDICATOR_24H);
     watch_clear_indicator(WATCH_INDICATOR_PM);
     watch_clear_colon();
 
-    if (pos < 0) {
-        sprintf(buf, "TL%2dno dat", logger_state->display_index);
+    if (!_thermistor_logging_face_read_point(logger_state, logger_state->display_index, &deci, &timestamp)) {
+        sprintf(buf, "TL%2dno dat", hours_ago);
     } else if (logger_state->ts_ticks) {
-        watch_date_time date_time = logger_state->data[pos].timestamp;
+        watch_date_time date_time = watch_utility_date_time_from_unix_time(timestamp, 0);
         watch_set_colon();
         if (clock_mode_24h) {
             watch_set_indicator(WATCH_INDICATOR_24H);
@@ -62,10 +124,11 @@ static void _thermistor_logging_face_update_display(thermistor_logger_state_t *l
         }
         sprintf(buf, "AT%2d%2d%02d%02d", date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
     } else {
+        float temperature_c = deci / 10.0;
         if (in_fahrenheit) {
-            sprintf(buf, "TL%2d%4.1f#F", logger_state->display_index, logger_state->data[pos].temperature_c * 1.8 + 32.0);
+            sprintf(buf, "TL%2d%4.1f#F", hours_ago, temperature_c * 1.8 + 32.0);
         } else {
-            sprintf(buf, "TL%2d%4.1f#C", logger_state->display_index, logger_state->data[pos].temperature_c);
+            sprintf(buf, "TL%2d%4.1f#C", hours_ago, temperature_c);
         }
     }
 
@@ -76,9 +139,10 @@ void thermistor_logging_face_setup(movement_settings_t *settings, uint8_t watch_
     (void) settings;
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(thermistor_logger_state_t));
+        *context_ptr = movement_face_context_alloc(sizeof(thermistor_logger_state_t));
         memset(*context_ptr, 0, sizeof(thermistor_logger_state_t));
     }
+    filesystem_ringlog_create(THERMISTOR_LOGGING_FILENAME, sizeof(thermistor_logger_record_t), THERMISTOR_LOGGING_RECORDS);
 }
 
 void thermistor_logging_face_activate(movement_settings_t *settings, void *context) {
@@ -102,9 +166,14 @@ bool thermistor_logging_face_loop(movement_event_t event, movement_settings_t *s
             logger_state->ts_ticks = 2;
             _thermistor_logging_face_update_display(logger_state, settings->bit.use_imperial_units, settings->bit.clock_mode_24h);
             break;
-        case EVENT_ALARM_BUTTON_DOWN:
-            logger_state->display_index = (logger_state->display_index + 1) % THERMISTOR_LOGGING_NUM_DATA_POINTS;
+        case EVENT_ALARM_BUTTON_DOWN: {
+            // step back one reading; past the oldest one in the log, wrap around to now.
+            int16_t count = filesystem_ringlog_count(THERMISTOR_LOGGING_FILENAME);
+            uint16_t points = logger_state->pending_count;
+            if (count > 0) points += (uint16_t)count * THERMISTOR_LOGGING_POINTS_PER_RECORD;
+            if (points == 0 || ++logger_state->display_index >= points) logger_state->display_index = 0;
             logger_state->ts_ticks = 0;
+        }
             // fall through
         case EVENT_ACTIVATE:
             _thermistor_logging_face_update_display(logger_state, settings->bit.use_imperial_units, settings->bit.clock_mode_24h);
@@ -133,7 +202,6 @@ void thermistor_logging_face_resign(movement_settings_t *settings, void *context
 bool thermistor_logging_face_wants_background_task(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
-    // this will get called at the top of each minute, so all we check is if we're at the top of the hour as well.
-    // if we are, we ask for a background task.
-    return watch_rtc_get_date_time().unit.minute == 0;
+    // this will get called at the top of each minute; take a reading every quarter hour.
+    return watch_rtc_get_date_time().unit.minute % 15 == 0;
 }
@@ -28,18 +28,24 @@
 #include "movement.h"
 #include "watch.h"
 
-#define THERMISTOR_LOGGING_NUM_DATA_POINTS (36)
+// Temperature history lives in a circular log file on the filesystem, not in RAM:
+// one reading every 15 minutes, seven days deep, and it survives resets and battery
+// swaps. Readings are packed 24 to a record (six hours) as an absolute base plus
+// int8 deltas in tenths of a degree, so a week costs under a kilobyte. Only the
+// record currently being filled is held in RAM; history pages are read back and
+// decoded on demand as you scroll. The ALARM button steps back one reading at a
+// time (the small digits show hours ago, capped at 99); LIGHT shows the reading's
+// timestamp for a moment, and a long press of LIGHT lights the LED.
 
-typedef struct {
-    watch_date_time timestamp;
-    float temperature_c;
-} thermistor_logger_data_point_t;
+#define THERMISTOR_LOGGING_POINTS_PER_RECORD (24)
 
 typedef struct {
-    uint8_t display_index;  // the index we are displaying on screen
-    uint8_t ts_ticks;       // when the user taps the LIGHT button, we show the timestamp for a few ticks.
-    int32_t data_points;    // the absolute number of data points logged
-    thermistor_logger_data_point_t data[THERMISTOR_LOGGING_NUM_DATA_POINTS];
+    uint16_t display_index;   // quarter-hour readings back from the most recent one
+    uint8_t ts_ticks;         // when the user taps the LIGHT button, we show the timestamp for a few ticks.
+    // the record being filled, kept raw here and delta-encoded when it flushes to the log.
+    uint32_t pending_timestamp;   // unix timestamp of the first pending reading
+    int16_t pending_deci[THERMISTOR_LOGGING_POINTS_PER_RECORD];  // tenths of a degree C
+    uint8_t pending_count;
 } thermistor_logger_state_t;
 
 void thermistor_logging_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -54,6 +60,7 @@ bool thermistor_logging_face_wants_background_task(movement_settings_t *settings
     thermistor_logging_face_loop, \
     thermistor_logging_face_resign, \
     thermistor_logging_face_wants_background_task, \
+    NULL, \
 })
 
 #endif // THERMISTOR_LOGGING_FACE_H_
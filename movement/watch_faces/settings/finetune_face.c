@@ -162,7 +162,7 @@ bool finetune_face_loop(movement_event_t event, movement_settings_t *settings, v
             // We flash green LED once per minute to measure clock error, when we are not on first screen
             if (finetune_page!=0) {
                 watch_date_time date_time;
-                date_time = watch_rtc_get_date_time();
+                date_time = event.date_time;
                 if (date_time.unit.second == 0) {
                     watch_set_led_green();
                     #ifndef __EMSCRIPTEN__
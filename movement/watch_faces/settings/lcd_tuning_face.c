@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "lcd_tuning_face.h"
+#include "filesystem.h"
+#include "watch.h"
+
+// frame rate candidates, slowest (lowest power) to fastest: prescaler and divider pairs
+// for the SLCD clock. The stock configuration is the 34 Hz entry.
+static const uint8_t _lcd_tuning_rates[][2] = {
+    {3, 7},  // 10 Hz
+    {3, 5},  // 14 Hz
+    {3, 3},  // 21 Hz
+    {2, 5},  // 28 Hz
+    {2, 4},  // 34 Hz (stock)
+    {2, 3},  // 42 Hz
+    {2, 2},  // 56 Hz
+    {2, 1},  // 85 Hz
+};
+#define LCD_TUNING_NUM_RATES (sizeof(_lcd_tuning_rates) / sizeof(_lcd_tuning_rates[0]))
+
+static void _lcd_tuning_face_apply(lcd_tuning_state_t *state) {
+    state->drive.prescaler = _lcd_tuning_rates[state->candidate][0];
+    state->drive.divider = _lcd_tuning_rates[state->candidate][1];
+    watch_set_lcd_drive(&state->drive);
+    state->saved = false;
+    watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
+}
+
+static void _lcd_tuning_face_update_display(lcd_tuning_state_t *state) {
+    char buf[6];
+    sprintf(buf, "%2d%2d", watch_lcd_frame_rate(&state->drive), state->drive.contrast);
+    watch_display_string(buf, 0);
+}
+
+void lcd_tuning_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
+    (void) settings;
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = movement_face_context_alloc(sizeof(lcd_tuning_state_t));
+        memset(*context_ptr, 0, sizeof(lcd_tuning_state_t));
+    }
+}
+
+void lcd_tuning_face_activate(movement_settings_t *settings, void *context) {
+    (void) settings;
+    lcd_tuning_state_t *state = (lcd_tuning_state_t *)context;
+    watch_get_lcd_drive(&state->entry_drive);
+    state->drive = state->entry_drive;
+    // find the candidate matching the current frame rate, falling back to stock.
+    state->candidate = 4;
+    for (uint8_t i = 0; i < LCD_TUNING_NUM_RATES; i++) {
+        if (_lcd_tuning_rates[i][0] == state->drive.prescaler && _lcd_tuning_rates[i][1] == state->drive.divider) {
+            state->candidate = i;
+            break;
+        }
+    }
+    state->pattern_on = false;
+    state->saved = false;
+    movement_request_tick_frequency(2);
+}
+
+bool lcd_tuning_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
+    lcd_tuning_state_t *state = (lcd_tuning_state_t *)context;
+    switch (event.event_type) {
+        case EVENT_ACTIVATE:
+            _lcd_tuning_face_update_display(state);
+            break;
+        case EVENT_TICK:
+            // the ghosting stress test: the whole clock line and the colon toggling at once.
+            state->pattern_on = !state->pattern_on;
+            if (state->pattern_on) {
+                watch_set_colon();
+                watch_display_string("888888", 4);
+            } else {
+                watch_clear_colon();
+                watch_display_string("      ", 4);
+            }
+            break;
+        case EVENT_LIGHT_BUTTON_DOWN:
+            state->candidate = (state->candidate + 1) % LCD_TUNING_NUM_RATES;
+            _lcd_tuning_face_apply(state);
+            _lcd_tuning_face_update_display(state);
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+            state->drive.contrast = (state->drive.contrast + 1) % 16;
+            _lcd_tuning_face_apply(state);
+            _lcd_tuning_face_update_display(state);
+            break;
+        case EVENT_ALARM_LONG_PRESS:
+            if (filesystem_write_file(MOVEMENT_LCD_TUNING_FILENAME, (char *)&state->drive, sizeof(state->drive))) {
+                state->saved = true;
+                watch_set_indicator(WATCH_INDICATOR_SIGNAL);
+            }
+            break;
+        case EVENT_TIMEOUT:
+            movement_move_to_face(0);
+            break;
+        default:
+            movement_default_loop_handler(event, settings);
+            break;
+    }
+
+    return true;
+}
+
+void lcd_tuning_face_resign(movement_settings_t *settings, void *context) {
+    (void) settings;
+    lcd_tuning_state_t *state = (lcd_tuning_state_t *)context;
+    watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
+    if (state->saved) return;
+    // leaving without saving: go back to the persisted configuration, or failing
+    // that, whatever was in effect when the face came up.
+    watch_lcd_drive_t drive;
+    if (filesystem_get_file_size(MOVEMENT_LCD_TUNING_FILENAME) == (int32_t)sizeof(drive) &&
+        filesystem_read_file(MOVEMENT_LCD_TUNING_FILENAME, (char *)&drive, sizeof(drive))) {
+        watch_set_lcd_drive(&drive);
+    } else {
+        watch_set_lcd_drive(&state->entry_drive);
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LCD_TUNING_FACE_H_
+#define LCD_TUNING_FACE_H_
+
+#include "movement.h"
+
+// LCD drive tuning. Panels vary: some ghost when many segments toggle at once under
+// the stock drive settings, others render cleanly at a slower and lower power frame
+// rate than stock. This face flashes a worst-case test pattern (the whole clock line
+// toggling between all segments on and all off) while you sweep the drive: LIGHT
+// steps through frame rate candidates from slowest to fastest, ALARM bumps the
+// contrast. The weekday digits show the frame rate in Hz and the day digits the
+// contrast setting. Step down until ghosting appears, step back up one, then long
+// press ALARM to save; movement reapplies the saved settings at every boot, so each
+// unit runs the slowest drive that still renders cleanly on its particular panel.
+// Leaving the face without saving restores whatever was in effect before. Bias is
+// not adjustable; the 1/3 duty panel pins it at 1/3.
+
+typedef struct {
+    watch_lcd_drive_t drive;        // the configuration currently being auditioned
+    watch_lcd_drive_t entry_drive;  // what was in effect on activation, restored if we leave without saving
+    uint8_t candidate;              // index into the frame rate candidate table
+    bool pattern_on;                // phase of the flashing test pattern
+    bool saved;                     // the current configuration has been written to the filesystem
+} lcd_tuning_state_t;
+
+void lcd_tuning_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
+void lcd_tuning_face_activate(movement_settings_t *settings, void *context);
+bool lcd_tuning_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
+void lcd_tuning_face_resign(movement_settings_t *settings, void *context);
+
+#define lcd_tuning_face ((const watch_face_t){ \
+    lcd_tuning_face_setup, \
+    lcd_tuning_face_activate, \
+    lcd_tuning_face_loop, \
+    lcd_tuning_face_resign, \
+    NULL, \
+    NULL, \
+})
+
+#endif // LCD_TUNING_FACE_H_
@@ -41,10 +41,113 @@ const char preferences_face_titles[PREFERENCES_FACE_NUM_PREFEFENCES][11] = {
     "LT   red  ",   // Light: red component
 };
 
+// where each page's blinking value lives on the display, so the blink can redraw
+// just those positions instead of repainting the whole menu four times a second.
+static const struct {
+    uint8_t position;
+    uint8_t length;
+} preferences_face_value_fields[PREFERENCES_FACE_NUM_PREFEFENCES] = {
+    { 4, 3 },  // 12h/24h
+    { 9, 1 },  // y/n
+    { 4, 6 },  // timeout interval
+    { 4, 6 },  // low energy interval
+    { 4, 6 },  // LED duration
+    { 8, 2 },  // green (or blue) level
+    { 8, 2 },  // red level
+};
+
+// draws only the current value, at its field's positions.
+static void _preferences_face_draw_value(movement_settings_t *settings, uint8_t current_page) {
+    char buf[8];
+    switch (current_page) {
+        case 0:
+            if (settings->bit.clock_mode_24h) watch_display_string("24h", 4);
+            else watch_display_string("12h", 4);
+            break;
+        case 1:
+            if (settings->bit.button_should_sound) watch_display_string("y", 9);
+            else watch_display_string("n", 9);
+            break;
+        case 2:
+            switch (settings->bit.to_interval) {
+                case 0:
+                    watch_display_string("60 SeC", 4);
+                    break;
+                case 1:
+                    watch_display_string("2 n&in", 4);
+                    break;
+                case 2:
+                    watch_display_string("5 n&in", 4);
+                    break;
+                case 3:
+                    watch_display_string("30n&in", 4);
+                    break;
+            }
+            break;
+        case 3:
+            switch (settings->bit.le_interval) {
+                case 0:
+                    watch_display_string(" Never", 4);
+                    break;
+                case 1:
+                    watch_display_string("1 hour", 4);
+                    break;
+                case 2:
+                    watch_display_string("2 hour", 4);
+                    break;
+                case 3:
+                    watch_display_string("6 hour", 4);
+                    break;
+                case 4:
+                    watch_display_string("12 hr", 4);
+                    break;
+                case 5:
+                    watch_display_string(" 1 day", 4);
+                    break;
+                case 6:
+                    watch_display_string(" 2 day", 4);
+                    break;
+                case 7:
+                    watch_display_string(" 7 day", 4);
+                    break;
+            }
+            break;
+        case 4:
+            if (settings->bit.led_duration) {
+                sprintf(buf, " %1d SeC", settings->bit.led_duration * 2 - 1);
+                watch_display_string(buf, 4);
+            } else {
+                watch_display_string("no LEd", 4);
+            }
+            break;
+        case 5:
+            sprintf(buf, "%2d", settings->bit.led_green_color);
+            watch_display_string(buf, 8);
+            break;
+        case 6:
+            sprintf(buf, "%2d", settings->bit.led_red_color);
+            watch_display_string(buf, 8);
+            break;
+    }
+}
+
+// blanks only the current value's positions, for the off phase of the blink.
+static void _preferences_face_erase_value(uint8_t current_page) {
+    char buf[8] = "      ";
+    buf[preferences_face_value_fields[current_page].length] = 0;
+    watch_display_string(buf, preferences_face_value_fields[current_page].position);
+}
+
+// a full repaint: only on activation and page changes, never on the tick.
+static void _preferences_face_draw_page(movement_settings_t *settings, uint8_t current_page) {
+    watch_display_string((char *)preferences_face_titles[current_page], 0);
+    _preferences_face_draw_value(settings, current_page);
+}
+
 void preferences_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(uint8_t));
+    if (*context_ptr == NULL) *context_ptr = movement_face_context_alloc(sizeof(uint8_t));
 }
 
 void preferences_face_activate(movement_settings_t *settings, void *context) {
@@ -56,9 +159,13 @@ void preferences_face_activate(movement_settings_t *settings, void *context) {
 bool preferences_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     uint8_t current_page = *((uint8_t *)context);
     switch (event.event_type) {
-        case EVENT_TICK:
         case EVENT_ACTIVATE:
-            // Do nothing; handled below.
+            _preferences_face_draw_page(settings, current_page);
+            break;
+        case EVENT_TICK:
+            // blink the active value by touching only its own segments.
+            if (event.subsecond % 2) _preferences_face_draw_value(settings, current_page);
+            else _preferences_face_erase_value(current_page);
             break;
         case EVENT_MODE_BUTTON_UP:
             watch_set_led_off();
@@ -67,6 +174,7 @@ bool preferences_face_loop(movement_event_t event, movement_settings_t *settings
         case EVENT_LIGHT_BUTTON_DOWN:
             current_page = (current_page + 1) % PREFERENCES_FACE_NUM_PREFEFENCES;
             *((uint8_t *)context) = current_page;
+            _preferences_face_draw_page(settings, current_page);
             break;
         case EVENT_ALARM_BUTTON_UP:
             switch (current_page) {
@@ -92,6 +200,9 @@ bool preferences_face_loop(movement_event_t event, movement_settings_t *settings
                     settings->bit.led_red_color = settings->bit.led_red_color + 1;
                     break;
             }
+            // the new value changes in RAM only; the settings register is committed to
+            // the backup domain once, in resign, which the timeout path also goes through.
+            _preferences_face_draw_value(settings, current_page);
             break;
         case EVENT_TIMEOUT:
             movement_move_to_face(0);
@@ -100,83 +211,6 @@ bool preferences_face_loop(movement_event_t event, movement_settings_t *settings
             return movement_default_loop_handler(event, settings);
     }
 
-    watch_display_string((char *)preferences_face_titles[current_page], 0);
-
-    // blink active setting on even-numbered quarter-seconds
-    if (event.subsecond % 2) {
-        char buf[8];
-        switch (current_page) {
-            case 0:
-                if (settings->bit.clock_mode_24h) watch_display_string("24h", 4);
-                else watch_display_string("12h", 4);
-                break;
-            case 1:
-                if (settings->bit.button_should_sound) watch_display_string("y", 9);
-                else watch_display_string("n", 9);
-                break;
-            case 2:
-                switch (settings->bit.to_interval) {
-                    case 0:
-                        watch_display_string("60 SeC", 4);
-                        break;
-                    case 1:
-                        watch_display_string("2 n&in", 4);
-                        break;
-                    case 2:
-                        watch_display_string("5 n&in", 4);
-                        break;
-                    case 3:
-                        watch_display_string("30n&in", 4);
-                        break;
-                }
-                break;
-            case 3:
-                switch (settings->bit.le_interval) {
-                    case 0:
-                        watch_display_string(" Never", 4);
-                        break;
-                    case 1:
-                        watch_display_string("1 hour", 4);
-                        break;
-                    case 2:
-                        watch_display_string("2 hour", 4);
-                        break;
-                    case 3:
-                        watch_display_string("6 hour", 4);
-                        break;
-                    case 4:
-                        watch_display_string("12 hr", 4);
-                        break;
-                    case 5:
-                        watch_display_string(" 1 day", 4);
-                        break;
-                    case 6:
-                        watch_display_string(" 2 day", 4);
-                        break;
-                    case 7:
-                        watch_display_string(" 7 day", 4);
-                        break;
-                }
-                break;
-            case 4:
-                if (settings->bit.led_duration) {
-                    sprintf(buf, " %1d SeC", settings->bit.led_duration * 2 - 1);
-                    watch_display_string(buf, 4);
-                } else {
-                    watch_display_string("no LEd", 4);
-                }
-                break;
-            case 5:
-                sprintf(buf, "%2d", settings->bit.led_green_color);
-                watch_display_string(buf, 8);
-                break;
-            case 6:
-                sprintf(buf, "%2d", settings->bit.led_red_color);
-                watch_display_string(buf, 8);
-                break;
-        }
-    }
-
     // on LED color select screns, preview the color.
     if (current_page >= 5) {
         watch_set_led_color(settings->bit.led_red_color ? (0xF | settings->bit.led_red_color << 4) : 0,
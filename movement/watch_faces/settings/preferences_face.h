@@ -38,6 +38,7 @@ void preferences_face_resign(movement_settings_t *settings, void *context);
     preferences_face_loop, \
     preferences_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // PREFERENCES_FACE_H_
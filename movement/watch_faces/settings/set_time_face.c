@@ -29,90 +29,149 @@
 #define SET_TIME_FACE_NUM_SETTINGS (7)
 const char set_time_face_titles[SET_TIME_FACE_NUM_SETTINGS][3] = {"HR", "M1", "SE", "YR", "MO", "DA", "ZO"};
 
-static bool _quick_ticks_running;
+// auto-repeat while the alarm button is held: hold time is measured on a fast timer
+// channel, so the rate ramp is hardware-timed and the face can stay at its normal
+// 4 Hz tick, applying however many steps came due in one RTC write per wake.
+static int8_t _repeat_timer = -1;
+static uint32_t _repeat_steps_applied;
 
-static void _handle_alarm_button(movement_settings_t *settings, watch_date_time date_time, uint8_t current_page) {
-    // handles short or long pressing of the alarm button
+static void _handle_alarm_button(movement_settings_t *settings, watch_date_time date_time, uint8_t current_page, uint8_t steps) {
+    // applies `steps` increments to the current unit; one step for a tap, possibly
+    // several at once during auto-repeat, but only ever one RTC write.
     const uint8_t days_in_month[12] = {31, 28, 31, 30, 31, 30, 30, 31, 30, 31, 30, 31};
 
     switch (current_page) {
         case 0: // hour
-            date_time.unit.hour = (date_time.unit.hour + 1) % 24;
+            date_time.unit.hour = (date_time.unit.hour + steps) % 24;
             break;
         case 1: // minute
-            date_time.unit.minute = (date_time.unit.minute + 1) % 60;
+            date_time.unit.minute = (date_time.unit.minute + steps) % 60;
             break;
         case 2: // second
             date_time.unit.second = 0;
             break;
         case 3: // year
             // only allow 2021-2030. fix this sometime next decade
-            date_time.unit.year = ((date_time.unit.year % 10) + 1);
+            date_time.unit.year = ((date_time.unit.year + steps - 1) % 10) + 1;
             break;
         case 4: // month
-            date_time.unit.month = (date_time.unit.month % 12) + 1;
+            date_time.unit.month = ((date_time.unit.month + steps - 1) % 12) + 1;
             break;
         case 5: { // day
-            uint32_t tmp_day = date_time.unit.day;   // use a temporary variable to avoid messing up the months
-            tmp_day = tmp_day + 1;
+            uint8_t days = days_in_month[date_time.unit.month - 1];
             // handle February 29th on a leap year
-            if (((tmp_day > days_in_month[date_time.unit.month - 1]) && (date_time.unit.month != 2 || (date_time.unit.year % 4) != 0))
-                || (date_time.unit.month == 2 && (date_time.unit.year % 4) == 0 && tmp_day > 29)) {
-                tmp_day = 1;
-            }
-            date_time.unit.day = tmp_day;
+            if (date_time.unit.month == 2 && (date_time.unit.year % 4) == 0) days = 29;
+            date_time.unit.day = ((date_time.unit.day + steps - 1) % days) + 1;
             break;
         }
         case 6: // time zone
-            settings->bit.time_zone++;
-            if (settings->bit.time_zone > 40) settings->bit.time_zone = 0;
+            settings->bit.time_zone = (settings->bit.time_zone + steps) % 41;
             break;
     }
     watch_rtc_set_date_time(date_time);
 }
 
-static void _abort_quick_ticks() {
-    if (_quick_ticks_running) {
-        _quick_ticks_running = false;
-        movement_request_tick_frequency(4);
+// how many steps a hold of the given length has earned: 4 per second for the first
+// two seconds, 16 for the next two, then 64. Computed from total elapsed ticks so
+// no steps go missing between wakes.
+static uint32_t _repeat_steps_due(uint32_t ticks) {
+    if (ticks <= 2 * WATCH_FAST_TIMER_HZ) return ticks / (WATCH_FAST_TIMER_HZ / 4);
+    if (ticks <= 4 * WATCH_FAST_TIMER_HZ) return 8 + (ticks - 2 * WATCH_FAST_TIMER_HZ) / (WATCH_FAST_TIMER_HZ / 16);
+    return 40 + (ticks - 4 * WATCH_FAST_TIMER_HZ) / (WATCH_FAST_TIMER_HZ / 64);
+}
+
+// redraws just the unit being changed, at its own display positions; during repeat
+// the rest of the screen hasn't changed and doesn't need repainting.
+static void _set_time_face_draw_unit(movement_settings_t *settings, watch_date_time date_time, uint8_t current_page) {
+    char buf[7];
+    switch (current_page) {
+        case 0: // hour
+            if (settings->bit.clock_mode_24h) {
+                sprintf(buf, "%2d", date_time.unit.hour);
+            } else {
+                sprintf(buf, "%2d", (date_time.unit.hour % 12) ? (date_time.unit.hour % 12) : 12);
+                if (date_time.unit.hour < 12) watch_clear_indicator(WATCH_INDICATOR_PM);
+                else watch_set_indicator(WATCH_INDICATOR_PM);
+            }
+            watch_display_string(buf, 4);
+            break;
+        case 1: // minute
+            sprintf(buf, "%02d", date_time.unit.minute);
+            watch_display_string(buf, 6);
+            break;
+        case 3: // year
+            sprintf(buf, "%2d", date_time.unit.year + 20);
+            watch_display_string(buf, 4);
+            break;
+        case 4: // month
+            sprintf(buf, "%02d", date_time.unit.month);
+            watch_display_string(buf, 6);
+            break;
+        case 5: // day
+            sprintf(buf, "%02d", date_time.unit.day);
+            watch_display_string(buf, 8);
+            break;
+        case 6: // time zone
+            watch_set_colon();
+            sprintf(buf, "%s", movement_timezone_labels[settings->bit.time_zone]);
+            watch_display_string(buf, 3);
+            break;
+    }
+}
+
+static void _abort_repeat(void) {
+    if (_repeat_timer >= 0) {
+        watch_fast_timer_release(_repeat_timer);
+        _repeat_timer = -1;
     }
 }
 
 void set_time_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(uint8_t));
+    if (*context_ptr == NULL) *context_ptr = movement_face_context_alloc(sizeof(uint8_t));
 }
 
 void set_time_face_activate(movement_settings_t *settings, void *context) {
     (void) settings;
     *((uint8_t *)context) = 0;
     movement_request_tick_frequency(4);
-    _quick_ticks_running = false;
 }
 
 bool set_time_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     uint8_t current_page = *((uint8_t *)context);
-    watch_date_time date_time = watch_rtc_get_date_time();
+    watch_date_time date_time = event.date_time;
 
     switch (event.event_type) {
         case EVENT_TICK:
-            if (_quick_ticks_running) {
-                if (watch_get_pin_level(BTN_ALARM)) _handle_alarm_button(settings, date_time, current_page);
-                else _abort_quick_ticks();
+            if (_repeat_timer >= 0) {
+                if (watch_get_pin_level(BTN_ALARM)) {
+                    uint32_t due = _repeat_steps_due(watch_fast_timer_get_ticks(_repeat_timer));
+                    if (due > _repeat_steps_applied) {
+                        _handle_alarm_button(settings, date_time, current_page, due - _repeat_steps_applied);
+                        _repeat_steps_applied = due;
+                        _set_time_face_draw_unit(settings, watch_rtc_get_date_time(), current_page);
+                    }
+                    // only the changing unit was redrawn; skip the full repaint below.
+                    return true;
+                }
+                _abort_repeat();
             }
             break;
         case EVENT_ALARM_LONG_PRESS:
-            if (current_page != 2) {
-                _quick_ticks_running = true;
-                movement_request_tick_frequency(8);
+            if (current_page != 2 && _repeat_timer < 0) {
+                _repeat_timer = watch_fast_timer_claim();
+                if (_repeat_timer >= 0) {
+                    watch_fast_timer_start(_repeat_timer);
+                    _repeat_steps_applied = 0;
+                }
             }
             break;
         case EVENT_ALARM_LONG_UP:
-            _abort_quick_ticks();
+            _abort_repeat();
             break;
         case EVENT_MODE_BUTTON_UP:
-            _abort_quick_ticks();
+            _abort_repeat();
             movement_move_to_next_face();
             return false;
         case EVENT_LIGHT_BUTTON_DOWN:
@@ -120,11 +179,11 @@ bool set_time_face_loop(movement_event_t event, movement_settings_t *settings, v
             *((uint8_t *)context) = current_page;
             break;
         case EVENT_ALARM_BUTTON_UP:
-            _abort_quick_ticks();
-            _handle_alarm_button(settings, date_time, current_page);
+            _abort_repeat();
+            _handle_alarm_button(settings, date_time, current_page, 1);
             break;
         case EVENT_TIMEOUT:
-            _abort_quick_ticks();
+            _abort_repeat();
             movement_move_to_face(0);
             break;
         default:
@@ -153,12 +212,12 @@ bool set_time_face_loop(movement_event_t event, movement_settings_t *settings, v
             sprintf(buf, "%s        ", set_time_face_titles[current_page]);
         } else {
             watch_set_colon();
-            sprintf(buf, "%s %3d%02d  ", set_time_face_titles[current_page], (int8_t) (movement_timezone_offsets[settings->bit.time_zone] / 60), (int8_t) (movement_timezone_offsets[settings->bit.time_zone] % 60) * (movement_timezone_offsets[settings->bit.time_zone] < 0 ? -1 : 1));
+            sprintf(buf, "%s %s  ", set_time_face_titles[current_page], movement_timezone_labels[settings->bit.time_zone]);
         }
     }
 
     // blink up the parameter we're setting
-    if (event.subsecond % 2 && !_quick_ticks_running) {
+    if (event.subsecond % 2 && _repeat_timer < 0) {
         switch (current_page) {
             case 0:
             case 3:
@@ -183,6 +242,7 @@ bool set_time_face_loop(movement_event_t event, movement_settings_t *settings, v
 void set_time_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
+    _abort_repeat();
     watch_set_led_off();
     watch_store_backup_data(settings->reg, 0);
 }
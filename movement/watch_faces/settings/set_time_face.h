@@ -27,6 +27,12 @@
 
 #include "movement.h"
 
+// Time and date setting. Tap ALARM to advance the current unit by one; hold it to
+// auto-repeat, ramping from 4 through 16 to 64 steps per second. The ramp is timed
+// on a fast timer channel rather than by counting display ticks, so the face wakes
+// at its normal 4 Hz, applies every step that came due in one RTC write, and
+// repaints only the digits being changed.
+
 void set_time_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void set_time_face_activate(movement_settings_t *settings, void *context);
 bool set_time_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
@@ -38,6 +44,7 @@ void set_time_face_resign(movement_settings_t *settings, void *context);
     set_time_face_loop, \
     set_time_face_resign, \
     NULL, \
+    NULL, \
 })
 
 #endif // SET_TIME_FACE_H_
@@ -50,7 +50,7 @@ watch_date_time date_time_settings;
 void set_time_hackwatch_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(uint8_t));
+    if (*context_ptr == NULL) *context_ptr = movement_face_context_alloc(sizeof(uint8_t));
 }
 
 void set_time_hackwatch_face_activate(movement_settings_t *settings, void *context) {
@@ -65,7 +65,7 @@ bool set_time_hackwatch_face_loop(movement_event_t event, movement_settings_t *s
     const uint8_t days_in_month[12] = {31, 28, 31, 30, 31, 30, 30, 31, 30, 31, 30, 31};
 
     if (event.subsecond == 15) // Delay displayed time update by ~0.5 seconds, to align phase exactly to main clock at 1Hz
-        date_time_settings = watch_rtc_get_date_time();
+        date_time_settings = event.date_time;
 
     static int8_t seconds_reset_sequence;
 
@@ -249,10 +249,9 @@ bool set_time_hackwatch_face_loop(movement_event_t event, movement_settings_t *s
         } else {
             watch_set_colon();
             sprintf(buf,
-                    "%s %3d%02d  ",
+                    "%s %s  ",
                     set_time_hackwatch_face_titles[current_page],
-                    (int8_t)(movement_timezone_offsets[settings->bit.time_zone] / 60),
-                    (int8_t)(movement_timezone_offsets[settings->bit.time_zone] % 60) * (movement_timezone_offsets[settings->bit.time_zone] < 0 ? -1 : 1));
+                    movement_timezone_labels[settings->bit.time_zone]);
         }
     }
 
@@ -0,0 +1,198 @@
+/* Generated by utils/gen_zone_transitions.py -- do not edit.
+ * DST transitions compiled from tzdata, 2025-01-01 through 2045-01-01.
+ * 560 transitions across 41 zone slots; see zone_transitions.h.
+ */
+
+#include "zone_transitions.h"
+
+const uint32_t movement_zone_transition_times[560] = {
+    1743296400, 1761440400, 1774746000, 1792890000, 1806195600, 1824944400,
+    1837645200, 1856394000, 1869094800, 1887843600, 1901149200, 1919293200,
+    1932598800, 1950742800, 1964048400, 1982797200, 1995498000, 2014246800,
+    2026947600, 2045696400, 2058397200, 2077146000, 2090451600, 2108595600,
+    2121901200, 2140045200, 2153350800, 2172099600, 2184800400, 2203549200,
+    2216250000, 2234998800, 2248304400, 2266448400, 2279754000, 2297898000,
+    2311203600, 2329347600, 2342653200, 2361402000, 1743870600, 1759595400,
+    1775320200, 1791045000, 1806769800, 1822494600, 1838219400, 1853944200,
+    1869669000, 1885998600, 1901723400, 1917448200, 1933173000, 1948897800,
+    1964622600, 1980347400, 1996072200, 2011797000, 2027521800, 2043246600,
+    2058971400, 2075301000, 2091025800, 2106750600, 2122475400, 2138200200,
+    2153925000, 2169649800, 2185374600, 2201099400, 2216824200, 2233153800,
+    2248878600, 2264603400, 2280328200, 2296053000, 2311777800, 2327502600,
+    2343227400, 2358952200, 1743868800, 1759593600, 1775318400, 1791043200,
+    1806768000, 1822492800, 1838217600, 1853942400, 1869667200, 1885996800,
+    1901721600, 1917446400, 1933171200, 1948896000, 1964620800, 1980345600,
+    1996070400, 2011795200, 2027520000, 2043244800, 2058969600, 2075299200,
+    2091024000, 2106748800, 2122473600, 2138198400, 2153923200, 2169648000,
+    2185372800, 2201097600, 2216822400, 2233152000, 2248876800, 2264601600,
+    2280326400, 2296051200, 2311776000, 2327500800, 2343225600, 2358950400,
+    1743865200, 1759591800, 1775314800, 1791041400, 1806764400, 1822491000,
+    1838214000, 1853940600, 1869663600, 1885995000, 1901718000, 1917444600,
+    1933167600, 1948894200, 1964617200, 1980343800, 1996066800, 2011793400,
+    2027516400, 2043243000, 2058966000, 2075297400, 2091020400, 2106747000,
+    2122470000, 2138196600, 2153919600, 2169646200, 2185369200, 2201095800,
+    2216818800, 2233150200, 2248873200, 2264599800, 2280322800, 2296049400,
+    2311772400, 2327499000, 2343222000, 2358948600, 1743861600, 1758981600,
+    1775311200, 1790431200, 1806760800, 1821880800, 1838210400, 1853330400,
+    1869660000, 1885384800, 1901714400, 1916834400, 1933164000, 1948284000,
+    1964613600, 1979733600, 1996063200, 2011183200, 2027512800, 2042632800,
+    2058962400, 2074687200, 2091016800, 2106136800, 2122466400, 2137586400,
+    2153916000, 2169036000, 2185365600, 2200485600, 2216815200, 2232540000,
+    2248869600, 2263989600, 2280319200, 2295439200, 2311768800, 2326888800,
+    2343218400, 2358338400, 1743861600, 1758981600, 1775311200, 1790431200,
+    1806760800, 1821880800, 1838210400, 1853330400, 1869660000, 1885384800,
+    1901714400, 1916834400, 1933164000, 1948284000, 1964613600, 1979733600,
+    1996063200, 2011183200, 2027512800, 2042632800, 2058962400, 2074687200,
+    2091016800, 2106136800, 2122466400, 2137586400, 2153916000, 2169036000,
+    2185365600, 2200485600, 2216815200, 2232540000, 2248869600, 2263989600,
+    2280319200, 2295439200, 2311768800, 2326888800, 2343218400, 2358338400,
+    1741518000, 1762077600, 1772967600, 1793527200, 1805022000, 1825581600,
+    1836471600, 1857031200, 1867921200, 1888480800, 1899370800, 1919930400,
+    1930820400, 1951380000, 1962874800, 1983434400, 1994324400, 2014884000,
+    2025774000, 2046333600, 2057223600, 2077783200, 2088673200, 2109232800,
+    2120122800, 2140682400, 2152177200, 2172736800, 2183626800, 2204186400,
+    2215076400, 2235636000, 2246526000, 2267085600, 2277975600, 2298535200,
+    2309425200, 2329984800, 2341479600, 2362039200, 1741514400, 1762074000,
+    1772964000, 1793523600, 1805018400, 1825578000, 1836468000, 1857027600,
+    1867917600, 1888477200, 1899367200, 1919926800, 1930816800, 1951376400,
+    1962871200, 1983430800, 1994320800, 2014880400, 2025770400, 2046330000,
+    2057220000, 2077779600, 2088669600, 2109229200, 2120119200, 2140678800,
+    2152173600, 2172733200, 2183623200, 2204182800, 2215072800, 2235632400,
+    2246522400, 2267082000, 2277972000, 2298531600, 2309421600, 2329981200,
+    2341476000, 2362035600, 1741510800, 1762070400, 1772960400, 1793520000,
+    1805014800, 1825574400, 1836464400, 1857024000, 1867914000, 1888473600,
+    1899363600, 1919923200, 1930813200, 1951372800, 1962867600, 1983427200,
+    1994317200, 2014876800, 2025766800, 2046326400, 2057216400, 2077776000,
+    2088666000, 2109225600, 2120115600, 2140675200, 2152170000, 2172729600,
+    2183619600, 2204179200, 2215069200, 2235628800, 2246518800, 2267078400,
+    2277968400, 2298528000, 2309418000, 2329977600, 2341472400, 2362032000,
+    1741507200, 1762066800, 1772956800, 1793516400, 1805011200, 1825570800,
+    1836460800, 1857020400, 1867910400, 1888470000, 1899360000, 1919919600,
+    1930809600, 1951369200, 1962864000, 1983423600, 1994313600, 2014873200,
+    2025763200, 2046322800, 2057212800, 2077772400, 2088662400, 2109222000,
+    2120112000, 2140671600, 2152166400, 2172726000, 2183616000, 2204175600,
+    2215065600, 2235625200, 2246515200, 2267074800, 2277964800, 2298524400,
+    2309414400, 2329974000, 2341468800, 2362028400, 1741503600, 1762063200,
+    1772953200, 1793512800, 1805007600, 1825567200, 1836457200, 1857016800,
+    1867906800, 1888466400, 1899356400, 1919916000, 1930806000, 1951365600,
+    1962860400, 1983420000, 1994310000, 2014869600, 2025759600, 2046319200,
+    2057209200, 2077768800, 2088658800, 2109218400, 2120108400, 2140668000,
+    2152162800, 2172722400, 2183612400, 2204172000, 2215062000, 2235621600,
+    2246511600, 2267071200, 2277961200, 2298520800, 2309410800, 2329970400,
+    2341465200, 2362024800, 1741500000, 1762059600, 1772949600, 1793509200,
+    1805004000, 1825563600, 1836453600, 1857013200, 1867903200, 1888462800,
+    1899352800, 1919912400, 1930802400, 1951362000, 1962856800, 1983416400,
+    1994306400, 2014866000, 2025756000, 2046315600, 2057205600, 2077765200,
+    2088655200, 2109214800, 2120104800, 2140664400, 2152159200, 2172718800,
+    2183608800, 2204168400, 2215058400, 2235618000, 2246508000, 2267067600,
+    2277957600, 2298517200, 2309407200, 2329966800, 2341461600, 2362021200,
+    1741498200, 1762057800, 1772947800, 1793507400, 1805002200, 1825561800,
+    1836451800, 1857011400, 1867901400, 1888461000, 1899351000, 1919910600,
+    1930800600, 1951360200, 1962855000, 1983414600, 1994304600, 2014864200,
+    2025754200, 2046313800, 2057203800, 2077763400, 2088653400, 2109213000,
+    2120103000, 2140662600, 2152157400, 2172717000, 2183607000, 2204166600,
+    2215056600, 2235616200, 2246506200, 2267065800, 2277955800, 2298515400,
+    2309405400, 2329965000, 2341459800, 2362019400, 1743296400, 1761440400,
+    1774746000, 1792890000, 1806195600, 1824944400, 1837645200, 1856394000,
+    1869094800, 1887843600, 1901149200, 1919293200, 1932598800, 1950742800,
+    1964048400, 1982797200, 1995498000, 2014246800, 2026947600, 2045696400,
+    2058397200, 2077146000, 2090451600, 2108595600, 2121901200, 2140045200,
+    2153350800, 2172099600, 2184800400, 2203549200, 2216250000, 2234998800,
+    2248304400, 2266448400, 2279754000, 2297898000, 2311203600, 2329347600,
+    2342653200, 2361402000,
+};
+
+// offset in force after the matching transition, in quarter hours east of UTC.
+const int8_t movement_zone_transition_offsets[560] = {
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 4,
+    8, 4, 8, 4, 38, 42, 38, 42, 38, 42, 38, 42,
+    38, 42, 38, 42, 38, 42, 38, 42, 38, 42, 38, 42,
+    38, 42, 38, 42, 38, 42, 38, 42, 38, 42, 38, 42,
+    38, 42, 38, 42, 38, 42, 38, 42, 40, 44, 40, 44,
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,
+    40, 44, 40, 44, 40, 44, 40, 44, 40, 44, 40, 44,
+    42, 44, 42, 44, 42, 44, 42, 44, 42, 44, 42, 44,
+    42, 44, 42, 44, 42, 44, 42, 44, 42, 44, 42, 44,
+    42, 44, 42, 44, 42, 44, 42, 44, 42, 44, 42, 44,
+    42, 44, 42, 44, 48, 52, 48, 52, 48, 52, 48, 52,
+    48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52,
+    48, 52, 48, 52, 48, 52, 48, 52, 48, 52, 48, 52,
+    48, 52, 48, 52, 48, 52, 48, 52, 51, 55, 51, 55,
+    51, 55, 51, 55, 51, 55, 51, 55, 51, 55, 51, 55,
+    51, 55, 51, 55, 51, 55, 51, 55, 51, 55, 51, 55,
+    51, 55, 51, 55, 51, 55, 51, 55, 51, 55, 51, 55,
+    -32, -36, -32, -36, -32, -36, -32, -36, -32, -36, -32, -36,
+    -32, -36, -32, -36, -32, -36, -32, -36, -32, -36, -32, -36,
+    -32, -36, -32, -36, -32, -36, -32, -36, -32, -36, -32, -36,
+    -32, -36, -32, -36, -28, -32, -28, -32, -28, -32, -28, -32,
+    -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32,
+    -28, -32, -28, -32, -28, -32, -28, -32, -28, -32, -28, -32,
+    -28, -32, -28, -32, -28, -32, -28, -32, -24, -28, -24, -28,
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,
+    -24, -28, -24, -28, -24, -28, -24, -28, -24, -28, -24, -28,
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,
+    -20, -24, -20, -24, -20, -24, -20, -24, -20, -24, -20, -24,
+    -20, -24, -20, -24, -16, -20, -16, -20, -16, -20, -16, -20,
+    -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20,
+    -16, -20, -16, -20, -16, -20, -16, -20, -16, -20, -16, -20,
+    -16, -20, -16, -20, -16, -20, -16, -20, -12, -16, -12, -16,
+    -12, -16, -12, -16, -12, -16, -12, -16, -12, -16, -12, -16,
+    -12, -16, -12, -16, -12, -16, -12, -16, -12, -16, -12, -16,
+    -12, -16, -12, -16, -12, -16, -12, -16, -12, -16, -12, -16,
+    -10, -14, -10, -14, -10, -14, -10, -14, -10, -14, -10, -14,
+    -10, -14, -10, -14, -10, -14, -10, -14, -10, -14, -10, -14,
+    -10, -14, -10, -14, -10, -14, -10, -14, -10, -14, -10, -14,
+    -10, -14, -10, -14, 0, -4, 0, -4, 0, -4, 0, -4,
+    0, -4, 0, -4, 0, -4, 0, -4, 0, -4, 0, -4,
+    0, -4, 0, -4, 0, -4, 0, -4, 0, -4, 0, -4,
+    0, -4, 0, -4, 0, -4, 0, -4,
+};
+
+const movement_zone_info_t movement_zone_infos[41] = {
+    {    0,  0,   0 },  //  0: 0:00 UTC, fixed
+    {    0, 40,   4 },  //  1: 1:00 Central European Time (Europe/Berlin)
+    {   40,  0,   8 },  //  2: 2:00 South African Standard Time (Africa/Johannesburg)
+    {   40,  0,  12 },  //  3: 3:00 Arabia Standard Time (Asia/Riyadh)
+    {   40,  0,  14 },  //  4: 3:30 Iran Standard Time (Asia/Tehran)
+    {   40,  0,  16 },  //  5: 4:00 Georgia Standard Time (Asia/Tbilisi)
+    {   40,  0,  18 },  //  6: 4:30 Afghanistan Time (Asia/Kabul)
+    {   40,  0,  20 },  //  7: 5:00 Pakistan Standard Time (Asia/Karachi)
+    {   40,  0,  22 },  //  8: 5:30 Indian Standard Time (Asia/Kolkata)
+    {   40,  0,  23 },  //  9: 5:45 Nepal Time (Asia/Kathmandu)
+    {   40,  0,  24 },  // 10: 6:00 Kyrgyzstan Time (Asia/Bishkek)
+    {   40,  0,  26 },  // 11: 6:30 Myanmar Time (Asia/Yangon)
+    {   40,  0,  28 },  // 12: 7:00 Thailand Standard Time (Asia/Bangkok)
+    {   40,  0,  32 },  // 13: 8:00 China Standard Time (Asia/Shanghai)
+    {   40,  0,  35 },  // 14: 8:45 Australian Central Western Standard Time (Australia/Eucla)
+    {   40,  0,  36 },  // 15: 9:00 Japan Standard Time (Asia/Tokyo)
+    {   40, 40,  42 },  // 16: 9:30 Australian Central Standard Time (Australia/Adelaide)
+    {   80, 40,  44 },  // 17: 10:00 Australian Eastern Standard Time (Australia/Sydney)
+    {  120, 40,  44 },  // 18: 10:30 Lord Howe Standard Time (Australia/Lord_Howe)
+    {  160,  0,  44 },  // 19: 11:00 Solomon Islands Time (Pacific/Guadalcanal)
+    {  160, 40,  52 },  // 20: 12:00 New Zealand Standard Time (Pacific/Auckland)
+    {  200, 40,  55 },  // 21: 12:45 Chatham Standard Time (Pacific/Chatham)
+    {  240,  0,  52 },  // 22: 13:00 Tonga Time (Pacific/Tongatapu)
+    {  240,  0,  55 },  // 23: 13:45 Chatham Daylight Time (manual-DST slot), fixed
+    {  240,  0,  56 },  // 24: 14:00 Line Islands Time (Pacific/Kiritimati)
+    {  240,  0, -48 },  // 25: -12:00 Baker Island Time (Etc/GMT+12)
+    {  240,  0, -44 },  // 26: -11:00 Niue Time (Pacific/Niue)
+    {  240,  0, -40 },  // 27: -10:00 Hawaii-Aleutian Standard Time (Pacific/Honolulu)
+    {  240,  0, -38 },  // 28: -9:30 Marquesas Islands Time (Pacific/Marquesas)
+    {  240, 40, -36 },  // 29: -9:00 Alaska Standard Time (America/Anchorage)
+    {  280, 40, -32 },  // 30: -8:00 Pacific Standard Time (America/Los_Angeles)
+    {  320, 40, -28 },  // 31: -7:00 Mountain Standard Time (America/Denver)
+    {  360, 40, -24 },  // 32: -6:00 Central Standard Time (America/Chicago)
+    {  400, 40, -20 },  // 33: -5:00 Eastern Standard Time (America/New_York)
+    {  440,  0, -18 },  // 34: -4:30 Venezuelan Standard Time (historical), fixed
+    {  440, 40, -16 },  // 35: -4:00 Atlantic Standard Time (America/Halifax)
+    {  480, 40, -14 },  // 36: -3:30 Newfoundland Standard Time (America/St_Johns)
+    {  520,  0, -12 },  // 37: -3:00 Brasilia Time (America/Sao_Paulo)
+    {  520,  0, -10 },  // 38: -2:30 Newfoundland Daylight Time (manual-DST slot), fixed
+    {  520,  0,  -8 },  // 39: -2:00 Fernando de Noronha Time (America/Noronha)
+    {  520, 40,  -4 },  // 40: -1:00 Azores Standard Time (Atlantic/Azores)
+};
@@ -0,0 +1,52 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ZONE_TRANSITIONS_H_
+#define ZONE_TRANSITIONS_H_
+
+#include <stdint.h>
+
+// The compiled DST transition table. Each of Movement's 41 time zone slots maps
+// to a representative IANA zone; utils/gen_zone_transitions.py compiles that
+// zone's transitions out of tzdata into zone_transitions.c as a shared pool of
+// sorted unix timestamps with the offset in force after each, packed to a
+// quarter-hour byte. Zones with no DST (and the legacy manual-DST slots) have
+// zero transitions and just carry their fixed offset.
+//
+// The consumer is movement_timezone_offset in movement.c, which binary-searches
+// a zone's slice once and then caches the surrounding transition window, so the
+// per-tick cost of DST-correct local time is a couple of compares. Outside the
+// compiled range the nearest compiled offset applies — regenerate the table
+// before it runs out.
+
+typedef struct {
+    uint16_t first_transition;  // index of this zone's slice in the shared pools
+    uint16_t num_transitions;   // 0 for fixed-offset zones
+    int8_t initial_offset;      // quarter hours east of UTC before the first transition
+} movement_zone_info_t;
+
+extern const movement_zone_info_t movement_zone_infos[41];
+extern const uint32_t movement_zone_transition_times[];
+extern const int8_t movement_zone_transition_offsets[];
+
+#endif // ZONE_TRANSITIONS_H_
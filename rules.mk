@@ -20,6 +20,37 @@ $(BUILD)/$(BIN).html: $(OBJS)
 		-s ASYNCIFY=1 \
 		--shell-file=$(TOP)/watch-library/simulator/shell.html
 
+# headless batch mode: a node module driven by watch-library/simulator/headless.js,
+# which replays a scripted event stream at faster-than-real-time speed.
+#     make headless && node ../../watch-library/simulator/headless.js build-sim/watch-headless.js script.txt
+headless: $(BUILD)/$(BIN)-headless.js
+
+$(BUILD)/$(BIN)-headless.js: $(OBJS)
+	@echo JS $@
+	@$(CC) $(LDFLAGS) $(OBJS) $(LIBS) -o $@ \
+		-s ASYNCIFY=1 \
+		-s ENVIRONMENT=node \
+		-s MODULARIZE=1 \
+		-s EXPORT_NAME=createWatchModule \
+		-s "EXPORTED_RUNTIME_METHODS=['ccall']"
+
+# power regression gate: replays the scripted day (power_scenario.txt next to the app's
+# Makefile) through the headless simulator's energy model and compares per-face charge
+# and the modeled average current against the stored baseline; nonzero exit on
+# regression. Needs the emscripten toolchain, like the simulator build:
+#     emmake make power-report
+# Record a baseline (do this once per face list, and after deliberate power changes):
+#     emmake make power-report POWER_BASELINE_UPDATE=1
+# Add SERIAL=/dev/ttyACM0 to also pull the wake ledger and per-face wake/cycle counters
+# from a plugged-in watch running a MOVEMENT_PROFILE=1 build into the same report.
+POWER_SCENARIO ?= power_scenario.txt
+POWER_BASELINE ?= power_baseline.json
+
+power-report: $(BUILD)/$(BIN)-headless.js
+	@node $(TOP)/watch-library/simulator/headless.js $(BUILD)/$(BIN)-headless.js $(POWER_SCENARIO) > $(BUILD)/power_transcript.txt
+	@python3 $(TOP)/utils/power_report.py $(BUILD)/power_transcript.txt --baseline $(POWER_BASELINE) \
+		$(if $(SERIAL),--serial $(SERIAL)) $(if $(POWER_BASELINE_UPDATE),--update)
+
 $(BUILD)/$(BIN).elf: $(OBJS)
 	@echo LD $@
 	@$(CC) $(LDFLAGS) $(OBJS) $(LIBS) -o $@
@@ -54,6 +85,22 @@ size: $(BUILD)/$(BIN).elf
 	@echo size:
 	@$(SIZE) -t $^
 
+ramreport: $(BUILD)/$(BIN).elf
+	@echo "RAM-resident fast section (.ramfunc) — address, size (hex), symbol:"
+	@$(OBJDUMP) -t $^ | grep -w '\.ramfunc' | sort
+	@s=$$($(NM) $^ | awk '$$3 == "_sramfunc" { print $$1 }'); \
+	 e=$$($(NM) $^ | awk '$$3 == "_eramfunc" { print $$1 }'); \
+	 printf "total: %d bytes of SRAM\n" $$((0x$$e - 0x$$s))
+
+facereport: $(OBJS)
+	@echo "Flash and RAM contribution by object file, faces included, largest flash first."
+	@echo "flash = text + data (initializers), ram = data + bss; sums are per-object section"
+	@echo "sizes, i.e. before --gc-sections trims unreferenced code. The cross-referenced"
+	@echo "link map ($(BUILD)/$(BIN).map) has the post-trim, per-symbol attribution."
+	@printf "%8s %8s  %s\n" flash ram object
+	@$(SIZE) $(OBJS) | awk 'NR > 1 { n = $$6; sub(".*/", "", n); printf "%8d %8d  %s\n", $$1 + $$2, $$2 + $$3, n }' | sort -rn
+	@$(SIZE) -t $(OBJS) | awk '$$6 == "(TOTALS)" { printf "%8d %8d  (total)\n", $$1 + $$2, $$2 + $$3 }'
+
 clean:
 	@echo clean
 	@-rm -rf $(BUILD)
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Generates watch_character_remap.h from the per-position character rules.
+
+watch_display_character used to apply a chain of runtime branches to remap
+characters that render differently (or not at all) at certain display
+positions. Those rules are encoded here instead, and flattened into a
+position x character lookup table so the display path is branch-free.
+
+Run from the repository root:
+
+    python3 utils/gen_character_remap.py > watch-library/shared/watch/watch_character_remap.h
+
+The generated header is checked in; re-run this script if the remapping
+rules or the character set change.
+"""
+
+NUM_POSITIONS = 10
+
+# positions whose extra "ninth segment" pixels some characters light up
+NINTH_SEGMENT_POSITIONS = 2
+
+
+def remap(character, position):
+    # special cases for positions 4 and 6
+    if position in (4, 6):
+        if character == '7': character = '&'  # "lowercase" 7
+        elif character == 'A': character = 'a'  # A needs to be lowercase
+        elif character == 'o': character = 'O'  # O needs to be uppercase
+        elif character == 'L': character = '!'  # L needs to be in top half
+        elif character in ('M', 'm', 'N'): character = 'n'  # M and uppercase N need to be lowercase n
+        elif character == 'c': character = 'C'  # C needs to be uppercase
+        elif character == 'J': character = 'j'  # same
+        elif character in ('v', 'V', 'U', 'W', 'w'): character = 'u'  # bottom segment duplicated, so show in top half
+    else:
+        if character == 'u': character = 'v'  # we can use the bottom segment; move to lower half
+        elif character == 'j': character = 'J'  # same but just display a normal J
+    if position > 1:
+        if character == 'T': character = 't'  # uppercase T only works in positions 0 and 1
+    if position == 1:
+        if character == 'a': character = 'A'  # A needs to be uppercase
+        elif character == 'o': character = 'O'  # O needs to be uppercase
+        elif character == 'i': character = 'l'  # I needs to be uppercase (use an l, it looks the same)
+        elif character == 'n': character = 'N'  # N needs to be uppercase
+        elif character == 'r': character = 'R'  # R needs to be uppercase
+        elif character == 'd': character = 'D'  # D needs to be uppercase
+        elif character in ('v', 'V', 'u'): character = 'U'  # side segments shared, make uppercase
+        elif character == 'b': character = 'B'  # B needs to be uppercase
+        elif character == 'c': character = 'C'  # C needs to be uppercase
+    else:
+        if character == 'R': character = 'r'  # R needs to be lowercase almost everywhere
+    if position != 0:
+        if character == 'I': character = 'l'  # uppercase I only works in position 0
+    return character
+
+
+def ninth_segment(character, position):
+    """The extra pixel a character lights beyond its eight mapped segments, applied to
+    the already-remapped character and packed as (com << 6) | seg; 0 means none."""
+    if position == 0:
+        if character in ('B', 'D'): return (0 << 6) | 15  # funky ninth segment
+    elif position == 1:
+        if character == 'T': return (1 << 6) | 12  # descender
+        if character in ('B', 'D', '@'): return (0 << 6) | 12  # funky ninth segment
+    return 0
+
+
+def fallback_masks(position):
+    """Bit (c - 0x20) set when character c renders at this position as a fallback
+    glyph rather than as itself, split into 64-bit low and 32-bit high words."""
+    lo = hi = 0
+    for c in range(0x20, 0x80):
+        if remap(chr(c), position) != chr(c):
+            if c < 0x60: lo |= 1 << (c - 0x20)
+            else: hi |= 1 << (c - 0x60)
+    return lo, hi
+
+
+def main():
+    print("// Generated by utils/gen_character_remap.py. Do not edit by hand;")
+    print("// re-run the script if the per-position character rules change.")
+    print("#ifndef _WATCH_CHARACTER_REMAP_H_INCLUDED")
+    print("#define _WATCH_CHARACTER_REMAP_H_INCLUDED")
+    print("")
+    print("#include <stdint.h>")
+    print("")
+    print("// Character_Remap[position][c - 0x20] is the Character_Set index to render when asked")
+    print("// to display character c at the given position, folding in all per-position rules.")
+    print("WATCH_RAMFUNC static const uint8_t Character_Remap[%d][96] = {" % NUM_POSITIONS)
+    for position in range(NUM_POSITIONS):
+        row = [remap(chr(c), position) for c in range(0x20, 0x80)]
+        values = ", ".join("0x%02x" % (ord(c) - 0x20) for c in row)
+        print("    { %s }, // position %d" % (values, position))
+    print("};")
+    print("")
+    print("// Character_Ninth_Segment[position][c - 0x20] is the extra pixel (a descender or the")
+    print("// funky ninth segment) character c lights at positions 0 and 1 beyond its mapped")
+    print("// segments, packed as (com << 6) | seg; zero means none. No other position has one.")
+    print("WATCH_RAMFUNC static const uint8_t Character_Ninth_Segment[%d][96] = {" % NINTH_SEGMENT_POSITIONS)
+    for position in range(NINTH_SEGMENT_POSITIONS):
+        row = [ninth_segment(remap(chr(c), position), position) for c in range(0x20, 0x80)]
+        values = ", ".join("0x%02x" % pixel for pixel in row)
+        print("    { %s }, // position %d" % (values, position))
+    print("};")
+    print("")
+    print("// bit (c - 0x20) (low word) or (c - 0x60) (high word) is set when character c renders")
+    print("// at the given position as a fallback glyph rather than as itself.")
+    for position in range(NUM_POSITIONS):
+        lo, hi = fallback_masks(position)
+        print("#define _WATCH_FALLBACK_LO_%d (0x%016xULL)" % (position, lo))
+        print("#define _WATCH_FALLBACK_HI_%d (0x%016xULL)" % (position, hi))
+    print("")
+    print("// True when character c (a character constant) renders natively at display position pos")
+    print("// (a literal 0-9), with no seven-segment fallback substitution. Usable in a static")
+    print("// assert, so a face can have the build fail if a label won't render where it puts it:")
+    print("//")
+    print("//     _Static_assert(WATCH_CHAR_RENDERS_EXACTLY('S', 0), \"title falls back at position 0\");")
+    print("#define WATCH_CHAR_RENDERS_EXACTLY(c, pos) (!((((c) - 0x20) < 64) ? \\")
+    print("    ((_WATCH_FALLBACK_LO_##pos >> ((c) - 0x20)) & 1) : \\")
+    print("    ((_WATCH_FALLBACK_HI_##pos >> ((c) - 0x60)) & 1)))")
+    print("")
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""Generate the packed bright-star catalog in movement/lib/starcat/star_catalog.c.
+
+The star catalog face wants a table it can binary-search and index straight out
+of flash: one packed 6-byte record per star — right ascension and declination as
+16-bit binary turns (the top half of astrolib's 32-bit binary angles, about 20
+arcseconds of resolution, far below the display's minute-of-time precision) and
+the visual magnitude in centimagnitudes — sorted by right ascension, with the
+display names in a parallel table so the records stay a power-of-two-friendly
+size. Coordinates are J2000; at the watch's HH:MM display resolution, general
+precession moves rise/transit times by under two minutes across the RTC's range,
+so the face applies none.
+
+By default the embedded table below is used: the ~110 stars complete to visual
+magnitude 2.7, which covers every star a naked-eye "what's that star" question
+is usually about. To build a deeper catalog, pass the path to a Yale Bright Star
+Catalog file (bsc5.dat, ADC catalog V/50) and the number of stars to take:
+
+    python3 utils/gen_star_catalog.py > movement/lib/starcat/star_catalog.c
+    python3 utils/gen_star_catalog.py bsc5.dat 300 > movement/lib/starcat/star_catalog.c
+
+The companion header star_catalog.h is maintained by hand.
+"""
+
+import sys
+
+# name (6 chars max, display charset), RA in decimal hours, dec in decimal
+# degrees (both J2000), visual magnitude.
+STARS = [
+    ("SIRIUS", 6.752, -16.716, -1.46),
+    ("CANOPU", 6.400, -52.696, -0.74),
+    ("RIGILK", 14.660, -60.834, -0.27),
+    ("ARCTUR", 14.261, 19.182, -0.05),
+    ("VEGA", 18.615, 38.784, 0.03),
+    ("CAPELL", 5.278, 45.998, 0.08),
+    ("RIGEL", 5.242, -8.202, 0.13),
+    ("PROCYO", 7.655, 5.225, 0.34),
+    ("ACHERN", 1.629, -57.237, 0.46),
+    ("BETELG", 5.919, 7.407, 0.50),
+    ("HADAR", 14.064, -60.373, 0.61),
+    ("ACRUX", 12.443, -63.099, 0.76),
+    ("ALTAIR", 19.846, 8.868, 0.77),
+    ("ALDEBA", 4.599, 16.509, 0.85),
+    ("ANTARE", 16.490, -26.432, 0.96),
+    ("SPICA", 13.420, -11.161, 0.97),
+    ("POLLUX", 7.755, 28.026, 1.14),
+    ("FOMALH", 22.961, -29.622, 1.16),
+    ("DENEB", 20.690, 45.280, 1.25),
+    ("MIMOSA", 12.795, -59.689, 1.25),
+    ("REGULU", 10.140, 11.967, 1.35),
+    ("ADHARA", 6.977, -28.972, 1.50),
+    ("CASTOR", 7.577, 31.888, 1.57),
+    ("GACRUX", 12.519, -57.113, 1.63),
+    ("SHAULA", 17.560, -37.104, 1.63),
+    ("BELLAT", 5.419, 6.350, 1.64),
+    ("ELNATH", 5.438, 28.608, 1.65),
+    ("MIAPLA", 9.220, -69.717, 1.68),
+    ("ALNILA", 5.603, -1.202, 1.69),
+    ("ALNAIR", 22.137, -46.961, 1.74),
+    ("ALNITA", 5.679, -1.943, 1.77),
+    ("ALIOTH", 12.900, 55.960, 1.77),
+    ("REGOR", 8.158, -47.337, 1.78),
+    ("DUBHE", 11.062, 61.751, 1.79),
+    ("MIRFAK", 3.405, 49.861, 1.80),
+    ("WEZEN", 7.140, -26.393, 1.84),
+    ("KAUSAU", 18.403, -34.385, 1.85),
+    ("AVIOR", 8.375, -59.510, 1.86),
+    ("ALKAID", 13.792, 49.313, 1.86),
+    ("SARGAS", 17.622, -42.998, 1.87),
+    ("MENKAL", 5.992, 44.948, 1.90),
+    ("ATRIA", 16.811, -69.028, 1.92),
+    ("ALHENA", 6.629, 16.399, 1.92),
+    ("PEACOC", 20.427, -56.735, 1.94),
+    ("ALSEPH", 8.745, -54.709, 1.96),
+    ("MIRZAM", 6.378, -17.956, 1.98),
+    ("ALPHAR", 9.460, -8.659, 1.98),
+    ("POLARI", 2.530, 89.264, 1.98),
+    ("HAMAL", 2.120, 23.463, 2.00),
+    ("DIPHDA", 0.726, -17.987, 2.04),
+    ("MIZAR", 13.399, 54.925, 2.04),
+    ("MIRACH", 1.162, 35.620, 2.05),
+    ("NUNKI", 18.921, -26.297, 2.06),
+    ("MENKEN", 14.111, -36.370, 2.06),
+    ("ALPHER", 0.140, 29.091, 2.06),
+    ("RASALH", 17.582, 12.560, 2.07),
+    ("KOCHAB", 14.845, 74.156, 2.08),
+    ("ALGIEB", 10.333, 19.842, 2.08),
+    ("SAIPH", 5.796, -9.670, 2.09),
+    ("TIAKI", 22.711, -46.885, 2.11),
+    ("ALGOL", 3.136, 40.956, 2.12),
+    ("DENEBO", 11.818, 14.572, 2.13),
+    ("MUHLIF", 12.692, -48.960, 2.17),
+    ("ASPIDI", 9.285, -59.275, 2.21),
+    ("SUHAIL", 9.133, -43.433, 2.21),
+    ("ALPHEC", 15.578, 26.715, 2.23),
+    ("SADR", 20.370, 40.257, 2.23),
+    ("MINTAK", 5.533, -0.299, 2.23),
+    ("ELTANI", 17.943, 51.489, 2.23),
+    ("SCHEDA", 0.675, 56.537, 2.24),
+    ("NAOS", 8.060, -40.003, 2.25),
+    ("ALMACH", 2.065, 42.330, 2.26),
+    ("CAPH", 0.153, 59.150, 2.27),
+    ("LARAWA", 16.836, -34.293, 2.29),
+    ("ALPLUP", 14.698, -47.388, 2.30),
+    ("EPSCEN", 13.665, -53.466, 2.30),
+    ("ETACEN", 14.592, -42.158, 2.31),
+    ("DSCHUB", 16.006, -22.622, 2.32),
+    ("MERAK", 11.031, 56.383, 2.37),
+    ("IZAR", 14.750, 27.074, 2.37),
+    ("ANKAA", 0.438, -42.306, 2.39),
+    ("ENIF", 21.736, 9.875, 2.39),
+    ("GIRTAB", 17.708, -39.030, 2.41),
+    ("SCHEAT", 23.063, 28.083, 2.42),
+    ("SABIK", 17.173, -15.725, 2.43),
+    ("PHECDA", 11.897, 53.695, 2.44),
+    ("ALDERA", 21.310, 62.585, 2.45),
+    ("ALUDRA", 7.402, -29.303, 2.45),
+    ("ALJANA", 20.770, 33.970, 2.46),
+    ("GAMCAS", 0.945, 60.717, 2.47),
+    ("MARKAB", 23.079, 15.205, 2.49),
+    ("MARKEB", 9.369, -55.011, 2.50),
+    ("MENKAR", 3.038, 4.090, 2.53),
+    ("ZETCEN", 13.925, -47.288, 2.55),
+    ("ZETOPH", 16.620, -10.567, 2.57),
+    ("ARNEB", 5.545, -17.822, 2.58),
+    ("GIENAH", 12.263, -17.542, 2.59),
+    ("ASCELL", 19.043, -29.880, 2.60),
+    ("ZUBENE", 15.283, -9.383, 2.61),
+    ("ACRAB", 16.090, -19.805, 2.62),
+    ("UNUKAL", 15.738, 6.426, 2.63),
+    ("SHERAT", 1.911, 20.808, 2.64),
+    ("PHACT", 5.660, -34.074, 2.64),
+    ("KRAZ", 12.573, -23.397, 2.65),
+    ("MAHASI", 5.995, 37.213, 2.65),
+    ("RUCHBA", 1.430, 60.235, 2.66),
+    ("MUPHRI", 13.911, 18.398, 2.68),
+    ("ALPMUS", 12.620, -69.136, 2.69),
+    ("HASSAL", 4.950, 33.166, 2.69),
+    ("KAUSME", 18.350, -29.828, 2.70),
+]
+
+
+def parse_bsc5(path, count):
+    """Take the `count` brightest named stars from a Yale Bright Star Catalog
+    (ADC V/50 fixed-column format), falling back to the Bayer/Flamsteed
+    designation when a star has no proper name."""
+    stars = []
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            try:
+                ra = int(line[75:77]) + int(line[77:79]) / 60 + float(line[79:83]) / 3600
+                dec = int(line[84:86]) + int(line[86:88]) / 60 + int(line[88:90]) / 3600
+                if line[83] == "-":
+                    dec = -dec
+                vmag = float(line[102:107])
+            except ValueError:
+                continue  # novae and placeholders have blank fields
+            name = line[4:14].strip().upper().replace(" ", "")[:6]
+            if not name:
+                continue
+            stars.append((name, ra, dec, vmag))
+    stars.sort(key=lambda s: s[3])
+    return stars[:count]
+
+
+def main():
+    if len(sys.argv) == 3:
+        stars = parse_bsc5(sys.argv[1], int(sys.argv[2]))
+    else:
+        stars = list(STARS)
+    stars.sort(key=lambda s: s[1])  # the face binary-searches on right ascension
+
+    print("// Bright-star catalog, generated by utils/gen_star_catalog.py -- do not edit.")
+    print("// %d stars, J2000 coordinates as 16-bit binary turns, sorted by right ascension." % len(stars))
+    print('#include "star_catalog.h"')
+    print()
+    print("const star_catalog_entry_t star_catalog[] = {")
+    for name, ra, dec, vmag in stars:
+        ra16 = round(ra / 24 * 65536) % 65536
+        dec16 = round(dec / 360 * 65536)
+        print("    { %5d, %6d, %4d }, // %-6s mag %.2f" % (ra16, dec16, round(vmag * 100), name, vmag))
+    print("};")
+    print()
+    print("const char star_catalog_names[][7] = {")
+    for name, ra, dec, vmag in stars:
+        print('    "%s",' % name)
+    print("};")
+    print()
+    print("const uint16_t star_catalog_num_stars = %d;" % len(stars))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Generates thermistor_table.h from the thermistor circuit constants.
+
+thermistor_driver_get_temperature used to run the full B-parameter equation in
+floating point on every sample; the softfloat logarithm dominated the cost of a
+background temperature reading. The curve is smooth, so it's flattened here into
+a 64-interval table of centidegrees over the ADC scale, and the driver reduces a
+sample to one table row pair plus a linear interpolation.
+
+Run from the repository root:
+
+    python3 utils/gen_thermistor_table.py > watch-library/shared/driver/thermistor_table.h
+
+The generated header is checked in; re-run this script if the circuit constants
+below (which mirror the defines in thermistor_driver.h) change.
+"""
+
+import math
+
+# keep in sync with the THERMISTOR_* defines in thermistor_driver.h
+HIGH_SIDE = True
+B_COEFFICIENT = 3380.0
+NOMINAL_TEMPERATURE = 25.0
+NOMINAL_RESISTANCE = 10000.0
+SERIES_RESISTANCE = 10000.0
+
+INTERVALS = 64
+CLAMP = 9999  # centidegrees: out-of-model extremes pin to +/- 99.99 C
+
+
+def centidegrees(value):
+    """Temperature at an ADC code, mirroring watch_utility_thermistor_temperature."""
+    if HIGH_SIDE:
+        code = value / 64.0
+        if code <= 0:
+            return -CLAMP  # open circuit: colder than the model reaches
+        resistance = (1023.0 * SERIES_RESISTANCE) / code - SERIES_RESISTANCE
+    else:
+        if value >= 65535:
+            return CLAMP
+        resistance = SERIES_RESISTANCE / (65535.0 / value - 1.0)
+    if resistance <= 0:
+        return CLAMP  # short circuit: hotter than the model reaches
+    inv_t = math.log(resistance / NOMINAL_RESISTANCE) / B_COEFFICIENT \
+        + 1.0 / (NOMINAL_TEMPERATURE + 273.15)
+    if inv_t <= 0:
+        return CLAMP
+    t = 1.0 / inv_t - 273.15
+    return max(-CLAMP, min(CLAMP, round(t * 100)))
+
+
+def main():
+    table = [centidegrees(i * (65536 // INTERVALS)) for i in range(INTERVALS + 1)]
+
+    print("// Generated by utils/gen_thermistor_table.py. Do not edit by hand;")
+    print("// re-run the script if the thermistor circuit constants change.")
+    print("#ifndef _THERMISTOR_TABLE_H_INCLUDED")
+    print("#define _THERMISTOR_TABLE_H_INCLUDED")
+    print("")
+    print("#include <stdint.h>")
+    print("")
+    print("// Thermistor_Table[value >> 10] is the temperature in centidegrees celsius at the")
+    print("// bottom of that 1024-count slice of the ADC scale; the 65th entry closes the last")
+    print("// interpolation interval. Out-of-model extremes are clamped to +/- 99.99 C.")
+    print("static const int16_t Thermistor_Table[%d] = {" % (INTERVALS + 1))
+    for row in range(0, INTERVALS + 1, 8):
+        entries = table[row:row + 8]
+        print("    " + "".join("%6d," % entry for entry in entries))
+    print("};")
+    print("")
+    print("#endif // _THERMISTOR_TABLE_H_INCLUDED")
+
+
+if __name__ == "__main__":
+    main()
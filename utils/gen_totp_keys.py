@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""Generate the static TOTP key table in movement/watch_faces/complication/totp_keys.c.
+
+The static totp_face keeps its keys as const tables in flash: no file parse, no
+base32 decode, no RAM copy at startup — the face is ready the moment it
+activates. The cost used to be hand-editing hex arrays in totp_face.c. This
+script compiles a provisioning file into those tables instead, so a fleet can
+keep its accounts in a config file and still ship them as immutable flash data.
+
+The provisioning file is the same format totp_face_lfs reads from
+totp_uris.txt — one otpauth:// URI per line, as found in a 2FA QR code or an
+Aegis plain-text export:
+
+    otpauth://totp/Example:alice@google.com?secret=JBSWY3DPEHPK3PXP&issuer=Example
+    otpauth://totp/ACME%20Co:john.doe@email.com?secret=HXDMVJECJJWSRB3HWIZR4IFUGFTMXBOZ&issuer=ACME%20Co&algorithm=SHA256&period=60
+
+so the same file provisions either face. The two-character display label is the
+first two characters of the issuer; secret, period and algorithm are decoded
+here at build time. Blank lines and lines starting with '#' are skipped.
+
+    python3 utils/gen_totp_keys.py totp_uris.txt > movement/watch_faces/complication/totp_keys.c
+
+With no argument the stock two-entry demo table is emitted, so the file shipped
+in the tree can be regenerated. The companion header totp_keys.h is maintained
+by hand. Do not commit a totp_keys.c built from real secrets to a public tree.
+"""
+
+import base64
+import sys
+import urllib.parse
+
+ALGORITHMS = ("SHA1", "SHA224", "SHA256", "SHA384", "SHA512")
+
+# the demo table totp_face has always shipped with: two copies of the RFC-style
+# test key JBSWY3DPEHPK3PXP, labelled 2F and AC.
+DEMO_URIS = [
+    "otpauth://totp/demo?secret=JBSWY3DPEHPK3PXP&issuer=2FDemo",
+    "otpauth://totp/demo?secret=JBSWY3DPEHPK3PXP&issuer=ACDemo",
+]
+
+
+def parse_uri(line):
+    if not line.startswith("otpauth://totp/"):
+        raise ValueError("not an otpauth://totp/ URI")
+    query = urllib.parse.urlsplit(line).query
+    params = dict(urllib.parse.parse_qsl(query))
+    secret = params["secret"].strip().upper()
+    key = base64.b32decode(secret + "=" * (-len(secret) % 8))
+    issuer = params.get("issuer", "AA")
+    if len(issuer) < 2:
+        raise ValueError("issuer must be >= 2 chars, got '%s'" % issuer)
+    period = int(params.get("period", "30"))
+    if period == 0:
+        raise ValueError("invalid period")
+    algorithm = params.get("algorithm", "SHA1").upper()
+    if algorithm not in ALGORITHMS:
+        raise ValueError("unsupported algorithm %s" % algorithm)
+    if params.get("digits", "6") != "6":
+        raise ValueError("only 6-digit codes are supported")
+    return (key, issuer[0], issuer[1], period, algorithm)
+
+
+def main():
+    if len(sys.argv) > 1:
+        with open(sys.argv[1]) as f:
+            lines = [l.strip() for l in f]
+        lines = [l for l in lines if l and not l.startswith("#")]
+    else:
+        lines = DEMO_URIS
+
+    records = []
+    for line in lines:
+        try:
+            records.append(parse_uri(line))
+        except (ValueError, KeyError) as e:
+            sys.exit("gen_totp_keys: skipping nothing, fix the file: %s (%s)" % (line, e))
+    if not records:
+        sys.exit("gen_totp_keys: no records")
+    if len(records) > 255:
+        sys.exit("gen_totp_keys: too many records")
+
+    out = sys.stdout
+    out.write("// Generated by utils/gen_totp_keys.py — do not edit.\n")
+    out.write("// Regenerate with: python3 utils/gen_totp_keys.py <totp_uris.txt> > movement/watch_faces/complication/totp_keys.c\n\n")
+    out.write('#include "totp_keys.h"\n\n')
+    out.write("const uint8_t totp_num_keys = %d;\n\n" % len(records))
+    out.write("const uint8_t totp_keys[] = {\n")
+    for key, l0, l1, _, _ in records:
+        out.write("    %s, // %c%c\n" % (", ".join("0x%02x" % b for b in key), l0, l1))
+    out.write("};\n\n")
+    out.write("const uint8_t totp_key_sizes[] = {\n")
+    for key, _, _, _, _ in records:
+        out.write("    %d,\n" % len(key))
+    out.write("};\n\n")
+    out.write("const uint32_t totp_timesteps[] = {\n")
+    for _, _, _, period, _ in records:
+        out.write("    %d,\n" % period)
+    out.write("};\n\n")
+    out.write("const char totp_labels[][2] = {\n")
+    for _, l0, l1, _, _ in records:
+        out.write("    { '%c', '%c' },\n" % (l0, l1))
+    out.write("};\n\n")
+    out.write("const hmac_alg totp_algorithms[] = {\n")
+    for _, _, _, _, algorithm in records:
+        out.write("    %s,\n" % algorithm)
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Generate a pruned, table-driven VSOP87A ephemeris from vsop87a_milli.c.
+
+The stock vsop87a_milli.c evaluates every series term on every call. This
+script parses its generated source and re-emits the same data as constant
+term tables (amplitude, phase, frequency) with one shared evaluator loop,
+dropping terms whose worst-case angular contribution as seen from Earth
+falls below a threshold in arc seconds. The threshold is applied per body
+using its minimum distance from Earth, so a term is only dropped if it
+could never move the body's apparent position by more than the threshold.
+
+The Earth and EMB series are never pruned: the Moon's position is derived
+from 82.3 times their difference, which amplifies any truncation error far
+beyond the threshold math above.
+
+Usage, from the repo root:
+
+    python3 utils/gen_vsop87_pruned.py [threshold_arcsec] \
+        > movement/lib/vsop87/vsop87a_pruned.c
+
+The companion header vsop87a_pruned.h is maintained by hand; this script
+only generates the tables. The default threshold is 1 arc second: dropped
+terms accumulate, and measured against the full milli series this keeps
+the worst geocentric deviation under 9 arc seconds across 1500-2900 AD --
+below one second of right ascension, the finest figure the astronomy face
+displays.
+"""
+
+import re
+import sys
+import os
+
+ARCSEC_TO_RAD = 4.84813681109536e-06
+
+# Minimum distance from Earth in AU, for converting the arc second threshold
+# into an amplitude cutoff per body. None means "never prune" (see above).
+MIN_EARTH_DISTANCE_AU = {
+    "mercury": 0.52,
+    "venus": 0.26,
+    "earth": None,
+    "emb": None,
+    "mars": 0.37,
+    "jupiter": 3.93,
+    "saturn": 8.0,
+    "uranus": 17.3,
+    "neptune": 28.8,
+}
+
+BODIES = ["earth", "emb", "jupiter", "mars", "mercury", "neptune", "saturn", "uranus", "venus"]
+MAX_POWER = 6
+
+TERM_RE = re.compile(
+    r"(\w+)_([xyz])_(\d)\+=\s*([0-9.-]+)\s*\*\s*cos\(\s*([0-9.-]+)\s*\+\s*([0-9.-]+)\*t\);"
+)
+
+
+def parse(path):
+    """Returns {body: {axis: [[(a, b, c), ...] per power]}}."""
+    series = {b: {axis: [[] for _ in range(MAX_POWER)] for axis in "xyz"} for b in BODIES}
+    with open(path) as f:
+        for line in f:
+            m = TERM_RE.search(line)
+            if m:
+                body, axis, power, a, b, c = m.groups()
+                series[body][axis][int(power)].append((a, b, c))
+    return series
+
+
+def main():
+    threshold_arcsec = float(sys.argv[1]) if len(sys.argv) > 1 else 1.0
+    src = os.path.join(os.path.dirname(__file__), "..", "movement", "lib", "vsop87", "vsop87a_milli.c")
+    series = parse(src)
+
+    out = sys.stdout
+    total_in = total_out = 0
+
+    out.write("//Generated by utils/gen_vsop87_pruned.py from vsop87a_milli.c; do not edit.\n")
+    out.write("//Terms contributing less than %g arc seconds as seen from Earth are pruned.\n" % threshold_arcsec)
+    out.write("//Underlying data: VSOP87-Multilang http://www.astrogreg.com/vsop87-multilang/index.html\n")
+    out.write("//Greg Miller (gmiller@gregmiller.net) 2019.  Released as Public Domain\n\n")
+    out.write("#include <math.h>\n")
+    out.write('#include "vsop87a_pruned.h"\n\n')
+    out.write("static double _vsop87a_pruned_eval(const vsop87a_pruned_series_t *series, double t) {\n")
+    out.write("   const vsop87a_pruned_term_t *term = series->terms;\n")
+    out.write("   double tn = 1.0;\n")
+    out.write("   double result = 0.0;\n")
+    out.write("   for (int power = 0; power < VSOP87A_PRUNED_MAX_POWER; power++) {\n")
+    out.write("      double sum = 0.0;\n")
+    out.write("      for (int i = 0; i < series->counts[power]; i++) {\n")
+    out.write("         sum += term->a * cos(term->b + term->c * t);\n")
+    out.write("         term++;\n")
+    out.write("      }\n")
+    out.write("      result += sum * tn;\n")
+    out.write("      tn *= t;\n")
+    out.write("   }\n")
+    out.write("   return result;\n")
+    out.write("}\n")
+
+    for body in BODIES:
+        dist = MIN_EARTH_DISTANCE_AU[body]
+        cutoff = 0.0 if dist is None else threshold_arcsec * ARCSEC_TO_RAD * dist
+        for axis in "xyz":
+            counts = []
+            out.write("\nstatic const vsop87a_pruned_term_t _%s_%s_terms[] = {\n" % (body, axis))
+            for power in range(MAX_POWER):
+                kept = [t for t in series[body][axis][power] if float(t[0]) >= cutoff]
+                total_in += len(series[body][axis][power])
+                total_out += len(kept)
+                counts.append(len(kept))
+                for a, b, c in kept:
+                    out.write("   {%s, %s, %s},\n" % (a, b, c))
+            out.write("};\n")
+            out.write("static const vsop87a_pruned_series_t _%s_%s = {_%s_%s_terms, {%s}};\n"
+                      % (body, axis, body, axis, ", ".join(str(n) for n in counts)))
+
+    for body in BODIES:
+        out.write("\nvoid vsop87a_pruned_get%s(double t,double temp[]){\n" % body.capitalize())
+        for i, axis in enumerate("xyz"):
+            out.write("   temp[%d]=_vsop87a_pruned_eval(&_%s_%s, t);\n" % (i, body, axis))
+        out.write("}\n")
+
+    out.write("\nvoid vsop87a_pruned_getMoon(double earth[], double emb[],double temp[]){\n")
+    out.write("   temp[0]=(emb[0]-earth[0])*(1 + 1 / 0.01230073677);\n")
+    out.write("   temp[1]=(emb[1]-earth[1])*(1 + 1 / 0.01230073677);\n")
+    out.write("   temp[2]=(emb[2]-earth[2])*(1 + 1 / 0.01230073677);\n")
+    out.write("   temp[0]=temp[0]+earth[0];\n")
+    out.write("   temp[1]=temp[1]+earth[1];\n")
+    out.write("   temp[2]=temp[2]+earth[2];\n")
+    out.write("}\n")
+
+    sys.stderr.write("kept %d of %d terms\n" % (total_out, total_in))
+
+
+if __name__ == "__main__":
+    main()
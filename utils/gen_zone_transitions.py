@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""Generate the compiled DST transition table in movement/zone_transitions.c.
+
+The movement_timezone_offsets table stores one fixed UTC offset per zone, so
+wearers in DST-observing zones have to move the watch two slots twice a year.
+This script compiles the real transition history out of the system tzdata
+(via zoneinfo) into flash tables: for each of Movement's 41 zone slots, a
+representative IANA zone's sorted transition timestamps and the offset in
+force after each one, packed as unix seconds plus a quarter-hour offset byte.
+The runtime side (movement_timezone_offset in movement.c) binary-searches a
+zone's slice once and caches the surrounding transition window, so per-tick
+resolution stays O(1).
+
+Slots that never observe DST — and the two legacy "daylight" slots that only
+exist so users could shift manually — compile to zero transitions and fall
+back to the fixed offset, same behavior as before.
+
+Usage, from the repo root:
+
+    python3 utils/gen_zone_transitions.py > movement/zone_transitions.c
+
+The companion header zone_transitions.h is maintained by hand. The table
+covers GEN_START through GEN_END; outside that range lookups pin to the
+nearest compiled offset, which for every zone here is the standard
+(non-DST) offset at the range edges.
+"""
+
+import sys
+from datetime import datetime, timedelta, timezone
+from zoneinfo import ZoneInfo
+
+GEN_START = datetime(2025, 1, 1, tzinfo=timezone.utc)
+GEN_END = datetime(2045, 1, 1, tzinfo=timezone.utc)
+
+# one representative IANA zone per movement_timezone_offsets slot, chosen to
+# match the slot's label in movement.c. None = fixed offset, no transitions
+# (either the region observes no DST, or the slot is a manual-DST duplicate).
+ZONES = [
+    (0,    None,                    "0:00 UTC"),
+    (60,   "Europe/Berlin",         "1:00 Central European Time"),
+    (120,  "Africa/Johannesburg",   "2:00 South African Standard Time"),
+    (180,  "Asia/Riyadh",           "3:00 Arabia Standard Time"),
+    (210,  "Asia/Tehran",           "3:30 Iran Standard Time"),
+    (240,  "Asia/Tbilisi",          "4:00 Georgia Standard Time"),
+    (270,  "Asia/Kabul",            "4:30 Afghanistan Time"),
+    (300,  "Asia/Karachi",          "5:00 Pakistan Standard Time"),
+    (330,  "Asia/Kolkata",          "5:30 Indian Standard Time"),
+    (345,  "Asia/Kathmandu",        "5:45 Nepal Time"),
+    (360,  "Asia/Bishkek",          "6:00 Kyrgyzstan Time"),
+    (390,  "Asia/Yangon",           "6:30 Myanmar Time"),
+    (420,  "Asia/Bangkok",          "7:00 Thailand Standard Time"),
+    (480,  "Asia/Shanghai",         "8:00 China Standard Time"),
+    (525,  "Australia/Eucla",       "8:45 Australian Central Western Standard Time"),
+    (540,  "Asia/Tokyo",            "9:00 Japan Standard Time"),
+    (570,  "Australia/Adelaide",    "9:30 Australian Central Standard Time"),
+    (600,  "Australia/Sydney",      "10:00 Australian Eastern Standard Time"),
+    (630,  "Australia/Lord_Howe",   "10:30 Lord Howe Standard Time"),
+    (660,  "Pacific/Guadalcanal",   "11:00 Solomon Islands Time"),
+    (720,  "Pacific/Auckland",      "12:00 New Zealand Standard Time"),
+    (765,  "Pacific/Chatham",       "12:45 Chatham Standard Time"),
+    (780,  "Pacific/Tongatapu",     "13:00 Tonga Time"),
+    (825,  None,                    "13:45 Chatham Daylight Time (manual-DST slot)"),
+    (840,  "Pacific/Kiritimati",    "14:00 Line Islands Time"),
+    (-720, "Etc/GMT+12",            "-12:00 Baker Island Time"),
+    (-660, "Pacific/Niue",          "-11:00 Niue Time"),
+    (-600, "Pacific/Honolulu",      "-10:00 Hawaii-Aleutian Standard Time"),
+    (-570, "Pacific/Marquesas",     "-9:30 Marquesas Islands Time"),
+    (-540, "America/Anchorage",     "-9:00 Alaska Standard Time"),
+    (-480, "America/Los_Angeles",   "-8:00 Pacific Standard Time"),
+    (-420, "America/Denver",        "-7:00 Mountain Standard Time"),
+    (-360, "America/Chicago",       "-6:00 Central Standard Time"),
+    (-300, "America/New_York",      "-5:00 Eastern Standard Time"),
+    (-270, None,                    "-4:30 Venezuelan Standard Time (historical)"),
+    (-240, "America/Halifax",       "-4:00 Atlantic Standard Time"),
+    (-210, "America/St_Johns",      "-3:30 Newfoundland Standard Time"),
+    (-180, "America/Sao_Paulo",     "-3:00 Brasilia Time"),
+    (-150, None,                    "-2:30 Newfoundland Daylight Time (manual-DST slot)"),
+    (-120, "America/Noronha",       "-2:00 Fernando de Noronha Time"),
+    (-60,  "Atlantic/Azores",       "-1:00 Azores Standard Time"),
+]
+
+
+def quarter_hours(offset_timedelta):
+    seconds = int(offset_timedelta.total_seconds())
+    if seconds % 900:
+        raise SystemExit("offset %d not a whole quarter hour" % seconds)
+    return seconds // 900
+
+
+def zone_transitions(tz):
+    """Return (initial_offset_qh, [(unix_time, offset_qh), ...]) over the range."""
+    initial = quarter_hours(GEN_START.astimezone(tz).utcoffset())
+    transitions = []
+    previous = initial
+    cursor = GEN_START
+    step = timedelta(days=1)
+    while cursor < GEN_END:
+        later = min(cursor + step, GEN_END)
+        current = quarter_hours(later.astimezone(tz).utcoffset())
+        if current != previous:
+            # bisect the day down to the exact second of the transition
+            lo, hi = cursor, later
+            while (hi - lo).total_seconds() > 1:
+                mid = lo + (hi - lo) / 2
+                if quarter_hours(mid.astimezone(tz).utcoffset()) == previous:
+                    lo = mid
+                else:
+                    hi = mid
+            transitions.append((int(hi.timestamp()), current))
+            previous = current
+        cursor = later
+    return initial, transitions
+
+
+def main():
+    times = []
+    offsets = []
+    infos = []
+    for fixed_minutes, name, label in ZONES:
+        if name is None:
+            infos.append((len(times), 0, fixed_minutes * 60 // 900, label + ", fixed"))
+            continue
+        initial, transitions = zone_transitions(ZoneInfo(name))
+        infos.append((len(times), len(transitions), initial, "%s (%s)" % (label, name)))
+        for when, offset in transitions:
+            times.append(when)
+            offsets.append(offset)
+
+    out = sys.stdout
+    out.write("/* Generated by utils/gen_zone_transitions.py -- do not edit.\n")
+    out.write(" * DST transitions compiled from tzdata, %s through %s.\n"
+              % (GEN_START.date(), GEN_END.date()))
+    out.write(" * %d transitions across %d zone slots; see zone_transitions.h.\n"
+              % (len(times), len(ZONES)))
+    out.write(" */\n\n#include \"zone_transitions.h\"\n\n")
+
+    out.write("const uint32_t movement_zone_transition_times[%d] = {\n" % len(times))
+    for i in range(0, len(times), 6):
+        out.write("    %s,\n" % ", ".join("%d" % t for t in times[i:i + 6]))
+    out.write("};\n\n")
+
+    out.write("// offset in force after the matching transition, in quarter hours east of UTC.\n")
+    out.write("const int8_t movement_zone_transition_offsets[%d] = {\n" % len(offsets))
+    for i in range(0, len(offsets), 12):
+        out.write("    %s,\n" % ", ".join("%d" % o for o in offsets[i:i + 12]))
+    out.write("};\n\n")
+
+    out.write("const movement_zone_info_t movement_zone_infos[%d] = {\n" % len(infos))
+    for i, (first, count, initial, label) in enumerate(infos):
+        out.write("    { %4d, %2d, %3d },  // %2d: %s\n" % (first, count, initial, i, label))
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Build a firmware delta stream for the watch's `fwdelta` shell command.
+
+Compares two application images (the .bin currently running on the watch and
+the .bin you want it to run) in 256-byte pages and emits only the pages that
+differ, each as a little-endian u16 page index followed by the page bytes, in
+ascending order, terminated by an index of 0xFFFF with no data. The watch
+copies its running image into the SPI flash staging area as the baseline and
+patches these pages over it, so a typical rebuild ships in a few KB instead
+of the full 100+ KB image.
+
+The tool also prints the `fwdelta` invocation to run first: the final image
+size and its CRC-32 in littlefs's flavor (reflected polynomial 0xedb88320,
+seed 0xffffffff, final value not inverted), which the watch verifies end to
+end before arming the update. Stream the output file with the same framing as
+fsload (see filesystem_process_transfer in movement/filesystem.c).
+
+Usage:
+
+    python3 utils/make_fw_delta.py old.bin new.bin delta.bin
+"""
+
+import sys
+
+PAGE_SIZE = 256
+
+
+def lfs_crc32(data):
+    crc = 0xFFFFFFFF
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ (0xEDB88320 if crc & 1 else 0)
+    return crc
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(__doc__.strip())
+    old_image = open(sys.argv[1], "rb").read()
+    new_image = open(sys.argv[2], "rb").read()
+
+    num_pages = (len(new_image) + PAGE_SIZE - 1) // PAGE_SIZE
+    if num_pages >= 0xFFFF:
+        sys.exit("error: new image is too large")
+
+    records = bytearray()
+    changed = 0
+    for page in range(num_pages):
+        new_page = new_image[page * PAGE_SIZE:(page + 1) * PAGE_SIZE]
+        old_page = old_image[page * PAGE_SIZE:(page + 1) * PAGE_SIZE]
+        # the baseline beyond the old image's end is erased flash (0xFF)
+        old_page = old_page + b"\xff" * (len(new_page) - len(old_page))
+        if new_page != old_page:
+            records += page.to_bytes(2, "little") + new_page
+            changed += 1
+    records += b"\xff\xff"
+
+    with open(sys.argv[3], "wb") as f:
+        f.write(records)
+
+    print("%d of %d pages changed, %d byte delta" % (changed, num_pages, len(records)))
+    print("on the watch, run: fwdelta %d %08x" % (len(new_image), lfs_crc32(new_image)))
+    print("then stream %s with fsload framing" % sys.argv[3])
+
+
+if __name__ == "__main__":
+    main()
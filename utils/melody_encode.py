@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Encodes a text note list into the "ML" melody format the melody library streams.
+
+Input is whitespace-separated events, read from a file or standard input:
+
+    NOTE[:duration]   a pitch like c4, f#5 or bb3 (octaves 1-8, BUZZER_NOTE range)
+    r[:duration]      a rest
+
+Durations are in sixteenths of a second and default to 2 (an eighth of a second).
+Durations 1-15 cost nothing; longer ones are escaped into a second byte, and ones
+too long even for that are split into tied events (the buzzer holds the pitch
+seamlessly across the tie). Intervals wider than seven semitones are written as a
+two-byte absolute pitch re-anchor.
+
+Example:
+
+    echo "e5 e5 r e5 r c5 e5 r g5:4 r:4 g4:4" | \
+        python3 utils/melody_encode.py > mario.mel
+
+Upload the output with the fsload shell command and hand the filename to
+melody_player_play. See movement/lib/melody/melody.h for the format details.
+"""
+
+import sys
+
+NOTE_OFFSETS = {'c': 0, 'd': 2, 'e': 4, 'f': 5, 'g': 7, 'a': 9, 'b': 11}
+NOTE_MIN = 0    # BUZZER_NOTE_A1
+NOTE_MAX = 86   # BUZZER_NOTE_B8
+TICKS_PER_UNIT = 4  # 64 Hz ticks per sixteenth of a second
+
+
+def parse_note(text):
+    """Note name -> BuzzerNote index (BUZZER_NOTE_A1 == 0)."""
+    name = text[0].lower()
+    if name not in NOTE_OFFSETS:
+        raise ValueError("unknown note '%s'" % text)
+    semi = NOTE_OFFSETS[name]
+    rest = text[1:]
+    while rest and rest[0] in '#b':
+        semi += 1 if rest[0] == '#' else -1
+        rest = rest[1:]
+    if not rest.isdigit():
+        raise ValueError("note '%s' needs an octave, like c4" % text)
+    octave = int(rest)
+    note = (octave - 2) * 12 + semi + 3  # BUZZER_NOTE_C2 == 3
+    if note < NOTE_MIN or note > NOTE_MAX:
+        raise ValueError("note '%s' is out of the buzzer's range" % text)
+    return note
+
+
+def emit_event(out, delta, units):
+    """One event, splitting durations too long for the escaped byte into ties."""
+    if delta == -8:
+        # rests can't use the escaped duration (a -8 delta with a zero duration nibble
+        # is the pitch re-anchor), so long silences chain plain rest events instead.
+        while units > 0:
+            chunk = min(units, 15)
+            out.append((0x8 << 4) | chunk)
+            units -= chunk
+        return
+    while units > 0:
+        if units <= 15:
+            out.append(((delta & 0x0F) << 4) | units)
+            return
+        ticks = units * TICKS_PER_UNIT
+        if ticks <= 255:
+            out.append((delta & 0x0F) << 4)
+            out.append(ticks)
+            return
+        out.append((delta & 0x0F) << 4)
+        out.append(252)  # 63 units; the tie re-enters with a zero delta
+        units -= 63
+        delta = 0
+
+
+def encode(tokens):
+    events = []
+    for token in tokens:
+        name, _, duration = token.partition(':')
+        units = int(duration) if duration else 2
+        if units < 1:
+            raise ValueError("duration in '%s' must be at least 1" % token)
+        if name.lower() == 'r':
+            events.append((None, units))
+        else:
+            events.append((parse_note(name), units))
+
+    pitches = [note for note, _ in events if note is not None]
+    if not pitches:
+        raise ValueError("a melody needs at least one pitched note")
+
+    out = bytearray([ord('M'), ord('L'), 1, pitches[0]])
+    current = pitches[0]
+    for note, units in events:
+        if note is None:
+            emit_event(out, -8, units)
+            continue
+        delta = note - current
+        if delta < -7 or delta > 7:
+            out.append(0x80)  # re-anchor: absolute pitch, no time consumed
+            out.append(note)
+            delta = 0
+        current = note
+        emit_event(out, delta, units)
+    return bytes(out)
+
+
+def main():
+    if len(sys.argv) > 1:
+        with open(sys.argv[1]) as infile:
+            tokens = infile.read().split()
+    else:
+        tokens = sys.stdin.read().split()
+    sys.stdout.buffer.write(encode(tokens))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""Power regression report for `make power-report`.
+
+Reads the transcript of a headless simulator replay (the ENERGY lines
+watch_energy_print emits at each `dump`), optionally pulls the on-target
+counters from a watch running a MOVEMENT_PROFILE=1 build over its USB serial
+shell, and compares the result against a stored baseline. Exits nonzero when
+the modeled power regresses past the tolerance, so the target can gate a
+release.
+
+The absolute numbers inherit the energy model's caveat (see watch_energy.h):
+they are estimates drawn from the data sheet, not measurements. What the gate
+actually checks is movement *relative to the baseline* of the same scripted
+day — a face that starts ticking faster or holding the bus moves its row no
+matter what the model's constants are.
+
+Usage:
+
+    python3 utils/power_report.py transcript.txt --baseline power_baseline.json
+        [--serial /dev/ttyACM0] [--tolerance 5] [--update]
+
+--update records the current numbers as the new baseline instead of comparing.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+import time
+
+# mirror of the modeled currents in watch_energy.h; keep in sync by hand.
+ACTIVE_UA = 500.0
+STANDBY_UA = 7.5
+
+# allow this much absolute drift (µC) per face before the percentage check even
+# applies, so a face that went from 0.1 to 0.2 µC doesn't fail a 5% gate.
+FACE_SLACK_UC = 1.0
+
+
+def parse_transcript(path):
+    """Returns (per-face µC from the last dump, session seconds, average µA)."""
+    faces = {}
+    total = None
+    for line in open(path):
+        if not line.startswith("ENERGY "):
+            continue
+        fields = line.split()
+        if fields[1] == "face":
+            faces = {}  # header: a fresh dump supersedes earlier ones
+        elif fields[1] == "total":
+            # ENERGY total <uc> uC over <s> s (avg <ua> uA)
+            m = re.match(r"ENERGY total ([\d.]+) uC over ([\d.]+) s \(avg ([\d.]+) uA\)", line)
+            if m:
+                total = (float(m.group(2)), float(m.group(3)))
+        else:
+            faces[fields[1]] = float(fields[-1])
+    if total is None:
+        sys.exit("no ENERGY total line in %s — does the scenario end with a dump?" % path)
+    return faces, total[0], total[1]
+
+
+def read_target_counters(port):
+    """Runs `profile` and `wakes` on the watch's shell and parses the output.
+
+    Returns {"faces": {index: {"wakes": n, "cycles": n}}, "active_s": n,
+    "standby_s": n}, or None with a complaint if the conversation fails.
+    The watch must be running a MOVEMENT_PROFILE=1 build and be plugged in.
+    """
+    try:
+        import termios
+    except ImportError:
+        print("warning: no termios on this host; skipping on-target capture")
+        return None
+    try:
+        fd = os.open(port, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+    except OSError as e:
+        print("warning: %s: %s; skipping on-target capture" % (port, e.strerror))
+        return None
+    attrs = termios.tcgetattr(fd)
+    attrs[0] = attrs[1] = attrs[3] = 0  # raw: no iflag, oflag, lflag processing
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+
+    def converse(command, settle=2.0):
+        os.write(fd, (command + "\n").encode())
+        out, deadline = b"", time.monotonic() + settle
+        while time.monotonic() < deadline:
+            try:
+                out += os.read(fd, 4096)
+            except BlockingIOError:
+                time.sleep(0.05)
+        return out.decode(errors="replace").splitlines()
+
+    result = {"faces": {}}
+    for line in converse("profile"):
+        m = re.match(r"\s*(\d+)\s+(\d+)\s+(\d+)\s*$", line)
+        if m:
+            result["faces"][m.group(1)] = {"wakes": int(m.group(2)), "cycles": int(m.group(3))}
+    for line in converse("wakes"):
+        m = re.search(r"act (\d+) stby (\d+)", line)
+        if m:  # rows are oldest first; the trailing "today" row wins
+            result["active_s"], result["standby_s"] = int(m.group(1)), int(m.group(2))
+    os.close(fd)
+    if not result["faces"] and "active_s" not in result:
+        print("warning: no counters from %s — is a MOVEMENT_PROFILE=1 build running?" % port)
+        return None
+    return result
+
+
+def target_avg_ua(counters):
+    active, standby = counters.get("active_s", 0), counters.get("standby_s", 0)
+    if active + standby == 0:
+        return None
+    return (active * ACTIVE_UA + standby * STANDBY_UA) / (active + standby)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("transcript", help="stdout of the headless replay")
+    ap.add_argument("--baseline", default="power_baseline.json")
+    ap.add_argument("--serial", help="watch serial port for on-target counters")
+    ap.add_argument("--tolerance", type=float, default=5.0, help="allowed regression, percent")
+    ap.add_argument("--update", action="store_true", help="store these numbers as the baseline")
+    args = ap.parse_args()
+
+    faces, session_s, avg_ua = parse_transcript(args.transcript)
+    uah_day = avg_ua * 24.0
+    current = {"session_s": session_s, "avg_ua": avg_ua, "uah_day": round(uah_day, 2),
+               "faces_uc": faces}
+
+    target = read_target_counters(args.serial) if args.serial else None
+    if target:
+        current["target"] = target
+
+    print("modeled day: %.1f µA average, %.1f µAh/day (session %.0f s)" % (avg_ua, uah_day, session_s))
+    for face in sorted(faces, key=lambda f: (f == "sys", int(f) if f.isdigit() else 0)):
+        print("  face %-3s %10.2f µC" % (face, faces[face]))
+    if target:
+        ua = target_avg_ua(target)
+        if ua is not None:
+            print("on-target: %.1f µA average from the wake ledger (%.1f µAh/day)" % (ua, ua * 24.0))
+        for face in sorted(target["faces"], key=int):
+            row = target["faces"][face]
+            print("  face %-3s %8d wakes %12d cycles" % (face, row["wakes"], row["cycles"]))
+
+    if args.update:
+        json.dump(current, open(args.baseline, "w"), indent=2)
+        print("baseline written to %s" % args.baseline)
+        return
+
+    if not os.path.exists(args.baseline):
+        sys.exit("no baseline at %s — run once with POWER_BASELINE_UPDATE=1 to record one" % args.baseline)
+    baseline = json.load(open(args.baseline))
+
+    failures = []
+    limit = baseline["avg_ua"] * (1.0 + args.tolerance / 100.0)
+    delta = 100.0 * (avg_ua - baseline["avg_ua"]) / baseline["avg_ua"]
+    print("baseline: %.1f µA; current is %+.1f%% (tolerance %.0f%%)" % (baseline["avg_ua"], delta, args.tolerance))
+    if avg_ua > limit:
+        failures.append("average current %.1f µA exceeds baseline %.1f µA" % (avg_ua, baseline["avg_ua"]))
+    for face, uc in faces.items():
+        base_uc = baseline.get("faces_uc", {}).get(face)
+        if base_uc is None:
+            continue
+        if uc > base_uc + FACE_SLACK_UC and uc > base_uc * (1.0 + args.tolerance / 100.0):
+            failures.append("face %s charge %.2f µC exceeds baseline %.2f µC" % (face, uc, base_uc))
+
+    if failures:
+        for failure in failures:
+            print("FAIL: " + failure)
+        sys.exit(1)
+    print("PASS: within tolerance of the stored baseline")
+
+
+if __name__ == "__main__":
+    main()
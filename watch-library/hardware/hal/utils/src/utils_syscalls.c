@@ -54,6 +54,9 @@ extern void    _exit(int status);
 extern void    _kill(int pid, int sig);
 extern int     _getpid(void);
 
+/* Highest break the allocator has ever reached; read by movement_get_memory_stats. */
+unsigned char *_heap_high_water = NULL;
+
 /**
  * \brief Replacement of C library of _sbrk
  */
@@ -68,6 +71,9 @@ extern caddr_t _sbrk(int incr)
 	prev_heap = heap;
 
 	heap += incr;
+	if (heap > _heap_high_water) {
+		_heap_high_water = heap;
+	}
 
 	return (caddr_t)prev_heap;
 }
@@ -31,26 +31,38 @@
 #include "saml22.h"
 #include "hal_init.h"
 #include "watch.h"
+#include "fw_update.h"
 #include "tusb.h"
 
 int main(void) {
+    // the reset handler started the cycle counter; close the startup stage (data/bss
+    // init plus libc constructors) before anything else.
+    watch_boot_mark("startup");
+
     // ASF code. Initialize the MCU with configuration options from Atmel Studio.
     init_mcu();
 
-    // check if we are plugged into USB power.
-    watch_enable_digital_input(VBUS_DET);
-    watch_enable_pull_down(VBUS_DET);
+    // check if we are plugged into USB power. this is the boot (and BACKUP wake) path,
+    // so configure the pin — input, pull-down — with one bulk port write each way.
+    const uint32_t vbus_mask = 1 << (VBUS_DET & 0x1F);
+    watch_configure_port(VBUS_DET >> 5, vbus_mask, &(watch_gpio_config_t){ .input_pins = vbus_mask, .pull_pins = vbus_mask });
     if (watch_get_pin_level(VBUS_DET)) {
         // if so, enable USB functionality.
         _watch_enable_usb();
     }
-    watch_disable_digital_input(VBUS_DET);
+    watch_configure_port(VBUS_DET >> 5, vbus_mask, &(watch_gpio_config_t){ 0 });
 
     // initialize the delay driver before any user code is called.
     delay_driver_init();
+    watch_boot_mark("init_mcu");
+
+    // if a verified firmware image is staged in the SPI flash, install it and reset
+    // into it before any application code runs. No-op (one header read) otherwise.
+    fw_update_apply_if_staged();
 
     // User code. Give the app a chance to initialize its data structures and state.
     app_init();
+    watch_boot_mark("app_init");
 
     // If the RTC is already enabled, we're either waking from BACKUP mode or a reset.
     // Ideally we should check if the TAMPER or CMP0 (alarm) flags are set.
@@ -72,17 +84,31 @@ int main(void) {
         date_time.unit.year = 2;
         watch_rtc_set_date_time(date_time);
     }
+    watch_boot_mark("watch_init");
 
     // User code. Give the app a chance to enable and set up peripherals.
     app_setup();
+    watch_boot_mark("app_setup");
 
+    bool boot_logged = false;
     while (1) {
         bool usb_enabled = hri_usbdevice_get_CTRLA_ENABLE_bit(USB);
         bool can_sleep = app_loop();
 
-        if (can_sleep && !usb_enabled) {
+        if (!boot_logged) {
+            // the first loop pass renders the active face; boot ends here.
+            boot_logged = true;
+            watch_boot_mark("first_loop");
+            watch_boot_finish();
+        }
+
+        if (can_sleep) {
             app_prepare_for_standby();
-            sleep(4);
+            // USB's 48 MHz clock survives IDLE but not STANDBY, and the service task is
+            // scheduled from the USB interrupt, so the CPU can halt here between bus
+            // events even while plugged in. The SERCOMs run in STANDBY on their own
+            // (RUNSTDBY), so UART and I2C transfers no longer need the shallower mode.
+            sleep(usb_enabled ? 2 : 4);
             app_wake_from_standby();
         }
     }
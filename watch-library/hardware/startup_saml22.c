@@ -28,6 +28,7 @@
  */
 
 #include "saml22.h"
+#include "watch_profile.h"
 
 /* Initialize segments */
 extern uint32_t _sfixed;
@@ -186,6 +187,10 @@ void Reset_Handler(void)
 {
     uint32_t *pSrc, *pDest;
 
+    /* Start the boot-stage cycle counter; safe here because it only writes SysTick
+     * registers, no RAM. main() drops the markers the stage log is built from. */
+    watch_profile_counter_start();
+
     /* Initialize the relocate segment */
     pSrc = &_etext;
     pDest = &_srelocate;
@@ -72,8 +72,8 @@
 
 //------------- CLASS -------------//
 #define CFG_TUD_CDC               1
-#define CFG_TUD_MSC               0
-#define CFG_TUD_HID               0
+#define CFG_TUD_MSC               1
+#define CFG_TUD_HID               1
 #define CFG_TUD_MIDI              0
 #define CFG_TUD_VENDOR            0
 
@@ -84,6 +84,12 @@
 // CDC Endpoint transfer buffer size, more is faster
 #define CFG_TUD_CDC_EP_BUFSIZE   (64)
 
+// MSC Endpoint transfer buffer size; one full block, so reads go NVM -> endpoint buffer -> host
+#define CFG_TUD_MSC_EP_BUFSIZE   (512)
+
+// HID Endpoint transfer buffer size; a boot keyboard report is 8 bytes
+#define CFG_TUD_HID_EP_BUFSIZE   (16)
+
 #ifdef __cplusplus
  }
 #endif
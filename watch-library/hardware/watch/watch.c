@@ -23,6 +23,7 @@
  */
 
 #include "watch.h"
+#include <stdio.h>
 
 // receives interrupts from MCLK, OSC32KCTRL, OSCCTRL, PAC, PM, SUPC and TAL, whatever that is.
 void SYSTEM_Handler(void) {
@@ -46,6 +47,69 @@ bool watch_is_usb_enabled(void) {
     return USB->DEVICE.CTRLA.bit.ENABLE;
 }
 
+void watch_set_performance_level(uint8_t level) {
+    // the DFLL48M that clocks USB only runs at PL2; refuse to demote out from under it.
+    if (level < 2 && watch_is_usb_enabled()) return;
+    _set_performance_level(level);
+}
+
+static uint8_t cpu_boost_depth = 0;
+
+void watch_cpu_boost_begin(void) {
+    if (cpu_boost_depth++) return;
+    // voltage first, then speed: 16 MHz is beyond PL0's ceiling, and one flash wait
+    // state keeps reads in spec at the higher clock. (USB leaves us at PL2 already;
+    // the promotion is then a no-op.)
+    watch_set_performance_level(2);
+    hri_nvmctrl_write_CTRLB_RWS_bf(NVMCTRL, 1);
+    hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_16_Val);
+}
+
+void watch_cpu_boost_end(void) {
+    if (cpu_boost_depth == 0) return;   // unbalanced end; nothing to undo
+    if (--cpu_boost_depth) return;      // an enclosing boost scope is still open
+    // speed first, then voltage — the mirror of begin. USB runs the core at 8 MHz,
+    // otherwise 4; the demotion to PL0 is refused while USB needs PL2.
+    hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, watch_is_usb_enabled() ? OSCCTRL_OSC16MCTRL_FSEL_8_Val : OSCCTRL_OSC16MCTRL_FSEL_4_Val);
+    hri_nvmctrl_write_CTRLB_RWS_bf(NVMCTRL, 0);
+    watch_set_performance_level(0);
+}
+
+void watch_dump_clock_tree(void) {
+    // names indexed by APBCMASK bit position; _watch_init gates all of these at boot,
+    // so anything listed here is held open by a driver (or is a stray worth chasing).
+    static const char *const apbc_names[] = {
+        "EVSYS", "SERCOM0", "SERCOM1", "SERCOM2", "SERCOM3", "SERCOM4", "SERCOM5",
+        "TCC0", "TC0", "TC1", "TC2", "TC3", "ADC", "AC", "PTC", "SLCD", "AES", "TRNG", "CCL",
+    };
+    printf("gclk generators:\n");
+    for (uint8_t i = 0; i < GCLK_GEN_NUM; i++) {
+        uint32_t genctrl = GCLK->GENCTRL[i].reg;
+        if (!(genctrl & GCLK_GENCTRL_GENEN)) continue;
+        printf("  gen%d: src %lu div %lu%s\n", i,
+               (genctrl & GCLK_GENCTRL_SRC_Msk) >> GCLK_GENCTRL_SRC_Pos,
+               (genctrl & GCLK_GENCTRL_DIV_Msk) >> GCLK_GENCTRL_DIV_Pos,
+               (genctrl & GCLK_GENCTRL_RUNSTDBY) ? " runstdby" : "");
+    }
+    printf("gclk channels:\n");
+    for (uint8_t i = 0; i < GCLK_NUM; i++) {
+        uint32_t pchctrl = GCLK->PCHCTRL[i].reg;
+        if (pchctrl & GCLK_PCHCTRL_CHEN) printf("  ch%d <- gen%lu\n", i, pchctrl & GCLK_PCHCTRL_GEN_Msk);
+    }
+    printf("apbc:");
+    uint32_t apbc = MCLK->APBCMASK.reg;
+    for (uint8_t i = 0; i < sizeof(apbc_names) / sizeof(apbc_names[0]); i++) {
+        if (apbc & (1 << i)) printf(" %s", apbc_names[i]);
+    }
+    // the A and B buses hold system blocks (PM, clocks, RTC, EIC, NVMCTRL, PORT...);
+    // print them raw, with the two we gate called out by name.
+    printf("\nahb 0x%03lx (usb %lu dmac %lu) apba 0x%03lx apbb 0x%02lx (usb %lu)\n",
+           MCLK->AHBMASK.reg, (MCLK->AHBMASK.reg & MCLK_AHBMASK_USB) ? 1UL : 0UL,
+           (MCLK->AHBMASK.reg & MCLK_AHBMASK_DMAC) ? 1UL : 0UL,
+           MCLK->APBAMASK.reg, MCLK->APBBMASK.reg,
+           (MCLK->APBBMASK.reg & MCLK_APBBMASK_USB) ? 1UL : 0UL);
+}
+
 void watch_reset_to_bootloader(void) {
     volatile uint32_t *dbl_tap_ptr = ((volatile uint32_t *)(HSRAM_ADDR + HSRAM_SIZE - 4));
     *dbl_tap_ptr = 0xf01669ef; // from the UF2 bootloaer: uf2.h line 255
@@ -29,6 +29,25 @@ static void _watch_sync_adc(void) {
     while (ADC->SYNCBUSY.reg);
 }
 
+static watch_adc_callback_t _watch_adc_callback = NULL;
+
+static uint16_t _watch_adc_channel_for_pin(const uint8_t pin) {
+    switch (pin) {
+        case A0:
+            return ADC_INPUTCTRL_MUXPOS_AIN12_Val;
+        case A1:
+            return ADC_INPUTCTRL_MUXPOS_AIN9_Val;
+        case A2:
+            return ADC_INPUTCTRL_MUXPOS_AIN10_Val;
+        case A3:
+            return ADC_INPUTCTRL_MUXPOS_AIN11_Val;
+        case A4:
+            return ADC_INPUTCTRL_MUXPOS_AIN8_Val;
+        default:
+            return ADC_INPUTCTRL_MUXPOS_GND_Val;
+    }
+}
+
 static uint16_t _watch_get_analog_value(uint16_t channel) {
     if (ADC->INPUTCTRL.bit.MUXPOS != channel) {
         ADC->INPUTCTRL.bit.MUXPOS = channel;
@@ -103,19 +122,100 @@ void watch_enable_analog_input(const uint8_t pin) {
 }
 
 uint16_t watch_get_analog_pin_level(const uint8_t pin) {
-    switch (pin) {
-        case A0:
-            return _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_AIN12_Val);
-        case A1:
-            return _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_AIN9_Val);
-        case A2:
-            return _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_AIN10_Val);
-        case A3:
-            return _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_AIN11_Val);
-        case A4:
-            return _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_AIN8_Val);
-        default:
-            return 0;
+    uint16_t channel = _watch_adc_channel_for_pin(pin);
+    if (channel == ADC_INPUTCTRL_MUXPOS_GND_Val) return 0;
+    return _watch_get_analog_value(channel);
+}
+
+void watch_get_analog_pin_level_async(const uint8_t pin, watch_adc_callback_t callback) {
+    uint16_t channel = _watch_adc_channel_for_pin(pin);
+    if (channel == ADC_INPUTCTRL_MUXPOS_GND_Val) return;
+
+    if (ADC->INPUTCTRL.bit.MUXPOS != channel) {
+        ADC->INPUTCTRL.bit.MUXPOS = channel;
+        _watch_sync_adc();
+    }
+
+    _watch_adc_callback = callback;
+    NVIC_ClearPendingIRQ(ADC_IRQn);
+    NVIC_EnableIRQ(ADC_IRQn);
+    ADC->SWTRIG.bit.START = 1;
+    // return immediately; the "result ready" interrupt delivers the value to the callback.
+}
+
+static watch_adc_callback_t _watch_adc_periodic_callback = NULL;
+static uint8_t _watch_adc_periodic_per_n = 0;
+
+// The RTC's EVCTRL register is enable-protected: the counter has to stop for the write.
+// The stop lasts a handful of synchronization cycles, well under a clock tick.
+static void _watch_rtc_set_periodic_event(uint8_t per_n, bool enable) {
+    RTC->MODE2.CTRLA.bit.ENABLE = 0;
+    while (RTC->MODE2.SYNCBUSY.reg);
+    if (enable) RTC->MODE2.EVCTRL.reg |= RTC_MODE2_EVCTRL_PEREO0 << per_n;
+    else RTC->MODE2.EVCTRL.reg &= ~(RTC_MODE2_EVCTRL_PEREO0 << per_n);
+    RTC->MODE2.CTRLA.bit.ENABLE = 1;
+    while (RTC->MODE2.SYNCBUSY.reg);
+}
+
+void watch_adc_schedule_periodic(const uint8_t pin, uint8_t frequency, watch_adc_callback_t callback) {
+    uint16_t channel = _watch_adc_channel_for_pin(pin);
+    if (channel == ADC_INPUTCTRL_MUXPOS_GND_Val) return;
+    // the RTC can only produce power-of-two periodic events, 1 to 128 Hz.
+    if (__builtin_popcount(frequency) != 1) return;
+    // same mapping as the periodic interrupts in watch_rtc: 1 Hz is PER7, 128 Hz is PER0.
+    uint8_t per_n = 7 - __builtin_ctz(frequency);
+
+    if (ADC->INPUTCTRL.bit.MUXPOS != channel) {
+        ADC->INPUTCTRL.bit.MUXPOS = channel;
+        _watch_sync_adc();
+    }
+
+    _watch_adc_periodic_callback = callback;
+    _watch_adc_periodic_per_n = per_n;
+    _watch_rtc_set_periodic_event(per_n, true);
+
+    // event channel 0 carries the RTC periodic event to the ADC's start input. The
+    // asynchronous path needs no channel clock, and RUNSTDBY keeps it alive in STANDBY,
+    // so the whole trigger chain runs with the CPU asleep.
+    MCLK->APBCMASK.reg |= MCLK_APBCMASK_EVSYS;
+    EVSYS->USER[EVSYS_ID_USER_ADC_START].reg = EVSYS_USER_CHANNEL(0 + 1); // user values are channel + 1; 0 is "no channel"
+    EVSYS->CHANNEL[0].reg = EVSYS_CHANNEL_EVGEN(EVSYS_ID_GEN_RTC_PER_0 + per_n) |
+                            EVSYS_CHANNEL_PATH_ASYNCHRONOUS |
+                            EVSYS_CHANNEL_RUNSTDBY |
+                            EVSYS_CHANNEL_ONDEMAND;
+
+    // start a conversion on each event, keep converting in STANDBY, and wake on results.
+    ADC->EVCTRL.bit.STARTEI = 1;
+    ADC->CTRLA.reg |= ADC_CTRLA_RUNSTDBY | ADC_CTRLA_ONDEMAND;
+    _watch_sync_adc();
+    NVIC_ClearPendingIRQ(ADC_IRQn);
+    NVIC_EnableIRQ(ADC_IRQn);
+}
+
+void watch_adc_cancel_periodic(void) {
+    if (_watch_adc_periodic_callback == NULL) return;
+    _watch_adc_periodic_callback = NULL;
+    NVIC_DisableIRQ(ADC_IRQn);
+    ADC->EVCTRL.bit.STARTEI = 0;
+    ADC->CTRLA.reg &= ~(ADC_CTRLA_RUNSTDBY | ADC_CTRLA_ONDEMAND);
+    _watch_sync_adc();
+    EVSYS->CHANNEL[0].reg = 0;
+    EVSYS->USER[EVSYS_ID_USER_ADC_START].reg = 0;
+    _watch_rtc_set_periodic_event(_watch_adc_periodic_per_n, false);
+}
+
+void ADC_Handler(void) {
+    uint16_t value = ADC->RESULT.reg; // reading the result clears the RESRDY flag
+    if (_watch_adc_periodic_callback) {
+        // scheduled sampling: deliver the value and stay armed for the next event.
+        _watch_adc_periodic_callback(value);
+        return;
+    }
+    NVIC_DisableIRQ(ADC_IRQn);
+    if (_watch_adc_callback) {
+        watch_adc_callback_t callback = _watch_adc_callback;
+        _watch_adc_callback = NULL;
+        callback(value);
     }
 }
 
@@ -127,10 +227,25 @@ void watch_set_analog_num_samples(uint16_t samples) {
     // make sure the desired value is within range and set it, if so.
     if (sample_val <= ADC_AVGCTRL_SAMPLENUM_1024_Val) {
         ADC->AVGCTRL.bit.SAMPLENUM = sample_val;
+        // accumulate mode: no averaging shift. @see watch_set_analog_oversampling
+        ADC->AVGCTRL.bit.ADJRES = 0;
         _watch_sync_adc();
     }
 }
 
+void watch_set_analog_oversampling(uint16_t samples) {
+    // ignore any input that's not a power of 2 (i.e. only one bit set)
+    if (__builtin_popcount(samples) != 1) return;
+    uint8_t sample_val = __builtin_ctz(samples);
+    // make sure the desired value is within range before touching anything.
+    if (sample_val > ADC_AVGCTRL_SAMPLENUM_1024_Val) return;
+    ADC->AVGCTRL.bit.SAMPLENUM = sample_val;
+    // right-shifting the accumulated result by min(log2(samples), 4) turns the sum into a
+    // 12-bit average, per the averaging table in the data sheet.
+    ADC->AVGCTRL.bit.ADJRES = (sample_val < 4) ? sample_val : 4;
+    _watch_sync_adc();
+}
+
 void watch_set_analog_sampling_length(uint8_t cycles) {
     // for clarity the API asks the user how many cycles they want the measurement to take.
     // but the ADC always needs at least one cycle; it just wants to know how many *extra* cycles we want.
@@ -184,7 +299,9 @@ uint16_t watch_get_vcc_voltage(void) {
     // restore the old reference, if needed.
     if (oldref != ADC_REFERENCE_INTREF) watch_set_analog_reference_voltage(oldref);
 
-    return (uint16_t)((raw_val * 1000) / (1024 * 1 << ADC->AVGCTRL.bit.SAMPLENUM));
+    // the accumulated result scales with the sample count, less any averaging shift.
+    uint32_t scale = (1 << ADC->AVGCTRL.bit.SAMPLENUM) >> ADC->AVGCTRL.bit.ADJRES;
+    return (uint16_t)((raw_val * 1000) / (1024 * scale));
 }
 
 inline void watch_disable_analog_input(const uint8_t pin) {
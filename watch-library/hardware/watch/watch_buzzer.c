@@ -23,6 +23,7 @@
  */
 
 #include "watch_buzzer.h"
+#include "watch_private.h"
 #include "../../../watch-library/hardware/include/saml22j18a.h"
 #include "../../../watch-library/hardware/include/component/tc.h"
 #include "../../../watch-library/hardware/hri/hri_tc_l22.h"
@@ -30,19 +31,13 @@
 void cb_watch_buzzer_seq(void);
 
 static uint16_t _seq_position;
-static int8_t _tone_ticks, _repeat_counter;
+static int16_t _tone_ticks;
+static int8_t _repeat_counter;
 static bool _callback_running = false;
 static int8_t *_sequence;
+static watch_buzzer_next_note_t _next_note;
 static void (*_cb_finished)(void);
 
-static void _tcc_write_RUNSTDBY(bool value) {
-    // enables or disables RUNSTDBY of the tcc
-    hri_tcc_clear_CTRLA_ENABLE_bit(TCC0);
-    hri_tcc_write_CTRLA_RUNSTDBY_bit(TCC0, value);
-    hri_tcc_set_CTRLA_ENABLE_bit(TCC0);
-    hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_ENABLE);
-}
-
 static inline void _tc3_start() {
     // start the TC3 timer
     hri_tc_set_CTRLA_ENABLE_bit(TC3);
@@ -73,9 +68,12 @@ static void _tc3_initialize() {
 }
 
 void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
-    if (_callback_running) _tc3_stop();
+    // aborting any sequence in progress also releases its TCC standby claim,
+    // keeping the request count balanced for the claim we make below.
+    if (_callback_running) watch_buzzer_abort_sequence();
     watch_set_buzzer_off();
     _sequence = note_sequence;
+    _next_note = NULL;
     _cb_finished = callback_on_end;
     _seq_position = 0;
     _tone_ticks = 0;
@@ -85,12 +83,48 @@ void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(v
     // setup TC3 timer
     _tc3_initialize();
     // TCC should run in standby mode
-    _tcc_write_RUNSTDBY(true);
+    _watch_request_tcc_runstdby(true);
+    // start the timer (for the 64 hz callback)
+    _tc3_start();
+}
+
+void watch_buzzer_play_stream(watch_buzzer_next_note_t next_note, void (*callback_on_end)(void)) {
+    if (_callback_running) watch_buzzer_abort_sequence();
+    watch_set_buzzer_off();
+    _sequence = NULL;
+    _next_note = next_note;
+    _cb_finished = callback_on_end;
+    _tone_ticks = 0;
+    // prepare buzzer
+    watch_enable_buzzer();
+    // setup TC3 timer
+    _tc3_initialize();
+    // TCC should run in standby mode
+    _watch_request_tcc_runstdby(true);
     // start the timer (for the 64 hz callback)
     _tc3_start();
 }
 
-void cb_watch_buzzer_seq(void) {
+WATCH_RAMFUNC void cb_watch_buzzer_seq(void) {
+    // streamed sequence: pull each note from the supplier instead of walking an array.
+    if (_next_note) {
+        if (_tone_ticks == 0) {
+            BuzzerNote note;
+            uint8_t duration;
+            if (_next_note(&note, &duration) && duration) {
+                if (note != BUZZER_NOTE_REST) {
+                    watch_set_buzzer_note(note);
+                    watch_set_buzzer_on();
+                } else watch_set_buzzer_off();
+                _tone_ticks = duration;
+            } else {
+                // supplier ran dry: end the sequence
+                watch_buzzer_abort_sequence();
+                if (_cb_finished) _cb_finished();
+            }
+        } else _tone_ticks--;
+        return;
+    }
     // callback for reading the note sequence
     if (_tone_ticks == 0) {
         if (_sequence[_seq_position] < 0 && _sequence[_seq_position + 1]) {
@@ -115,7 +149,7 @@ void cb_watch_buzzer_seq(void) {
             // read note
             BuzzerNote note = _sequence[_seq_position];
             if (note != BUZZER_NOTE_REST) {
-                watch_set_buzzer_period(NotePeriods[note]);
+                watch_set_buzzer_note(note);
                 watch_set_buzzer_on();
             } else watch_set_buzzer_off();
             // set duration ticks and move to next tone
@@ -132,12 +166,13 @@ void cb_watch_buzzer_seq(void) {
 void watch_buzzer_abort_sequence(void) {
     // ends/aborts the sequence
     if (_callback_running) _tc3_stop();
+    _next_note = NULL;
     watch_set_buzzer_off();
-    // disable standby mode for TCC
-    _tcc_write_RUNSTDBY(false);
+    // release our claim on TCC standby mode
+    _watch_request_tcc_runstdby(false);
 }
 
-void TC3_Handler(void) {
+WATCH_RAMFUNC void TC3_Handler(void) {
     // interrupt handler vor TC3 (globally!)
     cb_watch_buzzer_seq();
     TC3->COUNT8.INTFLAG.reg |= TC_INTFLAG_OVF;
@@ -149,9 +184,21 @@ inline void watch_enable_buzzer(void) {
     }
 }
 
+// right shift applied to the 50% compare values: 0, 2 or 4 bits for 50%, 12.5% or ~3% duty.
+static uint8_t _buzzer_duty_shift;
+
+void watch_set_buzzer_volume(watch_buzzer_volume_t volume) {
+    _buzzer_duty_shift = 2 * (uint8_t)volume;
+}
+
 inline void watch_set_buzzer_period(uint32_t period) {
     hri_tcc_write_PERBUF_reg(TCC0, period);
-    hri_tcc_write_CCBUF_reg(TCC0, WATCH_BUZZER_TCC_CHANNEL, period / 2);
+    hri_tcc_write_CCBUF_reg(TCC0, WATCH_BUZZER_TCC_CHANNEL, (period / 2) >> _buzzer_duty_shift);
+}
+
+inline void watch_set_buzzer_note(BuzzerNote note) {
+    hri_tcc_write_PERBUF_reg(TCC0, NotePeriods[note]);
+    hri_tcc_write_CCBUF_reg(TCC0, WATCH_BUZZER_TCC_CHANNEL, NoteDuties[note] >> _buzzer_duty_shift);
 }
 
 void watch_disable_buzzer(void) {
@@ -172,7 +219,7 @@ void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms) {
     if (note == BUZZER_NOTE_REST) {
         watch_set_buzzer_off();
     } else {
-        watch_set_buzzer_period(NotePeriods[note]);
+        watch_set_buzzer_note(note);
         watch_set_buzzer_on();
     }
     delay_ms(duration_ms);
@@ -143,6 +143,8 @@ static void _watch_disable_all_peripherals_except_slcd(void) {
     watch_disable_adc();
     watch_disable_external_interrupts();
     watch_disable_i2c();
+    // this is a real power-down, not a face bowing out: skip the scheduler's linger window.
+    _watch_i2c_quiesce(true);
     // TODO: replace this with a proper function when we remove the debug UART
     SERCOM3->USART.CTRLA.reg &= ~SERCOM_USART_CTRLA_ENABLE;
     MCLK->APBCMASK.reg &= ~MCLK_APBCMASK_SERCOM3;
@@ -0,0 +1,128 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_dma.h"
+#include "watch_private.h"
+
+// The DMAC at the register level: the ASF middleware is compiled out (CONF_DMAC_ENABLE
+// is 0), so this file owns the controller — the descriptor tables, the shared interrupt
+// and the channel map. Everything that claims a channel does it here:
+//   channel 0: SERCOM3 TX, the SPI scatter-gather transmit (watch_spi.c)
+//   channel 1: memory-to-memory copies (watch_dma_memcpy, below)
+#define WATCH_DMA_NUM_CHANNELS 2
+#define WATCH_DMA_CHANNEL_MEMCPY 1
+
+// first descriptors and write-back space for every channel, indexed by channel number;
+// BASEADDR and WRBADDR point at these, so they must cover the highest channel in use.
+DmacDescriptor _watch_dma_descriptors[WATCH_DMA_NUM_CHANNELS] __attribute__((aligned(16)));
+DmacDescriptor _watch_dma_writeback[WATCH_DMA_NUM_CHANNELS] __attribute__((aligned(16)));
+
+static void (*_channel_callbacks[WATCH_DMA_NUM_CHANNELS])(void);
+
+void _watch_dma_init(void) {
+    static bool initialized;
+    if (initialized) return;
+    initialized = true;
+
+    MCLK->AHBMASK.reg |= MCLK_AHBMASK_DMAC;
+    DMAC->CTRL.reg = 0;
+    DMAC->BASEADDR.reg = (uint32_t)_watch_dma_descriptors;
+    DMAC->WRBADDR.reg = (uint32_t)_watch_dma_writeback;
+    DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN0;
+    NVIC_ClearPendingIRQ(DMAC_IRQn);
+    NVIC_EnableIRQ(DMAC_IRQn);
+}
+
+void _watch_dma_register_channel_callback(uint8_t channel, void (*callback)(void)) {
+    _channel_callbacks[channel] = callback;
+}
+
+void DMAC_Handler(void) {
+    // one interrupt line serves all channels; INTPEND names the lowest pending one.
+    while (DMAC->INTPEND.reg & (DMAC_INTPEND_TCMPL | DMAC_INTPEND_TERR)) {
+        uint8_t channel = DMAC->INTPEND.bit.ID;
+        DMAC->CHID.reg = channel;
+        DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR;
+        if (channel < WATCH_DMA_NUM_CHANNELS && _channel_callbacks[channel]) _channel_callbacks[channel]();
+    }
+}
+
+// --------------------------------------------------------------------------------------
+// the memory-to-memory channel
+
+static void (*_memcpy_callback)(void);
+static volatile bool _memcpy_busy;
+
+static void _watch_dma_memcpy_complete(void) {
+    _memcpy_busy = false;
+    if (_memcpy_callback) _memcpy_callback();
+}
+
+void watch_dma_memcpy_wait(void) {
+    // idle until the end-of-block interrupt; other interrupts just re-run the loop.
+    while (_memcpy_busy) sleep(2);
+}
+
+void watch_dma_memcpy(void *dst, const void *src, uint16_t length, void (*callback)(void)) {
+    if (length == 0) {
+        if (callback) callback();
+        return;
+    }
+
+    _watch_dma_init();
+    _watch_dma_register_channel_callback(WATCH_DMA_CHANNEL_MEMCPY, _watch_dma_memcpy_complete);
+
+    // one copy at a time: a caller arriving early sleeps out the tail of the last one.
+    watch_dma_memcpy_wait();
+
+    // word beats when both buffers and the length are word aligned, byte beats otherwise.
+    DmacDescriptor *descriptor = &_watch_dma_descriptors[WATCH_DMA_CHANNEL_MEMCPY];
+    uint16_t btctrl = DMAC_BTCTRL_VALID | DMAC_BTCTRL_SRCINC | DMAC_BTCTRL_DSTINC | DMAC_BTCTRL_BLOCKACT_INT;
+    if ((((uint32_t)dst | (uint32_t)src | length) & 3) == 0) {
+        descriptor->BTCTRL.reg = btctrl | DMAC_BTCTRL_BEATSIZE_WORD;
+        descriptor->BTCNT.reg = length >> 2;
+    } else {
+        descriptor->BTCTRL.reg = btctrl | DMAC_BTCTRL_BEATSIZE_BYTE;
+        descriptor->BTCNT.reg = length;
+    }
+    // with incrementing addresses, SRCADDR and DSTADDR hold the address past the end.
+    descriptor->SRCADDR.reg = (uint32_t)src + length;
+    descriptor->DSTADDR.reg = (uint32_t)dst + length;
+    descriptor->DESCADDR.reg = 0;
+
+    _memcpy_callback = callback;
+    _memcpy_busy = true;
+
+    // CHID selects which channel the CH* registers address, and the interrupt handler
+    // switches it; keep the select-and-program sequence atomic against it.
+    __disable_irq();
+    DMAC->CHID.reg = WATCH_DMA_CHANNEL_MEMCPY;
+    DMAC->CHCTRLA.reg = 0;
+    // no peripheral trigger: the software trigger below launches the whole block.
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_LVL(0) | DMAC_CHCTRLB_TRIGACT_TRANSACTION;
+    DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL | DMAC_CHINTENSET_TERR;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+    DMAC->SWTRIGCTRL.reg = 1UL << WATCH_DMA_CHANNEL_MEMCPY;
+    __enable_irq();
+}
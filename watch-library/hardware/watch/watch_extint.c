@@ -92,6 +92,10 @@ void watch_register_interrupt_callback(const uint8_t pin, ext_irq_cb_t callback,
     hri_eic_config_reg_t config = EIC->CONFIG[config_index].reg;
     config &= ~(7 << sense_pos);
     config |= trigger << (sense_pos);
+    // The buttons get the EIC's majority-vote input filter, which samples the pin three times on
+    // the EIC clock (the 32.768 kHz crystal) and suppresses anything shorter. Contact bounce on
+    // the button domes otherwise shows up as spurious extra press/release interrupts.
+    if (pin == BTN_ALARM || pin == BTN_LIGHT || pin == BTN_MODE) config |= 1 << (sense_pos + 3);
     hri_eic_write_CONFIG_reg(EIC, config_index, config);
     // ...set the pin mode...
     gpio_set_pin_function(pin, GPIO_PIN_FUNCTION_A);
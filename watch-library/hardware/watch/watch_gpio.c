@@ -59,3 +59,29 @@ void watch_disable_digital_output(const uint8_t pin) {
 void watch_set_pin_level(const uint8_t pin, const bool level) {
     gpio_set_pin_level(pin, level);
 }
+
+// One WRCONFIG write applies the same pin configuration to up to 16 pins at once; the
+// two halves of the port are selected with HWSEL.
+static void _watch_wrconfig(PortGroup *group, uint32_t pins, uint32_t flags) {
+    if (pins & 0xFFFF) group->WRCONFIG.reg = PORT_WRCONFIG_WRPINCFG | flags | PORT_WRCONFIG_PINMASK(pins & 0xFFFF);
+    if (pins >> 16) group->WRCONFIG.reg = PORT_WRCONFIG_WRPINCFG | PORT_WRCONFIG_HWSEL | flags | PORT_WRCONFIG_PINMASK(pins >> 16);
+}
+
+void watch_configure_port(const uint8_t port, const uint32_t mask, const watch_gpio_config_t *config) {
+    PortGroup *group = &PORT->Group[port];
+    uint32_t inputs = config->input_pins & mask;
+    uint32_t outputs = config->output_pins & mask & ~inputs;
+    uint32_t pulls = config->pull_pins & inputs;
+    uint32_t high = config->high_pins & mask;
+
+    // levels before anything else: a pulled input pulls toward OUT, and an output
+    // drives OUT the moment DIR turns it on.
+    group->OUTSET.reg = high;
+    group->OUTCLR.reg = mask & ~high;
+    group->DIRSET.reg = outputs;
+    group->DIRCLR.reg = mask & ~outputs;
+    _watch_wrconfig(group, inputs & ~pulls, PORT_WRCONFIG_INEN);
+    _watch_wrconfig(group, pulls, PORT_WRCONFIG_INEN | PORT_WRCONFIG_PULLEN);
+    // outputs and unconfigured pins alike: plain GPIO, input buffer and pull off.
+    _watch_wrconfig(group, mask & ~inputs, 0);
+}
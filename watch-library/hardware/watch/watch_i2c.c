@@ -26,13 +26,51 @@
 
 struct io_descriptor *I2C_0_io;
 
-void watch_enable_i2c(void) {
+static watch_i2c_speed_t i2c_speed = WATCH_I2C_SPEED_STANDARD;
+
+// Programs SERCOM1's BAUD register for the selected speed. fSCL = fGCLK / (10 + 2·BAUD),
+// so the achievable ceiling is one tenth of the core clock: exactly 400 kHz at the usual
+// 4 MHz. The core clock rides generator 0 and thus the OSC16M, which watch_cpu_boost
+// scales, so read the real frequency instead of assuming the configured 4 MHz — a speed
+// change inside a boost scope still lands on the requested SCL rate. (A transfer that
+// straddles a boost transition scales with the clock; that quirk predates this function.)
+// BAUD is enable-protected: callers bracket this with disable/enable.
+static void _watch_i2c_apply_speed(void) {
+    static const uint8_t osc16m_mhz[] = { 4, 8, 12, 16 };
+    uint32_t fgclk = (uint32_t)osc16m_mhz[OSCCTRL->OSC16MCTRL.bit.FSEL] * 1000000;
+    uint32_t fscl = (i2c_speed == WATCH_I2C_SPEED_FAST) ? 400000 : 100000;
+    uint32_t cycles_per_bit = fgclk / fscl;
+    uint32_t baud = cycles_per_bit > 10 ? (cycles_per_bit - 10) / 2 : 0;
+    hri_sercomi2cm_write_BAUD_BAUD_bf(SERCOM1, baud > 255 ? 255 : baud);
+}
+
+void watch_i2c_set_speed(watch_i2c_speed_t speed) {
+    if (speed == i2c_speed) return;
+    i2c_speed = speed;
+    // the bus may be powered down right now; the new speed is applied at the next power-up.
+    if (!hri_sercomi2cm_get_CTRLA_ENABLE_bit(SERCOM1)) return;
+    // never yank the clock out from under an interrupt-driven transfer.
+    while (watch_i2c_is_async_busy());
+    i2c_m_sync_disable(&I2C_0);
+    _watch_i2c_apply_speed();
+    i2c_m_sync_enable(&I2C_0);
+}
+
+void _watch_enable_i2c_peripheral(void) {
     I2C_0_init();
+    // let the SERCOM request its generic clock in STANDBY. this is what allows an
+    // asynchronous receive to keep clocking bytes while the device sleeps: each byte's
+    // interrupt wakes the CPU just long enough to run the handler below. RUNSTDBY is
+    // enable-protected, so it has to go in before i2c_m_sync_enable sets ENABLE.
+    hri_sercomi2cm_set_CTRLA_RUNSTDBY_bit(SERCOM1);
+    // I2C_0_init programmed the standard-mode baud rate from the config; reapply the
+    // selected speed while the SERCOM is still disabled.
+    _watch_i2c_apply_speed();
     i2c_m_sync_get_io_descriptor(&I2C_0, &I2C_0_io);
     i2c_m_sync_enable(&I2C_0);
 }
 
-void watch_disable_i2c(void) {
+void _watch_disable_i2c_peripheral(void) {
     i2c_m_sync_disable(&I2C_0);
 	hri_mclk_clear_APBCMASK_SERCOM1_bit(MCLK);
 }
@@ -47,6 +85,82 @@ void watch_i2c_receive(int16_t addr, uint8_t *buf, uint16_t length) {
     io_read(I2C_0_io, buf, length);
 }
 
+// State for the asynchronous receive. The transfer runs entirely in the SERCOM1 interrupt
+// handler: instead of busy-waiting for the whole transfer like watch_i2c_receive, the CPU takes
+// one short interrupt per byte and can sleep in between, which matters for multi-byte sensor
+// bursts like draining the accelerometer FIFO. The SERCOM1 interrupt is only enabled while a
+// transfer is in flight, so the synchronous functions above can keep polling INTFLAG safely.
+static struct {
+    uint8_t *buf;
+    uint16_t remaining;
+    watch_i2c_callback_t callback;
+    volatile bool busy;
+} i2c_async;
+
+static void _watch_i2c_async_finish(void) {
+    hri_sercomi2cm_clear_INTEN_SB_bit(SERCOM1);
+    hri_sercomi2cm_clear_INTEN_MB_bit(SERCOM1);
+    hri_sercomi2cm_clear_INTEN_ERROR_bit(SERCOM1);
+    NVIC_DisableIRQ(SERCOM1_IRQn);
+    i2c_async.busy = false;
+    if (i2c_async.callback) i2c_async.callback();
+}
+
+void SERCOM1_Handler(void) {
+    uint8_t flags = hri_sercomi2cm_read_INTFLAG_reg(SERCOM1);
+
+    if (flags & SERCOM_I2CM_INTFLAG_SB) {
+        if (i2c_async.remaining == 1) {
+            // last byte: NACK it and issue a stop before reading it out. with smart mode off,
+            // reading DATA doesn't trigger any further bus activity.
+            hri_sercomi2cm_set_CTRLB_ACKACT_bit(SERCOM1);
+            hri_sercomi2cm_clear_CTRLB_SMEN_bit(SERCOM1);
+            hri_sercomi2cm_set_CTRLB_CMD_bf(SERCOM1, 0x3);
+            *i2c_async.buf++ = hri_sercomi2cm_read_DATA_reg(SERCOM1);
+            i2c_async.remaining = 0;
+            hri_sercomi2cm_clear_interrupt_SB_bit(SERCOM1);
+            _watch_i2c_async_finish();
+        } else {
+            // in smart mode, reading DATA sends our ACK and clocks in the next byte.
+            i2c_async.remaining--;
+            *i2c_async.buf++ = hri_sercomi2cm_read_DATA_reg(SERCOM1);
+            hri_sercomi2cm_clear_interrupt_SB_bit(SERCOM1);
+        }
+    } else if (flags & (SERCOM_I2CM_INTFLAG_MB | SERCOM_I2CM_INTFLAG_ERROR)) {
+        // MB during a read means the device NACKed its address; ERROR is a bus error.
+        // either way, free the bus and give up on the transfer.
+        hri_sercomi2cm_set_CTRLB_CMD_bf(SERCOM1, 0x3);
+        hri_sercomi2cm_clear_interrupt_MB_bit(SERCOM1);
+        hri_sercomi2cm_clear_interrupt_ERROR_bit(SERCOM1);
+        i2c_async.remaining = 0;
+        _watch_i2c_async_finish();
+    }
+}
+
+bool watch_i2c_receive_async(int16_t addr, uint8_t *buf, uint16_t length, watch_i2c_callback_t callback) {
+    if (i2c_async.busy || length == 0) return false;
+    i2c_async.buf = buf;
+    i2c_async.remaining = length;
+    i2c_async.callback = callback;
+    i2c_async.busy = true;
+
+    // smart mode: an ACK (per ACKACT) goes out automatically each time we read DATA.
+    hri_sercomi2cm_clear_CTRLB_ACKACT_bit(SERCOM1);
+    hri_sercomi2cm_set_CTRLB_SMEN_bit(SERCOM1);
+    hri_sercomi2cm_set_INTEN_SB_bit(SERCOM1);
+    hri_sercomi2cm_set_INTEN_MB_bit(SERCOM1);
+    hri_sercomi2cm_set_INTEN_ERROR_bit(SERCOM1);
+    NVIC_ClearPendingIRQ(SERCOM1_IRQn);
+    NVIC_EnableIRQ(SERCOM1_IRQn);
+    // writing the device's address with the read bit set starts the transfer.
+    hri_sercomi2cm_write_ADDR_reg(SERCOM1, ((addr & 0x7F) << 1) | 1);
+    return true;
+}
+
+bool watch_i2c_is_async_busy(void) {
+    return i2c_async.busy;
+}
+
 void watch_i2c_write8(int16_t addr, uint8_t reg, uint8_t data) {
     uint8_t buf[2];
     buf[0] = reg;
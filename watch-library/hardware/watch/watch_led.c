@@ -23,6 +23,140 @@
  */
 
 #include "watch_led.h"
+#include "watch_private.h"
+#include "../../../watch-library/hardware/include/saml22j18a.h"
+#include "../../../watch-library/hardware/include/component/tc.h"
+#include "../../../watch-library/hardware/hri/hri_tc_l22.h"
+
+static uint8_t _auto_off_red, _auto_off_green;
+static uint8_t _fade_step;
+static bool _fading;
+static bool _auto_off_active = false;
+static bool _tc1_configured = false;
+static bool _blink_active = false;
+static bool _blink_is_on;
+static uint8_t _blink_red, _blink_green;
+static uint16_t _blink_on_ticks, _blink_off_ticks;
+
+// the fade-out runs at the timer's full 32 Hz resolution, one step per tick.
+#define WATCH_LED_FADE_STEPS 8
+
+static void _tc1_stop(void) {
+    // stop the TC1 timer
+    hri_tc_clear_CTRLA_ENABLE_bit(TC1);
+    hri_tc_wait_for_sync(TC1, TC_SYNCBUSY_ENABLE);
+}
+
+static void _tc1_start_interval(uint16_t ticks) {
+    // (re)start TC1 to fire an overflow interrupt after the given number of 32 Hz ticks.
+    _tc1_stop();
+    hri_tccount16_write_COUNT_reg(TC1, 0);
+    hri_tccount16_write_CC_reg(TC1, 0, ticks ? ticks : 1); // match frequency mode: CC0 is the period
+    hri_tc_set_CTRLA_ENABLE_bit(TC1);
+}
+
+static void _tc1_initialize(void) {
+    // setup and initialize TC1 as the LED auto-off timer: 16-bit match frequency mode,
+    // 32.768 kHz GCLK3 divided by 1024 for 32 Hz resolution, running in standby.
+    // (TC0 is the USB service tick, TC2 the fast timer, TC3 the buzzer sequencer.)
+    hri_mclk_set_APBCMASK_TC1_bit(MCLK);
+    // TC0 and TC1 share GCLK peripheral channel 23, so this write also clocks the USB
+    // service tick; _watch_enable_usb programs the same GCLK3 source for that reason.
+    hri_gclk_write_PCHCTRL_reg(GCLK, TC1_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK3 | GCLK_PCHCTRL_CHEN);
+    _tc1_stop();
+    hri_tc_write_CTRLA_reg(TC1, TC_CTRLA_SWRST);
+    hri_tc_wait_for_sync(TC1, TC_SYNCBUSY_SWRST);
+    hri_tc_write_CTRLA_reg(TC1, TC_CTRLA_PRESCALER_DIV1024 |
+                           TC_CTRLA_MODE_COUNT16 |
+                           TC_CTRLA_RUNSTDBY);
+    hri_tc_write_WAVE_reg(TC1, TC_WAVE_WAVEGEN_MFRQ);
+    hri_tc_set_INTEN_OVF_bit(TC1);
+    NVIC_ClearPendingIRQ(TC1_IRQn);
+    NVIC_EnableIRQ(TC1_IRQn);
+}
+
+void watch_led_illuminate_with_auto_off(uint8_t red, uint8_t green, uint16_t duration_ms) {
+    if (_blink_active) watch_led_blink_stop(); // the two modes share TC1; last caller wins
+    watch_enable_leds();
+    watch_set_led_color(red, green);
+    _auto_off_red = red;
+    _auto_off_green = green;
+    _fading = false;
+    if (!_tc1_configured) {
+        _tc1_initialize();
+        _tc1_configured = true;
+    }
+    // PWM colors only display correctly in STANDBY if the TCC keeps running there.
+    // the claim is counted, so only make it once even if the button is mashed.
+    if (!_auto_off_active) {
+        _auto_off_active = true;
+        _watch_request_tcc_runstdby(true);
+    }
+    _tc1_start_interval((uint32_t)duration_ms * 32 / 1000);
+}
+
+void watch_led_blink_pattern(uint8_t red, uint8_t green, uint16_t on_ms, uint16_t off_ms) {
+    watch_enable_leds();
+    if (!_tc1_configured) {
+        _tc1_initialize();
+        _tc1_configured = true;
+    }
+    if (_auto_off_active) {
+        // take TC1 over from a pending auto-off; release its runstdby claim.
+        _auto_off_active = false;
+        _fading = false;
+        _watch_request_tcc_runstdby(false);
+    }
+    _blink_red = red;
+    _blink_green = green;
+    _blink_on_ticks = (uint32_t)on_ms * 32 / 1000;
+    _blink_off_ticks = (uint32_t)off_ms * 32 / 1000;
+    if (!_blink_active) {
+        _blink_active = true;
+        _watch_request_tcc_runstdby(true);
+    }
+    // start with the LED lit, as a caller watching for the first blink would expect.
+    _blink_is_on = true;
+    watch_set_led_color(red, green);
+    _tc1_start_interval(_blink_on_ticks);
+}
+
+void watch_led_blink_stop(void) {
+    if (!_blink_active) return;
+    _blink_active = false;
+    _tc1_stop();
+    watch_set_led_off();
+    _watch_request_tcc_runstdby(false);
+}
+
+void TC1_Handler(void) {
+    TC1->COUNT16.INTFLAG.reg |= TC_INTFLAG_OVF;
+    if (_blink_active) {
+        _blink_is_on = !_blink_is_on;
+        if (_blink_is_on) watch_set_led_color(_blink_red, _blink_green);
+        else watch_set_led_off();
+        _tc1_start_interval(_blink_is_on ? _blink_on_ticks : _blink_off_ticks);
+        return;
+    }
+    if (!_fading) {
+        if (watch_get_pin_level(BTN_LIGHT)) {
+            // the wearer is still holding the LIGHT button; give them another second.
+            _tc1_start_interval(32);
+            return;
+        }
+        _fading = true;
+        _fade_step = WATCH_LED_FADE_STEPS;
+        _tc1_start_interval(1);
+    } else if (--_fade_step) {
+        watch_set_led_color((_auto_off_red * _fade_step) / WATCH_LED_FADE_STEPS,
+                            (_auto_off_green * _fade_step) / WATCH_LED_FADE_STEPS);
+    } else {
+        _tc1_stop();
+        watch_set_led_off();
+        _auto_off_active = false;
+        _watch_request_tcc_runstdby(false);
+    }
+}
 
 void watch_enable_leds(void) {
     if (!hri_tcc_get_CTRLA_reg(TCC0, TCC_CTRLA_ENABLE)) {
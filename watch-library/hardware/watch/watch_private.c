@@ -27,9 +27,31 @@
 #include "tusb.h"
 
 void _watch_init(void) {
+    // paint the unused stack so movement_get_memory_stats can measure the deepest
+    // excursion later. This early in boot everything below the current stack pointer
+    // (less a small margin for this loop's own frame) is still virgin.
+    extern uint32_t _sstack;
+    uint32_t *stack_fill_top = (uint32_t *)(__get_MSP() - 32);
+    for (uint32_t *p = &_sstack; p < stack_fill_top; p++) *p = WATCH_STACK_FILL_WORD;
+
     // disable the LED pin (it may have been enabled by the bootloader)
     watch_disable_digital_output(GPIO(GPIO_PORTA, 20));
 
+    // every APBC peripheral comes out of reset with its bus clock enabled, used or not.
+    // gate the lot: each driver sets its own mask bit when opened (and clears it when
+    // closed), so from here on the mask reflects what is actually in use — which is also
+    // what the `clocks` shell command prints. TC0 stays if the USB service task already
+    // claimed it; with no USB this boot, its bus clocks get gated too.
+    if (watch_is_usb_enabled()) {
+        MCLK->APBCMASK.reg = MCLK_APBCMASK_TC0;
+    } else {
+        MCLK->APBCMASK.reg = 0;
+        MCLK->APBBMASK.reg &= ~MCLK_APBBMASK_USB;
+        MCLK->AHBMASK.reg &= ~MCLK_AHBMASK_USB;
+    }
+    // the DMA controller's clock is claimed by the SPI driver when a transfer needs it.
+    MCLK->AHBMASK.reg &= ~MCLK_AHBMASK_DMAC;
+
     // RAM should be back-biased in STANDBY
     PM->STDBYCFG.bit.BBIASHS = 1;
 
@@ -49,6 +71,12 @@ void _watch_init(void) {
         SUPC->VREG.bit.LPEFF = 0;
     }
 
+    // ASF's chip init leaves us at performance level 2, but the 4 MHz core clock is well
+    // within PL0's reach with zero flash wait states; the lower core voltage trims supply
+    // current from every active cycle. USB is the one thing that needs PL2 (its 48 MHz
+    // DFLL won't run below it), so stay there when plugged in.
+    watch_set_performance_level(0);
+
     // set up the brownout detector (low battery warning)
     NVIC_DisableIRQ(SYSTEM_IRQn);
     NVIC_ClearPendingIRQ(SYSTEM_IRQn);
@@ -172,6 +200,21 @@ void _watch_disable_tcc(void) {
     hri_mclk_clear_APBCMASK_TCC0_bit(MCLK);
 }
 
+void _watch_request_tcc_runstdby(bool value) {
+    static uint8_t requests = 0;
+    if (value) {
+        if (requests++) return;     // RUNSTDBY is already set
+    } else {
+        if (requests == 0) return;
+        if (--requests) return;     // another engine still needs it
+    }
+    if (!hri_tcc_get_CTRLA_reg(TCC0, TCC_CTRLA_ENABLE)) return;
+    hri_tcc_clear_CTRLA_ENABLE_bit(TCC0);
+    hri_tcc_write_CTRLA_RUNSTDBY_bit(TCC0, value);
+    hri_tcc_set_CTRLA_ENABLE_bit(TCC0);
+    hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_ENABLE);
+}
+
 void _watch_enable_usb(void) {
     // disable USB, just in case.
     hri_usb_clear_CTRLA_ENABLE_bit(USB);
@@ -216,10 +259,17 @@ void _watch_enable_usb(void) {
     gpio_set_pin_function(PIN_PA24, PINMUX_PA24G_USB_DM);
     gpio_set_pin_function(PIN_PA25, PINMUX_PA25G_USB_DP);
 
-    // before we init TinyUSB, we are going to need a periodic callback to handle TinyUSB tasks.
+    // before we init TinyUSB, we need an interrupt context to run its device task in.
     // TC2 and TC3 are reserved for devices on the 9-pin connector, so let's use TC0.
-    // clock TC0 with the 8 MHz clock on GCLK0.
-    hri_gclk_write_PCHCTRL_reg(GCLK, TC0_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK0_Val | GCLK_PCHCTRL_CHEN);
+    // The timer itself barely matters anymore: USB_Handler pends this interrupt whenever
+    // the peripheral has raised an event, so tud_task runs exactly when there is work,
+    // and the free-running overflow is just a ~32 Hz safety net for anything a pend
+    // might miss. That is what lets main() sleep in IDLE while plugged in instead of
+    // spinning a 1 kHz poll.
+    // clock TC0 with the 32.768 kHz clock on GCLK3. TC0 and TC1 share GCLK peripheral
+    // channel 23, and TC1 (the LED auto-off timer in watch_led.c) needs a source that
+    // keeps ticking in STANDBY — so both sides agree on the slow clock.
+    hri_gclk_write_PCHCTRL_reg(GCLK, TC0_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK3 | GCLK_PCHCTRL_CHEN);
     // and enable the peripheral clock.
     hri_mclk_set_APBCMASK_TC0_bit(MCLK);
     // disable and reset TC0.
@@ -227,13 +277,16 @@ void _watch_enable_usb(void) {
     hri_tc_wait_for_sync(TC0, TC_SYNCBUSY_ENABLE);
     hri_tc_write_CTRLA_reg(TC0, TC_CTRLA_SWRST);
     hri_tc_wait_for_sync(TC0, TC_SYNCBUSY_SWRST);
-    // configure the TC to overflow 1,000 times per second
-    hri_tc_write_CTRLA_reg(TC0, TC_CTRLA_PRESCALER_DIV64 |  // divide the 8 MHz clock by 64 to count at 125 KHz
-                                TC_CTRLA_MODE_COUNT8 |      // count in 8-bit mode
-                                TC_CTRLA_RUNSTDBY);         // run in standby, just in case we figure that out
-    hri_tccount8_write_PER_reg(TC0, 125);                   // 125000 Hz / 125 = 1,000 Hz
+    // configure the TC to overflow about 32 times per second as the safety net cadence
+    hri_tc_write_CTRLA_reg(TC0, TC_CTRLA_PRESCALER_DIV256 |     // divide the 32.768 kHz clock by 256 to count at 128 Hz
+                                TC_CTRLA_MODE_COUNT8 |          // count in 8-bit mode
+                                TC_CTRLA_RUNSTDBY);             // run in standby, just in case we figure that out
+    hri_tccount8_write_PER_reg(TC0, 3);                         // 128 Hz / 4 = 32 Hz
     // set an interrupt on overflow; this will call TC0_Handler below.
     hri_tc_set_INTEN_OVF_bit(TC0);
+    // run below the USB interrupt, so USB_Handler can preempt the service task to queue
+    // more events (and re-pend us) while we're mid-run.
+    NVIC_SetPriority(TC0_IRQn, 3);
     NVIC_ClearPendingIRQ(TC0_IRQn);
     NVIC_EnableIRQ (TC0_IRQn);
 
@@ -243,45 +296,143 @@ void _watch_enable_usb(void) {
     hri_tc_set_CTRLA_ENABLE_bit(TC0);
 }
 
+// set when bytes are sitting in the CDC FIFO without a flush behind them; the USB
+// service task picks these up, so a partial line waits at most one safety-net tick.
+static volatile bool _stdout_flush_pending = false;
+
 // this function ends up getting called by printf to log stuff to the USB console.
+// Output is line-batched: bytes accumulate in tinyUSB's FIFO and a flush — which hands
+// full endpoint-sized packets to the USB peripheral's per-endpoint DMA — is only started
+// on a newline, when the FIFO fills, or from the service task's timeout below. Flushing
+// after every call put a short packet on the wire per printf, and an instrumentation
+// dump made of many small printfs spent more time starting transfers than filling them.
 int _write(int file, char *ptr, int len) {
     (void)file;
     if (hri_usbdevice_get_CTRLA_ENABLE_bit(USB)) {
-        tud_cdc_n_write(0, (void const*)ptr, len);
-        tud_cdc_n_write_flush(0);
-        return len;
+        // tinyUSB's FIFO may accept fewer bytes than we have; keep pushing until
+        // everything is queued (each completed IN transfer re-pends the USB service
+        // task, so the FIFO drains out from under us), bailing only if the host
+        // disappears.
+        int written = 0;
+        while (written < len) {
+            uint32_t count = tud_cdc_n_write(0, (void const*)(ptr + written), len - written);
+            written += count;
+            if (count == 0) {
+                tud_cdc_n_write_flush(0);
+                if (!tud_cdc_n_connected(0)) break;
+            }
+        }
+        if (len > 0 && memchr(ptr, '\n', len) != NULL) {
+            tud_cdc_n_write_flush(0);
+            _stdout_flush_pending = false;
+        } else if (written > 0) {
+            _stdout_flush_pending = true;
+        }
+        return written;
     }
 
     return 0;
 }
 
-static char buf[256] = {0};
+// Incoming CDC bytes land in this ring buffer from the USB task. The USB peripheral has
+// already DMA'd each packet into its endpoint buffer; draining the endpoint into the ring
+// at interrupt time means nothing is dropped if the main loop is slow to read. (The old
+// single snapshot buffer here lost anything that arrived between two polls of read().)
+static uint8_t _usb_rx_buffer[1024];
+static volatile uint16_t _usb_rx_head = 0;  // the USB task writes here...
+static volatile uint16_t _usb_rx_tail = 0;  // ...and _read consumes from here.
 
 int _read(int file, char *ptr, int len) {
     (void)file;
-    int actual_length = strlen(buf);
-    if (actual_length) {
-        memcpy(ptr, buf, min(len, actual_length));
-        return actual_length;
+    int count = 0;
+    while (count < len && _usb_rx_tail != _usb_rx_head) {
+        ptr[count++] = (char)_usb_rx_buffer[_usb_rx_tail];
+        _usb_rx_tail = (_usb_rx_tail + 1) % sizeof(_usb_rx_buffer);
     }
-    return 0;
+    return count;
 }
 
 void USB_Handler(void) {
     tud_int_handler(0);
+    // tud_int_handler only queues the event; pend the lower-priority TC0 interrupt to
+    // run tud_task as a bottom half once we return. Scheduling the service task off the
+    // USB interrupt itself (instead of a free-running poll) is what lets the CPU halt
+    // between bus events during long provisioning sessions.
+    NVIC_SetPendingIRQ(TC0_IRQn);
 }
 
 static void cdc_task(void) {
-    if (tud_cdc_n_available(0)) {
-        tud_cdc_n_read(0, buf, sizeof(buf));
-    } else {
-        memset(buf, 0, 256);
+    // timeout flush for unterminated output: a prompt or progress fragment with no
+    // newline goes out on the next service pass instead of waiting in the FIFO forever.
+    if (_stdout_flush_pending) {
+        _stdout_flush_pending = false;
+        tud_cdc_n_write_flush(0);
+    }
+
+    while (tud_cdc_n_available(0)) {
+        uint16_t head = _usb_rx_head;
+        uint16_t space = (uint16_t)((_usb_rx_tail + sizeof(_usb_rx_buffer) - 1 - head) % sizeof(_usb_rx_buffer));
+        if (space == 0) break; // ring is full; leave the rest in the USB FIFO for next time.
+        uint16_t span = min(space, (uint16_t)(sizeof(_usb_rx_buffer) - head));
+        uint32_t count = tud_cdc_n_read(0, &_usb_rx_buffer[head], span);
+        if (count == 0) break;
+        _usb_rx_head = (head + count) % sizeof(_usb_rx_buffer);
+    }
+}
+
+// The HID keyboard types from this buffer. A watch face queues a whole string with
+// watch_usb_hid_type_string and goes back to sleep; the USB service task below drains it
+// one report at a time, alternating a key press and the all-keys-up release the host
+// needs between repeated characters. Each report's completion interrupt re-pends the
+// service task, so at the interface's 4 ms polling interval a six-digit code is on the
+// host in about 50 ms, with no extra wakes on our side.
+static char _hid_type_buffer[32];
+static volatile uint8_t _hid_type_pos = 0;
+static volatile uint8_t _hid_type_len = 0;
+static bool _hid_key_down = false;
+
+bool watch_usb_hid_type_string(const char *str) {
+    if (!hri_usbdevice_get_CTRLA_ENABLE_bit(USB) || !tud_hid_ready()) return false;
+    if (_hid_type_pos < _hid_type_len) return false; // still typing the last string
+    size_t len = strlen(str);
+    if (len > sizeof(_hid_type_buffer)) return false;
+    memcpy(_hid_type_buffer, str, len);
+    _hid_type_pos = 0;
+    _hid_type_len = len; // write the length last; it is what hands the buffer to the pump
+    NVIC_SetPendingIRQ(TC0_IRQn); // kick the service task to send the first report now
+    return true;
+}
+
+static void hid_task(void) {
+    if (_hid_type_pos >= _hid_type_len) return;
+    if (!tud_hid_ready()) return;
+
+    if (_hid_key_down) {
+        // release the key; the host needs the gap to register repeated characters.
+        tud_hid_keyboard_report(0, 0, NULL);
+        _hid_key_down = false;
+        _hid_type_pos++;
+        return;
     }
+
+    static const uint8_t conv_table[128][2] = { HID_ASCII_TO_KEYCODE };
+    uint8_t chr = (uint8_t)_hid_type_buffer[_hid_type_pos];
+    if (chr > 127 || conv_table[chr][1] == 0) {
+        _hid_type_pos++; // no keycode for this character; skip it.
+        return;
+    }
+    uint8_t keycode[6] = { conv_table[chr][1] };
+    tud_hid_keyboard_report(0, conv_table[chr][0] ? KEYBOARD_MODIFIER_LEFTSHIFT : 0, keycode);
+    _hid_key_down = true;
 }
 
+// The USB service task. Runs when USB_Handler pends it (there are queued events to
+// process) and on TC0's slow safety-net overflow; with an empty event queue all three
+// calls return almost immediately.
 void TC0_Handler(void) {
     tud_task();
     cdc_task();
+    hid_task();
     TC0->COUNT8.INTFLAG.reg |= TC_INTFLAG_OVF;
 }
 
@@ -354,15 +505,23 @@ uint8_t const * tud_descriptor_device_cb(void) {
 enum {
   ITF_NUM_CDC = 0,
   ITF_NUM_CDC_DATA,
+  ITF_NUM_MSC,
+  ITF_NUM_HID,
   ITF_NUM_TOTAL
 };
 
-#define CONFIG_TOTAL_LEN    (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN)
+#define CONFIG_TOTAL_LEN    (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN + TUD_MSC_DESC_LEN + TUD_HID_DESC_LEN)
 
 #define EPNUM_CDC_NOTIF   0x81
 #define EPNUM_CDC_OUT     0x02
 #define EPNUM_CDC_IN      0x82
+#define EPNUM_MSC_OUT     0x03
+#define EPNUM_MSC_IN      0x83
+#define EPNUM_HID_IN      0x84
 
+uint8_t const desc_hid_report[] = {
+  TUD_HID_REPORT_DESC_KEYBOARD()
+};
 
 uint8_t const desc_fs_configuration[] = {
   // Config number, interface count, string index, total length, attribute, power in mA
@@ -370,6 +529,12 @@ uint8_t const desc_fs_configuration[] = {
 
   // Interface number, string index, EP notification address and size, EP data address (out, in) and size.
   TUD_CDC_DESCRIPTOR(ITF_NUM_CDC, 4, EPNUM_CDC_NOTIF, 8, EPNUM_CDC_OUT, EPNUM_CDC_IN, 64),
+
+  // Interface number, string index, EP data address (out, in) and size.
+  TUD_MSC_DESCRIPTOR(ITF_NUM_MSC, 5, EPNUM_MSC_OUT, EPNUM_MSC_IN, 64),
+
+  // Interface number, string index, protocol, report descriptor len, EP In address, size and polling interval.
+  TUD_HID_DESCRIPTOR(ITF_NUM_HID, 6, HID_ITF_PROTOCOL_KEYBOARD, sizeof(desc_hid_report), EPNUM_HID_IN, CFG_TUD_HID_EP_BUFSIZE, 4),
 };
 
 // Invoked when received GET CONFIGURATION DESCRIPTOR
@@ -392,6 +557,8 @@ char const* string_desc_arr [] =
   "TinyUSB Device",              // 2: Product
   "123456",                      // 3: Serials, should use chip ID
   "TinyUSB CDC",                 // 4: CDC Interface
+  "TinyUSB MSC",                 // 5: MSC Interface
+  "TinyUSB HID",                 // 6: HID Interface
 };
 
 static uint16_t _desc_str[32];
@@ -431,3 +598,152 @@ uint16_t const* tud_descriptor_string_cb(uint8_t index, uint16_t langid)
 
     return _desc_str;
 }
+
+//--------------------------------------------------------------------+
+// Mass Storage callbacks
+//--------------------------------------------------------------------+
+
+// LUN 0 exposes the littlefs region as a raw, read-only block device: pull the whole
+// image off with dd (or any raw disk tool) and mount it on the host with littlefs-fuse.
+// The RWWEE EEPROM is memory mapped, so block reads are served straight from the NVM
+// address; the only RAM the data passes through is the MSC endpoint buffer.
+// Build with SPIFLASH_MSC=1 on boards with the flash chip (e.g. Sensor Watch Flash)
+// to expose it the same way as a second LUN.
+
+#define MSC_BLOCK_SIZE      512
+#define MSC_LUN_FILESYSTEM  0
+#define MSC_LUN_SPI_FLASH   1
+
+#ifdef SPIFLASH_MSC
+
+#include "spiflash.h"
+
+static uint32_t _spi_flash_block_count = 0;
+
+static void _spi_flash_probe(void) {
+    static bool probed = false;
+    if (probed) return;
+    probed = true;
+    spi_flash_init();
+    spi_flash_command(CMD_WAKE);
+    // the third JEDEC ID byte encodes the capacity as a power of two.
+    uint8_t jedec_id[3] = {0};
+    spi_flash_read_command(CMD_READ_JEDEC_ID, jedec_id, 3);
+    if (jedec_id[0] == 0x00 || jedec_id[0] == 0xFF) return; // no chip on the bus
+    _spi_flash_block_count = (1UL << jedec_id[2]) / MSC_BLOCK_SIZE;
+}
+
+uint8_t tud_msc_get_maxlun_cb(void) {
+    return 2;
+}
+
+#endif
+
+void tud_msc_inquiry_cb(uint8_t lun, uint8_t vendor_id[8], uint8_t product_id[16], uint8_t product_rev[4]) {
+    const char *product = (lun == MSC_LUN_FILESYSTEM) ? "Filesystem" : "SPI Flash";
+    memcpy(vendor_id, "TinyUSB", 7);
+    memcpy(product_id, product, strlen(product));
+    memcpy(product_rev, "1.0", 3);
+}
+
+bool tud_msc_test_unit_ready_cb(uint8_t lun) {
+    if (lun == MSC_LUN_FILESYSTEM) return true;
+#ifdef SPIFLASH_MSC
+    _spi_flash_probe();
+    if (_spi_flash_block_count) return true;
+#endif
+    tud_msc_set_sense(lun, SCSI_SENSE_NOT_READY, 0x3A, 0x00); // medium not present
+    return false;
+}
+
+void tud_msc_capacity_cb(uint8_t lun, uint32_t *block_count, uint16_t *block_size) {
+    if (lun == MSC_LUN_FILESYSTEM) {
+        *block_count = (NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES) / MSC_BLOCK_SIZE;
+    } else {
+#ifdef SPIFLASH_MSC
+        *block_count = _spi_flash_block_count;
+#else
+        *block_count = 0;
+#endif
+    }
+    *block_size = MSC_BLOCK_SIZE;
+}
+
+bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, bool load_eject) {
+    (void) lun;
+    (void) power_condition;
+    (void) start;
+    (void) load_eject;
+    return true;
+}
+
+int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buffer, uint32_t bufsize) {
+    if (lun == MSC_LUN_FILESYSTEM) {
+        if ((lba * MSC_BLOCK_SIZE) + offset + bufsize > NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES) return -1;
+        watch_storage_sync(); // wait out any littlefs program or erase in flight
+        memcpy(buffer, (uint8_t const *)(NVMCTRL_RWW_EEPROM_ADDR + (lba * MSC_BLOCK_SIZE) + offset), bufsize);
+        return bufsize;
+    }
+#ifdef SPIFLASH_MSC
+    if ((lba + (offset + bufsize + MSC_BLOCK_SIZE - 1) / MSC_BLOCK_SIZE) <= _spi_flash_block_count) {
+        if (spi_flash_read_data((lba * MSC_BLOCK_SIZE) + offset, buffer, bufsize)) return bufsize;
+    }
+#endif
+    return -1;
+}
+
+bool tud_msc_is_writable_cb(uint8_t lun) {
+    (void) lun;
+    return false;
+}
+
+int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *buffer, uint32_t bufsize) {
+    (void) lba;
+    (void) offset;
+    (void) buffer;
+    (void) bufsize;
+    // both LUNs are read-only; littlefs owns the storage, and letting the host
+    // scribble raw blocks under it could only end in tears.
+    tud_msc_set_sense(lun, SCSI_SENSE_DATA_PROTECT, 0x27, 0x00); // write protected
+    return -1;
+}
+
+int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16], void *buffer, uint16_t bufsize) {
+    (void) buffer;
+    (void) bufsize;
+
+    switch (scsi_cmd[0]) {
+        case SCSI_CMD_PREVENT_ALLOW_MEDIUM_REMOVAL:
+            return 0;
+        default:
+            tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00); // invalid command
+            return -1;
+    }
+}
+
+//--------------------------------------------------------------------+
+// HID callbacks
+//--------------------------------------------------------------------+
+
+uint8_t const * tud_hid_descriptor_report_cb(uint8_t instance) {
+    (void) instance;
+    return desc_hid_report;
+}
+
+uint16_t tud_hid_get_report_cb(uint8_t instance, uint8_t report_id, hid_report_type_t report_type, uint8_t *buffer, uint16_t reqlen) {
+    (void) instance;
+    (void) report_id;
+    (void) report_type;
+    (void) buffer;
+    (void) reqlen;
+    return 0;
+}
+
+void tud_hid_set_report_cb(uint8_t instance, uint8_t report_id, hid_report_type_t report_type, uint8_t const *buffer, uint16_t bufsize) {
+    // the host sends the keyboard LED state here; we have no caps lock light to drive.
+    (void) instance;
+    (void) report_id;
+    (void) report_type;
+    (void) buffer;
+    (void) bufsize;
+}
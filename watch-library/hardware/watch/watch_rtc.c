@@ -24,7 +24,10 @@
 
 #include "watch_rtc.h"
 
-ext_irq_cb_t tick_callbacks[8];
+// Each power-of-two frequency can have several subscribers; the PERn interrupt for a frequency
+// is enabled while it has at least one and disabled when the last one unsubscribes, so the
+// hardware only ticks at rates somebody actually asked for.
+ext_irq_cb_t tick_callbacks[8][WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS];
 ext_irq_cb_t alarm_callback;
 ext_irq_cb_t btn_alarm_callback;
 ext_irq_cb_t a2_callback;
@@ -79,31 +82,75 @@ void watch_rtc_disable_tick_callback(void) {
     watch_rtc_disable_periodic_callback(1);
 }
 
+// maps a power-of-two frequency to its PERn slot: left-justify the frequency in a 32-bit integer
+// and count the leading zeroes. 0x01 (1 Hz) has 7 leading zeroes for PER7; 0x80 (128 Hz) has none
+// for PER0.
+static inline uint8_t _per_n_for_frequency(uint8_t frequency) {
+    return __builtin_clz((uint32_t)frequency << 24);
+}
+
+static bool _periodic_slot_has_subscribers(uint8_t per_n) {
+    for (uint8_t i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) {
+        if (tick_callbacks[per_n][i] != NULL) return true;
+    }
+    return false;
+}
+
 void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequency) {
     // we told them, it has to be a power of 2.
     if (__builtin_popcount(frequency) != 1) return;
 
-    // this left-justifies the period in a 32-bit integer.
-    uint32_t tmp = frequency << 24;
-    // now we can count the leading zeroes to get the value we need.
-    // 0x01 (1 Hz) will have 7 leading zeros for PER7. 0xF0 (128 Hz) will have no leading zeroes for PER0.
-    uint8_t per_n = __builtin_clz(tmp);
+    // the historical behavior of this function: replace all subscribers at this frequency.
+    uint8_t per_n = _per_n_for_frequency(frequency);
+    for (uint8_t i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) tick_callbacks[per_n][i] = NULL;
+    tick_callbacks[per_n][0] = callback;
+
+    NVIC_ClearPendingIRQ(RTC_IRQn);
+    NVIC_EnableIRQ(RTC_IRQn);
+    RTC->MODE2.INTENSET.reg = 1 << per_n;
+}
+
+bool watch_rtc_subscribe_periodic_callback(ext_irq_cb_t callback, uint8_t frequency) {
+    if (__builtin_popcount(frequency) != 1 || callback == NULL) return false;
+    uint8_t per_n = _per_n_for_frequency(frequency);
 
-    // this also maps nicely to an index for our list of tick callbacks.
-    tick_callbacks[per_n] = callback;
+    int8_t free_slot = -1;
+    for (uint8_t i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) {
+        if (tick_callbacks[per_n][i] == callback) return true; // already subscribed
+        if (tick_callbacks[per_n][i] == NULL && free_slot == -1) free_slot = i;
+    }
+    if (free_slot == -1) return false;
+    tick_callbacks[per_n][free_slot] = callback;
 
     NVIC_ClearPendingIRQ(RTC_IRQn);
     NVIC_EnableIRQ(RTC_IRQn);
     RTC->MODE2.INTENSET.reg = 1 << per_n;
+    return true;
+}
+
+void watch_rtc_unsubscribe_periodic_callback(ext_irq_cb_t callback, uint8_t frequency) {
+    if (__builtin_popcount(frequency) != 1) return;
+    uint8_t per_n = _per_n_for_frequency(frequency);
+    for (uint8_t i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) {
+        if (tick_callbacks[per_n][i] == callback) tick_callbacks[per_n][i] = NULL;
+    }
+    // only silence the interrupt when the last subscriber leaves.
+    if (!_periodic_slot_has_subscribers(per_n)) RTC->MODE2.INTENCLR.reg = 1 << per_n;
 }
 
 void watch_rtc_disable_periodic_callback(uint8_t frequency) {
     if (__builtin_popcount(frequency) != 1) return;
-    uint8_t per_n = __builtin_clz(frequency << 24);
+    uint8_t per_n = _per_n_for_frequency(frequency);
+    for (uint8_t i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) tick_callbacks[per_n][i] = NULL;
     RTC->MODE2.INTENCLR.reg = 1 << per_n;
 }
 
 void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask) {
+    for (uint8_t per_n = 0; per_n < 8; per_n++) {
+        if (mask & (1 << per_n)) {
+            for (uint8_t i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) tick_callbacks[per_n][i] = NULL;
+        }
+    }
     RTC->MODE2.INTENCLR.reg = mask;
 }
 
@@ -111,6 +158,48 @@ void watch_rtc_disable_all_periodic_callbacks(void) {
     watch_rtc_disable_matching_periodic_callbacks(0xFF);
 }
 
+// The aligned tick works around a fixed phase relationship: with the DIV1024 prescaler,
+// PER7 fires on the rising edge of prescaler bit 9 — count 512 of 1024, half a second
+// *after* each CLOCK rollover. Since the prescaler can only be rephased by writing CLOCK
+// (which shifts timekeeping), alignment is synthesized instead: an internal 1 Hz anchor
+// arms a 16 Hz window (PER3 fires at counts 32, 96, ... 992) and counts down to the
+// first event past the rollover, 31.25 ms into the fresh second, then fires the user's
+// callback and disarms until the next anchor. Both halves ride the ordinary subscriber
+// slots, so they coexist with anything else ticking at 1 or 16 Hz.
+
+static ext_irq_cb_t _aligned_tick_callback;
+static uint8_t _aligned_tick_offset;  // extra sixteenths past the boundary
+static volatile uint8_t _aligned_tick_countdown;
+
+// from the anchor at count 512, the ninth PER3 event is the one at count 32 of the next second.
+#define ALIGNED_TICK_EVENTS_TO_BOUNDARY 9
+
+WATCH_RAMFUNC static void _aligned_tick_window_cb(void) {
+    if (--_aligned_tick_countdown) return;
+    watch_rtc_unsubscribe_periodic_callback(_aligned_tick_window_cb, 16);
+    if (_aligned_tick_callback) _aligned_tick_callback();
+}
+
+WATCH_RAMFUNC static void _aligned_tick_anchor_cb(void) {
+    _aligned_tick_countdown = ALIGNED_TICK_EVENTS_TO_BOUNDARY + _aligned_tick_offset;
+    // a stale PER3 flag would count as an event the moment the interrupt is enabled,
+    // skewing the whole window 62.5 ms early; clear it before arming.
+    RTC->MODE2.INTFLAG.reg = RTC_MODE2_INTFLAG_PER3;
+    watch_rtc_subscribe_periodic_callback(_aligned_tick_window_cb, 16);
+}
+
+void watch_rtc_register_aligned_tick_callback(ext_irq_cb_t callback, uint8_t offset_sixteenths) {
+    _aligned_tick_callback = callback;
+    _aligned_tick_offset = offset_sixteenths & 0xF;
+    watch_rtc_subscribe_periodic_callback(_aligned_tick_anchor_cb, 1);
+}
+
+void watch_rtc_disable_aligned_tick_callback(void) {
+    _aligned_tick_callback = NULL;
+    watch_rtc_unsubscribe_periodic_callback(_aligned_tick_anchor_cb, 1);
+    watch_rtc_unsubscribe_periodic_callback(_aligned_tick_window_cb, 16);
+}
+
 void watch_rtc_register_alarm_callback(ext_irq_cb_t callback, watch_date_time alarm_time, watch_rtc_alarm_match mask) {
     RTC->MODE2.Mode2Alarm[0].ALARM.reg = alarm_time.reg;
     RTC->MODE2.Mode2Alarm[0].MASK.reg = mask;
@@ -125,7 +214,7 @@ void watch_rtc_disable_alarm_callback(void) {
     RTC->MODE2.INTENCLR.reg = RTC_MODE2_INTENCLR_ALARM0;
 }
 
-void RTC_Handler(void) {
+WATCH_RAMFUNC void RTC_Handler(void) {
     uint16_t interrupt_status = RTC->MODE2.INTFLAG.reg;
     uint16_t interrupt_enabled = RTC->MODE2.INTENSET.reg;
 
@@ -134,8 +223,8 @@ void RTC_Handler(void) {
         // start from PER7, the 1 Hz tick.
         for(int8_t i = 7; i >= 0; i--) {
             if ((interrupt_status & interrupt_enabled) & (1 << i)) {
-                if (tick_callbacks[i] != NULL) {
-                    tick_callbacks[i]();
+                for (uint8_t j = 0; j < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; j++) {
+                    if (tick_callbacks[i][j] != NULL) tick_callbacks[i][j]();
                 }
                 RTC->MODE2.INTFLAG.reg = 1 << i;
 //                break; Uncertain if this fix is requried. We were discussing in discord. Might slightly increase power consumption. 
@@ -185,3 +274,117 @@ void watch_rtc_freqcorr_write(int16_t value, int16_t sign)
     // We do not sycnronize. We are not in a hurry
 }
 
+watch_rtc_clock_source watch_rtc_get_clock_source(void) {
+    switch (OSC32KCTRL->RTCCTRL.bit.RTCSEL) {
+        case OSC32KCTRL_RTCCTRL_RTCSEL_ULP1K_Val:
+        case OSC32KCTRL_RTCCTRL_RTCSEL_ULP32K_Val:
+            return WATCH_RTC_CLOCK_OSCULP32K;
+        default:
+            return WATCH_RTC_CLOCK_XOSC32K;
+    }
+}
+
+// Counts OSCULP32K cycles across 255 periods of the crystal divided by 2^ref_div_log2,
+// and returns the OSCULP's frequency error in centi-ppm. A /64 reference (~half-second
+// window) resolves about 60 ppm, plenty below the trim's step size; the /256 reference
+// (~2 seconds) resolves ~15 ppm for the final FREQCORR measurement.
+static int32_t _watch_rtc_osculp_error_centippm(uint8_t ref_div_log2) {
+    // generator 2 carries the divided crystal reference and generator 4 the OSCULP under
+    // test; both are unused at boot (0 is the CPU clock, 1 the USB DFLL, 3 the 32 kHz
+    // peripheral clock). DIVSEL divides by 2^(DIV+1).
+    GCLK->GENCTRL[2].reg = GCLK_GENCTRL_SRC_XOSC32K | GCLK_GENCTRL_DIV(ref_div_log2 - 1) | GCLK_GENCTRL_DIVSEL | GCLK_GENCTRL_GENEN;
+    GCLK->GENCTRL[4].reg = GCLK_GENCTRL_SRC_OSCULP32K | GCLK_GENCTRL_GENEN;
+    while (GCLK->SYNCBUSY.reg & (GCLK_SYNCBUSY_GENCTRL_GCLK2 | GCLK_SYNCBUSY_GENCTRL_GCLK4));
+    GCLK->PCHCTRL[FREQM_GCLK_ID_REF].reg = GCLK_PCHCTRL_GEN_GCLK2 | GCLK_PCHCTRL_CHEN;
+    GCLK->PCHCTRL[FREQM_GCLK_ID_MSR].reg = GCLK_PCHCTRL_GEN_GCLK4 | GCLK_PCHCTRL_CHEN;
+
+    MCLK->APBAMASK.reg |= MCLK_APBAMASK_FREQM;
+    FREQM->CTRLA.bit.ENABLE = 0;
+    while (FREQM->SYNCBUSY.reg & FREQM_SYNCBUSY_ENABLE);
+    FREQM->CFGA.reg = FREQM_CFGA_REFNUM(255);
+    FREQM->CTRLA.bit.ENABLE = 1;
+    while (FREQM->SYNCBUSY.reg & FREQM_SYNCBUSY_ENABLE);
+    FREQM->CTRLB.reg = FREQM_CTRLB_START;
+    while (FREQM->STATUS.bit.BUSY);
+    FREQM->INTFLAG.reg = FREQM_INTFLAG_DONE;
+    uint32_t value = FREQM->VALUE.bit.VALUE;
+
+    // a perfect OSCULP counts one cycle per undivided reference cycle.
+    uint32_t expected = 255UL << ref_div_log2;
+    return (int32_t)(((int64_t)value - (int64_t)expected) * 100000000LL / (int64_t)expected);
+}
+
+// put the measurement plumbing back the way watch_dump_clock_tree expects to find it.
+static void _watch_rtc_freqm_teardown(void) {
+    FREQM->CTRLA.bit.ENABLE = 0;
+    while (FREQM->SYNCBUSY.reg & FREQM_SYNCBUSY_ENABLE);
+    MCLK->APBAMASK.reg &= ~MCLK_APBAMASK_FREQM;
+    GCLK->PCHCTRL[FREQM_GCLK_ID_REF].reg = 0;
+    GCLK->PCHCTRL[FREQM_GCLK_ID_MSR].reg = 0;
+    GCLK->GENCTRL[2].reg = 0;
+    GCLK->GENCTRL[4].reg = 0;
+}
+
+void watch_rtc_set_clock_source(watch_rtc_clock_source source) {
+    if (source == watch_rtc_get_clock_source()) return;
+
+    if (source == WATCH_RTC_CLOCK_OSCULP32K) {
+        // recalibrate the OSCULP against the crystal while we still have it: sweep the
+        // 5-bit CALIB trim, keeping the value with the smallest frequency error. The
+        // trim DAC isn't guaranteed monotonic, so a sweep beats a binary search; at
+        // half a second per point this takes about 16 seconds, which is fine for a
+        // once-per-deployment transition into storage mode.
+        uint32_t osculp = OSC32KCTRL->OSCULP32K.reg & ~OSC32KCTRL_OSCULP32K_CALIB_Msk;
+        uint8_t best_calib = 0;
+        int32_t best_magnitude = INT32_MAX;
+        for (uint8_t calib = 0; calib < 32; calib++) {
+            OSC32KCTRL->OSCULP32K.reg = osculp | OSC32KCTRL_OSCULP32K_CALIB(calib);
+            int32_t error = _watch_rtc_osculp_error_centippm(6);
+            int32_t magnitude = error < 0 ? -error : error;
+            if (magnitude < best_magnitude) {
+                best_magnitude = magnitude;
+                best_calib = calib;
+            }
+        }
+        OSC32KCTRL->OSCULP32K.reg = osculp | OSC32KCTRL_OSCULP32K_CALIB(best_calib);
+
+        // measure the winning trim with the long window and hand the residual to
+        // FREQCORR. One step is 0.95367 ppm (see drift_correction.c); a positive
+        // (slowing) correction is what a fast oscillator needs. FREQCORR tops out
+        // around ±121 ppm — anything beyond that is the OSCULP being an RC
+        // oscillator, and is the accuracy this profile accepts.
+        int32_t error = _watch_rtc_osculp_error_centippm(8);
+        int32_t steps = (error + (error < 0 ? -47683 : 47683)) / 95367;
+        if (steps > 127) steps = 127;
+        if (steps < -127) steps = -127;
+        watch_rtc_freqcorr_write((int16_t)(steps < 0 ? -steps : steps), steps < 0 ? 1 : 0);
+        _watch_rtc_freqm_teardown();
+    } else {
+        // wake the crystal back up before anything depends on it.
+        OSC32KCTRL->XOSC32K.bit.ENABLE = 1;
+        while (!OSC32KCTRL->STATUS.bit.XOSC32KRDY);
+        // the OSCULP's correction doesn't apply to the crystal; zero it and let the
+        // drift correction engine reprogram its own value on the next update.
+        watch_rtc_freqcorr_write(0, 0);
+    }
+
+    // RTCSEL may only change while the RTC is stopped. Both selections clock the
+    // prescaler at 1.024 kHz, so the time base carries straight across the switch.
+    watch_rtc_enable(false);
+    OSC32KCTRL->RTCCTRL.reg = OSC32KCTRL_RTCCTRL_RTCSEL(
+        source == WATCH_RTC_CLOCK_OSCULP32K ? OSC32KCTRL_RTCCTRL_RTCSEL_ULP1K_Val : OSC32KCTRL_RTCCTRL_RTCSEL_XOSC1K_Val);
+    watch_rtc_enable(true);
+
+    // generator 3 feeds the 32 kHz peripherals (buzzer and LED TCs, the fast timer,
+    // EIC debounce); repoint it at whichever oscillator is staying awake, then gate
+    // the crystal off — its standby draw is the whole point of this profile.
+    if (source == WATCH_RTC_CLOCK_OSCULP32K) {
+        GCLK->GENCTRL[3].reg = GCLK_GENCTRL_SRC_OSCULP32K | GCLK_GENCTRL_DIV(1) | GCLK_GENCTRL_RUNSTDBY | GCLK_GENCTRL_GENEN;
+        while (GCLK->SYNCBUSY.reg & GCLK_SYNCBUSY_GENCTRL_GCLK3);
+        OSC32KCTRL->XOSC32K.bit.ENABLE = 0;
+    } else {
+        GCLK->GENCTRL[3].reg = GCLK_GENCTRL_SRC_XOSC32K | GCLK_GENCTRL_DIV(1) | GCLK_GENCTRL_RUNSTDBY | GCLK_GENCTRL_GENEN;
+        while (GCLK->SYNCBUSY.reg & GCLK_SYNCBUSY_GENCTRL_GCLK3);
+    }
+}
+
@@ -38,20 +38,128 @@ void watch_enable_display(void) {
     slcd_sync_enable(&SEGMENT_LCD_0);
 }
 
+// When a display transaction is open, pixel writes accumulate in this staged copy of the six
+// SDATA words (two per COM line) and are flushed in one burst by watch_display_commit.
+static bool display_transaction_open = false;
+static uint32_t display_staged_sdata[6];
+
+// Returns true if the given pixel is already in the requested state. Display routines rewrite
+// whole characters, but on a typical update only a segment or two actually changes; checking the
+// SDATA shadow register first lets us skip the read-modify-write for segments that are already
+// correct. (The mask math mirrors _slcd_sync_set_segment in hpl_slcd.c.)
+static inline bool _pixel_matches(uint8_t com, uint8_t seg, bool on) {
+    uint32_t value = ((volatile const uint32_t *)&SLCD->SDATAL0)[(com * 2) + (seg >> 5)];
+    uint32_t mask = (seg < 32) ? (1 << seg) : (1 << (seg >> 5));
+    return ((value & mask) != 0) == on;
+}
+
+static inline void _stage_pixel(uint8_t com, uint8_t seg, bool on) {
+    uint32_t mask = (seg < 32) ? (1 << seg) : (1 << (seg >> 5));
+    if (on) display_staged_sdata[(com * 2) + (seg >> 5)] |= mask;
+    else display_staged_sdata[(com * 2) + (seg >> 5)] &= ~mask;
+}
+
 inline void watch_set_pixel(uint8_t com, uint8_t seg) {
+    if (display_transaction_open) {
+        _stage_pixel(com, seg, true);
+        return;
+    }
+    if (_pixel_matches(com, seg, true)) return;
     slcd_sync_seg_on(&SEGMENT_LCD_0, SLCD_SEGID(com, seg));
 }
 
 inline void watch_clear_pixel(uint8_t com, uint8_t seg) {
+    if (display_transaction_open) {
+        _stage_pixel(com, seg, false);
+        return;
+    }
+    if (_pixel_matches(com, seg, false)) return;
     slcd_sync_seg_off(&SEGMENT_LCD_0, SLCD_SEGID(com, seg));
 }
 
+void watch_display_begin(void) {
+    if (display_transaction_open) return;
+    volatile const uint32_t *sdata = (volatile const uint32_t *)&SLCD->SDATAL0;
+    for (uint8_t i = 0; i < 6; i++) display_staged_sdata[i] = sdata[i];
+    display_transaction_open = true;
+}
+
+void watch_display_commit(void) {
+    if (!display_transaction_open) return;
+    display_transaction_open = false;
+    volatile uint32_t *sdata = (volatile uint32_t *)&SLCD->SDATAL0;
+    for (uint8_t i = 0; i < 6; i++) {
+        if (sdata[i] != display_staged_sdata[i]) sdata[i] = display_staged_sdata[i];
+    }
+}
+
 void watch_clear_display(void) {
     SLCD->SDATAL0.reg = 0;
     SLCD->SDATAL1.reg = 0;
     SLCD->SDATAL2.reg = 0;
 }
 
+void watch_get_lcd_drive(watch_lcd_drive_t *drive) {
+    drive->contrast = SLCD->CTRLC.bit.CTST;
+    drive->prescaler = SLCD->CTRLA.bit.PRESC;
+    drive->divider = SLCD->CTRLA.bit.CKDIV;
+}
+
+void watch_set_lcd_drive(watch_lcd_drive_t *drive) {
+    // CTRLA and CTRLC are enable-protected, so the controller has to go down for a moment;
+    // segment data is retained, and the display resumes scanning where it left off.
+    SLCD->CTRLA.bit.ENABLE = 0;
+    _sync_slcd();
+    SLCD->CTRLA.bit.PRESC = drive->prescaler & 0x3;
+    SLCD->CTRLA.bit.CKDIV = drive->divider & 0x7;
+    SLCD->CTRLC.bit.CTST = drive->contrast & 0xF;
+    SLCD->CTRLA.bit.ENABLE = 1;
+    _sync_slcd();
+}
+
+// Low power drive for low energy mode. The stock configuration already picks the SLCD's
+// lowest-power reference and charge pump refresh rates and the low-power waveform; what's
+// left on the table is the frame rate and the bias buffer. A display that changes once a
+// minute doesn't need the crisp mid-30s frame rate interactive use gets, so this drops the
+// frame clock to its slowest legible setting (about 21 frames per second) and turns off
+// the bias buffer, which exists to firm up segment transitions that barely happen down
+// here. The previous values — which may be the LCD tuning face's per-unit settings, not
+// the stock ones — are saved and restored on exit.
+static uint8_t _lp_saved_prescaler, _lp_saved_divider, _lp_saved_bbd;
+static bool _lp_saved_bben;
+static bool _display_low_power;
+
+void watch_display_enter_low_power_mode(void) {
+    if (_display_low_power) return;
+    _display_low_power = true;
+    _lp_saved_prescaler = SLCD->CTRLA.bit.PRESC;
+    _lp_saved_divider = SLCD->CTRLA.bit.CKDIV;
+    _lp_saved_bben = SLCD->CTRLB.bit.BBEN;
+    _lp_saved_bbd = SLCD->CTRLB.bit.BBD;
+
+    SLCD->CTRLA.bit.ENABLE = 0;
+    _sync_slcd();
+    SLCD->CTRLA.bit.PRESC = 3;  // ÷128
+    SLCD->CTRLA.bit.CKDIV = 3;  // ÷4: 32768 / (128 * 4 * 3 commons) ≈ 21 frames/s
+    SLCD->CTRLB.bit.BBEN = 0;
+    SLCD->CTRLA.bit.ENABLE = 1;
+    _sync_slcd();
+}
+
+void watch_display_exit_low_power_mode(void) {
+    if (!_display_low_power) return;
+    _display_low_power = false;
+
+    SLCD->CTRLA.bit.ENABLE = 0;
+    _sync_slcd();
+    SLCD->CTRLA.bit.PRESC = _lp_saved_prescaler;
+    SLCD->CTRLA.bit.CKDIV = _lp_saved_divider;
+    SLCD->CTRLB.bit.BBEN = _lp_saved_bben;
+    SLCD->CTRLB.bit.BBD = _lp_saved_bbd;
+    SLCD->CTRLA.bit.ENABLE = 1;
+    _sync_slcd();
+}
+
 void watch_start_character_blink(char character, uint32_t duration) {
     SLCD->CTRLD.bit.FC0EN = 0;
     _sync_slcd();
@@ -79,9 +187,51 @@ void watch_start_character_blink(char character, uint32_t duration) {
     _sync_slcd();
 }
 
+bool watch_start_pixel_blink(uint8_t com, uint8_t seg, uint32_t duration) {
+    // the blink function only reaches SEG lines 0 and 1; everything else on the glass
+    // (including the colon and the indicator icons) is wired beyond it.
+    if (com > 2 || seg > 1) return false;
+
+    SLCD->CTRLD.bit.FC0EN = 0;
+    _sync_slcd();
+
+    if (duration <= SLCD_FC_BYPASS_MAX_MS) {
+        SLCD->FC0.reg = SLCD_FC0_PB | ((duration / (1000 / SLCD_FRAME_FREQUENCY)) - 1);
+    } else {
+        SLCD->FC0.reg = (((duration / (1000 / SLCD_FRAME_FREQUENCY)) / 8 - 1));
+    }
+    SLCD->CTRLD.bit.FC0EN = 1;
+
+    watch_set_pixel(com, seg);
+
+    SLCD->CTRLD.bit.BLINK = 0;
+    SLCD->CTRLA.bit.ENABLE = 0;
+    _sync_slcd();
+
+    // OR into the selection so a second pixel can join an existing blink; stop clears it.
+    if (seg == 0) SLCD->BCFG.bit.BSS0 |= (1 << com);
+    else SLCD->BCFG.bit.BSS1 |= (1 << com);
+
+    SLCD->CTRLD.bit.BLINK = 1;
+    _sync_slcd();
+    SLCD->CTRLA.bit.ENABLE = 1;
+    _sync_slcd();
+    return true;
+}
+
 void watch_stop_blink(void) {
     SLCD->CTRLD.bit.FC0EN = 0;
     SLCD->CTRLD.bit.BLINK = 0;
+
+    // clear the blink selection so pixels picked by watch_start_pixel_blink don't leak
+    // into the next user's blink. BCFG is enable-protected; segment data is retained
+    // across the brief disable, so the display comes back as it was.
+    SLCD->CTRLA.bit.ENABLE = 0;
+    _sync_slcd();
+    SLCD->BCFG.bit.BSS0 = 0;
+    SLCD->BCFG.bit.BSS1 = 0;
+    SLCD->CTRLA.bit.ENABLE = 1;
+    _sync_slcd();
 }
 
 void watch_start_tick_animation(uint32_t duration) {
@@ -23,6 +23,7 @@
  */
 
 #include "watch_spi.h"
+#include "watch_private.h"
 
 struct io_descriptor *spi_io;
 
@@ -52,3 +53,77 @@ bool watch_spi_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t leng
     xfer.size = length;
     return !!spi_m_sync_transfer(&SPI_0, &xfer);
 }
+
+// Scatter-gather transmit over DMAC channel 0: two linked descriptors, triggered
+// beat-by-beat by the SERCOM's TX-ready signal. The controller bring-up, descriptor
+// tables and shared interrupt live in watch_dma.c; this file owns channel 0's
+// configuration and its first descriptor in the shared table.
+
+extern DmacDescriptor _watch_dma_descriptors[];
+static DmacDescriptor spi_dma_payload_descriptor __attribute__((aligned(16)));
+static volatile bool spi_dma_busy;
+
+static void _watch_spi_dma_complete(void) {
+    spi_dma_busy = false;
+}
+
+static void _watch_spi_dma_init(void) {
+    static bool initialized;
+    if (initialized) return;
+    initialized = true;
+
+    _watch_dma_init();
+    _watch_dma_register_channel_callback(0, _watch_spi_dma_complete);
+
+    // CHID selects which channel the CH* registers address, and the shared interrupt
+    // handler switches it; keep the select-and-program sequence atomic against it.
+    __disable_irq();
+    DMAC->CHID.reg = 0;
+    DMAC->CHCTRLA.reg = 0;
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_LVL(0) | DMAC_CHCTRLB_TRIGSRC(SERCOM3_DMAC_ID_TX) | DMAC_CHCTRLB_TRIGACT_BEAT;
+    DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL | DMAC_CHINTENSET_TERR;
+    __enable_irq();
+}
+
+bool watch_spi_write_scatter(const uint8_t *header, uint16_t header_length, const uint8_t *payload, uint16_t payload_length) {
+    if (payload_length == 0) return watch_spi_write(header, header_length);
+    if (header_length == 0) return watch_spi_write(payload, payload_length);
+
+    _watch_spi_dma_init();
+
+    // with an incrementing source, SRCADDR holds the address past the end of the buffer.
+    DmacDescriptor *descriptor = &_watch_dma_descriptors[0];
+    uint16_t btctrl = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_SRCINC;
+    descriptor->BTCTRL.reg = btctrl | DMAC_BTCTRL_BLOCKACT_NOACT;
+    descriptor->BTCNT.reg = header_length;
+    descriptor->SRCADDR.reg = (uint32_t)header + header_length;
+    descriptor->DSTADDR.reg = (uint32_t)&SERCOM3->SPI.DATA.reg;
+    descriptor->DESCADDR.reg = (uint32_t)&spi_dma_payload_descriptor;
+
+    spi_dma_payload_descriptor.BTCTRL.reg = btctrl | DMAC_BTCTRL_BLOCKACT_INT;
+    spi_dma_payload_descriptor.BTCNT.reg = payload_length;
+    spi_dma_payload_descriptor.SRCADDR.reg = (uint32_t)payload + payload_length;
+    spi_dma_payload_descriptor.DSTADDR.reg = (uint32_t)&SERCOM3->SPI.DATA.reg;
+    spi_dma_payload_descriptor.DESCADDR.reg = 0;
+
+    spi_dma_busy = true;
+    __disable_irq();
+    DMAC->CHID.reg = 0;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+    __enable_irq();
+
+    // idle until the end-of-chain interrupt; tick and button interrupts just re-run the loop.
+    while (spi_dma_busy) sleep(2);
+
+    // the interrupt fired when the last byte hit the data register; wait for the shift
+    // register to drain before the caller deasserts chip select.
+    while (!SERCOM3->SPI.INTFLAG.bit.TXC);
+
+    // we ignored everything the flash clocked back at us; flush the receiver so a stale
+    // byte or overflow flag can't confuse the next synchronous transfer.
+    while (SERCOM3->SPI.INTFLAG.bit.RXC) (void)SERCOM3->SPI.DATA.reg;
+    uint16_t status = SERCOM3->SPI.STATUS.reg;
+    if (status) SERCOM3->SPI.STATUS.reg = status;
+
+    return true;
+}
@@ -7,7 +7,24 @@
 #define RWWEE_ADDR_END (NVMCTRL_RWW_EEPROM_ADDR + NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES)
 #define NVM_MEMORY ((volatile uint16_t *)FLASH_ADDR)
 
-static bool _is_valid_address(uint32_t addr, uint32_t size) {
+// One-page write-combining buffer. The NVMCTRL programs the RWWEE region a 64-byte page
+// at a time, so a caller issuing smaller sequential writes would otherwise program the
+// same page repeatedly — burning a program cycle (and wear) per fragment. Sub-page
+// writes accumulate here instead; the page is programmed exactly once, when a write
+// crosses out of it or on watch_storage_sync. Reads overlay the pending page so callers
+// always see their own writes. littlefs's prog path already writes whole pages, which
+// flush straight through; the buffer is what makes smaller prog sizes safe and cheap.
+static uint8_t _page_buffer[NVMCTRL_PAGE_SIZE];
+static uint32_t _page_buffer_address = 0xFFFFFFFF; // byte address of the buffered page; ~0 when empty
+
+WATCH_RAMFUNC static void _watch_storage_wait(void) {
+    while (!hri_nvmctrl_get_interrupt_READY_bit(NVMCTRL)) {
+        // wait for flash to become ready
+    }
+    hri_nvmctrl_clear_STATUS_reg(NVMCTRL, NVMCTRL_STATUS_MASK);
+}
+
+WATCH_RAMFUNC static bool _is_valid_address(uint32_t addr, uint32_t size) {
     if ((addr < NVMCTRL_RWW_EEPROM_ADDR) || (addr > (NVMCTRL_RWW_EEPROM_ADDR + NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES))) {
         return false;
     }
@@ -26,7 +43,7 @@ bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t
     uint32_t i;
     uint16_t data;
 
-    watch_storage_sync();
+    _watch_storage_wait();
 
     if (address % 2) {
         data      = NVM_MEMORY[nvm_address++];
@@ -44,27 +61,38 @@ bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t
         }
         i += 2;
     }
+
+    // overlay any bytes still waiting in the write-combining buffer, so a read that
+    // follows a buffered write sees the data that will land in this page.
+    if (_page_buffer_address != 0xFFFFFFFF &&
+        address < _page_buffer_address + NVMCTRL_PAGE_SIZE &&
+        _page_buffer_address < address + size) {
+        for (i = 0; i < size; i++) {
+            uint32_t byte_address = address + i;
+            if (byte_address >= _page_buffer_address && byte_address < _page_buffer_address + NVMCTRL_PAGE_SIZE) {
+                buffer[i] = _page_buffer[byte_address - _page_buffer_address];
+            }
+        }
+    }
     return true;
 }
 
-bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
-    uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE + offset;
-    if (!_is_valid_address(address, size)) return false;
-
-    watch_storage_sync();
-
+// The write path runs from SRAM: these functions execute while NVMCTRL is busy
+// programming or erasing the RWWEE region, and fetching their instructions from the
+// flash the controller is working on stalls every fetch behind wait states. A littlefs
+// log flush chains many page writes back to back, so the stall compounds into the
+// longest uninterruptible active-CPU window in the firmware.
+WATCH_RAMFUNC static bool _watch_storage_program_page(uint32_t address, const uint8_t *data) {
     uint32_t nvm_address = address / 2;
-    uint16_t i, data;
+    uint16_t i, word;
 
+    _watch_storage_wait();
     hri_nvmctrl_write_CTRLA_reg(NVMCTRL, NVMCTRL_CTRLA_CMD_PBC | NVMCTRL_CTRLA_CMDEX_KEY);
-    watch_storage_sync();
+    _watch_storage_wait();
 
-    for (i = 0; i < size; i += 2) {
-        data = buffer[i];
-        if (i < NVMCTRL_PAGE_SIZE - 1) {
-            data |= (buffer[i + 1] << 8);
-        }
-        NVM_MEMORY[nvm_address++] = data;
+    for (i = 0; i < NVMCTRL_PAGE_SIZE; i += 2) {
+        word = data[i] | (data[i + 1] << 8);
+        NVM_MEMORY[nvm_address++] = word;
     }
     hri_nvmctrl_write_ADDR_reg(NVMCTRL, address / 2);
     hri_nvmctrl_write_CTRLA_reg(NVMCTRL, NVMCTRL_CTRLA_CMD_RWWEEWP | NVMCTRL_CTRLA_CMDEX_KEY);
@@ -72,23 +100,62 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
     return true;
 }
 
-bool watch_storage_erase(uint32_t row) {
+WATCH_RAMFUNC static bool _watch_storage_flush_page(void) {
+    if (_page_buffer_address == 0xFFFFFFFF) return true;
+    uint32_t address = _page_buffer_address;
+    _page_buffer_address = 0xFFFFFFFF;
+    return _watch_storage_program_page(address, _page_buffer);
+}
+
+WATCH_RAMFUNC bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+    uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE + offset;
+    if (!_is_valid_address(address, size)) return false;
+
+    while (size > 0) {
+        uint32_t page = address & ~(NVMCTRL_PAGE_SIZE - 1);
+        uint32_t index = address - page;
+        uint32_t take = NVMCTRL_PAGE_SIZE - index;
+        if (take > size) take = size;
+
+        if (_page_buffer_address != page) {
+            if (!_watch_storage_flush_page()) return false;
+            // unwritten bytes stay 0xFF: programming only drives bits low, so the
+            // erased parts of the page are left untouched.
+            memset(_page_buffer, 0xFF, NVMCTRL_PAGE_SIZE);
+            _page_buffer_address = page;
+        }
+        memcpy(_page_buffer + index, buffer, take);
+        address += take;
+        buffer += take;
+        size -= take;
+
+        // a completed page programs immediately; only a trailing partial page lingers,
+        // waiting for the write that finishes it or for a sync.
+        if (index + take == NVMCTRL_PAGE_SIZE && !_watch_storage_flush_page()) return false;
+    }
+
+    return true;
+}
+
+WATCH_RAMFUNC bool watch_storage_erase(uint32_t row) {
     uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE;
     if (!_is_valid_address(address, NVMCTRL_ROW_SIZE)) return false;
 
-    watch_storage_sync();
+    // pending data headed for this row dies with it; anything buffered for another row
+    // is independent of this erase and can keep waiting.
+    if (_page_buffer_address >= address && _page_buffer_address < address + NVMCTRL_ROW_SIZE) {
+        _page_buffer_address = 0xFFFFFFFF;
+    }
+
+    _watch_storage_wait();
     hri_nvmctrl_write_ADDR_reg(NVMCTRL, address / 2);
     hri_nvmctrl_write_CTRLA_reg(NVMCTRL, NVMCTRL_CTRLA_CMD_RWWEEER | NVMCTRL_CTRLA_CMDEX_KEY);
 
     return true;
 }
 
-bool watch_storage_sync(void) {
-    while (!hri_nvmctrl_get_interrupt_READY_bit(NVMCTRL)) {
-        // wait for flash to become ready
-    }
-
-    hri_nvmctrl_clear_STATUS_reg(NVMCTRL, NVMCTRL_STATUS_MASK);
-
+WATCH_RAMFUNC bool watch_storage_sync(void) {
+    if (!_watch_storage_flush_page()) return false;
+    _watch_storage_wait();
     return true;
 }
@@ -90,6 +90,10 @@ void watch_enable_uart(const uint8_t tx_pin, const uint8_t rx_pin, uint32_t baud
         default:
             break;
     }
+    // if a receive pin is configured, let the SERCOM keep its clock running in STANDBY.
+    // this is what lets the interrupt-driven receive path work from deep sleep: the
+    // receiver clocks in characters on its own, and only the RXC interrupt wakes the CPU.
+    if (ctrlb.reg & SERCOM_USART_CTRLB_RXEN) ctrla.reg |= SERCOM_USART_CTRLA_RUNSTDBY;
     SERCOM3->USART.CTRLA.reg = ctrla.reg;
     SERCOM3->USART.CTRLB.reg = ctrlb.reg;
 
@@ -116,3 +120,59 @@ char watch_uart_getc(void) {
     io_read(uart_io, &retval, 1);
     return retval;
 }
+
+// interrupt-driven receive. The handler owns rx_head, watch_uart_read_async owns rx_tail;
+// each side reads the other's index but only writes its own, so no critical section is
+// needed around the ring.
+static uint8_t *rx_buffer;
+static volatile size_t rx_head;
+static volatile size_t rx_tail;
+static size_t rx_size;
+static size_t rx_watermark;
+static uint8_t rx_terminator;
+static watch_uart_rx_callback_t rx_callback;
+
+void watch_uart_rx_enable(uint8_t *buffer, size_t size, size_t watermark, uint8_t terminator, watch_uart_rx_callback_t callback) {
+    rx_buffer = buffer;
+    rx_size = size;
+    rx_watermark = watermark;
+    rx_terminator = terminator;
+    rx_callback = callback;
+    rx_head = rx_tail = 0;
+    NVIC_ClearPendingIRQ(SERCOM3_IRQn);
+    NVIC_EnableIRQ(SERCOM3_IRQn);
+    SERCOM3->USART.INTENSET.reg = SERCOM_USART_INTENSET_RXC;
+}
+
+void watch_uart_rx_disable(void) {
+    SERCOM3->USART.INTENCLR.reg = SERCOM_USART_INTENCLR_RXC;
+    NVIC_DisableIRQ(SERCOM3_IRQn);
+}
+
+size_t watch_uart_read_async(uint8_t *buf, size_t len) {
+    size_t count = 0;
+    while (count < len && rx_tail != rx_head) {
+        buf[count++] = rx_buffer[rx_tail];
+        rx_tail = (rx_tail + 1) % rx_size;
+    }
+    return count;
+}
+
+void SERCOM3_Handler(void) {
+    while (SERCOM3->USART.INTFLAG.bit.RXC) {
+        uint8_t byte = SERCOM3->USART.DATA.reg;  // reading DATA clears RXC
+        size_t next = (rx_head + 1) % rx_size;
+        if (next != rx_tail) {
+            rx_buffer[rx_head] = byte;
+            rx_head = next;
+        }
+        // else: ring full, drop the byte; the consumer is too far behind either way.
+        if (rx_callback) {
+            size_t fill = (rx_head + rx_size - rx_tail) % rx_size;
+            if ((rx_watermark && fill == rx_watermark) || (rx_terminator && byte == rx_terminator)) rx_callback();
+        }
+    }
+    // a framing or overrun error latches in STATUS; clear it so it can't wedge reception.
+    uint16_t status = SERCOM3->USART.STATUS.reg;
+    if (status) SERCOM3->USART.STATUS.reg = status;
+}
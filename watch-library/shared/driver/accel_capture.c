@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "accel_capture.h"
+#include "lis2dw.h"
+#include "spiflash.h"
+#include "watch.h"
+
+#define ACCEL_CAPTURE_PAGE_SIZE 256
+#define ACCEL_CAPTURE_PAGES_PER_SECTOR 16
+#define ACCEL_CAPTURE_MAGIC 0xA9
+#define ACCEL_CAPTURE_HEADER_SIZE 4
+// first sample is stored raw; every later sample needs at most three varint
+// bytes per axis (a 14-bit sample pair can differ by 17 significant bits).
+#define ACCEL_CAPTURE_WORST_CASE_SAMPLE 9
+#define ACCEL_CAPTURE_WATERMARK 24
+
+static struct {
+    accel_capture_config_t config;
+    bool active;
+    uint8_t pages[2][ACCEL_CAPTURE_PAGE_SIZE];  // encoder fills one while the other programs
+    uint8_t active_buffer;
+    uint16_t fill;              // write position in the active page buffer
+    uint16_t sequence;          // stamped into each page header for ring ordering
+    uint32_t next_page;         // next flash page to program, relative to first_page
+    uint32_t pages_written;
+    uint32_t overruns;
+    lis2dw_reading_t previous;  // delta base; reset at each page boundary
+} capture;
+
+// map a signed delta onto small unsigned values: 0, -1, 1, -2, 2...
+static uint32_t _accel_capture_zigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static void _accel_capture_put_varint(uint32_t value) {
+    while (value >= 0x80) {
+        capture.pages[capture.active_buffer][capture.fill++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    capture.pages[capture.active_buffer][capture.fill++] = value;
+}
+
+static void _accel_capture_start_page(void) {
+    uint8_t *page = capture.pages[capture.active_buffer];
+    page[0] = ACCEL_CAPTURE_MAGIC;
+    page[1] = 0; // sample count, filled in as samples land
+    page[2] = capture.sequence & 0xFF;
+    page[3] = capture.sequence >> 8;
+    capture.sequence++;
+    capture.fill = ACCEL_CAPTURE_HEADER_SIZE;
+}
+
+static void _accel_capture_flush_page(void) {
+    // unwritten tail stays 0xFF, indistinguishable from erased flash.
+    memset(&capture.pages[capture.active_buffer][capture.fill], 0xFF,
+           ACCEL_CAPTURE_PAGE_SIZE - capture.fill);
+
+    // entering a fresh sector? erase it before the first page lands in it.
+    if ((capture.next_page % ACCEL_CAPTURE_PAGES_PER_SECTOR) == 0) {
+        spi_flash_wait_until_ready();
+        spi_flash_command(CMD_ENABLE_WRITE);
+        spi_flash_sector_command(CMD_SECTOR_ERASE,
+                                 (capture.config.first_page + capture.next_page) * ACCEL_CAPTURE_PAGE_SIZE);
+    }
+
+    // returns while the page programs; we keep encoding into the other buffer.
+    spi_flash_write_pages((capture.config.first_page + capture.next_page) * ACCEL_CAPTURE_PAGE_SIZE,
+                          capture.pages[capture.active_buffer], ACCEL_CAPTURE_PAGE_SIZE);
+
+    capture.next_page = (capture.next_page + 1) % capture.config.page_count;
+    capture.pages_written++;
+    capture.active_buffer ^= 1;
+    _accel_capture_start_page();
+}
+
+static void _accel_capture_encode(lis2dw_reading_t reading) {
+    uint8_t *page = capture.pages[capture.active_buffer];
+
+    if (page[1] == 0) {
+        // first sample of the page goes in raw, so every page decodes on its own.
+        page[capture.fill++] = reading.x & 0xFF;
+        page[capture.fill++] = (uint16_t)reading.x >> 8;
+        page[capture.fill++] = reading.y & 0xFF;
+        page[capture.fill++] = (uint16_t)reading.y >> 8;
+        page[capture.fill++] = reading.z & 0xFF;
+        page[capture.fill++] = (uint16_t)reading.z >> 8;
+    } else {
+        _accel_capture_put_varint(_accel_capture_zigzag((int32_t)reading.x - capture.previous.x));
+        _accel_capture_put_varint(_accel_capture_zigzag((int32_t)reading.y - capture.previous.y));
+        _accel_capture_put_varint(_accel_capture_zigzag((int32_t)reading.z - capture.previous.z));
+    }
+    page[1]++;
+    capture.previous = reading;
+
+    if (capture.fill > ACCEL_CAPTURE_PAGE_SIZE - ACCEL_CAPTURE_WORST_CASE_SAMPLE) {
+        _accel_capture_flush_page();
+    }
+}
+
+bool accel_capture_begin(accel_capture_config_t config) {
+    if (config.page_count == 0 || (config.page_count % ACCEL_CAPTURE_PAGES_PER_SECTOR) != 0) return false;
+
+    spi_flash_init();
+    if (!lis2dw_begin()) return false;
+
+    memset(&capture, 0, sizeof(capture));
+    capture.config = config;
+    capture.active = true;
+    _accel_capture_start_page();
+
+    lis2dw_set_low_power_mode(LIS2DW_LP_MODE_2); // 14-bit, ~3.5 µA at 25 Hz with low noise
+    lis2dw_set_low_noise_mode(true);
+    lis2dw_set_range(LIS2DW_RANGE_4_G);
+    lis2dw_set_data_rate(LIS2DW_DATA_RATE_25_HZ);
+
+    // FIFO in continuous mode with the watermark a few samples shy of full,
+    // so the interrupt leaves slack for the MCU to wake and drain it.
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_CTRL,
+                     LIS2DW_FIFO_CTRL_MODE_COLLECT_CONTINUOUS | ACCEL_CAPTURE_WATERMARK);
+
+    // route the watermark to INT1 and enable interrupts.
+    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1, configuration | LIS2DW_CTRL4_INT1_FTH);
+    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7, configuration | LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
+
+    return true;
+}
+
+void accel_capture_service(void) {
+    if (!capture.active) return;
+
+    // one I2C burst moves the whole FIFO; the only per-sample work afterward
+    // is the register shuffle into int16s and the delta encoder.
+    static lis2dw_fifo_t fifo;
+    if (lis2dw_read_fifo(&fifo)) capture.overruns++;
+
+    for (uint8_t i = 0; i < fifo.count; i++) {
+        _accel_capture_encode(fifo.readings[i]);
+    }
+}
+
+void accel_capture_end(void) {
+    if (!capture.active) return;
+
+    accel_capture_service(); // catch whatever collected since the last watermark
+
+    lis2dw_disable_fifo();
+    lis2dw_set_data_rate(LIS2DW_DATA_RATE_POWERDOWN);
+
+    if (capture.pages[capture.active_buffer][1] != 0) _accel_capture_flush_page();
+    spi_flash_wait_until_ready();
+    capture.active = false;
+}
+
+uint32_t accel_capture_pages_written(void) {
+    return capture.pages_written;
+}
+
+uint32_t accel_capture_overruns(void) {
+    return capture.overruns;
+}
@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACCEL_CAPTURE_H_
+#define ACCEL_CAPTURE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Continuous 25 Hz accelerometer capture to a SPI flash ring, for boards with
+// both the LIS2DW and the flash chip.
+//
+// The sensor's 32-sample FIFO collects readings while the MCU sleeps; its
+// watermark interrupt on INT1 signals that the FIFO wants draining. Each
+// service call drains the whole FIFO in one I2C burst, delta + zigzag encodes
+// the samples into one of two 256-byte page buffers, and hands full pages to
+// spi_flash_write_pages — which returns while the page is still programming,
+// so encoding the next burst overlaps the program cycle.
+//
+// Each flash page is self-contained: a four byte header (magic, sample count,
+// 16-bit sequence number for ordering the ring on readout), the first sample
+// raw as three little-endian int16s, then per-axis deltas from the previous
+// sample, zigzag mapped and written as 7-bits-per-byte varints. A typical
+// still-wrist page holds around 80 samples against 28 for raw storage.
+
+typedef struct {
+    uint32_t first_page;    // first 256-byte flash page of the ring
+    uint32_t page_count;    // ring length in pages; must be a multiple of 16 (whole 4 KB sectors)
+} accel_capture_config_t;
+
+/** @brief Configures the accelerometer (25 Hz, 14-bit low power, FIFO watermark on INT1)
+  *        and starts a capture into the given flash ring.
+  * @return false if the accelerometer is missing or the ring isn't sector-aligned.
+  */
+bool accel_capture_begin(accel_capture_config_t config);
+
+/** @brief Drains the accelerometer FIFO and stages the samples toward flash.
+  * @note Call when the INT1 watermark interrupt fires. The watermark is set at 24 of 32
+  *       samples, so at 25 Hz a call within ~300 ms of the interrupt loses nothing; a
+  *       once-per-second tick works as a fallback if the interrupt pin isn't wired.
+  */
+void accel_capture_service(void);
+
+/** @brief Stops sampling, flushes the partial page and waits for the last program cycle. */
+void accel_capture_end(void);
+
+/** @brief Gets the number of pages written since capture began (wraps count included). */
+uint32_t accel_capture_pages_written(void);
+
+/** @brief Gets the number of FIFO overruns seen since capture began (samples were lost). */
+uint32_t accel_capture_overruns(void);
+
+#endif // ACCEL_CAPTURE_H_
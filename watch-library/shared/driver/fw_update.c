@@ -0,0 +1,381 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "fw_update.h"
+#include "spiflash.h"
+#include "watch.h"
+
+// geometry of the application image in program flash, from the linker script: the UF2
+// bootloader owns the first 8 KB and the littlefs RWWEE-backed region isn't part of
+// the image, leaving 240 KB for the application.
+#define FW_APP_BASE 0x2000
+#define FW_APP_MAX_SIZE 0x3C000
+
+#define FW_PAGE_SIZE 256
+#define FW_SECTOR_SIZE 4096
+// the image starts one sector above the staging base; the first sector holds only the
+// header, so arming and disarming never touches image data.
+#define FW_IMAGE_BASE (FW_UPDATE_STAGING_BASE + FW_SECTOR_SIZE)
+
+#define FW_HEADER_MAGIC 0x46575550  // 'FWUP'
+
+typedef struct {
+    uint32_t magic;
+    uint32_t size;
+    uint32_t crc;
+    uint32_t check;     // ~(size ^ crc); a header is armed only if all four fields agree
+} fw_update_header_t;
+
+static struct {
+    bool active;
+    bool delta;
+    uint32_t size;
+    uint32_t crc;
+    uint32_t next_page;     // pages staged so far; the next one to write
+    uint32_t fill;          // bytes buffered toward the next page (full-image mode)
+    uint8_t page[FW_PAGE_SIZE];
+} staging;
+
+/// littlefs's CRC-32: reflected polynomial 0xedb88320, seed 0xffffffff, final value
+// not inverted — the same flavor the shell's transfer framing uses, computed here
+// with the same nibble table so the driver doesn't have to reach into littlefs.
+static uint32_t _fw_crc32(uint32_t crc, const uint8_t *data, uint32_t length) {
+    static const uint32_t rtable[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+        0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+        0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+        0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+    };
+    for (uint32_t i = 0; i < length; i++) {
+        crc = (crc >> 4) ^ rtable[(crc ^ (data[i] >> 0)) & 0xF];
+        crc = (crc >> 4) ^ rtable[(crc ^ (data[i] >> 4)) & 0xF];
+    }
+    return crc;
+}
+
+// writes one page of the staged image, erasing each 4 KB sector as the write
+// first enters it. Pages must arrive in ascending order for this to hold, which
+// both staging modes guarantee.
+static bool _fw_stage_page(uint32_t page_index, const uint8_t *data, uint32_t length) {
+    uint32_t address = FW_IMAGE_BASE + page_index * FW_PAGE_SIZE;
+    spi_flash_wait_until_ready();
+    if ((address % FW_SECTOR_SIZE) == 0) {
+        spi_flash_command(CMD_ENABLE_WRITE);
+        spi_flash_sector_command(CMD_SECTOR_ERASE, address);
+        spi_flash_wait_until_ready();
+    }
+    return spi_flash_write_pages(address, (uint8_t *)data, length);
+}
+
+// delta staging: fills baseline pages (copies of the running image) up to but not
+// including the given page, so patched pages can land in ascending order.
+static bool _fw_stage_baseline_through(uint32_t page_index) {
+    uint8_t page[FW_PAGE_SIZE];
+    while (staging.next_page < page_index) {
+        uint32_t offset = staging.next_page * FW_PAGE_SIZE;
+        if (offset + FW_PAGE_SIZE <= FW_APP_MAX_SIZE) {
+            memcpy(page, (const uint8_t *)(FW_APP_BASE + offset), FW_PAGE_SIZE);
+        } else {
+            memset(page, 0xFF, FW_PAGE_SIZE);
+        }
+        uint32_t take = staging.size - offset;
+        if (take > FW_PAGE_SIZE) take = FW_PAGE_SIZE;
+        if (!_fw_stage_page(staging.next_page, page, take)) return false;
+        staging.next_page++;
+    }
+    return true;
+}
+
+static bool _fw_staging_start(uint32_t size, uint32_t crc, bool delta) {
+    if (size == 0 || size > FW_APP_MAX_SIZE) return false;
+    watch_enable_spi();
+    spi_flash_init();
+    uint8_t jedec_id[3] = {0};
+    spi_flash_read_command(CMD_READ_JEDEC_ID, jedec_id, 3);
+    if (jedec_id[0] == 0x00 || jedec_id[0] == 0xFF) {
+        watch_disable_spi();
+        return false;
+    }
+    // disarm any previously staged image before overwriting it.
+    spi_flash_wait_until_ready();
+    spi_flash_command(CMD_ENABLE_WRITE);
+    spi_flash_sector_command(CMD_SECTOR_ERASE, FW_UPDATE_STAGING_BASE);
+    memset(&staging, 0, sizeof(staging));
+    staging.active = true;
+    staging.delta = delta;
+    staging.size = size;
+    staging.crc = crc;
+    return true;
+}
+
+bool fw_update_staging_begin(uint32_t size, uint32_t crc) {
+    return _fw_staging_start(size, crc, false);
+}
+
+bool fw_update_staging_begin_delta(uint32_t size, uint32_t crc) {
+    return _fw_staging_start(size, crc, true);
+}
+
+bool fw_update_staging_write(const uint8_t *data, uint32_t length) {
+    if (!staging.active || staging.delta) return false;
+    while (length) {
+        uint32_t offset = staging.next_page * FW_PAGE_SIZE + staging.fill;
+        if (offset >= staging.size) return false;   // more bytes than promised
+        uint32_t take = FW_PAGE_SIZE - staging.fill;
+        if (take > length) take = length;
+        if (take > staging.size - offset) take = staging.size - offset;
+        // the DMAC moves the frame into the page buffer; on a page boundary the CPU
+        // spends that time polling out the previous page's program cycle instead.
+        watch_dma_memcpy(staging.page + staging.fill, data, take, NULL);
+        staging.fill += take;
+        data += take;
+        length -= take;
+        if (staging.fill == FW_PAGE_SIZE || offset + take == staging.size) {
+            // both the copy and the program cycle must be done before the buffer goes
+            // back out on the wire (on the same DMA-driven SPI chain, no less).
+            spi_flash_wait_until_ready();
+            watch_dma_memcpy_wait();
+            if (!_fw_stage_page(staging.next_page, staging.page, staging.fill)) return false;
+            staging.next_page++;
+            staging.fill = 0;
+        }
+    }
+    // never return with a copy in flight: its source is the caller's frame buffer,
+    // which is free for reuse the moment we do.
+    watch_dma_memcpy_wait();
+    return true;
+}
+
+bool fw_update_staging_patch_page(uint32_t page_index, const uint8_t *data, uint32_t length) {
+    if (!staging.active || !staging.delta) return false;
+    if (page_index < staging.next_page) return false;   // pages must arrive in order
+    if (page_index * FW_PAGE_SIZE + length > staging.size || length > FW_PAGE_SIZE) return false;
+    if (!_fw_stage_baseline_through(page_index)) return false;
+    if (!_fw_stage_page(page_index, data, length)) return false;
+    staging.next_page = page_index + 1;
+    return true;
+}
+
+bool fw_update_staging_commit(void) {
+    if (!staging.active) return false;
+    if (staging.delta) {
+        // whatever the delta didn't touch past the last patch is baseline too.
+        if (!_fw_stage_baseline_through((staging.size + FW_PAGE_SIZE - 1) / FW_PAGE_SIZE)) {
+            fw_update_cancel();
+            return false;
+        }
+    } else if (staging.next_page * FW_PAGE_SIZE < staging.size || staging.fill) {
+        fw_update_cancel();
+        return false;
+    }
+
+    // read the whole staged image back and verify it end to end before arming; only
+    // an image that is byte-for-byte what the host intended ever reaches the applier.
+    spi_flash_wait_until_ready();
+    uint32_t crc = 0xFFFFFFFF;
+    uint8_t chunk[FW_PAGE_SIZE];
+    for (uint32_t offset = 0; offset < staging.size; offset += FW_PAGE_SIZE) {
+        uint32_t take = staging.size - offset;
+        if (take > FW_PAGE_SIZE) take = FW_PAGE_SIZE;
+        if (!spi_flash_read_data(FW_IMAGE_BASE + offset, chunk, take)) {
+            fw_update_cancel();
+            return false;
+        }
+        crc = _fw_crc32(crc, chunk, take);
+    }
+    if (crc != staging.crc) {
+        fw_update_cancel();
+        return false;
+    }
+
+    fw_update_header_t header = {
+        .magic = FW_HEADER_MAGIC,
+        .size = staging.size,
+        .crc = staging.crc,
+        .check = ~(staging.size ^ staging.crc),
+    };
+    spi_flash_command(CMD_ENABLE_WRITE);
+    spi_flash_write_data(FW_UPDATE_STAGING_BASE, (uint8_t *)&header, sizeof(header));
+    spi_flash_wait_until_ready();
+    staging.active = false;
+    watch_disable_spi();
+    return true;
+}
+
+void fw_update_cancel(void) {
+    if (!staging.active) {
+        watch_enable_spi();
+        spi_flash_init();
+    }
+    spi_flash_wait_until_ready();
+    spi_flash_command(CMD_ENABLE_WRITE);
+    spi_flash_sector_command(CMD_SECTOR_ERASE, FW_UPDATE_STAGING_BASE);
+    spi_flash_wait_until_ready();
+    staging.active = false;
+    watch_disable_spi();
+}
+
+static bool _fw_read_header(fw_update_header_t *header) {
+    if (!spi_flash_read_data(FW_UPDATE_STAGING_BASE, (uint8_t *)header, sizeof(*header))) return false;
+    return header->magic == FW_HEADER_MAGIC &&
+           header->check == (uint32_t)~(header->size ^ header->crc) &&
+           header->size > 0 && header->size <= FW_APP_MAX_SIZE;
+}
+
+void fw_update_print_status(void) {
+    if (staging.active) {
+        printf("staging %s: %lu of %lu pages\n", staging.delta ? "delta" : "image",
+               (unsigned long)staging.next_page,
+               (unsigned long)((staging.size + FW_PAGE_SIZE - 1) / FW_PAGE_SIZE));
+        return;
+    }
+    watch_enable_spi();
+    spi_flash_init();
+    fw_update_header_t header;
+    bool armed = _fw_read_header(&header);
+    watch_disable_spi();
+    if (armed) printf("armed: %lu bytes, crc %08lx; installs at next reset\n",
+                      (unsigned long)header.size, (unsigned long)header.crc);
+    else printf("no update staged\n");
+}
+
+// ---------------------------------------------------------------------------------
+// The applier. Everything from here down to the reset runs from RAM with interrupts
+// off: the install loop rewrites the whole application image — including this
+// driver's own flash-resident code and the vector table — so nothing may fetch from
+// program flash until the reset lands in the new firmware. The SPI flash is read
+// with register-level SERCOM3 transfers rather than through the driver above, and
+// the NVM rows are programmed the same way watch_storage.c programs the RWWEE region.
+
+#define FW_NVM_MEMORY ((volatile uint16_t *)FLASH_ADDR)
+
+WATCH_RAMFUNC static void _fw_raw_cs(bool level) {
+    if (level) PORT->Group[A3 >> 5].OUTSET.reg = 1UL << (A3 & 0x1F);
+    else PORT->Group[A3 >> 5].OUTCLR.reg = 1UL << (A3 & 0x1F);
+}
+
+WATCH_RAMFUNC static uint8_t _fw_raw_xfer(uint8_t byte) {
+    while (!SERCOM3->SPI.INTFLAG.bit.DRE);
+    SERCOM3->SPI.DATA.reg = byte;
+    while (!SERCOM3->SPI.INTFLAG.bit.RXC);
+    return SERCOM3->SPI.DATA.reg;
+}
+
+WATCH_RAMFUNC static void _fw_raw_read(uint32_t address, uint8_t *data, uint32_t length) {
+    _fw_raw_cs(false);
+    _fw_raw_xfer(CMD_READ_DATA);
+    _fw_raw_xfer((address >> 16) & 0xFF);
+    _fw_raw_xfer((address >> 8) & 0xFF);
+    _fw_raw_xfer(address & 0xFF);
+    for (uint32_t i = 0; i < length; i++) data[i] = _fw_raw_xfer(0xFF);
+    _fw_raw_cs(true);
+}
+
+WATCH_RAMFUNC static void _fw_nvm_wait(void) {
+    while (!NVMCTRL->INTFLAG.bit.READY);
+}
+
+WATCH_RAMFUNC __attribute__((noreturn)) static void _fw_install(uint32_t size) {
+    uint8_t page[FW_PAGE_SIZE];
+
+    NVMCTRL->CTRLB.bit.MANW = 1;    // explicit write-page commands only
+
+    // one SPI flash page is one NVM row: read, erase, program four 64-byte pages.
+    for (uint32_t offset = 0; offset < size; offset += FW_PAGE_SIZE) {
+        _fw_raw_read(FW_IMAGE_BASE + offset, page, FW_PAGE_SIZE);
+
+        uint32_t row_address = FW_APP_BASE + offset;
+        _fw_nvm_wait();
+        NVMCTRL->ADDR.reg = row_address / 2;
+        NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMD_ER | NVMCTRL_CTRLA_CMDEX_KEY;
+        _fw_nvm_wait();
+
+        for (uint32_t p = 0; p < FW_PAGE_SIZE; p += NVMCTRL_PAGE_SIZE) {
+            NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMD_PBC | NVMCTRL_CTRLA_CMDEX_KEY;
+            _fw_nvm_wait();
+            uint32_t nvm_address = (row_address + p) / 2;
+            for (uint32_t i = 0; i < NVMCTRL_PAGE_SIZE; i += 2) {
+                FW_NVM_MEMORY[nvm_address++] = page[p + i] | (page[p + i + 1] << 8);
+            }
+            NVMCTRL->ADDR.reg = (row_address + p) / 2;
+            NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMD_WP | NVMCTRL_CTRLA_CMDEX_KEY;
+            _fw_nvm_wait();
+        }
+    }
+
+    // the image is in place: disarm the staging header so the next boot doesn't
+    // reinstall, then reset into the new firmware. A power loss before this erase
+    // finishes just means one redundant (verified) reinstall at the next boot.
+    _fw_raw_cs(false);
+    _fw_raw_xfer(CMD_ENABLE_WRITE);
+    _fw_raw_cs(true);
+    _fw_raw_cs(false);
+    _fw_raw_xfer(CMD_SECTOR_ERASE);
+    _fw_raw_xfer((FW_UPDATE_STAGING_BASE >> 16) & 0xFF);
+    _fw_raw_xfer((FW_UPDATE_STAGING_BASE >> 8) & 0xFF);
+    _fw_raw_xfer(FW_UPDATE_STAGING_BASE & 0xFF);
+    _fw_raw_cs(true);
+    uint8_t status;
+    do {
+        _fw_raw_cs(false);
+        _fw_raw_xfer(CMD_READ_STATUS);
+        status = _fw_raw_xfer(0xFF);
+        _fw_raw_cs(true);
+    } while (status & 1);
+
+    NVIC_SystemReset();
+    while (1);
+}
+
+void fw_update_apply_if_staged(void) {
+    watch_enable_spi();
+    spi_flash_init();
+
+    fw_update_header_t header;
+    if (!_fw_read_header(&header)) {
+        watch_disable_spi();
+        return;
+    }
+
+    // verify the staged image one more time, from the copy the applier will actually
+    // read: arming happened on an earlier boot, and the flash has had time to be
+    // wrong. A mismatch disarms the header rather than installing a corrupt image.
+    uint32_t crc = 0xFFFFFFFF;
+    uint8_t chunk[FW_PAGE_SIZE];
+    for (uint32_t offset = 0; offset < header.size; offset += FW_PAGE_SIZE) {
+        uint32_t take = header.size - offset;
+        if (take > FW_PAGE_SIZE) take = FW_PAGE_SIZE;
+        spi_flash_read_data(FW_IMAGE_BASE + offset, chunk, take);
+        crc = _fw_crc32(crc, chunk, take);
+    }
+    if (crc != header.crc) {
+        fw_update_cancel();
+        return;
+    }
+
+    __disable_irq();
+    _fw_install(header.size);
+}
@@ -0,0 +1,105 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef FW_UPDATE_H_
+#define FW_UPDATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Firmware update staging through the SPI flash, for boards that have one.
+//
+// The usual field update is a paperclip into the reset button, the UF2 bootloader,
+// and a minute of mass-storage copying per watch. This pipeline replaces that for
+// watches already in the wild: a new image streams over the CDC shell into a staging
+// area at the top of the SPI flash while the watch keeps running, is CRC-verified end
+// to end, and a RAM-resident applier installs it into the program flash at the next
+// reset — sub-second downtime, no buttons, no bootloader session.
+//
+// Two staging modes share the area. A full image streams as-is; a delta streams only
+// the 256-byte pages that differ from the running firmware (the applier-side format
+// of utils/make_fw_delta.py), with the running image copied out of program flash as
+// the baseline first. Either way the staged image is reconstructed in SPI flash in
+// full and verified against the expected CRC of the final image before the header
+// that arms the applier is written — a failed or interrupted transfer just leaves a
+// stale staging area that never gets armed.
+//
+// The CRC is littlefs's CRC-32 (reflected polynomial 0xedb88320, seed 0xffffffff,
+// final value not inverted), the same one the shell's transfer framing uses.
+
+#ifndef FW_UPDATE_STAGING_BASE
+// staging area base in the SPI flash: the top 256 KB of the 2 MB chip on the
+// Sensor Watch Flash board. Keep accel_capture and other users below this.
+#define FW_UPDATE_STAGING_BASE 0x1C0000
+#endif
+
+/** @brief Begins staging a full firmware image.
+  * @param size length of the image in bytes; must fit the application flash region.
+  * @param crc expected CRC-32 of the whole image.
+  * @return false if the size is out of range or the SPI flash did not respond.
+  */
+bool fw_update_staging_begin(uint32_t size, uint32_t crc);
+
+/** @brief Begins staging a delta update: copies the running firmware image out of
+  *        program flash as the baseline, to be patched by fw_update_staging_patch_page.
+  * @param size length of the final image in bytes.
+  * @param crc expected CRC-32 of the final image.
+  */
+bool fw_update_staging_begin_delta(uint32_t size, uint32_t crc);
+
+/** @brief Streams the next chunk of a full image begun with fw_update_staging_begin.
+  *        Chunks may be any length; pages are assembled and programmed as they fill.
+  */
+bool fw_update_staging_write(const uint8_t *data, uint32_t length);
+
+/** @brief Replaces one 256-byte page of a delta staging begun with
+  *        fw_update_staging_begin_delta.
+  * @param page_index offset of the page in the final image, in 256-byte units.
+  * @param data the page contents; the final page of the image may be short.
+  * @param length bytes in the page, 256 except possibly for the last page.
+  */
+bool fw_update_staging_patch_page(uint32_t page_index, const uint8_t *data, uint32_t length);
+
+/** @brief Verifies the staged image against the expected CRC and, if it matches,
+  *        writes the header that arms the applier for the next reset.
+  * @return false if the read-back CRC does not match; the staging area is not armed.
+  */
+bool fw_update_staging_commit(void);
+
+/** @brief Disarms any staged update and abandons a staging in progress. */
+void fw_update_cancel(void);
+
+/** @brief Prints staging status: armed image size and CRC, or staging progress. */
+void fw_update_print_status(void);
+
+/** @brief Installs an armed staged image, if there is one, and resets. Called from
+  *        main() before any application code runs. The install loop and everything
+  *        it touches run from RAM with interrupts off: program flash contents are
+  *        undefined underneath it until the last row is programmed. After a verified
+  *        install the staging header is erased (so a crash mid-install retries at
+  *        the next reset, and a completed one doesn't), then the MCU resets into
+  *        the new firmware. Returns immediately when nothing is staged.
+  */
+void fw_update_apply_if_staged(void);
+
+#endif // FW_UPDATE_H_
@@ -25,12 +25,39 @@
 #include "lis2dw.h"
 #include "watch.h"
 
+// CTRL1 holds the sensor's whole power state — data rate, mode, low power mode — and every
+// setter does a read-modify-write of it over the bus. Cache it in the driver: users like the
+// motion wake engine and the logging faces re-apply the same rate every time they trade the
+// sensor back and forth, and with the cache a redundant setting costs no bus traffic at all.
+static uint8_t lis2dw_ctrl1_cache;
+static bool lis2dw_ctrl1_cache_valid;
+
+static uint8_t _lis2dw_read_ctrl1(void) {
+    if (!lis2dw_ctrl1_cache_valid) {
+        lis2dw_ctrl1_cache = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1);
+        lis2dw_ctrl1_cache_valid = true;
+    }
+    return lis2dw_ctrl1_cache;
+}
+
+static void _lis2dw_write_ctrl1(uint8_t val) {
+    if (lis2dw_ctrl1_cache_valid && val == lis2dw_ctrl1_cache) return;
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val);
+    lis2dw_ctrl1_cache = val;
+    lis2dw_ctrl1_cache_valid = true;
+}
+
 bool lis2dw_begin(void) {
     if (lis2dw_get_device_id() != LIS2DW_WHO_AM_I_VAL) {
         return false;
     }
+    // the LIS2DW is rated for fast mode; run its (many) register transactions at 400 kHz.
+    watch_i2c_set_speed(WATCH_I2C_SPEED_FAST);
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL2, LIS2DW_CTRL2_VAL_BOOT);
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL2, LIS2DW_CTRL2_VAL_SOFT_RESET);
+    // the soft reset just zeroed CTRL1; seed the cache without a read.
+    lis2dw_ctrl1_cache = 0;
+    lis2dw_ctrl1_cache_valid = true;
     // Enable block data update (output registers not updated until MSB and LSB have been read) and address autoincrement
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL2, LIS2DW_CTRL2_VAL_BDU | LIS2DW_CTRL2_VAL_IF_ADD_INC);
 
@@ -115,14 +142,14 @@ lis2dw_range_t lis2dw_get_range(void) {
 }
 
 void lis2dw_set_data_rate(lis2dw_data_rate_t dataRate) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(0b1111 << 4);
+    uint8_t val = _lis2dw_read_ctrl1() & ~(0b1111 << 4);
     uint8_t bits = dataRate << 4;
 
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_write_ctrl1(val | bits);
 }
 
 lis2dw_data_rate_t lis2dw_get_data_rate(void) {
-    return watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) >> 4;
+    return _lis2dw_read_ctrl1() >> 4;
 }
 
 void lis2dw_set_filter_type(lis2dw_filter_t bwfilter) {
@@ -150,32 +177,32 @@ lis2dw_bandwidth_filtering_mode_t lis2dw_get_bandwidth_filtering(void) {
 }
 
 void lis2dw_set_mode(lis2dw_mode_t mode) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(0b1100);
+    uint8_t val = _lis2dw_read_ctrl1() & ~(0b1100);
     uint8_t bits = (mode << 2) & 0b1100;
 
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_write_ctrl1(val | bits);
 }
 
 lis2dw_mode_t lis2dw_get_mode(void) {
-    return (lis2dw_mode_t)(watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & 0b1100) >> 2;
+    return (lis2dw_mode_t)(_lis2dw_read_ctrl1() & 0b1100) >> 2;
 }
 
 void lis2dw_set_low_power_mode(lis2dw_low_power_mode_t mode) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(0b11);
+    uint8_t val = _lis2dw_read_ctrl1() & ~(0b11);
     uint8_t bits = mode & 0b11;
 
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_write_ctrl1(val | bits);
 }
 
 lis2dw_low_power_mode_t lis2dw_get_low_power_mode(void) {
-    return watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & 0b11;
+    return _lis2dw_read_ctrl1() & 0b11;
 }
 
 void lis2dw_set_low_noise_mode(bool on) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(LIS2DW_CTRL6_VAL_LOW_NOISE);
+    uint8_t val = _lis2dw_read_ctrl1() & ~(LIS2DW_CTRL6_VAL_LOW_NOISE);
     uint8_t bits = on ? LIS2DW_CTRL6_VAL_LOW_NOISE : 0;
 
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_write_ctrl1(val | bits);
 }
 
 bool lis2dw_get_low_noise_mode(void) {
@@ -193,11 +220,24 @@ inline void lis2dw_enable_fifo(void) {
 bool lis2dw_read_fifo(lis2dw_fifo_t *fifo_data) {
     uint8_t temp = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_SAMPLE);
     bool overrun = !!(temp & LIS2DW_FIFO_SAMPLE_OVERRUN);
+    uint8_t buffer[32 * 6];
+    uint8_t reg = LIS2DW_REG_OUT_X_L | 0x80; // set high bit for consecutive reads
 
     fifo_data->count = temp & LIS2DW_FIFO_SAMPLE_COUNT;
+    if (fifo_data->count == 0) return overrun;
+
+    // the output registers auto-increment and wrap back to OUT_X_L after OUT_Z_H, so the whole
+    // FIFO drains in a single burst: one transaction instead of two per sample.
+    watch_i2c_send(LIS2DW_ADDRESS, &reg, 1);
+    watch_i2c_receive(LIS2DW_ADDRESS, buffer, (uint16_t)fifo_data->count * 6);
 
     for(int i = 0; i < fifo_data->count; i++) {
-        fifo_data->readings[i] = lis2dw_get_raw_reading();
+        fifo_data->readings[i].x = buffer[i * 6];
+        fifo_data->readings[i].x |= ((uint16_t)buffer[i * 6 + 1]) << 8;
+        fifo_data->readings[i].y = buffer[i * 6 + 2];
+        fifo_data->readings[i].y |= ((uint16_t)buffer[i * 6 + 3]) << 8;
+        fifo_data->readings[i].z = buffer[i * 6 + 4];
+        fifo_data->readings[i].z |= ((uint16_t)buffer[i * 6 + 5]) << 8;
     }
 
     return overrun;
@@ -229,6 +269,30 @@ void lis2dw_configure_wakeup_int1(uint8_t threshold, bool latch, bool active_sta
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7, configuration | LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
 }
 
+void lis2dw_configure_tap_int1(uint8_t threshold, bool latch, bool active_state) {
+    uint8_t configuration;
+
+    // enable single tap interrupt on INT1 pin
+    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1, configuration | LIS2DW_CTRL4_INT1_SINGLE_TAP);
+
+    // same threshold on all three axes; one LSB is 1/32nd of full scale.
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_TAP_THS_X, threshold & 0b00011111);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_TAP_THS_Y, threshold & 0b00011111);
+    // the tap detection enable bits for all three axes live in the Z threshold register.
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_TAP_THS_Z,
+                     LIS2DW_TAP_THS_Z_VAL_X_EN | LIS2DW_TAP_THS_Z_VAL_Y_EN | LIS2DW_TAP_THS_Z_VAL_Z_EN | (threshold & 0b00011111));
+
+    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL3) & ~(LIS2DW_CTRL3_VAL_LIR);
+    if (!active_state) configuration |= LIS2DW_CTRL3_VAL_H_L_ACTIVE;
+    if (latch) configuration |= LIS2DW_CTRL3_VAL_LIR;
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL3, configuration);
+
+    // enable interrupts
+    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7, configuration | LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
+}
+
 lis2dw_wakeup_source lis2dw_get_wakeup_source() {
     return (lis2dw_wakeup_source) watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_SRC);
 }
@@ -229,6 +229,9 @@ typedef enum {
 #define LIS2DW_REG_TAP_THS_X 0x30
 #define LIS2DW_REG_TAP_THS_Y 0x31
 #define LIS2DW_REG_TAP_THS_Z 0x32
+#define LIS2DW_TAP_THS_Z_VAL_X_EN 0b10000000
+#define LIS2DW_TAP_THS_Z_VAL_Y_EN 0b01000000
+#define LIS2DW_TAP_THS_Z_VAL_Z_EN 0b00100000
 #define LIS2DW_REG_INT1_DUR 0x33
 
 #define LIS2DW_REG_WAKE_UP_THS 0x34
@@ -337,6 +340,8 @@ void lis2dw_clear_fifo(void);
 
 void lis2dw_configure_wakeup_int1(uint8_t threshold, bool latch, bool active_state);
 
+void lis2dw_configure_tap_int1(uint8_t threshold, bool latch, bool active_state);
+
 lis2dw_interrupt_source lis2dw_get_interrupt_source(void);
 
 lis2dw_wakeup_source lis2dw_get_wakeup_source(void);
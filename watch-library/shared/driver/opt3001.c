@@ -31,8 +31,13 @@ THE SOFTWARE.
 #include <math.h>
 
 #include "opt3001.h"
+#include "watch.h"
 #include "watch_utility.h"
 
+static opt3001_oneShotCallback_t _opt3001_oneShotCallback = NULL;
+static uint8_t _opt3001_oneShotAddr;
+static uint8_t _opt3001_oneShotPin;
+
 uint16_t opt3001_readManufacturerID(uint8_t devaddr) {
 	uint8_t buf[2];
 	buf[0] = (uint8_t) OPT3001_MANUFACTURER_ID; 
@@ -60,6 +65,8 @@ opt3001_Config_t opt3001_readConfig(uint8_t devaddr) {
 }
 
 void opt3001_writeConfig(uint8_t devaddr, opt3001_Config_t config) {
+	// the OPT3001 is rated for fast mode; claim it before each measurement kickoff.
+	watch_i2c_set_speed(WATCH_I2C_SPEED_FAST);
     uint8_t buf[3] = {OPT3001_CONFIG, (uint8_t)(config.rawData >> 8), (uint8_t)(config.rawData & 0x00FF)};
     watch_i2c_send(devaddr, buf, 3);
 	return;
@@ -69,6 +76,16 @@ opt3001_t opt3001_readResult(uint8_t devaddr) {
 	return opt3001_readRegister(devaddr, OPT3001_RESULT);
 }
 
+opt3001_ER_t opt3001_readRawResult(uint8_t devaddr) {
+	opt3001_ER_t er;
+	uint8_t buf[2];
+	buf[0] = (uint8_t) OPT3001_RESULT;
+	watch_i2c_send(devaddr, buf, 1);
+	watch_i2c_receive(devaddr, buf, 2);
+	er.rawData = ((uint16_t) buf[0] << 8) | ((uint16_t) buf[1]);
+	return er;
+}
+
 opt3001_t opt3001_readHighLimit(uint8_t devaddr) {
 	return opt3001_readRegister(devaddr, OPT3001_HIGH_LIMIT);
 }
@@ -77,6 +94,42 @@ opt3001_t opt3001_readLowLimit(uint8_t devaddr) {
 	return opt3001_readRegister(devaddr, OPT3001_LOW_LIMIT);
 }
 
+static void _opt3001_oneShotDone(void) {
+	watch_register_interrupt_callback(_opt3001_oneShotPin, NULL, INTERRUPT_TRIGGER_NONE);
+	if (_opt3001_oneShotCallback) {
+		opt3001_oneShotCallback_t callback = _opt3001_oneShotCallback;
+		_opt3001_oneShotCallback = NULL;
+		opt3001_t result = opt3001_readResult(_opt3001_oneShotAddr);
+		// reading the config register clears the chip's latched INT flags.
+		opt3001_readConfig(_opt3001_oneShotAddr);
+		callback(result);
+	}
+}
+
+void opt3001_startOneShot(uint8_t devaddr, uint8_t int_pin, opt3001_oneShotCallback_t callback) {
+    watch_i2c_set_speed(WATCH_I2C_SPEED_FAST);
+	_opt3001_oneShotCallback = callback;
+	_opt3001_oneShotAddr = devaddr;
+	_opt3001_oneShotPin = int_pin;
+
+	// setting the two MSBs of the low limit exponent puts the INT pin in end-of-conversion mode.
+	uint8_t buf[3] = {OPT3001_LOW_LIMIT, 0xC0, 0x00};
+	watch_i2c_send(devaddr, buf, 3);
+
+	// the INT pin is open-drain and active low: pull it up and wake on the falling edge.
+	watch_register_interrupt_callback(int_pin, _opt3001_oneShotDone, INTERRUPT_TRIGGER_FALLING);
+	watch_enable_pull_up(int_pin);
+
+	// kick a single-shot conversion with automatic full-scale ranging; the chip powers
+	// itself back down when the conversion lands.
+	opt3001_Config_t config = {
+		.RangeNumber = 0B1100,
+		.Latch = 0B1,
+		.ModeOfConversionOperation = 0B01
+	};
+	opt3001_writeConfig(devaddr, config);
+}
+
 opt3001_t opt3001_readRegister(uint8_t devaddr, opt3001_Command_t command) {
     opt3001_t result;
     opt3001_ER_t er;
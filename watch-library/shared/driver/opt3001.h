@@ -77,6 +77,10 @@ uint16_t opt3001_readManufacturerID(uint8_t devaddr);
 uint16_t opt3001_readDeviceID(uint8_t devaddr);
 
 opt3001_t opt3001_readResult(uint8_t devaddr);
+
+// Reads the result register without the floating point lux conversion: the
+// exponent/mantissa word comes back as-is for callers that work in log2 terms.
+opt3001_ER_t opt3001_readRawResult(uint8_t devaddr);
 opt3001_t opt3001_readHighLimit(uint8_t devaddr);
 opt3001_t opt3001_readLowLimit(uint8_t devaddr);
 
@@ -84,4 +88,16 @@ opt3001_Config_t opt3001_readConfig(uint8_t devaddr);
 void opt3001_writeConfig(uint8_t devaddr, opt3001_Config_t config);
 opt3001_t opt3001_readRegister(uint8_t devaddr, opt3001_Command_t command);
 
+// A callback for a one-shot measurement, called with the conversion result.
+typedef void (*opt3001_oneShotCallback_t)(opt3001_t result);
+
+// Kicks off a single autoranging conversion and returns immediately. The chip's INT pin,
+// wired to int_pin on the nine-pin connector, is put in end-of-conversion mode and routed
+// through the external interrupt controller; when the conversion lands (up to 800 ms later)
+// the result is read out and handed to the callback. The chip powers itself down afterwards,
+// and the CPU is free to sleep in between instead of polling ConversionReady over I2C.
+// Requires watch_enable_i2c and watch_enable_external_interrupts to have been called.
+// Note that the callback runs in interrupt context.
+void opt3001_startOneShot(uint8_t devaddr, uint8_t int_pin, opt3001_oneShotCallback_t callback);
+
 #endif // OPT3001_
@@ -39,6 +39,7 @@ static void flash_disable(void) {
 }
 
 static bool transfer(uint8_t *command, uint32_t command_length, uint8_t *data_in, uint8_t *data_out, uint32_t data_length) {
+    flash_enable();
     bool status = watch_spi_write(command, command_length);
     if (status) {
         if (data_in != NULL && data_out != NULL) {
@@ -87,10 +88,8 @@ bool spi_flash_write_data(uint32_t address, uint8_t *data, uint32_t data_length)
     // Write the SPI flash write address into the bytes following the command byte.
     address_to_bytes(address, request + 1);
     flash_enable();
-    bool status = watch_spi_write(request, 4);
-    if (status) {
-        status = watch_spi_write(data, data_length);
-    }
+    // command header and payload go out in one DMA chain, CPU idle; no staging copy.
+    bool status = watch_spi_write_scatter(request, 4, data, data_length);
     flash_disable();
     return status;
 }
@@ -113,6 +112,38 @@ bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length)
     return status;
 }
 
+bool spi_flash_wait_until_ready(void) {
+    uint8_t status = 0;
+    // A page program takes a millisecond or three. Check once in case the part is
+    // already idle, then sleep a millisecond between polls instead of hammering the
+    // status register over the bus with the CPU spinning.
+    if (!spi_flash_read_command(CMD_READ_STATUS, &status, 1)) return false;
+    while (status & 0x01) {
+        delay_ms(1);
+        if (!spi_flash_read_command(CMD_READ_STATUS, &status, 1)) return false;
+    }
+    return true;
+}
+
+bool spi_flash_write_pages(uint32_t address, uint8_t *data, uint32_t data_length) {
+    while (data_length) {
+        // a page program wraps at a 256 byte boundary, so never cross one.
+        uint32_t chunk = 256 - (address & 0xFF);
+        if (chunk > data_length) chunk = data_length;
+        // Wait only if the previous page is still programming: whatever the caller
+        // did between calls (and this chunk's setup) overlaps the program cycle
+        // instead of being tacked on after it.
+        if (!spi_flash_wait_until_ready()) return false;
+        if (!spi_flash_command(CMD_ENABLE_WRITE)) return false;
+        if (!spi_flash_write_data(address, data, chunk)) return false;
+        address += chunk;
+        data += chunk;
+        data_length -= chunk;
+    }
+    // the final page is still programming when we return.
+    return true;
+}
+
 void spi_flash_init(void) {
 	gpio_set_pin_level(A3, true);
 	gpio_set_pin_direction(A3, GPIO_DIRECTION_OUT);
@@ -55,4 +55,11 @@ bool spi_flash_write_command(uint8_t command, uint8_t *data, uint32_t length);
 bool spi_flash_sector_command(uint8_t command, uint32_t address);
 bool spi_flash_write_data(uint32_t address, uint8_t *data, uint32_t data_length);
 bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length);
+// Waits out any program or erase cycle, sleeping between status polls.
+bool spi_flash_wait_until_ready(void);
+// Writes a buffer spanning any number of 256-byte pages, handling write enables and
+// page boundaries, and waiting for each program cycle only when the next page is
+// ready to go. Returns while the final page is still programming; call
+// spi_flash_wait_until_ready() before reading the data back.
+bool spi_flash_write_pages(uint32_t address, uint8_t *data, uint32_t data_length);
 void spi_flash_init(void);
@@ -0,0 +1,229 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "step_count.h"
+#include "lis2dw.h"
+#include "watch.h"
+
+#define STEP_COUNT_WATERMARK 24
+
+// all filter state is Q4 fixed point (four fraction bits): enough headroom that the
+// one-pole update terms don't truncate to zero near convergence, while a worst-case
+// L1 magnitude (3 * 32767 << 4) still fits an int32 with room to spare.
+#define STEP_COUNT_GRAVITY_SHIFT 5    // gravity tracker corner ~0.13 Hz at 25 Hz
+#define STEP_COUNT_SMOOTH_SHIFT 2     // smoothing corner ~1.1 Hz; together a walking-band band-pass
+#define STEP_COUNT_ENVELOPE_SHIFT 6   // peak envelope decays with a ~2.5 second time constant
+#define STEP_COUNT_THRESHOLD_FLOOR (1200 << 4)  // ~0.15 g of band-passed L1 swing at ±4g, empirical
+#define STEP_COUNT_REFRACTORY 8       // samples between accepted peaks; caps cadence just over 3 Hz
+#define STEP_COUNT_RHYTHM_WINDOW 50   // samples (2 s); peaks further apart start a new candidate walk
+#define STEP_COUNT_RHYTHM_RUN 4       // rhythmic peaks needed before a walk is credited
+
+#define STEP_COUNT_EPOCH_SAMPLES 750  // 30 seconds at 25 Hz
+#define STEP_COUNT_EPOCH_RING 16      // completed epochs held for the consumer; 8 minutes of slack
+#define STEP_COUNT_ACTIVITY_SHIFT 10  // epoch magnitude sum -> one byte; still wrist lands ~20, empirical
+
+static struct {
+    bool active;
+    uint32_t steps;
+    int32_t gravity_q4;    // slow low-pass of the L1 magnitude: gravity plus DC drift
+    int32_t band_q4;       // band-passed magnitude (high-passed against gravity, then smoothed)
+    int32_t envelope_q4;   // decaying peak envelope; half of it is the detection threshold
+    bool above;            // band is currently above threshold (for rising-edge detection)
+    uint8_t refractory;    // samples until the next peak may be accepted
+    uint8_t since_peak;    // samples since the last accepted peak, saturating
+    uint8_t pending;       // rhythmic peaks so far in the current candidate walk
+} engine;
+
+// epoch aggregation state. The ring is single-producer (the interrupt) and
+// single-consumer (the face's background task): the producer only moves write_index,
+// the consumer only moves read_index, so no locking is needed.
+static struct {
+    bool enabled;
+    uint16_t samples;      // samples into the current epoch
+    uint16_t crossings;    // zero crossings of the band-passed signal so far
+    uint32_t activity;     // sum of the band-passed magnitude, in raw counts
+    bool positive;         // sign of the band at the previous sample
+    step_count_epoch_t ring[STEP_COUNT_EPOCH_RING];
+    uint8_t write_index;
+    uint8_t read_index;
+} epochs;
+
+static void _step_count_close_epoch(void) {
+    if ((uint8_t)(epochs.write_index - epochs.read_index) < STEP_COUNT_EPOCH_RING) {
+        step_count_epoch_t *epoch = &epochs.ring[epochs.write_index % STEP_COUNT_EPOCH_RING];
+        // 750 samples can cross at most 750 times; quartering fits the count in a byte.
+        epoch->crossings = epochs.crossings >> 2;
+        uint32_t activity = epochs.activity >> STEP_COUNT_ACTIVITY_SHIFT;
+        epoch->activity = activity > 0xFF ? 0xFF : activity;
+        epochs.write_index++;
+    }
+    // if the ring was full, the epoch just fell on the floor; the consumer was told to keep up.
+    epochs.samples = 0;
+    epochs.crossings = 0;
+    epochs.activity = 0;
+}
+
+static void _step_count_int1_interrupt(void) {
+    step_count_service();
+}
+
+static inline void _step_count_feed(lis2dw_reading_t reading) {
+    int32_t ax = reading.x;
+    int32_t ay = reading.y;
+    int32_t az = reading.z;
+    if (ax < 0) ax = -ax;
+    if (ay < 0) ay = -ay;
+    if (az < 0) az = -az;
+    int32_t magnitude_q4 = (ax + ay + az) << 4;
+
+    engine.gravity_q4 += (magnitude_q4 - engine.gravity_q4) >> STEP_COUNT_GRAVITY_SHIFT;
+    engine.band_q4 += ((magnitude_q4 - engine.gravity_q4) - engine.band_q4) >> STEP_COUNT_SMOOTH_SHIFT;
+
+    if (epochs.enabled) {
+        // epoch aggregation rides on the band the step kernel just computed: a sign
+        // change is a zero crossing, and the magnitude sum is the restlessness fuel.
+        bool positive = engine.band_q4 >= 0;
+        if (positive != epochs.positive) epochs.crossings++;
+        epochs.positive = positive;
+        epochs.activity += (uint32_t)(positive ? engine.band_q4 : -engine.band_q4) >> 4;
+        if (++epochs.samples >= STEP_COUNT_EPOCH_SAMPLES) _step_count_close_epoch();
+    }
+
+    if (engine.band_q4 > engine.envelope_q4) engine.envelope_q4 = engine.band_q4;
+    else engine.envelope_q4 -= engine.envelope_q4 >> STEP_COUNT_ENVELOPE_SHIFT;
+
+    int32_t threshold_q4 = engine.envelope_q4 >> 1;
+    if (threshold_q4 < STEP_COUNT_THRESHOLD_FLOOR) threshold_q4 = STEP_COUNT_THRESHOLD_FLOOR;
+
+    if (engine.since_peak < 0xFF) engine.since_peak++;
+    if (engine.refractory) engine.refractory--;
+
+    bool above = engine.band_q4 > threshold_q4;
+    if (above && !engine.above && !engine.refractory) {
+        // a rising crossing: a peak. Steps are held back until a rhythm establishes
+        // itself; the peak that completes the run credits the whole run at once.
+        if (engine.since_peak >= STEP_COUNT_RHYTHM_WINDOW) engine.pending = 0;
+        engine.since_peak = 0;
+        engine.refractory = STEP_COUNT_REFRACTORY;
+        if (engine.pending < STEP_COUNT_RHYTHM_RUN) {
+            engine.pending++;
+            if (engine.pending == STEP_COUNT_RHYTHM_RUN) engine.steps += STEP_COUNT_RHYTHM_RUN;
+        } else {
+            engine.steps++;
+        }
+    }
+    engine.above = above;
+}
+
+bool step_count_begin(void) {
+    if (engine.active) return true;
+
+    // hold the I2C bus powered for the life of the engine; the watermark handler
+    // must be able to drain the FIFO even while Movement idles in low energy mode.
+    watch_enable_i2c();
+    if (!lis2dw_begin()) {
+        watch_disable_i2c();
+        return false;
+    }
+
+    memset(&engine, 0, sizeof(engine));
+    engine.active = true;
+
+    lis2dw_set_low_power_mode(LIS2DW_LP_MODE_2); // 14-bit, ~3.5 µA at 25 Hz with low noise
+    lis2dw_set_low_noise_mode(true);
+    lis2dw_set_range(LIS2DW_RANGE_4_G);
+    lis2dw_set_data_rate(LIS2DW_DATA_RATE_25_HZ);
+
+    // FIFO in continuous mode with the watermark a few samples shy of full,
+    // so the interrupt leaves slack for the MCU to wake and drain it.
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_CTRL,
+                     LIS2DW_FIFO_CTRL_MODE_COLLECT_CONTINUOUS | STEP_COUNT_WATERMARK);
+
+    // route the watermark to INT1 and enable interrupts.
+    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1, configuration | LIS2DW_CTRL4_INT1_FTH);
+    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7, configuration | LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
+
+    watch_register_interrupt_callback(A4, _step_count_int1_interrupt, INTERRUPT_TRIGGER_RISING);
+
+    return true;
+}
+
+void step_count_service(void) {
+    if (!engine.active) return;
+
+    // one I2C burst moves the whole FIFO; the kernel runs over the batch in
+    // tens of microseconds and the MCU is back asleep before the next sample lands.
+    static lis2dw_fifo_t fifo;
+    lis2dw_read_fifo(&fifo);
+
+    for (uint8_t i = 0; i < fifo.count; i++) {
+        _step_count_feed(fifo.readings[i]);
+    }
+}
+
+void step_count_end(void) {
+    if (!engine.active) return;
+
+    watch_register_interrupt_callback(A4, NULL, INTERRUPT_TRIGGER_NONE);
+    lis2dw_disable_fifo();
+    lis2dw_set_data_rate(LIS2DW_DATA_RATE_POWERDOWN);
+    watch_disable_i2c();
+    engine.active = false;
+}
+
+uint32_t step_count_steps(void) {
+    return engine.steps;
+}
+
+void step_count_reset(void) {
+    engine.steps = 0;
+    engine.pending = 0;
+    engine.since_peak = 0xFF;
+}
+
+bool step_count_is_active(void) {
+    return engine.active;
+}
+
+void step_count_epochs_enable(bool enable) {
+    epochs.enabled = false;
+    epochs.samples = 0;
+    epochs.crossings = 0;
+    epochs.activity = 0;
+    epochs.positive = false;
+    epochs.write_index = epochs.read_index = 0;
+    epochs.enabled = enable;
+}
+
+uint8_t step_count_epochs_read(step_count_epoch_t *buffer, uint8_t max) {
+    uint8_t drained = 0;
+    while (drained < max && epochs.read_index != epochs.write_index) {
+        buffer[drained++] = epochs.ring[epochs.read_index % STEP_COUNT_EPOCH_RING];
+        epochs.read_index++;
+    }
+    return drained;
+}
@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef STEP_COUNT_H_
+#define STEP_COUNT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Step counting engine for boards with the LIS2DW.
+//
+// The accelerometer runs at 25 Hz in 14-bit low power mode and collects samples into
+// its 32-entry FIFO while the MCU sleeps; the watermark interrupt (threshold 24, routed
+// to INT1 on pin A4) wakes us roughly once a second. The handler drains the FIFO in one
+// I2C burst and feeds the batch through the detection kernel, then the MCU goes back to
+// STANDBY. The I2C burst dominates each wake; the kernel itself is nothing but integer
+// adds, shifts and compares — around two dozen cycles per sample, tens of microseconds
+// for a full batch — so there is no reason to stay awake for it.
+//
+// The kernel works on the L1 magnitude |x|+|y|+|z|, which needs no multiplies and is
+// orientation-tolerant enough for cadence detection. A slow one-pole low-pass tracks
+// gravity plus drift and is subtracted out; a fast one-pole smooths what remains, giving
+// a band-pass centered on walking cadence. Peaks are accepted against an adaptive
+// threshold — half of a slowly decaying peak envelope, with a fixed floor so noise on a
+// still wrist never counts — and a refractory window caps cadence a little over 3 Hz.
+// To reject single jolts (a door slam, setting the watch down) steps are only credited
+// once four rhythmic peaks land within two seconds of each other; the fourth credits
+// all four retroactively.
+//
+// While running, the engine owns pin A4 and the accelerometer's data rate, FIFO and
+// INT1 routing: do not combine it with accel_capture or with
+// movement_enable_motion_wake on the same pin.
+//
+// The engine can also aggregate 30-second epochs for sleep tracking: per epoch, the
+// number of zero crossings of the band-passed signal and a scaled sum of its magnitude.
+// Both piggyback on values the step kernel already computes, adding a handful of cycles
+// per sample to the same FIFO-drain window — no extra wakes, no extra bus traffic.
+// Completed epochs land in a small internal ring for a consumer (the sleep face) to
+// drain at its leisure; sixteen entries buy it eight minutes of slack.
+
+/** @brief Configures the accelerometer (25 Hz, 14-bit low power, FIFO watermark on INT1)
+  *        and starts counting. The step total starts at zero.
+  * @return false if the accelerometer is missing.
+  */
+bool step_count_begin(void);
+
+/** @brief Drains the accelerometer FIFO and runs the detection kernel over the batch.
+  * @note The INT1 interrupt handler calls this on its own; it is public as a fallback
+  *       for boards where the interrupt pin isn't wired, where a once-per-second call
+  *       keeps up with the FIFO (which holds 1.28 seconds at 25 Hz).
+  */
+void step_count_service(void);
+
+/** @brief Stops sampling and powers the accelerometer down. The step total is retained. */
+void step_count_end(void);
+
+/** @brief Gets the number of steps detected since step_count_begin or step_count_reset. */
+uint32_t step_count_steps(void);
+
+/** @brief Zeroes the step total without disturbing the sampling pipeline (e.g. at midnight). */
+void step_count_reset(void);
+
+/** @brief Returns true if the engine is currently sampling. */
+bool step_count_is_active(void);
+
+typedef struct {
+    uint8_t crossings;  // zero crossings of the band-passed signal, scaled by 1/4
+    uint8_t activity;   // sum of the band-passed magnitude over the epoch, scaled; saturates
+} step_count_epoch_t;
+
+/** @brief Starts or stops 30-second epoch aggregation. Starting zeroes the accumulators
+  *        and empties the epoch ring; the engine must be running for epochs to advance. */
+void step_count_epochs_enable(bool enable);
+
+/** @brief Drains up to max completed epochs into the given buffer, oldest first.
+  * @return the number of epochs written. Call at least every few minutes while
+  *         aggregating; if the internal ring fills, the oldest epochs are dropped.
+  */
+uint8_t step_count_epochs_read(step_count_epoch_t *buffer, uint8_t max);
+
+#endif // STEP_COUNT_H_
@@ -23,6 +23,7 @@
  */
 
 #include "thermistor_driver.h"
+#include "thermistor_table.h"
 #include "watch.h"
 #include "watch_utility.h"
 
@@ -46,7 +47,29 @@ void thermistor_driver_disable(void) {
     watch_disable_digital_output(THERMISTOR_ENABLE_PIN);
 }
 
-float thermistor_driver_get_temperature(void) {
+static thermistor_driver_callback_t _thermistor_driver_callback = NULL;
+
+static void _thermistor_driver_conversion_done(uint16_t value) {
+    // power down the thermistor circuit now that the sense pin has been sampled.
+    watch_set_pin_level(THERMISTOR_ENABLE_PIN, !THERMISTOR_ENABLE_VALUE);
+    if (_thermistor_driver_callback) {
+        thermistor_driver_callback_t callback = _thermistor_driver_callback;
+        _thermistor_driver_callback = NULL;
+        callback(thermistor_driver_raw_to_centidegrees(value) / 100.0);
+    }
+}
+
+int16_t thermistor_driver_raw_to_centidegrees(uint16_t value) {
+    // the top six bits of the ADC code pick a table row; the low ten bits interpolate
+    // linearly to the next row. The table is generated by utils/gen_thermistor_table.py
+    // from the circuit constants above, replacing the B-equation float path whose
+    // softfloat logarithm dominated the cost of a background temperature sample.
+    int32_t floor_cd = Thermistor_Table[value >> 10];
+    int32_t ceil_cd = Thermistor_Table[(value >> 10) + 1];
+    return (int16_t)(floor_cd + (((ceil_cd - floor_cd) * (int32_t)(value & 0x3FF)) >> 10));
+}
+
+int16_t thermistor_driver_get_temperature_centidegrees(void) {
     // set the enable pin to the level that powers the thermistor circuit.
     watch_set_pin_level(THERMISTOR_ENABLE_PIN, THERMISTOR_ENABLE_VALUE);
     // get the sense pin level
@@ -54,5 +77,18 @@ float thermistor_driver_get_temperature(void) {
     // and then set the enable pin to the opposite value to power down the thermistor circuit.
     watch_set_pin_level(THERMISTOR_ENABLE_PIN, !THERMISTOR_ENABLE_VALUE);
 
-    return watch_utility_thermistor_temperature(value, THERMISTOR_HIGH_SIDE, THERMISTOR_B_COEFFICIENT, THERMISTOR_NOMINAL_TEMPERATURE, THERMISTOR_NOMINAL_RESISTANCE, THERMISTOR_SERIES_RESISTANCE);
+    return thermistor_driver_raw_to_centidegrees(value);
+}
+
+void thermistor_driver_get_temperature_async(thermistor_driver_callback_t callback) {
+    _thermistor_driver_callback = callback;
+    // set the enable pin to the level that powers the thermistor circuit.
+    watch_set_pin_level(THERMISTOR_ENABLE_PIN, THERMISTOR_ENABLE_VALUE);
+    // kick off the conversion; the ADC powers the circuit down and delivers the temperature
+    // from its interrupt handler, so the caller can go right back to sleep.
+    watch_get_analog_pin_level_async(THERMISTOR_SENSE_PIN, _thermistor_driver_conversion_done);
+}
+
+float thermistor_driver_get_temperature(void) {
+    return thermistor_driver_get_temperature_centidegrees() / 100.0;
 }
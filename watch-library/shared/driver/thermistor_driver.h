@@ -36,8 +36,22 @@
 #define THERMISTOR_NOMINAL_RESISTANCE (10000.0)
 #define THERMISTOR_SERIES_RESISTANCE (10000.0)
 
+// A callback for an asynchronous temperature measurement, called with the temperature in degrees celsius.
+typedef void (*thermistor_driver_callback_t)(float temperature);
+
 void thermistor_driver_enable(void);
 void thermistor_driver_disable(void);
 float thermistor_driver_get_temperature(void);
+// Like thermistor_driver_get_temperature, but in centidegrees celsius. Conversions run on
+// a 64-interval table generated from the constants above (utils/gen_thermistor_table.py),
+// so a sample costs one table interpolation instead of a softfloat logarithm; the float
+// getter is the same result divided by 100.
+int16_t thermistor_driver_get_temperature_centidegrees(void);
+// Converts a raw ADC code from the sense pin to centidegrees celsius.
+int16_t thermistor_driver_raw_to_centidegrees(uint16_t value);
+// Like thermistor_driver_get_temperature, but returns immediately and delivers the temperature
+// via callback (from interrupt context) when the ADC conversion completes, so the CPU can sleep
+// through the measurement. Useful for background temperature logging.
+void thermistor_driver_get_temperature_async(thermistor_driver_callback_t callback);
 
 #endif // THERMISTOR_DRIVER_H_
@@ -0,0 +1,23 @@
+// Generated by utils/gen_thermistor_table.py. Do not edit by hand;
+// re-run the script if the thermistor circuit constants change.
+#ifndef _THERMISTOR_TABLE_H_INCLUDED
+#define _THERMISTOR_TABLE_H_INCLUDED
+
+#include <stdint.h>
+
+// Thermistor_Table[value >> 10] is the temperature in centidegrees celsius at the
+// bottom of that 1024-count slice of the ADC scale; the 65th entry closes the last
+// interpolation interval. Out-of-model extremes are clamped to +/- 99.99 C.
+static const int16_t Thermistor_Table[65] = {
+     -9999, -5479, -4430, -3757, -3247, -2829, -2470, -2152,
+     -1866, -1603, -1359, -1129,  -912,  -705,  -507,  -316,
+      -131,    49,   224,   396,   564,   731,   895,  1057,
+      1218,  1379,  1538,  1698,  1858,  2018,  2179,  2341,
+      2505,  2671,  2838,  3009,  3182,  3359,  3539,  3724,
+      3914,  4110,  4312,  4521,  4738,  4964,  5201,  5450,
+      5712,  5990,  6286,  6604,  6947,  7322,  7733,  8191,
+      8708,  9303,  9999,  9999,  9999,  9999,  9999,  9999,
+      9999,
+};
+
+#endif // _THERMISTOR_TABLE_H_INCLUDED
@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stddef.h>
+#include "lis2dw.h"
+#include "wrist_raise.h"
+#include "opt3001.h"
+#include "watch.h"
+
+#define WRIST_RAISE_LIGHT_SENSOR_ADDRESS 0x44
+
+static struct {
+    bool active;
+    wrist_raise_cb_t raised;
+    wrist_raise_cb_t raised_in_dark;
+} wrist;
+
+static void _wrist_raise_lux_ready(opt3001_t result) {
+    if (result.lux < WRIST_RAISE_LUX_THRESHOLD) wrist.raised_in_dark();
+}
+
+static void _wrist_raise_interrupt(void) {
+    // one register read tells us which orientation the part settled into.
+    uint8_t source = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_SIXD_SRC);
+    if (!(source & LIS2DW_WAKE_UP_SRC_VAL_6D_IA)) return;   // some other INT1 function fired
+    if (!(source & WRIST_RAISE_ORIENTATION)) return;        // rolled away, not raised
+
+    if (wrist.raised) wrist.raised();
+    if (wrist.raised_in_dark) {
+        // the conversion runs on the light sensor while we sleep; its end-of-conversion
+        // interrupt delivers the verdict to _wrist_raise_lux_ready.
+        opt3001_startOneShot(WRIST_RAISE_LIGHT_SENSOR_ADDRESS, WRIST_RAISE_LIGHT_SENSOR_PIN, _wrist_raise_lux_ready);
+    }
+}
+
+bool wrist_raise_begin(wrist_raise_cb_t raised, wrist_raise_cb_t raised_in_dark) {
+    if (wrist.active) return true;
+
+    // hold the I2C bus powered for the life of the engine; the interrupt handler
+    // has to be able to ask the part what happened at any hour.
+    watch_enable_i2c();
+    if (!lis2dw_begin()) {
+        watch_disable_i2c();
+        return false;
+    }
+
+    wrist.raised = raised;
+    wrist.raised_in_dark = raised_in_dark;
+    wrist.active = true;
+
+    // the 6D engine needs the part sampling; if another engine already has an
+    // output data rate going, ride along with it rather than disturbing it.
+    if (lis2dw_get_data_rate() == LIS2DW_DATA_RATE_POWERDOWN) {
+        lis2dw_set_low_power_mode(LIS2DW_LP_MODE_1);
+        lis2dw_set_data_rate(LIS2DW_DATA_RATE_12_5_HZ);
+    }
+
+    // 6D threshold at 60° from each axis; tap thresholds in the low bits stay zero.
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_TAP_THS_X, 0b10 << 5);
+
+    // run the 6D comparison on low-pass filtered data so a swinging arm doesn't
+    // chatter through orientations, then route the event to INT1.
+    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7,
+                     configuration | LIS2DW_CTRL7_VAL_LPASS_ON6D | LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
+    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1, configuration | LIS2DW_CTRL4_INT1_6D);
+
+    watch_register_interrupt_callback(A4, _wrist_raise_interrupt, INTERRUPT_TRIGGER_RISING);
+
+    return true;
+}
+
+bool wrist_raise_resume(wrist_raise_cb_t raised, wrist_raise_cb_t raised_in_dark) {
+    if (wrist.active) return true;
+
+    // the sensor rode through BACKUP mode on battery power with its configuration
+    // intact; only the MCU's half of the arrangement needs rebuilding.
+    watch_enable_i2c();
+    wrist.raised = raised;
+    wrist.raised_in_dark = raised_in_dark;
+    wrist.active = true;
+    watch_register_interrupt_callback(A4, _wrist_raise_interrupt, INTERRUPT_TRIGGER_RISING);
+    return true;
+}
+
+void wrist_raise_end(void) {
+    if (!wrist.active) return;
+
+    watch_register_interrupt_callback(A4, NULL, INTERRUPT_TRIGGER_NONE);
+    uint8_t configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1, configuration & ~LIS2DW_CTRL4_INT1_6D);
+    watch_disable_i2c();
+    wrist.active = false;
+}
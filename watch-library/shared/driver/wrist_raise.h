@@ -0,0 +1,89 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef WRIST_RAISE_H_
+#define WRIST_RAISE_H_
+
+#include <stdbool.h>
+
+// Wrist-raise detection on the LIS2DW's 6D orientation engine.
+//
+// The orientation detection runs entirely on the sensor: the chip compares its
+// low-pass filtered acceleration against a 60° cone around each axis and pulses
+// INT1 (pin A4) whenever the part settles into a new orientation. The MCU's only
+// job is the interrupt edge — one I2C register read to ask which orientation, and
+// if it's the dial-up one, the raised callback fires. No sampling loop, no timers,
+// no CPU cost while the wrist is down.
+//
+// If a raised_in_dark callback is given, each raise also kicks a one-shot lux
+// conversion on the OPT3001 (for boards that have one); when the conversion lands
+// below WRIST_RAISE_LUX_THRESHOLD the second callback fires, which Movement uses
+// to light the LED at night without ever lighting it in daylight.
+//
+// The engine rides along with whatever output data rate is already running — the
+// step counter's 25 Hz, say — and only starts its own (12.5 Hz low power) if the
+// part is powered down. While running it owns pin A4: do not combine it with
+// accel_capture, step_count or movement_enable_motion_wake on the same pin.
+// Both callbacks run in interrupt context; keep them short.
+
+#ifndef WRIST_RAISE_ORIENTATION
+// SIXD_SRC bit for "dial up" with the sensor board in its usual mounting.
+#define WRIST_RAISE_ORIENTATION LIS2DW_WAKE_UP_SRC_VAL_ZH
+#endif
+
+#ifndef WRIST_RAISE_LUX_THRESHOLD
+// below this many lux the room counts as dark and the raised_in_dark callback fires.
+#define WRIST_RAISE_LUX_THRESHOLD 20
+#endif
+
+#ifndef WRIST_RAISE_LIGHT_SENSOR_PIN
+// the OPT3001's INT pin on the nine-pin connector, for the end-of-conversion wake.
+#define WRIST_RAISE_LIGHT_SENSOR_PIN A0
+#endif
+
+typedef void (*wrist_raise_cb_t)(void);
+
+/** @brief Configures the 6D orientation engine and starts delivering raise events.
+  * @param raised called (from the interrupt) when the watch turns dial-up.
+  * @param raised_in_dark if not NULL, called after a raise once a lux one-shot
+  *        confirms the surroundings are dark. Requires the OPT3001.
+  * @return false if the accelerometer is missing.
+  */
+bool wrist_raise_begin(wrist_raise_cb_t raised, wrist_raise_cb_t raised_in_dark);
+
+/** @brief Resumes raise events on a warm boot, without touching the sensor.
+  * @details On a wake from BACKUP mode the LIS2DW never lost power: the 6D engine is
+  *          still configured, still sampling, and very possibly the thing that woke us.
+  *          This restores only the MCU's side — the I2C bus hold and the pin A4
+  *          interrupt — and skips wrist_raise_begin's WHO_AM_I probe and soft reset,
+  *          which would knock over the running engine and cost a handful of I2C
+  *          transactions on the boot path. Only call this when the previous session
+  *          had wrist raise active; on a cold boot use wrist_raise_begin.
+  */
+bool wrist_raise_resume(wrist_raise_cb_t raised, wrist_raise_cb_t raised_in_dark);
+
+/** @brief Stops delivering raise events and releases pin A4. The accelerometer's
+  *        data rate is left alone, in case another engine is riding on it. */
+void wrist_raise_end(void);
+
+#endif // WRIST_RAISE_H_
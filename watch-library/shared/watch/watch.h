@@ -34,6 +34,29 @@
 #include "watch_main_loop.h"
 #endif // __EMSCRIPTEN__
 
+/** @brief Places a function or lookup table in RAM instead of flash.
+  * @details The SAM L22 executes from flash with wait states; code that runs on every single
+  *          wake (the RTC tick handler, the display character renderer, the buzzer sequencer)
+  *          pays that stall on each instruction fetch. Items marked with this macro are copied
+  *          into SRAM at startup alongside initialized data and execute with zero wait states.
+  *          Use it sparingly: everything it marks takes RAM for the life of the firmware. Run
+  *          `make ramreport` to see what landed there and what it costs.
+  */
+#ifdef __EMSCRIPTEN__
+#define WATCH_RAMFUNC
+#else
+#define WATCH_RAMFUNC __attribute__((section(".ramfunc")))
+#endif
+
+/** @brief Marks a function that runs rarely — boot, setup, error recovery — as cold.
+  * @details The compiler optimizes cold functions purely for size and keeps them out of
+  *          line. This matters most in the link-time optimized build (make LTO=1), where
+  *          the inliner sees the whole firmware at once and would otherwise spend its
+  *          growth budget inlining one-shot setup code into hot callers instead of the
+  *          per-tick paths the LTO build exists to speed up. Harmless in non-LTO builds.
+  */
+#define WATCH_COLD __attribute__((cold))
+
 /** @mainpage Sensor Watch Documentation
  *  @brief This documentation covers most of the functions you will use to interact with the Sensor Watch
            hardware. It is divided into the following sections:
@@ -63,13 +86,19 @@
 #include "watch_extint.h"
 #include "watch_led.h"
 #include "watch_buzzer.h"
+#include "watch_fast_timer.h"
 #include "watch_adc.h"
 #include "watch_gpio.h"
 #include "watch_i2c.h"
 #include "watch_spi.h"
+#include "watch_dma.h"
 #include "watch_uart.h"
 #include "watch_storage.h"
 #include "watch_deepsleep.h"
+#include "watch_rand.h"
+#include "watch_crc32.h"
+#include "watch_profile.h"
+#include "watch_boot.h"
 
 #include "watch_private.h"
 
@@ -84,10 +113,62 @@ bool watch_is_buzzer_or_led_enabled(void);
   */
 bool watch_is_usb_enabled(void);
 
+/** @brief Selects the SAM L22's performance level: 0 (low power) or 2 (high performance).
+  * @param level 0 or 2. (The SAM L22 has no performance level 1.)
+  * @details The performance level sets the core voltage, trading maximum clock speed for
+  *          supply current. The chip boots at PL2, but the watch's 4 MHz core clock is
+  *          well within PL0's reach with no extra flash wait states, so _watch_init
+  *          demotes to PL0 at startup: every active cycle — including heavy stretches
+  *          like astronomy math, hashing or littlefs housekeeping, which run at the same
+  *          speed either way — then draws less current. You only need this function if
+  *          you reconfigure GCLK0 to run the core faster than PL0 allows (12 MHz):
+  *          promote to PL2 first, and demote after restoring the clock. The call blocks
+  *          for the few microseconds the voltage regulator takes to settle at the new
+  *          level. Demotion is ignored while USB is enabled, because the 48 MHz DFLL
+  *          that clocks it only runs at PL2.
+  */
+void watch_set_performance_level(uint8_t level);
+
+/** @brief Runs the CPU at 16 MHz until the matching watch_cpu_boost_end.
+  * @details For a bounded computation — ephemeris math, sunrise iteration, a hash — racing
+  *          through at 16 MHz and going back to sleep usually costs less energy than
+  *          grinding it out at 4 MHz: active current doesn't rise fourfold, but the active
+  *          window shrinks to a quarter. This switches the main oscillator to 16 MHz (with
+  *          the PL2 promotion and flash wait state that speed requires) and restores
+  *          everything on the matching end call; begin/end pairs nest. Use it only around
+  *          pure computation: everything clocked from GCLK0 — I2C, the UART, the buzzer,
+  *          delay_ms — runs proportionally fast inside the window, and cycle counts from
+  *          the profiler are in 16 MHz cycles while it's active.
+  */
+void watch_cpu_boost_begin(void);
+
+/** @brief Ends the scope opened by watch_cpu_boost_begin, restoring the normal CPU clock.
+  */
+void watch_cpu_boost_end(void);
+
+/** @brief Prints the live clock tree to the console: enabled generic clock generators and
+  *        peripheral channels, and the bus clock masks.
+  * @details _watch_init gates every APBC peripheral clock at boot and drivers claim their
+  *          own bits when opened, so whatever this prints is either held open by a driver
+  *          or a stray worth chasing. Also available as the `clocks` shell command.
+  */
+void watch_dump_clock_tree(void);
+
 /** @brief Resets in the UF2 bootloader mode
   */
 void watch_reset_to_bootloader(void);
 
+/** @brief Types a string on the USB host through the HID keyboard interface.
+  * @param str a NUL-terminated ASCII string, at most 32 characters.
+  * @return True if the string was queued. False if USB is disabled, the host hasn't
+  *         configured the keyboard interface, a previous string is still being typed,
+  *         or the string is too long.
+  * @details The whole string is queued at once and typed out by the USB task at
+  *          interrupt time — about 8 ms per character — so the caller can return to
+  *          its run loop (or to sleep) immediately.
+  */
+bool watch_usb_hid_type_string(const char *str);
+
 /** @brief Reads up to len bytes from the USB serial.
   * @param file ignored, you can pass in 0
   * @param ptr pointer to a buffer of at least len bytes
@@ -51,6 +51,44 @@ void watch_enable_analog_input(const uint8_t pin);
   **/
 uint16_t watch_get_analog_pin_level(const uint8_t pin);
 
+/** @brief A callback for an asynchronous analog conversion, called with the sampled value.
+  */
+typedef void (*watch_adc_callback_t)(uint16_t value);
+
+/** @brief Begins an analog conversion on one of the pins and returns immediately; the callback
+  *        is invoked from the ADC's interrupt handler when the result is ready.
+  * @param pin One of pins A0-A4.
+  * @param callback The function to call with the sampled value.
+  * @details Unlike watch_get_analog_pin_level, which busy-waits on the conversion with the CPU
+  *          awake, this function only starts the conversion. The ADC finishes the measurement on
+  *          its own clock, so the caller is free to return to the run loop and let the device go
+  *          to sleep; the "result ready" interrupt wakes it to deliver the value. This is the
+  *          right call for background sensor logging, where the conversion need not be rushed
+  *          but every active-mode millisecond counts. Only one conversion can be in flight at a
+  *          time; starting a second one before the first callback arrives replaces the first.
+  * @note The callback runs in interrupt context: stash the value and get out.
+  **/
+void watch_get_analog_pin_level_async(const uint8_t pin, watch_adc_callback_t callback);
+
+/** @brief Schedules autonomous periodic conversions of one of the pins, clocked by the RTC.
+  * @param pin One of pins A0-A4.
+  * @param frequency The sampling rate in Hz: a power of 2, from 1 to 128.
+  * @param callback The function to call with each sampled value.
+  * @details The RTC's periodic event triggers each conversion through the event system,
+  *          entirely in hardware: no software ever starts a conversion, and both the event
+  *          channel and the ADC run in STANDBY. The CPU wakes only when a result is ready,
+  *          stores the value via the callback, and goes straight back to sleep — with
+  *          hardware averaging configured (@see watch_set_analog_oversampling), that one
+  *          brief wake delivers a whole averaged burst. Sampling continues until
+  *          watch_adc_cancel_periodic is called.
+  * @note The callback runs in interrupt context: stash the value and get out.
+  **/
+void watch_adc_schedule_periodic(const uint8_t pin, uint8_t frequency, watch_adc_callback_t callback);
+
+/** @brief Stops the periodic sampling started by watch_adc_schedule_periodic.
+  **/
+void watch_adc_cancel_periodic(void);
+
 /** @brief Sets the number of samples to accumulate when measuring a pin level. Default is 16.
   * @param samples A power of 2 <= 1024. Specifically: 1, 2, 4, 8, 16, 32, 64, 128, 256, 512
                    or 1024. Any other value will be ignored.
@@ -74,6 +112,22 @@ uint16_t watch_get_analog_pin_level(const uint8_t pin);
   **/
 void watch_set_analog_num_samples(uint16_t samples);
 
+/** @brief Configures the ADC to average a burst of samples in hardware, delivering a stable
+  *        12-bit reading (0-4095) from a single conversion request.
+  * @param samples A power of 2 <= 1024, as with watch_set_analog_num_samples.
+  * @details This is the ADC's averaging mode: it takes the requested number of samples
+  *          back-to-back and divides the accumulated sum down to a 12-bit result, all in
+  *          hardware. The difference from watch_set_analog_num_samples is what you get back:
+  *          that function accumulates samples into a larger value (16 bits at the default of
+  *          16 samples), while this one always returns the 12-bit average regardless of burst
+  *          size. If you have been smoothing a noisy thermistor or battery reading by calling
+  *          watch_get_analog_pin_level repeatedly and averaging in software, call this once
+  *          instead: a 16-sample average then costs one trip through the driver — or one CPU
+  *          wakeup, with watch_get_analog_pin_level_async — instead of 16.
+  * @see watch_set_analog_num_samples
+  **/
+void watch_set_analog_oversampling(uint16_t samples);
+
 /** @brief Sets the length of time spent sampling, which allows measurement of higher impedance inputs.
   *        Default is 1.
   * @param cycles The number of ADC cycles to sample, between 1 and 64.
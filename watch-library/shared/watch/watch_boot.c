@@ -0,0 +1,69 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "watch_boot.h"
+#include "watch_profile.h"
+
+#define WATCH_BOOT_MAX_STAGES 8
+
+typedef struct {
+    const char *stage;
+    uint32_t count;
+} watch_boot_stage_t;
+
+static watch_boot_stage_t _stages[WATCH_BOOT_MAX_STAGES];
+static uint8_t _num_stages;
+static bool _finished;
+
+void watch_boot_mark(const char *stage) {
+    // read the counter first: the bookkeeping below shouldn't count against any stage.
+    uint32_t count = watch_profile_counter_stop();
+    if (_finished || _num_stages == WATCH_BOOT_MAX_STAGES) return;
+    _stages[_num_stages].stage = stage;
+    _stages[_num_stages].count = count;
+    _num_stages++;
+    watch_profile_counter_start();
+}
+
+void watch_boot_finish(void) {
+    watch_profile_counter_stop();
+    _finished = true;
+}
+
+void watch_boot_print_report(void) {
+    uint32_t total = 0;
+#ifdef __EMSCRIPTEN__
+    printf("BOOT stage ns\n");
+#else
+    printf("BOOT stage cycles\n");
+#endif
+    for (uint8_t i = 0; i < _num_stages; i++) {
+        printf("%-12s %lu\n", _stages[i].stage, (unsigned long)_stages[i].count);
+        total += _stages[i].count;
+    }
+    printf("%-12s %lu\n", "total", (unsigned long)total);
+}
@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_BOOT_H_INCLUDED
+#define _WATCH_BOOT_H_INCLUDED
+////< @file watch_boot.h
+
+#include <stdint.h>
+
+/** @addtogroup boot Boot timing
+  * @brief A coarse breakdown of cold boot, from the reset vector to the first app loop pass.
+  * @details The reset handler starts the cycle counter from watch_profile.h before anything
+  *          else runs; main() then drops a marker after each boot stage (MCU init, app_init,
+  *          watch init, app_setup, first loop). Each marker records the cycles spent in the
+  *          stage it closes and restarts the counter, so the log is a per-stage breakdown
+  *          rather than cumulative timestamps. The log lives in RAM and is printed by the
+  *          `bootlog` shell command after boot; in the simulator the same stages are
+  *          recorded in nanoseconds of wall time.
+  * @note Two caveats inherited from the counter: a stage longer than 2^24 cycles wraps, and
+  *       the HAL delay driver borrows SysTick, so a stage that calls delay_ms reports
+  *       garbage for the cycles it slept. Neither bites on the stock boot path, which
+  *       neither sleeps nor comes anywhere near the wrap.
+  */
+/// @{
+
+/** @brief Closes the current boot stage: records the cycles elapsed since the previous mark
+  *        (or since reset) under the given label and restarts the counter. The label should
+  *        be a string literal. Calls after watch_boot_finish are ignored, as is anything
+  *        past the eighth stage.
+  */
+void watch_boot_mark(const char *stage);
+
+/** @brief Freezes the boot log. Called after the first app loop pass; from then on the
+  *        counter is free for watch_profile measurements without polluting the log.
+  */
+void watch_boot_finish(void);
+
+/** @brief Prints the recorded stages — label and count, one per line, plus a total — for
+  *        the `bootlog` shell command.
+  */
+void watch_boot_print_report(void);
+
+/// @}
+#endif
@@ -57,6 +57,24 @@ void watch_set_buzzer_on(void);
   */
 void watch_set_buzzer_off(void);
 
+/// @brief Drive strengths for the buzzer, as duty cycles of the PWM waveform.
+/// @details The piezo's loudness tracks the width of each drive pulse: narrowing it moves
+///          less charge through the element per cycle, so the quiet classes spend several
+///          times less energy per beep than full drive. Pitch is unaffected.
+typedef enum watch_buzzer_volume_t {
+    WATCH_BUZZER_VOLUME_FULL = 0, ///< 50% duty: the drive every beep has historically used.
+    WATCH_BUZZER_VOLUME_SOFT,     ///< 12.5% duty: clearly audible, about a quarter the energy.
+    WATCH_BUZZER_VOLUME_QUIET,    ///< ~3% duty: a polite tick, about a sixteenth the energy.
+} watch_buzzer_volume_t;
+
+/** @brief Sets the drive strength for subsequent buzzer output.
+  * @param volume The volume class to apply.
+  * @details Sticky until changed again: it applies to every note and period written after
+  *          the call, including those played by the sequencer. A note already sounding
+  *          keeps its current duty until the next pitch change.
+  */
+void watch_set_buzzer_volume(watch_buzzer_volume_t volume);
+
 /// @brief 87 notes for use with watch_buzzer_play_note
 typedef enum BuzzerNote {
     BUZZER_NOTE_A1,              ///< 55.00 Hz
@@ -160,6 +178,17 @@ void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms);
 /// @brief An array of periods for all the notes on a piano, corresponding to the names in BuzzerNote.
 extern const uint16_t NotePeriods[108];
 
+/// @brief The 50% duty cycle compare values matching NotePeriods, resolved at compile time.
+extern const uint16_t NoteDuties[108];
+
+/** @brief Sets the buzzer to the period and duty cycle for the given note.
+  * @param note The note whose pitch you wish to set. BUZZER_NOTE_REST is not meaningful here;
+  *             turn the buzzer off instead.
+  * @details Both values come straight from compile-time tables, making this just two register
+  *          writes — cheap enough for the sequencer's interrupt handler.
+  */
+void watch_set_buzzer_note(BuzzerNote note);
+
 /** @brief Plays the given sequence of notes in a non-blocking way.
   * @param note_sequence A pointer to the sequence of buzzer note & duration tuples, ending with a zero. A simple
   *        RLE logic is implemented: a negative number instead of a buzzer note means that the sequence
@@ -175,6 +204,25 @@ extern const uint16_t NotePeriods[108];
   */
 void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void));
 
+/** @brief Supplies the streamed sequencer with its next note. Called from the sequencer's
+  *        64 Hz interrupt when the current note's time is up: fill in the next note
+  *        (BUZZER_NOTE_REST for silence) and its duration in 64 Hz ticks and return true,
+  *        or return false to end the sequence. Runs in interrupt context, so it must be
+  *        constant-time — hand out notes from a buffer that a mainline task keeps topped
+  *        up (see the melody library), never straight from storage.
+  */
+typedef bool (*watch_buzzer_next_note_t)(BuzzerNote *note, uint8_t *duration);
+
+/** @brief Plays a sequence supplied one note at a time, for melodies that don't live in RAM.
+  * @param next_note The callback that produces each note as the sequencer needs it.
+  * @param callback_on_end A callback invoked when next_note ends the sequence. As with
+  *        watch_buzzer_play_sequence, it runs in interrupt context.
+  * @note Like watch_buzzer_play_sequence this is asynchronous and enables the buzzer
+  *       itself; watch_buzzer_abort_sequence stops a stream the same way it stops a
+  *       compiled-in sequence.
+  */
+void watch_buzzer_play_stream(watch_buzzer_next_note_t next_note, void (*callback_on_end)(void));
+
 /** @brief Aborts a playing sequence.
   */
 void watch_buzzer_abort_sequence(void);
@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_crc32.h"
+
+// Nibble-at-a-time table for the reflected CRC-32 polynomial (0xEDB88320). This is the
+// same algorithm and table littlefs uses, so the state words are interchangeable — and
+// critically, it's also the form the DSU's engine works in, which is what lets us seed
+// the hardware with a software-computed state and vice versa.
+static const uint32_t _crc32_table[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+    0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+    0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+};
+
+static uint32_t _watch_crc32_software(uint32_t crc, const uint8_t *data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        crc = (crc >> 4) ^ _crc32_table[(crc ^ data[i]) & 0xf];
+        crc = (crc >> 4) ^ _crc32_table[(crc ^ (data[i] >> 4)) & 0xf];
+    }
+    return crc;
+}
+
+#if !__EMSCRIPTEN__
+
+// Below this size the PAC dance and flag polling cost more than the table loop saves.
+#define WATCH_CRC32_DSU_THRESHOLD 16
+
+// Runs the DSU's CRC engine over a word-aligned region whose size is a multiple of four.
+// Returns false (leaving *crc untouched) if the engine flagged a bus error, in which
+// case the caller should redo the region in software.
+static bool _watch_crc32_dsu(uint32_t *crc, const uint8_t *data, size_t size) {
+    // the DSU is PAC write-protected at reset; open it up for the duration of the run.
+    PAC->WRCTRL.reg = PAC_WRCTRL_PERID(ID_DSU) | PAC_WRCTRL_KEY_CLR;
+    DSU->STATUSA.reg = DSU_STATUSA_DONE | DSU_STATUSA_BERR;
+    // DATA holds the raw reflected CRC state, same format littlefs chains, so an
+    // in-progress software checksum can continue in hardware without translation.
+    DSU->DATA.reg = *crc;
+    DSU->ADDR.reg = (uint32_t)data;   // word-aligned, so the AMOD bits stay zero
+    DSU->LENGTH.reg = (uint32_t)size; // the length field occupies bits 31:2, i.e. words
+    DSU->CTRL.reg = DSU_CTRL_CRC;
+    while (!(DSU->STATUSA.reg & DSU_STATUSA_DONE));
+    bool success = !(DSU->STATUSA.reg & DSU_STATUSA_BERR);
+    if (success) *crc = DSU->DATA.reg;
+    DSU->STATUSA.reg = DSU_STATUSA_DONE | DSU_STATUSA_BERR;
+    PAC->WRCTRL.reg = PAC_WRCTRL_PERID(ID_DSU) | PAC_WRCTRL_KEY_SET;
+    return success;
+}
+
+#endif // !__EMSCRIPTEN__
+
+uint32_t watch_crc32(uint32_t crc, const void *buffer, size_t size) {
+    const uint8_t *data = buffer;
+#if !__EMSCRIPTEN__
+    if (size >= WATCH_CRC32_DSU_THRESHOLD) {
+        // the engine reads whole words; take the unaligned head in software, hand the
+        // aligned middle to the DSU, and let the tail fall through to the loop below.
+        size_t head = (4 - ((uint32_t)data & 3)) & 3;
+        size_t aligned = (size - head) & ~(size_t)3;
+        crc = _watch_crc32_software(crc, data, head);
+        data += head;
+        size -= head;
+        if (_watch_crc32_dsu(&crc, data, aligned)) {
+            data += aligned;
+            size -= aligned;
+        }
+        // on a bus error the state hasn't advanced past the head, so the software
+        // loop below simply covers everything that's left.
+    }
+#endif
+    return _watch_crc32_software(crc, data, size);
+}
@@ -0,0 +1,58 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _WATCH_DMA_H_INCLUDED
+#define _WATCH_DMA_H_INCLUDED
+////< @file watch_dma.h
+
+#include "watch.h"
+
+/** @addtogroup dma DMA Copy Service
+  * @brief This section covers the DMAC's memory-to-memory channel, which moves buffers
+  *        around while the CPU sleeps or does something else. On the Cortex M0+ every
+  *        byte a memcpy moves is a real load and a real store; staging copies in the
+  *        log flush and flash write paths are a few hundred bytes each, and offloading
+  *        them shortens those burst windows.
+  */
+/// @{
+/** @brief Copies length bytes from src to dst using the DMAC instead of the CPU.
+  * @details The copy proceeds on its own once started. If callback is NULL the call
+  *          returns immediately and the caller must call watch_dma_memcpy_wait before
+  *          reading dst or reusing src; with a callback, that callback fires from the
+  *          DMAC interrupt when the copy completes. Only one copy can be in flight: a
+  *          second call sleeps until the first finishes before starting. In the
+  *          simulator this is a plain memcpy and the callback runs before it returns.
+  * @param dst The destination buffer.
+  * @param src The source buffer. The regions must not overlap.
+  * @param length The number of bytes to copy.
+  * @param callback An optional completion callback, called in interrupt context; may be NULL.
+  */
+void watch_dma_memcpy(void *dst, const void *src, uint16_t length, void (*callback)(void));
+
+/** @brief Sleeps until no DMA copy is in flight. Safe to call when none ever started.
+  */
+void watch_dma_memcpy_wait(void);
+
+/// @}
+#endif
@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_FAST_TIMER_H_INCLUDED
+#define _WATCH_FAST_TIMER_H_INCLUDED
+////< @file watch_fast_timer.h
+
+#include "watch.h"
+
+/** @addtogroup fast_timer Fast Timer
+  * @brief This section covers the shared high-resolution timing service, which multiplexes
+  *        several logical stopwatch channels onto one hardware timer.
+  * @details The service counts in ticks of 1/128 of a second on the TC2 peripheral, which runs
+  *          from the 32.768 kHz clock and keeps counting in STANDBY mode, so a face can time an
+  *          event spanning minutes without keeping the CPU awake or spinning up the 128 Hz RTC
+  *          tick. The hardware timer only runs while at least one channel is running. Several
+  *          faces can time independent events concurrently; each claims its own channel.
+  */
+/// @{
+
+/// @brief The number of logical timer channels available to claim.
+#define WATCH_FAST_TIMER_NUM_CHANNELS 4
+
+/// @brief The resolution of the fast timer, in ticks per second.
+#define WATCH_FAST_TIMER_HZ 128
+
+/** @brief Claims a logical timer channel, stopped and reset to zero.
+  * @return A channel handle to pass to the other fast timer functions, or -1 if all
+  *         channels are in use.
+  */
+int8_t watch_fast_timer_claim(void);
+
+/** @brief Releases a timer channel, stopping it if necessary, so others can claim it.
+  * @param channel The channel to release. Does nothing if the handle is invalid.
+  */
+void watch_fast_timer_release(int8_t channel);
+
+/** @brief Starts or resumes counting on a channel. Starts the hardware timer if this is the
+  *        only running channel.
+  * @param channel The channel to start.
+  */
+void watch_fast_timer_start(int8_t channel);
+
+/** @brief Pauses counting on a channel, retaining the count. Stops the hardware timer if no
+  *        other channel is still running.
+  * @param channel The channel to pause.
+  */
+void watch_fast_timer_stop(int8_t channel);
+
+/** @brief Resets a channel's count to zero. The channel keeps running if it was running.
+  * @param channel The channel to reset.
+  */
+void watch_fast_timer_reset(int8_t channel);
+
+/** @brief Returns a channel's current count in 1/128 second ticks.
+  * @param channel The channel to read.
+  * @details Reading a running channel captures its count without disturbing it, which is how
+  *          you take a lap time: read the channel and let it keep counting.
+  */
+uint32_t watch_fast_timer_get_ticks(int8_t channel);
+
+/** @brief Returns true if the given channel is currently counting.
+  * @param channel The channel to query.
+  */
+bool watch_fast_timer_is_running(int8_t channel);
+
+#ifndef __EMSCRIPTEN__
+void TC2_Handler(void);
+#endif
+
+/// @}
+#endif
@@ -72,5 +72,29 @@ void watch_disable_digital_output(const uint8_t pin);
   * @param level The level you wish to set: true for high, false for low.
   */
 void watch_set_pin_level(const uint8_t pin, const bool level);
+
+/** @brief A bulk pin configuration for one PORT group, applied by watch_configure_port.
+  *        In each mask, bit N refers to pin N of the group (i.e. bit 5 of a port A mask
+  *        is PA05).
+  */
+typedef struct {
+    uint32_t input_pins;    ///< pins to configure as digital inputs
+    uint32_t output_pins;   ///< pins to configure as digital outputs
+    uint32_t pull_pins;     ///< input pins that get a pull resistor
+    uint32_t high_pins;     ///< initial output levels; on a pulled input, true selects a pull-up and false a pull-down
+} watch_gpio_config_t;
+
+/** @brief Configures every masked pin of a PORT group in one shot.
+  * @param port The PORT group: 0 for port A, 1 for port B.
+  * @param mask The pins to touch. Pins outside the mask are left exactly as they are.
+  * @param config The configuration to apply. Masked pins that appear in none of the
+  *               config's masks are fully disabled: no input buffer, output driver or pull.
+  * @details Equivalent to calling the single-pin functions above for each masked pin, but
+  *          executed as a handful of whole-port register writes (OUT, DIR, WRCONFIG)
+  *          instead of a read-modify-write sequence per pin. Pin setup reruns on every
+  *          wake from BACKUP mode, so boot-path code with several pins to bring up
+  *          should prefer this.
+  */
+void watch_configure_port(const uint8_t port, const uint32_t mask, const watch_gpio_config_t *config);
 /// @}
 #endif
@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch.h"
+#include "watch_private.h"
+
+// The bus power scheduler. Several faces and drivers use the I2C bus independently, each
+// bracketing its work with watch_enable_i2c / watch_disable_i2c; with more than one of them
+// in play the bus used to get torn down and brought back up between every pair of
+// transactions, paying the SERCOM init and bus settling cost each time. Instead, enables
+// are reference counted, and the last disable doesn't power the bus down — it arms a short
+// linger window, counted down once a second by movement, so back-to-back users reuse one
+// power-up. Entering low energy mode cuts the linger short.
+
+#ifndef WATCH_I2C_LINGER_SECONDS
+#define WATCH_I2C_LINGER_SECONDS 3
+#endif
+
+static uint8_t i2c_refcount;
+static uint8_t i2c_linger_seconds;
+static bool i2c_powered;
+
+void watch_enable_i2c(void) {
+    i2c_refcount++;
+    i2c_linger_seconds = 0;
+    if (!i2c_powered) {
+        _watch_enable_i2c_peripheral();
+        i2c_powered = true;
+    }
+}
+
+void watch_disable_i2c(void) {
+    if (i2c_refcount == 0) return;
+    if (--i2c_refcount == 0) i2c_linger_seconds = WATCH_I2C_LINGER_SECONDS;
+}
+
+void _watch_i2c_quiesce(bool force) {
+    if (!i2c_powered || i2c_refcount) return;
+    if (!force && i2c_linger_seconds && --i2c_linger_seconds) return;
+    _watch_disable_i2c_peripheral();
+    i2c_powered = false;
+    i2c_linger_seconds = 0;
+}
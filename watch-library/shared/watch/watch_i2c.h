@@ -34,13 +34,38 @@
   */
 /// @{
 /** @brief Enables the I2C peripheral. Call this before attempting to interface with I2C devices.
+  * @note Enables are reference counted, so independent users — faces, drivers, background
+  *       tasks — can each bracket their bus use without coordinating. The bus only powers
+  *       up on the first enable.
   */
 void watch_enable_i2c(void);
 
-/** @brief Disables the I2C peripheral.
+/** @brief Releases your claim on the I2C peripheral.
+  * @details When the last user releases the bus, it is not powered down immediately: it
+  *          lingers for a few seconds so that back-to-back transactions from different
+  *          users reuse one power-up window, and is shut off once the bus has been quiet
+  *          for WATCH_I2C_LINGER_SECONDS (or when the watch enters low energy mode).
   */
 void watch_disable_i2c(void);
 
+/// The bus speeds watch_i2c_set_speed can select.
+typedef enum {
+    WATCH_I2C_SPEED_STANDARD = 0,  ///< 100 kHz, the power-on default; every I2C device supports it.
+    WATCH_I2C_SPEED_FAST,          ///< 400 kHz fast mode.
+} watch_i2c_speed_t;
+
+/** @brief Selects the bus speed for subsequent transactions.
+  * @param speed The speed to run the bus at.
+  * @details Calling this with the speed already in effect costs one compare, so drivers
+  *          can harmlessly claim their speed before every transaction; the hardware is
+  *          only reconfigured on an actual change. The LIS2DW and OPT3001 drivers claim
+  *          fast mode themselves — a 4× transfer-rate improvement that shrinks every
+  *          sensor window, the accelerometer FIFO drain most of all. If you put a
+  *          standard-mode-only device on the nine-pin connector, select
+  *          WATCH_I2C_SPEED_STANDARD before talking to it.
+  */
+void watch_i2c_set_speed(watch_i2c_speed_t speed);
+
 /** @brief Sends a series of values to a device on the I2C bus.
   * @param addr The address of the device you wish to talk to.
   * @param buf A series of unsigned bytes; the data you wish to transmit.
@@ -55,6 +80,30 @@ void watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length);
   */
 void watch_i2c_receive(int16_t addr, uint8_t *buf, uint16_t length);
 
+/** @brief A callback for watch_i2c_receive_async. It is invoked from the SERCOM interrupt
+  *        handler when the transfer completes (or fails), so keep it short; set a flag and do
+  *        your work in the app loop.
+  */
+typedef void (*watch_i2c_callback_t)(void);
+
+/** @brief Receives a series of values from a device on the I2C bus without blocking.
+  * @param addr The address of the device you wish to hear from.
+  * @param buf Storage for the incoming bytes; must remain valid until the callback fires.
+  * @param length The number of bytes that you wish to receive.
+  * @param callback A function to call when the transfer finishes.
+  * @return true if the transfer was started; false if another async transfer is in flight.
+  * @note Unlike watch_i2c_receive, which holds the CPU in a busy-wait for the whole transfer,
+  *       this clocks the bytes in from the interrupt handler: the CPU takes one brief wakeup
+  *       per byte and can sleep in between. Use it for multi-byte bursts like sensor FIFO
+  *       drains. On a bus error the callback still fires, with any unreceived bytes untouched.
+  */
+bool watch_i2c_receive_async(int16_t addr, uint8_t *buf, uint16_t length, watch_i2c_callback_t callback);
+
+/** @brief Checks whether an asynchronous receive is still in flight.
+  * @return true if a transfer started with watch_i2c_receive_async has not yet completed.
+  */
+bool watch_i2c_is_async_busy(void);
+
 /** @brief Writes a byte to a register in an I2C device.
   * @param addr The address of the device you wish to address.
   * @param reg The register on the device that you wish to set.
@@ -84,5 +84,36 @@ void watch_set_led_yellow(void);
 /** @brief Turns both the red and the green LEDs off. */
 void watch_set_led_off(void);
 
+/** @brief Illuminates the LED at the given color for a set duration, then fades it out and turns
+  *        it off — all from a hardware timer, with no involvement from your app.
+  * @param red The red value from 0-255.
+  * @param green The green value from 0-255. If your watch has a red/blue LED, this will be the blue value.
+  * @param duration_ms How long to hold the color before the fade-out begins, in milliseconds.
+  * @details Unlike watch_set_led_color, you do not need to keep your app awake while the LED is on:
+  *          the TCC is asked to keep running in STANDBY, and the TC1 timer interrupt steps the LED
+  *          through a quarter-second fade-out and turns it off while your app sleeps. If the LIGHT
+  *          button is still held down when the duration expires, the hold is extended by a second
+  *          at a time until it is released.
+  */
+void watch_led_illuminate_with_auto_off(uint8_t red, uint8_t green, uint16_t duration_ms);
+
+/** @brief Blinks the LED in a repeating on/off pattern driven by a hardware timer, with
+  *        no involvement from your app between toggles.
+  * @param red The red value from 0-255.
+  * @param green The green value from 0-255. If your watch has a red/blue LED, this will be the blue value.
+  * @param on_ms How long the LED stays lit in each cycle, in milliseconds.
+  * @param off_ms How long the LED stays dark in each cycle, in milliseconds.
+  * @details The pattern repeats until watch_led_blink_stop is called. The TCC is asked to keep
+  *          running in STANDBY and the TC1 timer toggles the LED from its interrupt, so your app
+  *          can sleep for the whole session — useful for locator-beacon faces that blink for
+  *          hours. The timer's resolution is 32 Hz, so durations are rounded to the nearest
+  *          31 ms (minimum one tick). TC1 is shared with the auto-off light: starting one
+  *          cancels the other.
+  */
+void watch_led_blink_pattern(uint8_t red, uint8_t green, uint16_t on_ms, uint16_t off_ms);
+
+/** @brief Stops a pattern started with watch_led_blink_pattern and turns the LED off. */
+void watch_led_blink_stop(void);
+
 /// @}
 #endif
@@ -29,6 +29,11 @@
 /// Called by main.c while setting up the app. You should not call this from your app.
 void _watch_init(void);
 
+/// The word _watch_init paints over the unused stack, so movement_get_memory_stats can
+/// find the deepest frame ever pushed by scanning for the first disturbed word. Hardware
+/// only; the simulator's stack belongs to the browser.
+#define WATCH_STACK_FILL_WORD 0x5AFE57AC
+
 /// Initializes the real-time clock peripheral.
 void _watch_rtc_init(void);
 
@@ -38,9 +43,36 @@ void _watch_enable_tcc(void);
 /// Called by buzzer and LED teardown functions. You should not call this from your app.
 void _watch_disable_tcc(void);
 
+/// Called by the buzzer sequencer and the LED auto-off engine to request that TCC0 keep
+/// running in STANDBY mode. Requests are counted, so one engine releasing its request
+/// does not stop the TCC out from under the other. You should not call this from your app.
+void _watch_request_tcc_runstdby(bool value);
+
 /// Called by main.c if plugged in to USB. You should not call this from your app.
 void _watch_enable_usb(void);
 
+/// Platform half of watch_enable_i2c: unconditionally powers up and initializes the SERCOM.
+/// Called by the bus power scheduler in shared watch_i2c.c. You should not call this from
+/// your app; call watch_enable_i2c, which reference-counts.
+void _watch_enable_i2c_peripheral(void);
+
+/// Platform half of watch_disable_i2c: unconditionally powers the SERCOM down.
+void _watch_disable_i2c_peripheral(void);
+
+/// Called by movement once a second (and with force = true when entering low energy mode):
+/// powers the I2C bus down once its linger window after the last watch_disable_i2c expires.
+/// You should not call this from your app.
+void _watch_i2c_quiesce(bool force);
+
+/// Brings up the DMA controller (clock, descriptor tables, interrupt) if it isn't up yet.
+/// Called by everything that claims a DMAC channel — the channel map lives in watch_dma.c.
+/// Hardware only; you should not call this from your app.
+void _watch_dma_init(void);
+
+/// Registers the function the shared DMAC interrupt calls when the given channel completes
+/// (or errors out). Hardware only; you should not call this from your app.
+void _watch_dma_register_channel_callback(uint8_t channel, void (*callback)(void));
+
 // this function ends up getting called by printf to log stuff to the USB console.
 int _write(int file, char *ptr, int len);
 
@@ -25,4 +25,22 @@
 
 // note: the buzzer uses a 1 MHz clock. these values were determined by dividing 1,000,000 by the target frequency.
 // i.e. for a 440 Hz tone (A4 on the piano), 1MHz/440Hz = 2273
-const uint16_t NotePeriods[108] = {18182,17161,16197,15288,14430,13620,12857,12134,11453,10811,10204,9631,9091,8581,8099,7645,7216,6811,6428,6068,5727,5405,5102,4816,4545,4290,4050,3822,3608,3405,3214,3034,2863,2703,2551,2408,2273,2145,2025,1911,1804,1703,1607,1517,1432,1351,1276,1204,1136,1073,1012,956,902,851,804,758,716,676,638,602,568,536,506,478,451,426,402,379,358,338,319,301,284,268,253,239,225,213,201,190,179,169,159,150,142,134,127};
+// the list is expanded twice below, so that both the period register value and the 50% duty cycle
+// compare value for every note are resolved at compile time; setting a note is then just two
+// register writes from the tables, with no arithmetic in the sequencer interrupt.
+#define WATCH_BUZZER_NOTE_PERIODS(X) \
+    X(18182) X(17161) X(16197) X(15288) X(14430) X(13620) X(12857) X(12134) X(11453) X(10811) \
+    X(10204) X(9631) X(9091) X(8581) X(8099) X(7645) X(7216) X(6811) X(6428) X(6068) \
+    X(5727) X(5405) X(5102) X(4816) X(4545) X(4290) X(4050) X(3822) X(3608) X(3405) \
+    X(3214) X(3034) X(2863) X(2703) X(2551) X(2408) X(2273) X(2145) X(2025) X(1911) \
+    X(1804) X(1703) X(1607) X(1517) X(1432) X(1351) X(1276) X(1204) X(1136) X(1073) \
+    X(1012) X(956) X(902) X(851) X(804) X(758) X(716) X(676) X(638) X(602) \
+    X(568) X(536) X(506) X(478) X(451) X(426) X(402) X(379) X(358) X(338) \
+    X(319) X(301) X(284) X(268) X(253) X(239) X(225) X(213) X(201) X(190) \
+    X(179) X(169) X(159) X(150) X(142) X(134) X(127)
+
+#define WATCH_BUZZER_EXPAND_PERIOD(period) (period),
+#define WATCH_BUZZER_EXPAND_DUTY(period) ((period) / 2),
+
+const uint16_t NotePeriods[108] = { WATCH_BUZZER_NOTE_PERIODS(WATCH_BUZZER_EXPAND_PERIOD) };
+const uint16_t NoteDuties[108] = { WATCH_BUZZER_NOTE_PERIODS(WATCH_BUZZER_EXPAND_DUTY) };
@@ -24,6 +24,7 @@
 
 #include "watch_slcd.h"
 #include "watch_private_display.h"
+#include "watch_character_remap.h"
 
 static const uint32_t IndicatorSegments[] = {
     SLCD_SEGID(0, 17), // WATCH_INDICATOR_SIGNAL
@@ -33,41 +34,23 @@ static const uint32_t IndicatorSegments[] = {
     SLCD_SEGID(1, 10), // WATCH_INDICATOR_LAP
 };
 
-void watch_display_character(uint8_t character, uint8_t position) {
-    // special cases for positions 4 and 6
-    if (position == 4 || position == 6) {
-        if (character == '7') character = '&'; // "lowercase" 7
-        else if (character == 'A') character = 'a'; // A needs to be lowercase
-        else if (character == 'o') character = 'O'; // O needs to be uppercase
-        else if (character == 'L') character = '!'; // L needs to be in top half
-        else if (character == 'M' || character == 'm' || character == 'N') character = 'n'; // M and uppercase N need to be lowercase n
-        else if (character == 'c') character = 'C'; // C needs to be uppercase
-        else if (character == 'J') character = 'j'; // same
-        else if (character == 'v' || character == 'V' || character == 'U' || character == 'W' || character == 'w') character = 'u'; // bottom segment duplicated, so show in top half
-    } else {
-        if (character == 'u') character = 'v'; // we can use the bottom segment; move to lower half
-        else if (character == 'j') character = 'J'; // same but just display a normal J
-    }
-    if (position > 1) {
-        if (character == 'T') character = 't'; // uppercase T only works in positions 0 and 1
-    }
-    if (position == 1) {
-        if (character == 'a') character = 'A'; // A needs to be uppercase
-        else if (character == 'o') character = 'O'; // O needs to be uppercase
-        else if (character == 'i') character = 'l'; // I needs to be uppercase (use an l, it looks the same)
-        else if (character == 'n') character = 'N'; // N needs to be uppercase
-        else if (character == 'r') character = 'R'; // R needs to be uppercase
-        else if (character == 'd') character = 'D'; // D needs to be uppercase
-        else if (character == 'v' || character == 'V' || character == 'u') character = 'U'; // side segments shared, make uppercase
-        else if (character == 'b') character = 'B'; // B needs to be uppercase
-        else if (character == 'c') character = 'C'; // C needs to be uppercase
-    } else {
-        if (character == 'R') character = 'r'; // R needs to be lowercase almost everywhere
-    }
+// the tens-of-seconds digit watch_display_seconds last rendered, so nine ticks out of ten
+// only the ones digit touches the SLCD. 0xFF means unknown: render both digits.
+static uint8_t Last_Seconds_Tens = 0xFF;
+
+WATCH_RAMFUNC void watch_display_character(uint8_t character, uint8_t position) {
+    // a generic write to position 8 means we no longer know what's in the tens-of-seconds
+    // digit; drop the memo so the next watch_display_seconds call renders it fresh.
+    if (position == 8) Last_Seconds_Tens = 0xFF;
+    // the per-position character rules (some characters render differently, or not at all, at
+    // certain positions) are flattened into Character_Remap at build time by
+    // utils/gen_character_remap.py, so remapping is a single table load instead of a branch chain.
+    if (character < 0x20 || character >= 0x80) character = 0x20;
+    uint8_t index = character - 0x20;
+    character = 0x20 + Character_Remap[position][index];
+
     if (position == 0) {
         watch_clear_pixel(0, 15); // clear funky ninth segment
-    } else {
-        if (character == 'I') character = 'l'; // uppercase I only works in position 0
     }
 
     uint64_t segmap = Segment_Map[position];
@@ -92,9 +75,50 @@ void watch_display_character(uint8_t character, uint8_t position) {
         segdata = segdata >> 1;
     }
 
-    if (character == 'T' && position == 1) watch_set_pixel(1, 12); // add descender
-    else if (position == 0 && (character == 'B' || character == 'D')) watch_set_pixel(0, 15); // add funky ninth segment
-    else if (position == 1 && (character == 'B' || character == 'D' || character == '@')) watch_set_pixel(0, 12); // add funky ninth segment
+    // descenders and funky ninth segments are folded into the generated table, as packed
+    // (com << 6 | seg) pixels keyed on the pre-remap character; zero means none. Only
+    // positions 0 and 1 have any, so the table stops there.
+    if (position < 2) {
+        uint8_t extra = Character_Ninth_Segment[position][index];
+        if (extra) watch_set_pixel(extra >> 6, extra & 0x3F);
+    }
+}
+
+uint16_t watch_character_segdata(uint8_t character, uint8_t position) {
+    if (character < 0x20 || character >= 0x80) character = 0x20;
+    uint8_t index = character - 0x20;
+    uint16_t result = (uint16_t)(Character_Set[Character_Remap[position][index]] & 0xFF);
+    if (position < 2) result |= (uint16_t)Character_Ninth_Segment[position][index] << 8;
+    return result;
+}
+
+WATCH_RAMFUNC void watch_display_segdata(uint16_t segdata, uint8_t position) {
+    if (position == 8) Last_Seconds_Tens = 0xFF;
+    if (position == 0) watch_clear_pixel(0, 15); // clear funky ninth segment
+
+    uint8_t pattern = segdata & 0xFF;
+    uint64_t segmap = Segment_Map[position];
+    for (int i = 0; i < 8; i++) {
+        uint8_t com = (segmap & 0xFF) >> 6;
+        if (com > 2) {
+            // COM3 means no segment exists; skip it.
+            segmap = segmap >> 8;
+            pattern = pattern >> 1;
+            continue;
+        }
+        uint8_t seg = segmap & 0x3F;
+
+        if (pattern & 1)
+          watch_set_pixel(com, seg);
+        else
+          watch_clear_pixel(com, seg);
+
+        segmap = segmap >> 8;
+        pattern = pattern >> 1;
+    }
+
+    uint8_t extra = segdata >> 8;
+    if (extra) watch_set_pixel(extra >> 6, extra & 0x3F);
 }
 
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position) {
@@ -137,6 +161,24 @@ void watch_display_string(char *string, uint8_t position) {
     // printf("________\n  %c%c  %c%c\n%c%c %c%c %c%c\n--------\n", (position > 0) ? ' ' : string[0], (position > 1) ? ' ' : string[1 - position], (position > 2) ? ' ' : string[2 - position], (position > 3) ? ' ' : string[3 - position], (position > 4) ? ' ' : string[4 - position], (position > 5) ? ' ' : string[5 - position], (position > 6) ? ' ' : string[6 - position], (position > 7) ? ' ' : string[7 - position], (position > 8) ? ' ' : string[8 - position], (position > 9) ? ' ' : string[9 - position]);
 }
 
+WATCH_RAMFUNC void watch_display_2d(uint8_t value, uint8_t position) {
+    // digit split via multiply and shift (exact for values below 160): the RTC hands us
+    // binary fields, and this is the shortest road from one to two segment table walks —
+    // no software divide, no string staging in between.
+    uint8_t tens = ((uint16_t)value * 205) >> 11;
+    watch_display_character('0' + tens, position);
+    watch_display_character('0' + (value - tens * 10), position + 1);
+}
+
+WATCH_RAMFUNC void watch_display_seconds(uint8_t second) {
+    uint8_t tens = ((uint16_t)second * 205) >> 11;
+    if (tens != Last_Seconds_Tens) {
+        watch_display_character_lp_seconds('0' + tens, 8);
+        Last_Seconds_Tens = tens;
+    }
+    watch_display_character_lp_seconds('0' + (second - tens * 10), 9);
+}
+
 void watch_set_colon(void) {
     watch_set_pixel(1, 16);
 }
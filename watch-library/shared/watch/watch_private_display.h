@@ -27,7 +27,7 @@
 #include "hpl_slcd_config.h"
 #include "driver_init.h"
 
-static const uint8_t Character_Set[] =
+WATCH_RAMFUNC static const uint8_t Character_Set[] =
 {
     0b00000000, //  
     0b01100000, // ! (L in the top half for positions 4 and 6)
@@ -126,7 +126,7 @@ static const uint8_t Character_Set[] =
     0b00000001, // ~
 };
 
-static const uint64_t Segment_Map[] = {
+WATCH_RAMFUNC static const uint64_t Segment_Map[] = {
     0x4e4f0e8e8f8d4d0d, // Position 0, mode
     0xc8c4c4c8b4b4b0b,  // Position 1, mode (Segments B and C shared, as are segments E and F)
     0xc049c00a49890949, // Position 2, day of month (Segments A, D, G shared; missing segment F)
@@ -143,6 +143,21 @@ static const uint8_t Num_Chars = 10;
 
 void watch_display_character(uint8_t character, uint8_t position);
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position);
+// renders a binary 0-99 field as two digits at position and position + 1, straight from the
+// packed RTC value to segment writes with no intermediate string.
+void watch_display_2d(uint8_t value, uint8_t position);
+// the minimal per-second clock render: writes the seconds digits at positions 8-9 via the
+// low-power path, skipping the tens digit when it hasn't rolled over.
+void watch_display_seconds(uint8_t second);
+
+// resolves a character to its segment pattern at a position: the low byte is the 8-bit
+// pattern after the per-position remap, the high byte the packed ninth-segment pixel for
+// positions 0 and 1 (zero if none). Callers that render the same text repeatedly (the
+// marquee library) resolve once and replay patterns through watch_display_segdata.
+uint16_t watch_character_segdata(uint8_t character, uint8_t position);
+// writes a pattern resolved by watch_character_segdata to the display; equivalent to
+// watch_display_character minus every table lookup.
+void watch_display_segdata(uint16_t segdata, uint8_t position);
 
 
 #endif
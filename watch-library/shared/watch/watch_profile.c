@@ -0,0 +1,105 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+
+#include "watch.h"
+#include "watch_profile.h"
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#endif
+
+#define WATCH_PROFILE_MAX_SECTIONS 16
+
+typedef struct {
+    const char *label;
+    uint32_t count;
+} watch_profile_section_t;
+
+static watch_profile_section_t _sections[WATCH_PROFILE_MAX_SECTIONS];
+static uint8_t _num_sections;
+static const char *_current_label;
+
+#ifndef __EMSCRIPTEN__
+
+// the SysTick down-counter, clocked from the CPU: the M0+ has no DWT cycle counter, but
+// at watch clock speeds SysTick's 24-bit range covers any section a face could plausibly
+// run inside one loop call. Starting simply takes the counter over from whoever had it.
+void watch_profile_counter_start(void) {
+    SysTick->LOAD = 0x00FFFFFF;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+uint32_t watch_profile_counter_stop(void) {
+    uint32_t elapsed = 0x00FFFFFF - SysTick->VAL;
+    SysTick->CTRL = 0;
+    return elapsed;
+}
+
+#else
+
+// no cycle counter in the simulator; report wall time in nanoseconds so the same code
+// still yields relative numbers (subject to all the noise of a browser tab).
+static double _counter_start_time;
+
+void watch_profile_counter_start(void) {
+    _counter_start_time = emscripten_get_now();
+}
+
+uint32_t watch_profile_counter_stop(void) {
+    return (uint32_t)((emscripten_get_now() - _counter_start_time) * 1000000.0);
+}
+
+#endif
+
+void watch_profile_begin(const char *label) {
+    _current_label = label;
+    watch_profile_counter_start();
+}
+
+void watch_profile_end(void) {
+    uint32_t count = watch_profile_counter_stop();
+    if (_num_sections == WATCH_PROFILE_MAX_SECTIONS) {
+        for (uint8_t i = 1; i < WATCH_PROFILE_MAX_SECTIONS; i++) _sections[i - 1] = _sections[i];
+        _num_sections--;
+    }
+    _sections[_num_sections].label = _current_label ? _current_label : "(unlabeled)";
+    _sections[_num_sections].count = count;
+    _num_sections++;
+    _current_label = NULL;
+}
+
+void watch_profile_dump(void) {
+#ifdef __EMSCRIPTEN__
+    printf("PROFILE section ns\n");
+#else
+    printf("PROFILE section cycles\n");
+#endif
+    for (uint8_t i = 0; i < _num_sections; i++) {
+        printf("%-24s %lu\n", _sections[i].label, (unsigned long)_sections[i].count);
+    }
+    _num_sections = 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_PROFILE_H_INCLUDED
+#define _WATCH_PROFILE_H_INCLUDED
+////< @file watch_profile.h
+
+#include <stdint.h>
+
+/** @addtogroup profile Microbenchmarks
+  * @brief On-target cycle measurement for before/after numbers on optimization work.
+  * @details The SAM L22's Cortex M0+ has no DWT cycle counter, so measurements use the
+  *          SysTick down-counter running from the CPU clock: results are in CPU cycles,
+  *          good for any single section up to 16.7 million cycles (a couple of seconds
+  *          at watch clock speeds). In the simulator the same API reports nanoseconds
+  *          of wall time instead — useful for relative comparisons only.
+  * @note Measurements do not nest: there is one SysTick, and it is the same counter
+  *       the MOVEMENT_PROFILE build uses to time face dispatches, so a section measured
+  *       inside a face's loop will steal the counter from the dispatch timer for that
+  *       pass. That costs one corrupted sample in the face profile, which is fine for
+  *       bench work; just don't leave measurement calls in shipping code.
+  */
+/// @{
+
+/** @brief Starts the raw counter. The single-level primitive the rest of this API
+  *        (and movement's face dispatch timer) is built on.
+  */
+void watch_profile_counter_start(void);
+
+/** @brief Stops the raw counter and returns the elapsed count (CPU cycles on hardware,
+  *        nanoseconds in the simulator).
+  */
+uint32_t watch_profile_counter_stop(void);
+
+/** @brief Starts a labeled measurement. The label should be a string literal; only the
+  *        pointer is stored.
+  */
+void watch_profile_begin(const char *label);
+
+/** @brief Ends the measurement started by watch_profile_begin and records it in the
+  *        results buffer, which holds the last 16 sections (oldest dropped first).
+  */
+void watch_profile_end(void);
+
+/** @brief Prints the recorded sections — label and count, one per line — and clears
+  *        the buffer. Output goes to the CDC console (or the browser console in the
+  *        simulator), so results can be read over USB without touching the display.
+  */
+void watch_profile_dump(void);
+
+/** @brief Measures a single statement: WATCH_PROFILE("label", do_the_thing()); */
+#define WATCH_PROFILE(label, statement) do { \
+    watch_profile_begin(label); \
+    statement; \
+    watch_profile_end(); \
+} while (0)
+
+/// @}
+#endif
@@ -0,0 +1,76 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stddef.h>
+#include "watch_rand.h"
+
+// implemented against the TRNG in watch_private.c (and against the host's entropy
+// source in the simulator); each call spins the peripheral up and back down.
+int getentropy(void *buf, size_t buflen);
+
+// One getentropy call fills the pool; each reseed consumes four words, so a single
+// TRNG spin-up covers two reseeds and (with the interval below) a thousand draws.
+#define WATCH_RAND_POOL_WORDS 8
+#define WATCH_RAND_RESEED_INTERVAL 512
+
+static uint32_t _entropy_pool[WATCH_RAND_POOL_WORDS];
+static uint8_t _entropy_pool_available; // words remaining in the pool
+static uint64_t _pcg_state;
+static uint64_t _pcg_inc;
+static uint16_t _draws_until_reseed;    // 0 at boot forces a seed on first use
+
+static void _watch_rand_reseed(void) {
+    if (_entropy_pool_available < 4) {
+        getentropy(_entropy_pool, sizeof(_entropy_pool));
+        _entropy_pool_available = WATCH_RAND_POOL_WORDS;
+    }
+    uint32_t *words = &_entropy_pool[_entropy_pool_available - 4];
+    // xor the fresh entropy in rather than assigning it, so the old trajectory
+    // still contributes; the increment must be odd for PCG to reach full period.
+    _pcg_state ^= ((uint64_t)words[0] << 32) | words[1];
+    _pcg_inc = (((uint64_t)words[2] << 32) | words[3]) | 1;
+    _entropy_pool_available -= 4;
+    _draws_until_reseed = WATCH_RAND_RESEED_INTERVAL;
+}
+
+uint32_t watch_rand(void) {
+    if (_draws_until_reseed == 0) _watch_rand_reseed();
+    _draws_until_reseed--;
+    // PCG32 (XSH RR): one 64-bit multiply-add plus shifts, no peripheral access.
+    uint64_t oldstate = _pcg_state;
+    _pcg_state = oldstate * 6364136223846793005ULL + _pcg_inc;
+    uint32_t xorshifted = ((oldstate >> 18) ^ oldstate) >> 27;
+    uint32_t rot = oldstate >> 59;
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+uint32_t watch_rand_uniform(uint32_t bound) {
+    // reject draws from the incomplete final copy of [0, bound) in the 32-bit range;
+    // for small bounds like dice the threshold is tiny and rejections are rare.
+    uint32_t threshold = -bound % bound;
+    for (;;) {
+        uint32_t r = watch_rand();
+        if (r >= threshold) return r % bound;
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_RAND_H_INCLUDED
+#define _WATCH_RAND_H_INCLUDED
+////< @file watch_rand.h
+
+#include "watch.h"
+
+/** @addtogroup rand Random Numbers
+  * @brief This section covers fast random numbers drawn from a cached entropy pool.
+  *
+  * The SAM L22's true random number generator costs a peripheral clock enable and a
+  * wait for data on every use, which is overkill when a watch face just wants to roll
+  * a die. These functions run a small PCG32 generator in RAM and reseed it from the
+  * TRNG only when a batched pool of harvested entropy runs dry, so the peripheral
+  * spin-up cost is amortized across hundreds of draws. For anything with security
+  * implications, call getentropy or arc4random directly instead.
+  **/
+/// @{
+
+/** @brief Returns 32 uniformly distributed random bits.
+  * @details The first call after boot harvests a batch of TRNG output to seed the
+  *          generator; subsequent calls are a few integer operations.
+  */
+uint32_t watch_rand(void);
+
+/** @brief Returns a uniformly distributed random number in [0, bound).
+  * @param bound The exclusive upper bound; must be nonzero.
+  * @details Uses rejection sampling, so the result carries no modulo bias.
+  */
+uint32_t watch_rand_uniform(uint32_t bound);
+
+/// @}
+#endif
@@ -137,6 +137,52 @@ void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequen
   */
 void watch_rtc_disable_periodic_callback(uint8_t frequency);
 
+/// The number of subscribers each periodic frequency can have. @see watch_rtc_subscribe_periodic_callback
+#define WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS 4
+
+/** @brief Subscribes a callback to the given periodic frequency, alongside any existing subscribers.
+  * @param callback The function to call at the given frequency. Must not be NULL.
+  * @param frequency The frequency of the tick in Hz. **Must be a power of 2**, from 1 to 128 inclusive.
+  * @return true if the subscription was added (or was already present); false if all
+  *         WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS slots for this frequency are taken.
+  * @details Unlike watch_rtc_register_periodic_callback, which replaces whatever was registered at
+  *          the given frequency, this multiplexes several subscribers onto one PERn interrupt. The
+  *          interrupt for a frequency is enabled while it has at least one subscriber and disabled
+  *          when the last one unsubscribes, so the hardware tick rate always matches actual demand:
+  *          two clients that need 8 Hz and 64 Hz each get exactly the rate they asked for, with no
+  *          need to run a faster shared tick and divide it in software.
+  */
+bool watch_rtc_subscribe_periodic_callback(ext_irq_cb_t callback, uint8_t frequency);
+
+/** @brief Removes a subscription added with watch_rtc_subscribe_periodic_callback. If this was the
+  *        last subscriber at the given frequency, the PERn interrupt is disabled.
+  * @param callback The callback that was subscribed.
+  * @param frequency The frequency it was subscribed at.
+  */
+void watch_rtc_unsubscribe_periodic_callback(ext_irq_cb_t callback, uint8_t frequency);
+
+/** @brief Registers a 1 Hz callback that fires just after the second rolls over.
+  * @param callback The function to call once per second, shortly after the seconds value changes.
+  * @param offset_sixteenths Extra delay past the rollover, in sixteenths of a second (0-15).
+  *        With 0 the callback lands about 31 ms after the boundary; each step adds 62.5 ms.
+  * @details The plain 1 Hz periodic interrupt has a fixed, unhelpful phase: the prescaler fires
+  *          it half a second after the seconds value changes, so a clock face that repaints on
+  *          that tick shows every second half a second late — and the phase can't be moved,
+  *          because the only way to reset the prescaler is to write the CLOCK register, which
+  *          disturbs timekeeping. This callback is instead synthesized from a brief burst of
+  *          16 Hz interrupts spanning each rollover, so watch_rtc_get_date_time is guaranteed
+  *          to return the fresh second when it fires. The burst costs a handful of very short
+  *          interrupt wakes per second — far less than ticking a face at 8 Hz just to keep its
+  *          seconds display crisp. Only one aligned callback exists; registering again replaces
+  *          it, and it must be disabled with watch_rtc_disable_aligned_tick_callback (the
+  *          periodic disable functions don't know about it).
+  */
+void watch_rtc_register_aligned_tick_callback(ext_irq_cb_t callback, uint8_t offset_sixteenths);
+
+/** @brief Disables the callback registered with watch_rtc_register_aligned_tick_callback.
+  */
+void watch_rtc_disable_aligned_tick_callback(void);
+
 /** @brief Disables tick callbacks for the given periods (as a bitmask).
   * @param mask The frequencies of tick callbacks you wish to disable, in Hz.
   * The 128 Hz callback is 0b1, the 64 Hz callback is 0b10, the 32 Hz callback is 0b100, etc.
@@ -157,5 +203,31 @@ void watch_rtc_enable(bool en);
   */
 void watch_rtc_freqcorr_write(int16_t value, int16_t sign);
 
+/// The two accuracy/power profiles the RTC can run on. @see watch_rtc_set_clock_source
+typedef enum watch_rtc_clock_source {
+    WATCH_RTC_CLOCK_XOSC32K = 0,  ///< the external 32.768 kHz crystal: ±20 ppm, the default.
+    WATCH_RTC_CLOCK_OSCULP32K,    ///< the internal ultra-low-power oscillator: much looser, but lets the crystal power down.
+} watch_rtc_clock_source;
+
+/** @brief Moves the RTC (and the 32 kHz peripheral clock) onto the given oscillator.
+  * @param source The profile to run on. Passing the current source is a no-op.
+  * @details The crystal is the right clock for a watch; this exists for deployments that
+  *          accept looser timekeeping in exchange for the OSCULP32K's lower draw — think
+  *          multi-month storage mode, where the minutes of drift accrued don't matter
+  *          because the time will be set on unboxing. Switching to the OSCULP first
+  *          recalibrates it against the crystal: the 5-bit trim is swept with the FREQM
+  *          peripheral to the closest frequency (about 16 seconds of measurement), and the
+  *          residual error is programmed into FREQCORR, clamped at its ±121 ppm range. The
+  *          crystal oscillator is then disabled entirely. Switching back re-enables the
+  *          crystal, waits for it to stabilize, and zeroes FREQCORR so the drift correction
+  *          engine can reprogram its own value. The calendar time carries straight across
+  *          the switch in both directions; only the tick rate changes quality.
+  */
+void watch_rtc_set_clock_source(watch_rtc_clock_source source);
+
+/** @brief Returns the oscillator the RTC is currently running on.
+  */
+watch_rtc_clock_source watch_rtc_get_clock_source(void);
+
 /// @}
 #endif
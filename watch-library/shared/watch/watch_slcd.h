@@ -84,6 +84,22 @@ void watch_clear_display(void);
   */
 void watch_display_string(char *string, uint8_t position);
 
+/** @brief Opens a display transaction: subsequent pixel and character writes accumulate in RAM
+  *        instead of touching the SLCD registers, until watch_display_commit flushes them.
+  * @details Watch faces that update several digits at once (a stopwatch updating the whole clock
+  *          line, say) otherwise issue a long series of independent segment register writes, and
+  *          the display can scan out a partially-updated frame in the middle of them. Wrapping
+  *          the updates in begin/commit coalesces them into one burst of register writes, one per
+  *          changed segment data word. Transactions do not nest; a second call to
+  *          watch_display_begin is a no-op.
+  */
+void watch_display_begin(void);
+
+/** @brief Commits a display transaction started with watch_display_begin, flushing all staged
+  *        pixel changes to the SLCD in a single burst. Does nothing if no transaction is open.
+  */
+void watch_display_commit(void);
+
 /** @brief Turns the colon segment on.
   */
 void watch_set_colon(void);
@@ -107,6 +123,55 @@ void watch_clear_indicator(WatchIndicatorSegment indicator);
   */
 void watch_clear_all_indicators(void);
 
+/** @brief Runtime-adjustable LCD drive parameters.
+  * @details Panels vary unit to unit: some ghost when many segments toggle at once under the
+  *          stock drive settings, while others render cleanly at a slower (and lower power)
+  *          frame rate than the stock one. These three values are everything that can be
+  *          tuned at runtime; the bias is pinned to 1/3 by the panel's 1/3 duty and is not
+  *          adjustable. The frame rate works out to 32768 Hz divided by the prescaler, the
+  *          divider and the three common lines.
+  */
+typedef struct {
+    uint8_t contrast;   ///< VLCD contrast adjustment, 0-15: about 2.51 V to 3.51 V in 67 mV steps.
+    uint8_t prescaler;  ///< SLCD clock prescaler, 0-3: divides the 32.768 kHz source by 16 << prescaler.
+    uint8_t divider;    ///< Further clock division, 0-7: divides by (divider + 1).
+} watch_lcd_drive_t;
+
+/** @brief Reads the LCD drive parameters currently in effect.
+  * @param drive Filled in with the current configuration.
+  */
+void watch_get_lcd_drive(watch_lcd_drive_t *drive);
+
+/** @brief Applies new LCD drive parameters.
+  * @details The frame rate fields are enable-protected, so the controller goes down briefly
+  *          while they change; segment data is retained, so the screen comes back as it was
+  *          without a repaint. Settings last until the next call to watch_enable_display,
+  *          which restores the stock configuration.
+  * @param drive The configuration to apply. Out-of-range fields are masked to their width.
+  */
+void watch_set_lcd_drive(watch_lcd_drive_t *drive);
+
+/** @brief Computes the frame rate a drive configuration would produce, in frames per second.
+  * @param drive The configuration to evaluate.
+  */
+static inline uint8_t watch_lcd_frame_rate(watch_lcd_drive_t *drive) {
+    return 32768 / ((16 << (drive->prescaler & 0x3)) * ((drive->divider & 0x7) + 1) * 3);
+}
+
+/** @brief Drops the LCD to its lowest-power drive that remains legible.
+  * @details Intended for low energy mode, where the display changes once a minute: the frame
+  *          rate falls to about 21 frames per second and the bias buffer (which firms up
+  *          segment transitions) turns off. Segment data is untouched and updates still work
+  *          normally; frame-counted effects like blinks and the tick animation run about
+  *          1.6x slower while this is in effect. The drive parameters in effect beforehand —
+  *          including any per-unit tuning — are restored by the exit call.
+  */
+void watch_display_enter_low_power_mode(void);
+
+/** @brief Restores the LCD drive that was in effect before watch_display_enter_low_power_mode.
+  */
+void watch_display_exit_low_power_mode(void);
+
 /** @brief Blinks a single character in position 7. Does not affect other positions.
   * @details Six of the seven segments in position 7 (and only position 7) are capable of autonomous
   *          blinking. This blinking does not require any CPU resources, and will continue even in
@@ -121,8 +186,30 @@ void watch_clear_all_indicators(void);
   */
 void watch_start_character_blink(char character, uint32_t duration);
 
+/** @brief Blinks a single pixel autonomously, leaving the rest of the display alone.
+  * @details Finer-grained counterpart to watch_start_character_blink: instead of rewriting
+  *          position 7 with a character, this sets one pixel and blinks just that pixel,
+  *          preserving whatever else is on the glass. Like the character blink it costs
+  *          zero CPU wakes and keeps going in STANDBY, which makes it a "watch is alive"
+  *          signal for low energy mode alongside the tick animation. Pixels accumulate:
+  *          call it again to add a second pixel at the same rate (the hardware has one
+  *          blink frame counter); watch_stop_blink clears the whole selection.
+  * @param com The common line of the pixel, 0-2.
+  * @param seg The segment line of the pixel. Only SEG lines 0 and 1 can blink.
+  * @param duration The duration of the on/off cycle in milliseconds, from 50 to ~4250 ms.
+  * @return true if the pixel can blink; false if it is out of the blink hardware's reach.
+  * @note The SAM L22's blink function only drives SEG lines 0 and 1 — the six pixels of
+  *       display position 7 minus its segment B. The colon (COM 1, SEG 16) and the
+  *       indicator icons (SEG 10, 16 and 17) are wired beyond its reach, so they cannot
+  *       blink without CPU wakes on this board; returning false lets a face fall back
+  *       to a position 7 heartbeat or the tick animation instead.
+  */
+bool watch_start_pixel_blink(uint8_t com, uint8_t seg, uint32_t duration);
+
 /** @brief Stops and clears all blinking segments.
   * @details This will stop all blinking in position 7, and clear all segments in that digit.
+  *          Also forgets any pixels selected with watch_start_pixel_blink, so the next
+  *          blink user starts from a clean selection.
   */
 void watch_stop_blink(void);
 
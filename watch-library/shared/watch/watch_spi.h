@@ -55,6 +55,22 @@ bool watch_spi_write(const uint8_t *buf, uint16_t length);
   */
 bool watch_spi_read(uint8_t *buf, uint16_t length);
 
+/** @brief Writes two buffers back to back in a single DMA chain, with the CPU idle.
+  * @details Built for the SPI flash page program: a 4-byte command header and a 256-byte
+  *          payload live in separate buffers, and gluing them together used to mean either
+  *          a staging copy or two CPU-fed byte loops. On hardware this sets up two linked
+  *          DMAC descriptors — header, then payload — and sleeps in IDLE while the
+  *          controller feeds the SERCOM; the one interrupt at the end of the chain wakes
+  *          us to wait out the last byte's shift register. In the simulator (and for a
+  *          zero-length payload) it falls back to sequential writes.
+  * @param header The first buffer to transmit.
+  * @param header_length The number of bytes in header.
+  * @param payload The second buffer, transmitted immediately after with no gap.
+  * @param payload_length The number of bytes in payload.
+  * @note This function does not manage the chip select pin (usually A3).
+  */
+bool watch_spi_write_scatter(const uint8_t *header, uint16_t header_length, const uint8_t *payload, uint16_t payload_length);
+
 /** @brief Reads a series of values from a device on the SPI bus.
   * @param data_out Storage for outgoing bytes.
   * @param data_in Storage for incoming bytes.
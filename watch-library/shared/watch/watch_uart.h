@@ -25,6 +25,7 @@
 #define _WATCH_UART_H_INCLUDED
 ////< @file watch_uart.h
 
+#include <stddef.h>
 #include "watch.h"
 
 /** @addtogroup uart UART
@@ -52,5 +53,39 @@ void watch_uart_puts(char *s);
   */
 char watch_uart_getc(void);
 
+/** @brief A callback for interrupt-driven receive. Called from the SERCOM interrupt handler:
+  *        keep it to setting a flag for your loop function; in particular, don't call
+  *        watch_uart_read_async from inside it.
+  */
+typedef void (*watch_uart_rx_callback_t)(void);
+
+/** @brief Switches the UART to interrupt-driven receive into a ring buffer you provide.
+  * @details The polled watch_uart_getc drops bytes whenever the CPU is busy elsewhere — a
+  *          33 ms tick handler at 9600 baud costs 30 characters of NMEA sentence. With a
+  *          ring buffer the interrupt handler catches every byte and your face drains them
+  *          at its leisure with watch_uart_read_async. While interrupt receive is enabled,
+  *          the main loop sleeps in IDLE instead of STANDBY: the SERCOM keeps its clock and
+  *          reception continues with the CPU halted, at an idle current cost — disable
+  *          receive when you stop listening.
+  * @param buffer Storage for the ring; yours to allocate, must outlive the enable.
+  * @param size Size of the buffer in bytes. When the ring is full, new bytes are dropped.
+  * @param watermark Fill level at which to invoke the callback, or 0 for no watermark.
+  * @param terminator A byte whose arrival also invokes the callback, or 0 for none. The
+  *                   SAM L22's SERCOM has no idle-line interrupt, so for framed protocols
+  *                   this is the end-of-frame signal: '\n' fires once per NMEA sentence.
+  * @param callback Called from interrupt context on watermark or terminator; may be NULL
+  *                 if you prefer to poll watch_uart_read_async from your tick.
+  */
+void watch_uart_rx_enable(uint8_t *buffer, size_t size, size_t watermark, uint8_t terminator, watch_uart_rx_callback_t callback);
+
+/** @brief Returns to polled receive and lets the main loop use STANDBY again.
+  */
+void watch_uart_rx_disable(void);
+
+/** @brief Drains up to len buffered bytes into buf without blocking.
+  * @return the number of bytes copied, possibly zero.
+  */
+size_t watch_uart_read_async(uint8_t *buf, size_t len);
+
 /// @}
 #endif
@@ -102,9 +102,23 @@ uint16_t watch_utility_days_since_new_year(uint16_t year, uint8_t month, uint8_t
     return (is_leap(year) && (month > 2) ? 1 : 0) + DAYS_SO_FAR[month - 1] + day;
 }
 
+uint32_t watch_utility_rata_die(uint16_t year, uint8_t month, uint8_t day) {
+    static const uint16_t DAYS_SO_FAR[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+    // days in the proleptic Gregorian years before this one, closed form: no loops.
+    // Day differences between any two dates are a single subtraction of two of these.
+    uint32_t prior_years = year - 1;
+    uint32_t days = 365 * prior_years + prior_years / 4 - prior_years / 100 + prior_years / 400;
+    // deliberately not is_leap(), which takes a tm-style year and misjudges
+    // century years like 2000 — birthdates reach well outside the RTC's range.
+    uint8_t leap = (year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0));
+    return days + DAYS_SO_FAR[month - 1] + ((month > 2) ? leap : 0) + day;
+}
+
 uint32_t watch_utility_convert_to_unix_time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, uint32_t utc_offset) {
     uint32_t year_adj = year + 4800;
-    uint32_t leap_days = 1 + (year_adj / 4) - (year_adj / 100) + (year_adj / 400);
+    // count leap days in the years before this one; this year's, if any, is accounted
+    // for by watch_utility_days_since_new_year once we're past February.
+    uint32_t leap_days = 1 + ((year_adj - 1) / 4) - ((year_adj - 1) / 100) + ((year_adj - 1) / 400);
     uint32_t days = 365 * year_adj + leap_days + watch_utility_days_since_new_year(year, month, day) - 1;
     days -= 2472692;  /* Adjust to Unix epoch. */
 
@@ -121,73 +135,66 @@ uint32_t watch_utility_date_time_to_unix_time(watch_date_time date_time, uint32_
     return watch_utility_convert_to_unix_time(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second, utc_offset);
 }
 
-#define LEAPOCH (946684800LL + 86400*(31+29))
-
-#define DAYS_PER_400Y (365*400 + 97)
-#define DAYS_PER_100Y (365*100 + 24)
-#define DAYS_PER_4Y   (365*4   + 1)
-
-watch_date_time watch_utility_date_time_from_unix_time(uint32_t timestamp, uint32_t utc_offset) {
-    watch_date_time retval;
-    retval.reg = 0;
-    int32_t days, secs;
-    int32_t remdays, remsecs, remyears;
-    int32_t qc_cycles, c_cycles, q_cycles;
-    int32_t years, months;
-    int32_t wday, yday, leap;
-    static const int8_t days_in_month[] = {31,30,31,30,31,31,30,31,30,31,31,29};
-    timestamp += utc_offset;
-
-    secs = timestamp - LEAPOCH;
-    days = secs / 86400;
-    remsecs = secs % 86400;
-    if (remsecs < 0) {
-        remsecs += 86400;
-        days--;
-    }
+int8_t watch_date_time_compare(watch_date_time a, watch_date_time b) {
+    // seconds occupy the low bits, with minute, hour, day, month and year stacked above
+    // them in order, so the packed registers sort chronologically as plain integers.
+    if (a.reg < b.reg) return -1;
+    return a.reg > b.reg ? 1 : 0;
+}
 
-    wday = (3+days)%7;
-    if (wday < 0) wday += 7;
+// seconds since midnight, unpacked from the register with shifts and two multiplies.
+static inline int32_t _watch_date_time_seconds_of_day(watch_date_time date_time) {
+    return (int32_t)((date_time.reg & 0x3F) + ((date_time.reg >> 6) & 0x3F) * 60 + ((date_time.reg >> 12) & 0x1F) * 3600);
+}
 
-    qc_cycles = (int)(days / DAYS_PER_400Y);
-    remdays = days % DAYS_PER_400Y;
-    if (remdays < 0) {
-        remdays += DAYS_PER_400Y;
-        qc_cycles--;
+int32_t watch_date_time_seconds_between(watch_date_time from, watch_date_time to) {
+    // same calendar day (bits 17 and up): no calendar math at all.
+    if ((from.reg >> 17) == (to.reg >> 17)) {
+        return _watch_date_time_seconds_of_day(to) - _watch_date_time_seconds_of_day(from);
     }
+    return (int32_t)(watch_utility_date_time_to_unix_time(to, 0) - watch_utility_date_time_to_unix_time(from, 0));
+}
 
-    c_cycles = remdays / DAYS_PER_100Y;
-    if (c_cycles == 4) c_cycles--;
-    remdays -= c_cycles * DAYS_PER_100Y;
-
-    q_cycles = remdays / DAYS_PER_4Y;
-    if (q_cycles == 25) q_cycles--;
-    remdays -= q_cycles * DAYS_PER_4Y;
-
-    remyears = remdays / 365;
-    if (remyears == 4) remyears--;
-    remdays -= remyears * 365;
+// 2020-01-01 00:00:00 UTC, the earliest moment the RTC can represent.
+#define EPOCH_2020 (1577836800u)
 
-    leap = !remyears && (q_cycles || !c_cycles);
-    yday = remdays + 31 + 28 + leap;
-    if (yday >= 365+leap) yday -= 365+leap;
+watch_date_time watch_utility_date_time_from_unix_time(uint32_t timestamp, uint32_t utc_offset) {
+    watch_date_time retval;
+    retval.reg = 0;
+    // cumulative days from 2020-01-01 to January 1 of each representable year (2020 - 2083),
+    // with a final entry marking the end of 2083. trading 130 bytes of flash for the
+    // Gregorian 400/100/4-year cycle div/mod chains this function used to grind through.
+    static const uint16_t days_to_year[65] = {
+        0, 366, 731, 1096, 1461, 1827, 2192, 2557, 2922, 3288,
+        3653, 4018, 4383, 4749, 5114, 5479, 5844, 6210, 6575, 6940,
+        7305, 7671, 8036, 8401, 8766, 9132, 9497, 9862, 10227, 10593,
+        10958, 11323, 11688, 12054, 12419, 12784, 13149, 13515, 13880, 14245,
+        14610, 14976, 15341, 15706, 16071, 16437, 16802, 17167, 17532, 17898,
+        18263, 18628, 18993, 19359, 19724, 20089, 20454, 20820, 21185, 21550,
+        21915, 22281, 22646, 23011, 23376,
+    };
+    static const uint16_t days_to_month[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
 
-    years = remyears + 4*q_cycles + 100*c_cycles + 400*qc_cycles;
+    timestamp += utc_offset;
+    if (timestamp < EPOCH_2020) return retval;
 
-    for (months=0; days_in_month[months] <= remdays; months++)
-        remdays -= days_in_month[months];
+    uint32_t days = (timestamp - EPOCH_2020) / 86400;
+    uint32_t remsecs = (timestamp - EPOCH_2020) % 86400;
+    if (days >= days_to_year[64]) return retval;
 
-    years += 2000;
+    // seed the year from the day count, then walk forward at most one entry.
+    uint32_t year = days / 366;
+    while (days >= days_to_year[year + 1]) year++;
+    uint32_t remdays = days - days_to_year[year];
 
-    months += 2;
-    if (months >= 12) {
-        months -=12;
-        years++;
-    }
+    // no year from 2020 through 2083 is divisible by 100, so the %4 test suffices.
+    uint32_t leap = ((year + WATCH_RTC_REFERENCE_YEAR) % 4 == 0) ? 1 : 0;
+    uint32_t month = 11;
+    while (remdays < days_to_month[month] + ((month >= 2) ? leap : 0)) month--;
+    remdays -= days_to_month[month] + ((month >= 2) ? leap : 0);
 
-    if (years < 2020 || years > 2083) return retval;
-    retval.unit.year = years - WATCH_RTC_REFERENCE_YEAR;
-    retval.unit.month = months + 1;
+    retval.unit.year = year;
+    retval.unit.month = month + 1;
     retval.unit.day = remdays + 1;
 
     retval.unit.hour = remsecs / 3600;
@@ -198,6 +205,19 @@ watch_date_time watch_utility_date_time_from_unix_time(uint32_t timestamp, uint3
 }
 
 watch_date_time watch_utility_date_time_convert_zone(watch_date_time date_time, uint32_t origin_utc_offset, uint32_t destination_utc_offset) {
+    int32_t delta = (int32_t)destination_utc_offset - (int32_t)origin_utc_offset;
+
+    // UTC offsets are whole minutes apart, and most conversions land within the same
+    // day; in that case, shift hour and minute in place and skip the calendar math.
+    if (delta % 60 == 0) {
+        int32_t minutes = date_time.unit.hour * 60 + date_time.unit.minute + delta / 60;
+        if (minutes >= 0 && minutes < 24 * 60) {
+            date_time.unit.hour = minutes / 60;
+            date_time.unit.minute = minutes % 60;
+            return date_time;
+        }
+    }
+
     uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, origin_utc_offset);
     return watch_utility_date_time_from_unix_time(timestamp, destination_utc_offset);
 }
@@ -247,3 +267,40 @@ uint32_t watch_utility_offset_timestamp(uint32_t now, int8_t hours, int8_t minut
     new += seconds;
     return new;
 }
+
+uint32_t watch_utility_fast_divide(uint32_t numerator, uint32_t denominator) {
+    if (denominator == 0) return UINT32_MAX;
+    uint8_t shift = __builtin_clz(denominator);
+    uint32_t d = denominator << shift;              // normalized to [0.5, 1) in Q0.32
+    // linear seed r = 48/17 - 32/17 * d in Q1.31, good to about 4.8 bits
+    uint32_t r = (uint32_t)(6063483241ull - (((uint64_t)4042322160u * d) >> 32));
+    // three Newton-Raphson steps r = r * (2 - d * r), doubling the correct bits each time
+    for (int i = 0; i < 3; i++) {
+        uint32_t e = (uint32_t)0u - (uint32_t)(((uint64_t)d * r) >> 32); // 2 - d*r in Q1.31 (the 2 wraps to 0)
+        r = (uint32_t)(((uint64_t)r * e) >> 31);
+    }
+    // quotient estimate from the reciprocal, then at most one correction step for exactness
+    uint32_t q = (uint32_t)(((uint64_t)numerator * r) >> (63 - shift));
+    while ((uint64_t)q * denominator > numerator) q--;
+    while (numerator - (uint64_t)q * denominator >= denominator) q++;
+    return q;
+}
+
+void watch_utility_format_2d(char *buf, uint8_t value) {
+    // value / 10 as a multiply and shift; exact for value < 160, and these fields are 0-99.
+    uint8_t tens = ((uint16_t)value * 205) >> 11;
+    buf[0] = '0' + tens;
+    buf[1] = '0' + (uint8_t)(value - tens * 10);
+}
+
+void watch_utility_format_2d_space(char *buf, uint8_t value) {
+    watch_utility_format_2d(buf, value);
+    if (buf[0] == '0') buf[0] = ' ';
+}
+
+void watch_utility_format_time(char *buf, uint8_t hour, uint8_t minute, uint8_t second) {
+    watch_utility_format_2d(buf, hour);
+    watch_utility_format_2d(buf + 2, minute);
+    watch_utility_format_2d(buf + 4, second);
+    buf[6] = 0;
+}
@@ -73,6 +73,16 @@ uint8_t watch_utility_get_weeknumber(uint16_t year, uint8_t month, uint8_t day);
  */
 uint16_t watch_utility_days_since_new_year(uint16_t year, uint8_t month, uint8_t day);
 
+/** @brief Returns the rata die (fixed day number) of the given Gregorian date: day 1 is
+  *        January 1 of year 1. Computed in closed form with a month lookup table, so the
+  *        difference between any two dates in days is one subtraction. The Julian day
+  *        number at midnight of a date is its rata die plus 1721424.5.
+  * @param year The year of the date (e.g. 2022)
+  * @param month The month of the date (1-12)
+  * @param day The day of the date (1-31)
+  */
+uint32_t watch_utility_rata_die(uint16_t year, uint8_t month, uint8_t day);
+
 /** @brief Returns 1 if year is leap and 0 otherwise
  * @param year The year (ex. 2022)
  */
@@ -100,6 +110,25 @@ uint32_t watch_utility_convert_to_unix_time(uint16_t year, uint8_t month, uint8_
   */
 uint32_t watch_utility_date_time_to_unix_time(watch_date_time date_time, uint32_t utc_offset);
 
+/** @brief Compares two watch_date_time values chronologically.
+  * @return -1 if a is earlier than b, 0 if they are equal, 1 if a is later than b.
+  * @details The packed register orders its fields seconds-first through year-last, so two
+  *          date_times compare correctly as plain integers — no field extraction needed.
+  *          Prefer this (or a direct .reg comparison) over comparing six unpacked fields
+  *          in scheduling code.
+  */
+int8_t watch_date_time_compare(watch_date_time a, watch_date_time b);
+
+/** @brief Returns the number of seconds from one watch_date_time to another.
+  * @param from The earlier time (a negative result means it wasn't the earlier one).
+  * @param to The later time.
+  * @return to - from, in seconds. Both times must be in the same time zone.
+  * @details When both times fall on the same calendar day — the common case for alarm and
+  *          timer scheduling — this is pure register arithmetic on the time-of-day bits.
+  *          Only when the day differs does it fall back to full calendar conversion.
+  */
+int32_t watch_date_time_seconds_between(watch_date_time from, watch_date_time to);
+
 /** @brief Converts a duration in seconds to a watch_duration_t struct.
   * @param seconds A positive number of seconds that you wish to convert to a formatted duration.
   * @return A populated struct with the number of days, hours, minutes and seconds elapsed.
@@ -164,4 +193,38 @@ float watch_utility_thermistor_temperature(uint16_t value, bool highside, float
  */
 uint32_t watch_utility_offset_timestamp(uint32_t now, int8_t hours, int8_t minutes, int8_t seconds);
 
+/** @brief Integer division via a fixed-point Newton-Raphson reciprocal, for rate = constant / elapsed
+ *        computations in display paths.
+ * @param numerator The dividend.
+ * @param denominator The divisor. Division by zero returns UINT32_MAX rather than faulting.
+ * @return numerator / denominator, truncated, exactly as the / operator would give.
+ * @details The SAM L22 has no hardware divider, so the / operator calls out to a software routine
+ *          whose run time varies with the operands; float division is costlier still. This routine
+ *          seeds a reciprocal from a linear fit, sharpens it with three Newton-Raphson steps (each
+ *          doubling the correct bits), and multiplies — a flat, short instruction count well suited
+ *          to a tick handler that turns an elapsed tick count into a displayed rate.
+ */
+uint32_t watch_utility_fast_divide(uint32_t numerator, uint32_t denominator);
+
+/** @brief Writes a two-digit zero-padded decimal number ("07", "42") with no terminating NUL.
+ * @param buf Destination for exactly two characters.
+ * @param value The value to format, 0-99.
+ * @details Equivalent to sprintf(buf, "%02d", value) without the format string interpretation:
+ *          newlib's printf re-parses the format, builds a large stack frame and calls the
+ *          software divide on every invocation, which is pure overhead in a loop function
+ *          running at 1-128 Hz. The digit split here is a multiply and a shift. Compose calls
+ *          into a line buffer and terminate it yourself (or use watch_utility_format_time).
+ */
+void watch_utility_format_2d(char *buf, uint8_t value);
+
+/** @brief Like watch_utility_format_2d, but pads a single-digit value with a leading space
+ *        instead of a zero, the way sprintf's "%2d" renders day and hour fields.
+ */
+void watch_utility_format_2d_space(char *buf, uint8_t value);
+
+/** @brief Writes "hhmmss" — three two-digit zero-padded fields — plus a terminating NUL.
+ * @param buf Destination for six characters plus the NUL.
+ */
+void watch_utility_format_time(char *buf, uint8_t hour, uint8_t minute, uint8_t second);
+
 #endif
@@ -24,6 +24,7 @@
 
 #include <stdio.h>
 #include "watch.h"
+#include "watch_energy.h"
 #include "watch_main_loop.h"
 
 #include <emscripten.h>
@@ -58,7 +59,11 @@ static EM_BOOL main_loop(double time, void *userData) {
     }
 
     animation_frame_id = ANIMATION_FRAME_ID_INVALID;
+    // time each pass through the app loop: this is the "CPU active" term of the
+    // simulator's energy model; everything between passes counts as STANDBY.
+    double loop_start = emscripten_get_now();
     bool can_sleep = app_loop();
+    watch_energy_charge_active(emscripten_get_now() - loop_start);
 
     if (can_sleep) {
         app_prepare_for_standby();
@@ -106,9 +111,15 @@ void delay_ms(const uint16_t ms) {
 }
 
 int main(void) {
+    // mirror the hardware boot markers (in wall time) so `bootlog` works here too.
+    watch_profile_counter_start();
     app_init();
+    watch_boot_mark("app_init");
     _watch_init();
+    watch_boot_mark("watch_init");
     app_setup();
+    watch_boot_mark("app_setup");
+    watch_boot_finish();
 
     resume_main_loop();
 
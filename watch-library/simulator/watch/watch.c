@@ -1,4 +1,5 @@
 #include "watch.h"
+#include <stdio.h>
 
 bool watch_is_buzzer_or_led_enabled(void) {
     return false;
@@ -8,6 +9,28 @@ bool watch_is_usb_enabled(void) {
     return true;
 }
 
+bool watch_usb_hid_type_string(const char *str) {
+    // no HID keyboard in the simulator.
+    (void) str;
+    return false;
+}
+
+void watch_set_performance_level(uint8_t level) {
+    // no performance levels in the simulator.
+    (void) level;
+}
+
+void watch_cpu_boost_begin(void) {
+    // no clock to boost in the simulator.
+}
+
+void watch_cpu_boost_end(void) {
+}
+
+void watch_dump_clock_tree(void) {
+    printf("no clock tree in the simulator\n");
+}
+
 void watch_reset_to_bootloader(void) {
     // No bootloader in the simulator; nothing to do here
 }
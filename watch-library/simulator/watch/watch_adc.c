@@ -32,8 +32,38 @@ uint16_t watch_get_analog_pin_level(const uint8_t pin) {
     return 32767; // pretend it's half of VCC
 }
 
+void watch_get_analog_pin_level_async(const uint8_t pin, watch_adc_callback_t callback) {
+    // no conversion time to wait out in the simulator; deliver the result immediately.
+    if (callback) callback(watch_get_analog_pin_level(pin));
+}
+
+// there is no event system in the simulator; periodic sampling is approximated with a
+// periodic RTC callback delivering the (static) simulated pin level.
+static watch_adc_callback_t _adc_periodic_callback = NULL;
+static uint8_t _adc_periodic_pin = 0;
+static uint8_t _adc_periodic_frequency = 0;
+
+static void _adc_periodic_tick(void) {
+    if (_adc_periodic_callback) _adc_periodic_callback(watch_get_analog_pin_level(_adc_periodic_pin));
+}
+
+void watch_adc_schedule_periodic(const uint8_t pin, uint8_t frequency, watch_adc_callback_t callback) {
+    _adc_periodic_pin = pin;
+    _adc_periodic_frequency = frequency;
+    _adc_periodic_callback = callback;
+    watch_rtc_subscribe_periodic_callback(_adc_periodic_tick, frequency);
+}
+
+void watch_adc_cancel_periodic(void) {
+    if (_adc_periodic_callback == NULL) return;
+    _adc_periodic_callback = NULL;
+    watch_rtc_unsubscribe_periodic_callback(_adc_periodic_tick, _adc_periodic_frequency);
+}
+
 void watch_set_analog_num_samples(uint16_t samples) {}
 
+void watch_set_analog_oversampling(uint16_t samples) {}
+
 void watch_set_analog_sampling_length(uint8_t cycles) {}
 
 void watch_set_analog_reference_voltage(watch_adc_reference_voltage reference) {}
@@ -23,6 +23,7 @@
  */
 
 #include "watch_buzzer.h"
+#include "watch_energy.h"
 #include "watch_main_loop.h"
 
 #include <emscripten.h>
@@ -34,9 +35,11 @@ static uint32_t buzzer_period;
 void cb_watch_buzzer_seq(void *userData);
 
 static uint16_t _seq_position;
-static int8_t _tone_ticks, _repeat_counter;
+static int16_t _tone_ticks;
+static int8_t _repeat_counter;
 static long _em_interval_id = 0;
 static int8_t *_sequence;
+static watch_buzzer_next_note_t _next_note;
 static void (*_cb_finished)(void);
 
 static inline void _em_interval_stop() {
@@ -48,6 +51,7 @@ void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(v
     if (_em_interval_id) _em_interval_stop();
     watch_set_buzzer_off();
     _sequence = note_sequence;
+    _next_note = NULL;
     _cb_finished = callback_on_end;
     _seq_position = 0;
     _tone_ticks = 0;
@@ -58,9 +62,41 @@ void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(v
     _em_interval_id = emscripten_set_interval(cb_watch_buzzer_seq, (double)(1000/64), (void *)NULL);
 }
 
+void watch_buzzer_play_stream(watch_buzzer_next_note_t next_note, void (*callback_on_end)(void)) {
+    if (_em_interval_id) _em_interval_stop();
+    watch_set_buzzer_off();
+    _sequence = NULL;
+    _next_note = next_note;
+    _cb_finished = callback_on_end;
+    _tone_ticks = 0;
+    // prepare buzzer
+    watch_enable_buzzer();
+    // initiate 64 hz callback
+    _em_interval_id = emscripten_set_interval(cb_watch_buzzer_seq, (double)(1000/64), (void *)NULL);
+}
+
 void cb_watch_buzzer_seq(void *userData) {
-    // callback for reading the note sequence
     (void) userData;
+    // streamed sequence: pull each note from the supplier instead of walking an array.
+    if (_next_note) {
+        if (_tone_ticks == 0) {
+            BuzzerNote note;
+            uint8_t duration;
+            if (_next_note(&note, &duration) && duration) {
+                if (note != BUZZER_NOTE_REST) {
+                    watch_set_buzzer_note(note);
+                    watch_set_buzzer_on();
+                } else watch_set_buzzer_off();
+                _tone_ticks = duration;
+            } else {
+                // supplier ran dry: end the sequence
+                watch_buzzer_abort_sequence();
+                if (_cb_finished) _cb_finished();
+            }
+        } else _tone_ticks--;
+        return;
+    }
+    // callback for reading the note sequence
     if (_tone_ticks == 0) {
         if (_sequence[_seq_position] < 0 && _sequence[_seq_position + 1]) {
             // repeat indicator found
@@ -86,7 +122,7 @@ void cb_watch_buzzer_seq(void *userData) {
             if (note == BUZZER_NOTE_REST) {
                 watch_set_buzzer_off();
             } else {
-                watch_set_buzzer_period(NotePeriods[note]);
+                watch_set_buzzer_note(note);
                 watch_set_buzzer_on();
             }
             // set duration ticks and move to next tone
@@ -103,6 +139,7 @@ void cb_watch_buzzer_seq(void *userData) {
 void watch_buzzer_abort_sequence(void) {
     // ends/aborts the sequence
     if (_em_interval_id) _em_interval_stop();
+    _next_note = NULL;
     watch_set_buzzer_off();
 }
 
@@ -115,11 +152,26 @@ void watch_enable_buzzer(void) {
     });
 }
 
+// the hardware narrows the drive pulse; here the same classes just scale the output gain.
+static double buzzer_gain = 1.0;
+
+void watch_set_buzzer_volume(watch_buzzer_volume_t volume) {
+    switch (volume) {
+        case WATCH_BUZZER_VOLUME_SOFT: buzzer_gain = 0.5; break;
+        case WATCH_BUZZER_VOLUME_QUIET: buzzer_gain = 0.25; break;
+        default: buzzer_gain = 1.0; break;
+    }
+}
+
 void watch_set_buzzer_period(uint32_t period) {
     if (!buzzer_enabled) return;
     buzzer_period = period;
 }
 
+void watch_set_buzzer_note(BuzzerNote note) {
+    watch_set_buzzer_period(NotePeriods[note]);
+}
+
 void watch_disable_buzzer(void) {
     buzzer_enabled = false;
     buzzer_period = NotePeriods[BUZZER_NOTE_A4];
@@ -134,6 +186,7 @@ void watch_disable_buzzer(void) {
 
 void watch_set_buzzer_on(void) {
     if (!buzzer_enabled) return;
+    watch_energy_note_buzzer(true);
 
     EM_ASM({
         const audioContext = Module['audioContext'];
@@ -152,12 +205,13 @@ void watch_set_buzzer_on(void) {
         }
 
         audioContext._oscillator.frequency.value = 1e6/$0;
-        audioContext._gain.gain.value = 1;
-    }, buzzer_period);
+        audioContext._gain.gain.value = $1;
+    }, buzzer_period, buzzer_gain);
 }
 
 void watch_set_buzzer_off(void) {
     if (!buzzer_enabled) return;
+    watch_energy_note_buzzer(false);
 
     EM_ASM({
         const audioContext = Module['audioContext'];
@@ -171,7 +225,7 @@ void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms) {
     if (note == BUZZER_NOTE_REST) {
         watch_set_buzzer_off();
     } else {
-        watch_set_buzzer_period(NotePeriods[note]);
+        watch_set_buzzer_note(note);
         watch_set_buzzer_on();
     }
 
@@ -0,0 +1,201 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_energy.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <emscripten.h>
+
+// 48 faces is comfortably more than any firmware ships; the last row collects time
+// spent outside any face (startup, movement housekeeping).
+#define MAX_FACES 48
+#define SYSTEM_ROW MAX_FACES
+
+typedef struct {
+    double active_ms;
+    uint32_t slcd_writes;
+    uint32_t i2c_bytes;
+    double buzzer_ms;
+    double led_ms; // at full-brightness-equivalent duty
+} energy_row_t;
+
+static energy_row_t rows[MAX_FACES + 1];
+static int16_t current_row = SYSTEM_ROW;
+static double session_start_ms;
+static double last_report_ms;
+static bool session_started = false;
+
+// Where "now" comes from. In the browser it's wall clock; the headless driver swaps in
+// the replay's virtual clock, so a day fast-forwarded in two real seconds still charges
+// a day's standby floor and a day of buzzer/LED on-time to the session.
+static double (*clock_fn)(void) = NULL;
+
+static double _energy_now(void) {
+    return clock_fn ? clock_fn() : emscripten_get_now();
+}
+
+void _watch_energy_set_clock(double (*now_fn)(void)) {
+    clock_fn = now_fn;
+}
+
+// on-time sources are level-triggered: remember when the level last changed and
+// integrate up to "now" whenever it changes again or a report is due.
+static bool buzzer_on = false;
+static double buzzer_since_ms;
+static double led_duty = 0.0; // 1.0 = both LEDs at full brightness
+static double led_since_ms;
+
+static void _settle_levels(double now) {
+    if (buzzer_on) {
+        rows[current_row].buzzer_ms += now - buzzer_since_ms;
+        buzzer_since_ms = now;
+    }
+    if (led_duty > 0.0) {
+        rows[current_row].led_ms += (now - led_since_ms) * led_duty;
+        led_since_ms = now;
+    }
+}
+
+static void _ensure_session(void) {
+    if (!session_started) {
+        session_started = true;
+        session_start_ms = _energy_now();
+        last_report_ms = session_start_ms;
+    }
+}
+
+static double _row_charge_uc(const energy_row_t *row) {
+    // µA × ms / 1000 = µC
+    return (row->active_ms * WATCH_ENERGY_ACTIVE_UA
+            + row->buzzer_ms * WATCH_ENERGY_BUZZER_UA
+            + row->led_ms * WATCH_ENERGY_LED_FULL_UA) / 1000.0
+        + row->slcd_writes * WATCH_ENERGY_SLCD_WRITE_UC
+        + row->i2c_bytes * WATCH_ENERGY_I2C_BYTE_UC;
+}
+
+static void _report(double now) {
+    char html[4096];
+    size_t pos = 0;
+    double session_s = (now - session_start_ms) / 1000.0;
+    if (session_s <= 0.0) return;
+
+    double total_uc = session_s * WATCH_ENERGY_STANDBY_UA; // the floor everyone pays
+    for (int16_t i = 0; i <= SYSTEM_ROW; i++) total_uc += _row_charge_uc(&rows[i]);
+
+    pos += snprintf(html + pos, sizeof(html) - pos,
+        "<tr><th>face</th><th>active ms</th><th>slcd wr</th><th>i2c B</th>"
+        "<th>buzz ms</th><th>led ms</th><th>&micro;C</th></tr>");
+    for (int16_t i = 0; i <= SYSTEM_ROW && pos < sizeof(html) - 128; i++) {
+        const energy_row_t *row = &rows[i];
+        double uc = _row_charge_uc(row);
+        if (uc == 0.0) continue;
+        char label[8];
+        if (i == SYSTEM_ROW) snprintf(label, sizeof(label), "sys");
+        else snprintf(label, sizeof(label), "%d", i);
+        pos += snprintf(html + pos, sizeof(html) - pos,
+            "<tr><td>%s</td><td>%.0f</td><td>%lu</td><td>%lu</td><td>%.0f</td><td>%.0f</td><td>%.2f</td></tr>",
+            label, row->active_ms, (unsigned long)row->slcd_writes, (unsigned long)row->i2c_bytes,
+            row->buzzer_ms, row->led_ms, uc);
+    }
+
+    EM_ASM({
+        if (typeof document === 'undefined') return; // headless: watch_energy_print instead
+        var table = document.getElementById('powerprofile');
+        if (table) table.innerHTML = UTF8ToString($0);
+        var summary = document.getElementById('powersummary');
+        // average current over the session, standby floor included
+        if (summary) summary.innerText = 'session ' + $2.toFixed(0) + ' s, modeled average ' + ($1 / $2).toFixed(1) + ' µA';
+    }, html, total_uc, session_s);
+}
+
+static void _maybe_report(double now) {
+    if (now - last_report_ms >= 1000.0) {
+        last_report_ms = now;
+        _settle_levels(now);
+        _report(now);
+    }
+}
+
+void watch_energy_set_face(int16_t face_idx) {
+    _ensure_session();
+    // settle level-triggered charges against the outgoing face first.
+    _settle_levels(_energy_now());
+    if (face_idx < 0 || face_idx >= MAX_FACES) current_row = SYSTEM_ROW;
+    else current_row = face_idx;
+}
+
+void watch_energy_charge_active(double ms) {
+    _ensure_session();
+    rows[current_row].active_ms += ms;
+    _maybe_report(_energy_now());
+}
+
+void watch_energy_charge_slcd_write(void) {
+    _ensure_session();
+    rows[current_row].slcd_writes++;
+}
+
+void watch_energy_charge_i2c(uint16_t bytes) {
+    _ensure_session();
+    rows[current_row].i2c_bytes += bytes;
+}
+
+void watch_energy_note_buzzer(bool on) {
+    _ensure_session();
+    double now = _energy_now();
+    _settle_levels(now);
+    buzzer_on = on;
+    buzzer_since_ms = now;
+}
+
+void watch_energy_print(void) {
+    if (!session_started) return;
+    double now = _energy_now();
+    _settle_levels(now);
+    double session_s = (now - session_start_ms) / 1000.0;
+    double total_uc = session_s * WATCH_ENERGY_STANDBY_UA;
+    printf("ENERGY face active_ms slcd_writes i2c_bytes buzzer_ms led_ms uc\n");
+    for (int16_t i = 0; i <= SYSTEM_ROW; i++) {
+        const energy_row_t *row = &rows[i];
+        double uc = _row_charge_uc(row);
+        total_uc += uc;
+        if (uc == 0.0) continue;
+        if (i == SYSTEM_ROW) printf("ENERGY sys");
+        else printf("ENERGY %d", i);
+        printf(" %.0f %lu %lu %.0f %.0f %.2f\n",
+            row->active_ms, (unsigned long)row->slcd_writes, (unsigned long)row->i2c_bytes,
+            row->buzzer_ms, row->led_ms, uc);
+    }
+    if (session_s > 0.0) printf("ENERGY total %.2f uC over %.1f s (avg %.1f uA)\n", total_uc, session_s, total_uc / session_s);
+}
+
+void watch_energy_note_led(uint8_t red, uint8_t green) {
+    _ensure_session();
+    double now = _energy_now();
+    _settle_levels(now);
+    led_duty = (red + green) / 510.0;
+    led_since_ms = now;
+}
@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_ENERGY_H_INCLUDED
+#define _WATCH_ENERGY_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Simulator-only energy accounting. The simulated HAL charges a modeled cost for each
+// operation it emulates — active CPU time, SLCD segment writes, I2C bus traffic, buzzer
+// and LED on-time — attributed to whichever watch face is current, and renders a
+// per-face power profile table into the simulator page once a second. The constants
+// below are a model drawn from the SAM L22 data sheet and the board's typical draw,
+// not measurements: the absolute numbers are estimates, but a face that regresses
+// (ticking faster, rewriting the whole display, holding the bus) shows up clearly
+// relative to its neighbors before anyone flashes hardware.
+
+// modeled currents (µA) and per-operation charges (µC)
+#define WATCH_ENERGY_ACTIVE_UA      500.0   // CPU awake in the main loop
+#define WATCH_ENERGY_STANDBY_UA     7.5     // STANDBY floor: RTC + SLCD + regulator
+#define WATCH_ENERGY_SLCD_WRITE_UC  0.05    // one segment set or cleared
+#define WATCH_ENERGY_I2C_BYTE_UC    0.3     // one byte on the bus at 100 kHz
+#define WATCH_ENERGY_BUZZER_UA      1100.0  // piezo + TCC while a note sounds
+#define WATCH_ENERGY_LED_FULL_UA    5000.0  // both LEDs at full brightness
+
+/** @brief Attributes subsequent charges to the given watch face.
+  * @param face_idx The index of the face now current, or -1 for time outside any face
+  *        (startup, movement housekeeping).
+  */
+void watch_energy_set_face(int16_t face_idx);
+
+/** @brief Charges active CPU time to the current face. Called by the main loop around
+  *        each pass through app_loop; also drives the once-a-second report refresh.
+  */
+void watch_energy_charge_active(double ms);
+
+/** @brief Charges one SLCD segment write to the current face. */
+void watch_energy_charge_slcd_write(void);
+
+/** @brief Charges an I2C transaction of the given length (including the address byte)
+  *        to the current face.
+  */
+void watch_energy_charge_i2c(uint16_t bytes);
+
+/** @brief Notes that the buzzer turned on or off; on-time between the two is charged
+  *        to the current face.
+  */
+void watch_energy_note_buzzer(bool on);
+
+/** @brief Notes a change in LED level; on-time is charged to the current face, scaled
+  *        by the duty the color implies.
+  */
+void watch_energy_note_led(uint8_t red, uint8_t green);
+
+/** @brief Prints the profile table to stdout; the headless batch driver's counterpart to
+  *        the in-page table.
+  */
+void watch_energy_print(void);
+
+/** @brief Substitutes a clock for wall time; NULL restores emscripten_get_now. The
+  *        headless driver installs the replay's virtual clock so the standby floor and
+  *        level-triggered on-times cover replayed hours, not the real seconds the
+  *        replay took.
+  */
+void _watch_energy_set_clock(double (*now_fn)(void));
+
+#endif
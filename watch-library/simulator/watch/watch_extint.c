@@ -23,6 +23,7 @@
  */
 
 #include "watch_extint.h"
+#include "watch_headless.h"
 #include "watch_main_loop.h"
 
 #include <emscripten.h>
@@ -150,6 +151,7 @@ static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, watch_in
 
     const bool level = (event & INTERRUPT_TRIGGER_RISING) != 0;
     EM_ASM({
+        if (typeof document === 'undefined') return; // headless: no page to highlight
         const classList = document.querySelector('#btn' + $0).classList;
         const highlight = 'highlight';
         $1 ? classList.add(highlight) : classList.remove(highlight);
@@ -169,6 +171,10 @@ static EM_BOOL watch_invoke_interrupt_callback(const uint8_t button_id, watch_in
     return EM_TRUE;
 }
 
+void _watch_extint_headless_press(uint8_t button_id, bool down) {
+    watch_invoke_interrupt_callback(button_id, down ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING);
+}
+
 void watch_register_interrupt_callback(const uint8_t pin, ext_irq_cb_t callback, watch_interrupt_trigger trigger) {
     if (pin == BTN_MODE) {
         external_interrupt_mode_callback = callback;
@@ -0,0 +1,108 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_fast_timer.h"
+
+#include <emscripten.h>
+#include <emscripten/html5.h>
+
+// one global 128 Hz counter; each channel is an offset into it (see watch_fast_timer.h).
+static volatile uint32_t _global_ticks;
+
+static struct {
+    uint32_t start;         // _global_ticks when the channel last started
+    uint32_t accumulated;   // ticks counted before the last start
+    bool claimed;
+    bool running;
+} _channels[WATCH_FAST_TIMER_NUM_CHANNELS];
+
+static uint8_t _running_count;
+static long _em_interval_id = 0;
+
+static inline bool _channel_valid(int8_t channel) {
+    return channel >= 0 && channel < WATCH_FAST_TIMER_NUM_CHANNELS && _channels[channel].claimed;
+}
+
+static void _em_tick(void *userData) {
+    (void) userData;
+    _global_ticks++;
+}
+
+int8_t watch_fast_timer_claim(void) {
+    for (int8_t channel = 0; channel < WATCH_FAST_TIMER_NUM_CHANNELS; channel++) {
+        if (!_channels[channel].claimed) {
+            _channels[channel].claimed = true;
+            _channels[channel].running = false;
+            _channels[channel].accumulated = 0;
+            _channels[channel].start = _global_ticks;
+            return channel;
+        }
+    }
+    return -1;
+}
+
+void watch_fast_timer_release(int8_t channel) {
+    if (!_channel_valid(channel)) return;
+    if (_channels[channel].running) watch_fast_timer_stop(channel);
+    _channels[channel].claimed = false;
+}
+
+void watch_fast_timer_start(int8_t channel) {
+    if (!_channel_valid(channel) || _channels[channel].running) return;
+    _channels[channel].start = _global_ticks;
+    _channels[channel].running = true;
+    if (_running_count++ == 0) {
+        // first running channel: start the 128 Hz callback
+        _em_interval_id = emscripten_set_interval(_em_tick, (double)(1000 / 128), NULL);
+    }
+}
+
+void watch_fast_timer_stop(int8_t channel) {
+    if (!_channel_valid(channel) || !_channels[channel].running) return;
+    _channels[channel].accumulated += _global_ticks - _channels[channel].start;
+    _channels[channel].running = false;
+    if (--_running_count == 0) {
+        // last running channel: stop the 128 Hz callback
+        emscripten_clear_interval(_em_interval_id);
+        _em_interval_id = 0;
+    }
+}
+
+void watch_fast_timer_reset(int8_t channel) {
+    if (!_channel_valid(channel)) return;
+    _channels[channel].accumulated = 0;
+    _channels[channel].start = _global_ticks;
+}
+
+uint32_t watch_fast_timer_get_ticks(int8_t channel) {
+    if (!_channel_valid(channel)) return 0;
+    uint32_t ticks = _channels[channel].accumulated;
+    if (_channels[channel].running) ticks += _global_ticks - _channels[channel].start;
+    return ticks;
+}
+
+bool watch_fast_timer_is_running(int8_t channel) {
+    if (!_channel_valid(channel)) return false;
+    return _channels[channel].running;
+}
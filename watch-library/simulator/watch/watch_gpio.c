@@ -45,3 +45,5 @@ void watch_disable_digital_output(const uint8_t pin) {}
 void watch_set_pin_level(const uint8_t pin, const bool level) {
     pin_levels[pin] = level;
 }
+
+void watch_configure_port(const uint8_t port, const uint32_t mask, const watch_gpio_config_t *config) {}
@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_headless.h"
+
+#include <stdio.h>
+
+#include <emscripten.h>
+
+#include "watch.h"
+#include "watch_energy.h"
+
+// after an injected event or a clock step, pump the app loop until it reports it could
+// sleep. the cap guards against a face that never sleeps (e.g. a running stopwatch)
+// starving the replay.
+#define HEADLESS_MAX_LOOP_PASSES 8
+
+static void _drain_app_loop(void) {
+    for (int i = 0; i < HEADLESS_MAX_LOOP_PASSES; i++) {
+        if (app_loop()) break;
+    }
+}
+
+EMSCRIPTEN_KEEPALIVE
+void watch_headless_init(void) {
+    _watch_rtc_headless_enable();
+    // charge energy against the virtual clock, so a fast-forwarded day is billed as a day.
+    _watch_energy_set_clock(_watch_rtc_headless_now_ms);
+}
+
+EMSCRIPTEN_KEEPALIVE
+void watch_headless_advance(uint32_t ms) {
+    // step the virtual clock at the RTC's fastest tick (128 Hz) so callbacks at every
+    // frequency fire in order, running the app loop after each step like a real wake.
+    const double step = 1000.0 / 128.0;
+    double remaining = ms;
+    while (remaining > 0) {
+        double this_step = remaining < step ? remaining : step;
+        _watch_rtc_headless_advance(this_step);
+        _drain_app_loop();
+        remaining -= this_step;
+    }
+}
+
+EMSCRIPTEN_KEEPALIVE
+void watch_headless_fast_forward(uint32_t ms) {
+    // like watch_headless_advance, but hops from one pending callback to the next
+    // instead of stepping at 128 Hz — each hop lands exactly on the earliest due event,
+    // fires it, and runs the app loop, so ordering is preserved and a quiet day (one
+    // 1 Hz tick and a minute alarm) replays in tens of thousands of calls rather than
+    // eleven million clock steps. Callbacks a handler registers mid-hop (a face
+    // re-arming its scheduled task) are picked up when the next hop is computed.
+    double remaining = ms;
+    while (remaining > 0) {
+        double next = _watch_rtc_headless_next_due_ms();
+        if (next < 0 || next > remaining) {
+            // nothing due inside the window: one quiet jump to the end.
+            _watch_rtc_headless_advance(remaining);
+            _drain_app_loop();
+            break;
+        }
+        _watch_rtc_headless_advance(next > 0 ? next : 1e-6);
+        _drain_app_loop();
+        remaining -= (next > 0 ? next : 1e-6);
+    }
+}
+
+EMSCRIPTEN_KEEPALIVE
+void watch_headless_press(uint8_t button_id, bool down) {
+    _watch_extint_headless_press(button_id, down);
+    _drain_app_loop();
+}
+
+EMSCRIPTEN_KEEPALIVE
+void watch_headless_dump(void) {
+    // one line per frame: the three COM lines as 24-bit hex bitmaps. not human-readable,
+    // but byte-identical frames across two commits mean identical display behavior.
+    printf("FRAME");
+    for (uint8_t com = 0; com < 3; com++) {
+        uint32_t bits = 0;
+        for (uint8_t seg = 0; seg < 24; seg++) {
+            if (_watch_slcd_get_pixel(com, seg)) bits |= 1ul << seg;
+        }
+        printf(" %06lx", (unsigned long)bits);
+    }
+    printf("\n");
+    watch_energy_print();
+}
@@ -0,0 +1,51 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_HEADLESS_H_INCLUDED
+#define _WATCH_HEADLESS_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Headless batch mode for the simulator. Built with `make headless` (node, no browser),
+// the firmware is driven by a scripted event stream from watch-library/simulator/headless.js:
+// the RTC becomes a virtual clock the driver advances explicitly — firing due periodic
+// callbacks and alarms itself — so a simulated hour of wrist time replays in well under a
+// second, deterministically. Frames and counters go to stdout for diffing across commits.
+
+// exported to the node driver (ccall)
+void watch_headless_init(void);
+void watch_headless_advance(uint32_t ms);
+void watch_headless_fast_forward(uint32_t ms);
+void watch_headless_press(uint8_t button_id, bool down); // 1 = light, 2 = mode, 3 = alarm
+void watch_headless_dump(void);
+
+// private hooks the simulator HAL provides for the driver above
+void _watch_rtc_headless_enable(void);
+void _watch_rtc_headless_advance(double ms);
+double _watch_rtc_headless_next_due_ms(void);
+double _watch_rtc_headless_now_ms(void);
+void _watch_extint_headless_press(uint8_t button_id, bool down);
+bool _watch_slcd_get_pixel(uint8_t com, uint8_t seg);
+
+#endif
@@ -23,14 +23,28 @@
  */
 
 #include "watch_led.h"
+#include "watch_energy.h"
 
 #include <emscripten.h>
+#include <emscripten/html5.h>
+
+static uint8_t _auto_off_red, _auto_off_green;
+static uint8_t _fade_step;
+static long _em_timeout_id = 0;
+static long _em_fade_interval_id = 0;
+static long _em_blink_timeout_id = 0;
+static bool _blink_is_on;
+static uint8_t _blink_red, _blink_green;
+static uint16_t _blink_on_ms, _blink_off_ms;
+
+#define WATCH_LED_FADE_STEPS 8
 
 void watch_enable_leds(void) {}
 
 void watch_disable_leds(void) {}
 
 void watch_set_led_color(uint8_t red, uint8_t green) {
+    watch_energy_note_led(red, green);
     EM_ASM({
         // the watch svg contains an feColorMatrix filter with id ledcolor
         // and a green svg gradient that mimics the led being on
@@ -59,3 +73,66 @@ void watch_set_led_yellow(void) {
 void watch_set_led_off(void) {
     watch_set_led_color(0, 0);
 }
+
+static void _auto_off_fade_step(void *userData) {
+    (void) userData;
+    if (--_fade_step) {
+        watch_set_led_color((_auto_off_red * _fade_step) / WATCH_LED_FADE_STEPS,
+                            (_auto_off_green * _fade_step) / WATCH_LED_FADE_STEPS);
+    } else {
+        emscripten_clear_interval(_em_fade_interval_id);
+        _em_fade_interval_id = 0;
+        watch_set_led_off();
+    }
+}
+
+static void _auto_off_begin_fade(void *userData) {
+    (void) userData;
+    _em_timeout_id = 0;
+    if (watch_get_pin_level(BTN_LIGHT)) {
+        // the wearer is still holding the LIGHT button; give them another second.
+        _em_timeout_id = emscripten_set_timeout(_auto_off_begin_fade, 1000, NULL);
+        return;
+    }
+    _fade_step = WATCH_LED_FADE_STEPS;
+    _em_fade_interval_id = emscripten_set_interval(_auto_off_fade_step, (double)(1000 / 32), NULL);
+}
+
+void watch_led_illuminate_with_auto_off(uint8_t red, uint8_t green, uint16_t duration_ms) {
+    watch_led_blink_stop();
+    if (_em_timeout_id) emscripten_clear_timeout(_em_timeout_id);
+    if (_em_fade_interval_id) emscripten_clear_interval(_em_fade_interval_id);
+    _em_fade_interval_id = 0;
+    _auto_off_red = red;
+    _auto_off_green = green;
+    watch_set_led_color(red, green);
+    _em_timeout_id = emscripten_set_timeout(_auto_off_begin_fade, duration_ms, NULL);
+}
+
+static void _blink_toggle(void *userData) {
+    (void) userData;
+    _blink_is_on = !_blink_is_on;
+    if (_blink_is_on) watch_set_led_color(_blink_red, _blink_green);
+    else watch_set_led_off();
+    _em_blink_timeout_id = emscripten_set_timeout(_blink_toggle, _blink_is_on ? _blink_on_ms : _blink_off_ms, NULL);
+}
+
+void watch_led_blink_pattern(uint8_t red, uint8_t green, uint16_t on_ms, uint16_t off_ms) {
+    if (_em_blink_timeout_id) emscripten_clear_timeout(_em_blink_timeout_id);
+    _blink_red = red;
+    _blink_green = green;
+    _blink_on_ms = on_ms;
+    _blink_off_ms = off_ms;
+    // start with the LED lit, as a caller watching for the first blink would expect.
+    _blink_is_on = true;
+    watch_set_led_color(red, green);
+    _em_blink_timeout_id = emscripten_set_timeout(_blink_toggle, on_ms, NULL);
+}
+
+void watch_led_blink_stop(void) {
+    if (_em_blink_timeout_id) {
+        emscripten_clear_timeout(_em_blink_timeout_id);
+        _em_blink_timeout_id = 0;
+        watch_set_led_off();
+    }
+}
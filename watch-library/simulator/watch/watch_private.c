@@ -55,6 +55,10 @@ void _watch_enable_tcc(void) {}
 
 void _watch_disable_tcc(void) {}
 
+void _watch_request_tcc_runstdby(bool value) {
+    (void) value;
+}
+
 void _watch_enable_usb(void) {}
 
 // this function ends up getting called by printf to log stuff to the USB console.
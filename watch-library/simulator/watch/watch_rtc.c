@@ -23,13 +23,23 @@
  */
 
 #include "watch_rtc.h"
+#include "watch_headless.h"
 #include "watch_main_loop.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
 
 static double time_offset = 0;
-static long tick_callbacks[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+static long tick_interval_ids[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+// subscribers per frequency slot; the interval for a slot runs while it has at least one.
+static ext_irq_cb_t tick_callbacks[8][WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS];
+
+// headless mode: the clock is virtual and the batch driver advances it explicitly,
+// firing due callbacks itself instead of through wall-clock emscripten intervals.
+static bool headless = false;
+static double headless_now_ms = 0;
+static double headless_slot_acc_ms[8];
+static double headless_alarm_due_ms = -1;
 
 static long alarm_interval_id = -1;
 static long alarm_timeout_id = -1;
@@ -82,42 +92,91 @@ void watch_rtc_disable_tick_callback(void) {
 }
 
 static void watch_invoke_periodic_callback(void *userData) {
-    ext_irq_cb_t callback = userData;
-    callback();
+    uint8_t per_n = (uint8_t)(uintptr_t)userData;
+    for (int i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) {
+        if (tick_callbacks[per_n][i] != NULL) tick_callbacks[per_n][i]();
+    }
     resume_main_loop();
 }
 
+// maps a power-of-two frequency to its PERn slot: left-justify the frequency in a 32-bit integer
+// and count the leading zeroes. 0x01 (1 Hz) has 7 leading zeroes for PER7; 0x80 (128 Hz) has none
+// for PER0.
+static inline uint8_t _per_n_for_frequency(uint8_t frequency) {
+    return __builtin_clz((uint32_t)frequency << 24);
+}
+
+static void _start_interval_if_needed(uint8_t per_n, uint8_t frequency) {
+    if (headless) return; // the batch driver fires callbacks from the virtual clock
+    if (tick_interval_ids[per_n] == -1) {
+        double interval = 1000 / frequency; // in msec
+        tick_interval_ids[per_n] = emscripten_set_interval(watch_invoke_periodic_callback, interval, (void *)(uintptr_t)per_n);
+    }
+}
+
+static void _stop_interval(uint8_t per_n) {
+    if (tick_interval_ids[per_n] != -1) {
+        emscripten_clear_interval(tick_interval_ids[per_n]);
+        tick_interval_ids[per_n] = -1;
+    }
+}
+
+static bool _periodic_slot_has_subscribers(uint8_t per_n) {
+    for (int i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) {
+        if (tick_callbacks[per_n][i] != NULL) return true;
+    }
+    return false;
+}
+
 void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequency) {
     // we told them, it has to be a power of 2.
     if (__builtin_popcount(frequency) != 1) return;
 
-    // this left-justifies the period in a 32-bit integer.
-    uint32_t tmp = frequency << 24;
-    // now we can count the leading zeroes to get the value we need.
-    // 0x01 (1 Hz) will have 7 leading zeros for PER7. 0xF0 (128 Hz) will have no leading zeroes for PER0.
-    uint8_t per_n = __builtin_clz(tmp);
+    // the historical behavior of this function: replace all subscribers at this frequency.
+    uint8_t per_n = _per_n_for_frequency(frequency);
+    for (int i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) tick_callbacks[per_n][i] = NULL;
+    tick_callbacks[per_n][0] = callback;
+    _stop_interval(per_n);
+    _start_interval_if_needed(per_n, frequency);
+}
+
+bool watch_rtc_subscribe_periodic_callback(ext_irq_cb_t callback, uint8_t frequency) {
+    if (__builtin_popcount(frequency) != 1 || callback == NULL) return false;
+    uint8_t per_n = _per_n_for_frequency(frequency);
 
-    // this also maps nicely to an index for our list of tick callbacks.
-    double interval = 1000 / frequency; // in msec
+    int free_slot = -1;
+    for (int i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) {
+        if (tick_callbacks[per_n][i] == callback) return true; // already subscribed
+        if (tick_callbacks[per_n][i] == NULL && free_slot == -1) free_slot = i;
+    }
+    if (free_slot == -1) return false;
+    tick_callbacks[per_n][free_slot] = callback;
+    _start_interval_if_needed(per_n, frequency);
+    return true;
+}
 
-    if (tick_callbacks[per_n] != -1) emscripten_clear_interval(tick_callbacks[per_n]);
-    tick_callbacks[per_n] = emscripten_set_interval(watch_invoke_periodic_callback, interval, (void *)callback);
+void watch_rtc_unsubscribe_periodic_callback(ext_irq_cb_t callback, uint8_t frequency) {
+    if (__builtin_popcount(frequency) != 1) return;
+    uint8_t per_n = _per_n_for_frequency(frequency);
+    for (int i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) {
+        if (tick_callbacks[per_n][i] == callback) tick_callbacks[per_n][i] = NULL;
+    }
+    // only stop the interval when the last subscriber leaves.
+    if (!_periodic_slot_has_subscribers(per_n)) _stop_interval(per_n);
 }
 
 void watch_rtc_disable_periodic_callback(uint8_t frequency) {
     if (__builtin_popcount(frequency) != 1) return;
-    uint8_t per_n = __builtin_clz(frequency << 24);
-    if (tick_callbacks[per_n] != -1) {
-        emscripten_clear_interval(tick_callbacks[per_n]);
-        tick_callbacks[per_n] = -1;
-    }
+    uint8_t per_n = _per_n_for_frequency(frequency);
+    for (int i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) tick_callbacks[per_n][i] = NULL;
+    _stop_interval(per_n);
 }
 
 void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask) {
-    for (int i = 0; i < 8; i++) {
-        if (tick_callbacks[i] != -1 && (mask & (1 << (7 - i))) != 0) {
-            emscripten_clear_interval(tick_callbacks[i]);
-            tick_callbacks[i] = -1;
+    for (int per_n = 0; per_n < 8; per_n++) {
+        if ((mask & (1 << (7 - per_n))) != 0) {
+            for (int i = 0; i < WATCH_RTC_PERIODIC_SUBSCRIBER_SLOTS; i++) tick_callbacks[per_n][i] = NULL;
+            _stop_interval(per_n);
         }
     }
 }
@@ -126,6 +185,52 @@ void watch_rtc_disable_all_periodic_callbacks(void) {
     watch_rtc_disable_matching_periodic_callbacks(0xFF);
 }
 
+// the aligned tick has no prescaler to fight here: fire once at the next simulated-clock
+// second boundary (plus the offset the hardware version would apply), then every 1000 ms.
+static ext_irq_cb_t aligned_tick_callback;
+static long aligned_tick_timeout_id = -1;
+static long aligned_tick_interval_id = -1;
+
+static void watch_invoke_aligned_tick_callback(void *userData) {
+    if (aligned_tick_callback) aligned_tick_callback();
+    resume_main_loop();
+}
+
+static void watch_start_aligned_tick_interval(void *userData) {
+    aligned_tick_timeout_id = -1;
+    aligned_tick_interval_id = emscripten_set_interval(watch_invoke_aligned_tick_callback, 1000, NULL);
+    watch_invoke_aligned_tick_callback(NULL);
+}
+
+void watch_rtc_register_aligned_tick_callback(ext_irq_cb_t callback, uint8_t offset_sixteenths) {
+    watch_rtc_disable_aligned_tick_callback();
+    aligned_tick_callback = callback;
+    if (headless) {
+        // the virtual clock advances in whole callback periods, so a plain 1 Hz
+        // subscription is aligned by definition.
+        watch_rtc_subscribe_periodic_callback(callback, 1);
+        return;
+    }
+    double target_ms = 31.25 + 62.5 * (offset_sixteenths & 0xF);
+    double ms_into_second = EM_ASM_DOUBLE({ return (Date.now() + $0) % 1000; }, time_offset);
+    double delay = target_ms - ms_into_second;
+    if (delay < 0) delay += 1000;
+    aligned_tick_timeout_id = emscripten_set_timeout(watch_start_aligned_tick_interval, delay, NULL);
+}
+
+void watch_rtc_disable_aligned_tick_callback(void) {
+    if (aligned_tick_callback) watch_rtc_unsubscribe_periodic_callback(aligned_tick_callback, 1);
+    aligned_tick_callback = NULL;
+    if (aligned_tick_timeout_id != -1) {
+        emscripten_clear_timeout(aligned_tick_timeout_id);
+        aligned_tick_timeout_id = -1;
+    }
+    if (aligned_tick_interval_id != -1) {
+        emscripten_clear_interval(aligned_tick_interval_id);
+        aligned_tick_interval_id = -1;
+    }
+}
+
 static void watch_invoke_alarm_interval_callback(void *userData) {
     if (alarm_callback) alarm_callback();
 }
@@ -180,12 +285,80 @@ void watch_rtc_register_alarm_callback(ext_irq_cb_t callback, watch_date_time al
     }, time_offset, alarm_time.reg, mask);
 
     alarm_callback = callback;
+    if (headless) {
+        headless_alarm_due_ms = headless_now_ms + timeout;
+        return;
+    }
     alarm_timeout_id = emscripten_set_timeout(watch_invoke_alarm_callback, timeout, NULL);
 }
 
+void _watch_rtc_headless_enable(void) {
+    headless = true;
+    headless_now_ms = 0;
+    headless_alarm_due_ms = -1;
+    for (uint8_t per_n = 0; per_n < 8; per_n++) {
+        _stop_interval(per_n);
+        headless_slot_acc_ms[per_n] = 0;
+    }
+    if (alarm_timeout_id != -1) {
+        emscripten_clear_timeout(alarm_timeout_id);
+        alarm_timeout_id = -1;
+    }
+    if (alarm_interval_id != -1) {
+        emscripten_clear_interval(alarm_interval_id);
+        alarm_interval_id = -1;
+    }
+}
+
+double _watch_rtc_headless_now_ms(void) {
+    return headless_now_ms;
+}
+
+double _watch_rtc_headless_next_due_ms(void) {
+    // delay until the nearest pending callback — the next tick of any subscribed
+    // periodic slot, or the alarm match — or -1 if nothing is pending at all.
+    double best = -1;
+    for (uint8_t per_n = 0; per_n < 8; per_n++) {
+        if (!_periodic_slot_has_subscribers(per_n)) continue;
+        double period = 1000.0 / (1 << (7 - per_n));
+        double due = period - headless_slot_acc_ms[per_n];
+        if (due < 0) due = 0;
+        if (best < 0 || due < best) best = due;
+    }
+    if (alarm_callback && headless_alarm_due_ms >= 0) {
+        double due = headless_alarm_due_ms - headless_now_ms;
+        if (due < 0) due = 0;
+        if (best < 0 || due < best) best = due;
+    }
+    return best;
+}
+
+void _watch_rtc_headless_advance(double ms) {
+    headless_now_ms += ms;
+    time_offset += ms;
+    for (uint8_t per_n = 0; per_n < 8; per_n++) {
+        if (!_periodic_slot_has_subscribers(per_n)) {
+            headless_slot_acc_ms[per_n] = 0;
+            continue;
+        }
+        double period = 1000.0 / (1 << (7 - per_n));
+        headless_slot_acc_ms[per_n] += ms;
+        while (headless_slot_acc_ms[per_n] >= period) {
+            headless_slot_acc_ms[per_n] -= period;
+            watch_invoke_periodic_callback((void *)(uintptr_t)per_n);
+        }
+    }
+    if (alarm_callback && headless_alarm_due_ms >= 0 && headless_now_ms >= headless_alarm_due_ms) {
+        // repeating alarms re-arm at their match interval, like the interval timer would
+        headless_alarm_due_ms = alarm_interval ? headless_alarm_due_ms + alarm_interval : -1;
+        alarm_callback();
+    }
+}
+
 void watch_rtc_disable_alarm_callback(void) {
     alarm_callback = NULL;
     alarm_interval = 0;
+    headless_alarm_due_ms = -1;
 
     if (alarm_timeout_id != -1) {
         emscripten_clear_timeout(alarm_timeout_id);
@@ -207,3 +380,14 @@ void watch_rtc_freqcorr_write(int16_t value, int16_t sign)
 {
     //Not simulated
 }
+
+static watch_rtc_clock_source _clock_source = WATCH_RTC_CLOCK_XOSC32K;
+
+void watch_rtc_set_clock_source(watch_rtc_clock_source source) {
+    // no oscillators to switch here; just remember the answer for the getter.
+    _clock_source = source;
+}
+
+watch_rtc_clock_source watch_rtc_get_clock_source(void) {
+    return _clock_source;
+}
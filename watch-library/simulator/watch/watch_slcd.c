@@ -22,7 +22,11 @@
  * SOFTWARE.
  */
 
+#include <string.h>
+
 #include "watch_slcd.h"
+#include "watch_energy.h"
+#include "watch_headless.h"
 #include "watch_private_display.h"
 #include "hpl_slcd_config.h"
 
@@ -42,27 +46,152 @@ void watch_enable_display(void) {
     watch_clear_display();
 }
 
-void watch_set_pixel(uint8_t com, uint8_t seg) {
+// shadow of the pixel state, so redundant updates can skip the (comparatively slow) DOM query.
+// dimensions match the SAM L22's three COM lines and 24 SEG lines.
+static bool pixel_shadow[3][24];
+
+// when a display transaction is open, pixel writes land here and are flushed by
+// watch_display_commit; mirrors the register staging the hardware implementation does.
+static bool display_transaction_open = false;
+static bool pixel_staged[3][24];
+
+// Changed segments are queued here and posted to the DOM in one batch per frame: a
+// querySelectorAll round trip per segment made fast-tick faces choppy and let DOM cost
+// leak into timing measurements, and this is where render-path changes get benchmarked.
+// Each entry packs seg in bits 0-4, com in bits 5-6 and the new state in bit 7; a
+// segment touched twice in one frame just has its entry updated, so the queue can never
+// outgrow the segment map.
+#define DIRTY_QUEUE_SIZE (3 * 24)
+static uint8_t dirty_queue[DIRTY_QUEUE_SIZE];
+static uint8_t dirty_count;
+static bool flush_scheduled;
+
+static void _flush_dirty_segments(void *userData) {
+    (void) userData;
+    flush_scheduled = false;
+    if (dirty_count == 0) return;
     EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 1);
-    }, com, seg);
+        if (typeof document === 'undefined') return; // headless: the shadow is the display
+        // resolve every segment's element list once and keep the map on Module;
+        // per-frame work is then just the opacity assignments.
+        if (!Module.segElements) {
+            Module.segElements = {};
+            document.querySelectorAll("[data-com][data-seg]").forEach((e) => {
+                var key = e.getAttribute('data-com') + ',' + e.getAttribute('data-seg');
+                (Module.segElements[key] = Module.segElements[key] || []).push(e);
+            });
+        }
+        for (var i = 0; i < $1; i++) {
+            var entry = HEAPU8[$0 + i];
+            var key = ((entry >> 5) & 3) + ',' + (entry & 31);
+            var on = (entry & 0x80) ? 1 : 0;
+            (Module.segElements[key] || []).forEach((e) => e.style.opacity = on);
+        }
+    }, dirty_queue, dirty_count);
+    dirty_count = 0;
+}
+
+static void _apply_pixel(uint8_t com, uint8_t seg, bool on) {
+    if (com >= 3 || seg >= 24) return; // nothing on the canvas to match anyway
+    watch_energy_charge_slcd_write();
+    uint8_t entry = (com << 5) | seg;
+    for (uint8_t i = 0; i < dirty_count; i++) {
+        if ((dirty_queue[i] & 0x7F) == entry) {
+            dirty_queue[i] = entry | (on ? 0x80 : 0);
+            return;
+        }
+    }
+    dirty_queue[dirty_count++] = entry | (on ? 0x80 : 0);
+    if (!flush_scheduled) {
+        flush_scheduled = true;
+        // fires on the next turn of the event loop, before the browser paints.
+        emscripten_async_call(_flush_dirty_segments, NULL, 0);
+    }
+}
+
+bool _watch_slcd_get_pixel(uint8_t com, uint8_t seg) {
+    if (com < 3 && seg < 24) return pixel_shadow[com][seg];
+    return false;
+}
+
+void watch_set_pixel(uint8_t com, uint8_t seg) {
+    if (com < 3 && seg < 24) {
+        if (display_transaction_open) {
+            pixel_staged[com][seg] = true;
+            return;
+        }
+        if (pixel_shadow[com][seg]) return;
+        pixel_shadow[com][seg] = true;
+    }
+    _apply_pixel(com, seg, true);
 }
 
 void watch_clear_pixel(uint8_t com, uint8_t seg) {
-    EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 0);
-    }, com, seg);
+    if (com < 3 && seg < 24) {
+        if (display_transaction_open) {
+            pixel_staged[com][seg] = false;
+            return;
+        }
+        if (!pixel_shadow[com][seg]) return;
+        pixel_shadow[com][seg] = false;
+    }
+    _apply_pixel(com, seg, false);
+}
+
+void watch_display_begin(void) {
+    if (display_transaction_open) return;
+    memcpy(pixel_staged, pixel_shadow, sizeof(pixel_staged));
+    display_transaction_open = true;
+}
+
+void watch_display_commit(void) {
+    if (!display_transaction_open) return;
+    display_transaction_open = false;
+    for (uint8_t com = 0; com < 3; com++) {
+        for (uint8_t seg = 0; seg < 24; seg++) {
+            if (pixel_staged[com][seg] != pixel_shadow[com][seg]) {
+                pixel_shadow[com][seg] = pixel_staged[com][seg];
+                _apply_pixel(com, seg, pixel_shadow[com][seg]);
+            }
+        }
+    }
 }
 
 void watch_clear_display(void) {
+    memset(pixel_shadow, 0, sizeof(pixel_shadow));
+    dirty_count = 0; // anything still queued is superseded by the wholesale clear
     EM_ASM({
+        if (typeof document === 'undefined') return;
         document.querySelectorAll("[data-com][data-seg]")
             .forEach((e) => e.style.opacity = 0);
     });
 }
 
+// the simulator has no SLCD controller to drive; it just remembers the configuration so
+// that get-after-set round trips behave like hardware.
+static watch_lcd_drive_t lcd_drive = {
+    .contrast = CONF_SLCD_CONTRAST_ADJUST,
+    .prescaler = CONF_SLCD_PRESC,
+    .divider = CONF_SLCD_CKDIV,
+};
+
+void watch_get_lcd_drive(watch_lcd_drive_t *drive) {
+    *drive = lcd_drive;
+}
+
+void watch_set_lcd_drive(watch_lcd_drive_t *drive) {
+    lcd_drive.contrast = drive->contrast & 0xF;
+    lcd_drive.prescaler = drive->prescaler & 0x3;
+    lcd_drive.divider = drive->divider & 0x7;
+}
+
+// no drive hardware to slow down; the low power mode only exists on the glass.
+void watch_display_enter_low_power_mode(void) {
+}
+
+void watch_display_exit_low_power_mode(void) {
+}
+
 static void watch_invoke_blink_callback(void *userData) {
     blink_state = !blink_state;
     watch_display_character(blink_state ? blink_character : ' ', 7);
@@ -79,10 +208,46 @@ void watch_start_character_blink(char character, uint32_t duration) {
     blink_interval_id = emscripten_set_interval(watch_invoke_blink_callback, (double)duration, NULL);
 }
 
+// emulation of the hardware's selected-pixel blink: one interval toggles every pixel
+// in the mask, mirroring the single blink frame counter the SLCD has.
+static uint8_t pixel_blink_mask;
+static bool pixel_blink_state;
+static long pixel_blink_interval_id = -1;
+
+static void watch_invoke_pixel_blink_callback(void *userData) {
+    (void) userData;
+    pixel_blink_state = !pixel_blink_state;
+    for (uint8_t com = 0; com < 3; com++) {
+        for (uint8_t seg = 0; seg < 2; seg++) {
+            if (pixel_blink_mask & (1 << (com * 2 + seg))) {
+                if (pixel_blink_state) watch_set_pixel(com, seg);
+                else watch_clear_pixel(com, seg);
+            }
+        }
+    }
+}
+
+bool watch_start_pixel_blink(uint8_t com, uint8_t seg, uint32_t duration) {
+    if (com > 2 || seg > 1) return false;
+    watch_set_pixel(com, seg);
+    pixel_blink_mask |= 1 << (com * 2 + seg);
+    pixel_blink_state = true;
+    // later calls re-arm the shared interval, like reprogramming the frame counter.
+    if (pixel_blink_interval_id != -1) emscripten_clear_timeout(pixel_blink_interval_id);
+    pixel_blink_interval_id = emscripten_set_interval(watch_invoke_pixel_blink_callback, (double)duration, NULL);
+    return true;
+}
+
 void watch_stop_blink(void) {
     emscripten_clear_timeout(blink_interval_id);
     blink_interval_id = -1;
     blink_state = false;
+    if (pixel_blink_interval_id != -1) {
+        emscripten_clear_timeout(pixel_blink_interval_id);
+        pixel_blink_interval_id = -1;
+    }
+    pixel_blink_mask = 0;
+    pixel_blink_state = false;
 }
 
 static void watch_invoke_tick_callback(void *userData) {
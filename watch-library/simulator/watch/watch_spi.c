@@ -33,3 +33,8 @@ bool watch_spi_write(const uint8_t *buf, uint16_t length) { return false; }
 bool watch_spi_read(uint8_t *buf, uint16_t length) { return false; }
 
 bool watch_spi_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) { return false; }
+
+bool watch_spi_write_scatter(const uint8_t *header, uint16_t header_length, const uint8_t *payload, uint16_t payload_length) {
+    // no DMA to chain in the simulator; sequential writes are equivalent.
+    return watch_spi_write(header, header_length) && watch_spi_write(payload, payload_length);
+}
@@ -45,3 +45,21 @@ char watch_uart_getc(void) {
     }
     return 0;
 }
+
+// no simulated device ever transmits, so interrupt-driven receive reduces to an empty ring.
+void watch_uart_rx_enable(uint8_t *buffer, size_t size, size_t watermark, uint8_t terminator, watch_uart_rx_callback_t callback) {
+    (void) buffer;
+    (void) size;
+    (void) watermark;
+    (void) terminator;
+    (void) callback;
+}
+
+void watch_uart_rx_disable(void) {
+}
+
+size_t watch_uart_read_async(uint8_t *buf, size_t len) {
+    (void) buf;
+    (void) len;
+    return 0;
+}